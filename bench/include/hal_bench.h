@@ -0,0 +1,140 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_HAL_BENCH RDK-V WiFi HAL Benchmark Tool
+ * @{
+ * @parblock
+ *
+ * ### hal_bench :
+ *
+ * Standalone benchmark for libwifihal.so, built with `make hal_bench`. It
+ * links the same library and reads the same configuration file as hal_test
+ * but does not use the ut-core framework, so nothing but the HAL call and
+ * the timestamps around it runs inside a measured interval.
+ *
+ * @endparblock
+ */
+
+/**
+* @file hal_bench.h
+*
+*/
+
+#ifndef __HAL_BENCH_H__
+#define __HAL_BENCH_H__
+
+#include <stdint.h>
+#include <glib.h>
+#include "wifi_common_hal.h"
+#include "wifi_perf_stats.h"
+
+#define HAL_BENCH_DEFAULT_CONFIG "/opt/wifi_hal_l1_test_config"
+#define HAL_BENCH_DEFAULT_PROFILE "POSITIVE3_WPA2_PSK_AES_SECURITY_MODE"
+
+/**
+ * @brief Report format
+ */
+typedef enum
+{
+    HAL_BENCH_FORMAT_TEXT = 0,
+    HAL_BENCH_FORMAT_CSV
+} hal_bench_format_t;
+
+/**
+ * @brief Command line options shared by every subcommand
+ */
+typedef struct
+{
+    const char *config_path;    /*!< -c, configuration file shared with hal_test */
+    GKeyFile *key_file;         /*!< Loaded configuration, NULL if the file could not be read */
+    INT radio_index;            /*!< -r, radio index */
+    INT ssid_index;             /*!< -s, SSID index */
+    unsigned iterations;        /*!< -n, measured iterations */
+    unsigned warmup;            /*!< -w, unmeasured iterations run first */
+    unsigned threads;           /*!< -t, worker threads */
+    unsigned duration_s;        /*!< -d, run time in seconds */
+    unsigned interval_ms;       /*!< -i, sampling interval in milliseconds */
+    const char *apis;           /*!< -a, comma separated getter names, NULL for all */
+    const char *profile;        /*!< -p, connection profile group in the configuration file */
+    const char *freq_list;      /*!< -F, scanning frequency list */
+    hal_bench_format_t format;  /*!< -o, report format */
+    int rusage;                 /*!< -R, report the system cost per API after the run */
+    int cpu;                    /*!< -C, CPU the measuring thread is pinned to, -1 for none */
+    int fifo_priority;          /*!< -P, SCHED_FIFO priority of the measuring thread, 0 for none */
+    int raw;                    /*!< -N, report samples without subtracting overhead_ns */
+    uint64_t overhead_ns;       /*!< Median cost of one empty measurement, measured at start-up */
+} hal_bench_options_t;
+
+/**
+ * @brief Subcommand entry point
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+typedef int (*hal_bench_command_fn)(hal_bench_options_t *options);
+
+int hal_bench_latency(hal_bench_options_t *options);
+int hal_bench_scan(hal_bench_options_t *options);
+int hal_bench_stress(hal_bench_options_t *options);
+int hal_bench_connect(hal_bench_options_t *options);
+int hal_bench_soak(hal_bench_options_t *options);
+
+/**
+ * @brief Prints the header of a report table
+ */
+void hal_bench_report_header(const hal_bench_options_t *options);
+
+/**
+ * @brief Summarises a sample set and prints one report row
+ *
+ * @param[in]     options Options, selects the format
+ * @param[in]     label   Row label
+ * @param[in,out] samples Samples, sorted in place
+ * @param[in]     errors  Calls that did not return RETURN_OK
+ */
+void hal_bench_report(const hal_bench_options_t *options, const char *label, wifi_perf_samples_t *samples, unsigned errors);
+
+/**
+ * @brief Returns non-zero if a getter was selected with -a
+ *
+ * @param[in] options Options
+ * @param[in] name    HAL function name
+ */
+int hal_bench_api_selected(const hal_bench_options_t *options, const char *name);
+
+/**
+ * @brief Calls wifi_init() and reports its latency
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int hal_bench_hal_init(const hal_bench_options_t *options);
+
+/**
+ * @brief Calls wifi_uninit()
+ */
+void hal_bench_hal_uninit(void);
+
+#endif // __HAL_BENCH_H__
+
+/** @} */ // End of RDKV_WIFI_HAL_BENCH
+/** @} */ // End of RDKV_WIFI
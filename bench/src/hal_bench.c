@@ -0,0 +1,363 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HAL_BENCH RDK-V WiFi HAL Benchmark Tool
+ * @{
+ */
+
+/**
+* @file hal_bench.c
+*
+*/
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "hal_bench.h"
+#include "wifi_hal_alloc.h"
+#include "wifi_hal_api.h"
+#include "wifi_hal_rusage.h"
+#include "wifi_hal_spawn.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stability.h"
+
+#define OVERHEAD_ITERATIONS 100000
+
+typedef struct
+{
+    const char *name;
+    hal_bench_command_fn run;
+    const char *help;
+} hal_bench_command_t;
+
+static const hal_bench_command_t commands[] = {
+    { "latency", hal_bench_latency, "per-getter latency distribution (-n, -w, -a)" },
+    { "scan",    hal_bench_scan,    "neighbor scan latency, direct and cached (-n, -F)" },
+    { "stress",  hal_bench_stress,  "getters from several threads at once (-t, -d, -a)" },
+    { "connect", hal_bench_connect, "connect and disconnect time of a configured profile (-n, -p)" },
+    { "soak",    hal_bench_soak,    "periodic getters over a long run, per-minute drift and memory (-d, -i, -a)" },
+};
+
+#define COMMAND_COUNT (sizeof(commands) / sizeof(commands[0]))
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s <command> [options]\n\nCommands:\n", prog);
+    for (size_t i = 0; i < COMMAND_COUNT; i++)
+    {
+        fprintf(stderr, "  %-8s %s\n", commands[i].name, commands[i].help);
+    }
+    fprintf(stderr,
+            "\nOptions:\n"
+            "  -c <file>   configuration file (default %s)\n"
+            "  -r <index>  radio index (default 1)\n"
+            "  -s <index>  SSID index (default 1)\n"
+            "  -n <count>  measured iterations (default 1000, connect/scan 10)\n"
+            "  -w <count>  warm-up iterations (default 10)\n"
+            "  -t <count>  threads (default 8)\n"
+            "  -d <secs>   duration (default 10, soak 3600)\n"
+            "  -i <ms>     sampling interval (default 1000)\n"
+            "  -a <list>   comma separated getters, e.g. wifi_getRadioChannel,wifi_getStats\n"
+            "  -p <group>  connection profile in the configuration file (default %s)\n"
+            "  -F <list>   scanning frequency list passed to wifi_setRadioScanningFreqList()\n"
+            "  -o <fmt>    text or csv (default text)\n"
+            "  -R          also report context switches, CPU time, page faults and hardware counters per API\n"
+            "  -C <cpu>    pin the measuring thread to a CPU, stress workers to the following ones\n"
+            "  -P <prio>   run the measuring thread at SCHED_FIFO with this priority (1-99, needs CAP_SYS_NICE)\n"
+            "  -N          report raw samples, without subtracting the measurement overhead\n",
+            HAL_BENCH_DEFAULT_CONFIG, HAL_BENCH_DEFAULT_PROFILE);
+}
+
+/*
+ * Times an empty call through the wrapper hooks with exactly the loop the
+ * subcommands use around a HAL call, so the overhead covers the clock reads
+ * and whatever tracing, heap, process start and system cost hooks this run
+ * enabled. The hooks' records of these calls are dropped afterwards.
+ */
+static void measure_overhead(hal_bench_options_t *options)
+{
+    int (*volatile call)(wifi_hal_api_t) = wifi_hal_wrap_empty_call;
+    wifi_perf_samples_t samples;
+    wifi_perf_summary_t summary;
+
+    wifi_perf_samples_init(&samples, OVERHEAD_ITERATIONS);
+    for (unsigned i = 0; i < OVERHEAD_ITERATIONS; i++)
+    {
+        uint64_t start = wifi_perf_now_ns();
+        call(WIFI_HAL_API_wifi_getHalVersion);
+        wifi_perf_samples_add(&samples, wifi_perf_now_ns() - start);
+    }
+    wifi_perf_summarize(&samples, &summary);
+    wifi_trace_reset();
+    wifi_alloc_reset();
+    wifi_spawn_reset();
+    wifi_rusage_reset();
+
+    /* Reported before overhead_ns is set, so this row is never subtracted from itself */
+    hal_bench_report_header(options);
+    hal_bench_report(options, "measurement overhead", &samples, 0);
+    options->overhead_ns = (uint64_t)summary.p50;
+    if (options->format == HAL_BENCH_FORMAT_TEXT)
+    {
+        printf("clock_gettime() pair: %llu ns\n", (unsigned long long)wifi_perf_clock_overhead_ns(OVERHEAD_ITERATIONS));
+        printf("%llu ns of measurement overhead (clock reads and wrapper hooks) %s every sample below\n",
+               (unsigned long long)options->overhead_ns, options->raw ? "is included in" : "has been subtracted from");
+    }
+    wifi_perf_samples_free(&samples);
+}
+
+void hal_bench_report_header(const hal_bench_options_t *options)
+{
+    if (options->format == HAL_BENCH_FORMAT_CSV)
+    {
+        printf("label,count,errors,min_us,p50_us,p90_us,p99_us,max_us,mean_us,cv\n");
+    }
+}
+
+void hal_bench_report(const hal_bench_options_t *options, const char *label, wifi_perf_samples_t *samples, unsigned errors)
+{
+    wifi_perf_summary_t summary;
+    char line[256];
+
+    if (!options->raw)
+    {
+        wifi_perf_samples_subtract(samples, options->overhead_ns);
+    }
+    wifi_perf_summarize(samples, &summary);
+    if (options->format == HAL_BENCH_FORMAT_CSV)
+    {
+        printf("%s,%zu,%u,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.4f\n", label, summary.count, errors,
+               summary.min / 1000.0, summary.p50 / 1000.0, summary.p90 / 1000.0, summary.p99 / 1000.0,
+               summary.max / 1000.0, summary.mean / 1000.0, summary.cv);
+    }
+    else
+    {
+        printf("%s errors=%u%s\n", wifi_perf_format_summary(line, sizeof(line), label, &summary), errors,
+               (summary.cv > WIFI_PERF_CV_LIMIT) ? " unstable" : "");
+    }
+    fflush(stdout);
+}
+
+int hal_bench_api_selected(const hal_bench_options_t *options, const char *name)
+{
+    const char *pos;
+    size_t len = strlen(name);
+
+    if (options->apis == NULL)
+    {
+        return 1;
+    }
+    for (pos = strstr(options->apis, name); pos != NULL; pos = strstr(pos + 1, name))
+    {
+        if ((pos == options->apis || pos[-1] == ',') && (pos[len] == '\0' || pos[len] == ','))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int hal_bench_hal_init(const hal_bench_options_t *options)
+{
+    uint64_t start = wifi_perf_now_ns();
+    INT ret = wifi_init();
+
+    if (ret != RETURN_OK)
+    {
+        fprintf(stderr, "wifi_init() failed: %d\n", ret);
+        return -1;
+    }
+    if (options->format == HAL_BENCH_FORMAT_TEXT)
+    {
+        printf("wifi_init() took %.3f ms\n", (wifi_perf_now_ns() - start) / 1e6);
+    }
+    return 0;
+}
+
+void hal_bench_hal_uninit(void)
+{
+    if (wifi_uninit() != RETURN_OK)
+    {
+        fprintf(stderr, "wifi_uninit() failed\n");
+    }
+}
+
+/* Applies -C and -P to the calling thread, which every subcommand measures from */
+static void apply_stability(const hal_bench_options_t *options)
+{
+    if (options->cpu >= 0)
+    {
+        if (wifi_perf_pin_cpu(options->cpu) != 0)
+        {
+            fprintf(stderr, "Cannot pin to CPU %d: %s\n", options->cpu, strerror(errno));
+        }
+        else if (options->format == HAL_BENCH_FORMAT_TEXT)
+        {
+            printf("Pinned to CPU %d\n", options->cpu);
+        }
+    }
+    if (options->fifo_priority > 0)
+    {
+        if (wifi_perf_set_fifo(options->fifo_priority) != 0)
+        {
+            fprintf(stderr, "Cannot run at SCHED_FIFO priority %d: %s\n", options->fifo_priority, strerror(errno));
+        }
+        else if (options->format == HAL_BENCH_FORMAT_TEXT)
+        {
+            printf("Running at SCHED_FIFO priority %d\n", options->fifo_priority);
+        }
+    }
+}
+
+static GKeyFile *load_config(const char *path)
+{
+    GError *error = NULL;
+    GKeyFile *key_file = g_key_file_new();
+
+    if (key_file == NULL)
+    {
+        return NULL;
+    }
+    if (!g_key_file_load_from_file(key_file, path, G_KEY_FILE_KEEP_COMMENTS, &error))
+    {
+        fprintf(stderr, "Failed to read %s: %s\n", path, (error != NULL) ? error->message : "unknown error");
+        g_key_file_free(key_file);
+        return NULL;
+    }
+    return key_file;
+}
+
+int main(int argc, char **argv)
+{
+    hal_bench_options_t options;
+    const hal_bench_command_t *command = NULL;
+    int opt;
+    int ret;
+
+    if (argc < 2)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    for (size_t i = 0; i < COMMAND_COUNT; i++)
+    {
+        if (strcmp(argv[1], commands[i].name) == 0)
+        {
+            command = &commands[i];
+        }
+    }
+    if (command == NULL)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    memset(&options, 0, sizeof(options));
+    options.config_path = HAL_BENCH_DEFAULT_CONFIG;
+    options.radio_index = 1;
+    options.ssid_index = 1;
+    options.warmup = 10;
+    options.threads = 8;
+    options.interval_ms = 1000;
+    options.profile = HAL_BENCH_DEFAULT_PROFILE;
+    options.cpu = -1;
+
+    optind = 2;
+    while ((opt = getopt(argc, argv, "c:r:s:n:w:t:d:i:a:p:F:o:C:P:NRh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'c': options.config_path = optarg; break;
+            case 'r': options.radio_index = atoi(optarg); break;
+            case 's': options.ssid_index = atoi(optarg); break;
+            case 'n': options.iterations = (unsigned)strtoul(optarg, NULL, 0); break;
+            case 'w': options.warmup = (unsigned)strtoul(optarg, NULL, 0); break;
+            case 't': options.threads = (unsigned)strtoul(optarg, NULL, 0); break;
+            case 'd': options.duration_s = (unsigned)strtoul(optarg, NULL, 0); break;
+            case 'i': options.interval_ms = (unsigned)strtoul(optarg, NULL, 0); break;
+            case 'a': options.apis = optarg; break;
+            case 'p': options.profile = optarg; break;
+            case 'F': options.freq_list = optarg; break;
+            case 'R': options.rusage = 1; break;
+            case 'C': options.cpu = atoi(optarg); break;
+            case 'P': options.fifo_priority = atoi(optarg); break;
+            case 'N': options.raw = 1; break;
+            case 'o':
+                if (strcmp(optarg, "csv") == 0)
+                {
+                    options.format = HAL_BENCH_FORMAT_CSV;
+                }
+                else if (strcmp(optarg, "text") != 0)
+                {
+                    usage(argv[0]);
+                    return 1;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    if (options.threads == 0 || options.interval_ms == 0)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    options.key_file = load_config(options.config_path);
+
+    /* Tracing is enabled by WIFI_HAL_TRACE=<file>, see wifi_hal_trace.h */
+    wifi_trace_init_from_env();
+    /* Heap accounting is enabled by WIFI_HAL_ALLOC=1, see wifi_hal_alloc.h */
+    wifi_alloc_init_from_env();
+    /* Process start detection is enabled by WIFI_HAL_SPAWN=1, see wifi_hal_spawn.h */
+    wifi_spawn_init_from_env();
+    /* Per-call system cost is enabled by WIFI_HAL_RUSAGE=1, see wifi_hal_rusage.h */
+    wifi_rusage_init_from_env();
+
+    /* WIFI_HAL_RUSAGE=1 also works, -R reports in the selected format */
+    if (options.rusage)
+    {
+        wifi_rusage_enable(1);
+    }
+    /* Measured with the hooks of the run enabled, under the same scheduling */
+    apply_stability(&options);
+    measure_overhead(&options);
+    ret = command->run(&options);
+    if (options.rusage)
+    {
+        wifi_rusage_enable(0);
+        wifi_rusage_report(options.format == HAL_BENCH_FORMAT_CSV);
+    }
+
+    wifi_trace_finish();
+    wifi_alloc_finish();
+    wifi_spawn_finish();
+    wifi_rusage_finish();
+    if (options.key_file != NULL)
+    {
+        g_key_file_free(options.key_file);
+    }
+    return (ret == 0) ? 0 : 1;
+}
+
+/** @} */ // End of RDKV_WIFI_HAL_BENCH
@@ -0,0 +1,265 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HAL_BENCH RDK-V WiFi HAL Benchmark Tool
+ * @{
+ */
+
+/**
+* @file hal_bench_connect.c
+*
+* `hal_bench connect`: connects to and disconnects from the access point of
+* a profile in the configuration file (same keys as the hal_test connection
+* tests) and reports how long each call takes to return and how long until
+* the HAL reports the new state through its callbacks. The profile group may
+* also set SECURITY_MODE to a wifiSecurityMode_t value, WPA2-PSK AES otherwise.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include "hal_bench.h"
+#include "wifi_client_hal.h"
+#include "wifi_perf_clock.h"
+
+#define CONNECT_DEFAULT_ITERATIONS 10
+#define CONNECT_TIMEOUT_S 30
+
+typedef struct
+{
+    gchar *ssid;
+    gchar *wep_key;
+    gchar *psk;
+    gchar *passphrase;
+    gchar *eap_identity;
+    gchar *ca_root_cert;
+    gchar *client_cert;
+    gchar *private_key;
+    wifiSecurityMode_t security_mode;
+} connect_profile_t;
+
+static pthread_mutex_t event_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t event_cond = PTHREAD_COND_INITIALIZER;
+static wifiStatusCode_t last_status = WIFI_HAL_SUCCESS;
+static uint64_t last_event_ns = 0;
+static unsigned event_count = 0;
+
+static void record_event(wifiStatusCode_t *status)
+{
+    pthread_mutex_lock(&event_lock);
+    last_status = (status != NULL) ? *status : WIFI_HAL_ERROR_UNKNOWN;
+    last_event_ns = wifi_perf_now_ns();
+    event_count++;
+    pthread_cond_broadcast(&event_cond);
+    pthread_mutex_unlock(&event_lock);
+}
+
+static INT connect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *status)
+{
+    (void)ssidIndex;
+    (void)AP_SSID;
+    record_event(status);
+    return RETURN_OK;
+}
+
+static INT disconnect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *status)
+{
+    (void)ssidIndex;
+    (void)AP_SSID;
+    record_event(status);
+    return RETURN_OK;
+}
+
+/* Waits for the callback to report want, returns the time it was reported or 0 on timeout */
+static uint64_t wait_for_status(wifiStatusCode_t want)
+{
+    struct timespec deadline;
+    uint64_t when = 0;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += CONNECT_TIMEOUT_S;
+
+    pthread_mutex_lock(&event_lock);
+    while (last_status != want)
+    {
+        if (pthread_cond_timedwait(&event_cond, &event_lock, &deadline) == ETIMEDOUT)
+        {
+            break;
+        }
+    }
+    if (last_status == want)
+    {
+        when = last_event_ns;
+    }
+    pthread_mutex_unlock(&event_lock);
+    return when;
+}
+
+static void reset_status(void)
+{
+    pthread_mutex_lock(&event_lock);
+    last_status = WIFI_HAL_SUCCESS;
+    pthread_mutex_unlock(&event_lock);
+}
+
+static int load_profile(const hal_bench_options_t *options, connect_profile_t *profile)
+{
+    GKeyFile *key_file = options->key_file;
+    const char *group = options->profile;
+    GError *error = NULL;
+    gint mode;
+
+    memset(profile, 0, sizeof(*profile));
+    if (key_file == NULL || !g_key_file_has_group(key_file, group))
+    {
+        fprintf(stderr, "Profile %s not found in %s\n", group, options->config_path);
+        return -1;
+    }
+    profile->ssid = g_key_file_get_string(key_file, group, "AP_SSID", NULL);
+    profile->wep_key = g_key_file_get_string(key_file, group, "WEP_KEY", NULL);
+    profile->psk = g_key_file_get_string(key_file, group, "PRESHAREDKEY", NULL);
+    profile->passphrase = g_key_file_get_string(key_file, group, "PASSPHRASE", NULL);
+    profile->eap_identity = g_key_file_get_string(key_file, group, "EAP_IDENTITY", NULL);
+    profile->ca_root_cert = g_key_file_get_string(key_file, group, "CA_ROOT_CERT", NULL);
+    profile->client_cert = g_key_file_get_string(key_file, group, "CLIENT_CERT", NULL);
+    profile->private_key = g_key_file_get_string(key_file, group, "PRIVATE_KEY", NULL);
+    mode = g_key_file_get_integer(key_file, group, "SECURITY_MODE", &error);
+    profile->security_mode = (error == NULL) ? (wifiSecurityMode_t)mode : WIFI_SECURITY_WPA2_PSK_AES;
+    if (error != NULL)
+    {
+        g_error_free(error);
+    }
+    if (profile->ssid == NULL)
+    {
+        fprintf(stderr, "Profile %s has no AP_SSID\n", group);
+        return -1;
+    }
+    return 0;
+}
+
+static void free_profile(connect_profile_t *profile)
+{
+    g_free(profile->ssid);
+    g_free(profile->wep_key);
+    g_free(profile->psk);
+    g_free(profile->passphrase);
+    g_free(profile->eap_identity);
+    g_free(profile->ca_root_cert);
+    g_free(profile->client_cert);
+    g_free(profile->private_key);
+}
+
+int hal_bench_connect(hal_bench_options_t *options)
+{
+    unsigned iterations = (options->iterations != 0) ? options->iterations : CONNECT_DEFAULT_ITERATIONS;
+    connect_profile_t profile;
+    wifi_perf_samples_t connect_call;
+    wifi_perf_samples_t connected;
+    wifi_perf_samples_t disconnect_call;
+    wifi_perf_samples_t disconnected;
+    unsigned connect_errors = 0;
+    unsigned connect_timeouts = 0;
+    unsigned disconnect_errors = 0;
+    unsigned disconnect_timeouts = 0;
+
+    if (load_profile(options, &profile) != 0)
+    {
+        free_profile(&profile);
+        return -1;
+    }
+    if (hal_bench_hal_init(options) != 0)
+    {
+        free_profile(&profile);
+        return -1;
+    }
+    wifi_connectEndpoint_callback_register(connect_callback);
+    wifi_disconnectEndpoint_callback_register(disconnect_callback);
+
+    wifi_perf_samples_init(&connect_call, iterations);
+    wifi_perf_samples_init(&connected, iterations);
+    wifi_perf_samples_init(&disconnect_call, iterations);
+    wifi_perf_samples_init(&disconnected, iterations);
+
+    for (unsigned n = 0; n < iterations; n++)
+    {
+        uint64_t start;
+        uint64_t when;
+        INT ret;
+
+        reset_status();
+        start = wifi_perf_now_ns();
+        ret = wifi_connectEndpoint(options->ssid_index, profile.ssid, profile.security_mode, profile.wep_key,
+                                   profile.psk, profile.passphrase, 0, profile.eap_identity,
+                                   profile.ca_root_cert, profile.client_cert, profile.private_key);
+        wifi_perf_samples_add(&connect_call, wifi_perf_now_ns() - start);
+        if (ret != RETURN_OK)
+        {
+            connect_errors++;
+            continue;
+        }
+        when = wait_for_status(WIFI_HAL_CONNECTED);
+        if (when == 0)
+        {
+            connect_timeouts++;
+        }
+        else
+        {
+            wifi_perf_samples_add(&connected, when - start);
+        }
+
+        reset_status();
+        start = wifi_perf_now_ns();
+        ret = wifi_disconnectEndpoint(options->ssid_index, profile.ssid);
+        wifi_perf_samples_add(&disconnect_call, wifi_perf_now_ns() - start);
+        if (ret != RETURN_OK)
+        {
+            disconnect_errors++;
+            continue;
+        }
+        when = wait_for_status(WIFI_HAL_DISCONNECTED);
+        if (when == 0)
+        {
+            disconnect_timeouts++;
+        }
+        else
+        {
+            wifi_perf_samples_add(&disconnected, when - start);
+        }
+    }
+
+    hal_bench_report(options, "wifi_connectEndpoint return", &connect_call, connect_errors);
+    hal_bench_report(options, "connect to WIFI_HAL_CONNECTED", &connected, connect_timeouts);
+    hal_bench_report(options, "wifi_disconnectEndpoint return", &disconnect_call, disconnect_errors);
+    hal_bench_report(options, "disconnect to WIFI_HAL_DISCONNECTED", &disconnected, disconnect_timeouts);
+    if (options->format == HAL_BENCH_FORMAT_TEXT)
+    {
+        printf("%u callbacks received, timeout %d s\n", event_count, CONNECT_TIMEOUT_S);
+    }
+
+    wifi_perf_samples_free(&connect_call);
+    wifi_perf_samples_free(&connected);
+    wifi_perf_samples_free(&disconnect_call);
+    wifi_perf_samples_free(&disconnected);
+    free_profile(&profile);
+    hal_bench_hal_uninit();
+    return (connect_errors == 0 && connect_timeouts == 0) ? 0 : -1;
+}
+
+/** @} */ // End of RDKV_WIFI_HAL_BENCH
@@ -0,0 +1,85 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HAL_BENCH RDK-V WiFi HAL Benchmark Tool
+ * @{
+ */
+
+/**
+* @file hal_bench_latency.c
+*
+* `hal_bench latency`: latency distribution of each read-only getter,
+* called back to back from a single thread.
+*/
+
+#include <stdio.h>
+#include "hal_bench.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_probe.h"
+
+#define LATENCY_DEFAULT_ITERATIONS 1000
+
+int hal_bench_latency(hal_bench_options_t *options)
+{
+    const wifi_perf_probe_t *probes;
+    wifi_perf_samples_t samples;
+    unsigned iterations = (options->iterations != 0) ? options->iterations : LATENCY_DEFAULT_ITERATIONS;
+    size_t count;
+
+    if (hal_bench_hal_init(options) != 0)
+    {
+        return -1;
+    }
+    probes = wifi_perf_probes(&count);
+    wifi_perf_samples_init(&samples, iterations);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const char *name = wifi_hal_api_name(probes[i].api);
+        unsigned errors = 0;
+
+        if (!hal_bench_api_selected(options, name))
+        {
+            continue;
+        }
+        for (unsigned w = 0; w < options->warmup; w++)
+        {
+            probes[i].call(options->radio_index, options->ssid_index);
+        }
+        wifi_perf_samples_clear(&samples);
+        for (unsigned n = 0; n < iterations; n++)
+        {
+            uint64_t start = wifi_perf_now_ns();
+            INT ret = probes[i].call(options->radio_index, options->ssid_index);
+
+            wifi_perf_samples_add(&samples, wifi_perf_now_ns() - start);
+            if (ret != RETURN_OK)
+            {
+                errors++;
+            }
+        }
+        hal_bench_report(options, name, &samples, errors);
+    }
+
+    wifi_perf_samples_free(&samples);
+    hal_bench_hal_uninit();
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_HAL_BENCH
@@ -0,0 +1,139 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HAL_BENCH RDK-V WiFi HAL Benchmark Tool
+ * @{
+ */
+
+/**
+* @file hal_bench_scan.c
+*
+* `hal_bench scan`: neighbor scan latency. With -F the scan is started with
+* wifi_setRadioScanningFreqList() and wifi_waitForScanResults() first and
+* each phase is reported separately. The same number of scans is then run
+* through the scan cache to show what a shared cache saves.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "hal_bench.h"
+#include "wifi_perf_clock.h"
+#include "wifi_scan_cache.h"
+
+#define SCAN_DEFAULT_ITERATIONS 10
+
+typedef INT (*scan_fn)(INT radioIndex, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size);
+
+static void run_scans(const hal_bench_options_t *options, const char *label, scan_fn scan, unsigned iterations)
+{
+    wifi_perf_samples_t samples;
+    unsigned errors = 0;
+    unsigned long aps = 0;
+
+    wifi_perf_samples_init(&samples, iterations);
+    for (unsigned n = 0; n < iterations; n++)
+    {
+        wifi_neighbor_ap_t *array = NULL;
+        UINT size = 0;
+        uint64_t start = wifi_perf_now_ns();
+        INT ret = scan(options->radio_index, &array, &size);
+
+        wifi_perf_samples_add(&samples, wifi_perf_now_ns() - start);
+        if (ret != RETURN_OK)
+        {
+            errors++;
+        }
+        else
+        {
+            aps += size;
+        }
+        free(array);
+    }
+    hal_bench_report(options, label, &samples, errors);
+    if (options->format == HAL_BENCH_FORMAT_TEXT && iterations > errors)
+    {
+        printf("%-40s %.1f APs per scan\n", "", (double)aps / (double)(iterations - errors));
+    }
+    wifi_perf_samples_free(&samples);
+}
+
+static void run_triggered_scans(const hal_bench_options_t *options, unsigned iterations)
+{
+    wifi_perf_samples_t trigger;
+    wifi_perf_samples_t wait;
+    unsigned trigger_errors = 0;
+    unsigned wait_errors = 0;
+
+    wifi_perf_samples_init(&trigger, iterations);
+    wifi_perf_samples_init(&wait, iterations);
+    for (unsigned n = 0; n < iterations; n++)
+    {
+        uint64_t start = wifi_perf_now_ns();
+
+        if (wifi_setRadioScanningFreqList(options->radio_index, options->freq_list) != RETURN_OK)
+        {
+            trigger_errors++;
+        }
+        wifi_perf_samples_add(&trigger, wifi_perf_now_ns() - start);
+        start = wifi_perf_now_ns();
+        if (wifi_waitForScanResults() != RETURN_OK)
+        {
+            wait_errors++;
+        }
+        wifi_perf_samples_add(&wait, wifi_perf_now_ns() - start);
+    }
+    hal_bench_report(options, "wifi_setRadioScanningFreqList", &trigger, trigger_errors);
+    hal_bench_report(options, "wifi_waitForScanResults", &wait, wait_errors);
+    wifi_perf_samples_free(&trigger);
+    wifi_perf_samples_free(&wait);
+}
+
+int hal_bench_scan(hal_bench_options_t *options)
+{
+    unsigned iterations = (options->iterations != 0) ? options->iterations : SCAN_DEFAULT_ITERATIONS;
+    wifi_scan_cache_stats_t stats;
+
+    if (hal_bench_hal_init(options) != 0)
+    {
+        return -1;
+    }
+
+    if (options->freq_list != NULL)
+    {
+        run_triggered_scans(options, iterations);
+    }
+    run_scans(options, "wifi_getNeighboringWiFiDiagnosticResult", wifi_getNeighboringWiFiDiagnosticResult, iterations);
+
+    if (wifi_scan_cache_init(NULL) == RETURN_OK)
+    {
+        run_scans(options, "scan cache", wifi_scan_cache_getNeighboringWiFiDiagnosticResult, iterations);
+        wifi_scan_cache_get_stats(&stats);
+        if (options->format == HAL_BENCH_FORMAT_TEXT)
+        {
+            printf("%-40s hit rate %.1f%%, %llu scans issued\n", "", wifi_scan_cache_hit_rate(&stats) * 100.0,
+                   (unsigned long long)stats.scans);
+        }
+        wifi_scan_cache_deinit();
+    }
+
+    hal_bench_hal_uninit();
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_HAL_BENCH
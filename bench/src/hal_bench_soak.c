@@ -0,0 +1,187 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HAL_BENCH RDK-V WiFi HAL Benchmark Tool
+ * @{
+ */
+
+/**
+* @file hal_bench_soak.c
+*
+* `hal_bench soak`: calls each selected getter once per interval for the
+* whole run, the way a middleware poller would. Prints one row per minute
+* with the latency of that minute and the resident set size of the process,
+* then per-getter totals and the drift between the first and last minute.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "hal_bench.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_probe.h"
+
+#define SOAK_DEFAULT_DURATION_S 3600
+#define SOAK_WINDOW_S 60
+
+/* Resident set size in kB, 0 if /proc is not available */
+static long resident_kb(void)
+{
+    FILE *file = fopen("/proc/self/statm", "r");
+    long size = 0;
+    long resident = 0;
+
+    if (file == NULL)
+    {
+        return 0;
+    }
+    if (fscanf(file, "%ld %ld", &size, &resident) != 2)
+    {
+        resident = 0;
+    }
+    fclose(file);
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+static void report_window(const hal_bench_options_t *options, wifi_perf_samples_t *window, unsigned *window_errors,
+                          unsigned window_index, double *first_p50, double *last_p50)
+{
+    wifi_perf_summary_t summary;
+    char label[64];
+
+    snprintf(label, sizeof(label), "minute %u rss=%ldkB", window_index + 1, resident_kb());
+    hal_bench_report(options, label, window, *window_errors);
+    /* After the report, which has already taken off the measurement overhead */
+    wifi_perf_summarize(window, &summary);
+    if (window_index == 0)
+    {
+        *first_p50 = summary.p50;
+    }
+    *last_p50 = summary.p50;
+    wifi_perf_samples_clear(window);
+    *window_errors = 0;
+}
+
+int hal_bench_soak(hal_bench_options_t *options)
+{
+    unsigned duration_s = (options->duration_s != 0) ? options->duration_s : SOAK_DEFAULT_DURATION_S;
+    const wifi_perf_probe_t *all;
+    wifi_perf_samples_t *totals;
+    unsigned *errors;
+    wifi_perf_samples_t window;
+    size_t count;
+    unsigned window_index = 0;
+    unsigned window_errors = 0;
+    double first_p50 = 0.0;
+    double last_p50 = 0.0;
+    long first_rss;
+    long last_rss;
+    uint64_t begin;
+    uint64_t end;
+    uint64_t next;
+    uint64_t now;
+    uint64_t window_end;
+
+    all = wifi_perf_probes(&count);
+    totals = calloc(count, sizeof(wifi_perf_samples_t));
+    errors = calloc(count, sizeof(unsigned));
+    if (totals == NULL || errors == NULL || hal_bench_hal_init(options) != 0)
+    {
+        free(totals);
+        free(errors);
+        return -1;
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        wifi_perf_samples_init(&totals[i], 0);
+    }
+    wifi_perf_samples_init(&window, 0);
+
+    first_rss = resident_kb();
+    begin = wifi_perf_now_ns();
+    end = begin + duration_s * WIFI_PERF_NS_PER_SEC;
+    window_end = begin + SOAK_WINDOW_S * WIFI_PERF_NS_PER_SEC;
+    next = begin;
+
+    while (wifi_perf_now_ns() < end)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            uint64_t start;
+            uint64_t elapsed;
+            INT ret;
+
+            if (!hal_bench_api_selected(options, wifi_hal_api_name(all[i].api)))
+            {
+                continue;
+            }
+            start = wifi_perf_now_ns();
+            ret = all[i].call(options->radio_index, options->ssid_index);
+            elapsed = wifi_perf_now_ns() - start;
+            wifi_perf_samples_add(&totals[i], elapsed);
+            wifi_perf_samples_add(&window, elapsed);
+            if (ret != RETURN_OK)
+            {
+                errors[i]++;
+                window_errors++;
+            }
+        }
+
+        if (wifi_perf_now_ns() >= window_end)
+        {
+            report_window(options, &window, &window_errors, window_index++, &first_p50, &last_p50);
+            window_end += SOAK_WINDOW_S * WIFI_PERF_NS_PER_SEC;
+        }
+
+        next += options->interval_ms * WIFI_PERF_NS_PER_MS;
+        now = wifi_perf_now_ns();
+        if (next > now)
+        {
+            wifi_perf_sleep_ms((uint32_t)((next - now + WIFI_PERF_NS_PER_MS - 1) / WIFI_PERF_NS_PER_MS));
+        }
+    }
+
+    if (window.count != 0)
+    {
+        report_window(options, &window, &window_errors, window_index, &first_p50, &last_p50);
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        if (totals[i].count != 0)
+        {
+            hal_bench_report(options, wifi_hal_api_name(all[i].api), &totals[i], errors[i]);
+        }
+        wifi_perf_samples_free(&totals[i]);
+    }
+    last_rss = resident_kb();
+    if (options->format == HAL_BENCH_FORMAT_TEXT)
+    {
+        printf("p50 drift first to last minute: %+.1f%%, rss %ld kB -> %ld kB (%+ld kB)\n",
+               (first_p50 > 0.0) ? (last_p50 - first_p50) * 100.0 / first_p50 : 0.0,
+               first_rss, last_rss, last_rss - first_rss);
+    }
+
+    wifi_perf_samples_free(&window);
+    free(totals);
+    free(errors);
+    hal_bench_hal_uninit();
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_HAL_BENCH
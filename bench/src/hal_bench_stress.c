@@ -0,0 +1,226 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HAL_BENCH RDK-V WiFi HAL Benchmark Tool
+ * @{
+ */
+
+/**
+* @file hal_bench_stress.c
+*
+* `hal_bench stress`: every thread calls the selected getters round-robin
+* for the whole run. Reports per-getter latency under contention and the
+* total call rate.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "hal_bench.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_probe.h"
+#include "wifi_perf_stability.h"
+
+#define STRESS_DEFAULT_DURATION_S 10
+
+typedef struct
+{
+    const hal_bench_options_t *options;
+    unsigned index;
+    const wifi_perf_probe_t **probes;
+    size_t count;
+    uint64_t end_ns;
+    pthread_mutex_t *gate;          /* Held by the main thread until the barrier exists */
+    pthread_barrier_t *start;
+    wifi_perf_samples_t *samples;   /* One set per probe */
+    unsigned *errors;               /* One counter per probe */
+} stress_worker_t;
+
+static void *stress_worker(void *arg)
+{
+    stress_worker_t *worker = arg;
+    size_t next = 0;
+
+    /* Workers inherit the measuring thread's CPU, spread them over the following ones instead */
+    if (worker->options->cpu >= 0)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+        wifi_perf_pin_cpu((int)((worker->options->cpu + 1 + worker->index) % ((cpus > 0) ? cpus : 1)));
+    }
+    pthread_mutex_lock(worker->gate);
+    pthread_mutex_unlock(worker->gate);
+    pthread_barrier_wait(worker->start);
+    while (wifi_perf_now_ns() < worker->end_ns)
+    {
+        uint64_t start = wifi_perf_now_ns();
+        INT ret = worker->probes[next]->call(worker->options->radio_index, worker->options->ssid_index);
+
+        wifi_perf_samples_add(&worker->samples[next], wifi_perf_now_ns() - start);
+        if (ret != RETURN_OK)
+        {
+            worker->errors[next]++;
+        }
+        next = (next + 1) % worker->count;
+    }
+    return NULL;
+}
+
+/* Frees the per-worker sample sets, workers that were never set up have NULL ones */
+static void stress_free(stress_worker_t *workers, unsigned threads, size_t count)
+{
+    for (unsigned t = 0; t < threads; t++)
+    {
+        for (size_t i = 0; i < count && workers[t].samples != NULL; i++)
+        {
+            wifi_perf_samples_free(&workers[t].samples[i]);
+        }
+        free(workers[t].samples);
+        free(workers[t].errors);
+    }
+}
+
+int hal_bench_stress(hal_bench_options_t *options)
+{
+    unsigned duration_s = (options->duration_s != 0) ? options->duration_s : STRESS_DEFAULT_DURATION_S;
+    const wifi_perf_probe_t *all;
+    const wifi_perf_probe_t **probes;
+    stress_worker_t *workers;
+    pthread_t *threads;
+    pthread_mutex_t gate = PTHREAD_MUTEX_INITIALIZER;
+    pthread_barrier_t start;
+    wifi_perf_samples_t merged;
+    size_t all_count;
+    size_t count = 0;
+    unsigned started = 0;
+    uint64_t calls = 0;
+    uint64_t begin;
+    int ret = 0;
+
+    all = wifi_perf_probes(&all_count);
+    probes = calloc(all_count, sizeof(*probes));
+    workers = calloc(options->threads, sizeof(*workers));
+    threads = calloc(options->threads, sizeof(*threads));
+    if (probes == NULL || workers == NULL || threads == NULL)
+    {
+        free(probes);
+        free(workers);
+        free(threads);
+        return -1;
+    }
+    for (size_t i = 0; i < all_count; i++)
+    {
+        if (hal_bench_api_selected(options, wifi_hal_api_name(all[i].api)))
+        {
+            probes[count++] = &all[i];
+        }
+    }
+    for (unsigned t = 0; t < options->threads && count != 0 && ret == 0; t++)
+    {
+        workers[t].options = options;
+        workers[t].index = t;
+        workers[t].probes = probes;
+        workers[t].count = count;
+        workers[t].gate = &gate;
+        workers[t].start = &start;
+        workers[t].samples = calloc(count, sizeof(wifi_perf_samples_t));
+        workers[t].errors = calloc(count, sizeof(unsigned));
+        if (workers[t].samples == NULL || workers[t].errors == NULL)
+        {
+            fprintf(stderr, "Out of memory for %u threads\n", options->threads);
+            ret = -1;
+        }
+        for (size_t i = 0; i < count && ret == 0; i++)
+        {
+            wifi_perf_samples_init(&workers[t].samples[i], 0);
+        }
+    }
+    if (count == 0 || ret != 0 || hal_bench_hal_init(options) != 0)
+    {
+        stress_free(workers, options->threads, count);
+        free(probes);
+        free(workers);
+        free(threads);
+        return -1;
+    }
+
+    /* Workers wait at the gate until the barrier is sized for the threads that were actually created.
+     * The end time is set once every worker exists so they all run for the same window. */
+    pthread_mutex_lock(&gate);
+    begin = wifi_perf_now_ns();
+    for (unsigned t = 0; t < options->threads; t++)
+    {
+        int err;
+
+        workers[t].end_ns = begin + duration_s * WIFI_PERF_NS_PER_SEC;
+        err = pthread_create(&threads[t], NULL, stress_worker, &workers[t]);
+        if (err != 0)
+        {
+            fprintf(stderr, "Cannot start thread %u of %u: %s\n", t + 1, options->threads, strerror(err));
+            ret = -1;
+            break;
+        }
+        started++;
+    }
+    /* A partial run would not be the requested load, the started workers return at once */
+    for (unsigned t = 0; t < started && ret != 0; t++)
+    {
+        workers[t].end_ns = 0;
+    }
+    pthread_barrier_init(&start, NULL, started + 1);
+    pthread_mutex_unlock(&gate);
+    pthread_barrier_wait(&start);
+    for (unsigned t = 0; t < started; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+    pthread_barrier_destroy(&start);
+
+    wifi_perf_samples_init(&merged, 0);
+    for (size_t i = 0; i < count && ret == 0; i++)
+    {
+        unsigned errors = 0;
+
+        wifi_perf_samples_clear(&merged);
+        for (unsigned t = 0; t < options->threads; t++)
+        {
+            wifi_perf_samples_merge(&merged, &workers[t].samples[i]);
+            errors += workers[t].errors[i];
+        }
+        calls += merged.count;
+        hal_bench_report(options, wifi_hal_api_name(probes[i]->api), &merged, errors);
+    }
+    if (ret == 0 && options->format == HAL_BENCH_FORMAT_TEXT)
+    {
+        printf("%u threads, %u s: %llu calls, %.0f calls/s\n", options->threads, duration_s,
+               (unsigned long long)calls, (double)calls / (double)duration_s);
+    }
+
+    wifi_perf_samples_free(&merged);
+    stress_free(workers, options->threads, count);
+    free(probes);
+    free(workers);
+    free(threads);
+    hal_bench_hal_uninit();
+    return ret;
+}
+
+/** @} */ // End of RDKV_WIFI_HAL_BENCH
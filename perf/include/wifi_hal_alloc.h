@@ -0,0 +1,188 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_hal_alloc.h
+*
+* Heap accounting per HAL call.
+*
+* The harness replaces malloc(), calloc(), realloc() and free() in the test
+* binaries and forwards them to the C library. While accounting is enabled,
+* every allocation made between a wrapper's entry and return is charged to
+* that HAL API, whichever library makes it. Outside HAL calls, or while
+* accounting is disabled, the replacements cost one thread-local load.
+* Blocks from memalign(), posix_memalign() and aligned_alloc() are not counted
+* when allocated, only when freed.
+*
+* Accounting is switched on from the environment or by the tests:
+* - `WIFI_HAL_ALLOC=1` accounts the whole run and prints a table per API at the end
+* - `WIFI_HAL_ALLOC_BUDGET=<api>=<allocs>[:<bytes>],...` sets per-call budgets,
+*   e.g. `wifi_getRadioChannel=0,wifi_getStats=2:512`
+*
+* Only glibc exposes the allocator entry points the replacements forward to;
+* elsewhere wifi_alloc_supported() returns 0 and nothing is counted.
+*/
+
+#ifndef __WIFI_HAL_ALLOC_H__
+#define __WIFI_HAL_ALLOC_H__
+
+#include <stdint.h>
+#include "wifi_hal_api.h"
+
+/**
+ * @brief Heap activity of one HAL API, accumulated over its calls
+ */
+typedef struct
+{
+    uint64_t calls;            /*!< Calls made while accounting was enabled */
+    uint64_t allocs;           /*!< malloc, calloc and realloc calls */
+    uint64_t frees;            /*!< free calls, including realloc releasing the old block */
+    uint64_t bytes;            /*!< Bytes requested */
+    uint64_t retained;         /*!< Bytes allocated in a call and still held when it returned */
+    uint64_t max_call_allocs;  /*!< Most allocations made by a single call */
+    uint64_t max_call_bytes;   /*!< Most bytes requested by a single call */
+    uint64_t max_call_peak;    /*!< Highest heap growth within a single call, in usable bytes */
+} wifi_alloc_stats_t;
+
+/**
+ * @brief Per-call budget of one HAL API
+ */
+typedef struct
+{
+    int64_t max_allocs;  /*!< Allocations allowed per call, -1 for no limit */
+    int64_t max_bytes;   /*!< Bytes allowed per call, -1 for no limit */
+} wifi_alloc_budget_t;
+
+/**
+ * @brief Non-zero while accounting is enabled. Read by the macros below.
+ */
+extern volatile int wifi_alloc_active;
+
+/**
+ * @brief Returns non-zero if the allocator replacements are available on this platform
+ */
+int wifi_alloc_supported(void);
+
+/**
+ * @brief Enables or disables accounting
+ *
+ * Must only be called while no HAL call is in progress.
+ *
+ * @param[in] enable Non-zero to enable
+ */
+void wifi_alloc_enable(int enable);
+
+/**
+ * @brief Clears the statistics of every API, budgets are kept
+ */
+void wifi_alloc_reset(void);
+
+/**
+ * @brief Starts charging allocations of the calling thread to an API
+ *
+ * Nested calls are charged to the outermost API.
+ *
+ * @param[in] api API being called
+ */
+void wifi_alloc_call_enter(wifi_hal_api_t api);
+
+/**
+ * @brief Stops charging allocations and adds the call to the API statistics
+ *
+ * @param[in] api API that returned
+ */
+void wifi_alloc_call_exit(wifi_hal_api_t api);
+
+/**
+ * @brief Returns the statistics of an API
+ *
+ * @param[in]  api   API identifier
+ * @param[out] stats Statistics, zeroed for an unknown API
+ */
+void wifi_alloc_get(wifi_hal_api_t api, wifi_alloc_stats_t *stats);
+
+/**
+ * @brief Sets the per-call budget of an API
+ *
+ * @param[in] api    API identifier
+ * @param[in] budget Budget, NULL removes it
+ */
+void wifi_alloc_set_budget(wifi_hal_api_t api, const wifi_alloc_budget_t *budget);
+
+/**
+ * @brief Returns the per-call budget of an API
+ *
+ * @param[in]  api    API identifier
+ * @param[out] budget Budget, both limits -1 if none is set
+ *
+ * @return int - 1 if a budget is set, 0 otherwise
+ */
+int wifi_alloc_get_budget(wifi_hal_api_t api, wifi_alloc_budget_t *budget);
+
+/**
+ * @brief Sets budgets from a `WIFI_HAL_ALLOC_BUDGET` style list
+ *
+ * @param[in] spec Comma separated `<api>=<allocs>[:<bytes>]` entries
+ *
+ * @return int - The status of the operation
+ * @retval 0  if every entry was applied
+ * @retval -1 if an entry names an unknown API or is malformed, the entries before it are applied
+ */
+int wifi_alloc_parse_budgets(const char *spec);
+
+/**
+ * @brief Checks the statistics of an API against its budget
+ *
+ * @param[in] api API identifier
+ *
+ * @return int - 1 if no single call exceeded the budget or none is set, 0 otherwise
+ */
+int wifi_alloc_within_budget(wifi_hal_api_t api);
+
+/**
+ * @brief Applies `WIFI_HAL_ALLOC_BUDGET` and enables accounting if `WIFI_HAL_ALLOC` is set
+ */
+void wifi_alloc_init_from_env(void);
+
+/**
+ * @brief Prints the statistics of every called API if `WIFI_HAL_ALLOC` is set
+ *
+ * @return int - Number of APIs over budget
+ */
+int wifi_alloc_finish(void);
+
+/**
+ * @brief Marks the start of a HAL call
+ */
+#define WIFI_ALLOC_CALL_ENTER(api) \
+    do { if (wifi_alloc_active) wifi_alloc_call_enter(api); } while (0)
+
+/**
+ * @brief Marks the return of a HAL call
+ */
+#define WIFI_ALLOC_CALL_EXIT(api) \
+    do { if (wifi_alloc_active) wifi_alloc_call_exit(api); } while (0)
+
+#endif // __WIFI_HAL_ALLOC_H__
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
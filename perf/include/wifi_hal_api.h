@@ -0,0 +1,182 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ * @parblock
+ *
+ * ### Performance harness for RDK-V WiFi HAL :
+ *
+ * Helpers shared by the test binaries to instrument and measure HAL calls.
+ * Every HAL API referenced by the tests is linked through a thin wrapper
+ * (see wifi_hal_wrap.c) so that per-call hooks can be applied without
+ * touching the call sites.
+ *
+ * @endparblock
+ */
+
+/**
+* @file wifi_hal_api.h
+*
+*/
+
+#ifndef __WIFI_HAL_API_H__
+#define __WIFI_HAL_API_H__
+
+#include <stdint.h>
+
+/**
+ * @brief List of every HAL API routed through the wrapper layer
+ *
+ * The Makefile extracts the names from this list to build the linker
+ * `--wrap` options, so it must stay one entry per line.
+ */
+#define WIFI_HAL_API_LIST(WIFI_HAL_API) \
+    WIFI_HAL_API(wifi_getHalVersion) \
+    WIFI_HAL_API(wifi_init) \
+    WIFI_HAL_API(wifi_initWithConfig) \
+    WIFI_HAL_API(wifi_down) \
+    WIFI_HAL_API(wifi_uninit) \
+    WIFI_HAL_API(wifi_getStats) \
+    WIFI_HAL_API(wifi_getRadioNumberOfEntries) \
+    WIFI_HAL_API(wifi_getSSIDNumberOfEntries) \
+    WIFI_HAL_API(wifi_getRadioEnable) \
+    WIFI_HAL_API(wifi_getRadioStatus) \
+    WIFI_HAL_API(wifi_getRadioIfName) \
+    WIFI_HAL_API(wifi_getRadioMaxBitRate) \
+    WIFI_HAL_API(wifi_getRadioSupportedFrequencyBands) \
+    WIFI_HAL_API(wifi_getRadioOperatingFrequencyBand) \
+    WIFI_HAL_API(wifi_getRadioSupportedStandards) \
+    WIFI_HAL_API(wifi_getRadioStandard) \
+    WIFI_HAL_API(wifi_getRadioPossibleChannels) \
+    WIFI_HAL_API(wifi_getRadioChannelsInUse) \
+    WIFI_HAL_API(wifi_getRadioChannel) \
+    WIFI_HAL_API(wifi_getRadioAutoChannelSupported) \
+    WIFI_HAL_API(wifi_getRadioAutoChannelEnable) \
+    WIFI_HAL_API(wifi_getRadioAutoChannelRefreshPeriod) \
+    WIFI_HAL_API(wifi_getRadioGuardInterval) \
+    WIFI_HAL_API(wifi_getRadioOperatingChannelBandwidth) \
+    WIFI_HAL_API(wifi_getRadioExtChannel) \
+    WIFI_HAL_API(wifi_getRadioMCS) \
+    WIFI_HAL_API(wifi_getRadioTransmitPowerSupported) \
+    WIFI_HAL_API(wifi_getRadioTransmitPower) \
+    WIFI_HAL_API(wifi_getRadioIEEE80211hSupported) \
+    WIFI_HAL_API(wifi_getRadioIEEE80211hEnabled) \
+    WIFI_HAL_API(wifi_getRegulatoryDomain) \
+    WIFI_HAL_API(wifi_getRadioTrafficStats) \
+    WIFI_HAL_API(wifi_getSSIDName) \
+    WIFI_HAL_API(wifi_getBaseBSSID) \
+    WIFI_HAL_API(wifi_getSSIDMACAddress) \
+    WIFI_HAL_API(wifi_getSSIDTrafficStats) \
+    WIFI_HAL_API(wifi_getNeighboringWiFiDiagnosticResult) \
+    WIFI_HAL_API(wifi_getSpecificSSIDInfo) \
+    WIFI_HAL_API(wifi_setRadioScanningFreqList) \
+    WIFI_HAL_API(wifi_getDualBandSupport) \
+    WIFI_HAL_API(wifi_waitForScanResults) \
+    WIFI_HAL_API(wifi_getCliWpsConfigMethodsSupported) \
+    WIFI_HAL_API(wifi_getCliWpsConfigMethodsEnabled) \
+    WIFI_HAL_API(wifi_setCliWpsConfigMethodsEnabled) \
+    WIFI_HAL_API(wifi_setCliWpsEnrolleePin) \
+    WIFI_HAL_API(wifi_setCliWpsButtonPush) \
+    WIFI_HAL_API(wifi_connectEndpoint) \
+    WIFI_HAL_API(wifi_disconnectEndpoint) \
+    WIFI_HAL_API(wifi_clearSSIDInfo) \
+    WIFI_HAL_API(wifi_disconnectEndpoint_callback_register) \
+    WIFI_HAL_API(wifi_connectEndpoint_callback_register) \
+    WIFI_HAL_API(wifi_telemetry_callback_register) \
+    WIFI_HAL_API(wifi_lastConnected_Endpoint) \
+    WIFI_HAL_API(wifi_setRoamingControl) \
+    WIFI_HAL_API(wifi_getRoamingControl) \
+    WIFI_HAL_API(wifi_cancelWpsPairing)
+
+#define WIFI_HAL_API_ENUM(name) WIFI_HAL_API_##name,
+
+/**
+ * @brief Identifier of each wrapped HAL API
+ */
+typedef enum
+{
+    WIFI_HAL_API_LIST(WIFI_HAL_API_ENUM)
+    WIFI_HAL_API_MAX
+} wifi_hal_api_t;
+
+#undef WIFI_HAL_API_ENUM
+
+/**
+ * @brief Returns the HAL function name for an API identifier
+ *
+ * @param[in] api API identifier
+ *
+ * @return const char* - static function name, "unknown" if out of range
+ */
+const char *wifi_hal_api_name(wifi_hal_api_t api);
+
+/**
+ * @brief Looks up an API identifier by HAL function name
+ *
+ * @param[in] name HAL function name, e.g. "wifi_getRadioChannel"
+ *
+ * @return wifi_hal_api_t - API identifier, WIFI_HAL_API_MAX if not found
+ */
+wifi_hal_api_t wifi_hal_api_from_name(const char *name);
+
+/**
+ * @brief Runs the per-call hooks of the wrappers around an empty body
+ *
+ * Costs what __wrap_<api> adds to a HAL call with the trace, heap, process
+ * start and system cost hooks as currently enabled, so a benchmark can
+ * subtract the harness along with its clock reads. The hooks record the call
+ * against api like a real one.
+ *
+ * @param[in] api API the hooks account the call to
+ *
+ * @return INT - RETURN_OK
+ */
+int wifi_hal_wrap_empty_call(wifi_hal_api_t api);
+
+/**
+ * @brief The first wifi_init() or wifi_initWithConfig() of the process
+ *
+ * Timed by the wrappers, so it is the cold start cost whichever test made the call.
+ */
+typedef struct
+{
+    wifi_hal_api_t api; /*!< WIFI_HAL_API_wifi_init or WIFI_HAL_API_wifi_initWithConfig */
+    uint64_t call_ns;   /*!< Duration of the call */
+    int result;         /*!< Value returned by the HAL */
+} wifi_hal_first_init_t;
+
+/**
+ * @brief Returns the first wifi_init() or wifi_initWithConfig() of the process
+ *
+ * @param[out] first Call details
+ *
+ * @return int - 1 if an init call has completed, 0 otherwise
+ */
+int wifi_hal_first_init(wifi_hal_first_init_t *first);
+
+#endif // __WIFI_HAL_API_H__
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
+/** @} */ // End of RDKV_WIFI_HALTEST
@@ -0,0 +1,160 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_hal_rusage.h
+*
+* System cost of each HAL call.
+*
+* While accounting is enabled, every wrapper reads getrusage(RUSAGE_THREAD)
+* before and after the real call and charges the difference to the API:
+* voluntary and involuntary context switches, user and system CPU time and
+* page faults. Where perf_event_open() is permitted, a per-thread group of
+* hardware counters (cycles, instructions, cache misses) is read the same
+* way. The kernel is counted too if perf_event_paranoid allows it, otherwise
+* only user space; wifi_rusage_counters() tells which.
+*
+* Only the calling thread is measured, work the HAL hands to its own threads
+* does not show up here. Accounting adds two system calls, plus two counter
+* reads, to each HAL call, so latency figures of the same run include them.
+*
+* Accounting is switched on from the environment or by the tests:
+* - `WIFI_HAL_RUSAGE=1` accounts the whole run and prints a table per API at the end
+*/
+
+#ifndef __WIFI_HAL_RUSAGE_H__
+#define __WIFI_HAL_RUSAGE_H__
+
+#include <stdint.h>
+#include "wifi_hal_api.h"
+
+/**
+ * @brief Hardware counter availability
+ */
+typedef enum
+{
+    WIFI_RUSAGE_COUNTERS_NONE = 0,  /*!< perf_event_open() is not permitted or not supported */
+    WIFI_RUSAGE_COUNTERS_USER,      /*!< User space only */
+    WIFI_RUSAGE_COUNTERS_ALL        /*!< User space and kernel */
+} wifi_rusage_counters_t;
+
+/**
+ * @brief System cost of one HAL API, accumulated over its calls
+ */
+typedef struct
+{
+    uint64_t calls;                  /*!< Calls made while accounting was enabled */
+    uint64_t voluntary_switches;     /*!< The thread blocked, e.g. on I/O or a lock */
+    uint64_t involuntary_switches;   /*!< The thread was preempted */
+    uint64_t user_ns;                /*!< User CPU time */
+    uint64_t system_ns;              /*!< System CPU time */
+    uint64_t minor_faults;           /*!< Page faults served without I/O */
+    uint64_t major_faults;           /*!< Page faults that needed I/O */
+    uint64_t counted_calls;          /*!< Calls for which the hardware counters were read */
+    uint64_t cycles;                 /*!< CPU cycles over counted_calls */
+    uint64_t instructions;           /*!< Instructions retired over counted_calls */
+    uint64_t cache_misses;           /*!< Last level cache misses over counted_calls */
+} wifi_rusage_stats_t;
+
+/**
+ * @brief Non-zero while accounting is enabled. Read by the macros below.
+ */
+extern volatile int wifi_rusage_active;
+
+/**
+ * @brief Enables or disables accounting
+ *
+ * Must only be called while no HAL call is in progress.
+ *
+ * @param[in] enable Non-zero to enable
+ */
+void wifi_rusage_enable(int enable);
+
+/**
+ * @brief Clears the statistics of every API
+ */
+void wifi_rusage_reset(void);
+
+/**
+ * @brief Returns which hardware counters the calling thread can read
+ *
+ * Opens the thread's counters on first use.
+ */
+wifi_rusage_counters_t wifi_rusage_counters(void);
+
+/**
+ * @brief Takes the starting readings for the calling thread
+ *
+ * Nested calls are charged to the outermost API.
+ *
+ * @param[in] api API being called
+ */
+void wifi_rusage_call_enter(wifi_hal_api_t api);
+
+/**
+ * @brief Takes the closing readings and adds the differences to the API statistics
+ *
+ * @param[in] api API that returned
+ */
+void wifi_rusage_call_exit(wifi_hal_api_t api);
+
+/**
+ * @brief Returns the statistics of an API
+ *
+ * @param[in]  api   API identifier
+ * @param[out] stats Statistics, zeroed for an unknown API
+ */
+void wifi_rusage_get(wifi_hal_api_t api, wifi_rusage_stats_t *stats);
+
+/**
+ * @brief Prints one row per called API with the cost per call
+ *
+ * @param[in] csv Non-zero for CSV, otherwise a text table
+ */
+void wifi_rusage_report(int csv);
+
+/**
+ * @brief Enables accounting if `WIFI_HAL_RUSAGE` is set
+ */
+void wifi_rusage_init_from_env(void);
+
+/**
+ * @brief Prints the report if `WIFI_HAL_RUSAGE` is set
+ */
+void wifi_rusage_finish(void);
+
+/**
+ * @brief Marks the start of a HAL call
+ */
+#define WIFI_RUSAGE_CALL_ENTER(api) \
+    do { if (wifi_rusage_active) wifi_rusage_call_enter(api); } while (0)
+
+/**
+ * @brief Marks the return of a HAL call
+ */
+#define WIFI_RUSAGE_CALL_EXIT(api) \
+    do { if (wifi_rusage_active) wifi_rusage_call_exit(api); } while (0)
+
+#endif // __WIFI_HAL_RUSAGE_H__
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
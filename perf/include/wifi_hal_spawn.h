@@ -0,0 +1,193 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_hal_spawn.h
+*
+* Detection of HAL calls that start processes.
+*
+* The harness replaces fork(), vfork(), posix_spawn(), posix_spawnp(),
+* execve(), execv(), execvp(), popen(), pclose(), system(), waitpid() and
+* wait() in the test binaries. While detection is enabled, every process
+* started inside a HAL call is charged to that API together with the time the
+* call spends starting processes and waiting for them. Processes started by
+* other threads, for example a HAL worker thread, are charged to
+* WIFI_HAL_API_MAX. vfork() is forwarded to fork(), as a replacement cannot
+* return into a child that shares its stack.
+*
+* Detection is switched on from the environment or by the tests:
+* - `WIFI_HAL_SPAWN=1` watches the whole run and prints a table per API at the end
+* - `WIFI_HAL_SPAWN_CRITICAL=<api>,...` marks APIs that must never start a process
+*/
+
+#ifndef __WIFI_HAL_SPAWN_H__
+#define __WIFI_HAL_SPAWN_H__
+
+#include <stdint.h>
+#include "wifi_hal_api.h"
+
+/**
+ * @brief Length of the command recorded per API, including the terminator
+ */
+#define WIFI_SPAWN_COMMAND_LEN 96
+
+/**
+ * @brief Ways of starting a process
+ */
+typedef enum
+{
+    WIFI_SPAWN_FORK = 0,     /*!< fork() or vfork() */
+    WIFI_SPAWN_POSIX_SPAWN,  /*!< posix_spawn() or posix_spawnp() */
+    WIFI_SPAWN_EXEC,         /*!< execve(), execv() or execvp(), usually in a forked child */
+    WIFI_SPAWN_POPEN,        /*!< popen() */
+    WIFI_SPAWN_SYSTEM,       /*!< system() */
+    WIFI_SPAWN_KIND_MAX
+} wifi_spawn_kind_t;
+
+/**
+ * @brief Processes started by one HAL API, accumulated over its calls
+ */
+typedef struct
+{
+    uint64_t calls;                        /*!< Calls made while detection was enabled */
+    uint64_t spawning_calls;               /*!< Calls that started at least one process */
+    uint64_t spawns[WIFI_SPAWN_KIND_MAX];  /*!< Processes started, by kind */
+    uint64_t spawn_ns;                     /*!< Time spent starting processes and waiting for them */
+    uint64_t max_call_spawn_ns;            /*!< Most such time in a single call */
+    char command[WIFI_SPAWN_COMMAND_LEN];  /*!< First command or program started, empty if none */
+} wifi_spawn_stats_t;
+
+/**
+ * @brief Non-zero while detection is enabled. Read by the macros below.
+ */
+extern volatile int wifi_spawn_active;
+
+/**
+ * @brief Returns the name of a spawn kind
+ *
+ * @param[in] kind Spawn kind
+ *
+ * @return const char* - static name, "unknown" if out of range
+ */
+const char *wifi_spawn_kind_name(wifi_spawn_kind_t kind);
+
+/**
+ * @brief Enables or disables detection
+ *
+ * Must only be called while no HAL call is in progress.
+ *
+ * @param[in] enable Non-zero to enable
+ *
+ * @return int - 0 on success, -1 if the shared statistics table could not be mapped
+ */
+int wifi_spawn_enable(int enable);
+
+/**
+ * @brief Clears the statistics of every API, critical marks are kept
+ */
+void wifi_spawn_reset(void);
+
+/**
+ * @brief Starts charging processes started by the calling thread to an API
+ *
+ * Nested calls are charged to the outermost API.
+ *
+ * @param[in] api API being called
+ */
+void wifi_spawn_call_enter(wifi_hal_api_t api);
+
+/**
+ * @brief Stops charging processes and adds the call to the API statistics
+ *
+ * @param[in] api API that returned
+ */
+void wifi_spawn_call_exit(wifi_hal_api_t api);
+
+/**
+ * @brief Returns the statistics of an API
+ *
+ * @param[in]  api   API identifier, WIFI_HAL_API_MAX for processes started outside HAL calls
+ * @param[out] stats Statistics, zeroed for an unknown API
+ */
+void wifi_spawn_get(wifi_hal_api_t api, wifi_spawn_stats_t *stats);
+
+/**
+ * @brief Marks an API as latency critical, it fails wifi_spawn_check() if it starts a process
+ *
+ * @param[in] api      API identifier
+ * @param[in] critical Non-zero to mark, zero to clear
+ */
+void wifi_spawn_set_critical(wifi_hal_api_t api, int critical);
+
+/**
+ * @brief Returns non-zero if an API is marked latency critical
+ */
+int wifi_spawn_is_critical(wifi_hal_api_t api);
+
+/**
+ * @brief Marks the APIs of a `WIFI_HAL_SPAWN_CRITICAL` style list as latency critical
+ *
+ * @param[in] spec Comma separated API names
+ *
+ * @return int - The status of the operation
+ * @retval 0  if every name was applied
+ * @retval -1 if a name is unknown, the names before it are applied
+ */
+int wifi_spawn_parse_critical(const char *spec);
+
+/**
+ * @brief Checks an API against its critical mark
+ *
+ * @param[in] api API identifier
+ *
+ * @return int - 0 if the API is critical and started a process, 1 otherwise
+ */
+int wifi_spawn_check(wifi_hal_api_t api);
+
+/**
+ * @brief Applies `WIFI_HAL_SPAWN_CRITICAL` and enables detection if `WIFI_HAL_SPAWN` is set
+ */
+void wifi_spawn_init_from_env(void);
+
+/**
+ * @brief Prints every API that started a process if `WIFI_HAL_SPAWN` is set
+ *
+ * @return int - Number of critical APIs that started a process
+ */
+int wifi_spawn_finish(void);
+
+/**
+ * @brief Marks the start of a HAL call
+ */
+#define WIFI_SPAWN_CALL_ENTER(api) \
+    do { if (wifi_spawn_active) wifi_spawn_call_enter(api); } while (0)
+
+/**
+ * @brief Marks the return of a HAL call
+ */
+#define WIFI_SPAWN_CALL_EXIT(api) \
+    do { if (wifi_spawn_active) wifi_spawn_call_exit(api); } while (0)
+
+#endif // __WIFI_HAL_SPAWN_H__
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
@@ -0,0 +1,181 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_hal_trace.h
+*
+* Low-overhead begin/end tracing for tests and HAL calls.
+*
+* Events are written into a per-thread ring buffer without locking or
+* formatting; nothing is printed while the tests run. When tracing is
+* disabled each macro costs a single load and branch. At the end of the run
+* the buffers can be exported as Chrome trace-event JSON (chrome://tracing,
+* ui.perfetto.dev) or as a native Perfetto protobuf trace.
+*
+* Tracing is switched on from the environment:
+* - `WIFI_HAL_TRACE=<file>` enables tracing and names the output file
+* - `WIFI_HAL_TRACE_FORMAT=chrome|perfetto` selects the format (default chrome)
+* - `WIFI_HAL_TRACE_EVENTS=<n>` sets the per-thread ring size (default 16384)
+*/
+
+#ifndef __WIFI_HAL_TRACE_H__
+#define __WIFI_HAL_TRACE_H__
+
+#include <stdint.h>
+#include "wifi_perf_clock.h"
+
+/**
+ * @brief Output format of wifi_trace_export()
+ */
+typedef enum
+{
+    WIFI_TRACE_FORMAT_CHROME_JSON = 0, /*!< Chrome trace-event JSON */
+    WIFI_TRACE_FORMAT_PERFETTO         /*!< Perfetto protobuf (TrackEvent) */
+} wifi_trace_format_t;
+
+/**
+ * @brief Category attached to each event
+ */
+typedef enum
+{
+    WIFI_TRACE_CATEGORY_TEST = 0, /*!< Test case body */
+    WIFI_TRACE_CATEGORY_HAL,      /*!< Single HAL API invocation */
+    WIFI_TRACE_CATEGORY_USER,     /*!< Any other span marked by the caller */
+    WIFI_TRACE_CATEGORY_MAX
+} wifi_trace_category_t;
+
+/**
+ * @brief Event phase
+ */
+typedef enum
+{
+    WIFI_TRACE_PHASE_BEGIN = 0,
+    WIFI_TRACE_PHASE_END
+} wifi_trace_phase_t;
+
+/**
+ * @brief Non-zero while tracing is enabled. Read by the macros below.
+ */
+extern volatile int wifi_trace_active;
+
+/**
+ * @brief Records a single event in the calling thread's ring buffer
+ *
+ * @param[in] name     Event name. Must be a string with static storage
+ *                     duration (a literal or __func__), it is not copied.
+ * @param[in] category Event category
+ * @param[in] phase    Begin or end
+ */
+void wifi_trace_record(const char *name, wifi_trace_category_t category, wifi_trace_phase_t phase);
+
+/**
+ * @brief Sets the ring size used for threads that start tracing afterwards
+ *
+ * @param[in] events Number of events per thread, rounded up to a power of two
+ */
+void wifi_trace_set_capacity(uint32_t events);
+
+/**
+ * @brief Enables or disables recording
+ *
+ * @param[in] enable Non-zero to enable
+ */
+void wifi_trace_enable(int enable);
+
+/**
+ * @brief Discards all recorded events
+ *
+ * Must only be called while no other thread is recording.
+ */
+void wifi_trace_reset(void);
+
+/**
+ * @brief Writes every recorded event to a file
+ *
+ * Must only be called while no other thread is recording. Spans are closed
+ * per thread before writing: a test span still open when the next test
+ * begins (its test failed out of an assertion) ends there, an end whose begin
+ * was lost to a ring wrap is dropped, and spans open at the last event of the
+ * thread end at it.
+ *
+ * @param[in] path   Output file path
+ * @param[in] format Output format
+ *
+ * @return int - The status of the operation
+ * @retval 0  if successful
+ * @retval -1 if the file could not be written, memory ran out or a Perfetto
+ *            packet did not fit its buffer (the file is then incomplete)
+ */
+int wifi_trace_export(const char *path, wifi_trace_format_t format);
+
+/**
+ * @brief Returns the number of events dropped because a ring wrapped
+ */
+uint64_t wifi_trace_dropped(void);
+
+/**
+ * @brief Enables tracing if `WIFI_HAL_TRACE` is set in the environment
+ */
+void wifi_trace_init_from_env(void);
+
+/**
+ * @brief Exports the trace to the file named by `WIFI_HAL_TRACE`, if any
+ */
+void wifi_trace_finish(void);
+
+/**
+ * @brief Marks the start of a named span
+ */
+#define WIFI_TRACE_BEGIN(name, category) \
+    do { if (wifi_trace_active) wifi_trace_record((name), (category), WIFI_TRACE_PHASE_BEGIN); } while (0)
+
+/**
+ * @brief Marks the end of a named span
+ */
+#define WIFI_TRACE_END(name, category) \
+    do { if (wifi_trace_active) wifi_trace_record((name), (category), WIFI_TRACE_PHASE_END); } while (0)
+
+/**
+ * @brief Marks the start of the enclosing test function
+ */
+#define WIFI_TRACE_TEST_BEGIN() WIFI_TRACE_BEGIN(__func__, WIFI_TRACE_CATEGORY_TEST)
+
+/**
+ * @brief Marks the end of the enclosing test function
+ */
+#define WIFI_TRACE_TEST_END() WIFI_TRACE_END(__func__, WIFI_TRACE_CATEGORY_TEST)
+
+/**
+ * @brief Traces a single statement as a span, e.g.
+ *        WIFI_TRACE_SPAN("scan", ret = wifi_waitForScanResults());
+ */
+#define WIFI_TRACE_SPAN(name, statement) \
+    do { \
+        WIFI_TRACE_BEGIN((name), WIFI_TRACE_CATEGORY_USER); \
+        statement; \
+        WIFI_TRACE_END((name), WIFI_TRACE_CATEGORY_USER); \
+    } while (0)
+
+#endif // __WIFI_HAL_TRACE_H__
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
@@ -0,0 +1,90 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_perf_clock.h
+*
+*/
+
+#ifndef __WIFI_PERF_CLOCK_H__
+#define __WIFI_PERF_CLOCK_H__
+
+#include <stdint.h>
+#include <time.h>
+
+#define WIFI_PERF_NS_PER_US 1000ULL
+#define WIFI_PERF_NS_PER_MS 1000000ULL
+#define WIFI_PERF_NS_PER_SEC 1000000000ULL
+
+/**
+ * @brief Returns CLOCK_MONOTONIC in nanoseconds
+ */
+static inline uint64_t wifi_perf_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * WIFI_PERF_NS_PER_SEC + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Returns CLOCK_REALTIME plus ms, the absolute deadline pthread_cond_timedwait() expects
+ */
+static inline struct timespec wifi_perf_deadline_ms(uint32_t ms)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += ms / 1000;
+    ts.tv_nsec += (long)(ms % 1000) * 1000000L;
+    if (ts.tv_nsec >= (long)WIFI_PERF_NS_PER_SEC)
+    {
+        ts.tv_sec++;
+        ts.tv_nsec -= (long)WIFI_PERF_NS_PER_SEC;
+    }
+    return ts;
+}
+
+/**
+ * @brief Sleeps for the given number of milliseconds
+ */
+static inline void wifi_perf_sleep_ms(uint32_t ms)
+{
+    struct timespec ts = { .tv_sec = ms / 1000, .tv_nsec = (long)(ms % 1000) * 1000000L };
+    while (nanosleep(&ts, &ts) != 0)
+    {
+    }
+}
+
+/**
+ * @brief Sleeps for the given number of microseconds
+ */
+static inline void wifi_perf_sleep_us(uint32_t us)
+{
+    struct timespec ts = { .tv_sec = us / 1000000, .tv_nsec = (long)(us % 1000000) * 1000L };
+    while (nanosleep(&ts, &ts) != 0)
+    {
+    }
+}
+
+#endif // __WIFI_PERF_CLOCK_H__
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
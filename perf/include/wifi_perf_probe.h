@@ -0,0 +1,67 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_perf_probe.h
+*
+* Uniform calls to the read-only HAL getters, so that latency loops can
+* iterate over a table instead of spelling out each getter and its buffers.
+*/
+
+#ifndef __WIFI_PERF_PROBE_H__
+#define __WIFI_PERF_PROBE_H__
+
+#include <stddef.h>
+#include "wifi_common_hal.h"
+#include "wifi_hal_api.h"
+
+/**
+ * @brief One read-only getter
+ */
+typedef struct
+{
+    wifi_hal_api_t api;                          /*!< Getter being called */
+    INT (*call)(INT radioIndex, INT ssidIndex);  /*!< Calls the getter with scratch buffers and returns its status */
+} wifi_perf_probe_t;
+
+/**
+ * @brief Returns every probe
+ *
+ * @param[out] count Number of probes
+ *
+ * @return const wifi_perf_probe_t* - Static table
+ */
+const wifi_perf_probe_t *wifi_perf_probes(size_t *count);
+
+/**
+ * @brief Looks up a probe by HAL function name
+ *
+ * @param[in] name HAL function name, e.g. "wifi_getRadioChannel"
+ *
+ * @return const wifi_perf_probe_t* - Probe, NULL if the API has no probe
+ */
+const wifi_perf_probe_t *wifi_perf_probe_find(const char *name);
+
+#endif // __WIFI_PERF_PROBE_H__
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
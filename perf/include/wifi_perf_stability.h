@@ -0,0 +1,138 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_perf_stability.h
+*
+* Controls that make latency measurements on a loaded device repeatable.
+*
+* The measuring thread can be pinned to one CPU, so it is not migrated
+* between caches mid-run, and raised to SCHED_FIFO, so ordinary load does
+* not preempt it. Raising the priority needs CAP_SYS_NICE; without it the
+* call fails and the run continues at normal priority.
+*
+* The cost of reading the clock is measured once and can be subtracted from
+* each sample with wifi_perf_samples_subtract(), so sub-microsecond getters
+* are not dominated by it.
+*
+* hal_test applies the controls to the thread running the suites from the
+* environment:
+* - `WIFI_PERF_CPU=<cpu>` pins it to a CPU
+* - `WIFI_PERF_FIFO=<priority>` runs it at SCHED_FIFO with that priority (1-99)
+*
+* Only that thread is covered. Threads the suites start through
+* wifi_perf_thread_create() get the policy and CPUs the process had before,
+* so many spinning workers at the same real-time priority cannot lock out the
+* thread that has to stop them. Threads started inside the HAL, the simulator
+* or the wrappers inherit the settings.
+*/
+
+#ifndef __WIFI_PERF_STABILITY_H__
+#define __WIFI_PERF_STABILITY_H__
+
+#include <pthread.h>
+#include <stdint.h>
+
+/**
+ * @brief Coefficient of variation above which a result should not be trusted
+ *
+ * A 10% regression cannot be told from noise when the samples themselves
+ * spread by more than that.
+ */
+#define WIFI_PERF_CV_LIMIT 0.10
+
+/**
+ * @brief Scheduling state of a thread, saved so it can be restored
+ */
+typedef struct
+{
+    unsigned char affinity[128];    /*!< Allowed CPUs, a cpu_set_t */
+    int policy;                     /*!< Scheduling policy */
+    int priority;                   /*!< Scheduling priority */
+} wifi_perf_sched_t;
+
+/**
+ * @brief Saves the scheduling state of the calling thread
+ *
+ * @param[out] saved State to pass to wifi_perf_sched_restore()
+ */
+void wifi_perf_sched_save(wifi_perf_sched_t *saved);
+
+/**
+ * @brief Restores a state saved by wifi_perf_sched_save()
+ *
+ * @param[in] saved Saved state
+ */
+void wifi_perf_sched_restore(const wifi_perf_sched_t *saved);
+
+/**
+ * @brief Pins the calling thread to one CPU
+ *
+ * @param[in] cpu CPU number
+ *
+ * @return int - 0 on success, -1 if the CPU does not exist or is not allowed
+ */
+int wifi_perf_pin_cpu(int cpu);
+
+/**
+ * @brief Runs the calling thread at SCHED_FIFO
+ *
+ * @param[in] priority Real-time priority, 1 to 99
+ *
+ * @return int - 0 on success, -1 otherwise, with errno EPERM if not permitted
+ */
+int wifi_perf_set_fifo(int priority);
+
+/**
+ * @brief Measures the cost of one wifi_perf_now_ns() reading
+ *
+ * @param[in] iterations Number of back to back readings
+ *
+ * @return uint64_t - Median gap between two readings in nanoseconds
+ */
+uint64_t wifi_perf_clock_overhead_ns(unsigned iterations);
+
+/**
+ * @brief Applies `WIFI_PERF_CPU` and `WIFI_PERF_FIFO` to the calling thread
+ *
+ * Prints a warning for a setting that cannot be applied.
+ */
+void wifi_perf_stability_init_from_env(void);
+
+/**
+ * @brief Starts a thread without the settings of wifi_perf_stability_init_from_env()
+ *
+ * The thread gets the policy, priority and CPUs the calling thread had before the
+ * settings were applied. Before wifi_perf_stability_init_from_env() it inherits them.
+ *
+ * @param[out] thread Thread handle
+ * @param[in]  fn     Thread function
+ * @param[in]  arg    Argument of fn
+ *
+ * @return int - 0 on success, otherwise the error of pthread_create()
+ */
+int wifi_perf_thread_create(pthread_t *thread, void *(*fn)(void *), void *arg);
+
+#endif // __WIFI_PERF_STABILITY_H__
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
@@ -0,0 +1,152 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_perf_stats.h
+*
+* Latency sample collection and summary statistics used by the benchmark
+* suites. A sample set is not thread safe; give each thread its own set and
+* merge them with wifi_perf_samples_merge() once the threads have finished.
+*/
+
+#ifndef __WIFI_PERF_STATS_H__
+#define __WIFI_PERF_STATS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Growable set of latency samples in nanoseconds
+ */
+typedef struct
+{
+    uint64_t *samples; /*!< Sample values in nanoseconds */
+    size_t count;      /*!< Number of valid samples */
+    size_t capacity;   /*!< Allocated number of samples */
+} wifi_perf_samples_t;
+
+/**
+ * @brief Summary statistics of a sample set, all values in nanoseconds
+ */
+typedef struct
+{
+    size_t count;   /*!< Number of samples */
+    double min;     /*!< Smallest sample */
+    double max;     /*!< Largest sample */
+    double mean;    /*!< Arithmetic mean */
+    double stddev;  /*!< Sample standard deviation */
+    double cv;      /*!< Coefficient of variation (stddev / mean) */
+    double p50;     /*!< Median */
+    double p90;     /*!< 90th percentile */
+    double p99;     /*!< 99th percentile */
+    double total;   /*!< Sum of all samples */
+} wifi_perf_summary_t;
+
+/**
+ * @brief Initialises a sample set
+ *
+ * @param[out] set      Sample set
+ * @param[in]  capacity Initial capacity, grows on demand
+ *
+ * @return int - 0 on success, -1 on allocation failure
+ */
+int wifi_perf_samples_init(wifi_perf_samples_t *set, size_t capacity);
+
+/**
+ * @brief Frees the memory held by a sample set
+ */
+void wifi_perf_samples_free(wifi_perf_samples_t *set);
+
+/**
+ * @brief Discards all samples, keeping the allocation
+ */
+void wifi_perf_samples_clear(wifi_perf_samples_t *set);
+
+/**
+ * @brief Appends a sample
+ *
+ * @return int - 0 on success, -1 if the set could not grow
+ */
+int wifi_perf_samples_add(wifi_perf_samples_t *set, uint64_t value_ns);
+
+/**
+ * @brief Appends every sample of src to dst
+ *
+ * @return int - 0 on success, -1 if dst could not grow
+ */
+int wifi_perf_samples_merge(wifi_perf_samples_t *dst, const wifi_perf_samples_t *src);
+
+/**
+ * @brief Subtracts a fixed overhead from every sample, stopping at zero
+ *
+ * @param[in,out] set         Sample set
+ * @param[in]     overhead_ns Overhead in nanoseconds, e.g. the cost of the timing itself
+ */
+void wifi_perf_samples_subtract(wifi_perf_samples_t *set, uint64_t overhead_ns);
+
+/**
+ * @brief Computes summary statistics. Sorts the samples in place.
+ *
+ * @param[in,out] set     Sample set
+ * @param[out]    summary Result, zeroed if the set is empty
+ */
+void wifi_perf_summarize(wifi_perf_samples_t *set, wifi_perf_summary_t *summary);
+
+/**
+ * @brief Default ratio between loaded and baseline p99 for wifi_perf_blocked()
+ */
+#define WIFI_PERF_BLOCKED_RATIO 10.0
+
+/**
+ * @brief Default minimum p99 increase for wifi_perf_blocked(), in nanoseconds
+ */
+#define WIFI_PERF_BLOCKED_MIN_NS (20.0 * 1000000.0)
+
+/**
+ * @brief Tells whether a call was blocked by concurrent activity
+ *
+ * A call counts as blocked when its p99 under load is WIFI_PERF_BLOCKED_RATIO
+ * times its baseline p99 and more than WIFI_PERF_BLOCKED_MIN_NS slower.
+ *
+ * @param[in] baseline Latency without the concurrent activity
+ * @param[in] loaded   Latency while the concurrent activity runs
+ *
+ * @return int - 1 if blocked, 0 otherwise or if either summary is empty
+ */
+int wifi_perf_blocked(const wifi_perf_summary_t *baseline, const wifi_perf_summary_t *loaded);
+
+/**
+ * @brief Formats a one-line summary in microseconds
+ *
+ * @param[out] buf     Output buffer
+ * @param[in]  size    Size of buf
+ * @param[in]  label   Label printed first
+ * @param[in]  summary Summary to print
+ *
+ * @return const char* - buf
+ */
+const char *wifi_perf_format_summary(char *buf, size_t size, const char *label, const wifi_perf_summary_t *summary);
+
+#endif // __WIFI_PERF_STATS_H__
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
@@ -0,0 +1,413 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_hal_alloc.c
+*
+* Allocator replacements and per-API heap accounting.
+*
+* Definitions of malloc() and friends in the executable take precedence over
+* the C library for every object in the process, including libwifihal.so and
+* the C library's own internal calls. The replacements forward to glibc's
+* __libc_* entry points. Each call is charged to the calling thread's current
+* HAL call, if any, and folded into the per-API totals when the wrapper
+* returns. Block sizes for frees come from malloc_usable_size(), so the heap
+* growth figures are in usable rather than requested bytes.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wifi_hal_alloc.h"
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+/**
+ * @brief Allocations of the HAL call in progress on one thread
+ */
+typedef struct
+{
+    int depth;            /*!< Nesting of wrapped calls, 0 outside HAL calls */
+    wifi_hal_api_t api;   /*!< Outermost API */
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t bytes;
+    int64_t live;         /*!< Usable bytes allocated minus usable bytes freed */
+    int64_t peak;         /*!< Highest value of live */
+} wifi_alloc_call_t;
+
+volatile int wifi_alloc_active = 0;
+
+static __thread wifi_alloc_call_t thread_call;
+
+static wifi_alloc_stats_t api_stats[WIFI_HAL_API_MAX];
+static wifi_alloc_budget_t api_budgets[WIFI_HAL_API_MAX];
+static int api_budget_set[WIFI_HAL_API_MAX];
+
+#ifdef __GLIBC__
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+static inline void alloc_charge(void *ptr, size_t size)
+{
+    wifi_alloc_call_t *call = &thread_call;
+
+    if (call->depth == 0 || ptr == NULL)
+    {
+        return;
+    }
+    call->allocs++;
+    call->bytes += size;
+    call->live += (int64_t)malloc_usable_size(ptr);
+    if (call->live > call->peak)
+    {
+        call->peak = call->live;
+    }
+}
+
+static inline void alloc_release(void *ptr)
+{
+    wifi_alloc_call_t *call = &thread_call;
+
+    if (call->depth == 0 || ptr == NULL)
+    {
+        return;
+    }
+    call->frees++;
+    call->live -= (int64_t)malloc_usable_size(ptr);
+}
+
+void *malloc(size_t size)
+{
+    void *ptr = __libc_malloc(size);
+
+    alloc_charge(ptr, size);
+    return ptr;
+}
+
+void *calloc(size_t count, size_t size)
+{
+    void *ptr = __libc_calloc(count, size);
+
+    alloc_charge(ptr, count * size);
+    return ptr;
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    size_t old_size = (thread_call.depth > 0 && ptr != NULL) ? malloc_usable_size(ptr) : 0;
+    void *moved = __libc_realloc(ptr, size);
+
+    /* glibc frees the block for a zero size and keeps it when the realloc fails */
+    if (thread_call.depth > 0 && ptr != NULL && (moved != NULL || size == 0))
+    {
+        thread_call.frees++;
+        thread_call.live -= (int64_t)old_size;
+    }
+    alloc_charge(moved, size);
+    return moved;
+}
+
+void free(void *ptr)
+{
+    alloc_release(ptr);
+    __libc_free(ptr);
+}
+
+int wifi_alloc_supported(void)
+{
+    return 1;
+}
+
+#else
+
+int wifi_alloc_supported(void)
+{
+    return 0;
+}
+
+#endif
+
+void wifi_alloc_enable(int enable)
+{
+    wifi_alloc_active = enable;
+}
+
+void wifi_alloc_reset(void)
+{
+    for (int api = 0; api < WIFI_HAL_API_MAX; api++)
+    {
+        wifi_alloc_stats_t *stats = &api_stats[api];
+
+        __atomic_store_n(&stats->calls, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&stats->allocs, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&stats->frees, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&stats->bytes, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&stats->retained, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&stats->max_call_allocs, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&stats->max_call_bytes, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&stats->max_call_peak, 0, __ATOMIC_RELAXED);
+    }
+}
+
+void wifi_alloc_call_enter(wifi_hal_api_t api)
+{
+    wifi_alloc_call_t *call = &thread_call;
+
+    if (call->depth++ > 0)
+    {
+        return;
+    }
+    call->api = api;
+    call->allocs = 0;
+    call->frees = 0;
+    call->bytes = 0;
+    call->live = 0;
+    call->peak = 0;
+}
+
+static void alloc_store_max(uint64_t *target, uint64_t value)
+{
+    uint64_t current = __atomic_load_n(target, __ATOMIC_RELAXED);
+
+    while (value > current &&
+           !__atomic_compare_exchange_n(target, &current, value, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+}
+
+void wifi_alloc_call_exit(wifi_hal_api_t api)
+{
+    wifi_alloc_call_t *call = &thread_call;
+    wifi_alloc_stats_t *stats;
+
+    (void)api;
+    if (call->depth == 0 || --call->depth > 0 || (unsigned)call->api >= WIFI_HAL_API_MAX)
+    {
+        return;
+    }
+    stats = &api_stats[call->api];
+    __atomic_fetch_add(&stats->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->allocs, call->allocs, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->frees, call->frees, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->bytes, call->bytes, __ATOMIC_RELAXED);
+    if (call->live > 0)
+    {
+        __atomic_fetch_add(&stats->retained, (uint64_t)call->live, __ATOMIC_RELAXED);
+    }
+    alloc_store_max(&stats->max_call_allocs, call->allocs);
+    alloc_store_max(&stats->max_call_bytes, call->bytes);
+    alloc_store_max(&stats->max_call_peak, (uint64_t)call->peak);
+}
+
+void wifi_alloc_get(wifi_hal_api_t api, wifi_alloc_stats_t *stats)
+{
+    if (stats == NULL)
+    {
+        return;
+    }
+    memset(stats, 0, sizeof(*stats));
+    if ((unsigned)api >= WIFI_HAL_API_MAX)
+    {
+        return;
+    }
+    stats->calls = __atomic_load_n(&api_stats[api].calls, __ATOMIC_RELAXED);
+    stats->allocs = __atomic_load_n(&api_stats[api].allocs, __ATOMIC_RELAXED);
+    stats->frees = __atomic_load_n(&api_stats[api].frees, __ATOMIC_RELAXED);
+    stats->bytes = __atomic_load_n(&api_stats[api].bytes, __ATOMIC_RELAXED);
+    stats->retained = __atomic_load_n(&api_stats[api].retained, __ATOMIC_RELAXED);
+    stats->max_call_allocs = __atomic_load_n(&api_stats[api].max_call_allocs, __ATOMIC_RELAXED);
+    stats->max_call_bytes = __atomic_load_n(&api_stats[api].max_call_bytes, __ATOMIC_RELAXED);
+    stats->max_call_peak = __atomic_load_n(&api_stats[api].max_call_peak, __ATOMIC_RELAXED);
+}
+
+void wifi_alloc_set_budget(wifi_hal_api_t api, const wifi_alloc_budget_t *budget)
+{
+    if ((unsigned)api >= WIFI_HAL_API_MAX)
+    {
+        return;
+    }
+    if (budget == NULL)
+    {
+        api_budget_set[api] = 0;
+        return;
+    }
+    api_budgets[api] = *budget;
+    api_budget_set[api] = 1;
+}
+
+int wifi_alloc_get_budget(wifi_hal_api_t api, wifi_alloc_budget_t *budget)
+{
+    int set = ((unsigned)api < WIFI_HAL_API_MAX) && api_budget_set[api];
+
+    if (budget != NULL)
+    {
+        budget->max_allocs = set ? api_budgets[api].max_allocs : -1;
+        budget->max_bytes = set ? api_budgets[api].max_bytes : -1;
+    }
+    return set;
+}
+
+int wifi_alloc_parse_budgets(const char *spec)
+{
+    const char *entry = spec;
+
+    if (spec == NULL)
+    {
+        return -1;
+    }
+    while (*entry != '\0')
+    {
+        const char *end = strchr(entry, ',');
+        size_t len = (end != NULL) ? (size_t)(end - entry) : strlen(entry);
+        char name[64];
+        const char *equals = memchr(entry, '=', len);
+        wifi_alloc_budget_t budget = { -1, -1 };
+        wifi_hal_api_t api;
+        char *parse_end;
+
+        if (equals == NULL || (size_t)(equals - entry) >= sizeof(name))
+        {
+            return -1;
+        }
+        memcpy(name, entry, (size_t)(equals - entry));
+        name[equals - entry] = '\0';
+        api = wifi_hal_api_from_name(name);
+        if (api == WIFI_HAL_API_MAX)
+        {
+            return -1;
+        }
+
+        budget.max_allocs = strtoll(equals + 1, &parse_end, 10);
+        if (parse_end == equals + 1 || budget.max_allocs < 0)
+        {
+            return -1;
+        }
+        if (*parse_end == ':')
+        {
+            const char *bytes = parse_end + 1;
+
+            budget.max_bytes = strtoll(bytes, &parse_end, 10);
+            if (parse_end == bytes || budget.max_bytes < 0)
+            {
+                return -1;
+            }
+        }
+        if (parse_end != entry + len)
+        {
+            return -1;
+        }
+        wifi_alloc_set_budget(api, &budget);
+
+        entry += len;
+        if (*entry == ',')
+        {
+            entry++;
+        }
+    }
+    return 0;
+}
+
+int wifi_alloc_within_budget(wifi_hal_api_t api)
+{
+    wifi_alloc_budget_t budget;
+    wifi_alloc_stats_t stats;
+
+    if (!wifi_alloc_get_budget(api, &budget))
+    {
+        return 1;
+    }
+    wifi_alloc_get(api, &stats);
+    if (budget.max_allocs >= 0 && stats.max_call_allocs > (uint64_t)budget.max_allocs)
+    {
+        return 0;
+    }
+    if (budget.max_bytes >= 0 && stats.max_call_bytes > (uint64_t)budget.max_bytes)
+    {
+        return 0;
+    }
+    return 1;
+}
+
+void wifi_alloc_init_from_env(void)
+{
+    const char *budgets = getenv("WIFI_HAL_ALLOC_BUDGET");
+
+    if (budgets != NULL && wifi_alloc_parse_budgets(budgets) != 0)
+    {
+        fprintf(stderr, "WIFI_HAL_ALLOC_BUDGET: cannot parse \"%s\"\n", budgets);
+    }
+    if (getenv("WIFI_HAL_ALLOC") != NULL)
+    {
+        wifi_alloc_enable(1);
+    }
+}
+
+int wifi_alloc_finish(void)
+{
+    int over = 0;
+
+    if (getenv("WIFI_HAL_ALLOC") == NULL)
+    {
+        return 0;
+    }
+    wifi_alloc_enable(0);
+    if (!wifi_alloc_supported())
+    {
+        printf("\nHeap accounting is not supported on this platform\n");
+        return 0;
+    }
+
+    printf("\n%-40s %8s %8s %8s %10s %10s %8s %10s %10s  %s\n", "api", "calls", "allocs", "frees", "bytes",
+           "retained", "max/call", "bytes/call", "peak/call", "budget");
+    for (int api = 0; api < WIFI_HAL_API_MAX; api++)
+    {
+        wifi_alloc_stats_t stats;
+        wifi_alloc_budget_t budget;
+        const char *verdict = "-";
+
+        wifi_alloc_get((wifi_hal_api_t)api, &stats);
+        if (stats.calls == 0)
+        {
+            continue;
+        }
+        if (wifi_alloc_get_budget((wifi_hal_api_t)api, &budget))
+        {
+            verdict = wifi_alloc_within_budget((wifi_hal_api_t)api) ? "ok" : "OVER";
+            over += (verdict[0] == 'O');
+        }
+        printf("%-40s %8llu %8llu %8llu %10llu %10llu %8llu %10llu %10llu  %s\n", wifi_hal_api_name((wifi_hal_api_t)api),
+               (unsigned long long)stats.calls, (unsigned long long)stats.allocs, (unsigned long long)stats.frees,
+               (unsigned long long)stats.bytes, (unsigned long long)stats.retained,
+               (unsigned long long)stats.max_call_allocs, (unsigned long long)stats.max_call_bytes,
+               (unsigned long long)stats.max_call_peak, verdict);
+    }
+    return over;
+}
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
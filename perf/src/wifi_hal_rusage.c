@@ -0,0 +1,354 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_hal_rusage.c
+*
+* getrusage() and hardware counter deltas per HAL call.
+*
+* Each thread opens its counter group on its first accounted call and keeps
+* it until it exits. The group counts continuously; a call is charged the
+* difference between two reads of the group leader.
+*/
+
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/perf_event.h>
+#include "wifi_hal_rusage.h"
+#include "wifi_perf_clock.h"
+
+#define RUSAGE_COUNTERS 3
+
+/**
+ * @brief Counter group read with PERF_FORMAT_GROUP
+ */
+typedef struct
+{
+    uint64_t nr;
+    uint64_t values[RUSAGE_COUNTERS];
+} wifi_rusage_group_t;
+
+/**
+ * @brief Accounting state of one thread
+ */
+typedef struct
+{
+    int depth;                       /*!< Nesting of wrapped calls, 0 outside HAL calls */
+    wifi_hal_api_t api;              /*!< Outermost API */
+    struct rusage start;             /*!< Reading taken on entry */
+    wifi_rusage_group_t counters;    /*!< Counter reading taken on entry */
+    int counted;                     /*!< Non-zero if counters holds a valid reading */
+    int fds[RUSAGE_COUNTERS];        /*!< Counter file descriptors, fds[0] leads the group */
+    wifi_rusage_counters_t mode;     /*!< What the thread's counters measure */
+    int opened;                      /*!< Non-zero once opening the counters was attempted */
+} wifi_rusage_thread_t;
+
+volatile int wifi_rusage_active = 0;
+
+static __thread wifi_rusage_thread_t thread_state;
+static wifi_rusage_stats_t api_stats[WIFI_HAL_API_MAX];
+static pthread_key_t thread_key;
+static pthread_once_t thread_key_once = PTHREAD_ONCE_INIT;
+
+static const uint64_t counter_configs[RUSAGE_COUNTERS] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+};
+
+static void rusage_close_counters(wifi_rusage_thread_t *state)
+{
+    for (int i = 0; i < RUSAGE_COUNTERS; i++)
+    {
+        if (state->fds[i] >= 0)
+        {
+            close(state->fds[i]);
+            state->fds[i] = -1;
+        }
+    }
+    state->mode = WIFI_RUSAGE_COUNTERS_NONE;
+}
+
+static void rusage_thread_exit(void *arg)
+{
+    rusage_close_counters((wifi_rusage_thread_t *)arg);
+}
+
+static void rusage_create_key(void)
+{
+    pthread_key_create(&thread_key, rusage_thread_exit);
+}
+
+static int rusage_open_group(wifi_rusage_thread_t *state, int exclude_kernel)
+{
+    for (int i = 0; i < RUSAGE_COUNTERS; i++)
+    {
+        struct perf_event_attr attr;
+
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = counter_configs[i];
+        attr.read_format = PERF_FORMAT_GROUP;
+        attr.exclude_kernel = exclude_kernel;
+        attr.exclude_hv = 1;
+        /* pid 0 and cpu -1: the calling thread on whichever CPU it runs */
+        state->fds[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, (i == 0) ? -1 : state->fds[0], PERF_FLAG_FD_CLOEXEC);
+        if (state->fds[i] < 0)
+        {
+            rusage_close_counters(state);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void rusage_open_counters(wifi_rusage_thread_t *state)
+{
+    state->opened = 1;
+    for (int i = 0; i < RUSAGE_COUNTERS; i++)
+    {
+        state->fds[i] = -1;
+    }
+    if (rusage_open_group(state, 0) == 0)
+    {
+        state->mode = WIFI_RUSAGE_COUNTERS_ALL;
+    }
+    else if (rusage_open_group(state, 1) == 0)
+    {
+        state->mode = WIFI_RUSAGE_COUNTERS_USER;
+    }
+    else
+    {
+        return;
+    }
+    pthread_once(&thread_key_once, rusage_create_key);
+    pthread_setspecific(thread_key, state);
+}
+
+static int rusage_read_counters(wifi_rusage_thread_t *state, wifi_rusage_group_t *group)
+{
+    if (state->mode == WIFI_RUSAGE_COUNTERS_NONE)
+    {
+        return 0;
+    }
+    return (read(state->fds[0], group, sizeof(*group)) == (ssize_t)sizeof(*group) && group->nr == RUSAGE_COUNTERS);
+}
+
+static uint64_t rusage_timeval_ns(const struct timeval *end, const struct timeval *start)
+{
+    int64_t ns = ((int64_t)end->tv_sec - start->tv_sec) * (int64_t)WIFI_PERF_NS_PER_SEC +
+                 ((int64_t)end->tv_usec - start->tv_usec) * (int64_t)WIFI_PERF_NS_PER_US;
+
+    return (ns > 0) ? (uint64_t)ns : 0;
+}
+
+static uint64_t rusage_diff(long end, long start)
+{
+    return (end > start) ? (uint64_t)(end - start) : 0;
+}
+
+void wifi_rusage_enable(int enable)
+{
+    wifi_rusage_active = enable;
+}
+
+void wifi_rusage_reset(void)
+{
+    for (int api = 0; api < WIFI_HAL_API_MAX; api++)
+    {
+        uint64_t *fields = (uint64_t *)&api_stats[api];
+
+        for (size_t i = 0; i < sizeof(api_stats[api]) / sizeof(uint64_t); i++)
+        {
+            __atomic_store_n(&fields[i], 0, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+wifi_rusage_counters_t wifi_rusage_counters(void)
+{
+    if (!thread_state.opened)
+    {
+        rusage_open_counters(&thread_state);
+    }
+    return thread_state.mode;
+}
+
+void wifi_rusage_call_enter(wifi_hal_api_t api)
+{
+    wifi_rusage_thread_t *state = &thread_state;
+
+    if (state->depth++ > 0)
+    {
+        return;
+    }
+    if (!state->opened)
+    {
+        rusage_open_counters(state);
+    }
+    state->api = api;
+    getrusage(RUSAGE_THREAD, &state->start);
+    state->counted = rusage_read_counters(state, &state->counters);
+}
+
+void wifi_rusage_call_exit(wifi_hal_api_t api)
+{
+    wifi_rusage_thread_t *state = &thread_state;
+    wifi_rusage_group_t counters;
+    wifi_rusage_stats_t *stats;
+    struct rusage end;
+    int counted;
+
+    (void)api;
+    if (state->depth == 0 || --state->depth > 0 || (unsigned)state->api >= WIFI_HAL_API_MAX)
+    {
+        return;
+    }
+    counted = state->counted && rusage_read_counters(state, &counters);
+    getrusage(RUSAGE_THREAD, &end);
+
+    stats = &api_stats[state->api];
+    __atomic_fetch_add(&stats->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->voluntary_switches, rusage_diff(end.ru_nvcsw, state->start.ru_nvcsw), __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->involuntary_switches, rusage_diff(end.ru_nivcsw, state->start.ru_nivcsw), __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->user_ns, rusage_timeval_ns(&end.ru_utime, &state->start.ru_utime), __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->system_ns, rusage_timeval_ns(&end.ru_stime, &state->start.ru_stime), __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->minor_faults, rusage_diff(end.ru_minflt, state->start.ru_minflt), __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->major_faults, rusage_diff(end.ru_majflt, state->start.ru_majflt), __ATOMIC_RELAXED);
+    if (counted)
+    {
+        __atomic_fetch_add(&stats->counted_calls, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&stats->cycles, counters.values[0] - state->counters.values[0], __ATOMIC_RELAXED);
+        __atomic_fetch_add(&stats->instructions, counters.values[1] - state->counters.values[1], __ATOMIC_RELAXED);
+        __atomic_fetch_add(&stats->cache_misses, counters.values[2] - state->counters.values[2], __ATOMIC_RELAXED);
+    }
+}
+
+void wifi_rusage_get(wifi_hal_api_t api, wifi_rusage_stats_t *stats)
+{
+    const uint64_t *fields;
+    uint64_t *out;
+
+    if (stats == NULL)
+    {
+        return;
+    }
+    memset(stats, 0, sizeof(*stats));
+    if ((unsigned)api >= WIFI_HAL_API_MAX)
+    {
+        return;
+    }
+    fields = (const uint64_t *)&api_stats[api];
+    out = (uint64_t *)stats;
+    for (size_t i = 0; i < sizeof(*stats) / sizeof(uint64_t); i++)
+    {
+        out[i] = __atomic_load_n(&fields[i], __ATOMIC_RELAXED);
+    }
+}
+
+static double rusage_per_call(uint64_t value, uint64_t calls)
+{
+    return (calls > 0) ? (double)value / (double)calls : 0.0;
+}
+
+void wifi_rusage_report(int csv)
+{
+    static const char *mode_names[] = { "not available", "user space only", "user space and kernel" };
+    wifi_rusage_counters_t mode = wifi_rusage_counters();
+
+    if (csv)
+    {
+        printf("api,calls,voluntary_cs,involuntary_cs,user_us,system_us,minor_faults,major_faults,counted_calls,cycles,instructions,cache_misses\n");
+    }
+    else
+    {
+        printf("\nPer call averages, hardware counters %s\n", mode_names[mode]);
+        printf("%-40s %8s %8s %8s %10s %10s %8s %8s %12s %12s %6s %10s\n", "api", "calls", "vol cs", "invol cs",
+               "user us", "sys us", "minflt", "majflt", "cycles", "instr", "ipc", "llc miss");
+    }
+    for (int api = 0; api < WIFI_HAL_API_MAX; api++)
+    {
+        wifi_rusage_stats_t stats;
+
+        wifi_rusage_get((wifi_hal_api_t)api, &stats);
+        if (stats.calls == 0)
+        {
+            continue;
+        }
+        if (csv)
+        {
+            printf("%s,%llu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%llu,%.1f,%.1f,%.1f\n", wifi_hal_api_name((wifi_hal_api_t)api),
+                   (unsigned long long)stats.calls, rusage_per_call(stats.voluntary_switches, stats.calls),
+                   rusage_per_call(stats.involuntary_switches, stats.calls),
+                   rusage_per_call(stats.user_ns, stats.calls) / WIFI_PERF_NS_PER_US,
+                   rusage_per_call(stats.system_ns, stats.calls) / WIFI_PERF_NS_PER_US,
+                   rusage_per_call(stats.minor_faults, stats.calls), rusage_per_call(stats.major_faults, stats.calls),
+                   (unsigned long long)stats.counted_calls, rusage_per_call(stats.cycles, stats.counted_calls),
+                   rusage_per_call(stats.instructions, stats.counted_calls),
+                   rusage_per_call(stats.cache_misses, stats.counted_calls));
+        }
+        else
+        {
+            printf("%-40s %8llu %8.2f %8.2f %10.2f %10.2f %8.2f %8.2f %12.0f %12.0f %6.2f %10.1f\n",
+                   wifi_hal_api_name((wifi_hal_api_t)api), (unsigned long long)stats.calls,
+                   rusage_per_call(stats.voluntary_switches, stats.calls),
+                   rusage_per_call(stats.involuntary_switches, stats.calls),
+                   rusage_per_call(stats.user_ns, stats.calls) / WIFI_PERF_NS_PER_US,
+                   rusage_per_call(stats.system_ns, stats.calls) / WIFI_PERF_NS_PER_US,
+                   rusage_per_call(stats.minor_faults, stats.calls), rusage_per_call(stats.major_faults, stats.calls),
+                   rusage_per_call(stats.cycles, stats.counted_calls),
+                   rusage_per_call(stats.instructions, stats.counted_calls),
+                   rusage_per_call(stats.instructions, stats.cycles),
+                   rusage_per_call(stats.cache_misses, stats.counted_calls));
+        }
+    }
+    fflush(stdout);
+}
+
+void wifi_rusage_init_from_env(void)
+{
+    if (getenv("WIFI_HAL_RUSAGE") != NULL)
+    {
+        wifi_rusage_enable(1);
+    }
+}
+
+void wifi_rusage_finish(void)
+{
+    if (getenv("WIFI_HAL_RUSAGE") == NULL)
+    {
+        return;
+    }
+    wifi_rusage_enable(0);
+    wifi_rusage_report(0);
+}
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
@@ -0,0 +1,520 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_hal_spawn.c
+*
+* Process start replacements and per-API statistics.
+*
+* Each replacement looks up the C library function with dlsym(RTLD_NEXT) on
+* first use and forwards to it. The statistics table lives in an anonymous
+* shared mapping, so that an exec made by a forked child is still charged to
+* the API that forked it; the child inherits the calling thread's state.
+* popen() and system() start their shell without going through the other
+* replacements, so each process is counted once.
+*/
+
+#define _GNU_SOURCE
+
+#include <dlfcn.h>
+#include <spawn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "wifi_hal_spawn.h"
+#include "wifi_perf_clock.h"
+
+/**
+ * @brief Statistics shared with forked children, the last slot is for processes started outside HAL calls
+ */
+typedef struct
+{
+    wifi_spawn_stats_t slots[WIFI_HAL_API_MAX + 1];
+    int command_claimed[WIFI_HAL_API_MAX + 1];
+} wifi_spawn_table_t;
+
+/**
+ * @brief The HAL call in progress on one thread
+ */
+typedef struct
+{
+    int depth;            /*!< Nesting of wrapped calls, 0 outside HAL calls */
+    wifi_hal_api_t api;   /*!< Outermost API */
+    uint64_t spawns;      /*!< Processes started by this call */
+    uint64_t spawn_ns;    /*!< Time this call spent starting and waiting for them */
+} wifi_spawn_call_t;
+
+typedef pid_t (*fork_fn)(void);
+typedef int (*posix_spawn_fn)(pid_t *, const char *, const posix_spawn_file_actions_t *, const posix_spawnattr_t *,
+                              char *const[], char *const[]);
+typedef int (*execve_fn)(const char *, char *const[], char *const[]);
+typedef int (*execv_fn)(const char *, char *const[]);
+typedef FILE *(*popen_fn)(const char *, const char *);
+typedef int (*pclose_fn)(FILE *);
+typedef int (*system_fn)(const char *);
+typedef pid_t (*waitpid_fn)(pid_t, int *, int);
+typedef pid_t (*wait_fn)(int *);
+
+volatile int wifi_spawn_active = 0;
+
+static wifi_spawn_table_t *spawn_table = NULL;
+static int spawn_critical[WIFI_HAL_API_MAX];
+static __thread wifi_spawn_call_t thread_call;
+
+static const char *kind_names[WIFI_SPAWN_KIND_MAX] = { "fork", "posix_spawn", "exec", "popen", "system" };
+
+/* Resolves the C library function once, concurrent first calls store the same value */
+static void *spawn_real(void **cache, const char *name)
+{
+    void *fn = __atomic_load_n(cache, __ATOMIC_RELAXED);
+
+    if (fn == NULL)
+    {
+        fn = dlsym(RTLD_NEXT, name);
+        __atomic_store_n(cache, fn, __ATOMIC_RELAXED);
+    }
+    return fn;
+}
+
+#define SPAWN_REAL(type, name) \
+    static type real_##name(void) \
+    { \
+        static void *cache = NULL; \
+        return (type)spawn_real(&cache, #name); \
+    }
+
+SPAWN_REAL(fork_fn, fork)
+SPAWN_REAL(posix_spawn_fn, posix_spawn)
+SPAWN_REAL(posix_spawn_fn, posix_spawnp)
+SPAWN_REAL(execve_fn, execve)
+SPAWN_REAL(execv_fn, execv)
+SPAWN_REAL(execv_fn, execvp)
+SPAWN_REAL(popen_fn, popen)
+SPAWN_REAL(pclose_fn, pclose)
+SPAWN_REAL(system_fn, system)
+SPAWN_REAL(waitpid_fn, waitpid)
+SPAWN_REAL(wait_fn, wait)
+
+static inline int spawn_watching(void)
+{
+    return wifi_spawn_active && spawn_table != NULL;
+}
+
+static void spawn_note(wifi_spawn_kind_t kind, const char *command)
+{
+    wifi_spawn_table_t *table = spawn_table;
+    int slot;
+
+    if (!spawn_watching())
+    {
+        return;
+    }
+    slot = (thread_call.depth > 0) ? (int)thread_call.api : WIFI_HAL_API_MAX;
+    if (thread_call.depth > 0)
+    {
+        thread_call.spawns++;
+    }
+    __atomic_fetch_add(&table->slots[slot].spawns[kind], 1, __ATOMIC_RELAXED);
+    if (command != NULL && !__atomic_exchange_n(&table->command_claimed[slot], 1, __ATOMIC_ACQ_REL))
+    {
+        snprintf(table->slots[slot].command, sizeof(table->slots[slot].command), "%s", command);
+    }
+}
+
+/* Waits are only charged inside HAL calls, the tests reap their own children too */
+static void spawn_time(uint64_t start_ns, int wait)
+{
+    uint64_t elapsed = wifi_perf_now_ns() - start_ns;
+
+    if (!spawn_watching())
+    {
+        return;
+    }
+    if (thread_call.depth > 0)
+    {
+        thread_call.spawn_ns += elapsed;
+    }
+    else if (!wait)
+    {
+        __atomic_fetch_add(&spawn_table->slots[WIFI_HAL_API_MAX].spawn_ns, elapsed, __ATOMIC_RELAXED);
+    }
+}
+
+pid_t fork(void)
+{
+    uint64_t start = wifi_perf_now_ns();
+    pid_t pid = real_fork()();
+
+    if (pid > 0)
+    {
+        spawn_note(WIFI_SPAWN_FORK, NULL);
+        spawn_time(start, 0);
+    }
+    return pid;
+}
+
+pid_t vfork(void)
+{
+    return fork();
+}
+
+int posix_spawn(pid_t *pid, const char *path, const posix_spawn_file_actions_t *file_actions,
+                const posix_spawnattr_t *attrp, char *const argv[], char *const envp[])
+{
+    uint64_t start = wifi_perf_now_ns();
+    int ret = real_posix_spawn()(pid, path, file_actions, attrp, argv, envp);
+
+    if (ret == 0)
+    {
+        spawn_note(WIFI_SPAWN_POSIX_SPAWN, path);
+    }
+    spawn_time(start, 0);
+    return ret;
+}
+
+int posix_spawnp(pid_t *pid, const char *file, const posix_spawn_file_actions_t *file_actions,
+                 const posix_spawnattr_t *attrp, char *const argv[], char *const envp[])
+{
+    uint64_t start = wifi_perf_now_ns();
+    int ret = real_posix_spawnp()(pid, file, file_actions, attrp, argv, envp);
+
+    if (ret == 0)
+    {
+        spawn_note(WIFI_SPAWN_POSIX_SPAWN, file);
+    }
+    spawn_time(start, 0);
+    return ret;
+}
+
+/* Noted before the call, a successful exec does not return */
+int execve(const char *path, char *const argv[], char *const envp[])
+{
+    spawn_note(WIFI_SPAWN_EXEC, path);
+    return real_execve()(path, argv, envp);
+}
+
+int execv(const char *path, char *const argv[])
+{
+    spawn_note(WIFI_SPAWN_EXEC, path);
+    return real_execv()(path, argv);
+}
+
+int execvp(const char *file, char *const argv[])
+{
+    spawn_note(WIFI_SPAWN_EXEC, file);
+    return real_execvp()(file, argv);
+}
+
+FILE *popen(const char *command, const char *type)
+{
+    uint64_t start = wifi_perf_now_ns();
+    FILE *fp = real_popen()(command, type);
+
+    if (fp != NULL)
+    {
+        spawn_note(WIFI_SPAWN_POPEN, command);
+    }
+    spawn_time(start, 0);
+    return fp;
+}
+
+int pclose(FILE *stream)
+{
+    uint64_t start = wifi_perf_now_ns();
+    int ret = real_pclose()(stream);
+
+    spawn_time(start, 1);
+    return ret;
+}
+
+int system(const char *command)
+{
+    uint64_t start = wifi_perf_now_ns();
+    int ret = real_system()(command);
+
+    /* system(NULL) only asks whether a shell exists */
+    if (command != NULL)
+    {
+        spawn_note(WIFI_SPAWN_SYSTEM, command);
+        spawn_time(start, 0);
+    }
+    return ret;
+}
+
+pid_t waitpid(pid_t pid, int *status, int options)
+{
+    uint64_t start = wifi_perf_now_ns();
+    pid_t ret = real_waitpid()(pid, status, options);
+
+    spawn_time(start, 1);
+    return ret;
+}
+
+pid_t wait(int *status)
+{
+    uint64_t start = wifi_perf_now_ns();
+    pid_t ret = real_wait()(status);
+
+    spawn_time(start, 1);
+    return ret;
+}
+
+const char *wifi_spawn_kind_name(wifi_spawn_kind_t kind)
+{
+    if ((unsigned)kind >= WIFI_SPAWN_KIND_MAX)
+    {
+        return "unknown";
+    }
+    return kind_names[kind];
+}
+
+int wifi_spawn_enable(int enable)
+{
+    if (enable && spawn_table == NULL)
+    {
+        void *table = mmap(NULL, sizeof(wifi_spawn_table_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+        if (table == MAP_FAILED)
+        {
+            return -1;
+        }
+        spawn_table = table;
+    }
+    wifi_spawn_active = enable;
+    return 0;
+}
+
+void wifi_spawn_reset(void)
+{
+    if (spawn_table != NULL)
+    {
+        memset(spawn_table, 0, sizeof(*spawn_table));
+    }
+}
+
+void wifi_spawn_call_enter(wifi_hal_api_t api)
+{
+    wifi_spawn_call_t *call = &thread_call;
+
+    if (call->depth++ > 0)
+    {
+        return;
+    }
+    call->api = api;
+    call->spawns = 0;
+    call->spawn_ns = 0;
+}
+
+void wifi_spawn_call_exit(wifi_hal_api_t api)
+{
+    wifi_spawn_call_t *call = &thread_call;
+    wifi_spawn_stats_t *slot;
+    uint64_t current;
+
+    (void)api;
+    if (call->depth == 0 || --call->depth > 0 || (unsigned)call->api >= WIFI_HAL_API_MAX || spawn_table == NULL)
+    {
+        return;
+    }
+    slot = &spawn_table->slots[call->api];
+    __atomic_fetch_add(&slot->calls, 1, __ATOMIC_RELAXED);
+    if (call->spawns == 0)
+    {
+        return;
+    }
+    __atomic_fetch_add(&slot->spawning_calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->spawn_ns, call->spawn_ns, __ATOMIC_RELAXED);
+    current = __atomic_load_n(&slot->max_call_spawn_ns, __ATOMIC_RELAXED);
+    while (call->spawn_ns > current &&
+           !__atomic_compare_exchange_n(&slot->max_call_spawn_ns, &current, call->spawn_ns, 1, __ATOMIC_RELAXED,
+                                        __ATOMIC_RELAXED))
+    {
+    }
+}
+
+void wifi_spawn_get(wifi_hal_api_t api, wifi_spawn_stats_t *stats)
+{
+    wifi_spawn_stats_t *slot;
+
+    if (stats == NULL)
+    {
+        return;
+    }
+    memset(stats, 0, sizeof(*stats));
+    if ((unsigned)api > WIFI_HAL_API_MAX || spawn_table == NULL)
+    {
+        return;
+    }
+    slot = &spawn_table->slots[api];
+    stats->calls = __atomic_load_n(&slot->calls, __ATOMIC_RELAXED);
+    stats->spawning_calls = __atomic_load_n(&slot->spawning_calls, __ATOMIC_RELAXED);
+    for (int kind = 0; kind < WIFI_SPAWN_KIND_MAX; kind++)
+    {
+        stats->spawns[kind] = __atomic_load_n(&slot->spawns[kind], __ATOMIC_RELAXED);
+    }
+    stats->spawn_ns = __atomic_load_n(&slot->spawn_ns, __ATOMIC_RELAXED);
+    stats->max_call_spawn_ns = __atomic_load_n(&slot->max_call_spawn_ns, __ATOMIC_RELAXED);
+    if (__atomic_load_n(&spawn_table->command_claimed[api], __ATOMIC_ACQUIRE))
+    {
+        memcpy(stats->command, slot->command, sizeof(stats->command));
+        stats->command[sizeof(stats->command) - 1] = '\0';
+    }
+}
+
+void wifi_spawn_set_critical(wifi_hal_api_t api, int critical)
+{
+    if ((unsigned)api < WIFI_HAL_API_MAX)
+    {
+        spawn_critical[api] = critical;
+    }
+}
+
+int wifi_spawn_is_critical(wifi_hal_api_t api)
+{
+    return ((unsigned)api < WIFI_HAL_API_MAX) && spawn_critical[api];
+}
+
+int wifi_spawn_parse_critical(const char *spec)
+{
+    const char *entry = spec;
+
+    if (spec == NULL)
+    {
+        return -1;
+    }
+    while (*entry != '\0')
+    {
+        size_t len = strcspn(entry, ",");
+        char name[64];
+        wifi_hal_api_t api;
+
+        if (len >= sizeof(name))
+        {
+            return -1;
+        }
+        memcpy(name, entry, len);
+        name[len] = '\0';
+        api = wifi_hal_api_from_name(name);
+        if (api == WIFI_HAL_API_MAX)
+        {
+            return -1;
+        }
+        wifi_spawn_set_critical(api, 1);
+
+        entry += len;
+        if (*entry == ',')
+        {
+            entry++;
+        }
+    }
+    return 0;
+}
+
+int wifi_spawn_check(wifi_hal_api_t api)
+{
+    wifi_spawn_stats_t stats;
+
+    if (!wifi_spawn_is_critical(api))
+    {
+        return 1;
+    }
+    wifi_spawn_get(api, &stats);
+    return (stats.spawning_calls == 0);
+}
+
+void wifi_spawn_init_from_env(void)
+{
+    const char *critical = getenv("WIFI_HAL_SPAWN_CRITICAL");
+
+    if (critical != NULL && wifi_spawn_parse_critical(critical) != 0)
+    {
+        fprintf(stderr, "WIFI_HAL_SPAWN_CRITICAL: cannot parse \"%s\"\n", critical);
+    }
+    if (getenv("WIFI_HAL_SPAWN") != NULL && wifi_spawn_enable(1) != 0)
+    {
+        fprintf(stderr, "WIFI_HAL_SPAWN: cannot map the statistics table\n");
+    }
+}
+
+int wifi_spawn_finish(void)
+{
+    int failed = 0;
+    int rows = 0;
+
+    if (getenv("WIFI_HAL_SPAWN") == NULL)
+    {
+        return 0;
+    }
+    wifi_spawn_enable(0);
+
+    for (int api = 0; api <= WIFI_HAL_API_MAX; api++)
+    {
+        wifi_spawn_stats_t stats;
+
+        wifi_spawn_get((wifi_hal_api_t)api, &stats);
+        for (int kind = 0; kind < WIFI_SPAWN_KIND_MAX; kind++)
+        {
+            rows += (stats.spawns[kind] > 0);
+        }
+    }
+    if (rows == 0)
+    {
+        printf("\nNo process was started while WIFI_HAL_SPAWN was set\n");
+        return 0;
+    }
+
+    printf("\n%-40s %8s %8s %6s %6s %6s %6s %6s %12s %12s  %s\n", "api", "calls", "spawning", "fork", "spawn",
+           "exec", "popen", "system", "total ms", "max/call ms", "first command");
+    for (int api = 0; api <= WIFI_HAL_API_MAX; api++)
+    {
+        wifi_spawn_stats_t stats;
+        uint64_t spawns = 0;
+        int bad;
+
+        wifi_spawn_get((wifi_hal_api_t)api, &stats);
+        for (int kind = 0; kind < WIFI_SPAWN_KIND_MAX; kind++)
+        {
+            spawns += stats.spawns[kind];
+        }
+        if (spawns == 0)
+        {
+            continue;
+        }
+        bad = (api < WIFI_HAL_API_MAX) && !wifi_spawn_check((wifi_hal_api_t)api);
+        failed += bad;
+        printf("%-40s %8llu %8llu %6llu %6llu %6llu %6llu %6llu %12.3f %12.3f  %s%s\n",
+               (api < WIFI_HAL_API_MAX) ? wifi_hal_api_name((wifi_hal_api_t)api) : "(outside HAL calls)",
+               (unsigned long long)stats.calls, (unsigned long long)stats.spawning_calls,
+               (unsigned long long)stats.spawns[WIFI_SPAWN_FORK], (unsigned long long)stats.spawns[WIFI_SPAWN_POSIX_SPAWN],
+               (unsigned long long)stats.spawns[WIFI_SPAWN_EXEC], (unsigned long long)stats.spawns[WIFI_SPAWN_POPEN],
+               (unsigned long long)stats.spawns[WIFI_SPAWN_SYSTEM], (double)stats.spawn_ns / WIFI_PERF_NS_PER_MS,
+               (double)stats.max_call_spawn_ns / WIFI_PERF_NS_PER_MS, stats.command, bad ? "  CRITICAL" : "");
+    }
+    return failed;
+}
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
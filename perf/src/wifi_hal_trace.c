@@ -0,0 +1,573 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_hal_trace.c
+*
+*/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "wifi_hal_trace.h"
+
+#define WIFI_TRACE_DEFAULT_EVENTS 16384
+#define WIFI_TRACE_MAX_EVENTS (1U << 24)
+
+/* Perfetto BuiltinClock value for CLOCK_MONOTONIC */
+#define PERFETTO_CLOCK_MONOTONIC 3
+#define PERFETTO_SEQUENCE_ID 1
+#define PERFETTO_TRACK_UUID_BASE 0x57494649ULL
+
+typedef struct
+{
+    uint64_t ts_ns;
+    const char *name;
+    uint8_t category;
+    uint8_t phase;
+} wifi_trace_event_t;
+
+typedef struct wifi_trace_ring
+{
+    struct wifi_trace_ring *next;
+    pid_t tid;
+    uint32_t mask;
+    uint64_t head; /* total number of events written */
+    wifi_trace_event_t events[];
+} wifi_trace_ring_t;
+
+volatile int wifi_trace_active = 0;
+
+static const char *category_names[WIFI_TRACE_CATEGORY_MAX] = { "test", "hal", "user" };
+
+static pthread_mutex_t rings_lock = PTHREAD_MUTEX_INITIALIZER;
+static wifi_trace_ring_t *rings = NULL;
+static uint32_t ring_capacity = WIFI_TRACE_DEFAULT_EVENTS;
+static __thread wifi_trace_ring_t *thread_ring = NULL;
+static __thread int thread_ring_failed = 0;
+
+static uint32_t round_up_pow2(uint32_t value)
+{
+    uint32_t result = 1;
+    while (result < value && result < WIFI_TRACE_MAX_EVENTS)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+static wifi_trace_ring_t *ring_create(void)
+{
+    uint32_t capacity = __atomic_load_n(&ring_capacity, __ATOMIC_RELAXED);
+    wifi_trace_ring_t *ring = calloc(1, sizeof(wifi_trace_ring_t) + (size_t)capacity * sizeof(wifi_trace_event_t));
+
+    if (ring == NULL)
+    {
+        thread_ring_failed = 1;
+        return NULL;
+    }
+    ring->tid = (pid_t)syscall(SYS_gettid);
+    ring->mask = capacity - 1;
+
+    pthread_mutex_lock(&rings_lock);
+    ring->next = rings;
+    rings = ring;
+    pthread_mutex_unlock(&rings_lock);
+
+    return ring;
+}
+
+void wifi_trace_record(const char *name, wifi_trace_category_t category, wifi_trace_phase_t phase)
+{
+    wifi_trace_ring_t *ring = thread_ring;
+    wifi_trace_event_t *event;
+    uint64_t head;
+
+    if (ring == NULL)
+    {
+        if (thread_ring_failed)
+        {
+            return;
+        }
+        ring = thread_ring = ring_create();
+        if (ring == NULL)
+        {
+            return;
+        }
+    }
+
+    head = ring->head;
+    event = &ring->events[head & ring->mask];
+    event->ts_ns = wifi_perf_now_ns();
+    event->name = name;
+    event->category = (uint8_t)category;
+    event->phase = (uint8_t)phase;
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+}
+
+void wifi_trace_set_capacity(uint32_t events)
+{
+    if (events == 0)
+    {
+        events = WIFI_TRACE_DEFAULT_EVENTS;
+    }
+    __atomic_store_n(&ring_capacity, round_up_pow2(events), __ATOMIC_RELAXED);
+}
+
+void wifi_trace_enable(int enable)
+{
+    wifi_trace_active = enable ? 1 : 0;
+}
+
+void wifi_trace_reset(void)
+{
+    wifi_trace_ring_t *ring;
+
+    pthread_mutex_lock(&rings_lock);
+    for (ring = rings; ring != NULL; ring = ring->next)
+    {
+        __atomic_store_n(&ring->head, 0, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&rings_lock);
+}
+
+uint64_t wifi_trace_dropped(void)
+{
+    wifi_trace_ring_t *ring;
+    uint64_t dropped = 0;
+
+    pthread_mutex_lock(&rings_lock);
+    for (ring = rings; ring != NULL; ring = ring->next)
+    {
+        uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        uint64_t capacity = (uint64_t)ring->mask + 1;
+        if (head > capacity)
+        {
+            dropped += head - capacity;
+        }
+    }
+    pthread_mutex_unlock(&rings_lock);
+
+    return dropped;
+}
+
+/* Returns the index of the oldest event still held by the ring */
+static uint64_t ring_first(const wifi_trace_ring_t *ring, uint64_t head)
+{
+    uint64_t capacity = (uint64_t)ring->mask + 1;
+    return (head > capacity) ? head - capacity : 0;
+}
+
+/*
+ * Copies the events of a ring with every span closed on the same thread.
+ *
+ * A test that fails inside a UT_ASSERT never records its end, and a wrapped
+ * ring loses the begin of its oldest spans. Test spans do not nest, so a test
+ * begin closes whatever is still open. An end closes the innermost open span
+ * of the same name and category and anything opened inside it, an end with no
+ * open span is dropped, and spans still open at the last event end there.
+ *
+ * Returns the number of events written to out, which must hold twice the
+ * events of the ring, or -1 if out of memory.
+ */
+static int64_t ring_balance(const wifi_trace_ring_t *ring, uint64_t head, wifi_trace_event_t *out)
+{
+    uint64_t first = ring_first(ring, head);
+    const wifi_trace_event_t **open;
+    uint64_t depth = 0;
+    uint64_t count = 0;
+    uint64_t last_ns = 0;
+    uint64_t index;
+
+    open = malloc((size_t)(head - first + 1) * sizeof(*open));
+    if (open == NULL)
+    {
+        return -1;
+    }
+
+    for (index = first; index < head; index++)
+    {
+        const wifi_trace_event_t *event = &ring->events[index & ring->mask];
+        uint64_t match = depth;
+
+        last_ns = event->ts_ns;
+        if (event->phase == WIFI_TRACE_PHASE_BEGIN)
+        {
+            if (event->category == WIFI_TRACE_CATEGORY_TEST)
+            {
+                match = 0;
+            }
+        }
+        else
+        {
+            while (match > 0 && (open[match - 1]->category != event->category ||
+                                 strcmp(open[match - 1]->name, event->name) != 0))
+            {
+                match--;
+            }
+            if (match == 0)
+            {
+                continue;
+            }
+            match--;
+        }
+
+        while (depth > match)
+        {
+            depth--;
+            out[count] = *open[depth];
+            out[count].ts_ns = event->ts_ns;
+            out[count].phase = WIFI_TRACE_PHASE_END;
+            count++;
+        }
+        if (event->phase == WIFI_TRACE_PHASE_BEGIN)
+        {
+            open[depth++] = event;
+            out[count++] = *event;
+        }
+    }
+
+    while (depth > 0)
+    {
+        depth--;
+        out[count] = *open[depth];
+        out[count].ts_ns = last_ns;
+        out[count].phase = WIFI_TRACE_PHASE_END;
+        count++;
+    }
+    free(open);
+    return (int64_t)count;
+}
+
+/* Balanced copy of a ring for the exporters, NULL if out of memory. Free with free() */
+static wifi_trace_event_t *ring_events(const wifi_trace_ring_t *ring, uint64_t *count)
+{
+    uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    wifi_trace_event_t *events = malloc((size_t)(head - ring_first(ring, head) + 1) * 2 * sizeof(*events));
+    int64_t written;
+
+    if (events == NULL)
+    {
+        return NULL;
+    }
+    written = ring_balance(ring, head, events);
+    if (written < 0)
+    {
+        free(events);
+        return NULL;
+    }
+    *count = (uint64_t)written;
+    return events;
+}
+
+static void json_write_string(FILE *fp, const char *text)
+{
+    fputc('"', fp);
+    for (; *text != '\0'; text++)
+    {
+        unsigned char c = (unsigned char)*text;
+        if (c == '"' || c == '\\')
+        {
+            fputc('\\', fp);
+            fputc(c, fp);
+        }
+        else if (c < 0x20)
+        {
+            fprintf(fp, "\\u%04x", c);
+        }
+        else
+        {
+            fputc(c, fp);
+        }
+    }
+    fputc('"', fp);
+}
+
+static int export_chrome_json(FILE *fp)
+{
+    wifi_trace_ring_t *ring;
+    pid_t pid = getpid();
+    int first = 1;
+
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", fp);
+    for (ring = rings; ring != NULL; ring = ring->next)
+    {
+        wifi_trace_event_t *events;
+        uint64_t count = 0;
+        uint64_t index;
+
+        events = ring_events(ring, &count);
+        if (events == NULL)
+        {
+            return -1;
+        }
+        fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"tid %d\"}}",
+                first ? "" : ",\n", (int)pid, (int)ring->tid, (int)ring->tid);
+        first = 0;
+
+        for (index = 0; index < count; index++)
+        {
+            const wifi_trace_event_t *event = &events[index];
+
+            fputs(",\n{\"name\":", fp);
+            json_write_string(fp, event->name);
+            fprintf(fp, ",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%llu.%03llu,\"pid\":%d,\"tid\":%d}",
+                    category_names[event->category],
+                    (event->phase == WIFI_TRACE_PHASE_BEGIN) ? 'B' : 'E',
+                    (unsigned long long)(event->ts_ns / 1000), (unsigned long long)(event->ts_ns % 1000),
+                    (int)pid, (int)ring->tid);
+        }
+        free(events);
+    }
+    fputs("\n]}\n", fp);
+
+    return ferror(fp) ? -1 : 0;
+}
+
+/*
+ * Minimal protobuf writer for the subset of perfetto.protos.Trace used here:
+ *
+ * Trace            { repeated TracePacket packet = 1; }
+ * TracePacket      { uint64 timestamp = 8; uint32 trusted_packet_sequence_id = 10;
+ *                    TrackEvent track_event = 11; uint32 timestamp_clock_id = 58;
+ *                    TrackDescriptor track_descriptor = 60; }
+ * TrackEvent       { Type type = 9; uint64 track_uuid = 11; repeated string categories = 22; string name = 23; }
+ * TrackDescriptor  { uint64 uuid = 1; ThreadDescriptor thread = 4; }
+ * ThreadDescriptor { int32 pid = 1; int32 tid = 2; string thread_name = 5; }
+ */
+typedef struct
+{
+    uint8_t data[512];
+    size_t len;
+    int overflow;    /* Something did not fit, the buffer must not be written */
+} pb_buffer_t;
+
+static void pb_append(pb_buffer_t *buf, const void *data, size_t len)
+{
+    if (buf->overflow || len > sizeof(buf->data) - buf->len)
+    {
+        buf->overflow = 1;
+        return;
+    }
+    memcpy(&buf->data[buf->len], data, len);
+    buf->len += len;
+}
+
+static void pb_varint(pb_buffer_t *buf, uint64_t value)
+{
+    uint8_t bytes[10];
+    size_t len = 0;
+
+    while (value >= 0x80)
+    {
+        bytes[len++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    bytes[len++] = (uint8_t)value;
+    pb_append(buf, bytes, len);
+}
+
+static void pb_tag(pb_buffer_t *buf, uint32_t field, uint32_t wire_type)
+{
+    pb_varint(buf, ((uint64_t)field << 3) | wire_type);
+}
+
+static void pb_uint(pb_buffer_t *buf, uint32_t field, uint64_t value)
+{
+    pb_tag(buf, field, 0);
+    pb_varint(buf, value);
+}
+
+static void pb_bytes(pb_buffer_t *buf, uint32_t field, const void *data, size_t len)
+{
+    pb_tag(buf, field, 2);
+    pb_varint(buf, len);
+    pb_append(buf, data, len);
+}
+
+static void pb_string(pb_buffer_t *buf, uint32_t field, const char *text)
+{
+    pb_bytes(buf, field, text, strlen(text));
+}
+
+/* Embeds a nested message, which overflows the parent if it overflowed itself */
+static void pb_message(pb_buffer_t *buf, uint32_t field, const pb_buffer_t *message)
+{
+    if (message->overflow)
+    {
+        buf->overflow = 1;
+        return;
+    }
+    pb_bytes(buf, field, message->data, message->len);
+}
+
+/* Returns -1 rather than writing a packet that overflowed */
+static int pb_write_packet(FILE *fp, const pb_buffer_t *packet)
+{
+    pb_buffer_t header = { .len = 0 };
+
+    if (packet->overflow)
+    {
+        return -1;
+    }
+    pb_tag(&header, 1, 2);
+    pb_varint(&header, packet->len);
+    fwrite(header.data, 1, header.len, fp);
+    fwrite(packet->data, 1, packet->len, fp);
+    return 0;
+}
+
+static int export_perfetto(FILE *fp)
+{
+    wifi_trace_ring_t *ring;
+    pid_t pid = getpid();
+    int ret = 0;
+
+    for (ring = rings; ring != NULL && ret == 0; ring = ring->next)
+    {
+        uint64_t track_uuid = PERFETTO_TRACK_UUID_BASE + (uint64_t)ring->tid;
+        pb_buffer_t thread = { .len = 0 };
+        pb_buffer_t descriptor = { .len = 0 };
+        pb_buffer_t packet = { .len = 0 };
+        wifi_trace_event_t *events;
+        char thread_name[32];
+        uint64_t count = 0;
+        uint64_t index;
+
+        events = ring_events(ring, &count);
+        if (events == NULL)
+        {
+            return -1;
+        }
+        snprintf(thread_name, sizeof(thread_name), "tid %d", (int)ring->tid);
+        pb_uint(&thread, 1, (uint64_t)pid);
+        pb_uint(&thread, 2, (uint64_t)ring->tid);
+        pb_string(&thread, 5, thread_name);
+        pb_uint(&descriptor, 1, track_uuid);
+        pb_message(&descriptor, 4, &thread);
+        pb_uint(&packet, 10, PERFETTO_SEQUENCE_ID);
+        pb_message(&packet, 60, &descriptor);
+        ret = pb_write_packet(fp, &packet);
+
+        for (index = 0; index < count && ret == 0; index++)
+        {
+            const wifi_trace_event_t *event = &events[index];
+            pb_buffer_t track_event = { .len = 0 };
+
+            /* TrackEvent.Type: TYPE_SLICE_BEGIN = 1, TYPE_SLICE_END = 2 */
+            pb_uint(&track_event, 9, (event->phase == WIFI_TRACE_PHASE_BEGIN) ? 1 : 2);
+            pb_uint(&track_event, 11, track_uuid);
+            pb_string(&track_event, 22, category_names[event->category]);
+            if (event->phase == WIFI_TRACE_PHASE_BEGIN)
+            {
+                pb_string(&track_event, 23, event->name);
+            }
+
+            packet.len = 0;
+            pb_uint(&packet, 8, event->ts_ns);
+            pb_uint(&packet, 10, PERFETTO_SEQUENCE_ID);
+            pb_message(&packet, 11, &track_event);
+            pb_uint(&packet, 58, PERFETTO_CLOCK_MONOTONIC);
+            ret = pb_write_packet(fp, &packet);
+        }
+        free(events);
+    }
+
+    return (ret != 0 || ferror(fp)) ? -1 : 0;
+}
+
+int wifi_trace_export(const char *path, wifi_trace_format_t format)
+{
+    FILE *fp;
+    int ret;
+
+    if (path == NULL)
+    {
+        return -1;
+    }
+    fp = fopen(path, (format == WIFI_TRACE_FORMAT_PERFETTO) ? "wb" : "w");
+    if (fp == NULL)
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(&rings_lock);
+    if (format == WIFI_TRACE_FORMAT_PERFETTO)
+    {
+        ret = export_perfetto(fp);
+    }
+    else
+    {
+        ret = export_chrome_json(fp);
+    }
+    pthread_mutex_unlock(&rings_lock);
+
+    if (fclose(fp) != 0)
+    {
+        ret = -1;
+    }
+    return ret;
+}
+
+void wifi_trace_init_from_env(void)
+{
+    const char *events = getenv("WIFI_HAL_TRACE_EVENTS");
+
+    if (events != NULL)
+    {
+        wifi_trace_set_capacity((uint32_t)strtoul(events, NULL, 0));
+    }
+    if (getenv("WIFI_HAL_TRACE") != NULL)
+    {
+        wifi_trace_enable(1);
+    }
+}
+
+void wifi_trace_finish(void)
+{
+    const char *path = getenv("WIFI_HAL_TRACE");
+    const char *format = getenv("WIFI_HAL_TRACE_FORMAT");
+    wifi_trace_format_t fmt = WIFI_TRACE_FORMAT_CHROME_JSON;
+
+    if (path == NULL)
+    {
+        return;
+    }
+    wifi_trace_enable(0);
+    if (format != NULL && strcmp(format, "perfetto") == 0)
+    {
+        fmt = WIFI_TRACE_FORMAT_PERFETTO;
+    }
+    if (wifi_trace_export(path, fmt) != 0)
+    {
+        fprintf(stderr, "Failed to write trace to %s\n", path);
+        return;
+    }
+    printf("Trace written to %s (%llu events dropped)\n", path, (unsigned long long)wifi_trace_dropped());
+}
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
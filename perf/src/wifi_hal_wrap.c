@@ -0,0 +1,744 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_hal_wrap.c
+*
+* Linker wrappers for every HAL API listed in wifi_hal_api.h.
+*
+* The test binaries are linked with `-Wl,--wrap=<api>` for each API, so every
+* call made by a test lands in `__wrap_<api>`, which applies the per-call
+* hooks and forwards to the real implementation (`__real_<api>`), whether
+* that is the skeleton compiled into the binary or libwifihal.so.
+*/
+
+#include <string.h>
+#include "wifi_common_hal.h"
+#include "wifi_client_hal.h"
+#include "wifi_hal_alloc.h"
+#include "wifi_hal_api.h"
+#include "wifi_hal_rusage.h"
+#include "wifi_hal_spawn.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+
+#define WIFI_HAL_API_NAME(name) #name,
+
+static const char *api_names[WIFI_HAL_API_MAX] = { WIFI_HAL_API_LIST(WIFI_HAL_API_NAME) };
+
+#undef WIFI_HAL_API_NAME
+
+const char *wifi_hal_api_name(wifi_hal_api_t api)
+{
+    if ((unsigned)api >= WIFI_HAL_API_MAX)
+    {
+        return "unknown";
+    }
+    return api_names[api];
+}
+
+wifi_hal_api_t wifi_hal_api_from_name(const char *name)
+{
+    int api;
+
+    if (name == NULL)
+    {
+        return WIFI_HAL_API_MAX;
+    }
+    for (api = 0; api < WIFI_HAL_API_MAX; api++)
+    {
+        if (strcmp(api_names[api], name) == 0)
+        {
+            return (wifi_hal_api_t)api;
+        }
+    }
+    return WIFI_HAL_API_MAX;
+}
+
+static wifi_hal_first_init_t first_init;
+static int first_init_claimed = 0;
+static int first_init_recorded = 0;
+
+int wifi_hal_first_init(wifi_hal_first_init_t *first)
+{
+    if (first == NULL || !__atomic_load_n(&first_init_recorded, __ATOMIC_ACQUIRE))
+    {
+        return 0;
+    }
+    *first = first_init;
+    return 1;
+}
+
+/* Only the init calls are timed here, every other wrapper stays at trace cost */
+static void hal_record_first_init(wifi_hal_api_t api, uint64_t start_ns, INT result)
+{
+    uint64_t call_ns = wifi_perf_now_ns() - start_ns;
+
+    if (__atomic_exchange_n(&first_init_claimed, 1, __ATOMIC_ACQ_REL))
+    {
+        return;
+    }
+    first_init.api = api;
+    first_init.call_ns = call_ns;
+    first_init.result = result;
+    __atomic_store_n(&first_init_recorded, 1, __ATOMIC_RELEASE);
+}
+
+static inline void hal_call_enter(wifi_hal_api_t api)
+{
+    WIFI_TRACE_BEGIN(api_names[api], WIFI_TRACE_CATEGORY_HAL);
+    /* After the trace event, so that creating a thread's trace ring is not charged to the API */
+    WIFI_ALLOC_CALL_ENTER(api);
+    WIFI_SPAWN_CALL_ENTER(api);
+    /* Last in, first out, so that the other hooks are not charged to the call */
+    WIFI_RUSAGE_CALL_ENTER(api);
+}
+
+static inline void hal_call_exit(wifi_hal_api_t api)
+{
+    WIFI_RUSAGE_CALL_EXIT(api);
+    WIFI_SPAWN_CALL_EXIT(api);
+    WIFI_ALLOC_CALL_EXIT(api);
+    WIFI_TRACE_END(api_names[api], WIFI_TRACE_CATEGORY_HAL);
+}
+
+int __attribute__((noinline)) wifi_hal_wrap_empty_call(wifi_hal_api_t api)
+{
+    hal_call_enter(api);
+    __asm__ __volatile__("" ::: "memory");
+    hal_call_exit(api);
+    return RETURN_OK;
+}
+
+INT __real_wifi_getHalVersion(CHAR* output_string);
+INT __wrap_wifi_getHalVersion(CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getHalVersion);
+    ret = __real_wifi_getHalVersion(output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getHalVersion);
+    return ret;
+}
+
+INT __real_wifi_init(void);
+INT __wrap_wifi_init(void)
+{
+    INT ret;
+    uint64_t start;
+
+    hal_call_enter(WIFI_HAL_API_wifi_init);
+    start = wifi_perf_now_ns();
+    ret = __real_wifi_init();
+    hal_record_first_init(WIFI_HAL_API_wifi_init, start, ret);
+    hal_call_exit(WIFI_HAL_API_wifi_init);
+    return ret;
+}
+
+INT __real_wifi_initWithConfig(wifi_halConfig_t* conf);
+INT __wrap_wifi_initWithConfig(wifi_halConfig_t* conf)
+{
+    INT ret;
+    uint64_t start;
+
+    hal_call_enter(WIFI_HAL_API_wifi_initWithConfig);
+    start = wifi_perf_now_ns();
+    ret = __real_wifi_initWithConfig(conf);
+    hal_record_first_init(WIFI_HAL_API_wifi_initWithConfig, start, ret);
+    hal_call_exit(WIFI_HAL_API_wifi_initWithConfig);
+    return ret;
+}
+
+INT __real_wifi_down(void);
+INT __wrap_wifi_down(void)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_down);
+    ret = __real_wifi_down();
+    hal_call_exit(WIFI_HAL_API_wifi_down);
+    return ret;
+}
+
+INT __real_wifi_uninit(void);
+INT __wrap_wifi_uninit(void)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_uninit);
+    ret = __real_wifi_uninit();
+    hal_call_exit(WIFI_HAL_API_wifi_uninit);
+    return ret;
+}
+
+void __real_wifi_getStats(INT radioIndex, wifi_sta_stats_t* wifi_sta_stats);
+void __wrap_wifi_getStats(INT radioIndex, wifi_sta_stats_t* wifi_sta_stats)
+{
+    hal_call_enter(WIFI_HAL_API_wifi_getStats);
+    __real_wifi_getStats(radioIndex, wifi_sta_stats);
+    hal_call_exit(WIFI_HAL_API_wifi_getStats);
+}
+
+INT __real_wifi_getRadioNumberOfEntries(ULONG* output);
+INT __wrap_wifi_getRadioNumberOfEntries(ULONG* output)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioNumberOfEntries);
+    ret = __real_wifi_getRadioNumberOfEntries(output);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioNumberOfEntries);
+    return ret;
+}
+
+INT __real_wifi_getSSIDNumberOfEntries(ULONG* output);
+INT __wrap_wifi_getSSIDNumberOfEntries(ULONG* output)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getSSIDNumberOfEntries);
+    ret = __real_wifi_getSSIDNumberOfEntries(output);
+    hal_call_exit(WIFI_HAL_API_wifi_getSSIDNumberOfEntries);
+    return ret;
+}
+
+INT __real_wifi_getRadioEnable(INT radioIndex, BOOL* output_bool);
+INT __wrap_wifi_getRadioEnable(INT radioIndex, BOOL* output_bool)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioEnable);
+    ret = __real_wifi_getRadioEnable(radioIndex, output_bool);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioEnable);
+    return ret;
+}
+
+INT __real_wifi_getRadioStatus(INT radioIndex, CHAR* output_string);
+INT __wrap_wifi_getRadioStatus(INT radioIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioStatus);
+    ret = __real_wifi_getRadioStatus(radioIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioStatus);
+    return ret;
+}
+
+INT __real_wifi_getRadioIfName(INT radioIndex, CHAR* output_string);
+INT __wrap_wifi_getRadioIfName(INT radioIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioIfName);
+    ret = __real_wifi_getRadioIfName(radioIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioIfName);
+    return ret;
+}
+
+INT __real_wifi_getRadioMaxBitRate(INT radioIndex, CHAR* output_string);
+INT __wrap_wifi_getRadioMaxBitRate(INT radioIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioMaxBitRate);
+    ret = __real_wifi_getRadioMaxBitRate(radioIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioMaxBitRate);
+    return ret;
+}
+
+INT __real_wifi_getRadioSupportedFrequencyBands(INT radioIndex, CHAR* output_string);
+INT __wrap_wifi_getRadioSupportedFrequencyBands(INT radioIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioSupportedFrequencyBands);
+    ret = __real_wifi_getRadioSupportedFrequencyBands(radioIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioSupportedFrequencyBands);
+    return ret;
+}
+
+INT __real_wifi_getRadioOperatingFrequencyBand(INT radioIndex, CHAR* output_string);
+INT __wrap_wifi_getRadioOperatingFrequencyBand(INT radioIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioOperatingFrequencyBand);
+    ret = __real_wifi_getRadioOperatingFrequencyBand(radioIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioOperatingFrequencyBand);
+    return ret;
+}
+
+INT __real_wifi_getRadioSupportedStandards(INT radioIndex, CHAR* output_string);
+INT __wrap_wifi_getRadioSupportedStandards(INT radioIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioSupportedStandards);
+    ret = __real_wifi_getRadioSupportedStandards(radioIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioSupportedStandards);
+    return ret;
+}
+
+INT __real_wifi_getRadioStandard(INT radioIndex, CHAR* output_string, BOOL* gOnly, BOOL* nOnly, BOOL* acOnly);
+INT __wrap_wifi_getRadioStandard(INT radioIndex, CHAR* output_string, BOOL* gOnly, BOOL* nOnly, BOOL* acOnly)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioStandard);
+    ret = __real_wifi_getRadioStandard(radioIndex, output_string, gOnly, nOnly, acOnly);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioStandard);
+    return ret;
+}
+
+INT __real_wifi_getRadioPossibleChannels(INT radioIndex, CHAR* output_string);
+INT __wrap_wifi_getRadioPossibleChannels(INT radioIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioPossibleChannels);
+    ret = __real_wifi_getRadioPossibleChannels(radioIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioPossibleChannels);
+    return ret;
+}
+
+INT __real_wifi_getRadioChannelsInUse(INT radioIndex, CHAR* output_string);
+INT __wrap_wifi_getRadioChannelsInUse(INT radioIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioChannelsInUse);
+    ret = __real_wifi_getRadioChannelsInUse(radioIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioChannelsInUse);
+    return ret;
+}
+
+INT __real_wifi_getRadioChannel(INT radioIndex, ULONG* output_ulong);
+INT __wrap_wifi_getRadioChannel(INT radioIndex, ULONG* output_ulong)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioChannel);
+    ret = __real_wifi_getRadioChannel(radioIndex, output_ulong);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioChannel);
+    return ret;
+}
+
+INT __real_wifi_getRadioAutoChannelSupported(INT radioIndex, BOOL* output_bool);
+INT __wrap_wifi_getRadioAutoChannelSupported(INT radioIndex, BOOL* output_bool)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioAutoChannelSupported);
+    ret = __real_wifi_getRadioAutoChannelSupported(radioIndex, output_bool);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioAutoChannelSupported);
+    return ret;
+}
+
+INT __real_wifi_getRadioAutoChannelEnable(INT radioIndex, BOOL* output_bool);
+INT __wrap_wifi_getRadioAutoChannelEnable(INT radioIndex, BOOL* output_bool)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioAutoChannelEnable);
+    ret = __real_wifi_getRadioAutoChannelEnable(radioIndex, output_bool);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioAutoChannelEnable);
+    return ret;
+}
+
+INT __real_wifi_getRadioAutoChannelRefreshPeriod(INT radioIndex, ULONG* output_ulong);
+INT __wrap_wifi_getRadioAutoChannelRefreshPeriod(INT radioIndex, ULONG* output_ulong)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioAutoChannelRefreshPeriod);
+    ret = __real_wifi_getRadioAutoChannelRefreshPeriod(radioIndex, output_ulong);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioAutoChannelRefreshPeriod);
+    return ret;
+}
+
+INT __real_wifi_getRadioGuardInterval(INT radioIndex, CHAR* output_string);
+INT __wrap_wifi_getRadioGuardInterval(INT radioIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioGuardInterval);
+    ret = __real_wifi_getRadioGuardInterval(radioIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioGuardInterval);
+    return ret;
+}
+
+INT __real_wifi_getRadioOperatingChannelBandwidth(INT radioIndex, CHAR* output_string);
+INT __wrap_wifi_getRadioOperatingChannelBandwidth(INT radioIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioOperatingChannelBandwidth);
+    ret = __real_wifi_getRadioOperatingChannelBandwidth(radioIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioOperatingChannelBandwidth);
+    return ret;
+}
+
+INT __real_wifi_getRadioExtChannel(INT radioIndex, CHAR* output_string);
+INT __wrap_wifi_getRadioExtChannel(INT radioIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioExtChannel);
+    ret = __real_wifi_getRadioExtChannel(radioIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioExtChannel);
+    return ret;
+}
+
+INT __real_wifi_getRadioMCS(INT radioIndex, INT* output_INT);
+INT __wrap_wifi_getRadioMCS(INT radioIndex, INT* output_INT)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioMCS);
+    ret = __real_wifi_getRadioMCS(radioIndex, output_INT);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioMCS);
+    return ret;
+}
+
+INT __real_wifi_getRadioTransmitPowerSupported(INT radioIndex, CHAR* output_list);
+INT __wrap_wifi_getRadioTransmitPowerSupported(INT radioIndex, CHAR* output_list)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioTransmitPowerSupported);
+    ret = __real_wifi_getRadioTransmitPowerSupported(radioIndex, output_list);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioTransmitPowerSupported);
+    return ret;
+}
+
+INT __real_wifi_getRadioTransmitPower(INT radioIndex, INT* output_INT);
+INT __wrap_wifi_getRadioTransmitPower(INT radioIndex, INT* output_INT)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioTransmitPower);
+    ret = __real_wifi_getRadioTransmitPower(radioIndex, output_INT);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioTransmitPower);
+    return ret;
+}
+
+INT __real_wifi_getRadioIEEE80211hSupported(INT radioIndex, BOOL* Supported);
+INT __wrap_wifi_getRadioIEEE80211hSupported(INT radioIndex, BOOL* Supported)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioIEEE80211hSupported);
+    ret = __real_wifi_getRadioIEEE80211hSupported(radioIndex, Supported);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioIEEE80211hSupported);
+    return ret;
+}
+
+INT __real_wifi_getRadioIEEE80211hEnabled(INT radioIndex, BOOL* enable);
+INT __wrap_wifi_getRadioIEEE80211hEnabled(INT radioIndex, BOOL* enable)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioIEEE80211hEnabled);
+    ret = __real_wifi_getRadioIEEE80211hEnabled(radioIndex, enable);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioIEEE80211hEnabled);
+    return ret;
+}
+
+INT __real_wifi_getRegulatoryDomain(INT radioIndex, CHAR* output_string);
+INT __wrap_wifi_getRegulatoryDomain(INT radioIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRegulatoryDomain);
+    ret = __real_wifi_getRegulatoryDomain(radioIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getRegulatoryDomain);
+    return ret;
+}
+
+INT __real_wifi_getRadioTrafficStats(INT radioIndex, wifi_radioTrafficStats_t* output_struct);
+INT __wrap_wifi_getRadioTrafficStats(INT radioIndex, wifi_radioTrafficStats_t* output_struct)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRadioTrafficStats);
+    ret = __real_wifi_getRadioTrafficStats(radioIndex, output_struct);
+    hal_call_exit(WIFI_HAL_API_wifi_getRadioTrafficStats);
+    return ret;
+}
+
+INT __real_wifi_getSSIDName(INT ssidIndex, CHAR* output_string);
+INT __wrap_wifi_getSSIDName(INT ssidIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getSSIDName);
+    ret = __real_wifi_getSSIDName(ssidIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getSSIDName);
+    return ret;
+}
+
+INT __real_wifi_getBaseBSSID(INT ssidIndex, CHAR* output_string);
+INT __wrap_wifi_getBaseBSSID(INT ssidIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getBaseBSSID);
+    ret = __real_wifi_getBaseBSSID(ssidIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getBaseBSSID);
+    return ret;
+}
+
+INT __real_wifi_getSSIDMACAddress(INT ssidIndex, CHAR* output_string);
+INT __wrap_wifi_getSSIDMACAddress(INT ssidIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getSSIDMACAddress);
+    ret = __real_wifi_getSSIDMACAddress(ssidIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getSSIDMACAddress);
+    return ret;
+}
+
+INT __real_wifi_getSSIDTrafficStats(INT ssidIndex, wifi_ssidTrafficStats_t* output_struct);
+INT __wrap_wifi_getSSIDTrafficStats(INT ssidIndex, wifi_ssidTrafficStats_t* output_struct)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getSSIDTrafficStats);
+    ret = __real_wifi_getSSIDTrafficStats(ssidIndex, output_struct);
+    hal_call_exit(WIFI_HAL_API_wifi_getSSIDTrafficStats);
+    return ret;
+}
+
+INT __real_wifi_getNeighboringWiFiDiagnosticResult(INT radioIndex, wifi_neighbor_ap_t** neighbor_ap_array, UINT* output_array_size);
+INT __wrap_wifi_getNeighboringWiFiDiagnosticResult(INT radioIndex, wifi_neighbor_ap_t** neighbor_ap_array, UINT* output_array_size)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getNeighboringWiFiDiagnosticResult);
+    ret = __real_wifi_getNeighboringWiFiDiagnosticResult(radioIndex, neighbor_ap_array, output_array_size);
+    hal_call_exit(WIFI_HAL_API_wifi_getNeighboringWiFiDiagnosticResult);
+    return ret;
+}
+
+INT __real_wifi_getSpecificSSIDInfo(const char* SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t** ap_array, UINT* output_array_size);
+INT __wrap_wifi_getSpecificSSIDInfo(const char* SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t** ap_array, UINT* output_array_size)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getSpecificSSIDInfo);
+    ret = __real_wifi_getSpecificSSIDInfo(SSID, band, ap_array, output_array_size);
+    hal_call_exit(WIFI_HAL_API_wifi_getSpecificSSIDInfo);
+    return ret;
+}
+
+INT __real_wifi_setRadioScanningFreqList(INT radioIndex, const CHAR* freqList);
+INT __wrap_wifi_setRadioScanningFreqList(INT radioIndex, const CHAR* freqList)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_setRadioScanningFreqList);
+    ret = __real_wifi_setRadioScanningFreqList(radioIndex, freqList);
+    hal_call_exit(WIFI_HAL_API_wifi_setRadioScanningFreqList);
+    return ret;
+}
+
+INT __real_wifi_getDualBandSupport(void);
+INT __wrap_wifi_getDualBandSupport(void)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getDualBandSupport);
+    ret = __real_wifi_getDualBandSupport();
+    hal_call_exit(WIFI_HAL_API_wifi_getDualBandSupport);
+    return ret;
+}
+
+INT __real_wifi_waitForScanResults(void);
+INT __wrap_wifi_waitForScanResults(void)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_waitForScanResults);
+    ret = __real_wifi_waitForScanResults();
+    hal_call_exit(WIFI_HAL_API_wifi_waitForScanResults);
+    return ret;
+}
+
+INT __real_wifi_getCliWpsConfigMethodsSupported(INT ssidIndex, CHAR* methods);
+INT __wrap_wifi_getCliWpsConfigMethodsSupported(INT ssidIndex, CHAR* methods)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getCliWpsConfigMethodsSupported);
+    ret = __real_wifi_getCliWpsConfigMethodsSupported(ssidIndex, methods);
+    hal_call_exit(WIFI_HAL_API_wifi_getCliWpsConfigMethodsSupported);
+    return ret;
+}
+
+INT __real_wifi_getCliWpsConfigMethodsEnabled(INT ssidIndex, CHAR* output_string);
+INT __wrap_wifi_getCliWpsConfigMethodsEnabled(INT ssidIndex, CHAR* output_string)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getCliWpsConfigMethodsEnabled);
+    ret = __real_wifi_getCliWpsConfigMethodsEnabled(ssidIndex, output_string);
+    hal_call_exit(WIFI_HAL_API_wifi_getCliWpsConfigMethodsEnabled);
+    return ret;
+}
+
+INT __real_wifi_setCliWpsConfigMethodsEnabled(INT ssidIndex, CHAR* methodString);
+INT __wrap_wifi_setCliWpsConfigMethodsEnabled(INT ssidIndex, CHAR* methodString)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_setCliWpsConfigMethodsEnabled);
+    ret = __real_wifi_setCliWpsConfigMethodsEnabled(ssidIndex, methodString);
+    hal_call_exit(WIFI_HAL_API_wifi_setCliWpsConfigMethodsEnabled);
+    return ret;
+}
+
+INT __real_wifi_setCliWpsEnrolleePin(INT ssidIndex, CHAR* EnrolleePin);
+INT __wrap_wifi_setCliWpsEnrolleePin(INT ssidIndex, CHAR* EnrolleePin)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_setCliWpsEnrolleePin);
+    ret = __real_wifi_setCliWpsEnrolleePin(ssidIndex, EnrolleePin);
+    hal_call_exit(WIFI_HAL_API_wifi_setCliWpsEnrolleePin);
+    return ret;
+}
+
+INT __real_wifi_setCliWpsButtonPush(INT ssidIndex);
+INT __wrap_wifi_setCliWpsButtonPush(INT ssidIndex)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_setCliWpsButtonPush);
+    ret = __real_wifi_setCliWpsButtonPush(ssidIndex);
+    hal_call_exit(WIFI_HAL_API_wifi_setCliWpsButtonPush);
+    return ret;
+}
+
+INT __real_wifi_connectEndpoint(INT ssidIndex, CHAR* AP_SSID, wifiSecurityMode_t AP_security_mode, CHAR* AP_security_WEPKey, CHAR* AP_security_PreSharedKey, CHAR* AP_security_KeyPassphrase, INT saveSSID, CHAR* eapIdentity, CHAR* carootcert, CHAR* clientcert, CHAR* privatekey);
+INT __wrap_wifi_connectEndpoint(INT ssidIndex, CHAR* AP_SSID, wifiSecurityMode_t AP_security_mode, CHAR* AP_security_WEPKey, CHAR* AP_security_PreSharedKey, CHAR* AP_security_KeyPassphrase, INT saveSSID, CHAR* eapIdentity, CHAR* carootcert, CHAR* clientcert, CHAR* privatekey)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_connectEndpoint);
+    ret = __real_wifi_connectEndpoint(ssidIndex, AP_SSID, AP_security_mode, AP_security_WEPKey, AP_security_PreSharedKey, AP_security_KeyPassphrase, saveSSID, eapIdentity, carootcert, clientcert, privatekey);
+    hal_call_exit(WIFI_HAL_API_wifi_connectEndpoint);
+    return ret;
+}
+
+INT __real_wifi_disconnectEndpoint(INT ssidIndex, CHAR* AP_SSID);
+INT __wrap_wifi_disconnectEndpoint(INT ssidIndex, CHAR* AP_SSID)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_disconnectEndpoint);
+    ret = __real_wifi_disconnectEndpoint(ssidIndex, AP_SSID);
+    hal_call_exit(WIFI_HAL_API_wifi_disconnectEndpoint);
+    return ret;
+}
+
+INT __real_wifi_clearSSIDInfo(INT ssidIndex);
+INT __wrap_wifi_clearSSIDInfo(INT ssidIndex)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_clearSSIDInfo);
+    ret = __real_wifi_clearSSIDInfo(ssidIndex);
+    hal_call_exit(WIFI_HAL_API_wifi_clearSSIDInfo);
+    return ret;
+}
+
+void __real_wifi_disconnectEndpoint_callback_register(wifi_disconnectEndpoint_callback callback_proc);
+void __wrap_wifi_disconnectEndpoint_callback_register(wifi_disconnectEndpoint_callback callback_proc)
+{
+    hal_call_enter(WIFI_HAL_API_wifi_disconnectEndpoint_callback_register);
+    __real_wifi_disconnectEndpoint_callback_register(callback_proc);
+    hal_call_exit(WIFI_HAL_API_wifi_disconnectEndpoint_callback_register);
+}
+
+void __real_wifi_connectEndpoint_callback_register(wifi_connectEndpoint_callback callback_proc);
+void __wrap_wifi_connectEndpoint_callback_register(wifi_connectEndpoint_callback callback_proc)
+{
+    hal_call_enter(WIFI_HAL_API_wifi_connectEndpoint_callback_register);
+    __real_wifi_connectEndpoint_callback_register(callback_proc);
+    hal_call_exit(WIFI_HAL_API_wifi_connectEndpoint_callback_register);
+}
+
+void __real_wifi_telemetry_callback_register(wifi_telemetry_ops_t* telemetry_ops);
+void __wrap_wifi_telemetry_callback_register(wifi_telemetry_ops_t* telemetry_ops)
+{
+    hal_call_enter(WIFI_HAL_API_wifi_telemetry_callback_register);
+    __real_wifi_telemetry_callback_register(telemetry_ops);
+    hal_call_exit(WIFI_HAL_API_wifi_telemetry_callback_register);
+}
+
+INT __real_wifi_lastConnected_Endpoint(wifi_pairedSSIDInfo_t* pairedSSIDInfo);
+INT __wrap_wifi_lastConnected_Endpoint(wifi_pairedSSIDInfo_t* pairedSSIDInfo)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_lastConnected_Endpoint);
+    ret = __real_wifi_lastConnected_Endpoint(pairedSSIDInfo);
+    hal_call_exit(WIFI_HAL_API_wifi_lastConnected_Endpoint);
+    return ret;
+}
+
+INT __real_wifi_setRoamingControl(int ssidIndex, wifi_roamingCtrl_t* pRoamingCtrl_data);
+INT __wrap_wifi_setRoamingControl(int ssidIndex, wifi_roamingCtrl_t* pRoamingCtrl_data)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_setRoamingControl);
+    ret = __real_wifi_setRoamingControl(ssidIndex, pRoamingCtrl_data);
+    hal_call_exit(WIFI_HAL_API_wifi_setRoamingControl);
+    return ret;
+}
+
+INT __real_wifi_getRoamingControl(int ssidIndex, wifi_roamingCtrl_t* pRoamingCtrl_data);
+INT __wrap_wifi_getRoamingControl(int ssidIndex, wifi_roamingCtrl_t* pRoamingCtrl_data)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_getRoamingControl);
+    ret = __real_wifi_getRoamingControl(ssidIndex, pRoamingCtrl_data);
+    hal_call_exit(WIFI_HAL_API_wifi_getRoamingControl);
+    return ret;
+}
+
+INT __real_wifi_cancelWpsPairing(void);
+INT __wrap_wifi_cancelWpsPairing(void)
+{
+    INT ret;
+
+    hal_call_enter(WIFI_HAL_API_wifi_cancelWpsPairing);
+    ret = __real_wifi_cancelWpsPairing();
+    hal_call_exit(WIFI_HAL_API_wifi_cancelWpsPairing);
+    return ret;
+}
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
+
@@ -0,0 +1,218 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_perf_probe.c
+*
+*/
+
+#include <string.h>
+#include "wifi_common_hal.h"
+#include "wifi_client_hal.h"
+#include "wifi_perf_probe.h"
+
+/* Every string getter gets the same generous scratch buffer */
+#define PROBE_STRING_LEN 256
+
+#define RADIO_STRING_PROBE(name) \
+    static INT probe_##name(INT radioIndex, INT ssidIndex) \
+    { \
+        CHAR output[PROBE_STRING_LEN]; \
+        (void)ssidIndex; \
+        return name(radioIndex, output); \
+    }
+
+#define RADIO_VALUE_PROBE(name, type) \
+    static INT probe_##name(INT radioIndex, INT ssidIndex) \
+    { \
+        type output; \
+        (void)ssidIndex; \
+        return name(radioIndex, &output); \
+    }
+
+#define SSID_STRING_PROBE(name) \
+    static INT probe_##name(INT radioIndex, INT ssidIndex) \
+    { \
+        CHAR output[PROBE_STRING_LEN]; \
+        (void)radioIndex; \
+        return name(ssidIndex, output); \
+    }
+
+#define SSID_VALUE_PROBE(name, type) \
+    static INT probe_##name(INT radioIndex, INT ssidIndex) \
+    { \
+        type output; \
+        (void)radioIndex; \
+        return name(ssidIndex, &output); \
+    }
+
+RADIO_VALUE_PROBE(wifi_getRadioEnable, BOOL)
+RADIO_STRING_PROBE(wifi_getRadioStatus)
+RADIO_STRING_PROBE(wifi_getRadioIfName)
+RADIO_STRING_PROBE(wifi_getRadioMaxBitRate)
+RADIO_STRING_PROBE(wifi_getRadioSupportedFrequencyBands)
+RADIO_STRING_PROBE(wifi_getRadioOperatingFrequencyBand)
+RADIO_STRING_PROBE(wifi_getRadioSupportedStandards)
+RADIO_STRING_PROBE(wifi_getRadioPossibleChannels)
+RADIO_STRING_PROBE(wifi_getRadioChannelsInUse)
+RADIO_VALUE_PROBE(wifi_getRadioChannel, ULONG)
+RADIO_VALUE_PROBE(wifi_getRadioAutoChannelSupported, BOOL)
+RADIO_VALUE_PROBE(wifi_getRadioAutoChannelEnable, BOOL)
+RADIO_VALUE_PROBE(wifi_getRadioAutoChannelRefreshPeriod, ULONG)
+RADIO_STRING_PROBE(wifi_getRadioGuardInterval)
+RADIO_STRING_PROBE(wifi_getRadioOperatingChannelBandwidth)
+RADIO_STRING_PROBE(wifi_getRadioExtChannel)
+RADIO_VALUE_PROBE(wifi_getRadioMCS, INT)
+RADIO_STRING_PROBE(wifi_getRadioTransmitPowerSupported)
+RADIO_VALUE_PROBE(wifi_getRadioTransmitPower, INT)
+RADIO_VALUE_PROBE(wifi_getRadioIEEE80211hSupported, BOOL)
+RADIO_VALUE_PROBE(wifi_getRadioIEEE80211hEnabled, BOOL)
+RADIO_STRING_PROBE(wifi_getRegulatoryDomain)
+RADIO_VALUE_PROBE(wifi_getRadioTrafficStats, wifi_radioTrafficStats_t)
+SSID_STRING_PROBE(wifi_getSSIDName)
+SSID_STRING_PROBE(wifi_getBaseBSSID)
+SSID_STRING_PROBE(wifi_getSSIDMACAddress)
+SSID_VALUE_PROBE(wifi_getSSIDTrafficStats, wifi_ssidTrafficStats_t)
+SSID_VALUE_PROBE(wifi_getRoamingControl, wifi_roamingCtrl_t)
+
+static INT probe_wifi_getRadioStandard(INT radioIndex, INT ssidIndex)
+{
+    CHAR output[PROBE_STRING_LEN];
+    BOOL gOnly, nOnly, acOnly;
+
+    (void)ssidIndex;
+    return wifi_getRadioStandard(radioIndex, output, &gOnly, &nOnly, &acOnly);
+}
+
+/* wifi_getStats() has no status, it always counts as a success */
+static INT probe_wifi_getStats(INT radioIndex, INT ssidIndex)
+{
+    wifi_sta_stats_t stats;
+
+    (void)ssidIndex;
+    memset(&stats, 0, sizeof(stats));
+    wifi_getStats(radioIndex, &stats);
+    return RETURN_OK;
+}
+
+static INT probe_wifi_getRadioNumberOfEntries(INT radioIndex, INT ssidIndex)
+{
+    ULONG output;
+
+    (void)radioIndex;
+    (void)ssidIndex;
+    return wifi_getRadioNumberOfEntries(&output);
+}
+
+static INT probe_wifi_getSSIDNumberOfEntries(INT radioIndex, INT ssidIndex)
+{
+    ULONG output;
+
+    (void)radioIndex;
+    (void)ssidIndex;
+    return wifi_getSSIDNumberOfEntries(&output);
+}
+
+static INT probe_wifi_getHalVersion(INT radioIndex, INT ssidIndex)
+{
+    CHAR output[PROBE_STRING_LEN];
+
+    (void)radioIndex;
+    (void)ssidIndex;
+    return wifi_getHalVersion(output);
+}
+
+static INT probe_wifi_lastConnected_Endpoint(INT radioIndex, INT ssidIndex)
+{
+    wifi_pairedSSIDInfo_t info;
+
+    (void)radioIndex;
+    (void)ssidIndex;
+    return wifi_lastConnected_Endpoint(&info);
+}
+
+#define PROBE(name) { WIFI_HAL_API_##name, probe_##name }
+
+static const wifi_perf_probe_t probes[] = {
+    PROBE(wifi_getHalVersion),
+    PROBE(wifi_getStats),
+    PROBE(wifi_getRadioNumberOfEntries),
+    PROBE(wifi_getSSIDNumberOfEntries),
+    PROBE(wifi_getRadioEnable),
+    PROBE(wifi_getRadioStatus),
+    PROBE(wifi_getRadioIfName),
+    PROBE(wifi_getRadioMaxBitRate),
+    PROBE(wifi_getRadioSupportedFrequencyBands),
+    PROBE(wifi_getRadioOperatingFrequencyBand),
+    PROBE(wifi_getRadioSupportedStandards),
+    PROBE(wifi_getRadioStandard),
+    PROBE(wifi_getRadioPossibleChannels),
+    PROBE(wifi_getRadioChannelsInUse),
+    PROBE(wifi_getRadioChannel),
+    PROBE(wifi_getRadioAutoChannelSupported),
+    PROBE(wifi_getRadioAutoChannelEnable),
+    PROBE(wifi_getRadioAutoChannelRefreshPeriod),
+    PROBE(wifi_getRadioGuardInterval),
+    PROBE(wifi_getRadioOperatingChannelBandwidth),
+    PROBE(wifi_getRadioExtChannel),
+    PROBE(wifi_getRadioMCS),
+    PROBE(wifi_getRadioTransmitPowerSupported),
+    PROBE(wifi_getRadioTransmitPower),
+    PROBE(wifi_getRadioIEEE80211hSupported),
+    PROBE(wifi_getRadioIEEE80211hEnabled),
+    PROBE(wifi_getRegulatoryDomain),
+    PROBE(wifi_getRadioTrafficStats),
+    PROBE(wifi_getSSIDName),
+    PROBE(wifi_getBaseBSSID),
+    PROBE(wifi_getSSIDMACAddress),
+    PROBE(wifi_getSSIDTrafficStats),
+    PROBE(wifi_lastConnected_Endpoint),
+    PROBE(wifi_getRoamingControl),
+};
+
+#undef PROBE
+
+const wifi_perf_probe_t *wifi_perf_probes(size_t *count)
+{
+    if (count != NULL)
+    {
+        *count = sizeof(probes) / sizeof(probes[0]);
+    }
+    return probes;
+}
+
+const wifi_perf_probe_t *wifi_perf_probe_find(const char *name)
+{
+    wifi_hal_api_t api = wifi_hal_api_from_name(name);
+
+    for (size_t i = 0; i < sizeof(probes) / sizeof(probes[0]); i++)
+    {
+        if (probes[i].api == api)
+        {
+            return &probes[i];
+        }
+    }
+    return NULL;
+}
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
@@ -0,0 +1,191 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_perf_stability.c
+*
+*/
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stability.h"
+#include "wifi_perf_stats.h"
+
+_Static_assert(sizeof(((wifi_perf_sched_t *)0)->affinity) >= sizeof(cpu_set_t), "affinity too small for cpu_set_t");
+
+/* Scheduling before wifi_perf_stability_init_from_env() changed it, given to the threads the suites start */
+static wifi_perf_sched_t env_default_sched;
+static int env_default_saved = 0;
+
+void wifi_perf_sched_save(wifi_perf_sched_t *saved)
+{
+    struct sched_param param;
+
+    if (saved == NULL)
+    {
+        return;
+    }
+    memset(saved, 0, sizeof(*saved));
+    if (sched_getaffinity(0, sizeof(cpu_set_t), (cpu_set_t *)saved->affinity) != 0)
+    {
+        /* Nothing to restore */
+        memset(saved->affinity, 0, sizeof(saved->affinity));
+    }
+    if (pthread_getschedparam(pthread_self(), &saved->policy, &param) == 0)
+    {
+        saved->priority = param.sched_priority;
+    }
+}
+
+void wifi_perf_sched_restore(const wifi_perf_sched_t *saved)
+{
+    struct sched_param param;
+
+    if (saved == NULL)
+    {
+        return;
+    }
+    if (CPU_COUNT((const cpu_set_t *)saved->affinity) > 0)
+    {
+        sched_setaffinity(0, sizeof(cpu_set_t), (const cpu_set_t *)saved->affinity);
+    }
+    memset(&param, 0, sizeof(param));
+    param.sched_priority = saved->priority;
+    pthread_setschedparam(pthread_self(), saved->policy, &param);
+}
+
+int wifi_perf_pin_cpu(int cpu)
+{
+    cpu_set_t set;
+
+    if (cpu < 0 || cpu >= CPU_SETSIZE)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    /* pid 0 is the calling thread, not the whole process */
+    return (sched_setaffinity(0, sizeof(set), &set) == 0) ? 0 : -1;
+}
+
+int wifi_perf_set_fifo(int priority)
+{
+    struct sched_param param;
+    int ret;
+
+    if (priority < sched_get_priority_min(SCHED_FIFO) || priority > sched_get_priority_max(SCHED_FIFO))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    memset(&param, 0, sizeof(param));
+    param.sched_priority = priority;
+    ret = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (ret != 0)
+    {
+        errno = ret;
+        return -1;
+    }
+    return 0;
+}
+
+uint64_t wifi_perf_clock_overhead_ns(unsigned iterations)
+{
+    wifi_perf_samples_t samples;
+    wifi_perf_summary_t summary;
+
+    if (iterations == 0 || wifi_perf_samples_init(&samples, iterations) != 0)
+    {
+        return 0;
+    }
+    for (unsigned i = 0; i < iterations; i++)
+    {
+        uint64_t start = wifi_perf_now_ns();
+
+        wifi_perf_samples_add(&samples, wifi_perf_now_ns() - start);
+    }
+    wifi_perf_summarize(&samples, &summary);
+    wifi_perf_samples_free(&samples);
+    return (uint64_t)summary.p50;
+}
+
+void wifi_perf_stability_init_from_env(void)
+{
+    const char *cpu = getenv("WIFI_PERF_CPU");
+    const char *fifo = getenv("WIFI_PERF_FIFO");
+
+    wifi_perf_sched_save(&env_default_sched);
+    env_default_saved = 1;
+    if (cpu != NULL && cpu[0] != '\0')
+    {
+        if (wifi_perf_pin_cpu(atoi(cpu)) != 0)
+        {
+            fprintf(stderr, "WIFI_PERF_CPU: cannot pin to CPU %s: %s\n", cpu, strerror(errno));
+        }
+    }
+    if (fifo != NULL && fifo[0] != '\0')
+    {
+        if (wifi_perf_set_fifo(atoi(fifo)) != 0)
+        {
+            fprintf(stderr, "WIFI_PERF_FIFO: cannot run at SCHED_FIFO priority %s: %s\n", fifo, strerror(errno));
+        }
+    }
+}
+
+int wifi_perf_thread_create(pthread_t *thread, void *(*fn)(void *), void *arg)
+{
+    pthread_attr_t attr;
+    struct sched_param param;
+    int ret;
+
+    ret = pthread_attr_init(&attr);
+    if (ret != 0)
+    {
+        return ret;
+    }
+    if (env_default_saved)
+    {
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = env_default_sched.priority;
+        pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy(&attr, env_default_sched.policy);
+        pthread_attr_setschedparam(&attr, &param);
+        if (CPU_COUNT((const cpu_set_t *)env_default_sched.affinity) > 0)
+        {
+            pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), (const cpu_set_t *)env_default_sched.affinity);
+        }
+    }
+    ret = pthread_create(thread, &attr, fn, arg);
+    pthread_attr_destroy(&attr);
+    return ret;
+}
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
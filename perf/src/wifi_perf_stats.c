@@ -0,0 +1,213 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST_PERF RDK-V WiFi HAL Test Performance Harness
+ * @{
+ */
+
+/**
+* @file wifi_perf_stats.c
+*
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "wifi_perf_stats.h"
+
+#define WIFI_PERF_DEFAULT_SAMPLES 1024
+
+int wifi_perf_samples_init(wifi_perf_samples_t *set, size_t capacity)
+{
+    if (set == NULL)
+    {
+        return -1;
+    }
+    if (capacity == 0)
+    {
+        capacity = WIFI_PERF_DEFAULT_SAMPLES;
+    }
+    set->samples = malloc(capacity * sizeof(uint64_t));
+    set->count = 0;
+    set->capacity = (set->samples != NULL) ? capacity : 0;
+    return (set->samples != NULL) ? 0 : -1;
+}
+
+void wifi_perf_samples_free(wifi_perf_samples_t *set)
+{
+    if (set == NULL)
+    {
+        return;
+    }
+    free(set->samples);
+    set->samples = NULL;
+    set->count = 0;
+    set->capacity = 0;
+}
+
+void wifi_perf_samples_clear(wifi_perf_samples_t *set)
+{
+    if (set != NULL)
+    {
+        set->count = 0;
+    }
+}
+
+static int samples_reserve(wifi_perf_samples_t *set, size_t needed)
+{
+    size_t capacity;
+    uint64_t *samples;
+
+    if (needed <= set->capacity)
+    {
+        return 0;
+    }
+    capacity = (set->capacity != 0) ? set->capacity : WIFI_PERF_DEFAULT_SAMPLES;
+    while (capacity < needed)
+    {
+        capacity *= 2;
+    }
+    samples = realloc(set->samples, capacity * sizeof(uint64_t));
+    if (samples == NULL)
+    {
+        return -1;
+    }
+    set->samples = samples;
+    set->capacity = capacity;
+    return 0;
+}
+
+int wifi_perf_samples_add(wifi_perf_samples_t *set, uint64_t value_ns)
+{
+    if (set == NULL || samples_reserve(set, set->count + 1) != 0)
+    {
+        return -1;
+    }
+    set->samples[set->count++] = value_ns;
+    return 0;
+}
+
+int wifi_perf_samples_merge(wifi_perf_samples_t *dst, const wifi_perf_samples_t *src)
+{
+    if (dst == NULL || src == NULL || samples_reserve(dst, dst->count + src->count) != 0)
+    {
+        return -1;
+    }
+    if (src->count != 0)
+    {
+        memcpy(&dst->samples[dst->count], src->samples, src->count * sizeof(uint64_t));
+    }
+    dst->count += src->count;
+    return 0;
+}
+
+void wifi_perf_samples_subtract(wifi_perf_samples_t *set, uint64_t overhead_ns)
+{
+    if (set == NULL)
+    {
+        return;
+    }
+    for (size_t i = 0; i < set->count; i++)
+    {
+        set->samples[i] = (set->samples[i] > overhead_ns) ? set->samples[i] - overhead_ns : 0;
+    }
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/* Nearest-rank percentile of a sorted set */
+static double percentile(const wifi_perf_samples_t *set, double pct)
+{
+    size_t rank = (size_t)ceil(pct / 100.0 * (double)set->count);
+
+    if (rank == 0)
+    {
+        rank = 1;
+    }
+    return (double)set->samples[rank - 1];
+}
+
+void wifi_perf_summarize(wifi_perf_samples_t *set, wifi_perf_summary_t *summary)
+{
+    double sum = 0.0;
+    double sq = 0.0;
+    size_t i;
+
+    if (summary == NULL)
+    {
+        return;
+    }
+    memset(summary, 0, sizeof(*summary));
+    if (set == NULL || set->count == 0)
+    {
+        return;
+    }
+
+    qsort(set->samples, set->count, sizeof(uint64_t), compare_u64);
+    for (i = 0; i < set->count; i++)
+    {
+        sum += (double)set->samples[i];
+    }
+    summary->count = set->count;
+    summary->total = sum;
+    summary->mean = sum / (double)set->count;
+    for (i = 0; i < set->count; i++)
+    {
+        double delta = (double)set->samples[i] - summary->mean;
+        sq += delta * delta;
+    }
+    summary->stddev = (set->count > 1) ? sqrt(sq / (double)(set->count - 1)) : 0.0;
+    summary->cv = (summary->mean > 0.0) ? summary->stddev / summary->mean : 0.0;
+    summary->min = (double)set->samples[0];
+    summary->max = (double)set->samples[set->count - 1];
+    summary->p50 = percentile(set, 50.0);
+    summary->p90 = percentile(set, 90.0);
+    summary->p99 = percentile(set, 99.0);
+}
+
+int wifi_perf_blocked(const wifi_perf_summary_t *baseline, const wifi_perf_summary_t *loaded)
+{
+    if (baseline == NULL || loaded == NULL || baseline->count == 0 || loaded->count == 0)
+    {
+        return 0;
+    }
+    return (loaded->p99 > baseline->p99 * WIFI_PERF_BLOCKED_RATIO &&
+            loaded->p99 - baseline->p99 > WIFI_PERF_BLOCKED_MIN_NS);
+}
+
+const char *wifi_perf_format_summary(char *buf, size_t size, const char *label, const wifi_perf_summary_t *summary)
+{
+    if (buf == NULL || size == 0)
+    {
+        return buf;
+    }
+    snprintf(buf, size, "%-40s n=%-6zu min=%.1fus p50=%.1fus p90=%.1fus p99=%.1fus max=%.1fus mean=%.1fus cv=%.3f",
+             (label != NULL) ? label : "", summary->count,
+             summary->min / 1000.0, summary->p50 / 1000.0, summary->p90 / 1000.0,
+             summary->p99 / 1000.0, summary->max / 1000.0, summary->mean / 1000.0, summary->cv);
+    return buf;
+}
+
+/** @} */ // End of RDKV_WIFI_HALTEST_PERF
@@ -0,0 +1,177 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_client_hal.c
+*
+* wifi_client_hal.h on top of the reference core. Roaming control is kept in
+* memory, the supplicant has no equivalent of wifi_roamingCtrl_t.
+*/
+
+#include <string.h>
+#include <stdlib.h>
+#include "wifi_client_hal.h"
+#include "wifi_ref.h"
+
+#define REF_WPS_METHODS_SUPPORTED "USBFlashDrive,Ethernet,Label,Display,ExternalNFCToken,NFCInterface,PushButton,PIN"
+#define REF_WPS_METHODS_DEFAULT "PushButton,PIN"
+
+static const CHAR wps_methods_supported[] = REF_WPS_METHODS_SUPPORTED;
+static CHAR wps_methods_enabled[128] = REF_WPS_METHODS_DEFAULT;
+static wifi_roamingCtrl_t roaming;
+
+static BOOL hal_ssid_ready(INT ssidIndex, const void *output)
+{
+    return (ssidIndex == 1 && output != NULL && wifi_ref_initialised());
+}
+
+/* Every comma separated entry must be one of REF_WPS_METHODS_SUPPORTED */
+static BOOL hal_wps_methods_valid(const CHAR *methods)
+{
+    CHAR copy[128];
+    CHAR *save = NULL;
+    CHAR *method;
+    INT count = 0;
+
+    if (strlen(methods) >= sizeof(copy))
+    {
+        return FALSE;
+    }
+    strcpy(copy, methods);
+    for (method = strtok_r(copy, ",", &save); method != NULL; method = strtok_r(NULL, ",", &save))
+    {
+        const CHAR *found = strstr(wps_methods_supported, method);
+        size_t len = strlen(method);
+
+        if (found == NULL || (found != wps_methods_supported && found[-1] != ',') ||
+            (found[len] != ',' && found[len] != '\0'))
+        {
+            return FALSE;
+        }
+        count++;
+    }
+    return (count > 0);
+}
+
+INT wifi_getCliWpsConfigMethodsSupported(INT ssidIndex, CHAR* methods)
+{
+    if (!hal_ssid_ready(ssidIndex, methods))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(methods, wps_methods_supported);
+    return RETURN_OK;
+}
+
+INT wifi_getCliWpsConfigMethodsEnabled(INT ssidIndex, CHAR* output_string)
+{
+    if (!hal_ssid_ready(ssidIndex, output_string))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, wps_methods_enabled);
+    return RETURN_OK;
+}
+
+INT wifi_setCliWpsConfigMethodsEnabled(INT ssidIndex, CHAR* methodString)
+{
+    if (!hal_ssid_ready(ssidIndex, methodString) || !hal_wps_methods_valid(methodString))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(wps_methods_enabled, methodString);
+    return RETURN_OK;
+}
+
+INT wifi_setCliWpsEnrolleePin(INT ssidIndex, CHAR* EnrolleePin)
+{
+    return wifi_ref_setCliWpsEnrolleePin(ssidIndex, EnrolleePin);
+}
+
+INT wifi_setCliWpsButtonPush(INT ssidIndex)
+{
+    return wifi_ref_setCliWpsButtonPush(ssidIndex);
+}
+
+INT wifi_connectEndpoint(INT ssidIndex, CHAR* AP_SSID, wifiSecurityMode_t AP_security_mode, CHAR* AP_security_WEPKey, CHAR* AP_security_PreSharedKey, CHAR* AP_security_KeyPassphrase, INT saveSSID, CHAR* eapIdentity, CHAR* carootcert, CHAR* clientcert, CHAR* privatekey)
+{
+    return wifi_ref_connectEndpoint(ssidIndex, AP_SSID, AP_security_mode, AP_security_WEPKey, AP_security_PreSharedKey,
+                                    AP_security_KeyPassphrase, saveSSID, eapIdentity, carootcert, clientcert, privatekey);
+}
+
+INT wifi_disconnectEndpoint(INT ssidIndex, CHAR* AP_SSID)
+{
+    return wifi_ref_disconnectEndpoint(ssidIndex, AP_SSID);
+}
+
+INT wifi_clearSSIDInfo(INT ssidIndex)
+{
+    return wifi_ref_clearSSIDInfo(ssidIndex);
+}
+
+void wifi_disconnectEndpoint_callback_register(wifi_disconnectEndpoint_callback callback_proc)
+{
+    wifi_ref_disconnectEndpoint_callback_register(callback_proc);
+}
+
+void wifi_connectEndpoint_callback_register(wifi_connectEndpoint_callback callback_proc)
+{
+    wifi_ref_connectEndpoint_callback_register(callback_proc);
+}
+
+void wifi_telemetry_callback_register(wifi_telemetry_ops_t* telemetry_ops)
+{
+    wifi_ref_telemetry_callback_register(telemetry_ops);
+}
+
+INT wifi_lastConnected_Endpoint(wifi_pairedSSIDInfo_t* pairedSSIDInfo)
+{
+    return wifi_ref_lastConnected_Endpoint(pairedSSIDInfo);
+}
+
+INT wifi_setRoamingControl(int ssidIndex, wifi_roamingCtrl_t* pRoamingCtrl_data)
+{
+    if (!hal_ssid_ready(ssidIndex, pRoamingCtrl_data))
+    {
+        return RETURN_ERR;
+    }
+    roaming = *pRoamingCtrl_data;
+    return RETURN_OK;
+}
+
+INT wifi_getRoamingControl(int ssidIndex, wifi_roamingCtrl_t* pRoamingCtrl_data)
+{
+    if (!hal_ssid_ready(ssidIndex, pRoamingCtrl_data))
+    {
+        return RETURN_ERR;
+    }
+    *pRoamingCtrl_data = roaming;
+    return RETURN_OK;
+}
+
+INT wifi_cancelWpsPairing(void)
+{
+    return wifi_ref_cancelWpsPairing();
+}
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
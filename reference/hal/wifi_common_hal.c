@@ -0,0 +1,272 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_common_hal.c
+*
+* wifi_common_hal.h on top of the reference core. Radio attributes the
+* supplicant control interface does not expose return RETURN_ERR.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wifi_common_hal.h"
+#include "wifi_ref.h"
+
+#define REF_HAL_VERSION "2.0.0-ref"
+#define REF_HAL_RADIOS 1
+#define REF_HAL_SSIDS 1
+
+INT wifi_getHalVersion(CHAR* output_string)
+{
+    if (output_string == NULL)
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, REF_HAL_VERSION);
+    return RETURN_OK;
+}
+
+INT wifi_init(void)
+{
+    return wifi_ref_init(NULL);
+}
+
+INT wifi_initWithConfig(wifi_halConfig_t* conf)
+{
+    if (conf == NULL)
+    {
+        return RETURN_ERR;
+    }
+    return wifi_ref_init(conf->wlan_Interface);
+}
+
+INT wifi_down(void)
+{
+    return wifi_ref_down();
+}
+
+INT wifi_uninit(void)
+{
+    return wifi_ref_uninit();
+}
+
+void wifi_getStats(INT radioIndex, wifi_sta_stats_t* wifi_sta_stats)
+{
+    (void)wifi_ref_getStats(radioIndex, wifi_sta_stats);
+}
+
+INT wifi_getRadioNumberOfEntries(ULONG* output)
+{
+    if (output == NULL || !wifi_ref_initialised())
+    {
+        return RETURN_ERR;
+    }
+    *output = REF_HAL_RADIOS;
+    return RETURN_OK;
+}
+
+INT wifi_getSSIDNumberOfEntries(ULONG* output)
+{
+    if (output == NULL || !wifi_ref_initialised())
+    {
+        return RETURN_ERR;
+    }
+    *output = REF_HAL_SSIDS;
+    return RETURN_OK;
+}
+
+INT wifi_getRadioEnable(INT radioIndex, BOOL* output_bool)
+{
+    return wifi_ref_getRadioEnable(radioIndex, output_bool);
+}
+
+INT wifi_getRadioStatus(INT radioIndex, CHAR* output_string)
+{
+    return wifi_ref_getRadioStatus(radioIndex, output_string);
+}
+
+INT wifi_getRadioIfName(INT radioIndex, CHAR* output_string)
+{
+    return wifi_ref_getRadioIfName(radioIndex, output_string);
+}
+
+INT wifi_getRadioMaxBitRate(INT radioIndex, CHAR* output_string)
+{
+    return RETURN_ERR;
+}
+
+INT wifi_getRadioSupportedFrequencyBands(INT radioIndex, CHAR* output_string)
+{
+    return wifi_ref_getRadioSupportedFrequencyBands(radioIndex, output_string);
+}
+
+INT wifi_getRadioOperatingFrequencyBand(INT radioIndex, CHAR* output_string)
+{
+    return wifi_ref_getRadioOperatingFrequencyBand(radioIndex, output_string);
+}
+
+INT wifi_getRadioSupportedStandards(INT radioIndex, CHAR* output_string)
+{
+    return RETURN_ERR;
+}
+
+INT wifi_getRadioStandard(INT radioIndex, CHAR* output_string, BOOL* gOnly, BOOL* nOnly, BOOL* acOnly)
+{
+    return RETURN_ERR;
+}
+
+INT wifi_getRadioPossibleChannels(INT radioIndex, CHAR* output_string)
+{
+    return wifi_ref_getRadioPossibleChannels(radioIndex, output_string);
+}
+
+INT wifi_getRadioChannelsInUse(INT radioIndex, CHAR* output_string)
+{
+    ULONG channel;
+
+    if (output_string == NULL || wifi_ref_getRadioChannel(radioIndex, &channel) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    sprintf(output_string, "%lu", channel);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioChannel(INT radioIndex, ULONG* output_ulong)
+{
+    return wifi_ref_getRadioChannel(radioIndex, output_ulong);
+}
+
+INT wifi_getRadioAutoChannelSupported(INT radioIndex, BOOL* output_bool)
+{
+    return RETURN_ERR;
+}
+
+INT wifi_getRadioAutoChannelEnable(INT radioIndex, BOOL* output_bool)
+{
+    return RETURN_ERR;
+}
+
+INT wifi_getRadioAutoChannelRefreshPeriod(INT radioIndex, ULONG* output_ulong)
+{
+    return RETURN_ERR;
+}
+
+INT wifi_getRadioGuardInterval(INT radioIndex, CHAR* output_string)
+{
+    return RETURN_ERR;
+}
+
+INT wifi_getRadioOperatingChannelBandwidth(INT radioIndex, CHAR* output_string)
+{
+    return wifi_ref_getRadioOperatingChannelBandwidth(radioIndex, output_string);
+}
+
+INT wifi_getRadioExtChannel(INT radioIndex, CHAR* output_string)
+{
+    return RETURN_ERR;
+}
+
+INT wifi_getRadioMCS(INT radioIndex, INT* output_INT)
+{
+    return RETURN_ERR;
+}
+
+INT wifi_getRadioTransmitPowerSupported(INT radioIndex, CHAR* output_list)
+{
+    return RETURN_ERR;
+}
+
+INT wifi_getRadioTransmitPower(INT radioIndex, INT* output_INT)
+{
+    return RETURN_ERR;
+}
+
+INT wifi_getRadioIEEE80211hSupported(INT radioIndex, BOOL* Supported)
+{
+    return RETURN_ERR;
+}
+
+INT wifi_getRadioIEEE80211hEnabled(INT radioIndex, BOOL* enable)
+{
+    return RETURN_ERR;
+}
+
+INT wifi_getRegulatoryDomain(INT radioIndex, CHAR* output_string)
+{
+    return wifi_ref_getRegulatoryDomain(radioIndex, output_string);
+}
+
+INT wifi_getRadioTrafficStats(INT radioIndex, wifi_radioTrafficStats_t* output_struct)
+{
+    return wifi_ref_getRadioTrafficStats(radioIndex, output_struct);
+}
+
+INT wifi_getSSIDName(INT ssidIndex, CHAR* output_string)
+{
+    return wifi_ref_getSSIDName(ssidIndex, output_string);
+}
+
+INT wifi_getBaseBSSID(INT ssidIndex, CHAR* output_string)
+{
+    return wifi_ref_getBaseBSSID(ssidIndex, output_string);
+}
+
+INT wifi_getSSIDMACAddress(INT ssidIndex, CHAR* output_string)
+{
+    return wifi_ref_getSSIDMACAddress(ssidIndex, output_string);
+}
+
+INT wifi_getSSIDTrafficStats(INT ssidIndex, wifi_ssidTrafficStats_t* output_struct)
+{
+    return wifi_ref_getSSIDTrafficStats(ssidIndex, output_struct);
+}
+
+INT wifi_getNeighboringWiFiDiagnosticResult(INT radioIndex, wifi_neighbor_ap_t** neighbor_ap_array, UINT* output_array_size)
+{
+    return wifi_ref_getNeighboringWiFiDiagnosticResult(radioIndex, neighbor_ap_array, output_array_size);
+}
+
+INT wifi_getSpecificSSIDInfo(const char* SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t** ap_array, UINT* output_array_size)
+{
+    return wifi_ref_getSpecificSSIDInfo(SSID, band, ap_array, output_array_size);
+}
+
+INT wifi_setRadioScanningFreqList(INT radioIndex, const CHAR* freqList)
+{
+    return wifi_ref_setRadioScanningFreqList(radioIndex, freqList);
+}
+
+INT wifi_getDualBandSupport(void)
+{
+    return wifi_ref_getDualBandSupport();
+}
+
+INT wifi_waitForScanResults(void)
+{
+    return wifi_ref_waitForScanResults();
+}
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
@@ -0,0 +1,156 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_ctrl.h
+*
+* Client side of the wpa_supplicant control interface.
+*
+* A connection is two Unix datagram sockets bound next to each other and
+* connected to the supplicant's control socket: one carries requests and
+* their replies, the other is ATTACHed and receives unsolicited events,
+* which a dedicated thread hands to the event function. Both stay open for
+* the lifetime of the connection, so a request costs one send and one
+* receive and never a socket setup.
+*
+* Requests are serialised on the connection; the supplicant answers one
+* command at a time anyway.
+*/
+
+#ifndef __WIFI_CTRL_H__
+#define __WIFI_CTRL_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Default directory of the supplicant control sockets
+ */
+#define WIFI_CTRL_DEFAULT_DIR "/var/run/wpa_supplicant"
+
+/**
+ * @brief Directory the client sockets are bound in
+ */
+#define WIFI_CTRL_CLIENT_DIR "/tmp"
+
+/**
+ * @brief Time to wait for a reply, as wpa_ctrl does
+ */
+#define WIFI_CTRL_TIMEOUT_MS 10000
+
+/**
+ * @brief Receives one event, without the "<level>" prefix
+ *
+ * Runs on the event thread of the connection. Must not close the connection.
+ */
+typedef void (*wifi_ctrl_event_fn)(const char *event, void *arg);
+
+/**
+ * @brief Open control connection
+ */
+typedef struct wifi_ctrl wifi_ctrl_t;
+
+/**
+ * @brief Request counters of a connection
+ */
+typedef struct
+{
+    uint64_t requests;      /*!< Requests sent */
+    uint64_t batches;       /*!< Round trips, a batch of requests counts once */
+    uint64_t failures;      /*!< Round trips without every reply, e.g. timed out */
+    uint64_t events;        /*!< Events received */
+    uint64_t request_ns;    /*!< Time from the first send to the last reply, summed over round trips */
+} wifi_ctrl_stats_t;
+
+/**
+ * @brief Connects to a supplicant control socket
+ *
+ * @param[in] ctrl_path Control socket, e.g. /var/run/wpa_supplicant/wlan0
+ * @param[in] on_event  Event function, NULL to not ATTACH
+ * @param[in] arg       Passed to on_event
+ *
+ * @return wifi_ctrl_t* - Connection, or NULL if the supplicant does not answer
+ */
+wifi_ctrl_t *wifi_ctrl_open(const char *ctrl_path, wifi_ctrl_event_fn on_event, void *arg);
+
+/**
+ * @brief DETACHes, stops the event thread and closes both sockets
+ */
+void wifi_ctrl_close(wifi_ctrl_t *ctrl);
+
+/**
+ * @brief Sends a command and waits for its reply
+ *
+ * @param[in]     ctrl      Connection
+ * @param[in]     cmd       Command, e.g. "STATUS"
+ * @param[out]    reply     Reply, NUL terminated
+ * @param[in,out] reply_len Size of reply on entry, length of the reply on return
+ *
+ * @return int - 0 on success, -1 on a send error, -2 on timeout
+ */
+int wifi_ctrl_request(wifi_ctrl_t *ctrl, const char *cmd, char *reply, size_t *reply_len);
+
+/**
+ * @brief Sends several commands back to back, then collects their replies
+ *
+ * The commands are in flight together, so the batch costs one wait for the
+ * supplicant instead of one per command. Replies arrive in the order sent.
+ *
+ * @param[in]     ctrl       Connection
+ * @param[in]     cmds       Commands
+ * @param[in]     count      Number of commands
+ * @param[out]    replies    Reply buffers, one per command, NUL terminated
+ * @param[in,out] reply_lens Sizes of the buffers on entry, lengths of the replies on return
+ *
+ * @return int - 0 if every command was answered, -1 on a send error, -2 on timeout
+ */
+int wifi_ctrl_request_batch(wifi_ctrl_t *ctrl, const char *const *cmds, size_t count, char *const *replies,
+                            size_t *reply_lens);
+
+/**
+ * @brief Sends a command whose only expected reply is "OK"
+ *
+ * @return int - 0 if the supplicant replied OK, -1 otherwise
+ */
+int wifi_ctrl_command(wifi_ctrl_t *ctrl, const char *cmd);
+
+/**
+ * @brief Returns the request counters of a connection
+ */
+void wifi_ctrl_get_stats(wifi_ctrl_t *ctrl, wifi_ctrl_stats_t *stats);
+
+/**
+ * @brief Finds "key=value" in a reply made of such lines
+ *
+ * @param[in]  reply Reply
+ * @param[in]  key   Key, without '='
+ * @param[out] value Value, NUL terminated, truncated to size
+ * @param[in]  size  Size of value
+ *
+ * @return int - 0 if found, -1 otherwise
+ */
+int wifi_ctrl_get_value(const char *reply, const char *key, char *value, size_t size);
+
+#endif // __WIFI_CTRL_H__
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
@@ -0,0 +1,80 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_mock_supplicant.h
+*
+* A wpa_supplicant stand-in serving the control interface on a Unix datagram
+* socket. The station behind it is the simulator core (wifi_sim.h), so
+* scans, connections and WPS sessions take the simulator's modelled time and
+* the access points are the simulator's population. Configure it with the
+* wifi_sim_set_* functions before starting.
+*
+* It answers the subset of commands the reference HAL sends: PING, STATUS,
+* SIGNAL_POLL, SCAN, SCAN_RESULTS, GET_CAPABILITY channels, GET country, the
+* network commands, the WPS commands, ATTACH and DETACH. Anything else gets
+* "UNKNOWN COMMAND".
+*/
+
+#ifndef __WIFI_MOCK_SUPPLICANT_H__
+#define __WIFI_MOCK_SUPPLICANT_H__
+
+#include <stdint.h>
+#include "wifi_common_hal.h"
+
+/**
+ * @brief Counters of the mock since it was started
+ */
+typedef struct
+{
+    uint64_t requests;      /*!< Commands received */
+    UINT clients;           /*!< Distinct client sockets seen */
+    UINT attached;          /*!< Clients attached for events now */
+    uint64_t events;        /*!< Events sent, counted once per client */
+} wifi_mock_supplicant_stats_t;
+
+/**
+ * @brief Binds the control socket and starts serving it
+ *
+ * Initialises the simulator core, which must not be in use through the
+ * simulator HAL at the same time.
+ *
+ * @param[in] ctrl_path Control socket to create, e.g. /tmp/wifi_mock/wlan0
+ *
+ * @return INT - RETURN_OK, or RETURN_ERR if already running or the socket cannot be bound
+ */
+INT wifi_mock_supplicant_start(const CHAR *ctrl_path);
+
+/**
+ * @brief Stops serving, removes the socket and uninitialises the simulator core
+ */
+void wifi_mock_supplicant_stop(void);
+
+/**
+ * @brief Returns the counters of the running mock
+ */
+void wifi_mock_supplicant_stats(wifi_mock_supplicant_stats_t *stats);
+
+#endif // __WIFI_MOCK_SUPPLICANT_H__
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
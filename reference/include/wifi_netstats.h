@@ -0,0 +1,162 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_netstats.h
+*
+* Kernel interface counters behind wifi_getRadioTrafficStats() and
+* wifi_getSSIDTrafficStats().
+*
+* A reader opens the counters of one interface once, from
+* /sys/class/net/<if>/statistics or, where sysfs has no such directory, from
+* /proc/net/dev, and keeps the descriptors open. A refresh is a pread() at
+* offset 0 of each, which makes the kernel format the counter again, and the
+* digits are converted in place without stdio.
+*
+* All paths are taken relative to a root directory, so a reader can be
+* pointed at a fake tree laid out like / on a host without the interface.
+*/
+
+#ifndef __WIFI_NETSTATS_H__
+#define __WIFI_NETSTATS_H__
+
+#include <stdint.h>
+#include "wifi_common_hal.h"
+
+/**
+ * @brief Interface directories below the root
+ */
+#define WIFI_NETSTATS_SYSFS_DIR "sys/class/net"
+
+/**
+ * @brief Counter table below the root, used where sysfs has no statistics
+ */
+#define WIFI_NETSTATS_PROCFS_FILE "proc/net/dev"
+
+/**
+ * @brief Counters, in the order of the /proc/net/dev columns
+ *
+ * From sysfs each is the attribute of the same name. The frame column of
+ * /proc/net/dev adds length, overrun and CRC errors to frame errors, and
+ * /proc/net/dev has no CRC error column, which reads 0 from there.
+ */
+typedef enum
+{
+    WIFI_NETSTATS_RX_BYTES = 0,
+    WIFI_NETSTATS_RX_PACKETS,
+    WIFI_NETSTATS_RX_ERRORS,
+    WIFI_NETSTATS_RX_DROPPED,
+    WIFI_NETSTATS_RX_FIFO_ERRORS,
+    WIFI_NETSTATS_RX_FRAME_ERRORS,
+    WIFI_NETSTATS_RX_COMPRESSED,
+    WIFI_NETSTATS_MULTICAST,
+    WIFI_NETSTATS_TX_BYTES,
+    WIFI_NETSTATS_TX_PACKETS,
+    WIFI_NETSTATS_TX_ERRORS,
+    WIFI_NETSTATS_TX_DROPPED,
+    WIFI_NETSTATS_TX_FIFO_ERRORS,
+    WIFI_NETSTATS_COLLISIONS,
+    WIFI_NETSTATS_TX_CARRIER_ERRORS,
+    WIFI_NETSTATS_TX_COMPRESSED,
+    WIFI_NETSTATS_RX_CRC_ERRORS,
+    WIFI_NETSTATS_COUNTERS
+} wifi_netstats_counter_t;
+
+/**
+ * @brief Where a reader takes its counters from
+ */
+typedef enum
+{
+    WIFI_NETSTATS_SOURCE_SYSFS = 0,
+    WIFI_NETSTATS_SOURCE_PROCFS
+} wifi_netstats_source_t;
+
+/**
+ * @brief One refresh of the counters
+ */
+typedef struct
+{
+    uint64_t value[WIFI_NETSTATS_COUNTERS]; /*!< Indexed by wifi_netstats_counter_t */
+} wifi_netstats_counters_t;
+
+/**
+ * @brief Open reader
+ */
+typedef struct wifi_netstats wifi_netstats_t;
+
+/**
+ * @brief Opens the counters of an interface
+ *
+ * Counters sysfs does not provide for the interface read as 0.
+ *
+ * @param[in] root   Root directory, NULL or "" for /
+ * @param[in] ifname Interface, e.g. wlan0
+ *
+ * @return wifi_netstats_t* - Reader, or NULL if neither sysfs nor /proc/net/dev has the interface
+ */
+wifi_netstats_t *wifi_netstats_open(const char *root, const char *ifname);
+
+/**
+ * @brief Closes the descriptors of a reader
+ */
+void wifi_netstats_close(wifi_netstats_t *netstats);
+
+/**
+ * @brief Returns where a reader takes its counters from
+ */
+wifi_netstats_source_t wifi_netstats_source(const wifi_netstats_t *netstats);
+
+/**
+ * @brief Reads the current counters
+ *
+ * Calls on one reader must be serialised.
+ *
+ * @param[in]  netstats Reader
+ * @param[out] counters Counters
+ *
+ * @return int - 0 on success, -1 if a counter could not be read or is not a number
+ */
+int wifi_netstats_read(wifi_netstats_t *netstats, wifi_netstats_counters_t *counters);
+
+/**
+ * @brief Fills radio traffic statistics from the counters
+ *
+ * Byte, packet, error and discard counts and the FCS error count come from
+ * the interface. The physical layer fields, noise floor, utilisation and
+ * start time, have no interface counter and are zeroed.
+ */
+void wifi_netstats_fill_radio(const wifi_netstats_counters_t *counters, wifi_radioTrafficStats_t *radio);
+
+/**
+ * @brief Fills SSID traffic statistics from the counters
+ *
+ * Byte, packet, error and discard counts come from the interface, multicast
+ * received from the multicast counter and unicast received from the
+ * remainder. Retry, acknowledgement and aggregation counts are 802.11
+ * counters the interface does not keep and are zeroed.
+ */
+void wifi_netstats_fill_ssid(const wifi_netstats_counters_t *counters, wifi_ssidTrafficStats_t *ssid);
+
+#endif // __WIFI_NETSTATS_H__
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
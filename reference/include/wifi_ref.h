@@ -0,0 +1,208 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ * @parblock
+ *
+ * ### Reference WiFi HAL over wpa_supplicant :
+ *
+ * A station HAL that drives wpa_supplicant through its control interface,
+ * the way most vendor HALs do. It keeps one control connection for requests
+ * and one attached connection for events for as long as the HAL is
+ * initialised (wifi_ctrl.h).
+ *
+ * The core in reference/src is linked into every test binary and driven
+ * directly by the L2 suites through the wifi_ref_* functions, against the
+ * mock supplicant in reference/mock (wifi_mock_supplicant.h). The HAL front
+ * end in reference/hal maps the HAL API onto the core and is selected with
+ * HAL_BACKEND=reference.
+ *
+ * The control interface has nothing to say about transmit power, MCS, guard
+ * interval, auto channel or 802.11h; real HALs read those over nl80211, and
+ * the reference HAL reports them as unsupported. Traffic counters come from
+ * the kernel interface statistics (wifi_netstats.h).
+ *
+ * @endparblock
+ */
+
+/**
+* @file wifi_ref.h
+*
+*/
+
+#ifndef __WIFI_REF_H__
+#define __WIFI_REF_H__
+
+#include "wifi_common_hal.h"
+#include "wifi_client_hal.h"
+#include "wifi_ctrl.h"
+
+/**
+ * @brief Interface used by wifi_init()
+ */
+#define WIFI_REF_DEFAULT_INTERFACE "wlan0"
+
+/**
+ * @brief Sets the directory of the supplicant control sockets
+ *
+ * Defaults to `WIFI_CTRL_DIR` from the environment, or WIFI_CTRL_DEFAULT_DIR.
+ * Applies from the next wifi_ref_init().
+ *
+ * @param[in] dir Directory, NULL for the default
+ */
+void wifi_ref_set_ctrl_dir(const CHAR *dir);
+
+/**
+ * @brief Sets the root of the sysfs and procfs trees the traffic counters are read from
+ *
+ * Defaults to `WIFI_NETSTATS_ROOT` from the environment, or /. A fake tree
+ * holds sys/class/net/<if>/statistics or proc/net/dev below it
+ * (wifi_netstats.h). Applies from the next wifi_ref_init().
+ *
+ * @param[in] root Directory, NULL for the default
+ */
+void wifi_ref_set_netstats_root(const CHAR *root);
+
+/**
+ * @brief Default age up to which wifi_getStats() is answered from the last result
+ */
+#define WIFI_REF_STATS_WINDOW_MS 100
+
+/**
+ * @brief Sets how long a wifi_getStats() result is served again
+ *
+ * wifi_getStats() collects STATUS and SIGNAL_POLL in one batch and keeps the
+ * result. Calls within the window get it back without asking the supplicant;
+ * a connection or disconnection drops it at once. Defaults to
+ * `WIFI_REF_STATS_WINDOW_MS` from the environment, or WIFI_REF_STATS_WINDOW_MS.
+ * Applies immediately.
+ *
+ * @param[in] window_ms Window in milliseconds, 0 to always ask, negative for the default
+ */
+void wifi_ref_set_stats_window(INT window_ms);
+
+/**
+ * @brief Changes a watcher can be woken for
+ */
+#define WIFI_REF_CHANGE_CHANNEL    0x01  /*!< CTRL-EVENT-CHANNEL-SWITCH on the current link */
+#define WIFI_REF_CHANGE_STATUS     0x02  /*!< wifi_init(), wifi_down() or wifi_uninit() */
+#define WIFI_REF_CHANGE_RSSI       0x04  /*!< CTRL-EVENT-SIGNAL-CHANGE into another bucket */
+#define WIFI_REF_CHANGE_CONNECTION 0x08  /*!< CTRL-EVENT-CONNECTED or CTRL-EVENT-DISCONNECTED */
+#define WIFI_REF_CHANGE_ALL        0x0F
+
+/**
+ * @brief Width of the signal buckets: -50 to -59 dBm, -60 to -69 dBm and so on
+ */
+#define WIFI_REF_RSSI_BUCKET_DB 10
+
+/**
+ * @brief Largest number of open watchers
+ */
+#define WIFI_REF_MAX_WATCHERS 8
+
+/**
+ * @brief Opens a change watcher
+ *
+ * The descriptor is an eventfd that becomes readable when one of the changes
+ * is reported by the supplicant, so a client can wait on it in its own poll
+ * or epoll set instead of polling the getters. Changes that happen before the
+ * watcher is read share one wakeup. Signal changes need the supplicant signal
+ * monitor (bgscan or a signal threshold) to be running. Watchers stay open
+ * across wifi_ref_init() and wifi_ref_uninit().
+ *
+ * @param[in] changes WIFI_REF_CHANGE_* bits
+ *
+ * @return INT - Descriptor, or -1 if changes is empty or WIFI_REF_MAX_WATCHERS are open
+ */
+INT wifi_ref_watch_open(UINT changes);
+
+/**
+ * @brief Returns and clears the changes seen since the last call, without blocking
+ *
+ * @param[in] fd Descriptor from wifi_ref_watch_open()
+ *
+ * @return UINT - WIFI_REF_CHANGE_* bits, 0 if there were none or fd is not a watcher
+ */
+UINT wifi_ref_watch_read(INT fd);
+
+/**
+ * @brief Closes a change watcher
+ */
+void wifi_ref_watch_close(INT fd);
+
+/**
+ * @brief Returns the request counters of the control connection
+ *
+ * @param[out] stats Counters, zeroed while not initialised
+ */
+void wifi_ref_ctrl_stats(wifi_ctrl_stats_t *stats);
+
+/**
+ * @brief Core operations behind the HAL API
+ *
+ * Same parameters, return values and callbacks as the HAL function of the
+ * same name in wifi_common_hal.h and wifi_client_hal.h.
+ */
+INT wifi_ref_init(const CHAR *interface);
+INT wifi_ref_down(void);
+INT wifi_ref_uninit(void);
+BOOL wifi_ref_initialised(void);
+INT wifi_ref_getRadioEnable(INT radioIndex, BOOL *output_bool);
+INT wifi_ref_getRadioStatus(INT radioIndex, CHAR *output_string);
+INT wifi_ref_getRadioIfName(INT radioIndex, CHAR *output_string);
+INT wifi_ref_getRadioSupportedFrequencyBands(INT radioIndex, CHAR *output_string);
+INT wifi_ref_getRadioOperatingFrequencyBand(INT radioIndex, CHAR *output_string);
+INT wifi_ref_getRadioPossibleChannels(INT radioIndex, CHAR *output_string);
+INT wifi_ref_getRadioChannel(INT radioIndex, ULONG *output_ulong);
+INT wifi_ref_getRadioOperatingChannelBandwidth(INT radioIndex, CHAR *output_string);
+INT wifi_ref_getRegulatoryDomain(INT radioIndex, CHAR *output_string);
+INT wifi_ref_getDualBandSupport(void);
+INT wifi_ref_getSSIDName(INT ssidIndex, CHAR *output_string);
+INT wifi_ref_getBaseBSSID(INT ssidIndex, CHAR *output_string);
+INT wifi_ref_getSSIDMACAddress(INT ssidIndex, CHAR *output_string);
+INT wifi_ref_getStats(INT radioIndex, wifi_sta_stats_t *wifi_sta_stats);
+INT wifi_ref_getRadioTrafficStats(INT radioIndex, wifi_radioTrafficStats_t *output_struct);
+INT wifi_ref_getSSIDTrafficStats(INT ssidIndex, wifi_ssidTrafficStats_t *output_struct);
+INT wifi_ref_getNeighboringWiFiDiagnosticResult(INT radioIndex, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size);
+INT wifi_ref_getSpecificSSIDInfo(const char *SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t **ap_array, UINT *output_array_size);
+INT wifi_ref_setRadioScanningFreqList(INT radioIndex, const CHAR *freqList);
+INT wifi_ref_waitForScanResults(void);
+INT wifi_ref_connectEndpoint(INT ssidIndex, CHAR *AP_SSID, wifiSecurityMode_t AP_security_mode, CHAR *AP_security_WEPKey,
+                             CHAR *AP_security_PreSharedKey, CHAR *AP_security_KeyPassphrase, INT saveSSID,
+                             CHAR *eapIdentity, CHAR *carootcert, CHAR *clientcert, CHAR *privatekey);
+INT wifi_ref_disconnectEndpoint(INT ssidIndex, CHAR *AP_SSID);
+INT wifi_ref_clearSSIDInfo(INT ssidIndex);
+INT wifi_ref_lastConnected_Endpoint(wifi_pairedSSIDInfo_t *pairedSSIDInfo);
+void wifi_ref_connectEndpoint_callback_register(wifi_connectEndpoint_callback callback_proc);
+void wifi_ref_disconnectEndpoint_callback_register(wifi_disconnectEndpoint_callback callback_proc);
+void wifi_ref_telemetry_callback_register(wifi_telemetry_ops_t *telemetry_ops);
+INT wifi_ref_setCliWpsButtonPush(INT ssidIndex);
+INT wifi_ref_setCliWpsEnrolleePin(INT ssidIndex, CHAR *EnrolleePin);
+INT wifi_ref_cancelWpsPairing(void);
+
+#endif // __WIFI_REF_H__
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
+/** @} */ // End of RDKV_WIFI
@@ -0,0 +1,87 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_scan_parse.h
+*
+* Turns the scan output of wpa_supplicant into wifi_neighbor_ap_t arrays.
+*
+* Two formats are understood:
+*
+* - SCAN_RESULTS: a "bssid / frequency / signal level / flags / ssid" header,
+*   then one tab separated line per BSS. Hidden networks have no SSID field.
+* - BSS: "key=value" lines per BSS, as answered to "BSS <id>" or
+*   "BSS RANGE=ALL", entries separated by "====" lines or starting again at
+*   "id=". Beacon interval, noise and the information elements ("ie=") fill
+*   the fields SCAN_RESULTS has nothing for: rates, standards, bandwidth,
+*   DTIM period and channel utilisation.
+*
+* The text is read in place and never modified or copied; it need not be NUL
+* terminated. Fields are located with memchr() and decoded straight into
+* their slot of the output array, SSIDs unescaped on the way ("\\xNN",
+* "\\\\", "\\\""). A first pass only locates and checks the fields, counting
+* the entries that match the filter, so the array is allocated once with
+* exactly that many entries; the second pass decodes them. Lines that do not
+* parse are skipped.
+*/
+
+#ifndef __WIFI_SCAN_PARSE_H__
+#define __WIFI_SCAN_PARSE_H__
+
+#include <stddef.h>
+#include "wifi_common_hal.h"
+
+/**
+ * @brief Entries to keep
+ */
+typedef struct
+{
+    const CHAR *ssid;           /*!< Only this SSID, NULL for all */
+    WIFI_HAL_FREQ_BAND band;    /*!< Only this band, WIFI_HAL_FREQ_BAND_NONE for all */
+} wifi_scan_filter_t;
+
+/**
+ * @brief Parses a SCAN_RESULTS reply
+ *
+ * @param[in]  text   Reply, not necessarily NUL terminated
+ * @param[in]  len    Length of text
+ * @param[in]  filter Entries to keep, NULL for all
+ * @param[out] aps    Array to be freed by the caller, NULL if no entry matched
+ * @param[out] count  Entries in the array
+ *
+ * @return INT - RETURN_OK, or RETURN_ERR on bad arguments or when out of memory
+ */
+INT wifi_scan_parse_results(const CHAR *text, size_t len, const wifi_scan_filter_t *filter, wifi_neighbor_ap_t **aps,
+                            UINT *count);
+
+/**
+ * @brief Parses one or more BSS entries
+ *
+ * Same contract as wifi_scan_parse_results(). An entry without a bssid is skipped.
+ */
+INT wifi_scan_parse_bss(const CHAR *text, size_t len, const wifi_scan_filter_t *filter, wifi_neighbor_ap_t **aps,
+                        UINT *count);
+
+#endif // __WIFI_SCAN_PARSE_H__
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
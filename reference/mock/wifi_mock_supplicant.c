@@ -0,0 +1,1006 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_mock_supplicant.c
+*
+*/
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "wifi_mock_supplicant.h"
+#include "wifi_sim.h"
+
+#define MOCK_MAX_CLIENTS 16
+#define MOCK_MAX_NETWORKS 4
+#define MOCK_REQUEST_SIZE 1024
+#define MOCK_REPLY_SIZE (64 * 1024)
+
+typedef struct
+{
+    BOOL used;
+    BOOL disabled;
+    CHAR ssid[64];
+    CHAR psk[128];
+    CHAR key_mgmt[16];
+    CHAR wep_key[128];
+} mock_network_t;
+
+static struct
+{
+    pthread_mutex_t lock;
+    BOOL running;
+    int fd;                                         /*!< -1 while stopped */
+    int stop[2];
+    INT watch;                                      /*!< Simulator watcher for signal and channel changes */
+    pthread_t thread;
+    CHAR path[108];
+
+    struct sockaddr_un clients[MOCK_MAX_CLIENTS];
+    UINT client_count;
+    struct sockaddr_un attached[MOCK_MAX_CLIENTS];
+    UINT attached_count;
+
+    mock_network_t networks[MOCK_MAX_NETWORKS];
+    INT current;                                    /*!< Selected network, -1 if none */
+    BOOL connecting;
+    BOOL wps;
+    BOOL scan_waiting;                              /*!< scan_thread waits for the simulator scan */
+    BOOL scan_thread_started;
+    pthread_t scan_thread;
+
+    uint64_t requests;
+    uint64_t events;
+} mock = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .fd = -1,
+    .stop = { -1, -1 },
+    .watch = -1,
+    .current = -1,
+};
+
+static void mock_copy(CHAR *dst, size_t size, const CHAR *src)
+{
+    snprintf(dst, size, "%s", src);
+}
+
+static UINT mock_frequency(UINT channel)
+{
+    if (channel == 14)
+    {
+        return 2484;
+    }
+    return (channel > 14) ? 5000 + 5 * channel : 2407 + 5 * channel;
+}
+
+static BOOL mock_same_addr(const struct sockaddr_un *a, const struct sockaddr_un *b)
+{
+    return (strcmp(a->sun_path, b->sun_path) == 0);
+}
+
+/* Sends an event to every attached client, caller holds mock.lock */
+static void mock_event_locked(const char *fmt, ...)
+{
+    char buf[512];
+    va_list ap;
+    int len;
+
+    if (mock.fd < 0)
+    {
+        return;
+    }
+    /* MSG_INFO level, as wpa_supplicant prefixes it */
+    len = snprintf(buf, sizeof(buf), "<3>");
+    va_start(ap, fmt);
+    len += vsnprintf(buf + len, sizeof(buf) - (size_t)len, fmt, ap);
+    va_end(ap);
+    if (len >= (int)sizeof(buf))
+    {
+        len = (int)sizeof(buf) - 1;
+    }
+    for (UINT i = 0; i < mock.attached_count; i++)
+    {
+        if (sendto(mock.fd, buf, (size_t)len, MSG_DONTWAIT, (const struct sockaddr *)&mock.attached[i],
+                   sizeof(mock.attached[i])) >= 0)
+        {
+            mock.events++;
+        }
+    }
+}
+
+/* Simulator connect callback, runs on the simulator timer thread */
+static INT mock_on_connect(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    wifi_sta_stats_t sta;
+
+    (void)ssidIndex;
+    memset(&sta, 0, sizeof(sta));
+    if (*error == WIFI_HAL_CONNECTED)
+    {
+        wifi_sim_getStats(1, &sta);
+    }
+
+    pthread_mutex_lock(&mock.lock);
+    mock.connecting = FALSE;
+    switch (*error)
+    {
+        case WIFI_HAL_CONNECTED:
+            if (mock.wps)
+            {
+                wifi_sim_registrar_t registrar;
+                mock_network_t *net = &mock.networks[0];
+
+                /* The credential replaces the configuration, as with update_config=1 */
+                wifi_sim_get_registrar(&registrar);
+                memset(mock.networks, 0, sizeof(mock.networks));
+                net->used = TRUE;
+                mock_copy(net->ssid, sizeof(net->ssid), registrar.ssid);
+                mock_copy(net->psk, sizeof(net->psk), registrar.passphrase);
+                mock_copy(net->key_mgmt, sizeof(net->key_mgmt), "WPA-PSK");
+                mock.current = 0;
+                mock.wps = FALSE;
+                mock_event_locked("WPS-SUCCESS ");
+            }
+            mock_event_locked("CTRL-EVENT-CONNECTED - Connection to %s completed [id=%d id_str=]", sta.sta_BSSID,
+                              mock.current);
+            break;
+        case WIFI_HAL_ERROR_NOT_FOUND:
+            mock_event_locked("CTRL-EVENT-NETWORK-NOT-FOUND");
+            break;
+        case WIFI_HAL_ERROR_INVALID_CREDENTIALS:
+            if (mock.wps)
+            {
+                mock.wps = FALSE;
+                mock_event_locked("WPS-FAIL msg=8 config_error=18");
+            }
+            else
+            {
+                mock_event_locked("CTRL-EVENT-SSID-TEMP-DISABLED id=%d ssid=\"%s\" auth_failures=1 duration=10 reason=WRONG_KEY",
+                                  mock.current, AP_SSID);
+            }
+            break;
+        case WIFI_HAL_ERROR_TIMEOUT_EXPIRED:
+            mock.wps = FALSE;
+            mock_event_locked("WPS-TIMEOUT ");
+            break;
+        case WIFI_HAL_DISCONNECTED:
+            mock_event_locked("CTRL-EVENT-DISCONNECTED bssid=00:00:00:00:00:00 reason=0");
+            break;
+        case WIFI_HAL_ERROR_CONNECTION_LOST:
+            /* Beacon loss, reason 4 is inactivity */
+            mock_event_locked("CTRL-EVENT-DISCONNECTED bssid=00:00:00:00:00:00 reason=4 locally_generated=1");
+            break;
+        default:
+            break;
+    }
+    pthread_mutex_unlock(&mock.lock);
+    return RETURN_OK;
+}
+
+/* Simulator disconnect callback, runs on the simulator timer thread */
+static INT mock_on_disconnect(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    (void)ssidIndex;
+    (void)AP_SSID;
+    (void)error;
+
+    pthread_mutex_lock(&mock.lock);
+    mock.connecting = FALSE;
+    mock_event_locked("CTRL-EVENT-DISCONNECTED bssid=00:00:00:00:00:00 reason=3 locally_generated=1");
+    pthread_mutex_unlock(&mock.lock);
+    return RETURN_OK;
+}
+
+static void *mock_scan_thread(void *arg)
+{
+    (void)arg;
+
+    wifi_sim_waitForScanResults();
+
+    pthread_mutex_lock(&mock.lock);
+    mock.scan_waiting = FALSE;
+    if (mock.running)
+    {
+        mock_event_locked("CTRL-EVENT-SCAN-RESULTS ");
+    }
+    pthread_mutex_unlock(&mock.lock);
+    return NULL;
+}
+
+static const char *mock_key_mgmt(const CHAR *security)
+{
+    if (strstr(security, "WPA3") != NULL)
+    {
+        return "SAE";
+    }
+    if (strstr(security, "Enterprise") != NULL)
+    {
+        return "WPA2-EAP";
+    }
+    if (strstr(security, "WPA2") != NULL)
+    {
+        return "WPA2-PSK";
+    }
+    if (strstr(security, "WPA") != NULL)
+    {
+        return "WPA-PSK";
+    }
+    return "NONE";
+}
+
+static const char *mock_cipher(const CHAR *encryption)
+{
+    if (strcmp(encryption, "AES+TKIP") == 0)
+    {
+        return "CCMP+TKIP";
+    }
+    if (strcmp(encryption, "TKIP") == 0)
+    {
+        return "TKIP";
+    }
+    if (strcmp(encryption, "AES") == 0)
+    {
+        return "CCMP";
+    }
+    return "NONE";
+}
+
+/* The flags column of SCAN_RESULTS, e.g. "[WPA2-PSK-CCMP][ESS]" */
+static void mock_flags(const wifi_neighbor_ap_t *ap, char *flags, size_t size)
+{
+    const char *cipher = mock_cipher(ap->ap_EncryptionMode);
+    const CHAR *security = ap->ap_SecurityModeEnabled;
+
+    if (strcmp(security, "WPA-WPA2-Personal") == 0)
+    {
+        snprintf(flags, size, "[WPA-PSK-%s][WPA2-PSK-%s][ESS]", cipher, cipher);
+    }
+    else if (strcmp(security, "WEP") == 0)
+    {
+        snprintf(flags, size, "[WEP][ESS]");
+    }
+    else if (strcmp(mock_key_mgmt(security), "SAE") == 0)
+    {
+        snprintf(flags, size, "[RSN-SAE-%s][ESS]", cipher);
+    }
+    else if (strcmp(mock_key_mgmt(security), "NONE") == 0)
+    {
+        snprintf(flags, size, "[ESS]");
+    }
+    else
+    {
+        snprintf(flags, size, "[%s-%s][ESS]", mock_key_mgmt(security), cipher);
+    }
+}
+
+static int mock_network_id(const char *arg)
+{
+    char *end;
+    long id = strtol(arg, &end, 10);
+
+    if (end == arg || id < 0 || id >= MOCK_MAX_NETWORKS || !mock.networks[id].used)
+    {
+        return -1;
+    }
+    return (int)id;
+}
+
+/* Strips the quotes of a SET_NETWORK string value */
+static BOOL mock_unquote(CHAR *dst, size_t size, const char *value)
+{
+    size_t len = strlen(value);
+
+    if (len < 2 || value[0] != '"' || value[len - 1] != '"' || len - 2 >= size)
+    {
+        return FALSE;
+    }
+    memcpy(dst, value + 1, len - 2);
+    dst[len - 2] = '\0';
+    return TRUE;
+}
+
+static int mock_set_network(const char *args, char *reply, size_t size)
+{
+    char field[32];
+    const char *value;
+    int id;
+    mock_network_t *net;
+
+    id = mock_network_id(args);
+    value = strchr(args, ' ');
+    if (id < 0 || value == NULL || sscanf(value + 1, "%31s", field) != 1)
+    {
+        return snprintf(reply, size, "FAIL\n");
+    }
+    value = strchr(value + 1, ' ');
+    if (value == NULL)
+    {
+        return snprintf(reply, size, "FAIL\n");
+    }
+    value++;
+    net = &mock.networks[id];
+
+    if (strcmp(field, "ssid") == 0)
+    {
+        if (!mock_unquote(net->ssid, sizeof(net->ssid), value))
+        {
+            return snprintf(reply, size, "FAIL\n");
+        }
+    }
+    else if (strcmp(field, "psk") == 0 || strcmp(field, "sae_password") == 0)
+    {
+        if (!mock_unquote(net->psk, sizeof(net->psk), value))
+        {
+            /* 64 hex digits */
+            mock_copy(net->psk, sizeof(net->psk), value);
+        }
+    }
+    else if (strcmp(field, "wep_key0") == 0)
+    {
+        if (!mock_unquote(net->wep_key, sizeof(net->wep_key), value))
+        {
+            mock_copy(net->wep_key, sizeof(net->wep_key), value);
+        }
+    }
+    else if (strcmp(field, "key_mgmt") == 0)
+    {
+        mock_copy(net->key_mgmt, sizeof(net->key_mgmt), value);
+    }
+    else if (strcmp(field, "scan_ssid") != 0 && strcmp(field, "priority") != 0)
+    {
+        return snprintf(reply, size, "FAIL\n");
+    }
+    return snprintf(reply, size, "OK\n");
+}
+
+static int mock_select_network(const char *args, char *reply, size_t size)
+{
+    CHAR none[1] = "";
+    wifiSecurityMode_t mode;
+    mock_network_t *net;
+    int id = mock_network_id(args);
+
+    if (id < 0)
+    {
+        return snprintf(reply, size, "FAIL\n");
+    }
+    net = &mock.networks[id];
+    if (strcmp(net->key_mgmt, "SAE") == 0)
+    {
+        mode = WIFI_SECURITY_WPA3_SAE;
+    }
+    else if (strcmp(net->key_mgmt, "NONE") == 0)
+    {
+        mode = (net->wep_key[0] != '\0') ? WIFI_SECURITY_WEP_128 : WIFI_SECURITY_NONE;
+    }
+    else
+    {
+        mode = WIFI_SECURITY_WPA2_PSK_AES;
+    }
+    if (wifi_sim_connectEndpoint(1, net->ssid, mode, net->wep_key, net->psk, net->psk, FALSE, none, none, none, none) != RETURN_OK)
+    {
+        return snprintf(reply, size, "FAIL\n");
+    }
+    mock.current = id;
+    mock.connecting = TRUE;
+    net->disabled = FALSE;
+    return snprintf(reply, size, "OK\n");
+}
+
+/* Drops the link to the selected network, the simulator reports it through the disconnect callback */
+static void mock_disconnect_current(void)
+{
+    wifi_sta_stats_t sta;
+
+    if (mock.current < 0)
+    {
+        return;
+    }
+    if (wifi_sim_getStats(1, &sta) == RETURN_OK && sta.sta_SSID[0] != '\0')
+    {
+        wifi_sim_disconnectEndpoint(1, sta.sta_SSID);
+    }
+    else if (mock.connecting)
+    {
+        wifi_sim_disconnectEndpoint(1, mock.networks[mock.current].ssid);
+    }
+}
+
+static int mock_remove_network(const char *args, char *reply, size_t size)
+{
+    int id;
+
+    if (strcmp(args, "all") == 0)
+    {
+        mock_disconnect_current();
+        memset(mock.networks, 0, sizeof(mock.networks));
+        mock.current = -1;
+        return snprintf(reply, size, "OK\n");
+    }
+    id = mock_network_id(args);
+    if (id < 0)
+    {
+        return snprintf(reply, size, "FAIL\n");
+    }
+    if (id == mock.current)
+    {
+        mock_disconnect_current();
+        mock.current = -1;
+    }
+    memset(&mock.networks[id], 0, sizeof(mock.networks[id]));
+    return snprintf(reply, size, "OK\n");
+}
+
+static int mock_status(char *reply, size_t size)
+{
+    wifi_sim_radio_t radio;
+    wifi_sta_stats_t sta;
+    int len;
+
+    wifi_sim_get_radio(&radio);
+    if (wifi_sim_getStats(1, &sta) != RETURN_OK || sta.sta_SSID[0] == '\0')
+    {
+        return snprintf(reply, size, "wpa_state=%s\naddress=%s\n", mock.connecting ? "ASSOCIATING" : "DISCONNECTED",
+                        radio.ssid_mac);
+    }
+    len = snprintf(reply, size, "bssid=%s\nfreq=%u\nssid=%s\nid=%d\nmode=station\npairwise_cipher=%s\ngroup_cipher=%s\n"
+                   "key_mgmt=%s\nwpa_state=COMPLETED\naddress=%s\n",
+                   sta.sta_BSSID, sta.sta_Frequency, sta.sta_SSID, mock.current, mock_cipher(sta.sta_Encryption),
+                   mock_cipher(sta.sta_Encryption), mock_key_mgmt(sta.sta_SecMode), radio.ssid_mac);
+    return len;
+}
+
+static int mock_signal_poll(char *reply, size_t size)
+{
+    wifi_sta_stats_t sta;
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT count = 0;
+    CHAR width[16] = "20";
+
+    if (wifi_sim_getStats(1, &sta) != RETURN_OK || sta.sta_SSID[0] == '\0')
+    {
+        return snprintf(reply, size, "FAIL\n");
+    }
+    if (wifi_sim_getSpecificSSIDInfo(sta.sta_SSID, WIFI_HAL_FREQ_BAND_NONE, &aps, &count) == RETURN_OK)
+    {
+        for (UINT i = 0; i < count; i++)
+        {
+            if (strcmp(aps[i].ap_BSSID, sta.sta_BSSID) == 0)
+            {
+                mock_copy(width, sizeof(width), aps[i].ap_OperatingChannelBandwidth);
+                width[strcspn(width, "M")] = '\0';
+            }
+        }
+        free(aps);
+    }
+    return snprintf(reply, size, "RSSI=%d\nLINKSPEED=%u\nNOISE=%d\nFREQUENCY=%u\nWIDTH=%s MHz\n", (int)sta.sta_RSSI,
+                    (unsigned)sta.sta_PhyRate, (int)sta.sta_Noise, sta.sta_Frequency, width);
+}
+
+static int mock_scan(const char *args, char *reply, size_t size)
+{
+    wifi_sim_radio_t radio;
+    const char *freq = (args != NULL) ? strstr(args, "freq=") : NULL;
+    CHAR list[256];
+
+    if (freq != NULL)
+    {
+        mock_copy(list, sizeof(list), freq + strlen("freq="));
+        list[strcspn(list, " ")] = '\0';
+    }
+    else
+    {
+        /* A full scan dwells on every channel */
+        wifi_sim_get_radio(&radio);
+        mock_copy(list, sizeof(list), radio.possible_channels);
+    }
+    if (wifi_sim_setRadioScanningFreqList(1, list) != RETURN_OK)
+    {
+        return snprintf(reply, size, "FAIL-BUSY\n");
+    }
+    if (!mock.scan_waiting)
+    {
+        if (mock.scan_thread_started)
+        {
+            pthread_join(mock.scan_thread, NULL);
+            mock.scan_thread_started = FALSE;
+        }
+        mock.scan_waiting = TRUE;
+        if (pthread_create(&mock.scan_thread, NULL, mock_scan_thread, NULL) != 0)
+        {
+            mock.scan_waiting = FALSE;
+            return snprintf(reply, size, "FAIL\n");
+        }
+        mock.scan_thread_started = TRUE;
+    }
+    return snprintf(reply, size, "OK\n");
+}
+
+static int mock_scan_results(char *reply, size_t size)
+{
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT count = 0;
+    int len;
+
+    len = snprintf(reply, size, "bssid / frequency / signal level / flags / ssid\n");
+    if (wifi_sim_getNeighboringWiFiDiagnosticResult(1, &aps, &count) != RETURN_OK)
+    {
+        return len;
+    }
+    for (UINT i = 0; i < count && (size_t)len < size; i++)
+    {
+        char flags[96];
+
+        mock_flags(&aps[i], flags, sizeof(flags));
+        len += snprintf(reply + len, size - (size_t)len, "%s\t%u\t%d\t%s\t%s\n", aps[i].ap_BSSID,
+                        mock_frequency(aps[i].ap_Channel), aps[i].ap_SignalStrength, flags, aps[i].ap_SSID);
+    }
+    free(aps);
+    return len;
+}
+
+static int mock_capability_channels(char *reply, size_t size)
+{
+    wifi_sim_radio_t radio;
+    char bg[256] = "";
+    char a[256] = "";
+    size_t bg_len = 0;
+    size_t a_len = 0;
+    char *save = NULL;
+
+    wifi_sim_get_radio(&radio);
+    for (char *ch = strtok_r(radio.possible_channels, ", ", &save); ch != NULL; ch = strtok_r(NULL, ", ", &save))
+    {
+        if (strtoul(ch, NULL, 10) <= 14)
+        {
+            bg_len += (size_t)snprintf(bg + bg_len, sizeof(bg) - bg_len, " %s", ch);
+        }
+        else
+        {
+            a_len += (size_t)snprintf(a + a_len, sizeof(a) - a_len, " %s", ch);
+        }
+    }
+    return snprintf(reply, size, "Mode[G] Channels:%s\nMode[B] Channels:%s\nMode[A] Channels:%s\n", bg, bg, a);
+}
+
+static int mock_list_networks(char *reply, size_t size)
+{
+    int len = snprintf(reply, size, "network id / ssid / bssid / flags\n");
+
+    for (int i = 0; i < MOCK_MAX_NETWORKS && (size_t)len < size; i++)
+    {
+        if (mock.networks[i].used)
+        {
+            len += snprintf(reply + len, size - (size_t)len, "%d\t%s\tany\t%s\n", i, mock.networks[i].ssid,
+                            (i == mock.current) ? "[CURRENT]" : mock.networks[i].disabled ? "[DISABLED]" : "");
+        }
+    }
+    return len;
+}
+
+static int mock_attach(const struct sockaddr_un *from, BOOL attach, char *reply, size_t size)
+{
+    for (UINT i = 0; i < mock.attached_count; i++)
+    {
+        if (mock_same_addr(&mock.attached[i], from))
+        {
+            if (!attach)
+            {
+                mock.attached[i] = mock.attached[--mock.attached_count];
+            }
+            return snprintf(reply, size, "OK\n");
+        }
+    }
+    if (!attach || mock.attached_count == MOCK_MAX_CLIENTS)
+    {
+        return snprintf(reply, size, "FAIL\n");
+    }
+    mock.attached[mock.attached_count++] = *from;
+    return snprintf(reply, size, "OK\n");
+}
+
+static BOOL mock_is(const char *cmd, const char *name, const char **args)
+{
+    size_t len = strlen(name);
+
+    if (strncmp(cmd, name, len) != 0 || (cmd[len] != '\0' && cmd[len] != ' '))
+    {
+        return FALSE;
+    }
+    *args = (cmd[len] == ' ') ? cmd + len + 1 : NULL;
+    return TRUE;
+}
+
+/* Runs one command, caller holds mock.lock */
+static int mock_dispatch(const char *cmd, const struct sockaddr_un *from, char *reply, size_t size)
+{
+    const char *args;
+
+    if (mock_is(cmd, "PING", &args))
+    {
+        return snprintf(reply, size, "PONG\n");
+    }
+    if (mock_is(cmd, "STATUS", &args))
+    {
+        return mock_status(reply, size);
+    }
+    if (mock_is(cmd, "SIGNAL_POLL", &args))
+    {
+        return mock_signal_poll(reply, size);
+    }
+    if (mock_is(cmd, "SCAN", &args))
+    {
+        return mock_scan(args, reply, size);
+    }
+    if (mock_is(cmd, "SCAN_RESULTS", &args))
+    {
+        return mock_scan_results(reply, size);
+    }
+    if (mock_is(cmd, "GET_CAPABILITY", &args) && args != NULL && strcmp(args, "channels") == 0)
+    {
+        return mock_capability_channels(reply, size);
+    }
+    if (mock_is(cmd, "GET", &args) && args != NULL && strcmp(args, "country") == 0)
+    {
+        wifi_sim_radio_t radio;
+
+        wifi_sim_get_radio(&radio);
+        return snprintf(reply, size, "%s", radio.regulatory_domain);
+    }
+    if (mock_is(cmd, "ADD_NETWORK", &args))
+    {
+        for (int i = 0; i < MOCK_MAX_NETWORKS; i++)
+        {
+            if (!mock.networks[i].used)
+            {
+                memset(&mock.networks[i], 0, sizeof(mock.networks[i]));
+                mock.networks[i].used = TRUE;
+                mock_copy(mock.networks[i].key_mgmt, sizeof(mock.networks[i].key_mgmt), "WPA-PSK");
+                return snprintf(reply, size, "%d\n", i);
+            }
+        }
+        return snprintf(reply, size, "FAIL\n");
+    }
+    if (mock_is(cmd, "SET_NETWORK", &args) && args != NULL)
+    {
+        return mock_set_network(args, reply, size);
+    }
+    if (mock_is(cmd, "SELECT_NETWORK", &args) && args != NULL)
+    {
+        return mock_select_network(args, reply, size);
+    }
+    if ((mock_is(cmd, "ENABLE_NETWORK", &args) || mock_is(cmd, "DISABLE_NETWORK", &args)) && args != NULL)
+    {
+        int id = mock_network_id(args);
+
+        if (id < 0)
+        {
+            return snprintf(reply, size, "FAIL\n");
+        }
+        mock.networks[id].disabled = (cmd[0] == 'D');
+        return snprintf(reply, size, "OK\n");
+    }
+    if (mock_is(cmd, "REMOVE_NETWORK", &args) && args != NULL)
+    {
+        return mock_remove_network(args, reply, size);
+    }
+    if (mock_is(cmd, "LIST_NETWORKS", &args))
+    {
+        return mock_list_networks(reply, size);
+    }
+    if (mock_is(cmd, "SAVE_CONFIG", &args))
+    {
+        return snprintf(reply, size, "OK\n");
+    }
+    if (mock_is(cmd, "DISCONNECT", &args))
+    {
+        mock_disconnect_current();
+        return snprintf(reply, size, "OK\n");
+    }
+    if (mock_is(cmd, "WPS_PBC", &args))
+    {
+        if (wifi_sim_setCliWpsButtonPush(1) != RETURN_OK)
+        {
+            return snprintf(reply, size, "FAIL\n");
+        }
+        mock.wps = TRUE;
+        return snprintf(reply, size, "OK\n");
+    }
+    if (mock_is(cmd, "WPS_PIN", &args) && args != NULL)
+    {
+        CHAR pin[16];
+
+        /* "WPS_PIN any <pin>" answers with the PIN */
+        if (sscanf(args, "any %15s", pin) != 1 || wifi_sim_setCliWpsEnrolleePin(1, pin) != RETURN_OK)
+        {
+            return snprintf(reply, size, "FAIL\n");
+        }
+        mock.wps = TRUE;
+        return snprintf(reply, size, "%s", pin);
+    }
+    if (mock_is(cmd, "WPS_CANCEL", &args))
+    {
+        wifi_sim_cancelWpsPairing();
+        mock.wps = FALSE;
+        return snprintf(reply, size, "OK\n");
+    }
+    if (mock_is(cmd, "ATTACH", &args))
+    {
+        return mock_attach(from, TRUE, reply, size);
+    }
+    if (mock_is(cmd, "DETACH", &args))
+    {
+        return mock_attach(from, FALSE, reply, size);
+    }
+    return snprintf(reply, size, "UNKNOWN COMMAND\n");
+}
+
+static void mock_count_client(const struct sockaddr_un *from)
+{
+    for (UINT i = 0; i < mock.client_count; i++)
+    {
+        if (mock_same_addr(&mock.clients[i], from))
+        {
+            return;
+        }
+    }
+    if (mock.client_count < MOCK_MAX_CLIENTS)
+    {
+        mock.clients[mock.client_count++] = *from;
+    }
+}
+
+/* Reports signal and channel changes of the simulator as wpa_supplicant does, caller holds mock.lock */
+static void mock_watch_events_locked(UINT changes)
+{
+    wifi_sim_radio_t radio;
+    wifi_sta_stats_t sta;
+
+    wifi_sim_get_radio(&radio);
+    if (wifi_sim_getStats(1, &sta) != RETURN_OK)
+    {
+        memset(&sta, 0, sizeof(sta));
+    }
+    if ((changes & WIFI_SIM_CHANGE_CHANNEL) != 0)
+    {
+        UINT freq = (sta.sta_Frequency != 0) ? sta.sta_Frequency : mock_frequency((UINT)radio.channel);
+        CHAR width[16];
+
+        mock_copy(width, sizeof(width), radio.bandwidth);
+        width[strcspn(width, "M")] = '\0';
+        mock_event_locked("CTRL-EVENT-CHANNEL-SWITCH freq=%u ht_enabled=1 ch_offset=0 ch_width=%s MHz cf1=%u cf2=0", freq,
+                          width, freq);
+    }
+    /* Only sent while associated, from the signal monitor */
+    if ((changes & WIFI_SIM_CHANGE_RSSI) != 0 && sta.sta_SSID[0] != '\0')
+    {
+        mock_event_locked("CTRL-EVENT-SIGNAL-CHANGE above=%d signal=%d noise=%d txrate=%u", (sta.sta_RSSI >= -70.0f) ? 1 : 0,
+                          (int)sta.sta_RSSI, (int)sta.sta_Noise, (unsigned)sta.sta_PhyRate * 1000);
+    }
+}
+
+static void *mock_thread(void *arg)
+{
+    char request[MOCK_REQUEST_SIZE];
+    char *reply = arg;
+
+    for (;;)
+    {
+        struct pollfd pfd[3] = { { .fd = mock.fd, .events = POLLIN }, { .fd = mock.stop[0], .events = POLLIN },
+                                 { .fd = mock.watch, .events = POLLIN } };
+        struct sockaddr_un from;
+        socklen_t from_len = sizeof(from);
+        ssize_t len;
+        int reply_len;
+
+        if (poll(pfd, 3, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        if (pfd[1].revents != 0)
+        {
+            break;
+        }
+        if (pfd[2].revents != 0)
+        {
+            UINT changes = wifi_sim_watch_read(mock.watch);
+
+            pthread_mutex_lock(&mock.lock);
+            mock_watch_events_locked(changes);
+            pthread_mutex_unlock(&mock.lock);
+        }
+        if ((pfd[0].revents & POLLIN) == 0)
+        {
+            continue;
+        }
+        memset(&from, 0, sizeof(from));
+        len = recvfrom(mock.fd, request, sizeof(request) - 1, 0, (struct sockaddr *)&from, &from_len);
+        if (len <= 0)
+        {
+            continue;
+        }
+        while (len > 0 && request[len - 1] == '\n')
+        {
+            len--;
+        }
+        request[len] = '\0';
+
+        pthread_mutex_lock(&mock.lock);
+        mock.requests++;
+        mock_count_client(&from);
+        reply_len = mock_dispatch(request, &from, reply, MOCK_REPLY_SIZE);
+        if (reply_len >= MOCK_REPLY_SIZE)
+        {
+            reply_len = MOCK_REPLY_SIZE - 1;
+        }
+        sendto(mock.fd, reply, (size_t)reply_len, MSG_DONTWAIT, (struct sockaddr *)&from, from_len);
+        pthread_mutex_unlock(&mock.lock);
+    }
+    free(reply);
+    return NULL;
+}
+
+INT wifi_mock_supplicant_start(const CHAR *ctrl_path)
+{
+    struct sockaddr_un addr;
+    char *reply;
+    int fd;
+
+    if (ctrl_path == NULL || strlen(ctrl_path) >= sizeof(addr.sun_path))
+    {
+        return RETURN_ERR;
+    }
+    reply = malloc(MOCK_REPLY_SIZE);
+    if (reply == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    pthread_mutex_lock(&mock.lock);
+    if (mock.running)
+    {
+        pthread_mutex_unlock(&mock.lock);
+        free(reply);
+        return RETURN_ERR;
+    }
+
+    fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, ctrl_path);
+    unlink(ctrl_path);
+    if (fd < 0 || bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || pipe2(mock.stop, O_CLOEXEC) != 0)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+            unlink(ctrl_path);
+        }
+        pthread_mutex_unlock(&mock.lock);
+        free(reply);
+        return RETURN_ERR;
+    }
+
+    mock.fd = fd;
+    mock_copy(mock.path, sizeof(mock.path), ctrl_path);
+    mock.client_count = 0;
+    mock.attached_count = 0;
+    memset(mock.networks, 0, sizeof(mock.networks));
+    mock.current = -1;
+    mock.connecting = FALSE;
+    mock.wps = FALSE;
+    mock.scan_waiting = FALSE;
+    mock.requests = 0;
+    mock.events = 0;
+
+    wifi_sim_init(NULL);
+    wifi_sim_connectEndpoint_callback_register(mock_on_connect);
+    wifi_sim_disconnectEndpoint_callback_register(mock_on_disconnect);
+    /* Without a watcher the mock still serves requests, it just sends no signal or channel events */
+    mock.watch = wifi_sim_watch_open(WIFI_SIM_CHANGE_RSSI | WIFI_SIM_CHANGE_CHANNEL);
+
+    if (pthread_create(&mock.thread, NULL, mock_thread, reply) != 0)
+    {
+        wifi_sim_watch_close(mock.watch);
+        mock.watch = -1;
+        wifi_sim_uninit();
+        close(mock.stop[0]);
+        close(mock.stop[1]);
+        close(fd);
+        unlink(ctrl_path);
+        mock.fd = -1;
+        pthread_mutex_unlock(&mock.lock);
+        free(reply);
+        return RETURN_ERR;
+    }
+    mock.running = TRUE;
+    pthread_mutex_unlock(&mock.lock);
+    return RETURN_OK;
+}
+
+void wifi_mock_supplicant_stop(void)
+{
+    pthread_mutex_lock(&mock.lock);
+    if (!mock.running)
+    {
+        pthread_mutex_unlock(&mock.lock);
+        return;
+    }
+    mock.running = FALSE;
+    pthread_mutex_unlock(&mock.lock);
+
+    (void)!write(mock.stop[1], "", 1);
+    pthread_join(mock.thread, NULL);
+
+    /* Uninitialising ends a scan in flight, which releases the scan thread */
+    wifi_sim_connectEndpoint_callback_register(NULL);
+    wifi_sim_disconnectEndpoint_callback_register(NULL);
+    wifi_sim_uninit();
+    if (mock.scan_thread_started)
+    {
+        pthread_join(mock.scan_thread, NULL);
+        mock.scan_thread_started = FALSE;
+    }
+
+    pthread_mutex_lock(&mock.lock);
+    close(mock.fd);
+    mock.fd = -1;
+    unlink(mock.path);
+    close(mock.stop[0]);
+    close(mock.stop[1]);
+    mock.stop[0] = mock.stop[1] = -1;
+    wifi_sim_watch_close(mock.watch);
+    mock.watch = -1;
+    pthread_mutex_unlock(&mock.lock);
+}
+
+void wifi_mock_supplicant_stats(wifi_mock_supplicant_stats_t *stats)
+{
+    if (stats == NULL)
+    {
+        return;
+    }
+    pthread_mutex_lock(&mock.lock);
+    stats->requests = mock.requests;
+    stats->clients = mock.client_count;
+    stats->attached = mock.attached_count;
+    stats->events = mock.events;
+    pthread_mutex_unlock(&mock.lock);
+}
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
@@ -0,0 +1,429 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_ctrl.c
+*
+*/
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+#include "wifi_ctrl.h"
+
+#define CTRL_EVENT_SIZE 4096
+
+struct wifi_ctrl
+{
+    int cmd_fd;
+    int event_fd;                    /*!< -1 if not attached */
+    struct sockaddr_un cmd_local;
+    struct sockaddr_un event_local;
+    pthread_mutex_t lock;            /*!< Serialises requests on cmd_fd */
+    pthread_t thread;
+    int stop[2];                     /*!< Pipe that wakes the event thread to exit */
+    wifi_ctrl_event_fn on_event;
+    void *arg;
+    wifi_ctrl_stats_t stats;
+};
+
+static unsigned ctrl_counter = 0;
+
+static uint64_t ctrl_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Binds a datagram socket to a fresh client path and connects it to the supplicant */
+static int ctrl_socket(const char *ctrl_path, struct sockaddr_un *local)
+{
+    struct sockaddr_un dest;
+    int fd;
+
+    if (strlen(ctrl_path) >= sizeof(dest.sun_path))
+    {
+        return -1;
+    }
+    fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    memset(local, 0, sizeof(*local));
+    local->sun_family = AF_UNIX;
+    snprintf(local->sun_path, sizeof(local->sun_path), "%s/wifi_ctrl_%d-%u", WIFI_CTRL_CLIENT_DIR, (int)getpid(),
+             __atomic_add_fetch(&ctrl_counter, 1, __ATOMIC_RELAXED));
+    unlink(local->sun_path);
+    if (bind(fd, (struct sockaddr *)local, sizeof(*local)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    memset(&dest, 0, sizeof(dest));
+    dest.sun_family = AF_UNIX;
+    strcpy(dest.sun_path, ctrl_path);
+    if (connect(fd, (struct sockaddr *)&dest, sizeof(dest)) != 0)
+    {
+        unlink(local->sun_path);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/* Sends cmd on fd and waits for a reply, skipping events that arrive first */
+static int ctrl_send(int fd, const char *cmd)
+{
+    return (send(fd, cmd, strlen(cmd), 0) < 0) ? -1 : 0;
+}
+
+/* Waits until deadline for the next reply, skipping unsolicited messages */
+static int ctrl_receive(int fd, char *reply, size_t *reply_len, uint64_t deadline)
+{
+    if (*reply_len == 0)
+    {
+        return -1;
+    }
+    for (;;)
+    {
+        struct pollfd pfd = { .fd = fd, .events = POLLIN };
+        uint64_t now = ctrl_now_ns();
+        ssize_t len;
+        int ret;
+
+        if (now >= deadline)
+        {
+            return -2;
+        }
+        ret = poll(&pfd, 1, (int)((deadline - now + 999999ULL) / 1000000ULL));
+        if (ret < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (ret <= 0)
+        {
+            return -2;
+        }
+        len = recv(fd, reply, *reply_len - 1, 0);
+        if (len < 0)
+        {
+            return -1;
+        }
+        reply[len] = '\0';
+        /* Unsolicited messages start with the "<level>" of the event */
+        if (len > 0 && reply[0] == '<')
+        {
+            continue;
+        }
+        *reply_len = (size_t)len;
+        return 0;
+    }
+}
+
+static int ctrl_exchange(int fd, const char *cmd, char *reply, size_t *reply_len)
+{
+    uint64_t deadline = ctrl_now_ns() + (uint64_t)WIFI_CTRL_TIMEOUT_MS * 1000000ULL;
+
+    if (*reply_len == 0 || ctrl_send(fd, cmd) != 0)
+    {
+        return -1;
+    }
+    return ctrl_receive(fd, reply, reply_len, deadline);
+}
+
+static void *ctrl_event_thread(void *arg)
+{
+    wifi_ctrl_t *ctrl = arg;
+    char buf[CTRL_EVENT_SIZE];
+
+    for (;;)
+    {
+        struct pollfd pfd[2] = { { .fd = ctrl->event_fd, .events = POLLIN }, { .fd = ctrl->stop[0], .events = POLLIN } };
+        const char *event = buf;
+        ssize_t len;
+
+        if (poll(pfd, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        if (pfd[1].revents != 0)
+        {
+            break;
+        }
+        len = recv(ctrl->event_fd, buf, sizeof(buf) - 1, 0);
+        if (len <= 0)
+        {
+            continue;
+        }
+        while (len > 0 && buf[len - 1] == '\n')
+        {
+            len--;
+        }
+        buf[len] = '\0';
+        if (buf[0] == '<')
+        {
+            const char *end = strchr(buf, '>');
+
+            event = (end != NULL) ? end + 1 : buf;
+        }
+        __atomic_add_fetch(&ctrl->stats.events, 1, __ATOMIC_RELAXED);
+        ctrl->on_event(event, ctrl->arg);
+    }
+    return NULL;
+}
+
+static void ctrl_release(wifi_ctrl_t *ctrl)
+{
+    if (ctrl->cmd_fd >= 0)
+    {
+        close(ctrl->cmd_fd);
+        unlink(ctrl->cmd_local.sun_path);
+    }
+    if (ctrl->event_fd >= 0)
+    {
+        close(ctrl->event_fd);
+        unlink(ctrl->event_local.sun_path);
+    }
+    if (ctrl->stop[0] >= 0)
+    {
+        close(ctrl->stop[0]);
+        close(ctrl->stop[1]);
+    }
+    pthread_mutex_destroy(&ctrl->lock);
+    free(ctrl);
+}
+
+wifi_ctrl_t *wifi_ctrl_open(const char *ctrl_path, wifi_ctrl_event_fn on_event, void *arg)
+{
+    wifi_ctrl_t *ctrl;
+    char reply[64];
+    size_t reply_len = sizeof(reply);
+
+    if (ctrl_path == NULL)
+    {
+        return NULL;
+    }
+    ctrl = calloc(1, sizeof(*ctrl));
+    if (ctrl == NULL)
+    {
+        return NULL;
+    }
+    ctrl->event_fd = -1;
+    ctrl->stop[0] = ctrl->stop[1] = -1;
+    ctrl->on_event = on_event;
+    ctrl->arg = arg;
+    pthread_mutex_init(&ctrl->lock, NULL);
+
+    ctrl->cmd_fd = ctrl_socket(ctrl_path, &ctrl->cmd_local);
+    if (ctrl->cmd_fd < 0 || ctrl_exchange(ctrl->cmd_fd, "PING", reply, &reply_len) != 0 ||
+        strncmp(reply, "PONG", 4) != 0)
+    {
+        ctrl_release(ctrl);
+        return NULL;
+    }
+    if (on_event == NULL)
+    {
+        return ctrl;
+    }
+
+    reply_len = sizeof(reply);
+    ctrl->event_fd = ctrl_socket(ctrl_path, &ctrl->event_local);
+    if (ctrl->event_fd < 0 || ctrl_exchange(ctrl->event_fd, "ATTACH", reply, &reply_len) != 0 ||
+        strncmp(reply, "OK", 2) != 0 || pipe2(ctrl->stop, O_CLOEXEC) != 0)
+    {
+        ctrl_release(ctrl);
+        return NULL;
+    }
+    if (pthread_create(&ctrl->thread, NULL, ctrl_event_thread, ctrl) != 0)
+    {
+        ctrl_release(ctrl);
+        return NULL;
+    }
+    return ctrl;
+}
+
+void wifi_ctrl_close(wifi_ctrl_t *ctrl)
+{
+    if (ctrl == NULL)
+    {
+        return;
+    }
+    if (ctrl->event_fd >= 0)
+    {
+        char reply[64];
+        size_t reply_len = sizeof(reply);
+
+        (void)!write(ctrl->stop[1], "", 1);
+        pthread_join(ctrl->thread, NULL);
+        ctrl_exchange(ctrl->event_fd, "DETACH", reply, &reply_len);
+    }
+    ctrl_release(ctrl);
+}
+
+int wifi_ctrl_request(wifi_ctrl_t *ctrl, const char *cmd, char *reply, size_t *reply_len)
+{
+    uint64_t start;
+    int ret;
+
+    if (ctrl == NULL || cmd == NULL || reply == NULL || reply_len == NULL)
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(&ctrl->lock);
+    start = ctrl_now_ns();
+    ret = ctrl_exchange(ctrl->cmd_fd, cmd, reply, reply_len);
+    ctrl->stats.requests++;
+    ctrl->stats.batches++;
+    ctrl->stats.request_ns += ctrl_now_ns() - start;
+    if (ret != 0)
+    {
+        ctrl->stats.failures++;
+    }
+    pthread_mutex_unlock(&ctrl->lock);
+    return ret;
+}
+
+int wifi_ctrl_request_batch(wifi_ctrl_t *ctrl, const char *const *cmds, size_t count, char *const *replies,
+                            size_t *reply_lens)
+{
+    uint64_t start;
+    uint64_t deadline;
+    size_t sent = 0;
+    int ret = 0;
+
+    if (ctrl == NULL || cmds == NULL || replies == NULL || reply_lens == NULL || count == 0)
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(&ctrl->lock);
+    start = ctrl_now_ns();
+    deadline = start + (uint64_t)WIFI_CTRL_TIMEOUT_MS * 1000000ULL;
+    /* The supplicant serves its socket in order, so the replies come back in the order sent */
+    while (sent < count && ctrl_send(ctrl->cmd_fd, cmds[sent]) == 0)
+    {
+        sent++;
+    }
+    for (size_t i = 0; i < sent && ret == 0; i++)
+    {
+        ret = ctrl_receive(ctrl->cmd_fd, replies[i], &reply_lens[i], deadline);
+    }
+    if (ret == 0 && sent < count)
+    {
+        ret = -1;
+    }
+    ctrl->stats.requests += count;
+    ctrl->stats.batches++;
+    ctrl->stats.request_ns += ctrl_now_ns() - start;
+    if (ret != 0)
+    {
+        ctrl->stats.failures++;
+    }
+    pthread_mutex_unlock(&ctrl->lock);
+    return ret;
+}
+
+int wifi_ctrl_command(wifi_ctrl_t *ctrl, const char *cmd)
+{
+    char reply[64];
+    size_t reply_len = sizeof(reply);
+
+    if (wifi_ctrl_request(ctrl, cmd, reply, &reply_len) != 0)
+    {
+        return -1;
+    }
+    return (strncmp(reply, "OK", 2) == 0) ? 0 : -1;
+}
+
+void wifi_ctrl_get_stats(wifi_ctrl_t *ctrl, wifi_ctrl_stats_t *stats)
+{
+    if (stats == NULL)
+    {
+        return;
+    }
+    memset(stats, 0, sizeof(*stats));
+    if (ctrl == NULL)
+    {
+        return;
+    }
+    pthread_mutex_lock(&ctrl->lock);
+    *stats = ctrl->stats;
+    pthread_mutex_unlock(&ctrl->lock);
+    stats->events = __atomic_load_n(&ctrl->stats.events, __ATOMIC_RELAXED);
+}
+
+int wifi_ctrl_get_value(const char *reply, const char *key, char *value, size_t size)
+{
+    size_t key_len = strlen(key);
+    const char *line = reply;
+
+    if (size == 0)
+    {
+        return -1;
+    }
+    while (line != NULL && *line != '\0')
+    {
+        if (strncmp(line, key, key_len) == 0 && line[key_len] == '=')
+        {
+            const char *start = line + key_len + 1;
+            const char *end = strchr(start, '\n');
+            size_t len = (end != NULL) ? (size_t)(end - start) : strlen(start);
+
+            if (len >= size)
+            {
+                len = size - 1;
+            }
+            memcpy(value, start, len);
+            value[len] = '\0';
+            return 0;
+        }
+        line = strchr(line, '\n');
+        if (line != NULL)
+        {
+            line++;
+        }
+    }
+    return -1;
+}
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
@@ -0,0 +1,377 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_netstats.c
+*
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "wifi_netstats.h"
+
+/* A sysfs counter is at most 20 digits and a newline */
+#define NETSTATS_ATTR_SIZE 32
+
+/* /proc/net/dev of a hundred or so interfaces */
+#define NETSTATS_PROCFS_SIZE (32 * 1024)
+
+/* Columns of an interface line in /proc/net/dev */
+#define NETSTATS_PROCFS_COLUMNS 16
+
+struct wifi_netstats
+{
+    wifi_netstats_source_t source;
+    int fds[WIFI_NETSTATS_COUNTERS];     /*!< Sysfs attributes, -1 where the interface has none */
+    int procfs_fd;
+    char ifname[32];
+    size_t ifname_len;
+    char *procfs_buf;                    /*!< NETSTATS_PROCFS_SIZE bytes */
+};
+
+static const char *const netstats_attrs[WIFI_NETSTATS_COUNTERS] = {
+    [WIFI_NETSTATS_RX_BYTES] = "rx_bytes",
+    [WIFI_NETSTATS_RX_PACKETS] = "rx_packets",
+    [WIFI_NETSTATS_RX_ERRORS] = "rx_errors",
+    [WIFI_NETSTATS_RX_DROPPED] = "rx_dropped",
+    [WIFI_NETSTATS_RX_FIFO_ERRORS] = "rx_fifo_errors",
+    [WIFI_NETSTATS_RX_FRAME_ERRORS] = "rx_frame_errors",
+    [WIFI_NETSTATS_RX_COMPRESSED] = "rx_compressed",
+    [WIFI_NETSTATS_MULTICAST] = "multicast",
+    [WIFI_NETSTATS_TX_BYTES] = "tx_bytes",
+    [WIFI_NETSTATS_TX_PACKETS] = "tx_packets",
+    [WIFI_NETSTATS_TX_ERRORS] = "tx_errors",
+    [WIFI_NETSTATS_TX_DROPPED] = "tx_dropped",
+    [WIFI_NETSTATS_TX_FIFO_ERRORS] = "tx_fifo_errors",
+    [WIFI_NETSTATS_COLLISIONS] = "collisions",
+    [WIFI_NETSTATS_TX_CARRIER_ERRORS] = "tx_carrier_errors",
+    [WIFI_NETSTATS_TX_COMPRESSED] = "tx_compressed",
+    [WIFI_NETSTATS_RX_CRC_ERRORS] = "rx_crc_errors",
+};
+
+/*
+ * Converts the decimal number at p, after any blanks, and returns the first
+ * character after it, or NULL if there are no digits or it overflows.
+ */
+static const char *netstats_u64(const char *p, const char *end, uint64_t *value)
+{
+    uint64_t v = 0;
+    const char *digits;
+
+    while (p < end && (*p == ' ' || *p == '\t'))
+    {
+        p++;
+    }
+    digits = p;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+        unsigned d = (unsigned)(*p - '0');
+
+        if (v > (UINT64_MAX - d) / 10)
+        {
+            return NULL;
+        }
+        v = v * 10 + d;
+        p++;
+    }
+    if (p == digits)
+    {
+        return NULL;
+    }
+    *value = v;
+    return p;
+}
+
+static int netstats_open_file(const char *root, const char *rel, char *path, size_t size)
+{
+    int n = snprintf(path, size, "%s/%s", root, rel);
+
+    if (n < 0 || (size_t)n >= size)
+    {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+    return open(path, O_RDONLY | O_CLOEXEC);
+}
+
+/* Opens the statistics attributes, fails unless rx_bytes is there */
+static int netstats_open_sysfs(wifi_netstats_t *netstats, const char *root)
+{
+    char rel[128];
+    char path[512];
+
+    for (int i = 0; i < WIFI_NETSTATS_COUNTERS; i++)
+    {
+        snprintf(rel, sizeof(rel), "%s/%s/statistics/%s", WIFI_NETSTATS_SYSFS_DIR, netstats->ifname,
+                 netstats_attrs[i]);
+        netstats->fds[i] = netstats_open_file(root, rel, path, sizeof(path));
+        if (i == WIFI_NETSTATS_RX_BYTES && netstats->fds[i] < 0)
+        {
+            return -1;
+        }
+    }
+    netstats->source = WIFI_NETSTATS_SOURCE_SYSFS;
+    return 0;
+}
+
+static int netstats_read_sysfs(wifi_netstats_t *netstats, wifi_netstats_counters_t *counters)
+{
+    char buf[NETSTATS_ATTR_SIZE];
+
+    for (int i = 0; i < WIFI_NETSTATS_COUNTERS; i++)
+    {
+        ssize_t len;
+
+        if (netstats->fds[i] < 0)
+        {
+            counters->value[i] = 0;
+            continue;
+        }
+        len = pread(netstats->fds[i], buf, sizeof(buf), 0);
+        if (len <= 0 || netstats_u64(buf, buf + len, &counters->value[i]) == NULL)
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Reads the whole table, returns its length or -1 */
+static ssize_t netstats_read_procfs_table(wifi_netstats_t *netstats)
+{
+    size_t len = 0;
+
+    /* pread() at offset 0 makes the kernel generate the table again */
+    while (len < NETSTATS_PROCFS_SIZE)
+    {
+        ssize_t n = pread(netstats->procfs_fd, netstats->procfs_buf + len, NETSTATS_PROCFS_SIZE - len, (off_t)len);
+
+        if (n < 0)
+        {
+            return -1;
+        }
+        if (n == 0)
+        {
+            break;
+        }
+        len += (size_t)n;
+    }
+    return (ssize_t)len;
+}
+
+/* Finds "<blanks><ifname>:" at the start of a line and returns what follows the colon */
+static const char *netstats_procfs_line(const wifi_netstats_t *netstats, const char *p, const char *end)
+{
+    while (p < end)
+    {
+        const char *eol = memchr(p, '\n', (size_t)(end - p));
+        const char *name = p;
+
+        if (eol == NULL)
+        {
+            eol = end;
+        }
+        while (name < eol && *name == ' ')
+        {
+            name++;
+        }
+        if ((size_t)(eol - name) > netstats->ifname_len && name[netstats->ifname_len] == ':' &&
+            memcmp(name, netstats->ifname, netstats->ifname_len) == 0)
+        {
+            return name + netstats->ifname_len + 1;
+        }
+        p = eol + 1;
+    }
+    return NULL;
+}
+
+static int netstats_read_procfs(wifi_netstats_t *netstats, wifi_netstats_counters_t *counters)
+{
+    ssize_t len = netstats_read_procfs_table(netstats);
+    const char *end;
+    const char *eol;
+    const char *p;
+
+    if (len <= 0)
+    {
+        return -1;
+    }
+    end = netstats->procfs_buf + len;
+    p = netstats_procfs_line(netstats, netstats->procfs_buf, end);
+    if (p == NULL)
+    {
+        return -1;
+    }
+    eol = memchr(p, '\n', (size_t)(end - p));
+    if (eol != NULL)
+    {
+        end = eol;
+    }
+    for (int i = 0; i < NETSTATS_PROCFS_COLUMNS; i++)
+    {
+        p = netstats_u64(p, end, &counters->value[i]);
+        if (p == NULL)
+        {
+            return -1;
+        }
+    }
+    counters->value[WIFI_NETSTATS_RX_CRC_ERRORS] = 0;
+    return 0;
+}
+
+static int netstats_open_procfs(wifi_netstats_t *netstats, const char *root)
+{
+    wifi_netstats_counters_t counters;
+    char path[512];
+
+    netstats->procfs_fd = netstats_open_file(root, WIFI_NETSTATS_PROCFS_FILE, path, sizeof(path));
+    netstats->procfs_buf = malloc(NETSTATS_PROCFS_SIZE);
+    if (netstats->procfs_fd < 0 || netstats->procfs_buf == NULL)
+    {
+        return -1;
+    }
+    netstats->source = WIFI_NETSTATS_SOURCE_PROCFS;
+    /* The interface has to be in the table now */
+    return netstats_read_procfs(netstats, &counters);
+}
+
+void wifi_netstats_close(wifi_netstats_t *netstats)
+{
+    if (netstats == NULL)
+    {
+        return;
+    }
+    for (int i = 0; i < WIFI_NETSTATS_COUNTERS; i++)
+    {
+        if (netstats->fds[i] >= 0)
+        {
+            close(netstats->fds[i]);
+        }
+    }
+    if (netstats->procfs_fd >= 0)
+    {
+        close(netstats->procfs_fd);
+    }
+    free(netstats->procfs_buf);
+    free(netstats);
+}
+
+wifi_netstats_t *wifi_netstats_open(const char *root, const char *ifname)
+{
+    wifi_netstats_t *netstats;
+
+    if (ifname == NULL || ifname[0] == '\0' || strchr(ifname, '/') != NULL)
+    {
+        return NULL;
+    }
+    netstats = calloc(1, sizeof(*netstats));
+    if (netstats == NULL)
+    {
+        return NULL;
+    }
+    for (int i = 0; i < WIFI_NETSTATS_COUNTERS; i++)
+    {
+        netstats->fds[i] = -1;
+    }
+    netstats->procfs_fd = -1;
+    netstats->ifname_len = strlen(ifname);
+    if (netstats->ifname_len >= sizeof(netstats->ifname))
+    {
+        free(netstats);
+        return NULL;
+    }
+    memcpy(netstats->ifname, ifname, netstats->ifname_len + 1);
+
+    /* "/" joined with "sys/..." */
+    if (root == NULL || root[0] == '\0' || strcmp(root, "/") == 0)
+    {
+        root = "";
+    }
+    if (netstats_open_sysfs(netstats, root) == 0 || netstats_open_procfs(netstats, root) == 0)
+    {
+        return netstats;
+    }
+    wifi_netstats_close(netstats);
+    return NULL;
+}
+
+wifi_netstats_source_t wifi_netstats_source(const wifi_netstats_t *netstats)
+{
+    return netstats->source;
+}
+
+int wifi_netstats_read(wifi_netstats_t *netstats, wifi_netstats_counters_t *counters)
+{
+    if (netstats == NULL || counters == NULL)
+    {
+        return -1;
+    }
+    if (netstats->source == WIFI_NETSTATS_SOURCE_SYSFS)
+    {
+        return netstats_read_sysfs(netstats, counters);
+    }
+    return netstats_read_procfs(netstats, counters);
+}
+
+void wifi_netstats_fill_radio(const wifi_netstats_counters_t *counters, wifi_radioTrafficStats_t *radio)
+{
+    const uint64_t *v = counters->value;
+
+    memset(radio, 0, sizeof(*radio));
+    radio->radio_BytesSent = (ULONG)v[WIFI_NETSTATS_TX_BYTES];
+    radio->radio_BytesReceived = (ULONG)v[WIFI_NETSTATS_RX_BYTES];
+    radio->radio_PacketsSent = (ULONG)v[WIFI_NETSTATS_TX_PACKETS];
+    radio->radio_PacketsReceived = (ULONG)v[WIFI_NETSTATS_RX_PACKETS];
+    radio->radio_ErrorsSent = (ULONG)v[WIFI_NETSTATS_TX_ERRORS];
+    radio->radio_ErrorsReceived = (ULONG)v[WIFI_NETSTATS_RX_ERRORS];
+    radio->radio_DiscardPacketsSent = (ULONG)v[WIFI_NETSTATS_TX_DROPPED];
+    radio->radio_DiscardPacketsReceived = (ULONG)v[WIFI_NETSTATS_RX_DROPPED];
+    radio->radio_FCSErrorCount = (ULONG)v[WIFI_NETSTATS_RX_CRC_ERRORS];
+}
+
+void wifi_netstats_fill_ssid(const wifi_netstats_counters_t *counters, wifi_ssidTrafficStats_t *ssid)
+{
+    const uint64_t *v = counters->value;
+
+    memset(ssid, 0, sizeof(*ssid));
+    ssid->ssid_BytesSent = (ULONG)v[WIFI_NETSTATS_TX_BYTES];
+    ssid->ssid_BytesReceived = (ULONG)v[WIFI_NETSTATS_RX_BYTES];
+    ssid->ssid_PacketsSent = (ULONG)v[WIFI_NETSTATS_TX_PACKETS];
+    ssid->ssid_PacketsReceived = (ULONG)v[WIFI_NETSTATS_RX_PACKETS];
+    ssid->ssid_ErrorsSent = (ULONG)v[WIFI_NETSTATS_TX_ERRORS];
+    ssid->ssid_ErrorsReceived = (ULONG)v[WIFI_NETSTATS_RX_ERRORS];
+    ssid->ssid_DiscardedPacketsSent = (ULONG)v[WIFI_NETSTATS_TX_DROPPED];
+    ssid->ssid_DiscardedPacketsReceived = (ULONG)v[WIFI_NETSTATS_RX_DROPPED];
+    ssid->ssid_MulticastPacketsReceived = (ULONG)v[WIFI_NETSTATS_MULTICAST];
+    /* The counters of the two can be read a packet apart */
+    if (v[WIFI_NETSTATS_RX_PACKETS] >= v[WIFI_NETSTATS_MULTICAST])
+    {
+        ssid->ssid_UnicastPacketsReceived = (ULONG)(v[WIFI_NETSTATS_RX_PACKETS] - v[WIFI_NETSTATS_MULTICAST]);
+    }
+}
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
@@ -0,0 +1,636 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_ref.c
+*
+* Reference core state, lifecycle, radio getters and scans.
+*/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wifi_ref_internal.h"
+#include "wifi_scan_parse.h"
+
+/* SCAN_RESULTS of a few hundred access points */
+#define REF_SCAN_RESULTS_SIZE (64 * 1024)
+
+ref_state_t ref_state = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .changed = PTHREAD_COND_INITIALIZER,
+    .stats_window_ms = -1,
+};
+
+void ref_copy(CHAR *dst, size_t size, const CHAR *src)
+{
+    strncpy(dst, src, size - 1);
+    dst[size - 1] = '\0';
+}
+
+UINT ref_freq_channel(UINT freq)
+{
+    if (freq == 2484)
+    {
+        return 14;
+    }
+    if (freq >= 2412 && freq < 2484)
+    {
+        return (freq - 2407) / 5;
+    }
+    if (freq >= 5000 && freq < 5900)
+    {
+        return (freq - 5000) / 5;
+    }
+    return 0;
+}
+
+const CHAR *ref_freq_band(UINT freq)
+{
+    return (freq < 3000) ? "2.4GHz" : "5GHz";
+}
+
+const CHAR *ref_key_mgmt_name(const CHAR *key_mgmt)
+{
+    if (strstr(key_mgmt, "SAE") != NULL)
+    {
+        return "WPA3-Personal";
+    }
+    if (strstr(key_mgmt, "WPA2-EAP") != NULL)
+    {
+        return "WPA2-Enterprise";
+    }
+    if (strstr(key_mgmt, "EAP") != NULL)
+    {
+        return "WPA-Enterprise";
+    }
+    if (strstr(key_mgmt, "WPA2-PSK") != NULL)
+    {
+        return "WPA2-Personal";
+    }
+    if (strstr(key_mgmt, "PSK") != NULL)
+    {
+        return "WPA-Personal";
+    }
+    return "None";
+}
+
+const CHAR *ref_cipher_name(const CHAR *cipher)
+{
+    BOOL ccmp = (strstr(cipher, "CCMP") != NULL);
+    BOOL tkip = (strstr(cipher, "TKIP") != NULL);
+
+    if (ccmp && tkip)
+    {
+        return "AES+TKIP";
+    }
+    if (ccmp)
+    {
+        return "AES";
+    }
+    if (tkip)
+    {
+        return "TKIP";
+    }
+    return "None";
+}
+
+INT ref_request(const char *cmd, char *reply, size_t size)
+{
+    wifi_ctrl_t *ctrl;
+    size_t len = size;
+
+    pthread_mutex_lock(&ref_state.lock);
+    ctrl = ref_state.ctrl;
+    pthread_mutex_unlock(&ref_state.lock);
+
+    if (ctrl == NULL || wifi_ctrl_request(ctrl, cmd, reply, &len) != 0)
+    {
+        return RETURN_ERR;
+    }
+    return RETURN_OK;
+}
+
+INT ref_command(const char *cmd)
+{
+    char reply[64];
+
+    if (ref_request(cmd, reply, sizeof(reply)) != RETURN_OK || strncmp(reply, "OK", 2) != 0)
+    {
+        return RETURN_ERR;
+    }
+    return RETURN_OK;
+}
+
+void wifi_ref_set_ctrl_dir(const CHAR *dir)
+{
+    pthread_mutex_lock(&ref_state.lock);
+    ref_copy(ref_state.ctrl_dir, sizeof(ref_state.ctrl_dir), (dir != NULL) ? dir : "");
+    pthread_mutex_unlock(&ref_state.lock);
+}
+
+void wifi_ref_ctrl_stats(wifi_ctrl_stats_t *stats)
+{
+    pthread_mutex_lock(&ref_state.lock);
+    wifi_ctrl_get_stats(ref_state.ctrl, stats);
+    pthread_mutex_unlock(&ref_state.lock);
+}
+
+INT wifi_ref_init(const CHAR *interface)
+{
+    const CHAR *dir;
+    CHAR path[160];
+    wifi_ctrl_t *ctrl;
+
+    pthread_mutex_lock(&ref_state.lock);
+    if (ref_state.ctrl != NULL)
+    {
+        pthread_mutex_unlock(&ref_state.lock);
+        return RETURN_OK;
+    }
+    dir = ref_state.ctrl_dir;
+    if (dir[0] == '\0')
+    {
+        dir = getenv("WIFI_CTRL_DIR");
+    }
+    if (dir == NULL || dir[0] == '\0')
+    {
+        dir = WIFI_CTRL_DEFAULT_DIR;
+    }
+    ref_copy(ref_state.interface, sizeof(ref_state.interface),
+             (interface != NULL && interface[0] != '\0') ? interface : WIFI_REF_DEFAULT_INTERFACE);
+    snprintf(path, sizeof(path), "%s/%s", dir, ref_state.interface);
+    pthread_mutex_unlock(&ref_state.lock);
+
+    /* The event thread may call back into ref_state as soon as the connection exists */
+    ctrl = wifi_ctrl_open(path, ref_event, NULL);
+    if (ctrl == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    pthread_mutex_lock(&ref_state.lock);
+    ref_state.ctrl = ctrl;
+    ref_stats_invalidate();
+    ref_state.down = FALSE;
+    ref_state.scan_active = FALSE;
+    ref_state.disconnecting = FALSE;
+    ref_state.link_channel = 0;
+    ref_state.wps_active = FALSE;
+    pthread_mutex_unlock(&ref_state.lock);
+    ref_watch_signal(WIFI_REF_CHANGE_STATUS);
+    return RETURN_OK;
+}
+
+INT wifi_ref_down(void)
+{
+    if (ref_command("DISCONNECT") != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    pthread_mutex_lock(&ref_state.lock);
+    ref_state.down = TRUE;
+    ref_stats_invalidate();
+    pthread_mutex_unlock(&ref_state.lock);
+    ref_watch_signal(WIFI_REF_CHANGE_STATUS);
+    return RETURN_OK;
+}
+
+INT wifi_ref_uninit(void)
+{
+    wifi_ctrl_t *ctrl;
+    wifi_netstats_t *netstats;
+
+    pthread_mutex_lock(&ref_state.lock);
+    ctrl = ref_state.ctrl;
+    ref_state.ctrl = NULL;
+    netstats = ref_state.netstats;
+    ref_state.netstats = NULL;
+    ref_state.scan_active = FALSE;
+    ref_stats_invalidate();
+    pthread_cond_broadcast(&ref_state.changed);
+    pthread_mutex_unlock(&ref_state.lock);
+
+    wifi_netstats_close(netstats);
+    if (ctrl == NULL)
+    {
+        return RETURN_ERR;
+    }
+    wifi_ctrl_close(ctrl);
+    ref_watch_signal(WIFI_REF_CHANGE_STATUS);
+    return RETURN_OK;
+}
+
+BOOL wifi_ref_initialised(void)
+{
+    BOOL initialised;
+
+    pthread_mutex_lock(&ref_state.lock);
+    initialised = (ref_state.ctrl != NULL);
+    pthread_mutex_unlock(&ref_state.lock);
+    return initialised;
+}
+
+static BOOL ref_radio_valid(INT radioIndex, const void *output)
+{
+    return (radioIndex == 1 && output != NULL);
+}
+
+INT wifi_ref_getRadioEnable(INT radioIndex, BOOL *output_bool)
+{
+    if (!ref_radio_valid(radioIndex, output_bool) || !wifi_ref_initialised())
+    {
+        return RETURN_ERR;
+    }
+    pthread_mutex_lock(&ref_state.lock);
+    *output_bool = !ref_state.down;
+    pthread_mutex_unlock(&ref_state.lock);
+    return RETURN_OK;
+}
+
+INT wifi_ref_getRadioStatus(INT radioIndex, CHAR *output_string)
+{
+    char reply[16];
+
+    if (!ref_radio_valid(radioIndex, output_string) || ref_request("PING", reply, sizeof(reply)) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    pthread_mutex_lock(&ref_state.lock);
+    strcpy(output_string, ref_state.down ? "Down" : "Up");
+    pthread_mutex_unlock(&ref_state.lock);
+    return RETURN_OK;
+}
+
+INT wifi_ref_getRadioIfName(INT radioIndex, CHAR *output_string)
+{
+    if (!ref_radio_valid(radioIndex, output_string) || !wifi_ref_initialised())
+    {
+        return RETURN_ERR;
+    }
+    pthread_mutex_lock(&ref_state.lock);
+    strcpy(output_string, ref_state.interface);
+    pthread_mutex_unlock(&ref_state.lock);
+    return RETURN_OK;
+}
+
+/*
+ * Collects the channels of GET_CAPABILITY channels, "Mode[B] Channels: 1 2 ..." per mode,
+ * as a comma separated list without duplicates. Sets *has_24 and *has_5 for the bands seen.
+ */
+static INT ref_capability_channels(CHAR *list, size_t size, BOOL *has_24, BOOL *has_5)
+{
+    char reply[REF_REPLY_SIZE];
+    BOOL seen[256] = { FALSE };
+    const char *p;
+    size_t len = 0;
+
+    if (ref_request("GET_CAPABILITY channels", reply, sizeof(reply)) != RETURN_OK || strncmp(reply, "FAIL", 4) == 0)
+    {
+        return RETURN_ERR;
+    }
+    list[0] = '\0';
+    *has_24 = FALSE;
+    *has_5 = FALSE;
+    for (p = strstr(reply, "Channels:"); p != NULL; p = strstr(p, "Channels:"))
+    {
+        p += strlen("Channels:");
+        while (*p != '\0' && *p != '\n')
+        {
+            char *end;
+            unsigned long channel = strtoul(p, &end, 10);
+
+            if (end == p)
+            {
+                p++;
+                continue;
+            }
+            p = end;
+            /* Modes B and G list the same channels */
+            if (channel == 0 || channel >= 256 || seen[channel])
+            {
+                continue;
+            }
+            seen[channel] = TRUE;
+            if (channel <= 14)
+            {
+                *has_24 = TRUE;
+            }
+            else
+            {
+                *has_5 = TRUE;
+            }
+            len += (size_t)snprintf(list + len, (len < size) ? size - len : 0, "%s%lu", (len > 0) ? "," : "", channel);
+        }
+    }
+    return (len < size) ? RETURN_OK : RETURN_ERR;
+}
+
+INT wifi_ref_getRadioSupportedFrequencyBands(INT radioIndex, CHAR *output_string)
+{
+    CHAR channels[512];
+    BOOL has_24;
+    BOOL has_5;
+
+    if (!ref_radio_valid(radioIndex, output_string) ||
+        ref_capability_channels(channels, sizeof(channels), &has_24, &has_5) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    sprintf(output_string, "%s%s%s", has_24 ? "2.4GHz" : "", (has_24 && has_5) ? "," : "", has_5 ? "5GHz" : "");
+    return RETURN_OK;
+}
+
+INT wifi_ref_getRadioPossibleChannels(INT radioIndex, CHAR *output_string)
+{
+    CHAR channels[512];
+    BOOL has_24;
+    BOOL has_5;
+
+    if (!ref_radio_valid(radioIndex, output_string) ||
+        ref_capability_channels(channels, sizeof(channels), &has_24, &has_5) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, channels);
+    return RETURN_OK;
+}
+
+INT wifi_ref_getDualBandSupport(void)
+{
+    CHAR channels[512];
+    BOOL has_24;
+    BOOL has_5;
+
+    if (ref_capability_channels(channels, sizeof(channels), &has_24, &has_5) != RETURN_OK)
+    {
+        return 0;
+    }
+    return (has_24 && has_5) ? 1 : 0;
+}
+
+/* Reads one STATUS value, fails unless the station is associated */
+static INT ref_status_value(const char *key, CHAR *value, size_t size)
+{
+    char reply[REF_REPLY_SIZE];
+    char state[32];
+
+    if (ref_request("STATUS", reply, sizeof(reply)) != RETURN_OK ||
+        wifi_ctrl_get_value(reply, "wpa_state", state, sizeof(state)) != 0 || strcmp(state, "COMPLETED") != 0 ||
+        wifi_ctrl_get_value(reply, key, value, size) != 0)
+    {
+        return RETURN_ERR;
+    }
+    return RETURN_OK;
+}
+
+INT wifi_ref_getRadioOperatingFrequencyBand(INT radioIndex, CHAR *output_string)
+{
+    CHAR freq[16];
+
+    /* A station only has an operating band while associated */
+    if (!ref_radio_valid(radioIndex, output_string) || ref_status_value("freq", freq, sizeof(freq)) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, ref_freq_band((UINT)strtoul(freq, NULL, 10)));
+    return RETURN_OK;
+}
+
+INT wifi_ref_getRadioChannel(INT radioIndex, ULONG *output_ulong)
+{
+    char reply[REF_REPLY_SIZE];
+    char state[32];
+    CHAR freq[16];
+    UINT channel;
+
+    if (!ref_radio_valid(radioIndex, output_ulong) || ref_request("STATUS", reply, sizeof(reply)) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    pthread_mutex_lock(&ref_state.lock);
+    /* While not associated the radio stays on the channel of the last association, 0 before the first */
+    if (wifi_ctrl_get_value(reply, "wpa_state", state, sizeof(state)) == 0 && strcmp(state, "COMPLETED") == 0 &&
+        wifi_ctrl_get_value(reply, "freq", freq, sizeof(freq)) == 0)
+    {
+        ref_state.link_channel = ref_freq_channel((UINT)strtoul(freq, NULL, 10));
+    }
+    channel = ref_state.link_channel;
+    pthread_mutex_unlock(&ref_state.lock);
+    *output_ulong = channel;
+    return RETURN_OK;
+}
+
+INT wifi_ref_getRadioOperatingChannelBandwidth(INT radioIndex, CHAR *output_string)
+{
+    char reply[REF_REPLY_SIZE];
+    CHAR width[16];
+    size_t out = 0;
+
+    if (!ref_radio_valid(radioIndex, output_string) || ref_request("SIGNAL_POLL", reply, sizeof(reply)) != RETURN_OK ||
+        wifi_ctrl_get_value(reply, "WIDTH", width, sizeof(width)) != 0)
+    {
+        return RETURN_ERR;
+    }
+    /* "80 MHz" becomes "80MHz" */
+    for (size_t i = 0; width[i] != '\0'; i++)
+    {
+        if (width[i] != ' ')
+        {
+            output_string[out++] = width[i];
+        }
+    }
+    output_string[out] = '\0';
+    return RETURN_OK;
+}
+
+INT wifi_ref_getRegulatoryDomain(INT radioIndex, CHAR *output_string)
+{
+    char reply[16];
+
+    if (!ref_radio_valid(radioIndex, output_string) || ref_request("GET country", reply, sizeof(reply)) != RETURN_OK ||
+        strncmp(reply, "FAIL", 4) == 0)
+    {
+        return RETURN_ERR;
+    }
+    reply[strcspn(reply, "\n")] = '\0';
+    strcpy(output_string, reply);
+    return RETURN_OK;
+}
+
+/* Reads one STATUS value of the SSID, empty while not associated */
+static INT ref_ssid_value(INT ssidIndex, const char *key, CHAR *output_string, size_t size)
+{
+    char reply[REF_REPLY_SIZE];
+
+    if (ssidIndex != 1 || output_string == NULL || ref_request("STATUS", reply, sizeof(reply)) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    if (wifi_ctrl_get_value(reply, key, output_string, size) != 0)
+    {
+        output_string[0] = '\0';
+    }
+    return RETURN_OK;
+}
+
+INT wifi_ref_getSSIDName(INT ssidIndex, CHAR *output_string)
+{
+    return ref_ssid_value(ssidIndex, "ssid", output_string, 33);
+}
+
+INT wifi_ref_getBaseBSSID(INT ssidIndex, CHAR *output_string)
+{
+    return ref_ssid_value(ssidIndex, "bssid", output_string, 18);
+}
+
+INT wifi_ref_getSSIDMACAddress(INT ssidIndex, CHAR *output_string)
+{
+    return ref_ssid_value(ssidIndex, "address", output_string, 18);
+}
+
+/* Reads SCAN_RESULTS into a caller-owned array of the entries that match ssid and band */
+static INT ref_scan_results(const char *ssid, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t **out, UINT *count)
+{
+    wifi_scan_filter_t filter = { ssid, band };
+    char *reply;
+    INT ret;
+
+    *out = NULL;
+    *count = 0;
+    reply = malloc(REF_SCAN_RESULTS_SIZE);
+    if (reply == NULL)
+    {
+        return RETURN_ERR;
+    }
+    if (ref_request("SCAN_RESULTS", reply, REF_SCAN_RESULTS_SIZE) != RETURN_OK)
+    {
+        free(reply);
+        return RETURN_ERR;
+    }
+    ret = wifi_scan_parse_results(reply, strlen(reply), &filter, out, count);
+    free(reply);
+    return ret;
+}
+
+INT wifi_ref_getNeighboringWiFiDiagnosticResult(INT radioIndex, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size)
+{
+    if (!ref_radio_valid(radioIndex, neighbor_ap_array) || output_array_size == NULL)
+    {
+        return RETURN_ERR;
+    }
+    return ref_scan_results(NULL, WIFI_HAL_FREQ_BAND_NONE, neighbor_ap_array, output_array_size);
+}
+
+INT wifi_ref_getSpecificSSIDInfo(const char *SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t **ap_array, UINT *output_array_size)
+{
+    if (SSID == NULL || ap_array == NULL || output_array_size == NULL)
+    {
+        return RETURN_ERR;
+    }
+    return ref_scan_results(SSID, band, ap_array, output_array_size);
+}
+
+INT wifi_ref_setRadioScanningFreqList(INT radioIndex, const CHAR *freqList)
+{
+    CHAR cmd[512] = "SCAN freq=";
+    size_t len = strlen(cmd);
+    size_t start = len;
+    char reply[64];
+
+    if (!ref_radio_valid(radioIndex, freqList))
+    {
+        return RETURN_ERR;
+    }
+    /* Space or comma separated in the HAL, comma separated for the supplicant */
+    for (const CHAR *p = freqList; *p != '\0'; p++)
+    {
+        if (*p == ' ' || *p == ',')
+        {
+            if (len > start && cmd[len - 1] != ',')
+            {
+                cmd[len++] = ',';
+            }
+            continue;
+        }
+        if (!isdigit((unsigned char)*p) || len + 2 >= sizeof(cmd))
+        {
+            return RETURN_ERR;
+        }
+        cmd[len++] = *p;
+    }
+    if (len > start && cmd[len - 1] == ',')
+    {
+        len--;
+    }
+    if (len == start)
+    {
+        return RETURN_ERR;
+    }
+    cmd[len] = '\0';
+
+    pthread_mutex_lock(&ref_state.lock);
+    if (ref_state.ctrl == NULL)
+    {
+        pthread_mutex_unlock(&ref_state.lock);
+        return RETURN_ERR;
+    }
+    /* A scan already in flight is joined rather than restarted */
+    if (ref_state.scan_active)
+    {
+        pthread_mutex_unlock(&ref_state.lock);
+        return RETURN_OK;
+    }
+    /* Set before asking, the results event can overtake the reply */
+    ref_state.scan_active = TRUE;
+    pthread_mutex_unlock(&ref_state.lock);
+
+    if (ref_request(cmd, reply, sizeof(reply)) != RETURN_OK || strncmp(reply, "OK", 2) != 0)
+    {
+        pthread_mutex_lock(&ref_state.lock);
+        ref_state.scan_active = FALSE;
+        pthread_cond_broadcast(&ref_state.changed);
+        pthread_mutex_unlock(&ref_state.lock);
+        return RETURN_ERR;
+    }
+    return RETURN_OK;
+}
+
+INT wifi_ref_waitForScanResults(void)
+{
+    pthread_mutex_lock(&ref_state.lock);
+    if (ref_state.ctrl == NULL)
+    {
+        pthread_mutex_unlock(&ref_state.lock);
+        return RETURN_ERR;
+    }
+    while (ref_state.scan_active)
+    {
+        pthread_cond_wait(&ref_state.changed, &ref_state.lock);
+    }
+    pthread_mutex_unlock(&ref_state.lock);
+    return RETURN_OK;
+}
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
@@ -0,0 +1,144 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_ref_internal.h
+*
+* State shared between the reference core modules. Not for use outside reference/src.
+*/
+
+#ifndef __WIFI_REF_INTERNAL_H__
+#define __WIFI_REF_INTERNAL_H__
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "wifi_netstats.h"
+#include "wifi_ref.h"
+
+/**
+ * @brief Reply buffer for commands with a short answer
+ */
+#define REF_REPLY_SIZE 2048
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t changed;              /*!< Broadcast whenever a scan completes */
+
+    wifi_ctrl_t *ctrl;                   /*!< NULL while not initialised */
+    CHAR ctrl_dir[96];
+    CHAR interface[32];
+    BOOL down;                           /*!< wifi_down() was called */
+    BOOL scan_active;
+
+    /* Link */
+    CHAR link_ssid[64];                  /*!< SSID being connected or connected, empty after WPS until connected */
+    CHAR link_passphrase[128];
+    CHAR link_wep_key[128];
+    wifiSecurityMode_t link_security;
+    BOOL link_save;
+    BOOL disconnecting;                  /*!< The next disconnection was requested through the HAL */
+    BOOL wps_active;
+    wifi_pairedSSIDInfo_t paired;
+    UINT link_channel;                   /*!< Channel of the last association, reported by wifi_getRadioChannel() while not associated */
+
+    /* Statistics collector */
+    INT stats_window_ms;                 /*!< Age up to which wifi_getStats() is answered from the cache, -1 until resolved */
+    wifi_sta_stats_t stats_cache;
+    uint64_t stats_at_ns;                /*!< When stats_cache was collected, 0 if there is none */
+    UINT stats_generation;               /*!< Bumped by link changes, a collection spanning one is not cached */
+
+    /* Interface counters */
+    CHAR netstats_root[96];
+    wifi_netstats_t *netstats;           /*!< Opened by the first traffic getter, closed by uninit */
+
+    wifi_connectEndpoint_callback connect_cb;
+    wifi_disconnectEndpoint_callback disconnect_cb;
+    wifi_telemetry_ops_t *telemetry;
+} ref_state_t;
+
+extern ref_state_t ref_state;
+
+/**
+ * @brief Sends a command on the control connection
+ *
+ * @return INT - RETURN_OK if a reply arrived, RETURN_ERR if not initialised or on error
+ */
+INT ref_request(const char *cmd, char *reply, size_t size);
+
+/**
+ * @brief Sends a command whose expected reply is "OK"
+ *
+ * @return INT - RETURN_OK if the supplicant replied OK
+ */
+INT ref_command(const char *cmd);
+
+/**
+ * @brief Drops the cached statistics, called with ref_state.lock held when the link changes
+ */
+void ref_stats_invalidate(void);
+
+/**
+ * @brief Wakes the watchers of the changes, callable with or without ref_state.lock held
+ */
+void ref_watch_signal(UINT changes);
+
+/**
+ * @brief Wakes the RSSI watchers if the level is in another bucket than the last one of the link
+ */
+void ref_watch_signal_rssi(INT rssi);
+
+/**
+ * @brief Handles one supplicant event, runs on the event thread of the connection
+ */
+void ref_event(const char *event, void *arg);
+
+/**
+ * @brief Maps a key_mgmt value of STATUS or LIST_NETWORKS to a security mode name
+ */
+const CHAR *ref_key_mgmt_name(const CHAR *key_mgmt);
+
+/**
+ * @brief Maps a pairwise_cipher value or scan flags to an encryption mode name
+ */
+const CHAR *ref_cipher_name(const CHAR *cipher);
+
+/**
+ * @brief Returns the channel of a frequency in MHz, 0 if unknown
+ */
+UINT ref_freq_channel(UINT freq);
+
+/**
+ * @brief Returns "2.4GHz" or "5GHz" for a frequency in MHz
+ */
+const CHAR *ref_freq_band(UINT freq);
+
+/**
+ * @brief Copies a string, truncating to size
+ */
+void ref_copy(CHAR *dst, size_t size, const CHAR *src);
+
+#endif // __WIFI_REF_INTERNAL_H__
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
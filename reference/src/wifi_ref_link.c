@@ -0,0 +1,503 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_ref_link.c
+*
+* Connections, WPS and the supplicant events that drive the client callbacks.
+*/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wifi_ref_internal.h"
+
+static void ref_notify_connect(const CHAR *ssid, wifiStatusCode_t code)
+{
+    wifi_connectEndpoint_callback cb;
+    CHAR name[64];
+
+    pthread_mutex_lock(&ref_state.lock);
+    cb = ref_state.connect_cb;
+    pthread_mutex_unlock(&ref_state.lock);
+
+    if (cb != NULL)
+    {
+        ref_copy(name, sizeof(name), ssid);
+        cb(1, name, &code);
+    }
+}
+
+/* Quotes a string value for SET_NETWORK, rejecting what the quoting cannot carry */
+static BOOL ref_quote(CHAR *dst, size_t size, const CHAR *src)
+{
+    size_t len = strlen(src);
+
+    if (len + 3 > size || strpbrk(src, "\"\n") != NULL)
+    {
+        return FALSE;
+    }
+    snprintf(dst, size, "\"%s\"", src);
+    return TRUE;
+}
+
+static INT ref_set_network(const char *id, const char *field, const char *value)
+{
+    CHAR cmd[320];
+
+    snprintf(cmd, sizeof(cmd), "SET_NETWORK %s %s %s", id, field, value);
+    return ref_command(cmd);
+}
+
+INT wifi_ref_connectEndpoint(INT ssidIndex, CHAR *AP_SSID, wifiSecurityMode_t AP_security_mode, CHAR *AP_security_WEPKey,
+                             CHAR *AP_security_PreSharedKey, CHAR *AP_security_KeyPassphrase, INT saveSSID,
+                             CHAR *eapIdentity, CHAR *carootcert, CHAR *clientcert, CHAR *privatekey)
+{
+    char reply[64];
+    char id[16];
+    CHAR ssid[72];
+    CHAR secret[140];
+    const CHAR *passphrase = "";
+    const char *key_mgmt;
+
+    if (ssidIndex != 1 || AP_SSID == NULL || AP_security_mode > WIFI_SECURITY_WPA3_SAE ||
+        AP_security_WEPKey == NULL || AP_security_PreSharedKey == NULL || AP_security_KeyPassphrase == NULL ||
+        eapIdentity == NULL || carootcert == NULL || clientcert == NULL || privatekey == NULL ||
+        !ref_quote(ssid, sizeof(ssid), AP_SSID))
+    {
+        return RETURN_ERR;
+    }
+
+    switch (AP_security_mode)
+    {
+        case WIFI_SECURITY_NONE:
+            key_mgmt = "NONE";
+            break;
+        case WIFI_SECURITY_WEP_64:
+        case WIFI_SECURITY_WEP_128:
+            key_mgmt = "NONE";
+            passphrase = AP_security_WEPKey;
+            break;
+        case WIFI_SECURITY_WPA3_PSK_AES:
+        case WIFI_SECURITY_WPA3_SAE:
+            key_mgmt = "SAE";
+            passphrase = AP_security_KeyPassphrase;
+            break;
+        default:
+            key_mgmt = "WPA-PSK";
+            passphrase = (AP_security_KeyPassphrase[0] != '\0') ? AP_security_KeyPassphrase : AP_security_PreSharedKey;
+            break;
+    }
+
+    pthread_mutex_lock(&ref_state.lock);
+    if (ref_state.ctrl == NULL || ref_state.wps_active)
+    {
+        pthread_mutex_unlock(&ref_state.lock);
+        return RETURN_ERR;
+    }
+    ref_copy(ref_state.link_ssid, sizeof(ref_state.link_ssid), AP_SSID);
+    ref_copy(ref_state.link_passphrase, sizeof(ref_state.link_passphrase),
+             (key_mgmt[0] == 'N') ? "" : passphrase);
+    ref_copy(ref_state.link_wep_key, sizeof(ref_state.link_wep_key), AP_security_WEPKey);
+    ref_state.link_security = AP_security_mode;
+    ref_state.link_save = saveSSID ? TRUE : FALSE;
+    ref_state.disconnecting = FALSE;
+    pthread_mutex_unlock(&ref_state.lock);
+
+    /* The station keeps one network, as the HAL has one SSID */
+    if (ref_command("REMOVE_NETWORK all") != RETURN_OK || ref_request("ADD_NETWORK", reply, sizeof(reply)) != RETURN_OK ||
+        !isdigit((unsigned char)reply[0]))
+    {
+        return RETURN_ERR;
+    }
+    ref_copy(id, sizeof(id), reply);
+    id[strcspn(id, "\n")] = '\0';
+
+    if (ref_set_network(id, "ssid", ssid) != RETURN_OK || ref_set_network(id, "key_mgmt", key_mgmt) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    if (passphrase[0] != '\0')
+    {
+        BOOL wep = (AP_security_mode == WIFI_SECURITY_WEP_64 || AP_security_mode == WIFI_SECURITY_WEP_128);
+
+        /* Hex WEP keys and 64 digit PSKs go unquoted */
+        if (strlen(passphrase) == 64 || (wep && strlen(passphrase) != 5 && strlen(passphrase) != 13))
+        {
+            ref_copy(secret, sizeof(secret), passphrase);
+        }
+        else if (!ref_quote(secret, sizeof(secret), passphrase))
+        {
+            return RETURN_ERR;
+        }
+        if (ref_set_network(id, wep ? "wep_key0" : (key_mgmt[0] == 'S') ? "sae_password" : "psk",
+                            secret) != RETURN_OK)
+        {
+            return RETURN_ERR;
+        }
+    }
+
+    snprintf(reply, sizeof(reply), "SELECT_NETWORK %s", id);
+    if (ref_command(reply) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    if (saveSSID)
+    {
+        ref_command("SAVE_CONFIG");
+    }
+    return RETURN_OK;
+}
+
+INT wifi_ref_disconnectEndpoint(INT ssidIndex, CHAR *AP_SSID)
+{
+    if (ssidIndex != 1 || AP_SSID == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    pthread_mutex_lock(&ref_state.lock);
+    if (ref_state.ctrl == NULL)
+    {
+        pthread_mutex_unlock(&ref_state.lock);
+        return RETURN_ERR;
+    }
+    ref_state.disconnecting = TRUE;
+    pthread_mutex_unlock(&ref_state.lock);
+
+    if (ref_command("DISCONNECT") != RETURN_OK)
+    {
+        pthread_mutex_lock(&ref_state.lock);
+        ref_state.disconnecting = FALSE;
+        pthread_mutex_unlock(&ref_state.lock);
+        return RETURN_ERR;
+    }
+    return RETURN_OK;
+}
+
+INT wifi_ref_clearSSIDInfo(INT ssidIndex)
+{
+    if (ssidIndex != 1 || ref_command("REMOVE_NETWORK all") != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    ref_command("SAVE_CONFIG");
+
+    pthread_mutex_lock(&ref_state.lock);
+    memset(&ref_state.paired, 0, sizeof(ref_state.paired));
+    pthread_mutex_unlock(&ref_state.lock);
+    return RETURN_OK;
+}
+
+INT wifi_ref_lastConnected_Endpoint(wifi_pairedSSIDInfo_t *pairedSSIDInfo)
+{
+    if (pairedSSIDInfo == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    pthread_mutex_lock(&ref_state.lock);
+    if (ref_state.ctrl == NULL)
+    {
+        pthread_mutex_unlock(&ref_state.lock);
+        return RETURN_ERR;
+    }
+    *pairedSSIDInfo = ref_state.paired;
+    pthread_mutex_unlock(&ref_state.lock);
+    return RETURN_OK;
+}
+
+void wifi_ref_connectEndpoint_callback_register(wifi_connectEndpoint_callback callback_proc)
+{
+    pthread_mutex_lock(&ref_state.lock);
+    ref_state.connect_cb = callback_proc;
+    pthread_mutex_unlock(&ref_state.lock);
+}
+
+void wifi_ref_disconnectEndpoint_callback_register(wifi_disconnectEndpoint_callback callback_proc)
+{
+    pthread_mutex_lock(&ref_state.lock);
+    ref_state.disconnect_cb = callback_proc;
+    pthread_mutex_unlock(&ref_state.lock);
+}
+
+void wifi_ref_telemetry_callback_register(wifi_telemetry_ops_t *telemetry_ops)
+{
+    pthread_mutex_lock(&ref_state.lock);
+    ref_state.telemetry = telemetry_ops;
+    pthread_mutex_unlock(&ref_state.lock);
+}
+
+static INT ref_wps_start(const char *cmd)
+{
+    char reply[64];
+
+    pthread_mutex_lock(&ref_state.lock);
+    if (ref_state.ctrl == NULL || ref_state.wps_active)
+    {
+        pthread_mutex_unlock(&ref_state.lock);
+        return RETURN_ERR;
+    }
+    ref_state.wps_active = TRUE;
+    pthread_mutex_unlock(&ref_state.lock);
+
+    /* WPS_PIN answers with the PIN rather than OK */
+    if (ref_request(cmd, reply, sizeof(reply)) != RETURN_OK || strncmp(reply, "FAIL", 4) == 0 ||
+        strncmp(reply, "UNKNOWN", 7) == 0)
+    {
+        pthread_mutex_lock(&ref_state.lock);
+        ref_state.wps_active = FALSE;
+        pthread_mutex_unlock(&ref_state.lock);
+        return RETURN_ERR;
+    }
+    return RETURN_OK;
+}
+
+INT wifi_ref_setCliWpsButtonPush(INT ssidIndex)
+{
+    if (ssidIndex != 1)
+    {
+        return RETURN_ERR;
+    }
+    return ref_wps_start("WPS_PBC");
+}
+
+INT wifi_ref_setCliWpsEnrolleePin(INT ssidIndex, CHAR *EnrolleePin)
+{
+    char cmd[32];
+    size_t len;
+
+    if (ssidIndex != 1 || EnrolleePin == NULL)
+    {
+        return RETURN_ERR;
+    }
+    len = strlen(EnrolleePin);
+    if (len != 4 && len != 8)
+    {
+        return RETURN_ERR;
+    }
+    for (size_t i = 0; i < len; i++)
+    {
+        if (!isdigit((unsigned char)EnrolleePin[i]))
+        {
+            return RETURN_ERR;
+        }
+    }
+    snprintf(cmd, sizeof(cmd), "WPS_PIN any %s", EnrolleePin);
+    return ref_wps_start(cmd);
+}
+
+INT wifi_ref_cancelWpsPairing(void)
+{
+    if (ref_command("WPS_CANCEL") != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    pthread_mutex_lock(&ref_state.lock);
+    ref_state.wps_active = FALSE;
+    pthread_mutex_unlock(&ref_state.lock);
+    return RETURN_OK;
+}
+
+static BOOL ref_event_is(const char *event, const char *name)
+{
+    return (strncmp(event, name, strlen(name)) == 0);
+}
+
+/* "CTRL-EVENT-CONNECTED - Connection to 02:00:00:00:00:01 completed [id=0 id_str=]" */
+static void ref_event_connected(const char *event)
+{
+    const char *to = strstr(event, "Connection to ");
+    char status[REF_REPLY_SIZE];
+    CHAR bssid[18] = "";
+    CHAR ssid[64];
+    CHAR key_mgmt[32] = "";
+    BOOL need_status;
+
+    if (to != NULL)
+    {
+        to += strlen("Connection to ");
+        ref_copy(bssid, sizeof(bssid), to);
+        bssid[strcspn(bssid, " ")] = '\0';
+    }
+
+    pthread_mutex_lock(&ref_state.lock);
+    need_status = (ref_state.link_ssid[0] == '\0' || ref_state.link_save);
+    pthread_mutex_unlock(&ref_state.lock);
+
+    /* After WPS only the supplicant knows the network it was given */
+    if (need_status && ref_request("STATUS", status, sizeof(status)) == RETURN_OK)
+    {
+        CHAR value[64];
+
+        pthread_mutex_lock(&ref_state.lock);
+        if (ref_state.link_ssid[0] == '\0' && wifi_ctrl_get_value(status, "ssid", value, sizeof(value)) == 0)
+        {
+            ref_copy(ref_state.link_ssid, sizeof(ref_state.link_ssid), value);
+        }
+        pthread_mutex_unlock(&ref_state.lock);
+        wifi_ctrl_get_value(status, "key_mgmt", key_mgmt, sizeof(key_mgmt));
+    }
+
+    pthread_mutex_lock(&ref_state.lock);
+    ref_state.wps_active = FALSE;
+    ref_copy(ssid, sizeof(ssid), ref_state.link_ssid);
+    if (ref_state.link_save)
+    {
+        wifi_pairedSSIDInfo_t *paired = &ref_state.paired;
+
+        memset(paired, 0, sizeof(*paired));
+        ref_copy(paired->ap_ssid, sizeof(paired->ap_ssid), ref_state.link_ssid);
+        ref_copy(paired->ap_bssid, sizeof(paired->ap_bssid), bssid);
+        ref_copy(paired->ap_security, sizeof(paired->ap_security), ref_key_mgmt_name(key_mgmt));
+        ref_copy(paired->ap_passphrase, sizeof(paired->ap_passphrase), ref_state.link_passphrase);
+        ref_copy(paired->ap_wep_key, sizeof(paired->ap_wep_key), ref_state.link_wep_key);
+    }
+    pthread_mutex_unlock(&ref_state.lock);
+
+    ref_notify_connect(ssid, WIFI_HAL_CONNECTED);
+}
+
+static void ref_event_disconnected(void)
+{
+    wifi_disconnectEndpoint_callback cb = NULL;
+    wifiStatusCode_t code = WIFI_HAL_DISCONNECTED;
+    BOOL requested;
+    CHAR ssid[64];
+
+    pthread_mutex_lock(&ref_state.lock);
+    requested = ref_state.disconnecting;
+    ref_state.disconnecting = FALSE;
+    ref_copy(ssid, sizeof(ssid), ref_state.link_ssid);
+    if (requested)
+    {
+        cb = ref_state.disconnect_cb;
+    }
+    pthread_mutex_unlock(&ref_state.lock);
+
+    /* A link lost without wifi_disconnectEndpoint() is reported on the connect callback */
+    if (!requested)
+    {
+        ref_notify_connect(ssid, WIFI_HAL_DISCONNECTED);
+    }
+    else if (cb != NULL)
+    {
+        cb(1, ssid, &code);
+    }
+}
+
+static void ref_event_failed(wifiStatusCode_t code, BOOL wps)
+{
+    CHAR ssid[64];
+
+    pthread_mutex_lock(&ref_state.lock);
+    if (wps)
+    {
+        ref_state.wps_active = FALSE;
+    }
+    ref_copy(ssid, sizeof(ssid), ref_state.link_ssid);
+    pthread_mutex_unlock(&ref_state.lock);
+
+    ref_notify_connect(ssid, code);
+}
+
+void ref_event(const char *event, void *arg)
+{
+    (void)arg;
+
+    if (ref_event_is(event, "CTRL-EVENT-SCAN-RESULTS") || ref_event_is(event, "CTRL-EVENT-SCAN-FAILED"))
+    {
+        pthread_mutex_lock(&ref_state.lock);
+        ref_state.scan_active = FALSE;
+        pthread_cond_broadcast(&ref_state.changed);
+        pthread_mutex_unlock(&ref_state.lock);
+    }
+    else if (ref_event_is(event, "CTRL-EVENT-CONNECTED"))
+    {
+        pthread_mutex_lock(&ref_state.lock);
+        ref_stats_invalidate();
+        pthread_mutex_unlock(&ref_state.lock);
+        ref_watch_signal(WIFI_REF_CHANGE_CONNECTION);
+        ref_event_connected(event);
+    }
+    else if (ref_event_is(event, "CTRL-EVENT-DISCONNECTED"))
+    {
+        pthread_mutex_lock(&ref_state.lock);
+        ref_stats_invalidate();
+        pthread_mutex_unlock(&ref_state.lock);
+        ref_watch_signal(WIFI_REF_CHANGE_CONNECTION);
+        ref_event_disconnected();
+    }
+    else if (ref_event_is(event, "CTRL-EVENT-SIGNAL-CHANGE"))
+    {
+        const char *signal = strstr(event, " signal=");
+
+        /* The cached statistics hold the old level */
+        pthread_mutex_lock(&ref_state.lock);
+        ref_stats_invalidate();
+        pthread_mutex_unlock(&ref_state.lock);
+        if (signal != NULL)
+        {
+            ref_watch_signal_rssi((INT)strtol(signal + strlen(" signal="), NULL, 10));
+        }
+    }
+    else if (ref_event_is(event, "CTRL-EVENT-CHANNEL-SWITCH"))
+    {
+        pthread_mutex_lock(&ref_state.lock);
+        ref_stats_invalidate();
+        pthread_mutex_unlock(&ref_state.lock);
+        ref_watch_signal(WIFI_REF_CHANGE_CHANNEL);
+    }
+    else if (ref_event_is(event, "CTRL-EVENT-NETWORK-NOT-FOUND"))
+    {
+        ref_event_failed(WIFI_HAL_ERROR_NOT_FOUND, FALSE);
+    }
+    else if (ref_event_is(event, "CTRL-EVENT-SSID-TEMP-DISABLED") && strstr(event, "reason=WRONG_KEY") != NULL)
+    {
+        ref_event_failed(WIFI_HAL_ERROR_INVALID_CREDENTIALS, FALSE);
+    }
+    else if (ref_event_is(event, "WPS-SUCCESS"))
+    {
+        /* The credential is saved and the connection follows */
+        pthread_mutex_lock(&ref_state.lock);
+        ref_state.link_ssid[0] = '\0';
+        ref_state.link_passphrase[0] = '\0';
+        ref_state.link_wep_key[0] = '\0';
+        ref_state.link_save = TRUE;
+        pthread_mutex_unlock(&ref_state.lock);
+    }
+    else if (ref_event_is(event, "WPS-FAIL"))
+    {
+        ref_event_failed(WIFI_HAL_ERROR_INVALID_CREDENTIALS, TRUE);
+    }
+    else if (ref_event_is(event, "WPS-TIMEOUT"))
+    {
+        pthread_mutex_lock(&ref_state.lock);
+        ref_state.wps_active = FALSE;
+        pthread_mutex_unlock(&ref_state.lock);
+        ref_notify_connect("", WIFI_HAL_ERROR_TIMEOUT_EXPIRED);
+    }
+}
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
@@ -0,0 +1,260 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_ref_stats.c
+*
+* Statistics behind wifi_getStats() and the traffic getters.
+*
+* STATUS and SIGNAL_POLL are sent back to back on the control connection and
+* their replies collected together, so a collection waits for the supplicant
+* once. The result is kept and served again for the configured window; link
+* changes drop it, and a collection that overlaps one is not kept.
+*
+* Traffic counters are the kernel statistics of the interface, read through a
+* wifi_netstats_t reader that stays open until wifi_uninit().
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wifi_ref_internal.h"
+
+static uint64_t ref_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Called with ref_state.lock held */
+static UINT ref_stats_window_ms(void)
+{
+    if (ref_state.stats_window_ms < 0)
+    {
+        const char *env = getenv("WIFI_REF_STATS_WINDOW_MS");
+
+        ref_state.stats_window_ms = (env != NULL && env[0] != '\0') ? atoi(env) : WIFI_REF_STATS_WINDOW_MS;
+        if (ref_state.stats_window_ms < 0)
+        {
+            ref_state.stats_window_ms = 0;
+        }
+    }
+    return (UINT)ref_state.stats_window_ms;
+}
+
+void ref_stats_invalidate(void)
+{
+    ref_state.stats_at_ns = 0;
+    ref_state.stats_generation++;
+}
+
+void wifi_ref_set_stats_window(INT window_ms)
+{
+    pthread_mutex_lock(&ref_state.lock);
+    ref_state.stats_window_ms = (window_ms < 0) ? -1 : window_ms;
+    ref_stats_invalidate();
+    pthread_mutex_unlock(&ref_state.lock);
+}
+
+/* Fills the statistics from the replies to STATUS and SIGNAL_POLL */
+static void ref_stats_parse(const char *status, const char *signal, wifi_sta_stats_t *sta)
+{
+    CHAR value[64];
+
+    memset(sta, 0, sizeof(*sta));
+    /* Not associated reads back as zeroed statistics */
+    if (wifi_ctrl_get_value(status, "wpa_state", value, sizeof(value)) != 0 || strcmp(value, "COMPLETED") != 0)
+    {
+        return;
+    }
+
+    wifi_ctrl_get_value(status, "ssid", sta->sta_SSID, sizeof(sta->sta_SSID));
+    wifi_ctrl_get_value(status, "bssid", sta->sta_BSSID, sizeof(sta->sta_BSSID));
+    if (wifi_ctrl_get_value(status, "freq", value, sizeof(value)) == 0)
+    {
+        sta->sta_Frequency = (UINT)strtoul(value, NULL, 10);
+        ref_copy(sta->sta_BAND, sizeof(sta->sta_BAND), ref_freq_band(sta->sta_Frequency));
+    }
+    if (wifi_ctrl_get_value(status, "key_mgmt", value, sizeof(value)) == 0)
+    {
+        ref_copy(sta->sta_SecMode, sizeof(sta->sta_SecMode), ref_key_mgmt_name(value));
+    }
+    if (wifi_ctrl_get_value(status, "pairwise_cipher", value, sizeof(value)) == 0)
+    {
+        ref_copy(sta->sta_Encryption, sizeof(sta->sta_Encryption), ref_cipher_name(value));
+    }
+
+    /* SIGNAL_POLL fails if the link went down between the two replies */
+    if (strncmp(signal, "FAIL", 4) == 0)
+    {
+        return;
+    }
+    if (wifi_ctrl_get_value(signal, "RSSI", value, sizeof(value)) == 0)
+    {
+        sta->sta_RSSI = (FLOAT)strtol(value, NULL, 10);
+    }
+    if (wifi_ctrl_get_value(signal, "NOISE", value, sizeof(value)) == 0)
+    {
+        sta->sta_Noise = (FLOAT)strtol(value, NULL, 10);
+    }
+    /* LINKSPEED is the current transmit rate in Mb/s */
+    if (wifi_ctrl_get_value(signal, "LINKSPEED", value, sizeof(value)) == 0)
+    {
+        sta->sta_PhyRate = (FLOAT)strtoul(value, NULL, 10);
+        sta->sta_LastDataUplinkRate = (UINT)strtoul(value, NULL, 10) * 1000;
+    }
+}
+
+static INT ref_stats_collect(wifi_sta_stats_t *sta)
+{
+    static const char *const cmds[] = { "STATUS", "SIGNAL_POLL" };
+    char status[REF_REPLY_SIZE];
+    char signal[REF_REPLY_SIZE];
+    char *const replies[] = { status, signal };
+    size_t lens[] = { sizeof(status), sizeof(signal) };
+    wifi_ctrl_t *ctrl;
+
+    pthread_mutex_lock(&ref_state.lock);
+    ctrl = ref_state.ctrl;
+    pthread_mutex_unlock(&ref_state.lock);
+
+    if (ctrl == NULL || wifi_ctrl_request_batch(ctrl, cmds, 2, replies, lens) != 0)
+    {
+        return RETURN_ERR;
+    }
+    ref_stats_parse(status, signal, sta);
+    return RETURN_OK;
+}
+
+INT wifi_ref_getStats(INT radioIndex, wifi_sta_stats_t *wifi_sta_stats)
+{
+    uint64_t now;
+    UINT generation;
+    UINT window_ms;
+
+    if (radioIndex != 1 || wifi_sta_stats == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    now = ref_now_ns();
+    pthread_mutex_lock(&ref_state.lock);
+    window_ms = ref_stats_window_ms();
+    if (ref_state.ctrl != NULL && ref_state.stats_at_ns != 0 &&
+        now - ref_state.stats_at_ns < (uint64_t)window_ms * 1000000ULL)
+    {
+        *wifi_sta_stats = ref_state.stats_cache;
+        pthread_mutex_unlock(&ref_state.lock);
+        return RETURN_OK;
+    }
+    generation = ref_state.stats_generation;
+    pthread_mutex_unlock(&ref_state.lock);
+
+    if (ref_stats_collect(wifi_sta_stats) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+
+    /* Aged from when it was asked for, so it is never served older than the window */
+    pthread_mutex_lock(&ref_state.lock);
+    if (window_ms > 0 && generation == ref_state.stats_generation)
+    {
+        ref_state.stats_cache = *wifi_sta_stats;
+        ref_state.stats_at_ns = now;
+    }
+    pthread_mutex_unlock(&ref_state.lock);
+    return RETURN_OK;
+}
+
+void wifi_ref_set_netstats_root(const CHAR *root)
+{
+    pthread_mutex_lock(&ref_state.lock);
+    ref_copy(ref_state.netstats_root, sizeof(ref_state.netstats_root), (root != NULL) ? root : "");
+    pthread_mutex_unlock(&ref_state.lock);
+}
+
+/* Opens the reader on first use, called with ref_state.lock held */
+static INT ref_traffic_read(wifi_netstats_counters_t *counters)
+{
+    if (ref_state.ctrl == NULL)
+    {
+        return RETURN_ERR;
+    }
+    if (ref_state.netstats == NULL)
+    {
+        const CHAR *root = ref_state.netstats_root;
+
+        if (root[0] == '\0')
+        {
+            root = getenv("WIFI_NETSTATS_ROOT");
+        }
+        ref_state.netstats = wifi_netstats_open(root, ref_state.interface);
+        if (ref_state.netstats == NULL)
+        {
+            return RETURN_ERR;
+        }
+    }
+    return (wifi_netstats_read(ref_state.netstats, counters) == 0) ? RETURN_OK : RETURN_ERR;
+}
+
+INT wifi_ref_getRadioTrafficStats(INT radioIndex, wifi_radioTrafficStats_t *output_struct)
+{
+    wifi_netstats_counters_t counters;
+    INT ret;
+
+    if (radioIndex != 1 || output_struct == NULL)
+    {
+        return RETURN_ERR;
+    }
+    pthread_mutex_lock(&ref_state.lock);
+    ret = ref_traffic_read(&counters);
+    pthread_mutex_unlock(&ref_state.lock);
+    if (ret == RETURN_OK)
+    {
+        wifi_netstats_fill_radio(&counters, output_struct);
+    }
+    return ret;
+}
+
+INT wifi_ref_getSSIDTrafficStats(INT ssidIndex, wifi_ssidTrafficStats_t *output_struct)
+{
+    wifi_netstats_counters_t counters;
+    INT ret;
+
+    if (ssidIndex != 1 || output_struct == NULL)
+    {
+        return RETURN_ERR;
+    }
+    pthread_mutex_lock(&ref_state.lock);
+    ret = ref_traffic_read(&counters);
+    pthread_mutex_unlock(&ref_state.lock);
+    if (ret == RETURN_OK)
+    {
+        wifi_netstats_fill_ssid(&counters, output_struct);
+    }
+    return ret;
+}
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
@@ -0,0 +1,178 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_ref_watch.c
+*
+* Change watchers, fed from supplicant events: CTRL-EVENT-CONNECTED and
+* DISCONNECTED, CTRL-EVENT-SIGNAL-CHANGE from the signal monitor and
+* CTRL-EVENT-CHANNEL-SWITCH. Each watcher is an eventfd written only when its
+* pending changes go from none to some, so a burst costs one wakeup.
+*/
+
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include "wifi_ref_internal.h"
+
+typedef struct
+{
+    INT fd;                  /*!< -1 when the slot is free */
+    UINT changes;            /*!< Changes the watcher asked for */
+    UINT pending;            /*!< Changes since the last wifi_ref_watch_read() */
+} ref_watcher_t;
+
+/* Taken after ref_state.lock where both are held */
+static pthread_mutex_t watch_lock = PTHREAD_MUTEX_INITIALIZER;
+static BOOL watch_rssi_known = FALSE;   /*!< A signal level has been seen on the current link */
+static INT watch_rssi_bucket;
+static ref_watcher_t watchers[WIFI_REF_MAX_WATCHERS] = {
+    [0 ... WIFI_REF_MAX_WATCHERS - 1] = { .fd = -1 },
+};
+
+/* Caller holds watch_lock */
+static void ref_watch_signal_locked(UINT changes)
+{
+    static const uint64_t one = 1;
+
+    for (int i = 0; i < WIFI_REF_MAX_WATCHERS; i++)
+    {
+        UINT bits = changes & watchers[i].changes;
+
+        if (watchers[i].fd < 0 || bits == 0)
+        {
+            continue;
+        }
+        if (watchers[i].pending == 0)
+        {
+            (void)!write(watchers[i].fd, &one, sizeof(one));
+        }
+        watchers[i].pending |= bits;
+    }
+}
+
+void ref_watch_signal(UINT changes)
+{
+    pthread_mutex_lock(&watch_lock);
+    /* The next link starts without a signal level to compare with */
+    if ((changes & WIFI_REF_CHANGE_CONNECTION) != 0)
+    {
+        watch_rssi_known = FALSE;
+    }
+    ref_watch_signal_locked(changes);
+    pthread_mutex_unlock(&watch_lock);
+}
+
+void ref_watch_signal_rssi(INT rssi)
+{
+    /* Truncates towards 0, so -50 to -59 dBm share a bucket */
+    INT bucket = rssi / WIFI_REF_RSSI_BUCKET_DB;
+
+    pthread_mutex_lock(&watch_lock);
+    if (!watch_rssi_known || bucket != watch_rssi_bucket)
+    {
+        watch_rssi_known = TRUE;
+        watch_rssi_bucket = bucket;
+        ref_watch_signal_locked(WIFI_REF_CHANGE_RSSI);
+    }
+    pthread_mutex_unlock(&watch_lock);
+}
+
+INT wifi_ref_watch_open(UINT changes)
+{
+    INT fd = -1;
+
+    if ((changes & WIFI_REF_CHANGE_ALL) == 0)
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(&watch_lock);
+    for (int i = 0; i < WIFI_REF_MAX_WATCHERS; i++)
+    {
+        if (watchers[i].fd < 0)
+        {
+            fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (fd >= 0)
+            {
+                watchers[i].fd = fd;
+                watchers[i].changes = changes & WIFI_REF_CHANGE_ALL;
+                watchers[i].pending = 0;
+            }
+            break;
+        }
+    }
+    pthread_mutex_unlock(&watch_lock);
+    return fd;
+}
+
+UINT wifi_ref_watch_read(INT fd)
+{
+    UINT pending = 0;
+
+    if (fd < 0)
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock(&watch_lock);
+    for (int i = 0; i < WIFI_REF_MAX_WATCHERS; i++)
+    {
+        if (watchers[i].fd == fd)
+        {
+            uint64_t count;
+
+            /* Cleared together under the lock, so a later change writes the eventfd again */
+            (void)!read(fd, &count, sizeof(count));
+            pending = watchers[i].pending;
+            watchers[i].pending = 0;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&watch_lock);
+    return pending;
+}
+
+void wifi_ref_watch_close(INT fd)
+{
+    if (fd < 0)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&watch_lock);
+    for (int i = 0; i < WIFI_REF_MAX_WATCHERS; i++)
+    {
+        if (watchers[i].fd == fd)
+        {
+            close(fd);
+            watchers[i].fd = -1;
+            watchers[i].pending = 0;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&watch_lock);
+}
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
@@ -0,0 +1,873 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file wifi_scan_parse.c
+*
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wifi_ref_internal.h"
+#include "wifi_scan_parse.h"
+
+#define SP_BSSID_LEN 17
+#define SP_MAX_DIGITS 10
+
+/* Element IDs of the "ie=" blob */
+#define SP_IE_SUPP_RATES 1
+#define SP_IE_TIM 5
+#define SP_IE_BSS_LOAD 11
+#define SP_IE_HT_CAP 45
+#define SP_IE_EXT_SUPP_RATES 50
+#define SP_IE_HT_OPERATION 61
+#define SP_IE_VHT_CAP 191
+#define SP_IE_VHT_OPERATION 192
+#define SP_IE_EXTENSION 255
+#define SP_IE_EXT_HE_CAP 35
+
+/* Words of the flags field */
+#define SP_FLAG_WPA 0x0001
+#define SP_FLAG_WPA2 0x0002
+#define SP_FLAG_WEP 0x0004
+#define SP_FLAG_PSK 0x0008
+#define SP_FLAG_SAE 0x0010
+#define SP_FLAG_EAP 0x0020
+#define SP_FLAG_CCMP 0x0040
+#define SP_FLAG_TKIP 0x0080
+#define SP_FLAG_IBSS 0x0100
+
+/* Capability information bits */
+#define SP_CAP_IBSS 0x0002
+
+/* A piece of the text, not NUL terminated */
+typedef struct
+{
+    const CHAR *p;
+    size_t len;
+} sp_field_t;
+
+/* The fields of one BSS entry */
+typedef struct
+{
+    sp_field_t bssid;
+    sp_field_t freq;
+    sp_field_t beacon_int;
+    sp_field_t capabilities;
+    sp_field_t noise;
+    sp_field_t level;
+    sp_field_t flags;
+    sp_field_t ssid;
+    sp_field_t ie;
+} sp_bss_t;
+
+static BOOL sp_equals(sp_field_t field, const CHAR *s)
+{
+    size_t len = strlen(s);
+
+    return (field.len == len && memcmp(field.p, s, len) == 0);
+}
+
+static BOOL sp_uint(sp_field_t field, UINT *value)
+{
+    unsigned long long v = 0;
+
+    if (field.len == 0 || field.len > SP_MAX_DIGITS)
+    {
+        return FALSE;
+    }
+    for (size_t i = 0; i < field.len; i++)
+    {
+        if (field.p[i] < '0' || field.p[i] > '9')
+        {
+            return FALSE;
+        }
+        v = v * 10 + (unsigned long long)(field.p[i] - '0');
+    }
+    if (v > 0xFFFFFFFFULL)
+    {
+        return FALSE;
+    }
+    *value = (UINT)v;
+    return TRUE;
+}
+
+static BOOL sp_int(sp_field_t field, INT *value)
+{
+    BOOL negative = (field.len > 0 && field.p[0] == '-');
+    UINT v;
+
+    if (negative)
+    {
+        field.p++;
+        field.len--;
+    }
+    if (!sp_uint(field, &v) || v > 0x7FFFFFFFU)
+    {
+        return FALSE;
+    }
+    *value = negative ? -(INT)v : (INT)v;
+    return TRUE;
+}
+
+static int sp_hex_digit(CHAR c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+/* "0x0411" */
+static BOOL sp_hex(sp_field_t field, UINT *value)
+{
+    UINT v = 0;
+
+    if (field.len < 3 || field.len > 10 || field.p[0] != '0' || (field.p[1] != 'x' && field.p[1] != 'X'))
+    {
+        return FALSE;
+    }
+    for (size_t i = 2; i < field.len; i++)
+    {
+        int digit = sp_hex_digit(field.p[i]);
+
+        if (digit < 0)
+        {
+            return FALSE;
+        }
+        v = (v << 4) | (UINT)digit;
+    }
+    *value = v;
+    return TRUE;
+}
+
+/* "02:00:00:00:00:01" */
+static BOOL sp_bssid(sp_field_t field)
+{
+    if (field.len != SP_BSSID_LEN)
+    {
+        return FALSE;
+    }
+    for (size_t i = 0; i < SP_BSSID_LEN; i++)
+    {
+        if ((i % 3 == 2) ? (field.p[i] != ':') : (sp_hex_digit(field.p[i]) < 0))
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/* Copies a field into a NUL terminated string, truncated to size */
+static void sp_copy(CHAR *dst, size_t size, sp_field_t field)
+{
+    size_t len = (field.len < size) ? field.len : size - 1;
+
+    memcpy(dst, field.p, len);
+    dst[len] = '\0';
+}
+
+/* Like ref_copy(), without padding a destination that is already zeroed */
+static void sp_set(CHAR *dst, size_t size, const CHAR *src)
+{
+    size_t len = strlen(src);
+
+    if (len >= size)
+    {
+        len = size - 1;
+    }
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+/* Undoes the escaping of SSIDs by the supplicant (printf_encode), truncated to size */
+static void sp_unescape(CHAR *dst, size_t size, sp_field_t field)
+{
+    const CHAR *p = field.p;
+    const CHAR *end = field.p + field.len;
+    size_t len = 0;
+
+    while (p < end && len + 1 < size)
+    {
+        CHAR c = *p++;
+
+        if (c == '\\' && p < end)
+        {
+            c = *p++;
+            switch (c)
+            {
+                case 'n':
+                    c = '\n';
+                    break;
+                case 'r':
+                    c = '\r';
+                    break;
+                case 't':
+                    c = '\t';
+                    break;
+                case 'e':
+                    c = '\033';
+                    break;
+                case 'x':
+                    if (end - p >= 2 && sp_hex_digit(p[0]) >= 0 && sp_hex_digit(p[1]) >= 0)
+                    {
+                        c = (CHAR)((sp_hex_digit(p[0]) << 4) | sp_hex_digit(p[1]));
+                        p += 2;
+                    }
+                    break;
+                default:
+                    /* "\\" and "\"" */
+                    break;
+            }
+        }
+        dst[len++] = c;
+    }
+    dst[len] = '\0';
+}
+
+/* Returns the line at *pos and moves *pos past its newline */
+static sp_field_t sp_next_line(const CHAR *text, size_t len, size_t *pos)
+{
+    sp_field_t line = { text + *pos, len - *pos };
+    const CHAR *nl = memchr(line.p, '\n', line.len);
+
+    if (nl != NULL)
+    {
+        line.len = (size_t)(nl - line.p);
+        *pos += line.len + 1;
+    }
+    else
+    {
+        *pos = len;
+    }
+    if (line.len > 0 && line.p[line.len - 1] == '\r')
+    {
+        line.len--;
+    }
+    return line;
+}
+
+static BOOL sp_band_matches(UINT freq, const wifi_scan_filter_t *filter)
+{
+    if (filter == NULL)
+    {
+        return TRUE;
+    }
+    switch (filter->band)
+    {
+        case WIFI_HAL_FREQ_BAND_24GHZ:
+            return (freq < 3000);
+        case WIFI_HAL_FREQ_BAND_5GHZ:
+            return (freq >= 3000);
+        default:
+            return TRUE;
+    }
+}
+
+/* Checks the SSID against the filter, unescaping it into ssid when asked to or to compare it */
+static BOOL sp_ssid_matches(sp_field_t field, const wifi_scan_filter_t *filter, CHAR *ssid, size_t size, BOOL fill)
+{
+    if (filter == NULL || filter->ssid == NULL)
+    {
+        if (fill)
+        {
+            sp_unescape(ssid, size, field);
+        }
+        return TRUE;
+    }
+    sp_unescape(ssid, size, field);
+    return (strcmp(ssid, filter->ssid) == 0);
+}
+
+static UINT sp_flag_word(const CHAR *word, size_t len)
+{
+    /* Fixed length compares, which the compiler turns into loads */
+    if (len == 3)
+    {
+        if (memcmp(word, "PSK", 3) == 0)
+        {
+            return SP_FLAG_PSK;
+        }
+        if (memcmp(word, "WPA", 3) == 0)
+        {
+            return SP_FLAG_WPA;
+        }
+        if (memcmp(word, "RSN", 3) == 0)
+        {
+            return SP_FLAG_WPA2;
+        }
+        if (memcmp(word, "SAE", 3) == 0)
+        {
+            return SP_FLAG_SAE;
+        }
+        if (memcmp(word, "EAP", 3) == 0)
+        {
+            return SP_FLAG_EAP;
+        }
+        if (memcmp(word, "WEP", 3) == 0)
+        {
+            return SP_FLAG_WEP;
+        }
+    }
+    else if (len == 4)
+    {
+        if (memcmp(word, "CCMP", 4) == 0)
+        {
+            return SP_FLAG_CCMP;
+        }
+        if (memcmp(word, "WPA2", 4) == 0)
+        {
+            return SP_FLAG_WPA2;
+        }
+        if (memcmp(word, "TKIP", 4) == 0)
+        {
+            return SP_FLAG_TKIP;
+        }
+        if (memcmp(word, "IBSS", 4) == 0)
+        {
+            return SP_FLAG_IBSS;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Reads flags such as "[WPA-PSK-CCMP+TKIP][WPA2-PSK-CCMP+TKIP][ESS]" in one
+ * pass, word by word, rather than searching the field once per flag.
+ */
+static UINT sp_flags(sp_field_t flags)
+{
+    UINT found = 0;
+    size_t start = 0;
+
+    for (size_t i = 0; i <= flags.len; i++)
+    {
+        if (i < flags.len && flags.p[i] != '[' && flags.p[i] != ']' && flags.p[i] != '-' && flags.p[i] != '+')
+        {
+            continue;
+        }
+        found |= sp_flag_word(flags.p + start, i - start);
+        start = i + 1;
+    }
+    return found;
+}
+
+/* Security, encryption and mode from the flags */
+static void sp_fill_flags(wifi_neighbor_ap_t *ap, sp_field_t field)
+{
+    UINT flags = sp_flags(field);
+    BOOL mixed = ((flags & SP_FLAG_WPA) && (flags & SP_FLAG_WPA2));
+    BOOL ccmp = ((flags & SP_FLAG_CCMP) != 0);
+    BOOL tkip = ((flags & SP_FLAG_TKIP) != 0);
+    const CHAR *security = "None";
+
+    if (flags & SP_FLAG_WEP)
+    {
+        security = "WEP";
+    }
+    else if (flags & SP_FLAG_SAE)
+    {
+        security = "WPA3-Personal";
+    }
+    else if (flags & SP_FLAG_EAP)
+    {
+        security = mixed ? "WPA-WPA2-Enterprise" : (flags & SP_FLAG_WPA2) ? "WPA2-Enterprise" : "WPA-Enterprise";
+    }
+    else if (flags & SP_FLAG_PSK)
+    {
+        security = mixed ? "WPA-WPA2-Personal" : (flags & SP_FLAG_WPA2) ? "WPA2-Personal" : "WPA-Personal";
+    }
+    sp_set(ap->ap_SecurityModeEnabled, sizeof(ap->ap_SecurityModeEnabled), security);
+    sp_set(ap->ap_EncryptionMode, sizeof(ap->ap_EncryptionMode),
+             (ccmp && tkip) ? "AES+TKIP" : ccmp ? "AES" : tkip ? "TKIP" : "None");
+    sp_set(ap->ap_Mode, sizeof(ap->ap_Mode), (flags & SP_FLAG_IBSS) ? "AdHoc" : "Infrastructure");
+}
+
+/* The fields every format has */
+static void sp_fill_common(wifi_neighbor_ap_t *ap, sp_field_t bssid, UINT freq, INT level, sp_field_t flags)
+{
+    sp_copy(ap->ap_BSSID, sizeof(ap->ap_BSSID), bssid);
+    ap->ap_Channel = ref_freq_channel(freq);
+    ap->ap_SignalStrength = level;
+    sp_set(ap->ap_OperatingFrequencyBand, sizeof(ap->ap_OperatingFrequencyBand), ref_freq_band(freq));
+    sp_fill_flags(ap, flags);
+}
+
+/*
+ * Splits "bssid\tfreq\tlevel\tflags\tssid" and, with fill, decodes it into ap
+ * when the entry matches. ap is scratch space even when the line is rejected.
+ */
+static BOOL sp_results_line(sp_field_t line, const wifi_scan_filter_t *filter, wifi_neighbor_ap_t *ap, BOOL fill)
+{
+    sp_field_t fields[5];
+    sp_field_t rest = line;
+    UINT freq;
+    INT level;
+    int n = 0;
+
+    while (n < 4)
+    {
+        const CHAR *tab = memchr(rest.p, '\t', rest.len);
+
+        if (tab == NULL)
+        {
+            break;
+        }
+        fields[n].p = rest.p;
+        fields[n].len = (size_t)(tab - rest.p);
+        rest.len -= fields[n].len + 1;
+        rest.p = tab + 1;
+        n++;
+    }
+    if (n < 3)
+    {
+        return FALSE;
+    }
+    /* Hidden networks have no SSID field */
+    fields[n] = rest;
+    if (n == 3)
+    {
+        fields[4].p = rest.p + rest.len;
+        fields[4].len = 0;
+    }
+
+    if (!sp_bssid(fields[0]) || !sp_uint(fields[1], &freq) || !sp_int(fields[2], &level) ||
+        !sp_band_matches(freq, filter))
+    {
+        return FALSE;
+    }
+    if (fill)
+    {
+        memset(ap, 0, sizeof(*ap));
+    }
+    if (!sp_ssid_matches(fields[4], filter, ap->ap_SSID, sizeof(ap->ap_SSID), fill))
+    {
+        return FALSE;
+    }
+    if (fill)
+    {
+        sp_fill_common(ap, fields[0], freq, level, fields[3]);
+    }
+    return TRUE;
+}
+
+INT wifi_scan_parse_results(const CHAR *text, size_t len, const wifi_scan_filter_t *filter, wifi_neighbor_ap_t **aps,
+                            UINT *count)
+{
+    wifi_neighbor_ap_t scratch;
+    size_t pos = 0;
+    UINT matches = 0;
+
+    if (text == NULL || aps == NULL || count == NULL)
+    {
+        return RETURN_ERR;
+    }
+    *aps = NULL;
+    *count = 0;
+
+    /* Count the entries to keep, then decode them into an array of exactly that size */
+    while (pos < len)
+    {
+        if (sp_results_line(sp_next_line(text, len, &pos), filter, &scratch, FALSE))
+        {
+            matches++;
+        }
+    }
+    if (matches == 0)
+    {
+        return RETURN_OK;
+    }
+    *aps = malloc(matches * sizeof(wifi_neighbor_ap_t));
+    if (*aps == NULL)
+    {
+        return RETURN_ERR;
+    }
+    pos = 0;
+    while (pos < len && *count < matches)
+    {
+        if (sp_results_line(sp_next_line(text, len, &pos), filter, &(*aps)[*count], TRUE))
+        {
+            (*count)++;
+        }
+    }
+    return RETURN_OK;
+}
+
+/* Appends a rate in units of 500 kb/s to a comma separated list of Mb/s */
+static void sp_append_rate(CHAR *list, size_t size, unsigned rate)
+{
+    size_t len = strlen(list);
+
+    snprintf(list + len, size - len, "%s%u%s", (len > 0) ? "," : "", rate / 2, (rate % 2) ? ".5" : "");
+}
+
+static void sp_append_standard(CHAR *list, size_t size, const CHAR *standard)
+{
+    size_t len = strlen(list);
+
+    snprintf(list + len, size - len, "%s%s", (len > 0) ? "," : "", standard);
+}
+
+/* Rates, standards, bandwidth, DTIM period and utilisation from the hex encoded information elements */
+static void sp_fill_ies(wifi_neighbor_ap_t *ap, sp_field_t ie, UINT freq)
+{
+    unsigned char body[255];
+    BOOL cck = FALSE;
+    BOOL ofdm = FALSE;
+    BOOL ht = FALSE;
+    BOOL vht = FALSE;
+    BOOL he = FALSE;
+    const CHAR *width = NULL;
+    size_t pos = 0;
+
+    if (ie.len == 0)
+    {
+        return;
+    }
+    while (pos + 4 <= ie.len)
+    {
+        int id_hi = sp_hex_digit(ie.p[pos]);
+        int id_lo = sp_hex_digit(ie.p[pos + 1]);
+        int len_hi = sp_hex_digit(ie.p[pos + 2]);
+        int len_lo = sp_hex_digit(ie.p[pos + 3]);
+        unsigned id;
+        size_t body_len;
+
+        if (id_hi < 0 || id_lo < 0 || len_hi < 0 || len_lo < 0)
+        {
+            break;
+        }
+        id = (unsigned)((id_hi << 4) | id_lo);
+        body_len = (size_t)((len_hi << 4) | len_lo);
+        pos += 4;
+        if (pos + body_len * 2 > ie.len)
+        {
+            break;
+        }
+        for (size_t i = 0; i < body_len; i++)
+        {
+            int hi = sp_hex_digit(ie.p[pos + i * 2]);
+            int lo = sp_hex_digit(ie.p[pos + i * 2 + 1]);
+
+            if (hi < 0 || lo < 0)
+            {
+                return;
+            }
+            body[i] = (unsigned char)((hi << 4) | lo);
+        }
+        pos += body_len * 2;
+
+        switch (id)
+        {
+            case SP_IE_SUPP_RATES:
+            case SP_IE_EXT_SUPP_RATES:
+                for (size_t i = 0; i < body_len; i++)
+                {
+                    unsigned rate = body[i] & 0x7F;
+
+                    if (rate == 2 || rate == 4 || rate == 11 || rate == 22)
+                    {
+                        cck = TRUE;
+                    }
+                    else
+                    {
+                        ofdm = TRUE;
+                    }
+                    sp_append_rate(ap->ap_SupportedDataTransferRates, sizeof(ap->ap_SupportedDataTransferRates), rate);
+                    if (body[i] & 0x80)
+                    {
+                        sp_append_rate(ap->ap_BasicDataTransferRates, sizeof(ap->ap_BasicDataTransferRates), rate);
+                    }
+                }
+                break;
+            case SP_IE_TIM:
+                if (body_len >= 2)
+                {
+                    ap->ap_DTIMPeriod = body[1];
+                }
+                break;
+            case SP_IE_BSS_LOAD:
+                if (body_len >= 3)
+                {
+                    snprintf(ap->ap_ChannelUtilization, sizeof(ap->ap_ChannelUtilization), "%u", body[2] * 100U / 255U);
+                }
+                break;
+            case SP_IE_HT_CAP:
+                ht = TRUE;
+                break;
+            case SP_IE_HT_OPERATION:
+                /* Secondary channel offset */
+                if (body_len >= 2 && width == NULL)
+                {
+                    width = (body[1] & 0x03) ? "40MHz" : "20MHz";
+                }
+                break;
+            case SP_IE_VHT_CAP:
+                vht = TRUE;
+                break;
+            case SP_IE_VHT_OPERATION:
+                /* Channel width, then the two centre frequency segments */
+                if (body_len >= 3)
+                {
+                    if (body[0] == 1)
+                    {
+                        width = (body[2] != 0) ? "160MHz" : "80MHz";
+                    }
+                    else if (body[0] == 2)
+                    {
+                        width = "160MHz";
+                    }
+                    else if (body[0] == 3)
+                    {
+                        width = "80+80MHz";
+                    }
+                }
+                break;
+            case SP_IE_EXTENSION:
+                if (body_len >= 1 && body[0] == SP_IE_EXT_HE_CAP)
+                {
+                    he = TRUE;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (freq < 3000)
+    {
+        if (cck)
+        {
+            sp_append_standard(ap->ap_SupportedStandards, sizeof(ap->ap_SupportedStandards), "b");
+        }
+        if (ofdm)
+        {
+            sp_append_standard(ap->ap_SupportedStandards, sizeof(ap->ap_SupportedStandards), "g");
+        }
+    }
+    else
+    {
+        sp_append_standard(ap->ap_SupportedStandards, sizeof(ap->ap_SupportedStandards), "a");
+    }
+    if (ht)
+    {
+        sp_append_standard(ap->ap_SupportedStandards, sizeof(ap->ap_SupportedStandards), "n");
+    }
+    if (vht && freq >= 3000)
+    {
+        sp_append_standard(ap->ap_SupportedStandards, sizeof(ap->ap_SupportedStandards), "ac");
+    }
+    if (he)
+    {
+        sp_append_standard(ap->ap_SupportedStandards, sizeof(ap->ap_SupportedStandards), "ax");
+    }
+    /* The operating standard is the newest one supported */
+    {
+        const CHAR *last = strrchr(ap->ap_SupportedStandards, ',');
+
+        sp_set(ap->ap_OperatingStandards, sizeof(ap->ap_OperatingStandards),
+                 (last != NULL) ? last + 1 : ap->ap_SupportedStandards);
+    }
+    if (width != NULL)
+    {
+        sp_set(ap->ap_OperatingChannelBandwidth, sizeof(ap->ap_OperatingChannelBandwidth), width);
+    }
+}
+
+/*
+ * Collects the fields of the BSS entry at *pos and moves *pos to the next
+ * entry. Returns FALSE once the text is exhausted.
+ */
+static BOOL sp_next_bss(const CHAR *text, size_t len, size_t *pos, sp_bss_t *bss)
+{
+    BOOL started = FALSE;
+
+    memset(bss, 0, sizeof(*bss));
+    while (*pos < len)
+    {
+        size_t line_start = *pos;
+        sp_field_t line = sp_next_line(text, len, pos);
+        const CHAR *eq;
+        sp_field_t key;
+        sp_field_t value;
+
+        if (line.len >= 4 && memcmp(line.p, "====", 4) == 0)
+        {
+            if (started)
+            {
+                return TRUE;
+            }
+            continue;
+        }
+        eq = memchr(line.p, '=', line.len);
+        if (eq == NULL)
+        {
+            continue;
+        }
+        key.p = line.p;
+        key.len = (size_t)(eq - line.p);
+        value.p = eq + 1;
+        value.len = line.len - key.len - 1;
+
+        /* Without separators, "id=" or a second "bssid=" starts the next entry */
+        if (started && (sp_equals(key, "id") || (sp_equals(key, "bssid") && bss->bssid.p != NULL)))
+        {
+            *pos = line_start;
+            return TRUE;
+        }
+        started = TRUE;
+        if (sp_equals(key, "bssid"))
+        {
+            bss->bssid = value;
+        }
+        else if (sp_equals(key, "freq"))
+        {
+            bss->freq = value;
+        }
+        else if (sp_equals(key, "beacon_int"))
+        {
+            bss->beacon_int = value;
+        }
+        else if (sp_equals(key, "capabilities"))
+        {
+            bss->capabilities = value;
+        }
+        else if (sp_equals(key, "noise"))
+        {
+            bss->noise = value;
+        }
+        else if (sp_equals(key, "level"))
+        {
+            bss->level = value;
+        }
+        else if (sp_equals(key, "flags"))
+        {
+            bss->flags = value;
+        }
+        else if (sp_equals(key, "ssid"))
+        {
+            bss->ssid = value;
+        }
+        else if (sp_equals(key, "ie"))
+        {
+            bss->ie = value;
+        }
+    }
+    return started;
+}
+
+/* With fill, decodes a BSS entry into ap when it matches. ap is scratch space even when the entry is rejected. */
+static BOOL sp_bss_entry(const sp_bss_t *bss, const wifi_scan_filter_t *filter, wifi_neighbor_ap_t *ap, BOOL fill)
+{
+    UINT freq;
+    UINT value;
+    INT level = 0;
+    INT noise;
+
+    if (!sp_bssid(bss->bssid) || !sp_uint(bss->freq, &freq) || !sp_band_matches(freq, filter))
+    {
+        return FALSE;
+    }
+    if (fill)
+    {
+        memset(ap, 0, sizeof(*ap));
+    }
+    if (!sp_ssid_matches(bss->ssid, filter, ap->ap_SSID, sizeof(ap->ap_SSID), fill))
+    {
+        return FALSE;
+    }
+    if (!fill)
+    {
+        return TRUE;
+    }
+    sp_int(bss->level, &level);
+    sp_fill_common(ap, bss->bssid, freq, level, bss->flags);
+    if (bss->flags.len == 0 && sp_hex(bss->capabilities, &value) && (value & SP_CAP_IBSS))
+    {
+        sp_set(ap->ap_Mode, sizeof(ap->ap_Mode), "AdHoc");
+    }
+    if (sp_uint(bss->beacon_int, &value))
+    {
+        ap->ap_BeaconPeriod = value;
+    }
+    if (sp_int(bss->noise, &noise))
+    {
+        ap->ap_Noise = noise;
+    }
+    sp_fill_ies(ap, bss->ie, freq);
+    return TRUE;
+}
+
+INT wifi_scan_parse_bss(const CHAR *text, size_t len, const wifi_scan_filter_t *filter, wifi_neighbor_ap_t **aps,
+                        UINT *count)
+{
+    wifi_neighbor_ap_t scratch;
+    sp_bss_t bss;
+    size_t pos = 0;
+    UINT matches = 0;
+
+    if (text == NULL || aps == NULL || count == NULL)
+    {
+        return RETURN_ERR;
+    }
+    *aps = NULL;
+    *count = 0;
+
+    while (sp_next_bss(text, len, &pos, &bss))
+    {
+        if (sp_bss_entry(&bss, filter, &scratch, FALSE))
+        {
+            matches++;
+        }
+    }
+    if (matches == 0)
+    {
+        return RETURN_OK;
+    }
+    *aps = malloc(matches * sizeof(wifi_neighbor_ap_t));
+    if (*aps == NULL)
+    {
+        return RETURN_ERR;
+    }
+    pos = 0;
+    while (*count < matches && sp_next_bss(text, len, &pos, &bss))
+    {
+        if (sp_bss_entry(&bss, filter, &(*aps)[*count], TRUE))
+        {
+            (*count)++;
+        }
+    }
+    return RETURN_OK;
+}
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
@@ -0,0 +1,116 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_REFERENCE RDK-V WiFi Reference HAL
+ * @{
+ */
+
+/**
+* @file mock_supplicant.c
+*
+* Runs the mock supplicant as a daemon, so the reference HAL can be exercised
+* from another process, e.g. hal_bench linked against the reference library:
+*
+*     mock_supplicant -p /tmp/wifi_mock/wlan0 &
+*     WIFI_CTRL_DIR=/tmp/wifi_mock hal_bench latency
+*/
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "wifi_mock_supplicant.h"
+
+#define MOCK_DEFAULT_PATH "/tmp/wifi_mock/wlan0"
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    stop_requested = 1;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [-p <path>]\n\n"
+            "  -p <path>  control socket to serve (default %s)\n",
+            prog, MOCK_DEFAULT_PATH);
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = MOCK_DEFAULT_PATH;
+    char dir[108];
+    char *slash;
+    wifi_mock_supplicant_stats_t stats;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "p:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'p':
+                path = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+
+    /* The supplicant creates its control directory */
+    snprintf(dir, sizeof(dir), "%s", path);
+    slash = strrchr(dir, '/');
+    if (slash != NULL && slash != dir)
+    {
+        *slash = '\0';
+        if (mkdir(dir, 0770) != 0 && errno != EEXIST)
+        {
+            fprintf(stderr, "Cannot create %s: %s\n", dir, strerror(errno));
+            return 1;
+        }
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+    if (wifi_mock_supplicant_start(path) != RETURN_OK)
+    {
+        fprintf(stderr, "Cannot serve %s\n", path);
+        return 1;
+    }
+    printf("Serving %s\n", path);
+    fflush(stdout);
+
+    while (!stop_requested)
+    {
+        pause();
+    }
+
+    wifi_mock_supplicant_stats(&stats);
+    wifi_mock_supplicant_stop();
+    printf("%llu requests from %u clients, %llu events\n", (unsigned long long)stats.requests, stats.clients,
+           (unsigned long long)stats.events);
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_REFERENCE
@@ -0,0 +1,462 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_SIMULATOR RDK-V WiFi HAL Simulator
+ * @{
+ */
+
+/**
+* @file wifi_common_hal.c
+*
+* wifi_common_hal.h on top of the simulator core. Argument and init-state
+* checks follow the L1 expectations, everything else is delegated.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wifi_common_hal.h"
+#include "wifi_sim.h"
+
+#define SIM_HAL_VERSION "2.0.0-sim"
+
+/* Fetches the radio attributes once the arguments and init state have been checked */
+static BOOL hal_radio(INT radioIndex, const void *output, wifi_sim_radio_t *radio)
+{
+    if (!wifi_sim_valid_radio(radioIndex) || output == NULL || !wifi_sim_initialised())
+    {
+        return FALSE;
+    }
+    wifi_sim_get_radio(radio);
+    return TRUE;
+}
+
+INT wifi_getHalVersion(CHAR* output_string)
+{
+    if (output_string == NULL)
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, SIM_HAL_VERSION);
+    return RETURN_OK;
+}
+
+INT wifi_init(void)
+{
+    return wifi_sim_init(NULL);
+}
+
+INT wifi_initWithConfig(wifi_halConfig_t* conf)
+{
+    if (conf == NULL)
+    {
+        return RETURN_ERR;
+    }
+    return wifi_sim_init(conf->wlan_Interface);
+}
+
+INT wifi_down(void)
+{
+    return wifi_sim_down();
+}
+
+INT wifi_uninit(void)
+{
+    return wifi_sim_uninit();
+}
+
+void wifi_getStats(INT radioIndex, wifi_sta_stats_t* wifi_sta_stats)
+{
+    (void)wifi_sim_getStats(radioIndex, wifi_sta_stats);
+}
+
+INT wifi_getRadioNumberOfEntries(ULONG* output)
+{
+    if (output == NULL || !wifi_sim_initialised())
+    {
+        return RETURN_ERR;
+    }
+    *output = WIFI_SIM_RADIOS;
+    return RETURN_OK;
+}
+
+INT wifi_getSSIDNumberOfEntries(ULONG* output)
+{
+    if (output == NULL || !wifi_sim_initialised())
+    {
+        return RETURN_ERR;
+    }
+    *output = WIFI_SIM_SSIDS;
+    return RETURN_OK;
+}
+
+INT wifi_getRadioEnable(INT radioIndex, BOOL* output_bool)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_bool, &radio))
+    {
+        return RETURN_ERR;
+    }
+    *output_bool = radio.enable;
+    return RETURN_OK;
+}
+
+INT wifi_getRadioStatus(INT radioIndex, CHAR* output_string)
+{
+    return wifi_sim_getRadioStatus(radioIndex, output_string);
+}
+
+INT wifi_getRadioIfName(INT radioIndex, CHAR* output_string)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_string, &radio))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, radio.if_name);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioMaxBitRate(INT radioIndex, CHAR* output_string)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_string, &radio))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, radio.max_bit_rate);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioSupportedFrequencyBands(INT radioIndex, CHAR* output_string)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_string, &radio))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, radio.supported_bands);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioOperatingFrequencyBand(INT radioIndex, CHAR* output_string)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_string, &radio))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, radio.operating_band);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioSupportedStandards(INT radioIndex, CHAR* output_string)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_string, &radio))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, radio.supported_standards);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioStandard(INT radioIndex, CHAR* output_string, BOOL* gOnly, BOOL* nOnly, BOOL* acOnly)
+{
+    wifi_sim_radio_t radio;
+
+    if (gOnly == NULL || nOnly == NULL || acOnly == NULL || !hal_radio(radioIndex, output_string, &radio))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, radio.standard);
+    *gOnly = (strcmp(radio.standard, "g") == 0);
+    *nOnly = (strcmp(radio.standard, "n") == 0);
+    *acOnly = (strcmp(radio.standard, "ac") == 0);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioPossibleChannels(INT radioIndex, CHAR* output_string)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_string, &radio))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, radio.possible_channels);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioChannelsInUse(INT radioIndex, CHAR* output_string)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_string, &radio))
+    {
+        return RETURN_ERR;
+    }
+    sprintf(output_string, "%lu", radio.channel);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioChannel(INT radioIndex, ULONG* output_ulong)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_ulong, &radio))
+    {
+        return RETURN_ERR;
+    }
+    *output_ulong = radio.channel;
+    return RETURN_OK;
+}
+
+INT wifi_getRadioAutoChannelSupported(INT radioIndex, BOOL* output_bool)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_bool, &radio))
+    {
+        return RETURN_ERR;
+    }
+    *output_bool = radio.auto_channel_supported;
+    return RETURN_OK;
+}
+
+INT wifi_getRadioAutoChannelEnable(INT radioIndex, BOOL* output_bool)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_bool, &radio))
+    {
+        return RETURN_ERR;
+    }
+    *output_bool = radio.auto_channel_enable;
+    return RETURN_OK;
+}
+
+INT wifi_getRadioAutoChannelRefreshPeriod(INT radioIndex, ULONG* output_ulong)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_ulong, &radio))
+    {
+        return RETURN_ERR;
+    }
+    *output_ulong = radio.auto_channel_refresh_period;
+    return RETURN_OK;
+}
+
+INT wifi_getRadioGuardInterval(INT radioIndex, CHAR* output_string)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_string, &radio))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, radio.guard_interval);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioOperatingChannelBandwidth(INT radioIndex, CHAR* output_string)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_string, &radio))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, radio.bandwidth);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioExtChannel(INT radioIndex, CHAR* output_string)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_string, &radio))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, radio.ext_channel);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioMCS(INT radioIndex, INT* output_INT)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_INT, &radio))
+    {
+        return RETURN_ERR;
+    }
+    *output_INT = radio.mcs;
+    return RETURN_OK;
+}
+
+INT wifi_getRadioTransmitPowerSupported(INT radioIndex, CHAR* output_list)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_list, &radio))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_list, radio.transmit_power_supported);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioTransmitPower(INT radioIndex, INT* output_INT)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_INT, &radio))
+    {
+        return RETURN_ERR;
+    }
+    *output_INT = radio.transmit_power;
+    return RETURN_OK;
+}
+
+INT wifi_getRadioIEEE80211hSupported(INT radioIndex, BOOL* Supported)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, Supported, &radio))
+    {
+        return RETURN_ERR;
+    }
+    *Supported = radio.ieee80211h_supported;
+    return RETURN_OK;
+}
+
+INT wifi_getRadioIEEE80211hEnabled(INT radioIndex, BOOL* enable)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, enable, &radio))
+    {
+        return RETURN_ERR;
+    }
+    *enable = radio.ieee80211h_enabled;
+    return RETURN_OK;
+}
+
+INT wifi_getRegulatoryDomain(INT radioIndex, CHAR* output_string)
+{
+    wifi_sim_radio_t radio;
+
+    if (!hal_radio(radioIndex, output_string, &radio))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, radio.regulatory_domain);
+    return RETURN_OK;
+}
+
+INT wifi_getRadioTrafficStats(INT radioIndex, wifi_radioTrafficStats_t* output_struct)
+{
+    return wifi_sim_getRadioTrafficStats(radioIndex, output_struct);
+}
+
+/* The SSID getters describe the network the station is associated with */
+static BOOL hal_ssid_stats(INT ssidIndex, const void *output, wifi_sta_stats_t *sta)
+{
+    if (!wifi_sim_valid_ssid(ssidIndex) || output == NULL)
+    {
+        return FALSE;
+    }
+    return (wifi_sim_getStats(1, sta) == RETURN_OK);
+}
+
+INT wifi_getSSIDName(INT ssidIndex, CHAR* output_string)
+{
+    wifi_sta_stats_t sta;
+
+    if (!hal_ssid_stats(ssidIndex, output_string, &sta))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, sta.sta_SSID);
+    return RETURN_OK;
+}
+
+INT wifi_getBaseBSSID(INT ssidIndex, CHAR* output_string)
+{
+    wifi_sta_stats_t sta;
+
+    if (!hal_ssid_stats(ssidIndex, output_string, &sta))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, sta.sta_BSSID);
+    return RETURN_OK;
+}
+
+INT wifi_getSSIDMACAddress(INT ssidIndex, CHAR* output_string)
+{
+    wifi_sim_radio_t radio;
+
+    if (!wifi_sim_valid_ssid(ssidIndex) || !hal_radio(1, output_string, &radio))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(output_string, radio.ssid_mac);
+    return RETURN_OK;
+}
+
+INT wifi_getSSIDTrafficStats(INT ssidIndex, wifi_ssidTrafficStats_t* output_struct)
+{
+    return wifi_sim_getSSIDTrafficStats(ssidIndex, output_struct);
+}
+
+INT wifi_getNeighboringWiFiDiagnosticResult(INT radioIndex, wifi_neighbor_ap_t** neighbor_ap_array, UINT* output_array_size)
+{
+    return wifi_sim_getNeighboringWiFiDiagnosticResult(radioIndex, neighbor_ap_array, output_array_size);
+}
+
+INT wifi_getSpecificSSIDInfo(const char* SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t** ap_array, UINT* output_array_size)
+{
+    return wifi_sim_getSpecificSSIDInfo(SSID, band, ap_array, output_array_size);
+}
+
+INT wifi_setRadioScanningFreqList(INT radioIndex, const CHAR* freqList)
+{
+    return wifi_sim_setRadioScanningFreqList(radioIndex, freqList);
+}
+
+INT wifi_getDualBandSupport(void)
+{
+    return 1;
+}
+
+INT wifi_waitForScanResults(void)
+{
+    return wifi_sim_waitForScanResults();
+}
+
+/** @} */ // End of RDKV_WIFI_SIMULATOR
@@ -0,0 +1,541 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_SIMULATOR RDK-V WiFi HAL Simulator
+ * @{
+ * @parblock
+ *
+ * ### Simulated WiFi HAL :
+ *
+ * A station with one radio and one SSID, a configurable population of access
+ * points, timed scans, connections and a WPS registrar. Everything that takes
+ * time on real hardware completes asynchronously after a modelled delay, so
+ * the benchmark suites see realistic call and callback timing on any host.
+ *
+ * The core in simulator/src is linked into every test binary and driven
+ * directly by the L2 suites through the wifi_sim_* functions. The HAL front
+ * end in simulator/hal maps the HAL API onto the core and is selected with
+ * HAL_BACKEND=simulator.
+ *
+ * @endparblock
+ */
+
+/**
+* @file wifi_sim.h
+*
+*/
+
+#ifndef __WIFI_SIM_H__
+#define __WIFI_SIM_H__
+
+#include <stdint.h>
+#include "wifi_common_hal.h"
+#include "wifi_client_hal.h"
+
+/**
+ * @brief Number of radios and SSIDs of the simulated station. Indexes start at 1.
+ */
+#define WIFI_SIM_RADIOS 1
+#define WIFI_SIM_SSIDS 1
+
+/**
+ * @brief Largest access point population
+ */
+#define WIFI_SIM_MAX_APS 64
+
+/**
+ * @brief Radio attributes returned by the radio getters
+ */
+typedef struct
+{
+    BOOL enable;
+    CHAR status[16];
+    CHAR if_name[32];
+    CHAR max_bit_rate[32];
+    CHAR supported_bands[32];
+    CHAR operating_band[16];
+    CHAR supported_standards[32];
+    CHAR standard[16];
+    CHAR possible_channels[128];
+    ULONG channel;
+    BOOL auto_channel_supported;
+    BOOL auto_channel_enable;
+    ULONG auto_channel_refresh_period;
+    CHAR guard_interval[16];
+    CHAR bandwidth[16];
+    CHAR ext_channel[32];
+    INT mcs;
+    CHAR transmit_power_supported[64];
+    INT transmit_power;
+    BOOL ieee80211h_supported;
+    BOOL ieee80211h_enabled;
+    CHAR regulatory_domain[8];
+    CHAR ssid_mac[18];
+} wifi_sim_radio_t;
+
+/**
+ * @brief Modelled durations of asynchronous operations
+ */
+typedef struct
+{
+    UINT handshake_ms;     /*!< wifi_connectEndpoint() to WIFI_HAL_CONNECTED */
+    UINT disconnect_ms;    /*!< wifi_disconnectEndpoint() to WIFI_HAL_DISCONNECTED */
+    UINT scan_dwell_ms;    /*!< Time spent on each channel of a scan, channels are those given to wifi_setRadioScanningFreqList() */
+    UINT cold_init_ms;     /*!< First wifi_init() after wifi_sim_reset(), i.e. after process start */
+    UINT warm_init_ms;     /*!< Every later wifi_init() */
+    UINT radio_up_ms;      /*!< wifi_init() returned to wifi_getRadioStatus() succeeding */
+    UINT first_scan_ms;    /*!< wifi_init() returned to the first neighbour results */
+} wifi_sim_timing_t;
+
+/**
+ * @brief WPS registrar of the access point the station pairs with
+ */
+typedef struct
+{
+    BOOL present;                /*!< FALSE models an access point that is not in WPS mode */
+    UINT pbc_response_ms;        /*!< Push button pressed to credential delivered */
+    UINT pin_response_ms;        /*!< PIN entered to credential delivered or rejected */
+    UINT walk_time_ms;           /*!< Session timeout without a registrar, 120 s in the WPS specification */
+    UINT cancel_ms;              /*!< wifi_cancelWpsPairing() to the radio being free again */
+    CHAR pin[9];                 /*!< PIN the registrar expects */
+    CHAR ssid[64];               /*!< Credential handed over */
+    CHAR passphrase[64];         /*!< Credential handed over */
+} wifi_sim_registrar_t;
+
+/**
+ * @brief State of the WPS session
+ */
+typedef enum
+{
+    WIFI_SIM_WPS_IDLE = 0,   /*!< No session */
+    WIFI_SIM_WPS_ACTIVE,     /*!< Session running, radio busy */
+    WIFI_SIM_WPS_CANCELLING  /*!< Cancel requested, radio still busy */
+} wifi_sim_wps_state_t;
+
+/**
+ * @brief Largest number of waypoints of a mobility path
+ */
+#define WIFI_SIM_MAX_WAYPOINTS 32
+
+/**
+ * @brief Position of the station at a point of model time
+ *
+ * The station moves in a straight line between two waypoints and stays at
+ * the last one.
+ */
+typedef struct
+{
+    UINT t_ms;                   /*!< Model time, increasing along the path */
+    double x_m;
+    double y_m;
+} wifi_sim_waypoint_t;
+
+/**
+ * @brief Placement of an access point of the population in the RF model
+ */
+typedef struct
+{
+    CHAR bssid[18];              /*!< ap_BSSID of the access point, placements without one are ignored */
+    double x_m;
+    double y_m;
+    INT tx_power_dbm;            /*!< EIRP */
+    UINT utilization;            /*!< Mean channel utilisation in percent */
+} wifi_sim_rf_ap_t;
+
+/**
+ * @brief RF environment
+ *
+ * Every tick moves the station along the path and sets the signal, noise
+ * and channel utilisation of each placed access point from log-distance path
+ * loss and shadow fading. The fading is correlated from tick to tick and
+ * drawn from a generator seeded with seed, so a seed replays the same values.
+ * The link takes the signal and noise of its access point and a PHY rate from
+ * their difference. Access points below sensitivity_dbm drop out of the scan
+ * results and a link on one is lost.
+ */
+typedef struct
+{
+    BOOL enable;                 /*!< FALSE leaves the configured signal levels alone */
+    BOOL realtime;               /*!< Tick on the event loop rather than in wifi_sim_rf_step() */
+    UINT tick_ms;                /*!< Model time between two ticks */
+    UINT seed;
+    double ref_loss_db;          /*!< Path loss at 1 m */
+    double path_loss_exponent;   /*!< 2 in free space, 3 to 4 indoors */
+    double fading_sigma_db;      /*!< Standard deviation of the shadow fading */
+    double fading_correlation;   /*!< Correlation of the fading between two ticks, 0 to below 1 */
+    INT noise_floor_dbm;
+    double noise_sigma_db;
+    double utilization_sigma;    /*!< Standard deviation of the channel utilisation in percent */
+    INT sensitivity_dbm;
+    UINT roam_second_ms;         /*!< Length of a second of the wifi_roamingCtrl_t times, below 1000 compresses them */
+    UINT waypoint_count;
+    wifi_sim_waypoint_t path[WIFI_SIM_MAX_WAYPOINTS];
+    UINT ap_count;
+    wifi_sim_rf_ap_t aps[WIFI_SIM_MAX_APS];
+} wifi_sim_rf_t;
+
+/**
+ * @brief Roaming of the station, evaluated on every tick of the RF model
+ *
+ * With roamingEnable set in wifi_sim_setRoamingControl(), a link whose signal
+ * stays below postAssnSelfSteerThreshold for postAssnSelfSteerTimeframe
+ * seconds triggers a roam scan over the channels of its SSID. An access point
+ * at least postAssnLevelDeltaConnected dB stronger takes the link through a
+ * new handshake, reported by the connect callback. Without one the station
+ * backs off for postAssnBackOffTime seconds. At connect time a 5 GHz access
+ * point above preassnBestThreshold is chosen unless another is stronger by
+ * more than preassnBestDelta.
+ *
+ * Times of the last roam are CLOCK_MONOTONIC nanoseconds, 0 for steps not
+ * reached yet.
+ */
+typedef struct
+{
+    ULONG roams;                 /*!< Completed handoffs */
+    ULONG failed;                /*!< Roam scans that found no better access point */
+    ULONG links_lost;            /*!< Links lost below the sensitivity */
+    uint64_t below_ns;           /*!< Signal went below postAssnSelfSteerThreshold */
+    uint64_t triggered_ns;       /*!< Below for the timeframe, roam scan started */
+    uint64_t scanned_ns;         /*!< Roam scan done, link left for the new access point */
+    uint64_t connected_ns;       /*!< Associated with the new access point */
+    CHAR from_bssid[18];
+    CHAR to_bssid[18];
+} wifi_sim_roam_t;
+
+/**
+ * @brief Telemetry markers sent through wifi_telemetry_callback_register()
+ *
+ * Sent from the event loop after the completion they report, before the HAL
+ * callback of the same completion.
+ */
+#define WIFI_SIM_TELEMETRY_NAME          "wifi_sim"                  /*!< Passed to init() at registration */
+#define WIFI_SIM_MARKER_SCAN_MS          "WIFI_INFO_SCAN_MS"         /*!< event_d: wifi_setRadioScanningFreqList() to results */
+#define WIFI_SIM_MARKER_CONNECTED        "WIFI_INFO_CONNECTED"       /*!< event_s: SSID */
+#define WIFI_SIM_MARKER_CONNECT_MS       "WIFI_INFO_CONNECT_MS"      /*!< event_d: association start to connected */
+#define WIFI_SIM_MARKER_CONNECT_FAILED   "WIFI_ERROR_CONNECT_FAILED" /*!< event_d: wifiStatusCode_t of the failure */
+#define WIFI_SIM_MARKER_DISCONNECTED     "WIFI_INFO_DISCONNECTED"    /*!< event_s: SSID */
+#define WIFI_SIM_MARKER_LINK_LOST        "WIFI_ERROR_LINK_LOST"      /*!< event_s: SSID of a link lost below the sensitivity */
+#define WIFI_SIM_MARKER_ROAM_MS          "WIFI_INFO_ROAM_MS"         /*!< event_d: roam triggered to associated with the new access point */
+
+/**
+ * @brief Traffic added to the counters by wifi_sim_add_traffic()
+ */
+typedef struct
+{
+    ULONG bytes_sent;
+    ULONG bytes_received;
+    ULONG packets_sent;            /*!< Unicast and multicast */
+    ULONG packets_received;        /*!< Unicast and multicast */
+    ULONG multicast_sent;          /*!< Part of packets_sent */
+    ULONG multicast_received;      /*!< Part of packets_received */
+    ULONG retransmissions;
+    ULONG errors_sent;
+    ULONG errors_received;
+    ULONG discards_sent;
+    ULONG discards_received;
+} wifi_sim_traffic_t;
+
+/**
+ * @brief Largest number of renditions of the video ladder
+ */
+#define WIFI_SIM_MAX_RENDITIONS 8
+
+/**
+ * @brief Traffic of the station generated by the workload model
+ */
+typedef enum
+{
+    WIFI_SIM_WORKLOAD_IDLE = 0,   /*!< Background multicast only */
+    WIFI_SIM_WORKLOAD_VIDEO,      /*!< Adaptive bitrate video, one segment at a time */
+    WIFI_SIM_WORKLOAD_WEB         /*!< Page loads separated by think time */
+} wifi_sim_workload_kind_t;
+
+/**
+ * @brief Workload model
+ *
+ * Every tick adds the traffic of the workload to the counters as
+ * wifi_sim_add_traffic() would, while the link is connected. Downloads run
+ * at the share of sta_LastDataDownlinkRate the channel utilisation of the
+ * access point leaves free.
+ *
+ * The video player keeps buffer_ms of video ahead. It requests the next
+ * segment whenever one more fits, at the highest rendition within
+ * abr_percent of the free throughput, and stalls when the buffer runs out.
+ * Once the buffer is full it downloads one segment per segment_ms, so the
+ * received bytes average the rendition. Web pages and think times are drawn
+ * from exponential distributions around their means with a generator seeded
+ * with seed.
+ *
+ * Data frames carry up to mtu bytes and every second one is acknowledged
+ * with a 66 byte frame, each request is one 400 byte frame and multicast
+ * frames are 200 bytes. Retransmissions and discards are retry_ratio of all
+ * frames and discard_ratio of the received ones, discarded frames are not in
+ * the packet counts.
+ */
+typedef struct
+{
+    BOOL enable;
+    BOOL realtime;               /*!< Tick on the event loop rather than in wifi_sim_workload_step() */
+    UINT tick_ms;                /*!< Model time between two ticks */
+    UINT seed;
+    wifi_sim_workload_kind_t kind;
+    UINT rendition_count;
+    UINT renditions_kbps[WIFI_SIM_MAX_RENDITIONS];  /*!< Ascending */
+    UINT segment_ms;
+    UINT buffer_ms;
+    UINT abr_percent;            /*!< Share of the free throughput a rendition may take */
+    UINT page_kbytes;            /*!< Mean page size */
+    UINT think_ms;               /*!< Mean time between the end of a page and the next request */
+    UINT multicast_pps;          /*!< Multicast frames received per second, whatever the workload */
+    UINT mtu;
+    double retry_ratio;
+    double discard_ratio;
+} wifi_sim_workload_t;
+
+/**
+ * @brief Ground truth of the workload model since it was set
+ */
+typedef struct
+{
+    ULONG ticks;
+    wifi_sim_traffic_t total;    /*!< Everything added to the counters */
+    UINT rendition_kbps;         /*!< Rendition of the last segment, 0 before the first */
+    UINT buffer_ms;              /*!< Video buffered ahead of playback */
+    ULONG segments;              /*!< Segments downloaded */
+    ULONG switches;              /*!< Rendition changes between two segments */
+    ULONG stalls;                /*!< Times playback ran out of buffer */
+    ULONG pages;                 /*!< Pages downloaded */
+} wifi_sim_workload_state_t;
+
+/**
+ * @brief Counters of the statistics store
+ */
+typedef struct
+{
+    ULONG publishes;               /*!< Snapshots written for the statistics getters */
+    ULONG retries;                 /*!< Getter reads that overlapped a publish and were repeated */
+} wifi_sim_store_stats_t;
+
+/**
+ * @brief Changes a watcher can be woken for
+ */
+#define WIFI_SIM_CHANGE_CHANNEL    0x01  /*!< Operating channel of the radio */
+#define WIFI_SIM_CHANGE_STATUS     0x02  /*!< Radio status, or the radio coming up or going away */
+#define WIFI_SIM_CHANGE_RSSI       0x04  /*!< Signal of the link moved to another bucket */
+#define WIFI_SIM_CHANGE_CONNECTION 0x08  /*!< Link connected or lost */
+#define WIFI_SIM_CHANGE_ALL        0x0F
+
+/**
+ * @brief Width of the signal buckets: -50 to -59 dBm, -60 to -69 dBm and so on
+ */
+#define WIFI_SIM_RSSI_BUCKET_DB 10
+
+/**
+ * @brief Largest number of open watchers
+ */
+#define WIFI_SIM_MAX_WATCHERS 8
+
+/**
+ * @brief Restores the default configuration and drops all state
+ *
+ * Pending timers are cancelled and the simulator is left uninitialised.
+ * Meant for test isolation.
+ */
+void wifi_sim_reset(void);
+
+/**
+ * @brief Reads and changes the radio attributes
+ */
+void wifi_sim_get_radio(wifi_sim_radio_t *radio);
+void wifi_sim_set_radio(const wifi_sim_radio_t *radio);
+
+/**
+ * @brief Reads and changes the modelled timing
+ */
+void wifi_sim_get_timing(wifi_sim_timing_t *timing);
+void wifi_sim_set_timing(const wifi_sim_timing_t *timing);
+
+/**
+ * @brief Reads and changes the WPS registrar
+ */
+void wifi_sim_get_registrar(wifi_sim_registrar_t *registrar);
+void wifi_sim_set_registrar(const wifi_sim_registrar_t *registrar);
+
+/**
+ * @brief Replaces the access point population
+ *
+ * @param[in] aps   Access points, copied
+ * @param[in] count Number of entries, at most WIFI_SIM_MAX_APS
+ *
+ * @return INT - RETURN_OK, or RETURN_ERR if count is too large
+ */
+INT wifi_sim_set_aps(const wifi_neighbor_ap_t *aps, UINT count);
+
+/**
+ * @brief Reads and changes the RF model
+ *
+ * Setting an enabled model restarts it at model time 0 and applies the first
+ * tick at once. The roaming record restarts with it.
+ *
+ * @return INT - RETURN_OK, or RETURN_ERR if a count is too large, tick_ms is 0,
+ *         the path goes back in time or the fading correlation is out of range
+ */
+void wifi_sim_get_rf(wifi_sim_rf_t *rf);
+INT wifi_sim_set_rf(const wifi_sim_rf_t *rf);
+
+/**
+ * @brief Advances a model that is not realtime by a number of ticks
+ *
+ * @return INT - RETURN_OK, or RETURN_ERR if the model is disabled or realtime
+ */
+INT wifi_sim_rf_step(UINT ticks);
+
+/**
+ * @brief Reads the roaming record
+ */
+void wifi_sim_get_roam(wifi_sim_roam_t *roam);
+
+/**
+ * @brief Adds traffic to the radio and SSID counters
+ *
+ * Byte, packet, error and discard counts go to both wifi_radioTrafficStats_t
+ * and wifi_ssidTrafficStats_t, multicast and the unicast remainder and
+ * retransmissions to wifi_ssidTrafficStats_t, and retransmissions also to
+ * sta_Retransmissions while connected. The counters only restart at
+ * wifi_sim_reset().
+ *
+ * @param[in] traffic Traffic since the last call
+ *
+ * @return INT - RETURN_OK, or RETURN_ERR if not initialised or multicast exceeds the packet count
+ */
+INT wifi_sim_add_traffic(const wifi_sim_traffic_t *traffic);
+
+/**
+ * @brief Reads and changes the workload model
+ *
+ * Setting an enabled model restarts it and its ground truth at model time 0.
+ * The counters keep what was added before.
+ *
+ * @return INT - RETURN_OK, or RETURN_ERR if tick_ms or mtu is 0, the video
+ *         ladder is empty, too long or not ascending, segment_ms is 0 or a
+ *         ratio is outside 0 to 1
+ */
+void wifi_sim_get_workload(wifi_sim_workload_t *workload);
+INT wifi_sim_set_workload(const wifi_sim_workload_t *workload);
+
+/**
+ * @brief Advances a model that is not realtime by a number of ticks
+ *
+ * @return INT - RETURN_OK, or RETURN_ERR if the model is disabled or realtime
+ */
+INT wifi_sim_workload_step(UINT ticks);
+
+/**
+ * @brief Reads the ground truth of the workload model
+ */
+void wifi_sim_get_workload_state(wifi_sim_workload_state_t *state);
+
+/**
+ * @brief Reads the counters of the statistics store
+ *
+ * wifi_sim_getStats(), wifi_sim_getRadioTrafficStats() and
+ * wifi_sim_getSSIDTrafficStats() read a snapshot published under a sequence
+ * counter whenever the state behind them changes, without taking the
+ * simulator lock. A getter that overlaps a publish reads again.
+ */
+void wifi_sim_get_store_stats(wifi_sim_store_stats_t *stats);
+
+/**
+ * @brief Tells whether the radio is busy with a WPS session
+ */
+wifi_sim_wps_state_t wifi_sim_wps_state(void);
+
+/**
+ * @brief Opens a change watcher
+ *
+ * The descriptor is an eventfd that becomes readable when one of the changes
+ * happens, so it can wait in the poll or epoll set of the caller beside its
+ * other descriptors instead of the caller polling the getters. Changes that
+ * happen before the watcher is read share one wakeup. Watchers stay open
+ * across wifi_sim_init(), wifi_sim_uninit() and wifi_sim_reset().
+ *
+ * @param[in] changes WIFI_SIM_CHANGE_* bits
+ *
+ * @return INT - Descriptor, or -1 if changes is empty or WIFI_SIM_MAX_WATCHERS are open
+ */
+INT wifi_sim_watch_open(UINT changes);
+
+/**
+ * @brief Returns and clears the changes seen since the last call, without blocking
+ *
+ * @param[in] fd Descriptor from wifi_sim_watch_open()
+ *
+ * @return UINT - WIFI_SIM_CHANGE_* bits, 0 if there were none or fd is not a watcher
+ */
+UINT wifi_sim_watch_read(INT fd);
+
+/**
+ * @brief Closes a change watcher
+ */
+void wifi_sim_watch_close(INT fd);
+
+/**
+ * @brief Core operations behind the HAL API
+ *
+ * Same parameters, return values and callbacks as the HAL function of the
+ * same name in wifi_common_hal.h and wifi_client_hal.h.
+ */
+INT wifi_sim_init(const CHAR *interface);
+INT wifi_sim_down(void);
+INT wifi_sim_uninit(void);
+BOOL wifi_sim_initialised(void);
+BOOL wifi_sim_valid_radio(INT radioIndex);
+BOOL wifi_sim_valid_ssid(INT ssidIndex);
+INT wifi_sim_getRadioStatus(INT radioIndex, CHAR *output_string);
+INT wifi_sim_getStats(INT radioIndex, wifi_sta_stats_t *wifi_sta_stats);
+INT wifi_sim_getRadioTrafficStats(INT radioIndex, wifi_radioTrafficStats_t *output_struct);
+INT wifi_sim_getSSIDTrafficStats(INT ssidIndex, wifi_ssidTrafficStats_t *output_struct);
+INT wifi_sim_getNeighboringWiFiDiagnosticResult(INT radioIndex, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size);
+INT wifi_sim_getSpecificSSIDInfo(const char *SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t **ap_array, UINT *output_array_size);
+INT wifi_sim_setRadioScanningFreqList(INT radioIndex, const CHAR *freqList);
+INT wifi_sim_waitForScanResults(void);
+INT wifi_sim_connectEndpoint(INT ssidIndex, CHAR *AP_SSID, wifiSecurityMode_t AP_security_mode, CHAR *AP_security_WEPKey,
+                             CHAR *AP_security_PreSharedKey, CHAR *AP_security_KeyPassphrase, INT saveSSID,
+                             CHAR *eapIdentity, CHAR *carootcert, CHAR *clientcert, CHAR *privatekey);
+INT wifi_sim_disconnectEndpoint(INT ssidIndex, CHAR *AP_SSID);
+INT wifi_sim_clearSSIDInfo(INT ssidIndex);
+INT wifi_sim_lastConnected_Endpoint(wifi_pairedSSIDInfo_t *pairedSSIDInfo);
+void wifi_sim_connectEndpoint_callback_register(wifi_connectEndpoint_callback callback_proc);
+void wifi_sim_disconnectEndpoint_callback_register(wifi_disconnectEndpoint_callback callback_proc);
+void wifi_sim_telemetry_callback_register(wifi_telemetry_ops_t *telemetry_ops);
+INT wifi_sim_setRoamingControl(INT ssidIndex, wifi_roamingCtrl_t *pRoamingCtrl_data);
+INT wifi_sim_getRoamingControl(INT ssidIndex, wifi_roamingCtrl_t *pRoamingCtrl_data);
+INT wifi_sim_setCliWpsButtonPush(INT ssidIndex);
+INT wifi_sim_setCliWpsEnrolleePin(INT ssidIndex, CHAR *EnrolleePin);
+INT wifi_sim_cancelWpsPairing(void);
+
+#endif // __WIFI_SIM_H__
+
+/** @} */ // End of RDKV_WIFI_SIMULATOR
+/** @} */ // End of RDKV_WIFI
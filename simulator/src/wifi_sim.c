@@ -0,0 +1,810 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_SIMULATOR RDK-V WiFi HAL Simulator
+ * @{
+ */
+
+/**
+* @file wifi_sim.c
+*
+* Simulator state, configuration, lifecycle, radio getters and scans.
+*/
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wifi_sim_internal.h"
+
+#define SIM_DEFAULT_INTERFACE "wlan0"
+
+sim_state_t sim_state = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .changed = PTHREAD_COND_INITIALIZER,
+};
+
+static BOOL sim_configured = FALSE;
+
+static void sim_copy(CHAR *dst, size_t size, const CHAR *src)
+{
+    snprintf(dst, size, "%s", src);
+}
+
+static void sim_default_ap(wifi_neighbor_ap_t *ap, const CHAR *ssid, const CHAR *bssid, UINT channel,
+                           INT rssi, const CHAR *security)
+{
+    BOOL is_5g = (channel > 14);
+
+    memset(ap, 0, sizeof(*ap));
+    sim_copy(ap->ap_SSID, sizeof(ap->ap_SSID), ssid);
+    sim_copy(ap->ap_BSSID, sizeof(ap->ap_BSSID), bssid);
+    sim_copy(ap->ap_Mode, sizeof(ap->ap_Mode), "Infrastructure");
+    ap->ap_Channel = channel;
+    ap->ap_SignalStrength = rssi;
+    sim_copy(ap->ap_SecurityModeEnabled, sizeof(ap->ap_SecurityModeEnabled), security);
+    sim_copy(ap->ap_EncryptionMode, sizeof(ap->ap_EncryptionMode), "AES");
+    sim_copy(ap->ap_OperatingFrequencyBand, sizeof(ap->ap_OperatingFrequencyBand), is_5g ? "5GHz" : "2.4GHz");
+    sim_copy(ap->ap_SupportedStandards, sizeof(ap->ap_SupportedStandards), is_5g ? "a,n,ac" : "b,g,n");
+    sim_copy(ap->ap_OperatingStandards, sizeof(ap->ap_OperatingStandards), is_5g ? "ac" : "n");
+    sim_copy(ap->ap_OperatingChannelBandwidth, sizeof(ap->ap_OperatingChannelBandwidth), is_5g ? "80MHz" : "20MHz");
+    ap->ap_BeaconPeriod = 100;
+    ap->ap_Noise = -92;
+    sim_copy(ap->ap_BasicDataTransferRates, sizeof(ap->ap_BasicDataTransferRates), "6,12,24");
+    sim_copy(ap->ap_SupportedDataTransferRates, sizeof(ap->ap_SupportedDataTransferRates), "6,9,12,18,24,36,48,54");
+    ap->ap_DTIMPeriod = 1;
+    sim_copy(ap->ap_ChannelUtilization, sizeof(ap->ap_ChannelUtilization), "30");
+}
+
+/* Caller holds sim_state.lock */
+static void sim_apply_defaults(void)
+{
+    wifi_sim_radio_t *r = &sim_state.radio;
+
+    sim_state.initialised = FALSE;
+    sim_state.init_count = 0;
+    sim_state.init_generation++;
+    sim_state.radio_up = FALSE;
+    sim_state.results_ready = FALSE;
+    sim_copy(sim_state.interface, sizeof(sim_state.interface), SIM_DEFAULT_INTERFACE);
+
+    memset(r, 0, sizeof(*r));
+    r->enable = TRUE;
+    sim_copy(r->status, sizeof(r->status), "Up");
+    sim_copy(r->if_name, sizeof(r->if_name), SIM_DEFAULT_INTERFACE);
+    sim_copy(r->max_bit_rate, sizeof(r->max_bit_rate), "866 Mb/s");
+    sim_copy(r->supported_bands, sizeof(r->supported_bands), "2.4GHz,5GHz");
+    sim_copy(r->operating_band, sizeof(r->operating_band), "5GHz");
+    sim_copy(r->supported_standards, sizeof(r->supported_standards), "b,g,n,a,ac");
+    sim_copy(r->standard, sizeof(r->standard), "ac");
+    sim_copy(r->possible_channels, sizeof(r->possible_channels), "1,2,3,4,5,6,7,8,9,10,11,36,40,44,48,149,153,157,161");
+    r->channel = 36;
+    r->auto_channel_supported = TRUE;
+    r->auto_channel_enable = FALSE;
+    r->auto_channel_refresh_period = 0;
+    sim_copy(r->guard_interval, sizeof(r->guard_interval), "800nsec");
+    sim_copy(r->bandwidth, sizeof(r->bandwidth), "80MHz");
+    sim_copy(r->ext_channel, sizeof(r->ext_channel), "Auto");
+    r->mcs = 9;
+    sim_copy(r->transmit_power_supported, sizeof(r->transmit_power_supported), "25,50,75,100");
+    r->transmit_power = 100;
+    r->ieee80211h_supported = TRUE;
+    r->ieee80211h_enabled = FALSE;
+    sim_copy(r->regulatory_domain, sizeof(r->regulatory_domain), "US");
+    sim_copy(r->ssid_mac, sizeof(r->ssid_mac), "02:00:00:00:01:00");
+
+    sim_state.timing.handshake_ms = 300;
+    sim_state.timing.disconnect_ms = 50;
+    sim_state.timing.scan_dwell_ms = 100;
+    sim_state.timing.cold_init_ms = 0;
+    sim_state.timing.warm_init_ms = 0;
+    sim_state.timing.radio_up_ms = 0;
+    sim_state.timing.first_scan_ms = 0;
+
+    memset(&sim_state.registrar, 0, sizeof(sim_state.registrar));
+    sim_state.registrar.present = TRUE;
+    sim_state.registrar.pbc_response_ms = 1500;
+    sim_state.registrar.pin_response_ms = 2500;
+    sim_state.registrar.walk_time_ms = 120000;
+    sim_state.registrar.cancel_ms = 50;
+    sim_copy(sim_state.registrar.pin, sizeof(sim_state.registrar.pin), "12345670");
+    sim_copy(sim_state.registrar.ssid, sizeof(sim_state.registrar.ssid), "SimHome");
+    sim_copy(sim_state.registrar.passphrase, sizeof(sim_state.registrar.passphrase), "simulated-passphrase");
+
+    sim_default_ap(&sim_state.aps[0], "SimHome", "02:00:00:00:00:01", 36, -48, "WPA2-Personal");
+    sim_default_ap(&sim_state.aps[1], "SimHome-2G", "02:00:00:00:00:02", 6, -45, "WPA2-Personal");
+    sim_default_ap(&sim_state.aps[2], "SimNeighbour", "02:00:00:00:00:03", 11, -72, "WPA2-Personal");
+    sim_default_ap(&sim_state.aps[3], "SimOpen", "02:00:00:00:00:04", 1, -80, "None");
+    sim_state.ap_count = 4;
+
+    sim_state.scan_active = FALSE;
+    sim_state.scan_timer = 0;
+    sim_state.scan_generation++;
+
+    sim_state.link = SIM_LINK_DISCONNECTED;
+    sim_state.link_timer = 0;
+    sim_state.link_generation++;
+    sim_state.link_ssid[0] = '\0';
+    sim_state.link_bssid[0] = '\0';
+    sim_state.link_passphrase[0] = '\0';
+    memset(&sim_state.sta, 0, sizeof(sim_state.sta));
+    memset(&sim_state.paired, 0, sizeof(sim_state.paired));
+    sim_state.paired_valid = FALSE;
+    memset(&sim_state.roaming, 0, sizeof(sim_state.roaming));
+    memset(sim_state.ap_hidden, 0, sizeof(sim_state.ap_hidden));
+    sim_rf_reset_locked();
+    sim_workload_reset_locked();
+
+    sim_wps_reset_locked();
+
+    memset(&sim_state.radio_traffic, 0, sizeof(sim_state.radio_traffic));
+    memset(&sim_state.ssid_traffic, 0, sizeof(sim_state.ssid_traffic));
+
+    sim_state.connect_cb = NULL;
+    sim_state.disconnect_cb = NULL;
+    sim_state.telemetry = NULL;
+    sim_configured = TRUE;
+}
+
+void sim_lock(void)
+{
+    pthread_mutex_lock(&sim_state.lock);
+    if (!sim_configured)
+    {
+        sim_apply_defaults();
+    }
+}
+
+void sim_unlock(void)
+{
+    sim_stats_publish_locked();
+    pthread_mutex_unlock(&sim_state.lock);
+}
+
+const wifi_neighbor_ap_t *sim_select_ap_locked(const CHAR *ssid, const CHAR *bssid)
+{
+    const wifi_roamingCtrl_t *roaming = &sim_state.roaming;
+    const wifi_neighbor_ap_t *best = NULL;
+    const wifi_neighbor_ap_t *best_5g = NULL;
+
+    for (UINT i = 0; i < sim_state.ap_count; i++)
+    {
+        const wifi_neighbor_ap_t *ap = &sim_state.aps[i];
+
+        if (sim_state.ap_hidden[i] || strcmp(ap->ap_SSID, ssid) != 0)
+        {
+            continue;
+        }
+        if (bssid != NULL)
+        {
+            if (strcmp(ap->ap_BSSID, bssid) == 0)
+            {
+                return ap;
+            }
+            continue;
+        }
+        if (!roaming->roamingEnable)
+        {
+            return ap;
+        }
+        if (best == NULL || ap->ap_SignalStrength > best->ap_SignalStrength)
+        {
+            best = ap;
+        }
+        if (ap->ap_Channel > 14 && (best_5g == NULL || ap->ap_SignalStrength > best_5g->ap_SignalStrength))
+        {
+            best_5g = ap;
+        }
+    }
+
+    /* Band steering: 5 GHz above the threshold wins unless clearly weaker than the best */
+    if (best_5g != NULL && best_5g->ap_SignalStrength >= roaming->preassnBestThreshold &&
+        best->ap_SignalStrength - best_5g->ap_SignalStrength <= roaming->preassnBestDelta)
+    {
+        return best_5g;
+    }
+    return best;
+}
+
+void wifi_sim_reset(void)
+{
+    sim_timer_cancel_all();
+
+    sim_lock();
+    sim_apply_defaults();
+    pthread_cond_broadcast(&sim_state.changed);
+    sim_unlock();
+}
+
+void wifi_sim_get_radio(wifi_sim_radio_t *radio)
+{
+    sim_lock();
+    *radio = sim_state.radio;
+    sim_unlock();
+}
+
+void wifi_sim_set_radio(const wifi_sim_radio_t *radio)
+{
+    UINT changes = 0;
+
+    sim_lock();
+    if (radio->channel != sim_state.radio.channel)
+    {
+        changes |= WIFI_SIM_CHANGE_CHANNEL;
+        /* A channel switch announced by the access point moves the link along */
+        if (sim_state.link == SIM_LINK_CONNECTED)
+        {
+            sim_state.sta.sta_Frequency = sim_frequency((UINT)radio->channel);
+        }
+    }
+    if (radio->enable != sim_state.radio.enable || strcmp(radio->status, sim_state.radio.status) != 0)
+    {
+        changes |= WIFI_SIM_CHANGE_STATUS;
+    }
+    sim_state.radio = *radio;
+    sim_watch_signal(changes);
+    sim_unlock();
+}
+
+void wifi_sim_get_timing(wifi_sim_timing_t *timing)
+{
+    sim_lock();
+    *timing = sim_state.timing;
+    sim_unlock();
+}
+
+void wifi_sim_set_timing(const wifi_sim_timing_t *timing)
+{
+    sim_lock();
+    sim_state.timing = *timing;
+    sim_unlock();
+}
+
+void wifi_sim_get_registrar(wifi_sim_registrar_t *registrar)
+{
+    sim_lock();
+    *registrar = sim_state.registrar;
+    sim_unlock();
+}
+
+void wifi_sim_set_registrar(const wifi_sim_registrar_t *registrar)
+{
+    sim_lock();
+    sim_state.registrar = *registrar;
+    sim_unlock();
+}
+
+INT wifi_sim_set_aps(const wifi_neighbor_ap_t *aps, UINT count)
+{
+    if (count > WIFI_SIM_MAX_APS || (count > 0 && aps == NULL))
+    {
+        return RETURN_ERR;
+    }
+
+    sim_lock();
+    if (count > 0)
+    {
+        memcpy(sim_state.aps, aps, count * sizeof(*aps));
+    }
+    sim_state.ap_count = count;
+    /* Visible until the next tick of the RF model says otherwise */
+    memset(sim_state.ap_hidden, 0, sizeof(sim_state.ap_hidden));
+
+    /* The link follows the signal of the access point it is on */
+    if (sim_state.link == SIM_LINK_CONNECTED)
+    {
+        for (UINT i = 0; i < count; i++)
+        {
+            INT rssi = sim_state.aps[i].ap_SignalStrength;
+            INT before = (INT)sim_state.sta.sta_RSSI;
+
+            if (strcmp(sim_state.aps[i].ap_BSSID, sim_state.sta.sta_BSSID) != 0 || rssi == before)
+            {
+                continue;
+            }
+            sim_state.sta.sta_RSSI = (FLOAT)rssi;
+            if (sim_rssi_bucket(rssi) != sim_rssi_bucket(before))
+            {
+                sim_watch_signal(WIFI_SIM_CHANGE_RSSI);
+            }
+            break;
+        }
+    }
+    sim_unlock();
+    return RETURN_OK;
+}
+
+static void sim_radio_up(void *arg)
+{
+    UINT generation = (UINT)(uintptr_t)arg;
+
+    sim_lock();
+    if (generation == sim_state.init_generation && sim_state.initialised)
+    {
+        sim_state.radio_up = TRUE;
+        sim_watch_signal(WIFI_SIM_CHANGE_STATUS);
+    }
+    sim_unlock();
+}
+
+static void sim_first_scan_done(void *arg)
+{
+    UINT generation = (UINT)(uintptr_t)arg;
+
+    sim_lock();
+    if (generation == sim_state.init_generation && sim_state.initialised)
+    {
+        sim_state.results_ready = TRUE;
+    }
+    sim_unlock();
+}
+
+INT wifi_sim_init(const CHAR *interface)
+{
+    UINT load_ms;
+    UINT radio_up_ms;
+    UINT first_scan_ms;
+
+    sim_lock();
+    if (sim_state.initialised)
+    {
+        sim_unlock();
+        return RETURN_OK;
+    }
+    load_ms = (sim_state.init_count == 0) ? sim_state.timing.cold_init_ms : sim_state.timing.warm_init_ms;
+    sim_state.init_count++;
+    sim_unlock();
+
+    /* Driver and firmware load happen inside the call, as on the platforms */
+    if (load_ms > 0)
+    {
+        struct timespec ts = { .tv_sec = load_ms / 1000, .tv_nsec = (long)(load_ms % 1000) * 1000000L };
+
+        while (nanosleep(&ts, &ts) != 0)
+        {
+        }
+    }
+
+    sim_lock();
+    if (interface != NULL && interface[0] != '\0')
+    {
+        sim_copy(sim_state.interface, sizeof(sim_state.interface), interface);
+    }
+    sim_copy(sim_state.radio.if_name, sizeof(sim_state.radio.if_name), sim_state.interface);
+    sim_copy(sim_state.radio.status, sizeof(sim_state.radio.status), "Up");
+    sim_state.radio.enable = TRUE;
+    sim_state.initialised = TRUE;
+    sim_state.init_generation++;
+
+    radio_up_ms = sim_state.timing.radio_up_ms;
+    first_scan_ms = sim_state.timing.first_scan_ms;
+    sim_state.radio_up = (radio_up_ms == 0);
+    sim_state.results_ready = (first_scan_ms == 0);
+    if (!sim_state.radio_up && sim_timer_start(radio_up_ms, sim_radio_up, (void *)(uintptr_t)sim_state.init_generation) == 0)
+    {
+        sim_state.radio_up = TRUE;
+    }
+    if (sim_state.radio_up)
+    {
+        sim_watch_signal(WIFI_SIM_CHANGE_STATUS);
+    }
+    if (!sim_state.results_ready &&
+        sim_timer_start(first_scan_ms, sim_first_scan_done, (void *)(uintptr_t)sim_state.init_generation) == 0)
+    {
+        sim_state.results_ready = TRUE;
+    }
+    sim_unlock();
+    return RETURN_OK;
+}
+
+/* Caller holds sim_state.lock */
+static void sim_stop_activity_locked(void)
+{
+    if (sim_state.link == SIM_LINK_CONNECTED || sim_state.link == SIM_LINK_DISCONNECTING)
+    {
+        sim_watch_signal(WIFI_SIM_CHANGE_CONNECTION);
+    }
+
+    sim_timer_cancel(sim_state.scan_timer);
+    sim_state.scan_timer = 0;
+    sim_state.scan_generation++;
+    sim_state.scan_active = FALSE;
+
+    sim_timer_cancel(sim_state.link_timer);
+    sim_state.link_timer = 0;
+    sim_state.link_generation++;
+    sim_state.link = SIM_LINK_DISCONNECTED;
+    memset(&sim_state.sta, 0, sizeof(sim_state.sta));
+    sim_roam_cancel_locked();
+
+    sim_wps_reset_locked();
+    pthread_cond_broadcast(&sim_state.changed);
+}
+
+INT wifi_sim_down(void)
+{
+    sim_lock();
+    if (!sim_state.initialised)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    sim_stop_activity_locked();
+    sim_copy(sim_state.radio.status, sizeof(sim_state.radio.status), "Down");
+    sim_state.radio.enable = FALSE;
+    sim_watch_signal(WIFI_SIM_CHANGE_STATUS);
+    sim_unlock();
+    return RETURN_OK;
+}
+
+INT wifi_sim_uninit(void)
+{
+    sim_lock();
+    if (!sim_state.initialised)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    sim_stop_activity_locked();
+    sim_state.initialised = FALSE;
+    sim_state.init_generation++;
+    sim_state.radio_up = FALSE;
+    sim_state.results_ready = FALSE;
+    sim_watch_signal(WIFI_SIM_CHANGE_STATUS);
+    sim_unlock();
+    return RETURN_OK;
+}
+
+BOOL wifi_sim_initialised(void)
+{
+    BOOL initialised;
+
+    sim_lock();
+    initialised = sim_state.initialised;
+    sim_unlock();
+    return initialised;
+}
+
+BOOL wifi_sim_valid_radio(INT radioIndex)
+{
+    return (radioIndex >= 1 && radioIndex <= WIFI_SIM_RADIOS);
+}
+
+BOOL wifi_sim_valid_ssid(INT ssidIndex)
+{
+    return (ssidIndex >= 1 && ssidIndex <= WIFI_SIM_SSIDS);
+}
+
+INT wifi_sim_getRadioStatus(INT radioIndex, CHAR *output_string)
+{
+    if (!wifi_sim_valid_radio(radioIndex) || output_string == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    sim_lock();
+    /* The driver does not answer until the radio has come up after wifi_init() */
+    if (!sim_state.initialised || !sim_state.radio_up)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    strcpy(output_string, sim_state.radio.status);
+    sim_unlock();
+    return RETURN_OK;
+}
+
+INT wifi_sim_getStats(INT radioIndex, wifi_sta_stats_t *wifi_sta_stats)
+{
+    sim_stats_t stats;
+
+    if (!wifi_sim_valid_radio(radioIndex) || wifi_sta_stats == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    sim_stats_read(&stats);
+    if (!stats.initialised)
+    {
+        return RETURN_ERR;
+    }
+    *wifi_sta_stats = stats.sta;
+    return RETURN_OK;
+}
+
+INT wifi_sim_getRadioTrafficStats(INT radioIndex, wifi_radioTrafficStats_t *output_struct)
+{
+    sim_stats_t stats;
+
+    if (!wifi_sim_valid_radio(radioIndex) || output_struct == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    sim_stats_read(&stats);
+    if (!stats.initialised)
+    {
+        return RETURN_ERR;
+    }
+    *output_struct = stats.radio;
+    return RETURN_OK;
+}
+
+INT wifi_sim_getSSIDTrafficStats(INT ssidIndex, wifi_ssidTrafficStats_t *output_struct)
+{
+    sim_stats_t stats;
+
+    if (!wifi_sim_valid_ssid(ssidIndex) || output_struct == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    sim_stats_read(&stats);
+    if (!stats.initialised)
+    {
+        return RETURN_ERR;
+    }
+    *output_struct = stats.ssid;
+    return RETURN_OK;
+}
+
+static BOOL sim_band_matches(const wifi_neighbor_ap_t *ap, WIFI_HAL_FREQ_BAND band)
+{
+    switch (band)
+    {
+        case WIFI_HAL_FREQ_BAND_24GHZ:
+            return (ap->ap_Channel <= 14);
+        case WIFI_HAL_FREQ_BAND_5GHZ:
+            return (ap->ap_Channel > 14);
+        default:
+            return TRUE;
+    }
+}
+
+/* Access points below the sensitivity of the RF model are not heard, caller holds sim_state.lock */
+static BOOL sim_ap_matches(UINT index, const char *ssid, WIFI_HAL_FREQ_BAND band)
+{
+    const wifi_neighbor_ap_t *ap = &sim_state.aps[index];
+
+    return !sim_state.ap_hidden[index] && (ssid == NULL || strcmp(ap->ap_SSID, ssid) == 0) && sim_band_matches(ap, band);
+}
+
+/* Copies the matching part of the population into a caller-owned array, caller holds sim_state.lock */
+static INT sim_copy_aps_locked(const char *ssid, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t **out, UINT *count)
+{
+    UINT matches = 0;
+
+    *out = NULL;
+    *count = 0;
+
+    for (UINT i = 0; i < sim_state.ap_count; i++)
+    {
+        if (sim_ap_matches(i, ssid, band))
+        {
+            matches++;
+        }
+    }
+    if (matches == 0)
+    {
+        return RETURN_OK;
+    }
+
+    *out = malloc(matches * sizeof(wifi_neighbor_ap_t));
+    if (*out == NULL)
+    {
+        return RETURN_ERR;
+    }
+    for (UINT i = 0; i < sim_state.ap_count; i++)
+    {
+        if (sim_ap_matches(i, ssid, band))
+        {
+            (*out)[(*count)++] = sim_state.aps[i];
+        }
+    }
+    return RETURN_OK;
+}
+
+INT wifi_sim_getNeighboringWiFiDiagnosticResult(INT radioIndex, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size)
+{
+    INT ret;
+
+    if (!wifi_sim_valid_radio(radioIndex) || neighbor_ap_array == NULL || output_array_size == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    sim_lock();
+    if (!sim_state.initialised)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    if (!sim_state.results_ready)
+    {
+        /* Nothing has been scanned since wifi_init() */
+        *neighbor_ap_array = NULL;
+        *output_array_size = 0;
+        sim_unlock();
+        return RETURN_OK;
+    }
+    ret = sim_copy_aps_locked(NULL, WIFI_HAL_FREQ_BAND_NONE, neighbor_ap_array, output_array_size);
+    sim_unlock();
+    return ret;
+}
+
+INT wifi_sim_getSpecificSSIDInfo(const char *SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t **ap_array, UINT *output_array_size)
+{
+    INT ret;
+
+    if (SSID == NULL || ap_array == NULL || output_array_size == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    sim_lock();
+    if (!sim_state.initialised)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    ret = sim_copy_aps_locked(SSID, band, ap_array, output_array_size);
+    sim_unlock();
+    return ret;
+}
+
+/* Counts the frequencies of a space or comma separated list, 0 if any entry is not a number */
+static UINT sim_count_freqs(const CHAR *freqList)
+{
+    UINT count = 0;
+    const CHAR *p = freqList;
+
+    while (*p != '\0')
+    {
+        if (*p == ' ' || *p == ',')
+        {
+            p++;
+            continue;
+        }
+        if (!isdigit((unsigned char)*p))
+        {
+            return 0;
+        }
+        while (isdigit((unsigned char)*p))
+        {
+            p++;
+        }
+        count++;
+    }
+    return count;
+}
+
+static void sim_scan_dwell_done(void *arg);
+
+/* Arms the end of the dwell on the next channel, caller holds sim_state.lock */
+static UINT sim_scan_arm_locked(void)
+{
+    uint64_t dwell_ns = (uint64_t)sim_state.timing.scan_dwell_ms * 1000000ULL;
+
+    /* Deadlines count from the start of the scan, so the steps do not drift */
+    return sim_timer_start_at(sim_state.scan_started_ns + (sim_state.scan_channel + 1) * dwell_ns, sim_scan_dwell_done,
+                              (void *)(uintptr_t)sim_state.scan_generation);
+}
+
+static void sim_scan_dwell_done(void *arg)
+{
+    UINT generation = (UINT)(uintptr_t)arg;
+    uint64_t elapsed_ns = 0;
+    BOOL done = FALSE;
+
+    sim_lock();
+    if (generation == sim_state.scan_generation && sim_state.scan_active)
+    {
+        sim_state.scan_channel++;
+        sim_state.scan_timer = 0;
+        if (sim_state.scan_channel < sim_state.scan_channels)
+        {
+            sim_state.scan_timer = sim_scan_arm_locked();
+        }
+        /* Out of timers the scan ends early rather than never */
+        if (sim_state.scan_timer == 0)
+        {
+            sim_state.scan_active = FALSE;
+            elapsed_ns = sim_timer_now_ns() - sim_state.scan_started_ns;
+            done = TRUE;
+            pthread_cond_broadcast(&sim_state.changed);
+        }
+    }
+    sim_unlock();
+
+    if (done)
+    {
+        sim_telemetry_d(WIFI_SIM_MARKER_SCAN_MS, (INT)(elapsed_ns / 1000000ULL));
+    }
+}
+
+INT wifi_sim_setRadioScanningFreqList(INT radioIndex, const CHAR *freqList)
+{
+    UINT channels;
+
+    if (!wifi_sim_valid_radio(radioIndex) || freqList == NULL)
+    {
+        return RETURN_ERR;
+    }
+    channels = sim_count_freqs(freqList);
+    if (channels == 0)
+    {
+        return RETURN_ERR;
+    }
+
+    sim_lock();
+    /* The radio cannot scan while it is held by a WPS session */
+    if (!sim_state.initialised || sim_state.wps != WIFI_SIM_WPS_IDLE)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    /* A scan already in flight is joined rather than restarted */
+    if (!sim_state.scan_active)
+    {
+        sim_state.scan_active = TRUE;
+        sim_state.scan_generation++;
+        sim_state.scan_channels = channels;
+        sim_state.scan_channel = 0;
+        sim_state.scan_started_ns = sim_timer_now_ns();
+        sim_state.scan_timer = sim_scan_arm_locked();
+        if (sim_state.scan_timer == 0)
+        {
+            sim_state.scan_active = FALSE;
+            sim_unlock();
+            return RETURN_ERR;
+        }
+    }
+    sim_unlock();
+    return RETURN_OK;
+}
+
+INT wifi_sim_waitForScanResults(void)
+{
+    sim_lock();
+    if (!sim_state.initialised)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    while (sim_state.scan_active)
+    {
+        pthread_cond_wait(&sim_state.changed, &sim_state.lock);
+    }
+    sim_unlock();
+    return RETURN_OK;
+}
+
+wifi_sim_wps_state_t wifi_sim_wps_state(void)
+{
+    wifi_sim_wps_state_t state;
+
+    sim_lock();
+    state = sim_state.wps;
+    sim_unlock();
+    return state;
+}
+
+/** @} */ // End of RDKV_WIFI_SIMULATOR
@@ -0,0 +1,300 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_SIMULATOR RDK-V WiFi HAL Simulator
+ * @{
+ */
+
+/**
+* @file wifi_sim_internal.h
+*
+* State shared between the simulator core modules. Not for use outside simulator/src.
+*/
+
+#ifndef __WIFI_SIM_INTERNAL_H__
+#define __WIFI_SIM_INTERNAL_H__
+
+#include <pthread.h>
+#include <stdint.h>
+#include "wifi_sim.h"
+
+/**
+ * @brief Timer callback, runs on the simulator event loop thread without sim_state.lock held
+ */
+typedef void (*sim_timer_fn)(void *arg);
+
+/**
+ * @brief Returns CLOCK_MONOTONIC in nanoseconds, the clock of the timers
+ */
+uint64_t sim_timer_now_ns(void);
+
+/**
+ * @brief Arms a one-shot timer
+ *
+ * @return Timer id, never 0, or 0 if the timer table is full
+ */
+UINT sim_timer_start(UINT delay_ms, sim_timer_fn fn, void *arg);
+
+/**
+ * @brief Arms a one-shot timer for an absolute sim_timer_now_ns() deadline
+ *
+ * Steps of a series armed from one start time this way do not drift by the
+ * time each callback takes.
+ *
+ * @return Timer id, never 0, or 0 if the timer table is full
+ */
+UINT sim_timer_start_at(uint64_t deadline_ns, sim_timer_fn fn, void *arg);
+
+/**
+ * @brief Disarms a timer
+ *
+ * @return TRUE if the timer was removed before it fired. FALSE if it already
+ *         fired or is running, so handlers must check their generation.
+ */
+BOOL sim_timer_cancel(UINT id);
+
+/**
+ * @brief Disarms every pending timer
+ */
+void sim_timer_cancel_all(void);
+
+typedef enum
+{
+    SIM_LINK_DISCONNECTED = 0,
+    SIM_LINK_CONNECTING,
+    SIM_LINK_CONNECTED,
+    SIM_LINK_DISCONNECTING
+} sim_link_t;
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t changed;              /*!< Broadcast whenever a scan completes */
+
+    BOOL initialised;
+    UINT init_count;                     /*!< wifi_sim_init() calls since the last reset */
+    UINT init_generation;
+    BOOL radio_up;
+    BOOL results_ready;
+    CHAR interface[32];
+    wifi_sim_radio_t radio;
+    wifi_sim_timing_t timing;
+    wifi_sim_registrar_t registrar;
+    wifi_neighbor_ap_t aps[WIFI_SIM_MAX_APS];
+    UINT ap_count;
+
+    /* Scan */
+    BOOL scan_active;
+    UINT scan_timer;
+    UINT scan_generation;
+    UINT scan_channels;                  /*!< Channels of the scan in flight */
+    UINT scan_channel;                   /*!< Channels dwelt on so far */
+    uint64_t scan_started_ns;            /*!< sim_timer_now_ns() at the start of the scan */
+
+    /* Link */
+    sim_link_t link;
+    UINT link_timer;
+    UINT link_generation;
+    uint64_t link_started_ns;            /*!< sim_timer_now_ns() at the start of the association */
+    CHAR link_ssid[64];
+    CHAR link_bssid[18];                 /*!< Access point the association is for, empty to choose by SSID */
+    CHAR link_passphrase[128];
+    wifiSecurityMode_t link_security;
+    BOOL link_save;
+    wifi_sta_stats_t sta;
+    wifi_pairedSSIDInfo_t paired;
+    BOOL paired_valid;
+    wifi_roamingCtrl_t roaming;
+
+    /* WPS */
+    wifi_sim_wps_state_t wps;
+    BOOL wps_accept;                     /*!< The registrar will hand over the credential */
+    UINT wps_timer;
+    UINT wps_generation;
+
+    /* RF model */
+    wifi_sim_rf_t rf;
+    UINT rf_timer;
+    UINT rf_generation;
+    UINT rf_tick;                        /*!< Ticks since the model was set */
+    uint64_t rf_started_ns;              /*!< sim_timer_now_ns() at tick 0 */
+    uint64_t rf_rng;
+    double rf_fading[WIFI_SIM_MAX_APS];  /*!< Fading of each placement, indexed like rf.aps */
+    BOOL ap_hidden[WIFI_SIM_MAX_APS];    /*!< Below the sensitivity, indexed like aps */
+
+    /* Roaming */
+    wifi_sim_roam_t roam;
+    BOOL roam_below;                     /*!< Link below postAssnSelfSteerThreshold since roam_below_ms */
+    uint64_t roam_below_ms;              /*!< Model time */
+    uint64_t roam_backoff_ms;            /*!< Model time before which no roam is triggered */
+    BOOL roam_scanning;
+    BOOL roam_associating;               /*!< Handshake with link_bssid is a roam */
+    uint64_t roam_below_ns;              /*!< Times of the roam in progress, copied to roam when it completes */
+    uint64_t roam_triggered_ns;
+    uint64_t roam_scanned_ns;
+    CHAR roam_from[18];
+    UINT roam_timer;
+    UINT roam_generation;
+
+    /* Workload model */
+    wifi_sim_workload_t workload;
+    wifi_sim_workload_state_t workload_state;
+    UINT workload_timer;
+    UINT workload_generation;
+    uint64_t workload_started_ns;        /*!< sim_timer_now_ns() at model time 0 */
+    uint64_t workload_rng;
+    BOOL workload_playing;
+    uint64_t workload_left;              /*!< Bytes of the segment or page in flight, 0 if none */
+    UINT workload_think_ms;              /*!< Think time left before the next page */
+    uint64_t workload_data;              /*!< Data bytes received since the model was set */
+    double workload_multicast_carry;     /*!< Fractions of a frame carried to the next tick */
+    double workload_retry_carry;
+    double workload_discard_carry;
+
+    wifi_radioTrafficStats_t radio_traffic;
+    wifi_ssidTrafficStats_t ssid_traffic;
+
+    wifi_connectEndpoint_callback connect_cb;
+    wifi_disconnectEndpoint_callback disconnect_cb;
+    wifi_telemetry_ops_t *telemetry;
+} sim_state_t;
+
+extern sim_state_t sim_state;
+
+/**
+ * @brief Takes and releases sim_state.lock, the first lock applies the default configuration
+ */
+void sim_lock(void);
+void sim_unlock(void);
+
+/**
+ * @brief Chooses the access point to associate with, caller holds sim_state.lock
+ *
+ * Only access points above the sensitivity of the RF model are candidates.
+ * Given a BSSID, that access point. Otherwise the first of the SSID, or the
+ * choice of the pre-association roaming control when roaming is enabled.
+ *
+ * @return Access point, or NULL if there is none
+ */
+const wifi_neighbor_ap_t *sim_select_ap_locked(const CHAR *ssid, const CHAR *bssid);
+
+/**
+ * @brief Starts associating with an access point, caller holds sim_state.lock
+ *
+ * The outcome is reported through the connect callback after the modelled
+ * handshake. Shared by wifi_sim_connectEndpoint(), a successful WPS session
+ * and a roam, which passes the BSSID it chose. Otherwise bssid is NULL.
+ *
+ * @return INT - RETURN_OK, or RETURN_ERR if no timer could be armed
+ */
+INT sim_link_start_locked(const CHAR *ssid, const CHAR *bssid, const CHAR *passphrase, wifiSecurityMode_t security,
+                          BOOL save);
+
+/**
+ * @brief Returns the centre frequency of a channel in MHz
+ */
+UINT sim_frequency(UINT channel);
+
+/**
+ * @brief Reports a status code through the connect callback, called without sim_state.lock held
+ */
+void sim_notify_connect(const CHAR *ssid, wifiStatusCode_t code);
+
+/**
+ * @brief Sends a telemetry marker if telemetry is registered, called without sim_state.lock held
+ */
+void sim_telemetry_s(const CHAR *marker, const CHAR *value);
+void sim_telemetry_d(const CHAR *marker, INT value);
+
+/**
+ * @brief Drops the WPS session, caller holds sim_state.lock
+ */
+void sim_wps_reset_locked(void);
+
+/**
+ * @brief Sets the PHY and data rates of the link from its signal to noise ratio, caller holds sim_state.lock
+ */
+void sim_link_rates_locked(void);
+
+/**
+ * @brief Stops the RF model and clears the roaming state, caller holds sim_state.lock
+ */
+void sim_rf_reset_locked(void);
+
+/**
+ * @brief Drops a roam in progress, caller holds sim_state.lock
+ */
+void sim_roam_cancel_locked(void);
+
+/**
+ * @brief Completes the roam if the link just associated is one, caller holds sim_state.lock
+ *
+ * @return Milliseconds from the roam trigger, or -1 if the association was not a roam
+ */
+INT sim_roam_connected_locked(void);
+
+/**
+ * @brief Stops the workload model and restores its defaults, caller holds sim_state.lock
+ */
+void sim_workload_reset_locked(void);
+
+/**
+ * @brief Adds traffic to the counters, caller holds sim_state.lock
+ *
+ * The multicast counts must not exceed the packet counts.
+ */
+void sim_traffic_add_locked(const wifi_sim_traffic_t *traffic);
+
+/**
+ * @brief Wakes the watchers of the changes, callable with or without sim_state.lock held
+ */
+void sim_watch_signal(UINT changes);
+
+/**
+ * @brief Returns the WIFI_SIM_RSSI_BUCKET_DB bucket of a signal level
+ */
+INT sim_rssi_bucket(INT rssi);
+
+/**
+ * @brief What the statistics getters return
+ */
+typedef struct
+{
+    BOOL initialised;
+    wifi_sta_stats_t sta;                /*!< Zero unless connected */
+    wifi_radioTrafficStats_t radio;
+    wifi_ssidTrafficStats_t ssid;
+} sim_stats_t;
+
+/**
+ * @brief Publishes the statistics if they changed, caller holds sim_state.lock
+ *
+ * Called by sim_unlock(), so every change made under the lock is visible to
+ * the getters once the lock is released.
+ */
+void sim_stats_publish_locked(void);
+
+/**
+ * @brief Reads the last published statistics without taking sim_state.lock
+ */
+void sim_stats_read(sim_stats_t *stats);
+
+#endif // __WIFI_SIM_INTERNAL_H__
+
+/** @} */ // End of RDKV_WIFI_SIMULATOR
@@ -0,0 +1,423 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_SIMULATOR RDK-V WiFi HAL Simulator
+ * @{
+ */
+
+/**
+* @file wifi_sim_link.c
+*
+* Connection state, saved credentials and the client callbacks.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "wifi_sim_internal.h"
+
+static void link_copy(CHAR *dst, size_t size, const CHAR *src)
+{
+    snprintf(dst, size, "%s", src);
+}
+
+UINT sim_frequency(UINT channel)
+{
+    return (channel > 14) ? 5000 + 5 * channel : 2407 + 5 * channel;
+}
+
+/* Caller holds sim_state.lock */
+static void link_fill_stats_locked(const wifi_neighbor_ap_t *ap)
+{
+    wifi_sta_stats_t *sta = &sim_state.sta;
+    BOOL is_5g = (ap->ap_Channel > 14);
+
+    memset(sta, 0, sizeof(*sta));
+    link_copy(sta->sta_SSID, sizeof(sta->sta_SSID), ap->ap_SSID);
+    link_copy(sta->sta_BSSID, sizeof(sta->sta_BSSID), ap->ap_BSSID);
+    link_copy(sta->sta_BAND, sizeof(sta->sta_BAND), ap->ap_OperatingFrequencyBand);
+    link_copy(sta->sta_SecMode, sizeof(sta->sta_SecMode), ap->ap_SecurityModeEnabled);
+    link_copy(sta->sta_Encryption, sizeof(sta->sta_Encryption), ap->ap_EncryptionMode);
+    sta->sta_PhyRate = is_5g ? 866.0f : 144.0f;
+    sta->sta_Noise = (FLOAT)ap->ap_Noise;
+    sta->sta_RSSI = (FLOAT)ap->ap_SignalStrength;
+    sta->sta_Frequency = sim_frequency(ap->ap_Channel);
+    sta->sta_LastDataDownlinkRate = is_5g ? 650000 : 130000;
+    sta->sta_LastDataUplinkRate = is_5g ? 433000 : 72000;
+    if (sim_state.rf.enable)
+    {
+        sim_link_rates_locked();
+    }
+}
+
+void sim_telemetry_s(const CHAR *marker, const CHAR *value)
+{
+    wifi_telemetry_ops_t *ops;
+    CHAR name[64];
+    CHAR text[64];
+
+    sim_lock();
+    ops = sim_state.telemetry;
+    sim_unlock();
+
+    if (ops != NULL && ops->event_s != NULL)
+    {
+        link_copy(name, sizeof(name), marker);
+        link_copy(text, sizeof(text), value);
+        ops->event_s(name, text);
+    }
+}
+
+void sim_telemetry_d(const CHAR *marker, INT value)
+{
+    wifi_telemetry_ops_t *ops;
+    CHAR name[64];
+
+    sim_lock();
+    ops = sim_state.telemetry;
+    sim_unlock();
+
+    if (ops != NULL && ops->event_d != NULL)
+    {
+        link_copy(name, sizeof(name), marker);
+        ops->event_d(name, value);
+    }
+}
+
+void sim_notify_connect(const CHAR *ssid, wifiStatusCode_t code)
+{
+    wifi_connectEndpoint_callback cb;
+    uint64_t started_ns;
+    CHAR name[64];
+
+    sim_lock();
+    cb = sim_state.connect_cb;
+    started_ns = sim_state.link_started_ns;
+    sim_unlock();
+
+    if (code == WIFI_HAL_CONNECTED)
+    {
+        sim_telemetry_s(WIFI_SIM_MARKER_CONNECTED, ssid);
+        sim_telemetry_d(WIFI_SIM_MARKER_CONNECT_MS, (INT)((sim_timer_now_ns() - started_ns) / 1000000ULL));
+    }
+    else if (code == WIFI_HAL_ERROR_CONNECTION_LOST)
+    {
+        sim_telemetry_s(WIFI_SIM_MARKER_LINK_LOST, ssid);
+    }
+    else
+    {
+        sim_telemetry_d(WIFI_SIM_MARKER_CONNECT_FAILED, (INT)code);
+    }
+
+    if (cb != NULL)
+    {
+        link_copy(name, sizeof(name), ssid);
+        cb(1, name, &code);
+    }
+}
+
+static void link_handshake_done(void *arg)
+{
+    UINT generation = (UINT)(uintptr_t)arg;
+    const wifi_neighbor_ap_t *ap;
+    wifiStatusCode_t code;
+    CHAR ssid[64];
+    INT roam_ms = -1;
+
+    sim_lock();
+    if (generation != sim_state.link_generation || sim_state.link != SIM_LINK_CONNECTING)
+    {
+        sim_unlock();
+        return;
+    }
+    sim_state.link_timer = 0;
+    link_copy(ssid, sizeof(ssid), sim_state.link_ssid);
+
+    ap = sim_select_ap_locked(sim_state.link_ssid, (sim_state.link_bssid[0] != '\0') ? sim_state.link_bssid : NULL);
+    if (ap != NULL)
+    {
+        sim_state.link = SIM_LINK_CONNECTED;
+        link_fill_stats_locked(ap);
+        if (sim_state.link_save)
+        {
+            memset(&sim_state.paired, 0, sizeof(sim_state.paired));
+            link_copy(sim_state.paired.ap_ssid, sizeof(sim_state.paired.ap_ssid), ap->ap_SSID);
+            link_copy(sim_state.paired.ap_bssid, sizeof(sim_state.paired.ap_bssid), ap->ap_BSSID);
+            link_copy(sim_state.paired.ap_security, sizeof(sim_state.paired.ap_security), ap->ap_SecurityModeEnabled);
+            link_copy(sim_state.paired.ap_passphrase, sizeof(sim_state.paired.ap_passphrase), sim_state.link_passphrase);
+            sim_state.paired_valid = TRUE;
+        }
+        code = WIFI_HAL_CONNECTED;
+        roam_ms = sim_roam_connected_locked();
+        sim_watch_signal(WIFI_SIM_CHANGE_CONNECTION);
+    }
+    else
+    {
+        sim_state.link = SIM_LINK_DISCONNECTED;
+        sim_roam_cancel_locked();
+        code = WIFI_HAL_ERROR_NOT_FOUND;
+    }
+    sim_unlock();
+
+    if (roam_ms >= 0)
+    {
+        sim_telemetry_d(WIFI_SIM_MARKER_ROAM_MS, roam_ms);
+    }
+    sim_notify_connect(ssid, code);
+}
+
+INT sim_link_start_locked(const CHAR *ssid, const CHAR *bssid, const CHAR *passphrase, wifiSecurityMode_t security,
+                          BOOL save)
+{
+    /* Associating elsewhere drops the current link */
+    if (sim_state.link == SIM_LINK_CONNECTED || sim_state.link == SIM_LINK_DISCONNECTING)
+    {
+        sim_watch_signal(WIFI_SIM_CHANGE_CONNECTION);
+    }
+    sim_timer_cancel(sim_state.link_timer);
+    sim_roam_cancel_locked();
+    sim_state.link_generation++;
+    sim_state.link = SIM_LINK_CONNECTING;
+    sim_state.link_started_ns = sim_timer_now_ns();
+    link_copy(sim_state.link_ssid, sizeof(sim_state.link_ssid), ssid);
+    link_copy(sim_state.link_bssid, sizeof(sim_state.link_bssid), (bssid != NULL) ? bssid : "");
+    link_copy(sim_state.link_passphrase, sizeof(sim_state.link_passphrase), passphrase);
+    sim_state.link_security = security;
+    sim_state.link_save = save;
+    memset(&sim_state.sta, 0, sizeof(sim_state.sta));
+
+    sim_state.link_timer = sim_timer_start(sim_state.timing.handshake_ms, link_handshake_done,
+                                           (void *)(uintptr_t)sim_state.link_generation);
+    if (sim_state.link_timer == 0)
+    {
+        sim_state.link = SIM_LINK_DISCONNECTED;
+        return RETURN_ERR;
+    }
+    return RETURN_OK;
+}
+
+INT wifi_sim_connectEndpoint(INT ssidIndex, CHAR *AP_SSID, wifiSecurityMode_t AP_security_mode, CHAR *AP_security_WEPKey,
+                             CHAR *AP_security_PreSharedKey, CHAR *AP_security_KeyPassphrase, INT saveSSID,
+                             CHAR *eapIdentity, CHAR *carootcert, CHAR *clientcert, CHAR *privatekey)
+{
+    const CHAR *secret;
+    INT ret;
+
+    if (!wifi_sim_valid_ssid(ssidIndex) || AP_SSID == NULL || AP_security_mode > WIFI_SECURITY_WPA3_SAE ||
+        AP_security_WEPKey == NULL || AP_security_PreSharedKey == NULL || AP_security_KeyPassphrase == NULL ||
+        eapIdentity == NULL || carootcert == NULL || clientcert == NULL || privatekey == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    switch (AP_security_mode)
+    {
+        case WIFI_SECURITY_WEP_64:
+        case WIFI_SECURITY_WEP_128:
+            secret = AP_security_WEPKey;
+            break;
+        case WIFI_SECURITY_NONE:
+            secret = "";
+            break;
+        default:
+            secret = (AP_security_KeyPassphrase[0] != '\0') ? AP_security_KeyPassphrase : AP_security_PreSharedKey;
+            break;
+    }
+
+    sim_lock();
+    if (!sim_state.initialised || sim_state.wps != WIFI_SIM_WPS_IDLE)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    ret = sim_link_start_locked(AP_SSID, NULL, secret, AP_security_mode, saveSSID ? TRUE : FALSE);
+    sim_unlock();
+    return ret;
+}
+
+static void link_disconnect_done(void *arg)
+{
+    UINT generation = (UINT)(uintptr_t)arg;
+    wifi_disconnectEndpoint_callback cb;
+    wifiStatusCode_t code = WIFI_HAL_DISCONNECTED;
+    CHAR ssid[64];
+
+    sim_lock();
+    if (generation != sim_state.link_generation || sim_state.link != SIM_LINK_DISCONNECTING)
+    {
+        sim_unlock();
+        return;
+    }
+    sim_state.link_timer = 0;
+    sim_state.link = SIM_LINK_DISCONNECTED;
+    memset(&sim_state.sta, 0, sizeof(sim_state.sta));
+    link_copy(ssid, sizeof(ssid), sim_state.link_ssid);
+    cb = sim_state.disconnect_cb;
+    sim_watch_signal(WIFI_SIM_CHANGE_CONNECTION);
+    sim_unlock();
+
+    sim_telemetry_s(WIFI_SIM_MARKER_DISCONNECTED, ssid);
+    if (cb != NULL)
+    {
+        cb(1, ssid, &code);
+    }
+}
+
+INT wifi_sim_disconnectEndpoint(INT ssidIndex, CHAR *AP_SSID)
+{
+    if (!wifi_sim_valid_ssid(ssidIndex) || AP_SSID == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    sim_lock();
+    if (!sim_state.initialised)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    if (sim_state.link == SIM_LINK_DISCONNECTED || sim_state.link == SIM_LINK_DISCONNECTING)
+    {
+        sim_unlock();
+        return RETURN_OK;
+    }
+    if (strcmp(sim_state.link_ssid, AP_SSID) != 0)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+
+    sim_timer_cancel(sim_state.link_timer);
+    sim_roam_cancel_locked();
+    sim_state.link_generation++;
+    sim_state.link = SIM_LINK_DISCONNECTING;
+    sim_state.link_timer = sim_timer_start(sim_state.timing.disconnect_ms, link_disconnect_done,
+                                           (void *)(uintptr_t)sim_state.link_generation);
+    if (sim_state.link_timer == 0)
+    {
+        sim_state.link = SIM_LINK_DISCONNECTED;
+        memset(&sim_state.sta, 0, sizeof(sim_state.sta));
+    }
+    sim_unlock();
+    return RETURN_OK;
+}
+
+INT wifi_sim_clearSSIDInfo(INT ssidIndex)
+{
+    if (!wifi_sim_valid_ssid(ssidIndex))
+    {
+        return RETURN_ERR;
+    }
+
+    sim_lock();
+    if (!sim_state.initialised)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    memset(&sim_state.paired, 0, sizeof(sim_state.paired));
+    sim_state.paired_valid = FALSE;
+    sim_unlock();
+    return RETURN_OK;
+}
+
+INT wifi_sim_lastConnected_Endpoint(wifi_pairedSSIDInfo_t *pairedSSIDInfo)
+{
+    if (pairedSSIDInfo == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    sim_lock();
+    if (!sim_state.initialised)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    /* Nothing saved reads back as an empty entry, as on the reference platforms */
+    *pairedSSIDInfo = sim_state.paired;
+    sim_unlock();
+    return RETURN_OK;
+}
+
+void wifi_sim_connectEndpoint_callback_register(wifi_connectEndpoint_callback callback_proc)
+{
+    sim_lock();
+    sim_state.connect_cb = callback_proc;
+    sim_unlock();
+}
+
+void wifi_sim_disconnectEndpoint_callback_register(wifi_disconnectEndpoint_callback callback_proc)
+{
+    sim_lock();
+    sim_state.disconnect_cb = callback_proc;
+    sim_unlock();
+}
+
+void wifi_sim_telemetry_callback_register(wifi_telemetry_ops_t *telemetry_ops)
+{
+    CHAR name[] = WIFI_SIM_TELEMETRY_NAME;
+
+    sim_lock();
+    sim_state.telemetry = telemetry_ops;
+    sim_unlock();
+
+    if (telemetry_ops != NULL && telemetry_ops->init != NULL)
+    {
+        telemetry_ops->init(name);
+    }
+}
+
+INT wifi_sim_setRoamingControl(INT ssidIndex, wifi_roamingCtrl_t *pRoamingCtrl_data)
+{
+    if (!wifi_sim_valid_ssid(ssidIndex) || pRoamingCtrl_data == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    sim_lock();
+    if (!sim_state.initialised)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    sim_state.roaming = *pRoamingCtrl_data;
+    sim_unlock();
+    return RETURN_OK;
+}
+
+INT wifi_sim_getRoamingControl(INT ssidIndex, wifi_roamingCtrl_t *pRoamingCtrl_data)
+{
+    if (!wifi_sim_valid_ssid(ssidIndex) || pRoamingCtrl_data == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    sim_lock();
+    if (!sim_state.initialised)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    *pRoamingCtrl_data = sim_state.roaming;
+    sim_unlock();
+    return RETURN_OK;
+}
+
+/** @} */ // End of RDKV_WIFI_SIMULATOR
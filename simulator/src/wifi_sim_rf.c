@@ -0,0 +1,587 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_SIMULATOR RDK-V WiFi HAL Simulator
+ * @{
+ */
+
+/**
+* @file wifi_sim_rf.c
+*
+* RF model and roaming. A tick moves the station along its path, sets the
+* signal, noise and channel utilisation of the placed access points, carries
+* the signal over to the link and lets the roaming control act on it.
+*
+* The generator is seeded when the model is set and draws the same three
+* values per placement per tick whether or not the placement matches an
+* access point, so a seed replays the same trace for the same configuration.
+*/
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "wifi_sim_internal.h"
+
+/**
+ * @brief Lowest signal to noise ratio of each MCS and the PHY rates in Mb/s
+ *
+ * Two spatial streams with the short guard interval: VHT 80 MHz on 5 GHz,
+ * HT 20 MHz on 2.4 GHz, which has no MCS 8 and 9.
+ */
+static const struct
+{
+    INT snr_db;
+    FLOAT rate_5g;
+    FLOAT rate_24g;
+} rf_mcs[] = {
+    { 5, 65.0f, 14.4f },
+    { 8, 130.0f, 28.9f },
+    { 11, 195.0f, 43.3f },
+    { 14, 260.0f, 57.8f },
+    { 18, 390.0f, 86.7f },
+    { 22, 520.0f, 115.6f },
+    { 24, 585.0f, 130.0f },
+    { 26, 650.0f, 144.4f },
+    { 30, 780.0f, 144.4f },
+    { 32, 866.7f, 144.4f },
+};
+
+typedef struct
+{
+    BOOL lost;                           /*!< The link was lost below the sensitivity */
+    CHAR ssid[64];
+} rf_report_t;
+
+/* BSSIDs are copied from 64 byte fields into 18 byte ones, so the copy is bounded by the destination */
+static void rf_copy(CHAR *dst, size_t size, const CHAR *src)
+{
+    snprintf(dst, size, "%.*s", (int)(size - 1), src);
+}
+
+static void rf_defaults(wifi_sim_rf_t *rf)
+{
+    memset(rf, 0, sizeof(*rf));
+    rf->enable = FALSE;
+    rf->realtime = TRUE;
+    rf->tick_ms = 100;
+    rf->seed = 1;
+    rf->ref_loss_db = 40.0;
+    rf->path_loss_exponent = 3.0;
+    rf->fading_sigma_db = 4.0;
+    rf->fading_correlation = 0.9;
+    rf->noise_floor_dbm = -92;
+    rf->noise_sigma_db = 1.0;
+    rf->utilization_sigma = 5.0;
+    rf->sensitivity_dbm = -90;
+    rf->roam_second_ms = 1000;
+}
+
+/* splitmix64, caller holds sim_state.lock */
+static uint64_t rf_next(void)
+{
+    uint64_t z = (sim_state.rf_rng += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/* Standard normal draw (Box-Muller), caller holds sim_state.lock */
+static double rf_gauss(void)
+{
+    double u1 = ((double)(rf_next() >> 11) + 1.0) / 9007199254740993.0;
+    double u2 = (double)(rf_next() >> 11) / 9007199254740992.0;
+
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+/* Model time in milliseconds, caller holds sim_state.lock */
+static uint64_t rf_now_ms_locked(void)
+{
+    if (sim_state.rf.realtime)
+    {
+        return (sim_timer_now_ns() - sim_state.rf_started_ns) / 1000000ULL;
+    }
+    return (uint64_t)sim_state.rf_tick * sim_state.rf.tick_ms;
+}
+
+static void rf_position(const wifi_sim_rf_t *rf, uint64_t t_ms, double *x, double *y)
+{
+    const wifi_sim_waypoint_t *path = rf->path;
+    UINT i;
+
+    *x = 0.0;
+    *y = 0.0;
+    if (rf->waypoint_count == 0)
+    {
+        return;
+    }
+    for (i = 1; i < rf->waypoint_count && path[i].t_ms <= t_ms; i++)
+    {
+    }
+    if (i == rf->waypoint_count || t_ms <= path[i - 1].t_ms)
+    {
+        *x = path[i - 1].x_m;
+        *y = path[i - 1].y_m;
+        return;
+    }
+
+    double f = (double)(t_ms - path[i - 1].t_ms) / (double)(path[i].t_ms - path[i - 1].t_ms);
+
+    *x = path[i - 1].x_m + f * (path[i].x_m - path[i - 1].x_m);
+    *y = path[i - 1].y_m + f * (path[i].y_m - path[i - 1].y_m);
+}
+
+/* Index of the access point of the population with this BSSID, -1 if none. Caller holds sim_state.lock */
+static INT rf_find_ap_locked(const CHAR *bssid)
+{
+    for (UINT i = 0; i < sim_state.ap_count; i++)
+    {
+        if (bssid[0] != '\0' && strcmp(sim_state.aps[i].ap_BSSID, bssid) == 0)
+        {
+            return (INT)i;
+        }
+    }
+    return -1;
+}
+
+static BOOL rf_placed_locked(const CHAR *bssid)
+{
+    for (UINT p = 0; p < sim_state.rf.ap_count; p++)
+    {
+        if (bssid[0] != '\0' && strcmp(sim_state.rf.aps[p].bssid, bssid) == 0)
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/* Sets the access points for the current tick, caller holds sim_state.lock */
+static void rf_apply_locked(void)
+{
+    const wifi_sim_rf_t *rf = &sim_state.rf;
+    double rho = rf->fading_correlation;
+    double x;
+    double y;
+
+    rf_position(rf, (uint64_t)sim_state.rf_tick * rf->tick_ms, &x, &y);
+    for (UINT p = 0; p < rf->ap_count; p++)
+    {
+        const wifi_sim_rf_ap_t *place = &rf->aps[p];
+        double fading_draw = rf_gauss();
+        double noise_draw = rf_gauss();
+        double utilization_draw = rf_gauss();
+        double *fading = &sim_state.rf_fading[p];
+        double distance;
+        double rssi;
+        double utilization;
+        wifi_neighbor_ap_t *ap;
+        INT index;
+
+        /* First order autoregressive, so the fading keeps its spread but moves slowly */
+        if (sim_state.rf_tick == 0)
+        {
+            *fading = rf->fading_sigma_db * fading_draw;
+        }
+        else
+        {
+            *fading = rho * *fading + sqrt(1.0 - rho * rho) * rf->fading_sigma_db * fading_draw;
+        }
+
+        index = rf_find_ap_locked(place->bssid);
+        if (index < 0)
+        {
+            continue;
+        }
+        ap = &sim_state.aps[index];
+        distance = fmax(hypot(x - place->x_m, y - place->y_m), 1.0);
+        rssi = place->tx_power_dbm - (rf->ref_loss_db + 10.0 * rf->path_loss_exponent * log10(distance)) + *fading;
+        utilization = fmin(fmax(place->utilization + rf->utilization_sigma * utilization_draw, 0.0), 100.0);
+
+        ap->ap_SignalStrength = (INT)lround(rssi);
+        ap->ap_Noise = (INT)lround(rf->noise_floor_dbm + rf->noise_sigma_db * noise_draw);
+        snprintf(ap->ap_ChannelUtilization, sizeof(ap->ap_ChannelUtilization), "%u", (UINT)lround(utilization));
+        sim_state.ap_hidden[index] = (ap->ap_SignalStrength < rf->sensitivity_dbm);
+    }
+}
+
+void sim_link_rates_locked(void)
+{
+    wifi_sta_stats_t *sta = &sim_state.sta;
+    BOOL is_5g = (sta->sta_Frequency > 5000);
+    INT snr = (INT)lroundf(sta->sta_RSSI - sta->sta_Noise);
+    UINT mcs = 0;
+
+    for (UINT i = 1; i < sizeof(rf_mcs) / sizeof(rf_mcs[0]); i++)
+    {
+        if (snr >= rf_mcs[i].snr_db)
+        {
+            mcs = i;
+        }
+    }
+    /* Below the lowest MCS the link still limps along at it */
+    sta->sta_PhyRate = is_5g ? rf_mcs[mcs].rate_5g : rf_mcs[mcs].rate_24g;
+    sta->sta_LastDataDownlinkRate = (UINT)(sta->sta_PhyRate * 750.0f);
+    sta->sta_LastDataUplinkRate = (UINT)(sta->sta_PhyRate * 500.0f);
+}
+
+/* Carries the access point over to the link or loses it, caller holds sim_state.lock */
+static void rf_link_locked(rf_report_t *report)
+{
+    wifi_sta_stats_t *sta = &sim_state.sta;
+    const wifi_neighbor_ap_t *ap;
+    INT index;
+    INT before;
+
+    if (sim_state.link != SIM_LINK_CONNECTED || !rf_placed_locked(sta->sta_BSSID))
+    {
+        return;
+    }
+    index = rf_find_ap_locked(sta->sta_BSSID);
+    if (index < 0)
+    {
+        return;
+    }
+    ap = &sim_state.aps[index];
+
+    if (sim_state.ap_hidden[index])
+    {
+        sim_state.link_generation++;
+        sim_state.link = SIM_LINK_DISCONNECTED;
+        memset(sta, 0, sizeof(*sta));
+        sim_roam_cancel_locked();
+        sim_state.roam.links_lost++;
+        sim_watch_signal(WIFI_SIM_CHANGE_CONNECTION);
+        report->lost = TRUE;
+        rf_copy(report->ssid, sizeof(report->ssid), sim_state.link_ssid);
+        return;
+    }
+
+    before = (INT)sta->sta_RSSI;
+    sta->sta_RSSI = (FLOAT)ap->ap_SignalStrength;
+    sta->sta_Noise = (FLOAT)ap->ap_Noise;
+    sim_link_rates_locked();
+    if (sim_rssi_bucket(ap->ap_SignalStrength) != sim_rssi_bucket(before))
+    {
+        sim_watch_signal(WIFI_SIM_CHANGE_RSSI);
+    }
+}
+
+/* Strongest other access point of the SSID that clears the roaming delta, caller holds sim_state.lock */
+static const wifi_neighbor_ap_t *roam_candidate_locked(void)
+{
+    const wifi_neighbor_ap_t *best = NULL;
+    INT floor = (INT)sim_state.sta.sta_RSSI + sim_state.roaming.postAssnLevelDeltaConnected;
+
+    for (UINT i = 0; i < sim_state.ap_count; i++)
+    {
+        const wifi_neighbor_ap_t *ap = &sim_state.aps[i];
+
+        if (sim_state.ap_hidden[i] || strcmp(ap->ap_SSID, sim_state.link_ssid) != 0 ||
+            strcmp(ap->ap_BSSID, sim_state.sta.sta_BSSID) == 0 || ap->ap_SignalStrength < floor)
+        {
+            continue;
+        }
+        if (best == NULL || ap->ap_SignalStrength > best->ap_SignalStrength)
+        {
+            best = ap;
+        }
+    }
+    return best;
+}
+
+static void roam_scan_done(void *arg)
+{
+    UINT generation = (UINT)(uintptr_t)arg;
+    const wifi_neighbor_ap_t *target;
+    CHAR ssid[64];
+    CHAR bssid[18];
+    CHAR from[18];
+    CHAR passphrase[128];
+
+    sim_lock();
+    if (generation != sim_state.roam_generation || !sim_state.roam_scanning || sim_state.link != SIM_LINK_CONNECTED)
+    {
+        sim_unlock();
+        return;
+    }
+    sim_state.roam_scanning = FALSE;
+    sim_state.roam_timer = 0;
+
+    target = roam_candidate_locked();
+    if (target == NULL)
+    {
+        uint64_t backoff = (sim_state.roaming.postAssnBackOffTime > 0) ? (uint64_t)sim_state.roaming.postAssnBackOffTime : 0;
+
+        sim_state.roam.failed++;
+        sim_state.roam_below = FALSE;
+        sim_state.roam_backoff_ms = rf_now_ms_locked() + backoff * sim_state.rf.roam_second_ms;
+        sim_unlock();
+        return;
+    }
+
+    /* sim_link_start_locked() overwrites the link and clears the roam flags, not the times */
+    rf_copy(ssid, sizeof(ssid), sim_state.link_ssid);
+    rf_copy(bssid, sizeof(bssid), target->ap_BSSID);
+    rf_copy(from, sizeof(from), sim_state.sta.sta_BSSID);
+    rf_copy(passphrase, sizeof(passphrase), sim_state.link_passphrase);
+    if (sim_link_start_locked(ssid, bssid, passphrase, sim_state.link_security, sim_state.link_save) == RETURN_OK)
+    {
+        sim_state.roam_associating = TRUE;
+        sim_state.roam_scanned_ns = sim_timer_now_ns();
+        rf_copy(sim_state.roam_from, sizeof(sim_state.roam_from), from);
+    }
+    sim_unlock();
+}
+
+/* Number of channels the access points of the SSID are on, caller holds sim_state.lock */
+static UINT roam_channels_locked(void)
+{
+    UINT channels = 0;
+
+    for (UINT i = 0; i < sim_state.ap_count; i++)
+    {
+        BOOL seen = FALSE;
+
+        if (strcmp(sim_state.aps[i].ap_SSID, sim_state.link_ssid) != 0)
+        {
+            continue;
+        }
+        for (UINT j = 0; j < i && !seen; j++)
+        {
+            seen = (strcmp(sim_state.aps[j].ap_SSID, sim_state.link_ssid) == 0 &&
+                    sim_state.aps[j].ap_Channel == sim_state.aps[i].ap_Channel);
+        }
+        if (!seen)
+        {
+            channels++;
+        }
+    }
+    return (channels > 0) ? channels : 1;
+}
+
+/* Post-association self steering, caller holds sim_state.lock */
+static void roam_evaluate_locked(void)
+{
+    const wifi_roamingCtrl_t *ctrl = &sim_state.roaming;
+    uint64_t now_ms = rf_now_ms_locked();
+    uint64_t timeframe;
+
+    if (sim_state.link != SIM_LINK_CONNECTED || !ctrl->roamingEnable || sim_state.roam_scanning)
+    {
+        return;
+    }
+    if ((INT)sim_state.sta.sta_RSSI >= ctrl->postAssnSelfSteerThreshold)
+    {
+        sim_state.roam_below = FALSE;
+        return;
+    }
+    if (!sim_state.roam_below)
+    {
+        sim_state.roam_below = TRUE;
+        sim_state.roam_below_ms = now_ms;
+        sim_state.roam_below_ns = sim_timer_now_ns();
+    }
+
+    timeframe = (ctrl->postAssnSelfSteerTimeframe > 0) ? (uint64_t)ctrl->postAssnSelfSteerTimeframe : 0;
+    if (now_ms - sim_state.roam_below_ms < timeframe * sim_state.rf.roam_second_ms || now_ms < sim_state.roam_backoff_ms)
+    {
+        return;
+    }
+
+    sim_state.roam_generation++;
+    sim_state.roam_timer = sim_timer_start(roam_channels_locked() * sim_state.timing.scan_dwell_ms, roam_scan_done,
+                                           (void *)(uintptr_t)sim_state.roam_generation);
+    if (sim_state.roam_timer != 0)
+    {
+        sim_state.roam_scanning = TRUE;
+        sim_state.roam_triggered_ns = sim_timer_now_ns();
+    }
+}
+
+/* One tick of the model, caller holds sim_state.lock */
+static void rf_tick_locked(rf_report_t *report)
+{
+    rf_apply_locked();
+    rf_link_locked(report);
+    roam_evaluate_locked();
+}
+
+/* Called without sim_state.lock held */
+static void rf_report(const rf_report_t *report)
+{
+    if (report->lost)
+    {
+        sim_notify_connect(report->ssid, WIFI_HAL_ERROR_CONNECTION_LOST);
+    }
+}
+
+static void rf_tick_done(void *arg);
+
+/* Arms the next tick, caller holds sim_state.lock */
+static UINT rf_arm_locked(void)
+{
+    uint64_t tick_ns = (uint64_t)sim_state.rf.tick_ms * 1000000ULL;
+
+    return sim_timer_start_at(sim_state.rf_started_ns + (sim_state.rf_tick + 1) * tick_ns, rf_tick_done,
+                              (void *)(uintptr_t)sim_state.rf_generation);
+}
+
+static void rf_tick_done(void *arg)
+{
+    UINT generation = (UINT)(uintptr_t)arg;
+    rf_report_t report = { 0 };
+
+    sim_lock();
+    if (generation != sim_state.rf_generation || !sim_state.rf.enable || !sim_state.rf.realtime)
+    {
+        sim_unlock();
+        return;
+    }
+    sim_state.rf_tick++;
+    sim_state.rf_timer = rf_arm_locked();
+    rf_tick_locked(&report);
+    sim_unlock();
+
+    rf_report(&report);
+}
+
+void sim_roam_cancel_locked(void)
+{
+    sim_timer_cancel(sim_state.roam_timer);
+    sim_state.roam_timer = 0;
+    sim_state.roam_generation++;
+    sim_state.roam_scanning = FALSE;
+    sim_state.roam_associating = FALSE;
+    sim_state.roam_below = FALSE;
+}
+
+INT sim_roam_connected_locked(void)
+{
+    wifi_sim_roam_t *roam = &sim_state.roam;
+
+    if (!sim_state.roam_associating)
+    {
+        return -1;
+    }
+    sim_state.roam_associating = FALSE;
+    roam->roams++;
+    roam->below_ns = sim_state.roam_below_ns;
+    roam->triggered_ns = sim_state.roam_triggered_ns;
+    roam->scanned_ns = sim_state.roam_scanned_ns;
+    roam->connected_ns = sim_timer_now_ns();
+    rf_copy(roam->from_bssid, sizeof(roam->from_bssid), sim_state.roam_from);
+    rf_copy(roam->to_bssid, sizeof(roam->to_bssid), sim_state.sta.sta_BSSID);
+    return (INT)((roam->connected_ns - roam->triggered_ns) / 1000000ULL);
+}
+
+void sim_rf_reset_locked(void)
+{
+    sim_timer_cancel(sim_state.rf_timer);
+    sim_state.rf_timer = 0;
+    sim_state.rf_generation++;
+    sim_state.rf_tick = 0;
+    rf_defaults(&sim_state.rf);
+    sim_roam_cancel_locked();
+    sim_state.roam_backoff_ms = 0;
+    memset(&sim_state.roam, 0, sizeof(sim_state.roam));
+}
+
+void wifi_sim_get_rf(wifi_sim_rf_t *rf)
+{
+    sim_lock();
+    *rf = sim_state.rf;
+    sim_unlock();
+}
+
+INT wifi_sim_set_rf(const wifi_sim_rf_t *rf)
+{
+    rf_report_t report = { 0 };
+
+    if (rf == NULL || rf->waypoint_count > WIFI_SIM_MAX_WAYPOINTS || rf->ap_count > WIFI_SIM_MAX_APS ||
+        (rf->enable && rf->tick_ms == 0) || rf->fading_correlation < 0.0 || rf->fading_correlation >= 1.0)
+    {
+        return RETURN_ERR;
+    }
+    for (UINT i = 1; i < rf->waypoint_count; i++)
+    {
+        if (rf->path[i].t_ms <= rf->path[i - 1].t_ms)
+        {
+            return RETURN_ERR;
+        }
+    }
+
+    sim_lock();
+    sim_timer_cancel(sim_state.rf_timer);
+    sim_state.rf_timer = 0;
+    sim_state.rf_generation++;
+    sim_state.rf = *rf;
+    sim_roam_cancel_locked();
+    sim_state.roam_backoff_ms = 0;
+    memset(&sim_state.roam, 0, sizeof(sim_state.roam));
+    memset(sim_state.ap_hidden, 0, sizeof(sim_state.ap_hidden));
+
+    if (rf->enable)
+    {
+        sim_state.rf_tick = 0;
+        sim_state.rf_rng = rf->seed;
+        sim_state.rf_started_ns = sim_timer_now_ns();
+        rf_tick_locked(&report);
+        if (rf->realtime)
+        {
+            sim_state.rf_timer = rf_arm_locked();
+        }
+    }
+    sim_unlock();
+
+    rf_report(&report);
+    return RETURN_OK;
+}
+
+INT wifi_sim_rf_step(UINT ticks)
+{
+    rf_report_t report = { 0 };
+
+    sim_lock();
+    if (!sim_state.rf.enable || sim_state.rf.realtime)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    for (UINT i = 0; i < ticks; i++)
+    {
+        sim_state.rf_tick++;
+        rf_tick_locked(&report);
+    }
+    sim_unlock();
+
+    rf_report(&report);
+    return RETURN_OK;
+}
+
+void wifi_sim_get_roam(wifi_sim_roam_t *roam)
+{
+    sim_lock();
+    *roam = sim_state.roam;
+    sim_unlock();
+}
+
+/** @} */ // End of RDKV_WIFI_SIMULATOR
@@ -0,0 +1,177 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_SIMULATOR RDK-V WiFi HAL Simulator
+ * @{
+ */
+
+/**
+* @file wifi_sim_stats.c
+*
+* Statistics store. The getters read a snapshot of the station and traffic
+* statistics under a sequence counter instead of taking sim_state.lock, so
+* any number of readers neither wait for each other nor hold up the thread
+* updating the counters.
+*
+* The only writer is whoever releases sim_state.lock: it makes the counter
+* odd, copies the snapshot in and makes it even again. A reader copies the
+* snapshot between two reads of the counter and repeats if the counter was
+* odd or moved. Both copies go word by word through relaxed atomics, so a
+* reader racing the writer gets a torn copy it throws away rather than a data
+* race.
+*/
+
+#include <sched.h>
+#include <stdint.h>
+#include <string.h>
+#include "wifi_sim_internal.h"
+
+#define SIM_STATS_WORDS ((sizeof(sim_stats_t) + sizeof(uint64_t) - 1) / sizeof(uint64_t))
+
+typedef union
+{
+    sim_stats_t stats;
+    uint64_t word[SIM_STATS_WORDS];
+} sim_stats_words_t;
+
+static uint32_t stats_seq;                   /*!< Odd while a publish is in progress */
+static sim_stats_words_t stats_published;
+static sim_stats_words_t stats_last;         /*!< Writer's copy of stats_published, under sim_state.lock */
+static ULONG stats_publishes;
+static ULONG stats_retries;
+
+void sim_stats_publish_locked(void)
+{
+    sim_stats_words_t next;
+    uint32_t seq;
+
+    memset(&next, 0, sizeof(next));
+    next.stats.initialised = sim_state.initialised;
+    if (sim_state.link == SIM_LINK_CONNECTED)
+    {
+        next.stats.sta = sim_state.sta;
+    }
+    next.stats.radio = sim_state.radio_traffic;
+    next.stats.ssid = sim_state.ssid_traffic;
+
+    /* Most unlocks change nothing the getters see, and readers keep going undisturbed */
+    if (memcmp(&next, &stats_last, sizeof(next)) == 0)
+    {
+        return;
+    }
+    stats_last = next;
+
+    seq = __atomic_load_n(&stats_seq, __ATOMIC_RELAXED);
+    __atomic_store_n(&stats_seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    for (size_t i = 0; i < SIM_STATS_WORDS; i++)
+    {
+        __atomic_store_n(&stats_published.word[i], next.word[i], __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&stats_seq, seq + 2, __ATOMIC_RELEASE);
+    __atomic_add_fetch(&stats_publishes, 1, __ATOMIC_RELAXED);
+}
+
+void sim_stats_read(sim_stats_t *stats)
+{
+    sim_stats_words_t copy;
+
+    for (;;)
+    {
+        uint32_t before = __atomic_load_n(&stats_seq, __ATOMIC_ACQUIRE);
+
+        if ((before & 1) == 0)
+        {
+            for (size_t i = 0; i < SIM_STATS_WORDS; i++)
+            {
+                copy.word[i] = __atomic_load_n(&stats_published.word[i], __ATOMIC_RELAXED);
+            }
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (__atomic_load_n(&stats_seq, __ATOMIC_RELAXED) == before)
+            {
+                break;
+            }
+        }
+        __atomic_add_fetch(&stats_retries, 1, __ATOMIC_RELAXED);
+        /* The writer may have been preempted halfway, let it finish */
+        sched_yield();
+    }
+    *stats = copy.stats;
+}
+
+void sim_traffic_add_locked(const wifi_sim_traffic_t *traffic)
+{
+    wifi_radioTrafficStats_t *radio = &sim_state.radio_traffic;
+    wifi_ssidTrafficStats_t *ssid = &sim_state.ssid_traffic;
+
+    radio->radio_BytesSent += traffic->bytes_sent;
+    radio->radio_BytesReceived += traffic->bytes_received;
+    radio->radio_PacketsSent += traffic->packets_sent;
+    radio->radio_PacketsReceived += traffic->packets_received;
+    radio->radio_ErrorsSent += traffic->errors_sent;
+    radio->radio_ErrorsReceived += traffic->errors_received;
+    radio->radio_DiscardPacketsSent += traffic->discards_sent;
+    radio->radio_DiscardPacketsReceived += traffic->discards_received;
+
+    ssid->ssid_BytesSent += traffic->bytes_sent;
+    ssid->ssid_BytesReceived += traffic->bytes_received;
+    ssid->ssid_PacketsSent += traffic->packets_sent;
+    ssid->ssid_PacketsReceived += traffic->packets_received;
+    ssid->ssid_RetransCount += traffic->retransmissions;
+    ssid->ssid_ErrorsSent += traffic->errors_sent;
+    ssid->ssid_ErrorsReceived += traffic->errors_received;
+    ssid->ssid_UnicastPacketsSent += traffic->packets_sent - traffic->multicast_sent;
+    ssid->ssid_UnicastPacketsReceived += traffic->packets_received - traffic->multicast_received;
+    ssid->ssid_DiscardedPacketsSent += traffic->discards_sent;
+    ssid->ssid_DiscardedPacketsReceived += traffic->discards_received;
+    ssid->ssid_MulticastPacketsSent += traffic->multicast_sent;
+    ssid->ssid_MulticastPacketsReceived += traffic->multicast_received;
+
+    if (sim_state.link == SIM_LINK_CONNECTED)
+    {
+        sim_state.sta.sta_Retransmissions += (UINT)traffic->retransmissions;
+    }
+}
+
+INT wifi_sim_add_traffic(const wifi_sim_traffic_t *traffic)
+{
+    if (traffic == NULL || traffic->multicast_sent > traffic->packets_sent ||
+        traffic->multicast_received > traffic->packets_received)
+    {
+        return RETURN_ERR;
+    }
+
+    sim_lock();
+    if (!sim_state.initialised)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    sim_traffic_add_locked(traffic);
+    sim_unlock();
+    return RETURN_OK;
+}
+
+void wifi_sim_get_store_stats(wifi_sim_store_stats_t *stats)
+{
+    stats->publishes = __atomic_load_n(&stats_publishes, __ATOMIC_RELAXED);
+    stats->retries = __atomic_load_n(&stats_retries, __ATOMIC_RELAXED);
+}
+
+/** @} */ // End of RDKV_WIFI_SIMULATOR
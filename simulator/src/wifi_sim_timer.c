@@ -0,0 +1,245 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_SIMULATOR RDK-V WiFi HAL Simulator
+ * @{
+ */
+
+/**
+* @file wifi_sim_timer.c
+*
+* One-shot timers on a single event loop thread. Each timer slot owns a
+* timerfd registered once with an epoll instance, and the loop thread sleeps
+* in epoll_wait() until one of them expires. Every delayed event of the
+* simulator is one of these timers, so all completions are serialised on the
+* loop the way a driver event loop would serialise them, and each fires at its
+* own CLOCK_MONOTONIC deadline without a thread or condition variable per
+* event.
+*/
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+#include "wifi_sim_internal.h"
+
+#define SIM_MAX_TIMERS 32
+
+typedef struct
+{
+    UINT id;                 /*!< 0 when the slot is free */
+    int fd;                  /*!< timerfd, -1 if it could not be created */
+    uint64_t deadline_ns;
+    sim_timer_fn fn;
+    void *arg;
+} sim_timer_t;
+
+static pthread_mutex_t timer_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t timer_once = PTHREAD_ONCE_INIT;
+static int timer_epoll = -1;
+static sim_timer_t timers[SIM_MAX_TIMERS];
+static UINT timer_next_id = 1;
+
+uint64_t sim_timer_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Arms the timerfd of a slot for its deadline, or disarms it for 0; caller holds timer_lock */
+static void timer_arm_locked(sim_timer_t *timer, uint64_t deadline_ns)
+{
+    struct itimerspec spec = { { 0, 0 }, { 0, 0 } };
+
+    if (deadline_ns != 0)
+    {
+        /* An it_value of zero would disarm, a deadline already passed fires at once */
+        spec.it_value.tv_sec = (time_t)(deadline_ns / 1000000000ULL);
+        spec.it_value.tv_nsec = (long)(deadline_ns % 1000000000ULL);
+    }
+    timerfd_settime(timer->fd, (deadline_ns != 0) ? TFD_TIMER_ABSTIME : 0, &spec, NULL);
+}
+
+/*
+ * Takes the earliest expired timer off the table, caller holds timer_lock.
+ * Timers that expire together fire in deadline order, whatever order epoll
+ * reported them in.
+ */
+static sim_timer_t *timer_take_expired_locked(uint64_t now_ns)
+{
+    sim_timer_t *earliest = NULL;
+
+    for (int i = 0; i < SIM_MAX_TIMERS; i++)
+    {
+        if (timers[i].id != 0 && timers[i].deadline_ns <= now_ns &&
+            (earliest == NULL || timers[i].deadline_ns < earliest->deadline_ns))
+        {
+            earliest = &timers[i];
+        }
+    }
+    return earliest;
+}
+
+static void *timer_thread(void *arg)
+{
+    struct epoll_event events[SIM_MAX_TIMERS];
+
+    (void)arg;
+
+    for (;;)
+    {
+        int count = epoll_wait(timer_epoll, events, SIM_MAX_TIMERS, -1);
+
+        if (count < 0)
+        {
+            if (errno != EINTR)
+            {
+                break;
+            }
+            continue;
+        }
+
+        pthread_mutex_lock(&timer_lock);
+        for (int i = 0; i < count; i++)
+        {
+            uint64_t expirations;
+
+            /* Clears the readiness; a timer rearmed or cancelled since reads nothing */
+            (void)!read(timers[events[i].data.u32].fd, &expirations, sizeof(expirations));
+        }
+        for (;;)
+        {
+            sim_timer_t *next = timer_take_expired_locked(sim_timer_now_ns());
+            sim_timer_t fired;
+
+            if (next == NULL)
+            {
+                break;
+            }
+            fired = *next;
+            next->id = 0;
+            timer_arm_locked(next, 0);
+            pthread_mutex_unlock(&timer_lock);
+            fired.fn(fired.arg);
+            pthread_mutex_lock(&timer_lock);
+        }
+        pthread_mutex_unlock(&timer_lock);
+    }
+    return NULL;
+}
+
+static void timer_setup(void)
+{
+    pthread_t thread;
+
+    timer_epoll = epoll_create1(EPOLL_CLOEXEC);
+    for (int i = 0; i < SIM_MAX_TIMERS; i++)
+    {
+        struct epoll_event event = { .events = EPOLLIN, .data.u32 = (uint32_t)i };
+
+        timers[i].fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (timers[i].fd >= 0 && (timer_epoll < 0 || epoll_ctl(timer_epoll, EPOLL_CTL_ADD, timers[i].fd, &event) != 0))
+        {
+            close(timers[i].fd);
+            timers[i].fd = -1;
+        }
+    }
+    if (timer_epoll >= 0 && pthread_create(&thread, NULL, timer_thread, NULL) == 0)
+    {
+        pthread_detach(thread);
+    }
+}
+
+UINT sim_timer_start_at(uint64_t deadline_ns, sim_timer_fn fn, void *arg)
+{
+    UINT id = 0;
+
+    pthread_once(&timer_once, timer_setup);
+
+    pthread_mutex_lock(&timer_lock);
+    for (int i = 0; i < SIM_MAX_TIMERS; i++)
+    {
+        if (timers[i].id == 0 && timers[i].fd >= 0)
+        {
+            id = timer_next_id++;
+            if (timer_next_id == 0)
+            {
+                timer_next_id = 1;
+            }
+            timers[i].id = id;
+            timers[i].deadline_ns = deadline_ns;
+            timers[i].fn = fn;
+            timers[i].arg = arg;
+            timer_arm_locked(&timers[i], (deadline_ns != 0) ? deadline_ns : 1);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&timer_lock);
+    return id;
+}
+
+UINT sim_timer_start(UINT delay_ms, sim_timer_fn fn, void *arg)
+{
+    return sim_timer_start_at(sim_timer_now_ns() + (uint64_t)delay_ms * 1000000ULL, fn, arg);
+}
+
+BOOL sim_timer_cancel(UINT id)
+{
+    BOOL cancelled = FALSE;
+
+    if (id == 0)
+    {
+        return FALSE;
+    }
+
+    pthread_mutex_lock(&timer_lock);
+    for (int i = 0; i < SIM_MAX_TIMERS; i++)
+    {
+        if (timers[i].id == id)
+        {
+            timers[i].id = 0;
+            timer_arm_locked(&timers[i], 0);
+            cancelled = TRUE;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&timer_lock);
+    return cancelled;
+}
+
+void sim_timer_cancel_all(void)
+{
+    pthread_mutex_lock(&timer_lock);
+    for (int i = 0; i < SIM_MAX_TIMERS; i++)
+    {
+        if (timers[i].id != 0)
+        {
+            timers[i].id = 0;
+            timer_arm_locked(&timers[i], 0);
+        }
+    }
+    pthread_mutex_unlock(&timer_lock);
+}
+
+/** @} */ // End of RDKV_WIFI_SIMULATOR
@@ -0,0 +1,406 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_SIMULATOR RDK-V WiFi HAL Simulator
+ * @{
+ */
+
+/**
+* @file wifi_sim_traffic.c
+*
+* Workload model. A tick works out the data the workload downloads in it,
+* turns data, requests and background multicast into frames and adds them to
+* the traffic counters, keeping the sum as ground truth for the tests.
+*
+* Fractional frames of the ratios and of the multicast rate are carried from
+* tick to tick, so the counts over any run are the configured ratios rounded
+* down once rather than on every tick.
+*/
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wifi_sim_internal.h"
+
+#define WORKLOAD_ACK_BYTES 66
+#define WORKLOAD_REQUEST_BYTES 400
+#define WORKLOAD_MULTICAST_BYTES 200
+
+static void workload_defaults(wifi_sim_workload_t *w)
+{
+    static const UINT ladder[] = { 4000, 8000, 12000, 16000, 25000 };
+
+    memset(w, 0, sizeof(*w));
+    w->enable = FALSE;
+    w->realtime = TRUE;
+    w->tick_ms = 100;
+    w->seed = 1;
+    w->kind = WIFI_SIM_WORKLOAD_VIDEO;
+    w->rendition_count = sizeof(ladder) / sizeof(ladder[0]);
+    memcpy(w->renditions_kbps, ladder, sizeof(ladder));
+    w->segment_ms = 2000;
+    w->buffer_ms = 10000;
+    w->abr_percent = 80;
+    w->page_kbytes = 2000;
+    w->think_ms = 10000;
+    w->multicast_pps = 20;
+    w->mtu = 1500;
+    w->retry_ratio = 0.05;
+    w->discard_ratio = 0.001;
+}
+
+/* splitmix64, caller holds sim_state.lock */
+static uint64_t workload_next(void)
+{
+    uint64_t z = (sim_state.workload_rng += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/* Exponential draw around a mean, caller holds sim_state.lock */
+static double workload_exponential(double mean)
+{
+    double u = ((double)(workload_next() >> 11) + 1.0) / 9007199254740993.0;
+
+    return -mean * log(u);
+}
+
+/* Download throughput left by the channel utilisation of the access point of the link, caller holds sim_state.lock */
+static uint64_t workload_free_kbps_locked(void)
+{
+    INT utilization = 0;
+
+    for (UINT i = 0; i < sim_state.ap_count; i++)
+    {
+        if (strcmp(sim_state.aps[i].ap_BSSID, sim_state.sta.sta_BSSID) == 0)
+        {
+            utilization = atoi(sim_state.aps[i].ap_ChannelUtilization);
+            break;
+        }
+    }
+    if (utilization < 0)
+    {
+        utilization = 0;
+    }
+    else if (utilization > 100)
+    {
+        utilization = 100;
+    }
+    return (uint64_t)sim_state.sta.sta_LastDataDownlinkRate * (uint64_t)(100 - utilization) / 100;
+}
+
+/* Highest rendition within abr_percent of the free throughput, or the lowest, caller holds sim_state.lock */
+static UINT workload_rendition_locked(uint64_t free_kbps)
+{
+    const wifi_sim_workload_t *w = &sim_state.workload;
+    UINT kbps = w->renditions_kbps[0];
+
+    for (UINT i = 1; i < w->rendition_count; i++)
+    {
+        if ((uint64_t)w->renditions_kbps[i] * 100 <= free_kbps * w->abr_percent)
+        {
+            kbps = w->renditions_kbps[i];
+        }
+    }
+    return kbps;
+}
+
+/* Caller holds sim_state.lock */
+static void workload_video_locked(BOOL linked, uint64_t free_kbps, uint64_t budget, uint64_t *data, ULONG *requests)
+{
+    const wifi_sim_workload_t *w = &sim_state.workload;
+    wifi_sim_workload_state_t *st = &sim_state.workload_state;
+
+    if (linked && sim_state.workload_left == 0 && st->buffer_ms + w->segment_ms <= w->buffer_ms)
+    {
+        UINT kbps = workload_rendition_locked(free_kbps);
+
+        if (st->rendition_kbps != 0 && kbps != st->rendition_kbps)
+        {
+            st->switches++;
+        }
+        st->rendition_kbps = kbps;
+        sim_state.workload_left = (uint64_t)kbps * w->segment_ms / 8;
+        (*requests)++;
+    }
+    if (linked && sim_state.workload_left > 0)
+    {
+        uint64_t bytes = (budget < sim_state.workload_left) ? budget : sim_state.workload_left;
+
+        sim_state.workload_left -= bytes;
+        *data += bytes;
+        if (sim_state.workload_left == 0)
+        {
+            st->segments++;
+            st->buffer_ms += w->segment_ms;
+        }
+    }
+
+    /* Playback starts, and resumes after a stall, with one segment buffered */
+    if (sim_state.workload_playing)
+    {
+        if (st->buffer_ms == 0)
+        {
+            sim_state.workload_playing = FALSE;
+            st->stalls++;
+        }
+        else
+        {
+            st->buffer_ms -= (st->buffer_ms < w->tick_ms) ? st->buffer_ms : w->tick_ms;
+        }
+    }
+    else if (st->buffer_ms >= w->segment_ms)
+    {
+        sim_state.workload_playing = TRUE;
+    }
+}
+
+/* Caller holds sim_state.lock */
+static void workload_web_locked(BOOL linked, uint64_t budget, uint64_t *data, ULONG *requests)
+{
+    const wifi_sim_workload_t *w = &sim_state.workload;
+    wifi_sim_workload_state_t *st = &sim_state.workload_state;
+
+    if (sim_state.workload_left == 0)
+    {
+        if (sim_state.workload_think_ms > w->tick_ms)
+        {
+            sim_state.workload_think_ms -= w->tick_ms;
+            return;
+        }
+        sim_state.workload_think_ms = 0;
+        if (!linked)
+        {
+            return;
+        }
+        sim_state.workload_left = (uint64_t)workload_exponential((double)w->page_kbytes * 1024.0) + 1;
+        (*requests)++;
+    }
+    if (linked)
+    {
+        uint64_t bytes = (budget < sim_state.workload_left) ? budget : sim_state.workload_left;
+
+        sim_state.workload_left -= bytes;
+        *data += bytes;
+        if (sim_state.workload_left == 0)
+        {
+            st->pages++;
+            sim_state.workload_think_ms = (UINT)workload_exponential((double)w->think_ms);
+        }
+    }
+}
+
+/* Takes whole frames out of a carry, caller holds sim_state.lock */
+static ULONG workload_take(double *carry, double add)
+{
+    ULONG whole;
+
+    *carry += add;
+    whole = (ULONG)*carry;
+    *carry -= (double)whole;
+    return whole;
+}
+
+static void workload_sum(wifi_sim_traffic_t *total, const wifi_sim_traffic_t *t)
+{
+    total->bytes_sent += t->bytes_sent;
+    total->bytes_received += t->bytes_received;
+    total->packets_sent += t->packets_sent;
+    total->packets_received += t->packets_received;
+    total->multicast_sent += t->multicast_sent;
+    total->multicast_received += t->multicast_received;
+    total->retransmissions += t->retransmissions;
+    total->errors_sent += t->errors_sent;
+    total->errors_received += t->errors_received;
+    total->discards_sent += t->discards_sent;
+    total->discards_received += t->discards_received;
+}
+
+/* One tick of the model, caller holds sim_state.lock */
+static void workload_tick_locked(void)
+{
+    const wifi_sim_workload_t *w = &sim_state.workload;
+    BOOL linked = (sim_state.initialised && sim_state.link == SIM_LINK_CONNECTED) ? TRUE : FALSE;
+    uint64_t free_kbps = linked ? workload_free_kbps_locked() : 0;
+    uint64_t budget = free_kbps * w->tick_ms / 8;
+    uint64_t data = 0;
+    uint64_t frames_before;
+    uint64_t frames_after;
+    ULONG requests = 0;
+    ULONG multicast;
+    wifi_sim_traffic_t t = { 0 };
+
+    sim_state.workload_state.ticks++;
+    switch (w->kind)
+    {
+        case WIFI_SIM_WORKLOAD_VIDEO:
+            workload_video_locked(linked, free_kbps, budget, &data, &requests);
+            break;
+        case WIFI_SIM_WORKLOAD_WEB:
+            workload_web_locked(linked, budget, &data, &requests);
+            break;
+        default:
+            break;
+    }
+    if (!linked)
+    {
+        return;
+    }
+
+    frames_before = (sim_state.workload_data + w->mtu - 1) / w->mtu;
+    sim_state.workload_data += data;
+    frames_after = (sim_state.workload_data + w->mtu - 1) / w->mtu;
+    multicast = workload_take(&sim_state.workload_multicast_carry, (double)w->multicast_pps * w->tick_ms / 1000.0);
+
+    t.bytes_received = data + (uint64_t)multicast * WORKLOAD_MULTICAST_BYTES;
+    t.packets_received = (ULONG)(frames_after - frames_before) + multicast;
+    t.multicast_received = multicast;
+    /* Delayed acknowledgement: one for every second data frame since the model started */
+    t.packets_sent = (ULONG)(frames_after / 2 - frames_before / 2) + requests;
+    t.bytes_sent = (ULONG)(frames_after / 2 - frames_before / 2) * WORKLOAD_ACK_BYTES + requests * WORKLOAD_REQUEST_BYTES;
+    t.retransmissions = workload_take(&sim_state.workload_retry_carry,
+                                      w->retry_ratio * (double)(t.packets_sent + t.packets_received));
+    t.discards_received = workload_take(&sim_state.workload_discard_carry, w->discard_ratio * (double)t.packets_received);
+
+    sim_traffic_add_locked(&t);
+    workload_sum(&sim_state.workload_state.total, &t);
+}
+
+static void workload_tick_done(void *arg);
+
+/* Arms the next tick, caller holds sim_state.lock */
+static UINT workload_arm_locked(void)
+{
+    uint64_t tick_ns = (uint64_t)sim_state.workload.tick_ms * 1000000ULL;
+
+    return sim_timer_start_at(sim_state.workload_started_ns + (sim_state.workload_state.ticks + 1) * tick_ns,
+                              workload_tick_done, (void *)(uintptr_t)sim_state.workload_generation);
+}
+
+static void workload_tick_done(void *arg)
+{
+    UINT generation = (UINT)(uintptr_t)arg;
+
+    sim_lock();
+    if (generation != sim_state.workload_generation || !sim_state.workload.enable || !sim_state.workload.realtime)
+    {
+        sim_unlock();
+        return;
+    }
+    workload_tick_locked();
+    sim_state.workload_timer = workload_arm_locked();
+    sim_unlock();
+}
+
+/* Restarts the model and its ground truth, caller holds sim_state.lock */
+static void workload_restart_locked(void)
+{
+    sim_timer_cancel(sim_state.workload_timer);
+    sim_state.workload_timer = 0;
+    sim_state.workload_generation++;
+    memset(&sim_state.workload_state, 0, sizeof(sim_state.workload_state));
+    sim_state.workload_rng = sim_state.workload.seed;
+    sim_state.workload_playing = FALSE;
+    sim_state.workload_left = 0;
+    sim_state.workload_think_ms = 0;
+    sim_state.workload_data = 0;
+    sim_state.workload_multicast_carry = 0.0;
+    sim_state.workload_retry_carry = 0.0;
+    sim_state.workload_discard_carry = 0.0;
+}
+
+void sim_workload_reset_locked(void)
+{
+    workload_defaults(&sim_state.workload);
+    workload_restart_locked();
+}
+
+void wifi_sim_get_workload(wifi_sim_workload_t *workload)
+{
+    sim_lock();
+    *workload = sim_state.workload;
+    sim_unlock();
+}
+
+INT wifi_sim_set_workload(const wifi_sim_workload_t *workload)
+{
+    if (workload == NULL || workload->rendition_count > WIFI_SIM_MAX_RENDITIONS || workload->retry_ratio < 0.0 ||
+        workload->retry_ratio > 1.0 || workload->discard_ratio < 0.0 || workload->discard_ratio > 1.0)
+    {
+        return RETURN_ERR;
+    }
+    if (workload->enable && (workload->tick_ms == 0 || workload->mtu == 0))
+    {
+        return RETURN_ERR;
+    }
+    if (workload->enable && workload->kind == WIFI_SIM_WORKLOAD_VIDEO &&
+        (workload->rendition_count == 0 || workload->segment_ms == 0))
+    {
+        return RETURN_ERR;
+    }
+    for (UINT i = 1; i < workload->rendition_count; i++)
+    {
+        if (workload->renditions_kbps[i] <= workload->renditions_kbps[i - 1])
+        {
+            return RETURN_ERR;
+        }
+    }
+
+    sim_lock();
+    sim_state.workload = *workload;
+    workload_restart_locked();
+    if (workload->enable)
+    {
+        sim_state.workload_started_ns = sim_timer_now_ns();
+        if (workload->realtime)
+        {
+            sim_state.workload_timer = workload_arm_locked();
+        }
+    }
+    sim_unlock();
+    return RETURN_OK;
+}
+
+INT wifi_sim_workload_step(UINT ticks)
+{
+    sim_lock();
+    if (!sim_state.workload.enable || sim_state.workload.realtime)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    for (UINT i = 0; i < ticks; i++)
+    {
+        workload_tick_locked();
+    }
+    sim_unlock();
+    return RETURN_OK;
+}
+
+void wifi_sim_get_workload_state(wifi_sim_workload_state_t *state)
+{
+    sim_lock();
+    *state = sim_state.workload_state;
+    sim_unlock();
+}
+
+/** @} */ // End of RDKV_WIFI_SIMULATOR
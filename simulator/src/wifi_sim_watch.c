@@ -0,0 +1,156 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_SIMULATOR RDK-V WiFi HAL Simulator
+ * @{
+ */
+
+/**
+* @file wifi_sim_watch.c
+*
+* Change watchers. Each is an eventfd with the changes it asked for and the
+* changes seen since it was last read. The eventfd is written only when the
+* pending set goes from empty to not empty, so a burst of changes costs the
+* watcher one wakeup.
+*/
+
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include "wifi_sim_internal.h"
+
+typedef struct
+{
+    INT fd;                  /*!< -1 when the slot is free */
+    UINT changes;            /*!< Changes the watcher asked for */
+    UINT pending;            /*!< Changes since the last wifi_sim_watch_read() */
+} sim_watcher_t;
+
+/* Taken after sim_state.lock where both are held */
+static pthread_mutex_t watch_lock = PTHREAD_MUTEX_INITIALIZER;
+static sim_watcher_t watchers[WIFI_SIM_MAX_WATCHERS] = {
+    [0 ... WIFI_SIM_MAX_WATCHERS - 1] = { .fd = -1 },
+};
+
+INT sim_rssi_bucket(INT rssi)
+{
+    /* Truncates towards 0, so -50 to -59 dBm share a bucket */
+    return rssi / WIFI_SIM_RSSI_BUCKET_DB;
+}
+
+void sim_watch_signal(UINT changes)
+{
+    static const uint64_t one = 1;
+
+    pthread_mutex_lock(&watch_lock);
+    for (int i = 0; i < WIFI_SIM_MAX_WATCHERS; i++)
+    {
+        UINT bits = changes & watchers[i].changes;
+
+        if (watchers[i].fd < 0 || bits == 0)
+        {
+            continue;
+        }
+        if (watchers[i].pending == 0)
+        {
+            (void)!write(watchers[i].fd, &one, sizeof(one));
+        }
+        watchers[i].pending |= bits;
+    }
+    pthread_mutex_unlock(&watch_lock);
+}
+
+INT wifi_sim_watch_open(UINT changes)
+{
+    INT fd = -1;
+
+    if ((changes & WIFI_SIM_CHANGE_ALL) == 0)
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(&watch_lock);
+    for (int i = 0; i < WIFI_SIM_MAX_WATCHERS; i++)
+    {
+        if (watchers[i].fd < 0)
+        {
+            fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (fd >= 0)
+            {
+                watchers[i].fd = fd;
+                watchers[i].changes = changes & WIFI_SIM_CHANGE_ALL;
+                watchers[i].pending = 0;
+            }
+            break;
+        }
+    }
+    pthread_mutex_unlock(&watch_lock);
+    return fd;
+}
+
+UINT wifi_sim_watch_read(INT fd)
+{
+    UINT pending = 0;
+
+    if (fd < 0)
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock(&watch_lock);
+    for (int i = 0; i < WIFI_SIM_MAX_WATCHERS; i++)
+    {
+        if (watchers[i].fd == fd)
+        {
+            uint64_t count;
+
+            /* Cleared together under the lock, so a later change writes the eventfd again */
+            (void)!read(fd, &count, sizeof(count));
+            pending = watchers[i].pending;
+            watchers[i].pending = 0;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&watch_lock);
+    return pending;
+}
+
+void wifi_sim_watch_close(INT fd)
+{
+    if (fd < 0)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&watch_lock);
+    for (int i = 0; i < WIFI_SIM_MAX_WATCHERS; i++)
+    {
+        if (watchers[i].fd == fd)
+        {
+            close(fd);
+            watchers[i].fd = -1;
+            watchers[i].pending = 0;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&watch_lock);
+}
+
+/** @} */ // End of RDKV_WIFI_SIMULATOR
@@ -0,0 +1,208 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_SIMULATOR RDK-V WiFi HAL Simulator
+ * @{
+ */
+
+/**
+* @file wifi_sim_wps.c
+*
+* WPS enrollee sessions against the simulated registrar. A session holds the
+* radio from the push button or PIN call until the credential is delivered,
+* the registrar rejects the PIN, the walk time expires or the session is
+* cancelled. Cancelling returns at once and frees the radio after cancel_ms.
+*/
+
+#include <ctype.h>
+#include <stdint.h>
+#include <string.h>
+#include "wifi_sim_internal.h"
+
+void sim_wps_reset_locked(void)
+{
+    sim_timer_cancel(sim_state.wps_timer);
+    sim_state.wps_timer = 0;
+    sim_state.wps_generation++;
+    sim_state.wps = WIFI_SIM_WPS_IDLE;
+    sim_state.wps_accept = FALSE;
+}
+
+static void wps_registrar_done(void *arg)
+{
+    UINT generation = (UINT)(uintptr_t)arg;
+    wifi_sim_registrar_t registrar;
+    BOOL accept;
+
+    sim_lock();
+    if (generation != sim_state.wps_generation || sim_state.wps != WIFI_SIM_WPS_ACTIVE)
+    {
+        sim_unlock();
+        return;
+    }
+    accept = sim_state.wps_accept;
+    registrar = sim_state.registrar;
+    sim_state.wps_timer = 0;
+    sim_state.wps = WIFI_SIM_WPS_IDLE;
+    if (accept &&
+        sim_link_start_locked(registrar.ssid, NULL, registrar.passphrase, WIFI_SECURITY_WPA2_PSK_AES, TRUE) != RETURN_OK)
+    {
+        accept = FALSE;
+    }
+    sim_unlock();
+
+    /* On success the connect callback follows once the station has associated */
+    if (!accept)
+    {
+        sim_notify_connect(registrar.ssid, WIFI_HAL_ERROR_INVALID_CREDENTIALS);
+    }
+}
+
+static void wps_walk_timeout(void *arg)
+{
+    UINT generation = (UINT)(uintptr_t)arg;
+
+    sim_lock();
+    if (generation != sim_state.wps_generation || sim_state.wps != WIFI_SIM_WPS_ACTIVE)
+    {
+        sim_unlock();
+        return;
+    }
+    sim_state.wps_timer = 0;
+    sim_state.wps = WIFI_SIM_WPS_IDLE;
+    sim_unlock();
+
+    sim_notify_connect("", WIFI_HAL_ERROR_TIMEOUT_EXPIRED);
+}
+
+static void wps_cancel_done(void *arg)
+{
+    UINT generation = (UINT)(uintptr_t)arg;
+
+    sim_lock();
+    if (generation == sim_state.wps_generation && sim_state.wps == WIFI_SIM_WPS_CANCELLING)
+    {
+        sim_state.wps_timer = 0;
+        sim_state.wps = WIFI_SIM_WPS_IDLE;
+    }
+    sim_unlock();
+}
+
+/* Caller holds sim_state.lock */
+static INT wps_start_locked(UINT response_ms, BOOL accept)
+{
+    if (!sim_state.initialised || sim_state.wps != WIFI_SIM_WPS_IDLE)
+    {
+        return RETURN_ERR;
+    }
+
+    sim_state.wps_generation++;
+    sim_state.wps = WIFI_SIM_WPS_ACTIVE;
+    sim_state.wps_accept = accept;
+    if (sim_state.registrar.present)
+    {
+        sim_state.wps_timer = sim_timer_start(response_ms, wps_registrar_done, (void *)(uintptr_t)sim_state.wps_generation);
+    }
+    else
+    {
+        sim_state.wps_timer = sim_timer_start(sim_state.registrar.walk_time_ms, wps_walk_timeout,
+                                              (void *)(uintptr_t)sim_state.wps_generation);
+    }
+    if (sim_state.wps_timer == 0)
+    {
+        sim_state.wps = WIFI_SIM_WPS_IDLE;
+        return RETURN_ERR;
+    }
+    return RETURN_OK;
+}
+
+INT wifi_sim_setCliWpsButtonPush(INT ssidIndex)
+{
+    INT ret;
+
+    if (!wifi_sim_valid_ssid(ssidIndex))
+    {
+        return RETURN_ERR;
+    }
+
+    sim_lock();
+    ret = wps_start_locked(sim_state.registrar.pbc_response_ms, TRUE);
+    sim_unlock();
+    return ret;
+}
+
+/* Enrollee PINs are 4 or 8 decimal digits */
+static BOOL wps_pin_valid(const CHAR *pin)
+{
+    size_t len = strlen(pin);
+
+    if (len != 4 && len != 8)
+    {
+        return FALSE;
+    }
+    for (size_t i = 0; i < len; i++)
+    {
+        if (!isdigit((unsigned char)pin[i]))
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+INT wifi_sim_setCliWpsEnrolleePin(INT ssidIndex, CHAR *EnrolleePin)
+{
+    INT ret;
+
+    if (!wifi_sim_valid_ssid(ssidIndex) || EnrolleePin == NULL || !wps_pin_valid(EnrolleePin))
+    {
+        return RETURN_ERR;
+    }
+
+    sim_lock();
+    ret = wps_start_locked(sim_state.registrar.pin_response_ms, strcmp(EnrolleePin, sim_state.registrar.pin) == 0);
+    sim_unlock();
+    return ret;
+}
+
+INT wifi_sim_cancelWpsPairing(void)
+{
+    sim_lock();
+    if (!sim_state.initialised)
+    {
+        sim_unlock();
+        return RETURN_ERR;
+    }
+    if (sim_state.wps == WIFI_SIM_WPS_ACTIVE)
+    {
+        sim_timer_cancel(sim_state.wps_timer);
+        sim_state.wps_generation++;
+        sim_state.wps = WIFI_SIM_WPS_CANCELLING;
+        sim_state.wps_timer = sim_timer_start(sim_state.registrar.cancel_ms, wps_cancel_done,
+                                              (void *)(uintptr_t)sim_state.wps_generation);
+        if (sim_state.wps_timer == 0)
+        {
+            sim_state.wps = WIFI_SIM_WPS_IDLE;
+        }
+    }
+    sim_unlock();
+    return RETURN_OK;
+}
+
+/** @} */ // End of RDKV_WIFI_SIMULATOR
@@ -64,10 +64,16 @@
 #include <stdlib.h>
 #include <glib.h>
 #include "wifi_common_hal.h"
+#include "wifi_hal_alloc.h"
+#include "wifi_hal_rusage.h"
+#include "wifi_hal_spawn.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_stability.h"
 
 GKeyFile *key_file;
 
 extern int register_hal_l1_tests( void );
+extern int register_hal_l2_tests( void );
 
 int WiFi_InitPreReq(){
     int ret = 0;
@@ -173,13 +179,14 @@ int main(int argc, char** argv)
     UT_init( argc, argv );
     /* Check if tests are registered successfully */
     registerReturn = register_hal_l1_tests();
+    registerReturn |= register_hal_l2_tests();
     if (registerReturn == 0)
     {
-        printf("register_hal_l1_tests() returned success");
+        printf("register_hal_l1_tests() and register_hal_l2_tests() returned success");
     }
     else
     {
-        printf("register_hal_l1_tests() returned failure");
+        printf("register_hal_l1_tests() or register_hal_l2_tests() returned failure");
         return 1;
     }
 
@@ -188,9 +195,24 @@ int main(int argc, char** argv)
         printf("Failed to read /opt/wifi_hal_l1_test_config");
     }
 
+    /* Tracing is enabled by WIFI_HAL_TRACE=<file>, see wifi_hal_trace.h */
+    wifi_trace_init_from_env();
+    /* Heap accounting is enabled by WIFI_HAL_ALLOC=1, see wifi_hal_alloc.h */
+    wifi_alloc_init_from_env();
+    /* Process start detection is enabled by WIFI_HAL_SPAWN=1, see wifi_hal_spawn.h */
+    wifi_spawn_init_from_env();
+    /* Per-call system cost is enabled by WIFI_HAL_RUSAGE=1, see wifi_hal_rusage.h */
+    wifi_rusage_init_from_env();
+    /* The suites run on this thread, WIFI_PERF_CPU and WIFI_PERF_FIFO apply to it and not to their workers, see wifi_perf_stability.h */
+    wifi_perf_stability_init_from_env();
+
     /* Begin test executions */
     UT_run_tests();
 
+    wifi_trace_finish();
+    wifi_alloc_finish();
+    wifi_spawn_finish();
+    wifi_rusage_finish();
     KeyFile_delete(key_file);
 
     return 0;
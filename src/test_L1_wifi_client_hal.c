@@ -68,6 +68,8 @@
 #include <string.h>
 #include <glib.h>
 #include "wifi_client_hal.h"
+#include "wifi_hal_trace.h"
+#include "test_wifi_client_config.h"
 
 #define SSID "AP_SSID"
 #define PSK "PRESHAREDKEY"
@@ -78,21 +80,8 @@
 #define PRIVATE_KEY "PRIVATE_KEY"
 #define WEP_KEY "WEP_KEY"
 
-extern GKeyFile *key_file;
 extern const int SSID_INDEX;
 
-typedef struct _wifi_connectEndpoint_test_config
-{
-    char *ap_SSID;
-    char *WEPKey;
-    char *PreSharedKey;
-    char *KeyPassphrase;
-    char *eapIdentity;
-    char *carootcert;
-    char *clientcert;
-    char *privatekey;
-} wifi_connectEndpoint_test_config_t;
-
 extern int WiFi_InitPreReq(void);
 extern int WiFi_InitWithConfigPreReq(void);
 extern int WiFi_UnInitPosReq(void);
@@ -162,7 +151,7 @@ void Config_delete(wifi_connectEndpoint_test_config_t *l1_config) {
 */
 void test_l1_wifi_client_hal_positive1_wifi_getCliWpsConfigMethodsSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive1_wifi_getCliWpsConfigMethodsSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR methods[] = {"\0"};
 
     UT_LOG("Invoking wifi_getCliWpsConfigMethodsSupported with ssidIndex = 1 and valid buffer for methods\n");
@@ -189,7 +178,7 @@ void test_l1_wifi_client_hal_positive1_wifi_getCliWpsConfigMethodsSupported (voi
         method = strtok(NULL, ",");
     }
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive1_wifi_getCliWpsConfigMethodsSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -212,7 +201,7 @@ void test_l1_wifi_client_hal_positive1_wifi_getCliWpsConfigMethodsSupported (voi
 */
 void test_l1_wifi_client_hal_positive2_wifi_getCliWpsConfigMethodsSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive2_wifi_getCliWpsConfigMethodsSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR methods[] = {"\0"};
     INT res;
 
@@ -240,7 +229,7 @@ void test_l1_wifi_client_hal_positive2_wifi_getCliWpsConfigMethodsSupported (voi
         method = strtok(NULL, ",");
     }
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive2_wifi_getCliWpsConfigMethodsSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -263,7 +252,7 @@ void test_l1_wifi_client_hal_positive2_wifi_getCliWpsConfigMethodsSupported (voi
 */
 void test_l1_wifi_client_hal_negative1_wifi_getCliWpsConfigMethodsSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative1_wifi_getCliWpsConfigMethodsSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = -1;
     CHAR methods[200] = {"\0"};
 
@@ -272,7 +261,7 @@ void test_l1_wifi_client_hal_negative1_wifi_getCliWpsConfigMethodsSupported (voi
     UT_LOG("wifi_getCliWpsConfigMethodsSupported retuns %d", res);
     UT_ASSERT_EQUAL(res, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative1_wifi_getCliWpsConfigMethodsSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -296,7 +285,7 @@ void test_l1_wifi_client_hal_negative1_wifi_getCliWpsConfigMethodsSupported (voi
 */ 
 void test_l1_wifi_client_hal_negative2_wifi_getCliWpsConfigMethodsSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative2_wifi_getCliWpsConfigMethodsSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *methods = NULL;
 
     UT_LOG("Invoking wifi_getCliWpsConfigMethodsSupported with NULL buffer for methods\n");
@@ -304,7 +293,7 @@ void test_l1_wifi_client_hal_negative2_wifi_getCliWpsConfigMethodsSupported (voi
     UT_LOG("wifi_getCliWpsConfigMethodsSupported API returns %d", res);
     UT_ASSERT_EQUAL(res, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative2_wifi_getCliWpsConfigMethodsSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -328,7 +317,7 @@ void test_l1_wifi_client_hal_negative2_wifi_getCliWpsConfigMethodsSupported (voi
 */
 void test_l1_wifi_client_hal_negative3_wifi_getCliWpsConfigMethodsSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative3_wifi_getCliWpsConfigMethodsSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR methods[200] = {"\0"};
 
     UT_LOG("Invoking wifi_getCliWpsConfigMethodsSupported without calling wifi_init()\n");
@@ -336,7 +325,7 @@ void test_l1_wifi_client_hal_negative3_wifi_getCliWpsConfigMethodsSupported (voi
     UT_LOG("wifi_getCliWpsConfigMethodsSupported API returns %d",res);
     UT_ASSERT_EQUAL(res, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative3_wifi_getCliWpsConfigMethodsSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -360,7 +349,7 @@ void test_l1_wifi_client_hal_negative3_wifi_getCliWpsConfigMethodsSupported (voi
  */
 void test_l1_wifi_client_hal_positive1_wifi_getCliWpsConfigMethodsEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive1_wifi_getCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[] = {"\0"};
 
     UT_LOG("Invoking wifi_getCliWpsConfigMethodsEnabled with input parameter ssidIndex=1 and valid output_string buffer\n");
@@ -387,7 +376,7 @@ void test_l1_wifi_client_hal_positive1_wifi_getCliWpsConfigMethodsEnabled (void)
         method = strtok(NULL, ",");
     }
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive1_wifi_getCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -411,7 +400,7 @@ void test_l1_wifi_client_hal_positive1_wifi_getCliWpsConfigMethodsEnabled (void)
  */
 void test_l1_wifi_client_hal_positive2_wifi_getCliWpsConfigMethodsEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive2_wifi_getCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[100] = {"\0"};
     INT return_val;
 
@@ -439,7 +428,7 @@ void test_l1_wifi_client_hal_positive2_wifi_getCliWpsConfigMethodsEnabled (void)
         method = strtok(NULL, ",");
     }
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive2_wifi_getCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -462,7 +451,7 @@ void test_l1_wifi_client_hal_positive2_wifi_getCliWpsConfigMethodsEnabled (void)
 */
 void test_l1_wifi_client_hal_negative1_wifi_getCliWpsConfigMethodsEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative1_wifi_getCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[100] = {"\0"};
 
     UT_LOG("Invoking wifi_getCliWpsConfigMethodsEnabled with input parameter ssidIndex=1 and valid output_string buffer without calling wifi_init or wifi_initWithConfig\n");
@@ -470,7 +459,7 @@ void test_l1_wifi_client_hal_negative1_wifi_getCliWpsConfigMethodsEnabled (void)
     UT_LOG("wifi_getCliWpsConfigMethodsEnabled API returns %d",return_val);
     UT_ASSERT_EQUAL(return_val, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative1_wifi_getCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -493,7 +482,7 @@ void test_l1_wifi_client_hal_negative1_wifi_getCliWpsConfigMethodsEnabled (void)
  */
 void test_l1_wifi_client_hal_negative2_wifi_getCliWpsConfigMethodsEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative2_wifi_getCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = 2;
     CHAR output_string[100] = {"\0"};
 
@@ -502,7 +491,7 @@ void test_l1_wifi_client_hal_negative2_wifi_getCliWpsConfigMethodsEnabled (void)
     UT_LOG("wifi_getCliWpsConfigMethodsEnabled API returns %d",return_val);
     UT_ASSERT_EQUAL(return_val, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative2_wifi_getCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -525,7 +514,7 @@ void test_l1_wifi_client_hal_negative2_wifi_getCliWpsConfigMethodsEnabled (void)
 */
 void test_l1_wifi_client_hal_negative3_wifi_getCliWpsConfigMethodsEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative3_wifi_getCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *output_string = NULL;
 
     UT_LOG("Invoking wifi_getCliWpsConfigMethodsEnabled with input parameter ssidIndex=1 and NULL output_string buffer.\n");
@@ -533,7 +522,7 @@ void test_l1_wifi_client_hal_negative3_wifi_getCliWpsConfigMethodsEnabled (void)
     UT_LOG("wifi_getCliWpsConfigMethodsEnabled API retuns %d",return_val);
     UT_ASSERT_EQUAL(return_val, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative3_wifi_getCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -556,7 +545,7 @@ void test_l1_wifi_client_hal_negative3_wifi_getCliWpsConfigMethodsEnabled (void)
  */
 void test_l1_wifi_client_hal_positive1_wifi_setCliWpsConfigMethodsEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive1_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR* methodString = "USBFlashDrive";
 
     UT_LOG("Invoking wifi_setCliWpsConfigMethodsEnabled with ssidIndex 1 and methodString \"USBFlashDrive\".\n");
@@ -564,7 +553,7 @@ void test_l1_wifi_client_hal_positive1_wifi_setCliWpsConfigMethodsEnabled (void)
     UT_LOG("wifi_setCliWpsConfigMethodsEnabled API returns %d",returnStatus);
     UT_ASSERT_EQUAL(returnStatus, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive1_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -587,7 +576,7 @@ void test_l1_wifi_client_hal_positive1_wifi_setCliWpsConfigMethodsEnabled (void)
  */
 void test_l1_wifi_client_hal_positive2_wifi_setCliWpsConfigMethodsEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive2_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR* methodString = "USBFlashDrive";
     INT returnStatus;
 
@@ -596,7 +585,7 @@ void test_l1_wifi_client_hal_positive2_wifi_setCliWpsConfigMethodsEnabled (void)
     UT_LOG("wifi_setCliWpsConfigMethodsEnabled API returns %d",returnStatus);
     UT_ASSERT_EQUAL(returnStatus, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive2_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -619,7 +608,7 @@ void test_l1_wifi_client_hal_positive2_wifi_setCliWpsConfigMethodsEnabled (void)
  */
 void test_l1_wifi_client_hal_positive3_wifi_setCliWpsConfigMethodsEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive3_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR* methodString = "Ethernet";
 
     UT_LOG("Invoking wifi_setCliWpsConfigMethodsEnabled with ssidIndex 1 and methodString \"Ethernet\".\n");
@@ -627,7 +616,7 @@ void test_l1_wifi_client_hal_positive3_wifi_setCliWpsConfigMethodsEnabled (void)
     UT_LOG("wifi_setCliWpsConfigMethodsEnabled API returns %d",returnStatus);
     UT_ASSERT_EQUAL(returnStatus, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive3_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -650,7 +639,7 @@ void test_l1_wifi_client_hal_positive3_wifi_setCliWpsConfigMethodsEnabled (void)
 */
 void test_l1_wifi_client_hal_negative1_wifi_setCliWpsConfigMethodsEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative1_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = 0;
     CHAR* methodString = "USBFlashDrive";
 
@@ -659,7 +648,7 @@ void test_l1_wifi_client_hal_negative1_wifi_setCliWpsConfigMethodsEnabled (void)
     UT_LOG("wifi_setCliWpsConfigMethodsEnabled API returns %d",returnStatus);
     UT_ASSERT_EQUAL(returnStatus, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative1_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -682,7 +671,7 @@ void test_l1_wifi_client_hal_negative1_wifi_setCliWpsConfigMethodsEnabled (void)
 */
 void test_l1_wifi_client_hal_negative2_wifi_setCliWpsConfigMethodsEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative2_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR* methodString = "";
 
     UT_LOG("Invoking wifi_setCliWpsConfigMethodsEnabled with ssidIndex 1 and empty methodString.\n");
@@ -690,7 +679,7 @@ void test_l1_wifi_client_hal_negative2_wifi_setCliWpsConfigMethodsEnabled (void)
     UT_LOG("wifi_setCliWpsConfigMethodsEnabled API returns %d",returnStatus);
     UT_ASSERT_EQUAL(returnStatus, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative2_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 /**
 * @brief This function checks if works wifi_setCliWpsConfigMethodsEnabled() as expected
@@ -712,7 +701,7 @@ void test_l1_wifi_client_hal_negative2_wifi_setCliWpsConfigMethodsEnabled (void)
 */
 void test_l1_wifi_client_hal_negative3_wifi_setCliWpsConfigMethodsEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative3_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR* methodString = NULL;
 
     UT_LOG("Invoking wifi_setCliWpsConfigMethodsEnabled with ssidIndex 1 and methodString = NULL.\n");
@@ -720,7 +709,7 @@ void test_l1_wifi_client_hal_negative3_wifi_setCliWpsConfigMethodsEnabled (void)
     UT_LOG("wifi_setCliWpsConfigMethodsEnabled API returns %d\n",returnStatus);
     UT_ASSERT_EQUAL(returnStatus, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative3_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -743,7 +732,7 @@ void test_l1_wifi_client_hal_negative3_wifi_setCliWpsConfigMethodsEnabled (void)
 */
 void test_l1_wifi_client_hal_negative4_wifi_setCliWpsConfigMethodsEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative4_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR* methodString = "IntegratedNFC";
 
     UT_LOG("Invoking wifi_setCliWpsConfigMethodsEnabled with ssidIndex 1 and methodString = \"IntegratedNFC\".\n");
@@ -751,7 +740,7 @@ void test_l1_wifi_client_hal_negative4_wifi_setCliWpsConfigMethodsEnabled (void)
     UT_LOG("wifi_setCliWpsConfigMethodsEnabled API returns %d\n",returnStatus);
     UT_ASSERT_EQUAL(returnStatus, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative4_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -774,7 +763,7 @@ void test_l1_wifi_client_hal_negative4_wifi_setCliWpsConfigMethodsEnabled (void)
 */
 void test_l1_wifi_client_hal_negative5_wifi_setCliWpsConfigMethodsEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative5_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR* methodString = "USBFlashDrive";
 
     UT_LOG("Invoking wifi_setCliWpsConfigMethodsEnabled without initializing WiFi, with ssidIndex 1 and methodString \"USBFlashDrive\".\n");
@@ -782,7 +771,7 @@ void test_l1_wifi_client_hal_negative5_wifi_setCliWpsConfigMethodsEnabled (void)
     UT_LOG("wifi_setCliWpsConfigMethodsEnabled API returns : %d\n",returnStatus);
     UT_ASSERT_EQUAL(returnStatus, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative5_wifi_setCliWpsConfigMethodsEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -805,7 +794,7 @@ void test_l1_wifi_client_hal_negative5_wifi_setCliWpsConfigMethodsEnabled (void)
 */
 void test_l1_wifi_client_hal_positive1_wifi_setCliWpsEnrolleePin (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive1_wifi_setCliWpsEnrolleePin...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *EnrolleePin = Config_key_new(key_file, "l1_positive1_wifi_setCliWpsEnrolleePin", "ENROLLEE_PIN");
 
     if (NULL == EnrolleePin)
@@ -816,7 +805,7 @@ void test_l1_wifi_client_hal_positive1_wifi_setCliWpsEnrolleePin (void)
     Config_key_delete(EnrolleePin);
     UT_ASSERT_EQUAL(retVal, RETURN_OK);
  
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive1_wifi_setCliWpsEnrolleePin...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -839,7 +828,7 @@ void test_l1_wifi_client_hal_positive1_wifi_setCliWpsEnrolleePin (void)
 */
 void test_l1_wifi_client_hal_positive2_wifi_setCliWpsEnrolleePin (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive2_wifi_setCliWpsEnrolleePin...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *EnrolleePin = Config_key_new(key_file, "l1_positive2_wifi_setCliWpsEnrolleePin", "ENROLLEE_PIN");
 
     if (NULL == EnrolleePin)
@@ -850,7 +839,7 @@ void test_l1_wifi_client_hal_positive2_wifi_setCliWpsEnrolleePin (void)
     Config_key_delete(EnrolleePin);
     UT_ASSERT_EQUAL(retVal, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive2_wifi_setCliWpsEnrolleePin...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -873,7 +862,7 @@ void test_l1_wifi_client_hal_positive2_wifi_setCliWpsEnrolleePin (void)
 */
 void test_l1_wifi_client_hal_negative1_wifi_setCliWpsEnrolleePin (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative1_wifi_setCliWpsEnrolleePin...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = 2;
     CHAR *EnrolleePin = Config_key_new(key_file, "l1_negative1_wifi_setCliWpsEnrolleePin", "ENROLLEE_PIN");
 
@@ -885,7 +874,7 @@ void test_l1_wifi_client_hal_negative1_wifi_setCliWpsEnrolleePin (void)
     Config_key_delete(EnrolleePin);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative1_wifi_setCliWpsEnrolleePin...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -908,7 +897,7 @@ void test_l1_wifi_client_hal_negative1_wifi_setCliWpsEnrolleePin (void)
 */
 void test_l1_wifi_client_hal_negative2_wifi_setCliWpsEnrolleePin (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative2_wifi_setCliWpsEnrolleePin...\n"); 
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *EnrolleePin = Config_key_new(key_file, "l1_negative2_wifi_setCliWpsEnrolleePin", "ENROLLEE_PIN");
 
     INT retVal = wifi_setCliWpsEnrolleePin(SSID_INDEX, EnrolleePin);
@@ -916,7 +905,7 @@ void test_l1_wifi_client_hal_negative2_wifi_setCliWpsEnrolleePin (void)
     Config_key_delete(EnrolleePin);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative2_wifi_setCliWpsEnrolleePin...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -939,7 +928,7 @@ void test_l1_wifi_client_hal_negative2_wifi_setCliWpsEnrolleePin (void)
 */
 void test_l1_wifi_client_hal_negative3_wifi_setCliWpsEnrolleePin (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative3_wifi_setCliWpsEnrolleePin...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *EnrolleePin = Config_key_new(key_file, "l1_negative3_wifi_setCliWpsEnrolleePin", "ENROLLEE_PIN");
 
     if (NULL == EnrolleePin)
@@ -950,7 +939,7 @@ void test_l1_wifi_client_hal_negative3_wifi_setCliWpsEnrolleePin (void)
     Config_key_delete(EnrolleePin);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative3_wifi_setCliWpsEnrolleePin...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -973,7 +962,7 @@ void test_l1_wifi_client_hal_negative3_wifi_setCliWpsEnrolleePin (void)
  */
 void test_l1_wifi_client_hal_negative4_wifi_setCliWpsEnrolleePin (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative4_wifi_setCliWpsEnrolleePin...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *EnrolleePin = Config_key_new(key_file, "l1_negative4_wifi_setCliWpsEnrolleePin", "ENROLLEE_PIN");
 
     if (NULL == EnrolleePin)
@@ -984,7 +973,7 @@ void test_l1_wifi_client_hal_negative4_wifi_setCliWpsEnrolleePin (void)
     Config_key_delete(EnrolleePin);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative4_wifi_setCliWpsEnrolleePin...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1007,7 +996,7 @@ void test_l1_wifi_client_hal_negative4_wifi_setCliWpsEnrolleePin (void)
 **/
 void test_l1_wifi_client_hal_positive1_wifi_setCliWpsButtonPush (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive1_wifi_setCliWpsButtonPush...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = 1;
 
     UT_LOG("Invoked wifi_setCliWpsButtonPush with valid ssidIndex = 1\n");
@@ -1015,7 +1004,7 @@ void test_l1_wifi_client_hal_positive1_wifi_setCliWpsButtonPush (void)
     UT_LOG("wifi_setCliWpsButtonPush API returns : %d\n",returnStatus);
     UT_ASSERT_EQUAL(returnStatus, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive1_wifi_setCliWpsButtonPush...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1038,7 +1027,7 @@ void test_l1_wifi_client_hal_positive1_wifi_setCliWpsButtonPush (void)
 **/
 void test_l1_wifi_client_hal_positive2_wifi_setCliWpsButtonPush (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive2_wifi_setCliWpsButtonPush...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = 1;
     INT returnStatus;
 
@@ -1047,7 +1036,7 @@ void test_l1_wifi_client_hal_positive2_wifi_setCliWpsButtonPush (void)
     UT_LOG("wifi_setCliWpsButtonPush API returns : %d\n",returnStatus);
     UT_ASSERT_EQUAL(returnStatus, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive2_wifi_setCliWpsButtonPush...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1071,14 +1060,14 @@ void test_l1_wifi_client_hal_positive2_wifi_setCliWpsButtonPush (void)
 */
 void test_l1_wifi_client_hal_negative1_wifi_setCliWpsButtonPush (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative1_wifi_setCliWpsButtonPush...\n");
+    WIFI_TRACE_TEST_BEGIN();
 
     UT_LOG("Invoking the wifi_setCliWpsButtonPush API without pre-initializing.\n");
     INT returnStatus = wifi_setCliWpsButtonPush(SSID_INDEX);
     UT_LOG("wifi_setCliWpsButtonPush API returns : %d\n",returnStatus);
     UT_ASSERT_EQUAL(returnStatus, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative1_wifi_setCliWpsButtonPush...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1101,7 +1090,7 @@ void test_l1_wifi_client_hal_negative1_wifi_setCliWpsButtonPush (void)
 */
 void test_l1_wifi_client_hal_negative2_wifi_setCliWpsButtonPush (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative2_wifi_setCliWpsButtonPush...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = -1;
 
     UT_LOG("Invoking the wifi_setCliWpsButtonPush API with ssidIndex = -1.\n");
@@ -1109,7 +1098,7 @@ void test_l1_wifi_client_hal_negative2_wifi_setCliWpsButtonPush (void)
     UT_LOG("wifi_setCliWpsButtonPush API returns : %d\n",returnStatus);
     UT_ASSERT_EQUAL(returnStatus, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative2_wifi_setCliWpsButtonPush...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1132,7 +1121,7 @@ void test_l1_wifi_client_hal_negative2_wifi_setCliWpsButtonPush (void)
 */
 void test_l1_wifi_client_hal_positive1_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive1_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WEP_64;
     INT saveSSID = 1;
     wifi_connectEndpoint_test_config_t *l1_config = Config_new(key_file, "POSITIVE1_WEP_64_SECURITY_MODE");
@@ -1147,7 +1136,7 @@ void test_l1_wifi_client_hal_positive1_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive1_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1170,7 +1159,7 @@ void test_l1_wifi_client_hal_positive1_wifi_connectEndpoint (void)
 */
 void test_l1_wifi_client_hal_positive2_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive2_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WPA_ENTERPRISE_AES;
     INT saveSSID = 1;
     wifi_connectEndpoint_test_config_t *l1_config = Config_new(key_file, "POSITIVE2_WPA_ENTERPRISE_AES_SECURITY_MODE");
@@ -1185,7 +1174,7 @@ void test_l1_wifi_client_hal_positive2_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive2_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1209,7 +1198,7 @@ void test_l1_wifi_client_hal_positive2_wifi_connectEndpoint (void)
 */
 void test_l1_wifi_client_hal_positive3_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive3_validInputs...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WPA2_PSK_AES;   
     INT saveSSID = 0;
     wifi_connectEndpoint_test_config_t *l1_config = Config_new(key_file, "POSITIVE3_WPA2_PSK_AES_SECURITY_MODE");
@@ -1224,7 +1213,7 @@ void test_l1_wifi_client_hal_positive3_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive3_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1248,7 +1237,7 @@ void test_l1_wifi_client_hal_positive3_wifi_connectEndpoint (void)
 */
 void test_l1_wifi_client_hal_positive4_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive4_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WEP_64;    
     INT saveSSID = 0;
     wifi_connectEndpoint_test_config_t *l1_config = Config_new(key_file, "POSITIVE4_WEP_64_SECURITY_MODE");
@@ -1263,7 +1252,7 @@ void test_l1_wifi_client_hal_positive4_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive4_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1286,7 +1275,7 @@ void test_l1_wifi_client_hal_positive4_wifi_connectEndpoint (void)
 */
 void test_l1_wifi_client_hal_negative1_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative1_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = 0;
     CHAR AP_SSID[] = "ValidSSID";                                  /*Need to replace with valid value*/
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WEP_64;    
@@ -1304,7 +1293,7 @@ void test_l1_wifi_client_hal_negative1_wifi_connectEndpoint (void)
     UT_LOG("The API wifi_connectEndpoint returns: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting ttest_l1_wifi_client_hal_negative1_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1327,7 +1316,7 @@ void test_l1_wifi_client_hal_negative1_wifi_connectEndpoint (void)
 */
 void test_l1_wifi_client_hal_negative2_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative2_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_NOT_SUPPORTED + 1;
     INT saveSSID = 1;
     wifi_connectEndpoint_test_config_t *l1_config = Config_new(key_file, "NEGATIVE2_NOT_SUPPORTED_SECURITY_MODE");
@@ -1342,7 +1331,7 @@ void test_l1_wifi_client_hal_negative2_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting ttest_l1_wifi_client_hal_negative2_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1365,7 +1354,7 @@ void test_l1_wifi_client_hal_negative2_wifi_connectEndpoint (void)
 */
 void test_l1_wifi_client_hal_negative3_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative3_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WEP_64;
     INT saveSSID = 0;
     wifi_connectEndpoint_test_config_t *l1_config = Config_new(key_file, "NEGATIVE3_WEP_64_SECURITY_MODE");
@@ -1380,7 +1369,7 @@ void test_l1_wifi_client_hal_negative3_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting ttest_l1_wifi_client_hal_negative3_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1404,7 +1393,7 @@ void test_l1_wifi_client_hal_negative3_wifi_connectEndpoint (void)
  */
 void test_l1_wifi_client_hal_negative4_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative4_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
 
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WEP_128;
     INT saveSSID = 1;
@@ -1420,7 +1409,7 @@ void test_l1_wifi_client_hal_negative4_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting ttest_l1_wifi_client_hal_negative4_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1443,7 +1432,7 @@ void test_l1_wifi_client_hal_negative4_wifi_connectEndpoint (void)
 */
 void test_l1_wifi_client_hal_negative5_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative5_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WPA_PSK_TKIP;
     INT saveSSID = 1;
     wifi_connectEndpoint_test_config_t *l1_config = Config_new(key_file, "NEGATIVE5_WPA_PSK_TKIP_SECURITY_MODE");
@@ -1458,7 +1447,7 @@ void test_l1_wifi_client_hal_negative5_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting ttest_l1_wifi_client_hal_negative5_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 /**
  * @brief Test case to verify the behavior of the wifi_connectEndpoint function when an invalid saveSSID value is provided.
@@ -1480,7 +1469,7 @@ void test_l1_wifi_client_hal_negative5_wifi_connectEndpoint (void)
  */
 void test_l1_wifi_client_hal_negative6_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative6_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WPA3_SAE;
     INT saveSSID = 2;
     wifi_connectEndpoint_test_config_t *l1_config = Config_new(key_file, "NEGATIVE6_WPA3_SAE_SECURITY_MODE");
@@ -1495,7 +1484,7 @@ void test_l1_wifi_client_hal_negative6_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting ttest_l1_wifi_client_hal_negative6_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 } 
 
 /**
@@ -1518,7 +1507,7 @@ void test_l1_wifi_client_hal_negative6_wifi_connectEndpoint (void)
  */
 void test_l1_wifi_client_hal_negative7_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative7_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WPA2_ENTERPRISE_AES;
     INT saveSSID = 1;
     wifi_connectEndpoint_test_config_t *l1_config = Config_new(key_file, "NEGATIVE7_WPA2_ENTERPRISE_AES_SECURITY_MODE");
@@ -1533,7 +1522,7 @@ void test_l1_wifi_client_hal_negative7_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting ttest_l1_wifi_client_hal_negative7_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 } 
 
 /**
@@ -1557,7 +1546,7 @@ void test_l1_wifi_client_hal_negative7_wifi_connectEndpoint (void)
  */
 void test_l1_wifi_client_hal_negative8_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative8_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WPA_WPA2_ENTERPRISE;
     INT saveSSID = 1;
     wifi_connectEndpoint_test_config_t *l1_config = Config_new(key_file, "NEGATIVE8_WPA_WPA2_ENTERPRISE_SECURITY_MODE");
@@ -1572,7 +1561,7 @@ void test_l1_wifi_client_hal_negative8_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting ttest_l1_wifi_client_hal_negative8_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1595,7 +1584,7 @@ void test_l1_wifi_client_hal_negative8_wifi_connectEndpoint (void)
 */
 void test_l1_wifi_client_hal_negative9_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative9_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WPA2_ENTERPRISE_TKIP;
     INT saveSSID = 1;
     wifi_connectEndpoint_test_config_t *l1_config = Config_new(key_file, "NEGATIVE9_WPA2_ENTERPRISE_TKIP_SECURITY_MODE");
@@ -1610,7 +1599,7 @@ void test_l1_wifi_client_hal_negative9_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting ttest_l1_wifi_client_hal_negative9_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1633,7 +1622,7 @@ void test_l1_wifi_client_hal_negative9_wifi_connectEndpoint (void)
 */
 void test_l1_wifi_client_hal_negative10_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative10_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WPA3_PSK_AES;
     INT saveSSID = 1;
     wifi_connectEndpoint_test_config_t *l1_config = Config_new(key_file, "NEGATIVE10_WPA3_PSK_AES_SECURITY_MODE");
@@ -1648,7 +1637,7 @@ void test_l1_wifi_client_hal_negative10_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting ttest_l1_wifi_client_hal_negative10_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1671,7 +1660,7 @@ void test_l1_wifi_client_hal_negative10_wifi_connectEndpoint (void)
 */
 void test_l1_wifi_client_hal_negative11_wifi_connectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative11_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifiSecurityMode_t AP_security_mode = WIFI_SECURITY_WPA3_PSK_AES;
     INT saveSSID = 1;
     wifi_connectEndpoint_test_config_t *l1_config = Config_new(key_file, "NEGATIVE11_WPA3_PSK_AES_SECURITY_MODE");
@@ -1686,7 +1675,7 @@ void test_l1_wifi_client_hal_negative11_wifi_connectEndpoint (void)
     Config_delete(l1_config);
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative11_wifi_connectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1711,7 +1700,7 @@ void test_l1_wifi_client_hal_negative11_wifi_connectEndpoint (void)
 */
 void test_l1_wifi_client_hal_positive1_wifi_disconnectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive1_wifi_disconnectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     char *ssid = Config_key_new(key_file, "l1_positive1_wifi_disconnectEndpoint", SSID);
 
     if (NULL == ssid) 
@@ -1722,7 +1711,7 @@ void test_l1_wifi_client_hal_positive1_wifi_disconnectEndpoint (void)
     Config_key_delete(ssid);
     UT_ASSERT_EQUAL(status, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive1_wifi_disconnectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1747,7 +1736,7 @@ void test_l1_wifi_client_hal_positive1_wifi_disconnectEndpoint (void)
 */
 void test_l1_wifi_client_hal_positive2_wifi_disconnectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive2_wifi_disconnectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     char *ssid = Config_key_new(key_file, "l1_positive2_wifi_disconnectEndpoint", SSID);
 
     if (NULL == ssid) 
@@ -1758,7 +1747,7 @@ void test_l1_wifi_client_hal_positive2_wifi_disconnectEndpoint (void)
     Config_key_delete(ssid);
     UT_ASSERT_EQUAL(status, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive2_wifi_disconnectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1781,7 +1770,7 @@ void test_l1_wifi_client_hal_positive2_wifi_disconnectEndpoint (void)
  */
 void test_l1_wifi_client_hal_negative1_wifi_disconnectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative1_wifi_disconnectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = 0;
     char *ssid = Config_key_new(key_file, "l1_negative1_wifi_disconnectEndpoint", SSID);
 
@@ -1793,7 +1782,7 @@ void test_l1_wifi_client_hal_negative1_wifi_disconnectEndpoint (void)
     Config_key_delete(ssid);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative1_wifi_disconnectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1816,7 +1805,7 @@ void test_l1_wifi_client_hal_negative1_wifi_disconnectEndpoint (void)
  */
 void test_l1_wifi_client_hal_negative2_wifi_disconnectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative2_wifi_disconnectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     char *ssid = Config_key_new(key_file, "l1_negative2_wifi_disconnectEndpoint", SSID);
 
     if (NULL == ssid) 
@@ -1827,7 +1816,7 @@ void test_l1_wifi_client_hal_negative2_wifi_disconnectEndpoint (void)
     Config_key_delete(ssid);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative2_wifi_disconnectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1850,7 +1839,7 @@ void test_l1_wifi_client_hal_negative2_wifi_disconnectEndpoint (void)
  */
 void test_l1_wifi_client_hal_negative3_wifi_disconnectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative3_wifi_disconnectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     char *ssid = Config_key_new(key_file, "l1_negative3_wifi_disconnectEndpoint", SSID);
 
     UT_LOG("Invoking wifi_disconnectEndpoint API with ssidIndex = 1 and AP_SSID = \"valid_value\"\n");
@@ -1859,7 +1848,7 @@ void test_l1_wifi_client_hal_negative3_wifi_disconnectEndpoint (void)
     Config_key_delete(ssid);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative3_wifi_disconnectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1883,7 +1872,7 @@ void test_l1_wifi_client_hal_negative3_wifi_disconnectEndpoint (void)
 */
 void test_l1_wifi_client_hal_negaitive4_wifi_disconnectEndpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negaitive4_wifi_disconnectEndpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     char *ssid = Config_key_new(key_file, "l1_negaitive4_wifi_disconnectEndpoint", SSID);
 
     if (NULL == ssid) 
@@ -1894,7 +1883,7 @@ void test_l1_wifi_client_hal_negaitive4_wifi_disconnectEndpoint (void)
     Config_key_delete(ssid);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negaitive4_wifi_disconnectEndpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1917,14 +1906,14 @@ void test_l1_wifi_client_hal_negaitive4_wifi_disconnectEndpoint (void)
 */
 void test_l1_wifi_client_hal_positive1_wifi_clearSSIDInfo (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive1_wifi_clearSSIDInfo...\n");
+    WIFI_TRACE_TEST_BEGIN();
     
     UT_LOG("Invoking wifi_clearSSIDInfo with valid SSID index %d\n", SSID_INDEX);
     INT returnValue = wifi_clearSSIDInfo(SSID_INDEX);
     UT_LOG("wifi_clearSSIDInfo API returns : %d\n",returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive1_wifi_clearSSIDInfo...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1947,7 +1936,7 @@ void test_l1_wifi_client_hal_positive1_wifi_clearSSIDInfo (void)
 */
 void test_l1_wifi_client_hal_positive2_wifi_clearSSIDInfo (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive2_wifi_clearSSIDInfo...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT returnValue;
 
     UT_LOG("Invoking wifi_clearSSIDInfo with valid SSID index %d\n", SSID_INDEX);
@@ -1955,7 +1944,7 @@ void test_l1_wifi_client_hal_positive2_wifi_clearSSIDInfo (void)
     UT_LOG("wifi_clearSSIDInfo API returns : %d\n",returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive2_wifi_clearSSIDInfo...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1979,7 +1968,7 @@ void test_l1_wifi_client_hal_positive2_wifi_clearSSIDInfo (void)
 */
 void test_l1_wifi_client_hal_negative1_wifi_clearSSIDInfo (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative1_wifi_clearSSIDInfo...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = 0;
 
     UT_LOG("Invoking wifi_clearSSIDInfo with ssidIndex = 0\n");
@@ -1987,7 +1976,7 @@ void test_l1_wifi_client_hal_negative1_wifi_clearSSIDInfo (void)
     UT_LOG("wifi_clearSSIDInfo API returns : %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative1_wifi_clearSSIDInfo...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2010,7 +1999,7 @@ void test_l1_wifi_client_hal_negative1_wifi_clearSSIDInfo (void)
 */
 void test_l1_wifi_client_hal_negative2_wifi_clearSSIDInfo (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative2_wifi_clearSSIDInfo...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = -1;
 
     UT_LOG("Invoking wifi_clearSSIDInfo with ssidIndex = -1\n");
@@ -2018,7 +2007,7 @@ void test_l1_wifi_client_hal_negative2_wifi_clearSSIDInfo (void)
     UT_LOG("wifi_clearSSIDInfo API returns : %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative2_wifi_clearSSIDInfo...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2042,14 +2031,14 @@ void test_l1_wifi_client_hal_negative2_wifi_clearSSIDInfo (void)
 */
 void test_l1_wifi_client_hal_negative3_wifi_clearSSIDInfo (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative3_wifi_clearSSIDInfo...\n");
+    WIFI_TRACE_TEST_BEGIN();
 
     UT_LOG("Invoking wifi_clearSSIDInfo without initializing wifi_init()\n");
     INT returnValue = wifi_clearSSIDInfo(SSID_INDEX);
     UT_LOG("wifi_clearSSIDInfo API returns : %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative3_wifi_clearSSIDInfo...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2074,7 +2063,7 @@ void test_l1_wifi_client_hal_negative3_wifi_clearSSIDInfo (void)
 */     
 void test_l1_wifi_client_hal_positive1_wifi_lastConnected_Endpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive1_wifi_lastConnected_Endpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_pairedSSIDInfo_t ssidInfo;
     INT ret;
     CHAR *ssid = Config_key_new(key_file, "l1_positive1_wifi_lastConnected_Endpoint", "AP_SSID");
@@ -2123,7 +2112,7 @@ void test_l1_wifi_client_hal_positive1_wifi_lastConnected_Endpoint (void)
         }
     }
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive1_wifi_lastConnected_Endpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2148,7 +2137,7 @@ void test_l1_wifi_client_hal_positive1_wifi_lastConnected_Endpoint (void)
 */     
 void test_l1_wifi_client_hal_positive2_wifi_lastConnected_Endpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive2_wifi_lastConnected_Endpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ret;
     wifi_pairedSSIDInfo_t ssidInfo;
     CHAR *ssid = Config_key_new(key_file, "l1_positive2_wifi_lastConnected_Endpoint", "AP_SSID");
@@ -2199,7 +2188,7 @@ void test_l1_wifi_client_hal_positive2_wifi_lastConnected_Endpoint (void)
         }
     }
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive2_wifi_lastConnected_Endpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -2223,7 +2212,7 @@ void test_l1_wifi_client_hal_positive2_wifi_lastConnected_Endpoint (void)
 */
 void test_l1_wifi_client_hal_negative1_wifi_lastConnected_Endpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative1_wifi_lastConnected_Endpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_pairedSSIDInfo_t *ssidInfo = NULL;
 
     UT_LOG("Invoking wifi_lastConnected_Endpoint with NULL ssidInfo structure\n");
@@ -2231,7 +2220,7 @@ void test_l1_wifi_client_hal_negative1_wifi_lastConnected_Endpoint (void)
     UT_LOG("wifi_lastConnected_Endpoint API returns : %d\n",ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative1_wifi_lastConnected_Endpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2254,7 +2243,7 @@ void test_l1_wifi_client_hal_negative1_wifi_lastConnected_Endpoint (void)
 */
 void test_l1_wifi_client_hal_negative2_wifi_lastConnected_Endpoint (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative2_wifi_lastConnected_Endpoint...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_pairedSSIDInfo_t ssidInfo;
 
     memset(&ssidInfo, 0, sizeof(wifi_pairedSSIDInfo_t));
@@ -2263,7 +2252,7 @@ void test_l1_wifi_client_hal_negative2_wifi_lastConnected_Endpoint (void)
     UT_LOG("wifi_lastConnected_Endpoint API returns : %d\n",ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative2_wifi_lastConnected_Endpoint...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2286,7 +2275,7 @@ void test_l1_wifi_client_hal_negative2_wifi_lastConnected_Endpoint (void)
 */
 void test_l1_wifi_client_hal_positive1_wifi_setRoamingControl (void) 
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive1_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_roamingCtrl_t pRoamingCtrl_data;
 
     memset(&pRoamingCtrl_data, 0, sizeof(wifi_roamingCtrl_t));
@@ -2308,7 +2297,7 @@ void test_l1_wifi_client_hal_positive1_wifi_setRoamingControl (void)
     UT_LOG("wifi_setRoamingControl API returns : %d\n", retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive1_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2331,7 +2320,7 @@ void test_l1_wifi_client_hal_positive1_wifi_setRoamingControl (void)
 */
 void test_l1_wifi_client_hal_positive2_wifi_setRoamingControl (void) 
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive2_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_BEGIN();
     int retVal;
     wifi_roamingCtrl_t pRoamingCtrl_data;
 
@@ -2354,7 +2343,7 @@ void test_l1_wifi_client_hal_positive2_wifi_setRoamingControl (void)
     UT_LOG("wifi_setRoamingControl API returns : %d\n", retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive2_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2377,7 +2366,7 @@ void test_l1_wifi_client_hal_positive2_wifi_setRoamingControl (void)
 */
 void test_l1_wifi_client_hal_negative1_wifi_setRoamingControl (void) 
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative1_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_roamingCtrl_t* pRoamingCtrl_data = NULL;
 
     UT_LOG("Invoking wifi_setRoamingControl with ssidIndex = 1 and pRoamingCtrl_data structure = NULL.\n");
@@ -2385,7 +2374,7 @@ void test_l1_wifi_client_hal_negative1_wifi_setRoamingControl (void)
     UT_LOG("wifi_setRoamingControl API returns : %d\n",retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative1_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2408,7 +2397,7 @@ void test_l1_wifi_client_hal_negative1_wifi_setRoamingControl (void)
 */
 void test_l1_wifi_client_hal_negative2_wifi_setRoamingControl (void) 
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative2_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_roamingCtrl_t pRoamingCtrl_data;
 
     memset(&pRoamingCtrl_data, 0, sizeof(wifi_roamingCtrl_t));
@@ -2430,7 +2419,7 @@ void test_l1_wifi_client_hal_negative2_wifi_setRoamingControl (void)
     UT_LOG("wifi_setRoamingControl API returns : %d\n",retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative2_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2453,7 +2442,7 @@ void test_l1_wifi_client_hal_negative2_wifi_setRoamingControl (void)
 */
 void test_l1_wifi_client_hal_negative3_wifi_setRoamingControl (void) 
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative3_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_BEGIN();
     int ssidIndex = 0;
     wifi_roamingCtrl_t pRoamingCtrl_data;
 
@@ -2476,7 +2465,7 @@ void test_l1_wifi_client_hal_negative3_wifi_setRoamingControl (void)
     UT_LOG("wifi_setRoamingControl API returns : %d\n",retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative3_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2499,7 +2488,7 @@ void test_l1_wifi_client_hal_negative3_wifi_setRoamingControl (void)
 */
 void test_l1_wifi_client_hal_negative4_wifi_setRoamingControl (void) 
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative4_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_BEGIN();
     int ssidIndex = 100;
     wifi_roamingCtrl_t pRoamingCtrl_data;
 
@@ -2522,7 +2511,7 @@ void test_l1_wifi_client_hal_negative4_wifi_setRoamingControl (void)
     UT_LOG("wifi_setRoamingControl API returns : %d\n",retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative4_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2545,7 +2534,7 @@ void test_l1_wifi_client_hal_negative4_wifi_setRoamingControl (void)
 */
 void test_l1_wifi_client_hal_negative5_wifi_setRoamingControl (void) 
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative5_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_BEGIN();
     int ssidIndex = -1;
     wifi_roamingCtrl_t pRoamingCtrl_data;
 
@@ -2568,7 +2557,7 @@ void test_l1_wifi_client_hal_negative5_wifi_setRoamingControl (void)
     UT_LOG("wifi_setRoamingControl API returns : %d\n",retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative5_wifi_setRoamingControl...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2592,7 +2581,7 @@ void test_l1_wifi_client_hal_negative5_wifi_setRoamingControl (void)
 */
 void test_l1_wifi_client_hal_positive1_wifi_getRoamingControl (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive1_wifi_getRoamingControl...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_roamingCtrl_t pRoamingCtrl_data;
 
     UT_LOG("Invoking wifi_getRoamingControl with ssidIndex = 1 and pRoamingCtrl_data = valid structure.\n");
@@ -2732,7 +2721,7 @@ void test_l1_wifi_client_hal_positive1_wifi_getRoamingControl (void)
         UT_FAIL("Post-association AP steer control time frame validation failed\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive1_wifi_getRoamingControl...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2756,7 +2745,7 @@ void test_l1_wifi_client_hal_positive1_wifi_getRoamingControl (void)
 */
 void test_l1_wifi_client_hal_positive2_wifi_getRoamingControl (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive2_wifi_getRoamingControl...\n");
+    WIFI_TRACE_TEST_BEGIN();
     int retVal;
     wifi_roamingCtrl_t pRoamingCtrl_data;
 
@@ -2897,7 +2886,7 @@ void test_l1_wifi_client_hal_positive2_wifi_getRoamingControl (void)
         UT_FAIL("Post-association AP steer control time frame validation failed\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive2_wifi_getRoamingControl...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2920,7 +2909,7 @@ void test_l1_wifi_client_hal_positive2_wifi_getRoamingControl (void)
  */
 void test_l1_wifi_client_hal_negative1_wifi_getRoamingControl (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative1_wifi_getRoamingControl...\n");
+    WIFI_TRACE_TEST_BEGIN();
     int ssidIndex = 0;
     wifi_roamingCtrl_t pRoamingCtrl_data;
 
@@ -2930,7 +2919,7 @@ void test_l1_wifi_client_hal_negative1_wifi_getRoamingControl (void)
     UT_LOG("wifi_getRoamingContro API returns :%d\n", retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative1_wifi_getRoamingControl...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2954,7 +2943,7 @@ void test_l1_wifi_client_hal_negative1_wifi_getRoamingControl (void)
  */
 void test_l1_wifi_client_hal_negative2_wifi_getRoamingControl (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative2_wifi_getRoamingControl...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_roamingCtrl_t *pRoamingCtrl_data = NULL;
 
     UT_LOG("Invoking wifi_getRoamingControl with ssidIndex = 1 and pRoamingCtrl_data = NULL\n");
@@ -2962,7 +2951,7 @@ void test_l1_wifi_client_hal_negative2_wifi_getRoamingControl (void)
     UT_LOG("wifi_getRoamingControl API returns : %d\n",retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative2_wifi_getRoamingControl...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2985,7 +2974,7 @@ void test_l1_wifi_client_hal_negative2_wifi_getRoamingControl (void)
 */
 void test_l1_wifi_client_hal_negative3_wifi_getRoamingControl (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative3_wifi_getRoamingControl...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_roamingCtrl_t pRoamingCtrl_data;
 
     memset(&pRoamingCtrl_data, 0, sizeof(wifi_roamingCtrl_t));
@@ -2994,7 +2983,7 @@ void test_l1_wifi_client_hal_negative3_wifi_getRoamingControl (void)
     UT_LOG("wifi_getRoamingControl API Returns : %d\n",retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative3_wifi_getRoamingControl...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3017,14 +3006,14 @@ void test_l1_wifi_client_hal_negative3_wifi_getRoamingControl (void)
 */
 void test_l1_wifi_client_hal_positive1_wifi_cancelWpsPairing (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive1_wifi_cancelWpsPairing...\n");
+    WIFI_TRACE_TEST_BEGIN();
 
     UT_LOG("Invoking wifi_cancelWpsPairing API.\n");
     INT status = wifi_cancelWpsPairing();
     UT_LOG("wifi_cancelWpsPairing API returns : %d\n",status);
     UT_ASSERT_EQUAL(status, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive1_wifi_cancelWpsPairing...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3047,7 +3036,7 @@ void test_l1_wifi_client_hal_positive1_wifi_cancelWpsPairing (void)
 */
 void test_l1_wifi_client_hal_positive2_wifi_cancelWpsPairing (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_positive2_wifi_cancelWpsPairing...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT status;
 
     UT_LOG("Invoking wifi_cancelWpsPairing API.\n");
@@ -3055,7 +3044,7 @@ void test_l1_wifi_client_hal_positive2_wifi_cancelWpsPairing (void)
     UT_LOG("wifi_cancelWpsPairing API returns : %d\n",status);
     UT_ASSERT_EQUAL(status, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_positive2_wifi_cancelWpsPairing...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3078,14 +3067,14 @@ void test_l1_wifi_client_hal_positive2_wifi_cancelWpsPairing (void)
 */
 void test_l1_wifi_client_hal_negative1_wifi_cancelWpsPairing (void)
 {
-    UT_LOG("Entering test_l1_wifi_client_hal_negative1_wifi_cancelWpsPairing...\n");
+    WIFI_TRACE_TEST_BEGIN();
 
     UT_LOG("Invoking wifi_cancelWpsPairing API.\n");
     INT status = wifi_cancelWpsPairing();
     UT_LOG("wifi_cancelWpsPairing API returns : %d\n",status);
     UT_ASSERT_EQUAL(status, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_client_hal_negative1_wifi_cancelWpsPairing...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 static UT_test_suite_t * pSuite_with_no_wifi_init = NULL;
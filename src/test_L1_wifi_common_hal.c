@@ -67,6 +67,7 @@
 #include <stdint.h>
 #include <glib.h>
 #include "wifi_common_hal.h"
+#include "wifi_hal_trace.h"
 
 #define MAX_OUTPUT_STRING_LEN 50
 #define MAX_LENGTH 256
@@ -123,7 +124,7 @@ int check_value (const char* target, const char* list[], int count)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getHalVersion (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getHalVersion...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_test_string[20] = {0};
     INT return_status;
 
@@ -132,7 +133,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getHalVersion (void)
     UT_LOG("The returned status is %d, and the obtained HAL version is %s\n",return_status, output_test_string);
     UT_ASSERT_EQUAL(return_status, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getHalVersion...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -156,7 +157,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getHalVersion (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getHalVersion (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getHalVersion...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *output_test_string = NULL;
     INT return_status;
 
@@ -165,7 +166,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getHalVersion (void)
     UT_LOG(" The returned status is %d\n", return_status);
     UT_ASSERT_EQUAL(return_status, RETURN_ERR);
     
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getHalVersion...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -190,7 +191,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getHalVersion (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_init (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_init...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT result;
 
     UT_LOG("Invoking wifi_init without any input parameters. Expecting RETURN_OK.\n");
@@ -201,7 +202,7 @@ void test_l1_wifi_common_hal_positive1_wifi_init (void)
     result = wifi_uninit();
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_init...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -227,7 +228,7 @@ void test_l1_wifi_common_hal_positive1_wifi_init (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_init (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_init...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT result;
 
     UT_LOG("Invoking wifi_init without any input parameters. Expecting RETURN_OK.\n");
@@ -242,7 +243,7 @@ void test_l1_wifi_common_hal_negative1_wifi_init (void)
     result = wifi_uninit();
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_init...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -266,7 +267,7 @@ void test_l1_wifi_common_hal_negative1_wifi_init (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_initWithConfig (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_initWithConfig...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_halConfig_t conf;
     int result;
 
@@ -277,7 +278,7 @@ void test_l1_wifi_common_hal_positive1_wifi_initWithConfig (void)
     result = wifi_uninit();
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_initWithConfig...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -302,7 +303,7 @@ void test_l1_wifi_common_hal_positive1_wifi_initWithConfig (void)
 */
 void test_l1_wifi_common_hal_positive2_wifi_initWithConfig (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive2_wifi_initWithConfig...\n");
+    WIFI_TRACE_TEST_BEGIN();
     int result;
 
     UT_LOG("Invoking wifi_initWithConfig with NULL\n");
@@ -313,7 +314,7 @@ void test_l1_wifi_common_hal_positive2_wifi_initWithConfig (void)
     result = wifi_uninit();
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive2_wifi_initWithConfig...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -337,7 +338,7 @@ void test_l1_wifi_common_hal_positive2_wifi_initWithConfig (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_initWithConfig (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_initWithConfig...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_halConfig_t conf;
     int result;
 
@@ -350,7 +351,7 @@ void test_l1_wifi_common_hal_negative2_wifi_initWithConfig (void)
     result = wifi_uninit();
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_initWithConfig...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -374,7 +375,7 @@ void test_l1_wifi_common_hal_negative2_wifi_initWithConfig (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_initWithConfig (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_initWithConfig...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_halConfig_t conf;
     int result;
 
@@ -387,7 +388,7 @@ void test_l1_wifi_common_hal_negative3_wifi_initWithConfig (void)
     result = wifi_uninit();
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_initWithConfig...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -410,7 +411,7 @@ void test_l1_wifi_common_hal_negative3_wifi_initWithConfig (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_down (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_down..\n");
+    WIFI_TRACE_TEST_BEGIN();
 
     INT return_val;
     UT_LOG("Invoking wifi_down().\n");
@@ -418,7 +419,7 @@ void test_l1_wifi_common_hal_positive1_wifi_down (void)
     UT_LOG("Invoking wifi_down(). Return value: %d\n", return_val);
     UT_ASSERT_EQUAL(return_val, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_down...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -442,7 +443,7 @@ void test_l1_wifi_common_hal_positive1_wifi_down (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_down (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_down...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT return_val;
 
     UT_LOG("Invoking wifi_down() without initialization.\n");
@@ -450,7 +451,7 @@ void test_l1_wifi_common_hal_negative1_wifi_down (void)
     UT_LOG("Invoking wifi_down() without initialization. Return value: %d\n", return_val);
     UT_ASSERT_EQUAL(return_val, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_down...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -475,7 +476,7 @@ void test_l1_wifi_common_hal_negative1_wifi_down (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_uninit (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_uninit...\n");
+    WIFI_TRACE_TEST_BEGIN();
     int ret ;
 
     ret = wifi_init();
@@ -486,7 +487,7 @@ void test_l1_wifi_common_hal_positive1_wifi_uninit (void)
     UT_LOG("Expected return value is RETURN_OK, got: %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_uninit...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -512,7 +513,7 @@ void test_l1_wifi_common_hal_positive1_wifi_uninit (void)
 */
 void test_l1_wifi_common_hal_positive2_wifi_uninit (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive2_wifi_uninit...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_halConfig_t conf;
     int result;
 
@@ -526,7 +527,7 @@ void test_l1_wifi_common_hal_positive2_wifi_uninit (void)
     UT_LOG("Expected return value is RETURN_OK, got: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive2_wifi_uninit...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -550,7 +551,7 @@ void test_l1_wifi_common_hal_positive2_wifi_uninit (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_uninit (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_uninit...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ret;
 
     UT_LOG("Invoking wifi_uninit() without prior execution of wifi_init() or wifi_initWithConfig()\n");
@@ -558,7 +559,7 @@ void test_l1_wifi_common_hal_negative1_wifi_uninit (void)
     UT_LOG("Expected return value is RETURN_ERR, got: %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_uninit...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -582,7 +583,7 @@ void test_l1_wifi_common_hal_negative1_wifi_uninit (void)
 */
 void test_l1_wifi_common_hal_positive1_getStats (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_getStats...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_sta_stats_t wifi_sta_stats;
     CHAR *ssid = Config_key_new(key_file, "l1_positive1_wifi_getStats", "AP_SSID");
 
@@ -712,7 +713,7 @@ void test_l1_wifi_common_hal_positive1_getStats (void)
         UT_FAIL("sta_Retransmissions validation failed\n");
     }
     Config_key_delete(ssid);
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_getStats...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -736,7 +737,7 @@ void test_l1_wifi_common_hal_positive1_getStats (void)
 */
 void test_l1_wifi_common_hal_negative1_getStats(void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_getStats...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 0;
     wifi_sta_stats_t wifi_sta_stats;
 
@@ -744,7 +745,7 @@ void test_l1_wifi_common_hal_negative1_getStats(void)
     memset(&wifi_sta_stats, 0, sizeof(wifi_sta_stats_t));
     wifi_getStats(radioIndex, &wifi_sta_stats);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_getStats...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -769,13 +770,13 @@ void test_l1_wifi_common_hal_negative1_getStats(void)
 */
 void test_l1_wifi_common_hal_negative2_getStats (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_getStats...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_sta_stats_t *wifi_sta_stats = NULL;
 
     UT_LOG("Invoking wifi_getStats with valid radioIndex=1 and NULL &wifi_sta_stats buffer.\n");
     wifi_getStats(RADIO_INDEX, wifi_sta_stats); 
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_getStats...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -798,14 +799,14 @@ void test_l1_wifi_common_hal_negative2_getStats (void)
 */
 void test_l1_wifi_common_hal_negative3_getStats (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_getStats...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_sta_stats_t wifi_sta_stats;
 
     UT_LOG("Invoking wifi_getStats without calling wifi_init or wifi_initWithConfig\n");
     memset(&wifi_sta_stats, 0, sizeof(wifi_sta_stats_t));
     wifi_getStats(RADIO_INDEX, &wifi_sta_stats);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_getStats...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -828,7 +829,7 @@ void test_l1_wifi_common_hal_negative3_getStats (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioNumberOfEntries (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioNumberOfEntries...\n");
+    WIFI_TRACE_TEST_BEGIN();
     ULONG output;
     INT ret;    
 
@@ -842,7 +843,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioNumberOfEntries (void)
     UT_LOG("Returned value: %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioNumberOfEntries...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -865,7 +866,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioNumberOfEntries (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioNumberOfEntries (void)
 {
-   UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioNumberOfEntries...\n");
+   WIFI_TRACE_TEST_BEGIN();
    INT ret;
    ULONG *output = NULL;
 
@@ -873,7 +874,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioNumberOfEntries (void)
    UT_LOG("Invoking wifi_getRadioNumberOfEntries with NULL output reference. Returned value: %d\n", ret);
    UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-   UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioNumberOfEntries...\n");
+   WIFI_TRACE_TEST_END();
 }
 
 
@@ -897,7 +898,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioNumberOfEntries (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioNumberOfEntries (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioNumberOfEntries...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ret;
     ULONG output;
 
@@ -906,7 +907,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioNumberOfEntries (void)
     UT_LOG("Returned value: %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioNumberOfEntries...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -930,7 +931,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioNumberOfEntries (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getSSIDNumberOfEntries (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getSSIDNumberOfEntries...\n");
+    WIFI_TRACE_TEST_BEGIN();
     ULONG ssidNumber;
     INT result;
 
@@ -944,7 +945,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getSSIDNumberOfEntries (void)
         UT_FAIL("failed due to invalid number of ssid\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getSSIDNumberOfEntries...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -967,7 +968,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getSSIDNumberOfEntries (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getSSIDNumberOfEntries (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getSSIDNumberOfEntries...\n");
+    WIFI_TRACE_TEST_BEGIN();
     ULONG ssidNumber;
     INT result;
 
@@ -976,7 +977,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getSSIDNumberOfEntries (void)
     UT_LOG("Return status: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getSSIDNumberOfEntries...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -999,7 +1000,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getSSIDNumberOfEntries (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getSSIDNumberOfEntries (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getSSIDNumberOfEntries...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT result;
 
     UT_LOG("Invoking wifi_getSSIDNumberOfEntries with a NULL pointer.\n");
@@ -1007,7 +1008,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getSSIDNumberOfEntries (void)
     UT_LOG("Return status: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getSSIDNumberOfEntries...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1030,7 +1031,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getSSIDNumberOfEntries (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioEnable (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL output_bool;
     INT ret;
 
@@ -1044,7 +1045,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioEnable (void)
         UT_FAIL("failed due to invalid Radio Enable value\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1067,7 +1068,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioEnable (void)
 */
 void test_l1_wifi_common_hal_positive2_wifi_getRadioEnable (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive2_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL output_bool = 0;
     INT ret;
 
@@ -1081,7 +1082,7 @@ void test_l1_wifi_common_hal_positive2_wifi_getRadioEnable (void)
     UT_FAIL("failed due to invalid Radio Enable value\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive2_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1104,7 +1105,7 @@ void test_l1_wifi_common_hal_positive2_wifi_getRadioEnable (void)
 */
 void test_l1_wifi_common_hal_positive3_wifi_getRadioEnable (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive3_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL output_bool = 1;
     INT ret;
 
@@ -1118,7 +1119,7 @@ void test_l1_wifi_common_hal_positive3_wifi_getRadioEnable (void)
         UT_FAIL("failed due to invalid Radio Enable value\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive3_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1141,7 +1142,7 @@ void test_l1_wifi_common_hal_positive3_wifi_getRadioEnable (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioEnable (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL output_bool;
     INT radioIndex = 2;
     INT ret;
@@ -1151,7 +1152,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioEnable (void)
     UT_LOG("Returned: %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1174,7 +1175,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioEnable (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioEnable (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL *output_bool = NULL;
     INT ret;
 
@@ -1183,7 +1184,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioEnable (void)
     UT_LOG("Returned: %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1206,7 +1207,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioEnable (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioEnable (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL output_bool;
     INT radioIndex = -1;
     INT ret;
@@ -1216,7 +1217,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioEnable (void)
     UT_LOG("Returned: %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR)
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1239,7 +1240,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioEnable (void)
 */
 void test_l1_wifi_common_hal_negative4_wifi_getRadioEnable (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ret;
     BOOL output_bool;
 
@@ -1248,7 +1249,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioEnable (void)
     UT_LOG("Returned: %d, Output: %d\n", ret, output_bool);
     UT_ASSERT_EQUAL(ret, RETURN_ERR)
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getRadioEnable...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1271,7 +1272,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioEnable (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioStatus (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioStatus...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[20];
     const char* radiostatus[] = {"Up", "Down", "Unknown", "Dormant", "NotPresent", "LowerLayerDown"};
     int count = sizeof(radiostatus) / sizeof(radiostatus[0]);
@@ -1289,7 +1290,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioStatus (void)
         UT_FAIL("failed due to invalid output_string\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioStatus...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -1313,7 +1314,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioStatus (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioStatus (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioStatus...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT return_value;
     CHAR output_string[20];
 
@@ -1322,7 +1323,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioStatus (void)
     UT_LOG("return status: %d", return_value);
     UT_ASSERT_EQUAL(return_value, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioStatus...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -1346,7 +1347,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioStatus (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioStatus (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioStatus...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT return_value;
     INT radioIndex = 2;
     CHAR output_string[20];
@@ -1356,7 +1357,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioStatus (void)
     UT_LOG("Return value: %d\n", return_value);
     UT_ASSERT_EQUAL(return_value, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioStatus...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1379,7 +1380,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioStatus (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioStatus (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioStatus...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *output_string = NULL; 
     INT return_value;
 
@@ -1388,7 +1389,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioStatus (void)
     UT_LOG("Return value: %d\n", return_value);
     UT_ASSERT_EQUAL(return_value, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioStatus...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -1412,7 +1413,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioStatus (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioIfName (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioIfName...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[MAX_OUTPUT_STRING_LEN] = {0};
     INT status;
 
@@ -1421,7 +1422,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioIfName (void)
     UT_LOG(" The function status returned: %d, output string: %s\n", status, output_string);
     UT_ASSERT_EQUAL(status, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioIfName...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1444,7 +1445,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioIfName (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioIfName (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioIfName...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[MAX_OUTPUT_STRING_LEN];
 
     UT_LOG("Invoking wifi_getRadioIfName without calling either wifi_init or wifi_initWithConfig.\n");
@@ -1452,7 +1453,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioIfName (void)
     UT_LOG(" The function status returned: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioIfName...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1475,7 +1476,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioIfName (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioIfName (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioIfName...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[MAX_OUTPUT_STRING_LEN];
     INT radioIndex = 0;
     INT status;
@@ -1485,7 +1486,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioIfName (void)
     UT_LOG("The function status returned: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioIfName...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -1509,7 +1510,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioIfName (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioIfName (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioIfName...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[MAX_OUTPUT_STRING_LEN];
     INT radioIndex = 2;
     INT status;
@@ -1519,7 +1520,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioIfName (void)
     UT_LOG("The function status returned: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioIfName...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -1543,7 +1544,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioIfName (void)
 */
 void test_l1_wifi_common_hal_negative4_wifi_getRadioIfName (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getRadioIfName...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT status;
 
     UT_LOG("Invoking wifi_getRadioIfName with valid radio index and NULL CHAR pointer.\n");
@@ -1551,7 +1552,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioIfName (void)
     UT_LOG("The function status returned: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getRadioIfName...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -1575,7 +1576,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioIfName (void)
 */
 void test_l1_wifi_common_hal_negative5_wifi_getRadioIfName (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative5_wifi_getRadioIfName...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *output_string = NULL;
     INT status;
         
@@ -1584,7 +1585,7 @@ void test_l1_wifi_common_hal_negative5_wifi_getRadioIfName (void)
     UT_LOG("The function status returned: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative5_wifi_getRadioIfName...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1607,7 +1608,7 @@ void test_l1_wifi_common_hal_negative5_wifi_getRadioIfName (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioMaxBitRate (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioMaxBitRate...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR outputVal[50] = {0};
     INT bitrate;
     INT status;
@@ -1623,7 +1624,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioMaxBitRate (void)
         UT_FAIL("failed due to invalid output_string\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioMaxBitRate...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1646,7 +1647,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioMaxBitRate (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioMaxBitRate (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioMaxBitRate...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR outputVal[50];
     INT radioIndex = 2;
     INT status;
@@ -1656,7 +1657,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioMaxBitRate (void)
     UT_LOG("The return status is %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioMaxBitRate...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1679,7 +1680,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioMaxBitRate (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioMaxBitRate (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioMaxBitRate...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR outputVal[50];
     INT status;
 
@@ -1688,7 +1689,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioMaxBitRate (void)
     UT_LOG("The return status is %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioMaxBitRate...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1711,7 +1712,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioMaxBitRate (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioMaxBitRate (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioMaxBitRate...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT status;
 
     UT_LOG("Invoking wifi_getRadioMaxBitRate with NULL output_string.\n");
@@ -1719,7 +1720,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioMaxBitRate (void)
     UT_LOG("The return status is %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioMaxBitRate...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1742,7 +1743,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioMaxBitRate (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioSupportedFrequencyBands (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioSupportedFrequencyBands...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[12] = {0};
     INT return_status;
 
@@ -1756,7 +1757,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioSupportedFrequencyBands (voi
         UT_FAIL("failed due to invalid output_string\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioSupportedFrequencyBands...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1779,7 +1780,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioSupportedFrequencyBands (voi
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioSupportedFrequencyBands (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioSupportedFrequencyBands...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *output_string = NULL;
     INT return_status;
 
@@ -1788,7 +1789,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioSupportedFrequencyBands (voi
     UT_LOG("Return Status: %d\n", return_status);
     UT_ASSERT_EQUAL(return_status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioSupportedFrequencyBands...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1811,7 +1812,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioSupportedFrequencyBands (voi
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioSupportedFrequencyBands (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioSupportedFrequencyBands...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[12];
     INT return_status;
     INT radioIndex = 0;
@@ -1821,7 +1822,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioSupportedFrequencyBands (voi
     UT_LOG("Return Status: %d\n", return_status);
     UT_ASSERT_EQUAL(return_status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioSupportedFrequencyBands...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1844,7 +1845,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioSupportedFrequencyBands (voi
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioSupportedFrequencyBands (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioSupportedFrequencyBands...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[12];
     INT return_status;
 
@@ -1853,7 +1854,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioSupportedFrequencyBands (voi
     UT_LOG("Return Status: %d\n", return_status);
     UT_ASSERT_EQUAL(return_status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioSupportedFrequencyBands...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1876,7 +1877,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioSupportedFrequencyBands (voi
 */
 void test_l1_wifi_common_hal_negative4_wifi_getRadioSupportedFrequencyBands (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getRadioSupportedFrequencyBands...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[3];
     INT return_status;
 
@@ -1885,7 +1886,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioSupportedFrequencyBands (voi
     UT_LOG("Return Status: %d\n", return_status);
     UT_ASSERT_EQUAL(return_status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getRadioSupportedFrequencyBands...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1908,7 +1909,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioSupportedFrequencyBands (voi
 */        
 void test_l1_wifi_common_hal_positive1_wifi_getRadioOperatingFrequencyBand (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioOperatingFrequencyBand...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[32] = {0};
     INT result;
 
@@ -1922,7 +1923,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioOperatingFrequencyBand (void
         UT_FAIL("failed due to invalid output_string\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioOperatingFrequencyBand...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1945,7 +1946,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioOperatingFrequencyBand (void
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioOperatingFrequencyBand (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioOperatingFrequencyBand...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[32];
     INT radioIndex = 0;
     INT result;
@@ -1955,7 +1956,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioOperatingFrequencyBand (void
     UT_LOG("Returned: status: %d, output_string: %s\n", result, output_string);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioOperatingFrequencyBand...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -1978,7 +1979,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioOperatingFrequencyBand (void
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioOperatingFrequencyBand (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioOperatingFrequencyBand...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[32];
     INT result;
 
@@ -1987,7 +1988,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioOperatingFrequencyBand (void
     UT_LOG("Returned: status: %d, output_string: %s\n", result, output_string);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioOperatingFrequencyBand...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2010,7 +2011,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioOperatingFrequencyBand (void
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioOperatingFrequencyBand (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioOperatingFrequencyBand...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *output_string = NULL;
     INT result;
 
@@ -2019,7 +2020,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioOperatingFrequencyBand (void
     UT_LOG("Returned: status: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioOperatingFrequencyBand...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2042,7 +2043,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioOperatingFrequencyBand (void
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioSupportedStandards (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioSupportedStandards ... \n"); 
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[100];
     int status;
 
@@ -2056,7 +2057,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioSupportedStandards (void)
         UT_FAIL("failed due to invalid output_string\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioSupportedStandards ...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2079,7 +2080,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioSupportedStandards (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioSupportedStandards (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioSupportedStandards ... \n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[100];
     INT radioIndex = 0;
     int status;
@@ -2089,7 +2090,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioSupportedStandards (void)
     UT_LOG("Returned status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioSupportedStandards ...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2112,7 +2113,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioSupportedStandards (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioSupportedStandards (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioSupportedStandards ... \n");
+    WIFI_TRACE_TEST_BEGIN();
     int status;
 
     UT_LOG("Invoking wifi_getRadioSupportedStandards with output_string as NULL. \n");
@@ -2120,7 +2121,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioSupportedStandards (void)
     UT_LOG("Returned status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioSupportedStandards ...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2143,7 +2144,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioSupportedStandards (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioSupportedStandards (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioSupportedStandards ... \n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[100];
     int status;
 
@@ -2152,7 +2153,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioSupportedStandards (void)
     UT_LOG("Returned status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioSupportedStandards ...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2175,7 +2176,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioSupportedStandards (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioStandard (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioStandard...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[50] = {0};
     BOOL gOnly, nOnly, acOnly;
     INT retStatus;
@@ -2190,7 +2191,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioStandard (void)
         UT_FAIL("failed due to invalid output_string\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioStandard...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2213,7 +2214,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioStandard (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioStandard (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioStandard...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 2;
     CHAR output_string[50];
     BOOL gOnly, nOnly, acOnly;
@@ -2224,7 +2225,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioStandard (void)
     UT_LOG("Return status is %d\n", retStatus);
     UT_ASSERT_EQUAL(retStatus, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioStandard...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2247,7 +2248,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioStandard (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioStandard (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioStandard...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[50];
     BOOL gOnly, nOnly, acOnly;
     INT retStatus;
@@ -2257,7 +2258,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioStandard (void)
     UT_LOG("Return status is %d\n", retStatus);
     UT_ASSERT_EQUAL(retStatus, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioStandard...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2281,7 +2282,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioStandard (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioStandard (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioStandard...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT retStatus;
 
     UT_LOG("Invoking wifi_getRadioStandard with radioIndex 1. All Output Buffers are NULL.\n");
@@ -2289,7 +2290,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioStandard (void)
     UT_LOG("Return status is %d\n", retStatus);
     UT_ASSERT_EQUAL(retStatus, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioStandard...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -2313,7 +2314,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioStandard (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioPossibleChannels (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioPossibleChannels...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[50] = {0};
     char *token;
     INT retVal, value;
@@ -2335,7 +2336,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioPossibleChannels (void)
         token = strtok(NULL, " ");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioPossibleChannels...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2359,7 +2360,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioPossibleChannels (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioPossibleChannels (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioPossibleChannels...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 2;
     CHAR output_string[50];
     INT retVal;
@@ -2369,7 +2370,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioPossibleChannels (void)
     UT_LOG("Returned value was %d\n", retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioPossibleChannels...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2394,7 +2395,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioPossibleChannels (void)
 */ 
 void test_l1_wifi_common_hal_negative2_wifi_getRadioPossibleChannels (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioPossibleChannels...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[50];
     INT retVal;
 
@@ -2403,7 +2404,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioPossibleChannels (void)
     UT_LOG("Returned value was %d\n", retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioPossibleChannels...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2426,7 +2427,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioPossibleChannels (void)
  */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioPossibleChannels (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioPossibleChannels...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR* output_string = NULL;
     INT retVal;
 
@@ -2435,7 +2436,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioPossibleChannels (void)
     UT_LOG("Returned value was %d\n", retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioPossibleChannels...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2458,7 +2459,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioPossibleChannels (void)
 */
 void test_l1_wifi_common_hal_negative4_wifi_getRadioPossibleChannels (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getRadioPossibleChannels...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[3];
     INT retVal;
 
@@ -2467,7 +2468,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioPossibleChannels (void)
     UT_LOG("Returned value was %d\n", retVal);
     UT_ASSERT_EQUAL(retVal, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getRadioPossibleChannels...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2491,7 +2492,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioPossibleChannels (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioChannelsInUse (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioChannelsInUse...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[MAX_LENGTH];
     INT returnValue, value;
     char *token;
@@ -2513,7 +2514,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioChannelsInUse (void)
         token = strtok(NULL, " ");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioChannelsInUse...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2536,7 +2537,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioChannelsInUse (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioChannelsInUse (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioChannelsInUse...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[MAX_LENGTH];
     INT returnValue;
 
@@ -2545,7 +2546,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioChannelsInUse (void)
     UT_LOG("Return Value: %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioChannelsInUse...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2568,7 +2569,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioChannelsInUse (void)
 */ 
 void test_l1_wifi_common_hal_negative2_wifi_getRadioChannelsInUse (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioChannelsInUse...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[MAX_LENGTH];
     INT radioIndex = 2;
     INT returnValue;
@@ -2578,7 +2579,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioChannelsInUse (void)
     UT_LOG("Return Value: %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioChannelsInUse...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2601,7 +2602,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioChannelsInUse (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioChannelsInUse (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioChannelsInUse...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT returnValue;
 
     UT_LOG("Invoking wifi_getRadioChannelsInUse with NULL output_string.\n");
@@ -2609,7 +2610,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioChannelsInUse (void)
     UT_LOG("Return Value: %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioChannelsInUse...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2633,7 +2634,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioChannelsInUse (void)
 */
 void test_l1_wifi_common_hal_negative4_wifi_getRadioChannelsInUse (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getRadioChannelsInUse...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[2];
     INT returnValue;
 
@@ -2642,7 +2643,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioChannelsInUse (void)
     UT_LOG("Return Value: %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getRadioChannelsInUse...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2665,7 +2666,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioChannelsInUse (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioChannel (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioChannel...\n");
+    WIFI_TRACE_TEST_BEGIN();
     ULONG output_ulong;
     INT returnValue;
 
@@ -2694,7 +2695,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioChannel (void)
         UT_FAIL("invalid Radio channel\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioChannel...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2717,7 +2718,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioChannel (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioChannel (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioChannel...\n");
+    WIFI_TRACE_TEST_BEGIN();
     ULONG output_ulong;
     INT radioIndex = 2;
     INT returnValue;
@@ -2727,7 +2728,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioChannel (void)
     UT_LOG("Return status is %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioChannel...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2750,7 +2751,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioChannel (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioChannel (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioChannel...\n");
+    WIFI_TRACE_TEST_BEGIN();
     ULONG *output_ulong = NULL;
     INT returnValue;
 
@@ -2759,7 +2760,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioChannel (void)
     UT_LOG("Return status is %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioChannel...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2783,7 +2784,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioChannel (void)
 
 void test_l1_wifi_common_hal_negative3_wifi_getRadioChannel (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioChannel...\n");
+    WIFI_TRACE_TEST_BEGIN();
     ULONG output_ulong;
     INT returnValue;
 
@@ -2792,7 +2793,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioChannel (void)
     UT_LOG("The returned channel number is %lu and return status is %d\n", output_ulong, returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioChannel...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2815,7 +2816,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioChannel (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioAutoChannelSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioAutoChannelSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL output_bool;
     INT result;
 
@@ -2829,7 +2830,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioAutoChannelSupported (void)
         UT_FAIL("failed due to invalid output_bool\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioAutoChannelSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -2853,7 +2854,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioAutoChannelSupported (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioAutoChannelSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioAutoChannelSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL output_bool;
     INT result;
 
@@ -2862,7 +2863,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioAutoChannelSupported (void)
     UT_LOG("return status: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioAutoChannelSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2885,7 +2886,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioAutoChannelSupported (void)
  */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioAutoChannelSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioAutoChannelSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 2;
     BOOL output_bool;
     INT result;
@@ -2895,7 +2896,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioAutoChannelSupported (void)
     UT_LOG("Returned value was :  %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioAutoChannelSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2918,7 +2919,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioAutoChannelSupported (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioAutoChannelSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioAutoChannelSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT result;
 
     UT_LOG("Invoking wifi_getRadioAutoChannelSupported with NULL output_bool.\n");
@@ -2926,7 +2927,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioAutoChannelSupported (void)
     UT_LOG("Returned value was : %d \n",result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioAutoChannelSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -2950,7 +2951,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioAutoChannelSupported (void)
 */
 void test_l1_wifi_common_hal_positive2_wifi_getRadioAutoChannelSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive2_wifi_getRadioAutoChannelSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL output_bool = 3;
     INT result;
 
@@ -2964,7 +2965,7 @@ void test_l1_wifi_common_hal_positive2_wifi_getRadioAutoChannelSupported (void)
         UT_FAIL("failed due to invalid output_bool\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive2_wifi_getRadioAutoChannelSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -2987,7 +2988,7 @@ void test_l1_wifi_common_hal_positive2_wifi_getRadioAutoChannelSupported (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioAutoChannelEnable (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioAutoChannelEnable...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL output_bool;
     INT ret;
 
@@ -3001,7 +3002,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioAutoChannelEnable (void)
         UT_FAIL("failed due to invalid output_bool\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioAutoChannelEnable...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3024,7 +3025,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioAutoChannelEnable (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioAutoChannelEnable (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioAutoChannelEnable...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL output_bool;
     INT ret;
     INT radioIndex = 2;
@@ -3034,7 +3035,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioAutoChannelEnable (void)
     UT_LOG("Received output_bool: %d and return status: %d\n", output_bool, ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioAutoChannelEnable...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3057,7 +3058,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioAutoChannelEnable (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioAutoChannelEnable (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioAutoChannelEnable...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ret;
 
     UT_LOG("Invoking wifi_getRadioAutoChannelEnable(1, NULL).\n");
@@ -3065,7 +3066,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioAutoChannelEnable (void)
     UT_LOG("Received return status: %i\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR)
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioAutoChannelEnable...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3088,7 +3089,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioAutoChannelEnable (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioAutoChannelEnable (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioAutoChannelEnable...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL output_bool;
     INT ret;
 
@@ -3097,7 +3098,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioAutoChannelEnable (void)
     UT_LOG("Received output_bool: %c and return status: %d\n", output_bool, ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR)
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioAutoChannelEnable...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3120,7 +3121,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioAutoChannelEnable (void)
 */
 void test_l1_wifi_common_hal_positive1_getRadioAutoChannelRefreshPeriod (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_getRadioAutoChannelRefreshPeriod...\n");
+    WIFI_TRACE_TEST_BEGIN();
     ULONG output = 0;
     INT ret;
 
@@ -3134,7 +3135,7 @@ void test_l1_wifi_common_hal_positive1_getRadioAutoChannelRefreshPeriod (void)
         UT_FAIL("failed due to invalid output_ulong\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_getRadioAutoChannelRefreshPeriod...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3157,7 +3158,7 @@ void test_l1_wifi_common_hal_positive1_getRadioAutoChannelRefreshPeriod (void)
 */
 void test_l1_wifi_common_hal_negative1_getRadioAutoChannelRefreshPeriod (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_getRadioAutoChannelRefreshPeriod...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ret;
     INT radioIndex = 2;
 
@@ -3166,7 +3167,7 @@ void test_l1_wifi_common_hal_negative1_getRadioAutoChannelRefreshPeriod (void)
     UT_LOG("Returned status is %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_getRadioAutoChannelRefreshPeriod...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3190,7 +3191,7 @@ void test_l1_wifi_common_hal_negative1_getRadioAutoChannelRefreshPeriod (void)
  */
 void test_l1_wifi_common_hal_negative2_getRadioAutoChannelRefreshPeriod (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_getRadioAutoChannelRefreshPeriod...\n");
+    WIFI_TRACE_TEST_BEGIN();
     ULONG output = 0;
     INT ret;
 
@@ -3199,7 +3200,7 @@ void test_l1_wifi_common_hal_negative2_getRadioAutoChannelRefreshPeriod (void)
     UT_LOG("Returned status is %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_getRadioAutoChannelRefreshPeriod...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3222,7 +3223,7 @@ void test_l1_wifi_common_hal_negative2_getRadioAutoChannelRefreshPeriod (void)
 */
 void test_l1_wifi_common_hal_positive2_getRadioAutoChannelRefreshPeriod (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive2_getRadioAutoChannelRefreshPeriod...\n");
+    WIFI_TRACE_TEST_BEGIN();
     ULONG output = UINT32_MAX;
     INT ret;
 
@@ -3236,7 +3237,7 @@ void test_l1_wifi_common_hal_positive2_getRadioAutoChannelRefreshPeriod (void)
         UT_FAIL("failed due to invalid output\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive2_getRadioAutoChannelRefreshPeriod...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3259,7 +3260,7 @@ void test_l1_wifi_common_hal_positive2_getRadioAutoChannelRefreshPeriod (void)
 */
 void test_l1_wifi_common_hal_negative3_getRadioAutoChannelRefreshPeriod (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_getRadioAutoChannelRefreshPeriod...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ret;
 
     UT_LOG("Invoking wifi_getRadioAutoChannelRefreshPeriod with null pointer for output.\n");
@@ -3267,7 +3268,7 @@ void test_l1_wifi_common_hal_negative3_getRadioAutoChannelRefreshPeriod (void)
     UT_LOG("Returned status is %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_getRadioAutoChannelRefreshPeriod...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3290,7 +3291,7 @@ void test_l1_wifi_common_hal_negative3_getRadioAutoChannelRefreshPeriod (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioGuardInterval (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioGuardInterval...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[10];
     INT result;
 
@@ -3305,7 +3306,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioGuardInterval (void)
         UT_FAIL("failed due to invalid output_string\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioGuardInterval...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3328,7 +3329,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioGuardInterval (void)
  */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioGuardInterval (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioGuardInterval...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 2;
     CHAR output_string[10];
     INT result;
@@ -3338,7 +3339,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioGuardInterval (void)
     UT_LOG("Return status is: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioGuardInterval...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3361,7 +3362,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioGuardInterval (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioGuardInterval (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioGuardInterval...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *output_string = NULL;
     INT result;
 
@@ -3370,7 +3371,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioGuardInterval (void)
     UT_LOG("Return status is: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioGuardInterval...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3393,7 +3394,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioGuardInterval (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioGuardInterval (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioGuardInterval...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[24] = {'\0'};
     INT result;
 
@@ -3402,7 +3403,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioGuardInterval (void)
     UT_LOG("Return status is: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioGuardInterval...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3425,7 +3426,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioGuardInterval (void)
  */
 void test_l1_wifi_common_hal_negative4_wifi_getRadioGuardInterval (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getRadioGuardInterval...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[10];
     INT result;
 
@@ -3434,7 +3435,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioGuardInterval (void)
     UT_LOG("Return status is: %d\n", result );
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getRadioGuardInterval...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3457,7 +3458,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioGuardInterval (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioOperatingChannelBandwidth (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioOperatingChannelBandwidth...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[50] = {0};
     const char* bandwidth[] = {"20MHz", "40MHz", "80MHz", "160MHz", "Auto"};
     INT returnValue;
@@ -3473,7 +3474,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioOperatingChannelBandwidth (v
         UT_FAIL("failed due to invalid output_string\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioOperatingChannelBandwidth...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3497,7 +3498,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioOperatingChannelBandwidth (v
  */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioOperatingChannelBandwidth (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioOperatingChannelBandwidth...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 2;
     CHAR output_string[50];
     INT returnValue;
@@ -3507,7 +3508,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioOperatingChannelBandwidth (v
     UT_LOG("Return value: %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioOperatingChannelBandwidth...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3530,7 +3531,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioOperatingChannelBandwidth (v
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioOperatingChannelBandwidth (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioOperatingChannelBandwidth...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *output_string = NULL;
     INT returnValue;
 
@@ -3539,7 +3540,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioOperatingChannelBandwidth (v
     UT_LOG("Return value: %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioOperatingChannelBandwidth...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3562,7 +3563,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioOperatingChannelBandwidth (v
  */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioOperatingChannelBandwidth (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioOperatingChannelBandwidth...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[50];
     INT returnValue;
 
@@ -3571,7 +3572,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioOperatingChannelBandwidth (v
     UT_LOG("Return value: %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioOperatingChannelBandwidth...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3594,7 +3595,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioOperatingChannelBandwidth (v
 */
 void test_l1_wifi_common_hal_negative4_wifi_getRadioOperatingChannelBandwidth (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getRadioOperatingChannelBandwidth...\n");
+    WIFI_TRACE_TEST_BEGIN();
     FLOAT radioIndex = -1;
     CHAR output_string[50];
     INT returnValue;
@@ -3604,7 +3605,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioOperatingChannelBandwidth (v
     UT_LOG("Return value: %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getRadioOperatingChannelBandwidth...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3628,7 +3629,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioOperatingChannelBandwidth (v
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioExtChannel (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioExtChannel...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[100];
     INT result;
 
@@ -3642,7 +3643,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioExtChannel (void)
         UT_FAIL("failed due to invalid output_string\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioExtChannel...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3665,7 +3666,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioExtChannel (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioExtChannel (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioExtChannel...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT result;
     INT radioIndex = 0;
     CHAR output_string[100]; 
@@ -3675,7 +3676,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioExtChannel (void)
     UT_LOG("The return status is %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioExtChannel...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3698,7 +3699,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioExtChannel (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioExtChannel (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioExtChannel...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 2;
     CHAR output_string[100]; 
     INT result;
@@ -3708,7 +3709,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioExtChannel (void)
     UT_LOG("The return status is %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioExtChannel...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3731,7 +3732,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioExtChannel (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioExtChannel (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioExtChannel...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *output_string = NULL;
     INT result;
 
@@ -3740,7 +3741,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioExtChannel (void)
     UT_LOG("The return status is %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioExtChannel...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3763,7 +3764,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioExtChannel (void)
 */
 void test_l1_wifi_common_hal_negative4_wifi_getRadioExtChannel (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getRadioExtChannel...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[100]; 
     INT result;
 
@@ -3772,7 +3773,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioExtChannel (void)
     UT_LOG("The return status is %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getRadioExtChannel...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3795,7 +3796,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioExtChannel (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioMCS (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioMCS...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT output_INT;
     INT status;
 
@@ -3821,7 +3822,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioMCS (void)
         UT_FAIL("invalid RadioMCS\n");
     }        
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioMCS...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3844,7 +3845,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioMCS (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioMCS (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioMCS...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 2;
     INT output_INT;
     INT status;
@@ -3854,7 +3855,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioMCS (void)
     UT_LOG("Retrun Status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioMCS...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3877,7 +3878,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioMCS (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioMCS (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioMCS...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT status;
 
     UT_LOG("Invoking wifi_getRadioMCS with valid radioIndex and NULL output_INT pointer.\n");
@@ -3885,7 +3886,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioMCS (void)
     UT_LOG("Retrun Status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioMCS...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3908,7 +3909,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioMCS (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioMCS (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioMCS...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT output_INT;
     INT status;
 
@@ -3917,7 +3918,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioMCS (void)
     UT_LOG("Return Status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioMCS...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3940,7 +3941,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioMCS (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioTransmitPowerSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioTransmitPowerSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_list[50];
     int return_status;
 
@@ -3949,7 +3950,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioTransmitPowerSupported (void
     UT_LOG("return status: %d, output_list: %s\n", return_status, output_list);
     UT_ASSERT_EQUAL(return_status, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioTransmitPowerSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -3972,7 +3973,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioTransmitPowerSupported (void
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioTransmitPowerSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioTransmitPowerSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 0;
     CHAR output_list[50];
     int return_status;
@@ -3982,7 +3983,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioTransmitPowerSupported (void
     UT_LOG("Return status: %d\n", return_status);
     UT_ASSERT_EQUAL(return_status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioTransmitPowerSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4005,7 +4006,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioTransmitPowerSupported (void
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioTransmitPowerSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioTransmitPowerSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 2;
     CHAR output_list[50];
     int return_status;
@@ -4015,7 +4016,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioTransmitPowerSupported (void
     UT_LOG("Return status: %d\n", return_status);
     UT_ASSERT_EQUAL(return_status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioTransmitPowerSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4038,7 +4039,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioTransmitPowerSupported (void
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioTransmitPowerSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioTransmitPowerSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *output_list = NULL;
     int return_status;
 
@@ -4047,7 +4048,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioTransmitPowerSupported (void
     UT_LOG("Return status: %d\n", return_status);
     UT_ASSERT_EQUAL(return_status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioTransmitPowerSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4071,7 +4072,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioTransmitPowerSupported (void
 */
 void test_l1_wifi_common_hal_negative4_wifi_getRadioTransmitPowerSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getRadioTransmitPowerSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_list[50];
     int return_status;
 
@@ -4080,7 +4081,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioTransmitPowerSupported (void
     UT_LOG("return status: %d, output_list: %s\n", return_status, output_list);
     UT_ASSERT_EQUAL(return_status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getRadioTransmitPowerSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4103,7 +4104,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioTransmitPowerSupported (void
  */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioTransmitPower (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioTransmitPower...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT output_INT = 50;
     INT ret;
 
@@ -4117,7 +4118,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioTransmitPower (void)
         UT_FAIL("failed due to invalid TransmitPower\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioTransmitPower...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4143,7 +4144,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioTransmitPower (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioTransmitPower (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioTransmitPower...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 2;
     INT output_INT;
     INT ret;
@@ -4153,7 +4154,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioTransmitPower (void)
     UT_LOG("Return status: %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioTransmitPower...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4176,7 +4177,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioTransmitPower (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioTransmitPower (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioTransmitPower...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT *output_INT = NULL;
     INT ret;
 
@@ -4185,7 +4186,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioTransmitPower (void)
     UT_LOG("Return status: %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioTransmitPower...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4208,7 +4209,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioTransmitPower (void)
  */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioTransmitPower (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioTransmitPower...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT output_INT = 50;
     INT ret;
 
@@ -4217,7 +4218,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioTransmitPower (void)
     UT_LOG("Return status: %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioTransmitPower...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4239,7 +4240,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioTransmitPower (void)
  */
 void test_l1_wifi_common_hal_negative4_wifi_getRadioTransmitPower (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getRadioTransmitPower...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT output_INT = 0;
     INT ret;
 
@@ -4248,7 +4249,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioTransmitPower (void)
     UT_LOG("Return status: %d\n", ret);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getRadioTransmitPower...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4272,7 +4273,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRadioTransmitPower (void)
 */
 void test_l1_wifi_common_hal_positive_1_wifi_getRadioIEEE80211hSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive_1_wifi_getRadioIEEE80211hSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL supported = 0;
     INT returnValue;
 
@@ -4286,7 +4287,7 @@ void test_l1_wifi_common_hal_positive_1_wifi_getRadioIEEE80211hSupported (void)
         UT_FAIL("failed due to invalid output\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive_1_wifi_getRadioIEEE80211hSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4309,7 +4310,7 @@ void test_l1_wifi_common_hal_positive_1_wifi_getRadioIEEE80211hSupported (void)
  */
 void test_l1_wifi_common_hal_negative_1_wifi_getRadioIEEE80211hSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative_1_wifi_getRadioIEEE80211hSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 0;
     BOOL supported;
     INT returnValue;
@@ -4319,7 +4320,7 @@ void test_l1_wifi_common_hal_negative_1_wifi_getRadioIEEE80211hSupported (void)
     UT_LOG("Returned status : %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative_1_wifi_getRadioIEEE80211hSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4342,7 +4343,7 @@ void test_l1_wifi_common_hal_negative_1_wifi_getRadioIEEE80211hSupported (void)
 */
 void test_l1_wifi_common_hal_negative_2_wifi_getRadioIEEE80211hSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative_2_wifi_getRadioIEEE80211hSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL *supported = NULL;
     INT returnValue;
 
@@ -4351,7 +4352,7 @@ void test_l1_wifi_common_hal_negative_2_wifi_getRadioIEEE80211hSupported (void)
     UT_LOG("Returned status : %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative_2_wifi_getRadioIEEE80211hSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4374,7 +4375,7 @@ void test_l1_wifi_common_hal_negative_2_wifi_getRadioIEEE80211hSupported (void)
 */
 void test_l1_wifi_common_hal_negative_3_wifi_getRadioIEEE80211hSupported (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative_3_wifi_getRadioIEEE80211hSupported...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL supported;
     INT returnValue;
 
@@ -4383,7 +4384,7 @@ void test_l1_wifi_common_hal_negative_3_wifi_getRadioIEEE80211hSupported (void)
     UT_LOG("Returned status : %d\n", returnValue);
     UT_ASSERT_EQUAL(returnValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative_3_wifi_getRadioIEEE80211hSupported...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4406,7 +4407,7 @@ void test_l1_wifi_common_hal_negative_3_wifi_getRadioIEEE80211hSupported (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioIEEE80211hEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioIEEE80211hEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL enable;
     INT result;  
 
@@ -4420,7 +4421,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioIEEE80211hEnabled (void)
         UT_FAIL("failed due to invalid RadioIEEE80211hEnabled value\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioIEEE80211hEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4443,7 +4444,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioIEEE80211hEnabled (void)
 */ 
 void test_l1_wifi_common_hal_negative1_wifi_getRadioIEEE80211hEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioIEEE80211hEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL enable;
     INT result; 
 
@@ -4452,7 +4453,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioIEEE80211hEnabled (void)
     UT_LOG("return status: %d\n",result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioIEEE80211hEnabled...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4476,7 +4477,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioIEEE80211hEnabled (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioIEEE80211hEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioIEEE80211hEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT result;
 
     UT_LOG("Invoking wifi_getRadioIEEE80211hEnabled with NULL parameter.\n");
@@ -4484,7 +4485,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioIEEE80211hEnabled (void)
     UT_LOG("Return status: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioIEEE80211hEnabled...", "\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4507,7 +4508,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioIEEE80211hEnabled (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioIEEE80211hEnabled (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioIEEE80211hEnabled...\n");
+    WIFI_TRACE_TEST_BEGIN();
     BOOL enable;
     INT radioIndex = 2;
     INT result;  
@@ -4517,7 +4518,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioIEEE80211hEnabled (void)
     UT_LOG("Return  status: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioIEEE80211hEnabled...", "\n");
+    WIFI_TRACE_TEST_END();
 }
 
  /**
@@ -4540,7 +4541,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioIEEE80211hEnabled (void)
  */
 void test_l1_wifi_common_hal_positive1_wifi_getRegulatoryDomain (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[50];
     INT status;
 
@@ -4555,7 +4556,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRegulatoryDomain (void)
         UT_FAIL("Invalid 3rd octet\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -4579,7 +4580,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRegulatoryDomain (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getRegulatoryDomain (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = -1;
     CHAR output_string[50];
     INT status;
@@ -4589,7 +4590,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRegulatoryDomain (void)
     UT_LOG("Return status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4612,7 +4613,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRegulatoryDomain (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRegulatoryDomain (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 0;
     CHAR output_string[50];
     INT status;
@@ -4622,7 +4623,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRegulatoryDomain (void)
     UT_LOG("Return status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4647,7 +4648,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRegulatoryDomain (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getRegulatoryDomain (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 2;
     CHAR output_string[50];
     INT status;
@@ -4657,7 +4658,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRegulatoryDomain (void)
     UT_LOG("Return status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_END();
 }
     
 /**
@@ -4681,7 +4682,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRegulatoryDomain (void)
  */
 void test_l1_wifi_common_hal_negative4_wifi_getRegulatoryDomain (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[4] = {'\0'};
     INT status;
 
@@ -4690,7 +4691,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRegulatoryDomain (void)
     UT_LOG("Return status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -4715,7 +4716,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getRegulatoryDomain (void)
 */
 void test_l1_wifi_common_hal_negative5_wifi_getRegulatoryDomain (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative5_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *output_string = NULL;
     INT status;
 
@@ -4724,7 +4725,7 @@ void test_l1_wifi_common_hal_negative5_wifi_getRegulatoryDomain (void)
     UT_LOG("Return status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative5_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -4748,7 +4749,7 @@ void test_l1_wifi_common_hal_negative5_wifi_getRegulatoryDomain (void)
 */
 void test_l1_wifi_common_hal_negative6_wifi_getRegulatoryDomain (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative6_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[50];
     INT status;
 
@@ -4757,7 +4758,7 @@ void test_l1_wifi_common_hal_negative6_wifi_getRegulatoryDomain (void)
     UT_LOG("Return status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative6_wifi_getRegulatoryDomain...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4780,7 +4781,7 @@ void test_l1_wifi_common_hal_negative6_wifi_getRegulatoryDomain (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getRadioTrafficStats (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getRadioTrafficStats...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_radioTrafficStats_t output_struct;
     INT status;
  
@@ -4894,7 +4895,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioTrafficStats (void)
         UT_FAIL("Invalid radio_StatisticsStartTime\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getRadioTrafficStats...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4917,7 +4918,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getRadioTrafficStats (void)
  */
 void test_l1_wifi_common_hal_negative1_wifi_getRadioTrafficStats (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getRadioTrafficStats...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 0;
     INT status;
     wifi_radioTrafficStats_t output_struct;
@@ -4927,7 +4928,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioTrafficStats (void)
     UT_LOG("Return status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getRadioTrafficStats...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4950,7 +4951,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getRadioTrafficStats (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getRadioTrafficStats (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getRadioTrafficStats...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT status;
 
     UT_LOG("Invoked wifi_getRadioTrafficStats with valid radio index and NULL output struct buffer.\n");
@@ -4958,7 +4959,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioTrafficStats (void)
     UT_LOG("Return status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getRadioTrafficStats...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -4981,7 +4982,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getRadioTrafficStats (void)
  */
 void test_l1_wifi_common_hal_negative3_wifi_getRadioTrafficStats (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getRadioTrafficStats...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT status;
     wifi_radioTrafficStats_t output_struct;
 
@@ -4990,7 +4991,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioTrafficStats (void)
     UT_LOG("Return status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getRadioTrafficStats...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5014,7 +5015,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getRadioTrafficStats (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getSSIDName (void)
 {    
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getSSIDName...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[50];
     INT ret_val;
 
@@ -5023,7 +5024,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getSSIDName (void)
     UT_LOG("Returned status : %d\n", ret_val);    
     UT_ASSERT_EQUAL(ret_val, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getSSIDName...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5047,7 +5048,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getSSIDName (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getSSIDName (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getSSIDName...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = 2;
     CHAR output_string[50];
     INT ret_val;    
@@ -5057,7 +5058,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getSSIDName (void)
     UT_LOG("Returned status : %d\n", ret_val);
     UT_ASSERT_EQUAL(ret_val, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getSSIDName...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /** 
@@ -5081,7 +5082,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getSSIDName (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getSSIDName (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getSSIDName...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ret_val;
 
     UT_LOG("Invoking wifi_getSSIDName with a NULL output_string. Checking for error return status.\n");  
@@ -5089,7 +5090,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getSSIDName (void)
     UT_LOG("Returned status : %d\n", ret_val);
     UT_ASSERT_EQUAL(ret_val, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getSSIDName...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5112,7 +5113,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getSSIDName (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getSSIDName (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getSSIDName...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[50];
     INT ret_val;
 
@@ -5121,7 +5122,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getSSIDName (void)
     UT_LOG("Returned status : %d\n", ret_val);
     UT_ASSERT_EQUAL(ret_val, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getSSIDName...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5144,7 +5145,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getSSIDName (void)
 */
 void test_l1_wifi_common_hal_boundary1_wifi_getSSIDName (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_boundary1_wifi_getSSIDName...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[513];
     INT ret_val;
 
@@ -5153,7 +5154,7 @@ void test_l1_wifi_common_hal_boundary1_wifi_getSSIDName (void)
     UT_LOG("Returned status : %d\n", ret_val);
     UT_ASSERT_EQUAL(ret_val, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_boundary1_wifi_getSSIDName...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5176,7 +5177,7 @@ void test_l1_wifi_common_hal_boundary1_wifi_getSSIDName (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getBaseBSSID (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getBaseBSSID...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[50];
     INT status;
 
@@ -5185,7 +5186,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getBaseBSSID (void)
     UT_LOG("Return status = %d , ssidIndex = %d\n", status , SSID_INDEX);
     UT_ASSERT_EQUAL(status, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getBaseBSSID...\n");
+    WIFI_TRACE_TEST_END();
 }    
 
 /**
@@ -5208,7 +5209,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getBaseBSSID (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getBaseBSSID (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getBaseBSSID...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = 2;
     CHAR output_string[50];
     INT status;
@@ -5218,7 +5219,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getBaseBSSID (void)
     UT_LOG("ssidIndex = %d and Return status = %d\n", ssidIndex, status); 
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getBaseBSSID...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5243,7 +5244,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getBaseBSSID (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getBaseBSSID (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getBaseBSSID...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR* output_string = NULL;
     INT status;
 
@@ -5252,7 +5253,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getBaseBSSID (void)
     UT_LOG("ssidIndex = %d and Return status = %d\n", SSID_INDEX, status);  
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getBaseBSSID...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5275,7 +5276,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getBaseBSSID (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getBaseBSSID (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getBaseBSSID...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[50];
     INT status;
 
@@ -5284,7 +5285,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getBaseBSSID (void)
     UT_LOG("Return status = %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getBaseBSSID...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5307,7 +5308,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getBaseBSSID (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getSSIDMACAddress (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getSSIDMACAddress...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[20];
     INT result;
 
@@ -5316,7 +5317,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getSSIDMACAddress (void)
     UT_LOG("Return status: %d and MAC address: %s\n", result, output_string);
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getSSIDMACAddress...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5339,7 +5340,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getSSIDMACAddress (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getSSIDMACAddress (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getSSIDMACAddress...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT result;
 
     UT_LOG("Invoking wifi_getSSIDMACAddress with NULL pointer for output buffer. SSID index: 1.\n");
@@ -5347,7 +5348,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getSSIDMACAddress (void)
     UT_LOG("Return status: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getSSIDMACAddress...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5370,7 +5371,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getSSIDMACAddress (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getSSIDMACAddress (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getSSIDMACAddress...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = 2;
     CHAR output_string[20];
     INT result;
@@ -5380,7 +5381,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getSSIDMACAddress (void)
     UT_LOG("Return status: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getSSIDMACAddress...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5403,7 +5404,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getSSIDMACAddress (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getSSIDMACAddress (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getSSIDMACAddress...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR output_string[20];
     INT result;
 
@@ -5412,7 +5413,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getSSIDMACAddress (void)
     UT_LOG("Return status: %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getSSIDMACAddress...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5436,7 +5437,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getSSIDMACAddress (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getSSIDTrafficStats (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getSSIDTrafficStats...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT status;
     wifi_ssidTrafficStats_t output_struct;
 
@@ -5674,7 +5675,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getSSIDTrafficStats (void)
         UT_FAIL("ssid_UnknownPacketsReceived validation failed\n");
     }
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getSSIDTrafficStats...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5698,7 +5699,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getSSIDTrafficStats (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getSSIDTrafficStats (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getSSIDTrafficStats...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = 2;
     INT status;
     wifi_ssidTrafficStats_t output_struct;
@@ -5709,7 +5710,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getSSIDTrafficStats (void)
     UT_LOG("Return Status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getSSIDTrafficStats...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5733,7 +5734,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getSSIDTrafficStats (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_getSSIDTrafficStats (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getSSIDTrafficStats...\n");
+    WIFI_TRACE_TEST_BEGIN();
     wifi_ssidTrafficStats_t *output_struct = NULL;
     INT status;
 
@@ -5742,7 +5743,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getSSIDTrafficStats (void)
     UT_LOG("Return Status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getSSIDTrafficStats...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5767,7 +5768,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getSSIDTrafficStats (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getSSIDTrafficStats (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getSSIDTrafficStats...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT status;
     wifi_ssidTrafficStats_t output_struct;
 
@@ -5777,7 +5778,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getSSIDTrafficStats (void)
     UT_LOG("Return Status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getSSIDTrafficStats...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5800,7 +5801,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getSSIDTrafficStats (void)
 */
 void test_l1_wifi_common_hal_negative4_wifi_getSSIDTrafficStats (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getSSIDTrafficStats...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT ssidIndex = 0;
     INT status;
     wifi_ssidTrafficStats_t output_struct;
@@ -5811,7 +5812,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getSSIDTrafficStats (void)
     UT_LOG("Retrun Status: %d\n", status);
     UT_ASSERT_EQUAL(status, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getSSIDTrafficStats...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -5834,7 +5835,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getSSIDTrafficStats (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_getNeighboringWiFiDiagnosticResult (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getNeighboringWiFiDiagnosticResult...\n");
+    WIFI_TRACE_TEST_BEGIN();
     UINT output_array_size = 512;
     INT result;
     CHAR *ssid = Config_key_new(key_file, "l1_positive1_wifi_getNeighboringWiFiDiagnosticResult", "AP_SSID");
@@ -6041,7 +6042,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getNeighboringWiFiDiagnosticResult (
     }
     free(neighbor_ap_array);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getNeighboringWiFiDiagnosticResult...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6065,7 +6066,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getNeighboringWiFiDiagnosticResult (
 */
 void test_l1_wifi_common_hal_negative1_wifi_getNeighboringWiFiDiagnosticResult  (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getNeighboringWiFiDiagnosticResult...\n");
+    WIFI_TRACE_TEST_BEGIN();
     UINT *output_array_size = NULL;
     INT result;
     wifi_neighbor_ap_t *neighbor_ap_array;
@@ -6077,7 +6078,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getNeighboringWiFiDiagnosticResult
         free(neighbor_ap_array);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getNeighboringWiFiDiagnosticResult...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6100,7 +6101,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getNeighboringWiFiDiagnosticResult
 */
 void test_l1_wifi_common_hal_negative2_wifi_getNeighboringWiFiDiagnosticResult (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getNeighboringWiFiDiagnosticResult...\n");
+    WIFI_TRACE_TEST_BEGIN();
     UINT output_array_size = 512;
     wifi_neighbor_ap_t *neighbor_ap_array = NULL;
     INT result;
@@ -6111,7 +6112,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getNeighboringWiFiDiagnosticResult (
     free(neighbor_ap_array);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getNeighboringWiFiDiagnosticResult...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6134,7 +6135,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getNeighboringWiFiDiagnosticResult (
 */
 void test_l1_wifi_common_hal_negative3_wifi_getNeighboringWiFiDiagnosticResult (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getNeighboringWiFiDiagnosticResult...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 3;
     UINT output_array_size = 512;
     wifi_neighbor_ap_t *neighbor_ap_array;
@@ -6146,7 +6147,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getNeighboringWiFiDiagnosticResult (
     UT_LOG("Returned status : %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getNeighboringWiFiDiagnosticResult...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6169,7 +6170,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getNeighboringWiFiDiagnosticResult (
 */
 void test_l1_wifi_common_hal_negative4_wifi_getNeighboringWiFiDiagnosticResult (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getNeighboringWiFiDiagnosticResult...\n");
+    WIFI_TRACE_TEST_BEGIN();
     UINT output_array_size = 512;
     wifi_neighbor_ap_t *neighbor_ap_array = NULL;
 
@@ -6180,7 +6181,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getNeighboringWiFiDiagnosticResult (
         free(neighbor_ap_array);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getNeighboringWiFiDiagnosticResult...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -6204,7 +6205,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getNeighboringWiFiDiagnosticResult (
 */
 void test_l1_wifi_common_hal_positive1_wifi_getSpecificSSIDInfo (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_getSpecificSSIDInfo...\n");
+    WIFI_TRACE_TEST_BEGIN();
     WIFI_HAL_FREQ_BAND band = WIFI_HAL_FREQ_BAND_24GHZ;
     UINT output_array_size = 0;
     wifi_neighbor_ap_t *neighbor_ap_array;
@@ -6410,7 +6411,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getSpecificSSIDInfo (void)
     }
     free(neighbor_ap_array);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_getSpecificSSIDInfo...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6433,7 +6434,7 @@ void test_l1_wifi_common_hal_positive1_wifi_getSpecificSSIDInfo (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_getSpecificSSIDInfo (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_getSpecificSSIDInfo...\n");
+    WIFI_TRACE_TEST_BEGIN();
     const char *SSID = NULL;
     WIFI_HAL_FREQ_BAND band = WIFI_HAL_FREQ_BAND_5GHZ;
     UINT output_array_size = 0;
@@ -6447,7 +6448,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getSpecificSSIDInfo (void)
        free(neighbor_ap_array);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_getSpecificSSIDInfo...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6471,7 +6472,7 @@ void test_l1_wifi_common_hal_negative1_wifi_getSpecificSSIDInfo (void)
  */
 void test_l1_wifi_common_hal_negative2_wifi_getSpecificSSIDInfo (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_getSpecificSSIDInfo...\n");
+    WIFI_TRACE_TEST_BEGIN();
     WIFI_HAL_FREQ_BAND band = 5;
     UINT output_array_size = 0;
     wifi_neighbor_ap_t *neighbor_ap_array = NULL;
@@ -6487,7 +6488,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getSpecificSSIDInfo (void)
     Config_key_delete(ssid);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_getSpecificSSIDInfo...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6510,7 +6511,7 @@ void test_l1_wifi_common_hal_negative2_wifi_getSpecificSSIDInfo (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_getSpecificSSIDInfo (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_getSpecificSSIDInfo...\n");
+    WIFI_TRACE_TEST_BEGIN();
     WIFI_HAL_FREQ_BAND band = WIFI_HAL_FREQ_BAND_24GHZ;
     UINT output_array_size = 0;
     wifi_neighbor_ap_t *neighbor_ap_array = NULL;
@@ -6527,7 +6528,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getSpecificSSIDInfo (void)
     Config_key_delete(ssid);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_getSpecificSSIDInfo...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6550,7 +6551,7 @@ void test_l1_wifi_common_hal_negative3_wifi_getSpecificSSIDInfo (void)
 */
 void test_l1_wifi_common_hal_negative4_wifi_getSpecificSSIDInfo (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_getSpecificSSIDInfo...\n");
+    WIFI_TRACE_TEST_BEGIN();
     WIFI_HAL_FREQ_BAND band = WIFI_HAL_FREQ_BAND_24GHZ;
     UINT output_array_size = 0;
     wifi_neighbor_ap_t *neighbor_ap_array = NULL;
@@ -6567,7 +6568,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getSpecificSSIDInfo (void)
     Config_key_delete(ssid);
     UT_ASSERT_EQUAL(ret, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_getSpecificSSIDInfo...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6590,7 +6591,7 @@ void test_l1_wifi_common_hal_negative4_wifi_getSpecificSSIDInfo (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_setRadioScanningFreqList (void)
 {    
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *freqList = "2412 2437 2452 2467 2482";
     INT result;
 
@@ -6599,7 +6600,7 @@ void test_l1_wifi_common_hal_positive1_wifi_setRadioScanningFreqList (void)
     UT_LOG("Returned status : %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_OK);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 
@@ -6624,7 +6625,7 @@ void test_l1_wifi_common_hal_positive1_wifi_setRadioScanningFreqList (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_setRadioScanningFreqList (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT radioIndex = 2;
     CHAR *freqList = "2412 2437 2452 2467 2482";
     INT result;
@@ -6634,7 +6635,7 @@ void test_l1_wifi_common_hal_negative1_wifi_setRadioScanningFreqList (void)
     UT_LOG("Returned status : %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6657,7 +6658,7 @@ void test_l1_wifi_common_hal_negative1_wifi_setRadioScanningFreqList (void)
 */
 void test_l1_wifi_common_hal_negative2_wifi_setRadioScanningFreqList (void)
 {    
-    UT_LOG("Entering test_l1_wifi_common_hal_negative2_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *freqList = "2412:2437:2452:2467:2482";
     INT result;
 
@@ -6666,7 +6667,7 @@ void test_l1_wifi_common_hal_negative2_wifi_setRadioScanningFreqList (void)
     UT_LOG("Returned : %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative2_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6689,7 +6690,7 @@ void test_l1_wifi_common_hal_negative2_wifi_setRadioScanningFreqList (void)
 */
 void test_l1_wifi_common_hal_negative3_wifi_setRadioScanningFreqList (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative3_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *freqList = "5555 2437 2452 2467 2482";
     INT result;
 
@@ -6698,7 +6699,7 @@ void test_l1_wifi_common_hal_negative3_wifi_setRadioScanningFreqList (void)
     UT_LOG("Returned status : %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative3_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6721,7 +6722,7 @@ void test_l1_wifi_common_hal_negative3_wifi_setRadioScanningFreqList (void)
 */
 void test_l1_wifi_common_hal_negative4_wifi_setRadioScanningFreqList (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative4_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *freqList = NULL;
     INT result;
 
@@ -6730,7 +6731,7 @@ void test_l1_wifi_common_hal_negative4_wifi_setRadioScanningFreqList (void)
     UT_LOG("Returned status : %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative4_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6753,7 +6754,7 @@ void test_l1_wifi_common_hal_negative4_wifi_setRadioScanningFreqList (void)
 */
 void test_l1_wifi_common_hal_negative5_wifi_setRadioScanningFreqList (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative5_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *freqList = "2412 2437 2452 2467 2482";
     INT result;
 
@@ -6762,7 +6763,7 @@ void test_l1_wifi_common_hal_negative5_wifi_setRadioScanningFreqList (void)
     UT_LOG("Returned status : %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative5_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6785,7 +6786,7 @@ void test_l1_wifi_common_hal_negative5_wifi_setRadioScanningFreqList (void)
 */
 void test_l1_wifi_common_hal_negative6_wifi_setRadioScanningFreqList (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative6_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_BEGIN();
     CHAR *freqList = " ";
     INT result;
 
@@ -6794,7 +6795,7 @@ void test_l1_wifi_common_hal_negative6_wifi_setRadioScanningFreqList (void)
     UT_LOG("Returned status : %d\n", result);
     UT_ASSERT_EQUAL(result, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative6_wifi_setRadioScanningFreqList...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6817,7 +6818,7 @@ void test_l1_wifi_common_hal_negative6_wifi_setRadioScanningFreqList (void)
 */
 void test_l1_wifi_common_hal_positive1_getDualBandSupport (void)
 {
-    UT_LOG("Entering test function: test_l1_wifi_common_hal_positive1_getDualBandSupport...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT return_val;
 
     UT_LOG("Invoking wifi_getDualBandSupport\n");
@@ -6834,7 +6835,7 @@ void test_l1_wifi_common_hal_positive1_getDualBandSupport (void)
         UT_ASSERT_EQUAL(return_val, 0);
     }
 
-    UT_LOG("Exiting test function: test_l1_wifi_common_hal_positive1_getDualBandSupport...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6857,7 +6858,7 @@ void test_l1_wifi_common_hal_positive1_getDualBandSupport (void)
 */
 void test_l1_wifi_common_hal_positive1_wifi_waitForScanResults (void) 
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_positive1_wifi_waitForScanResults...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT retValue;
 
     UT_LOG("Invoking wifi_waitForScanResults. Expected return value is #RETURN_OK.\n");
@@ -6865,7 +6866,7 @@ void test_l1_wifi_common_hal_positive1_wifi_waitForScanResults (void)
     UT_LOG("Returned status : %d\n", retValue);
     UT_ASSERT_EQUAL(retValue, RETURN_OK);  
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_positive1_wifi_waitForScanResults...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 /**
@@ -6889,7 +6890,7 @@ void test_l1_wifi_common_hal_positive1_wifi_waitForScanResults (void)
 */
 void test_l1_wifi_common_hal_negative1_wifi_waitForScanResults (void)
 {
-    UT_LOG("Entering test_l1_wifi_common_hal_negative1_wifi_waitForScanResults...\n");
+    WIFI_TRACE_TEST_BEGIN();
     INT retValue;
 
     UT_LOG("Invoking wifi_waitForScanResults without calling wifi_init or wifi_initWithConfig.\n");
@@ -6897,7 +6898,7 @@ void test_l1_wifi_common_hal_negative1_wifi_waitForScanResults (void)
     UT_LOG("Returned status : %d\n", retValue);
     UT_ASSERT_EQUAL(retValue, RETURN_ERR);
 
-    UT_LOG("Exiting test_l1_wifi_common_hal_negative1_wifi_waitForScanResults...\n");
+    WIFI_TRACE_TEST_END();
 }
 
 static UT_test_suite_t * pSuite_with_no_wifi_init = NULL;
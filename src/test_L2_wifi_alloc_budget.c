@@ -0,0 +1,343 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_ALLOC_BUDGET_HALTEST_L2 RDK-V WiFi Allocation Budget L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for heap use per HAL call :
+ *
+ * Counts the allocations, requested bytes and heap growth of every read-only getter through the
+ * harness allocator replacements (wifi_hal_alloc.h) and checks them against per-call budgets.
+ * Frequently polled getters should not allocate at all; the default budget allows
+ * wifi_getRadioChannel() no allocation, and `WIFI_HAL_ALLOC_BUDGET` adds or overrides budgets,
+ * e.g. `WIFI_HAL_ALLOC_BUDGET=wifi_getRadioStatus=0,wifi_getStats=2:512`.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_alloc_budget.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wifi_common_hal.h"
+#include "wifi_hal_alloc.h"
+#include "wifi_hal_api.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_probe.h"
+#include "wifi_sim.h"
+
+#define HAL_ITERATIONS 20
+#define SMALL_BLOCK 64
+#define LARGE_BLOCK 256
+
+extern int WiFi_InitPreReq(void);
+extern int WiFi_UnInitPosReq(void);
+extern const int RADIO_INDEX;
+extern const int SSID_INDEX;
+
+/**
+ * @brief Budgets applied unless WIFI_HAL_ALLOC_BUDGET sets one for the same API
+ */
+static const struct
+{
+    wifi_hal_api_t api;
+    wifi_alloc_budget_t budget;
+} default_budgets[] = {
+    { WIFI_HAL_API_wifi_getRadioChannel, { 0, 0 } },
+};
+
+/* Called through a volatile pointer, so that the compiler cannot drop the malloc/free pairs below */
+static void *(*volatile test_malloc)(size_t size) = malloc;
+
+static void alloc_log(wifi_hal_api_t api, const wifi_alloc_stats_t *stats)
+{
+    wifi_alloc_budget_t budget;
+    int has_budget = wifi_alloc_get_budget(api, &budget);
+
+    UT_LOG("%-40s calls=%llu allocs=%llu frees=%llu bytes=%llu retained=%llu max/call=%llu bytes/call=%llu peak/call=%llu%s\n",
+           wifi_hal_api_name(api), (unsigned long long)stats->calls, (unsigned long long)stats->allocs,
+           (unsigned long long)stats->frees, (unsigned long long)stats->bytes, (unsigned long long)stats->retained,
+           (unsigned long long)stats->max_call_allocs, (unsigned long long)stats->max_call_bytes,
+           (unsigned long long)stats->max_call_peak,
+           has_budget ? (wifi_alloc_within_budget(api) ? " budget ok" : " OVER BUDGET") : "");
+}
+
+/**
+* @brief Verify the heap accounting against known allocations
+*
+* Makes allocations between explicit call markers, with the simulator as a HAL that allocates its
+* result, and checks what is charged to each API. Skipped while WIFI_HAL_ALLOC=1 accounts the whole
+* run, as the explicit markers would charge made-up allocations to real APIs. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | malloc, realloc and free inside one call | 64 bytes grown to 256 | 2 allocations, 2 frees, 320 bytes, nothing retained, peak at least 256 | Should be successful |
+* | 02 | Allocate inside a call nested in another | 64 bytes | Charged to the outer API only | Should be successful |
+* | 03 | Allocate outside any call | 64 bytes | Nothing charged | Should be successful |
+* | 04 | Get the simulator scan results inside a call | None | One allocation of the returned array, retained by the caller | Should be successful |
+* | 05 | Parse budgets and check them | "wifi_getRadioChannel=0,wifi_getStats=2:512" | wifi_getRadioChannel over budget, malformed lists rejected | Should be successful |
+*/
+void test_l2_wifi_alloc_accounting (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    const wifi_hal_api_t single = WIFI_HAL_API_wifi_getRadioChannel;
+    const wifi_hal_api_t outer = WIFI_HAL_API_wifi_getRadioStatus;
+    const wifi_hal_api_t inner = WIFI_HAL_API_wifi_getRadioEnable;
+    const wifi_hal_api_t scan = WIFI_HAL_API_wifi_getNeighboringWiFiDiagnosticResult;
+    wifi_alloc_stats_t stats;
+    wifi_alloc_budget_t saved[2];
+    wifi_alloc_budget_t parsed;
+    int saved_set[2];
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT count = 0;
+    void *block;
+
+    if (!wifi_alloc_supported() || wifi_alloc_active)
+    {
+        UT_LOG("%s, skipping\n", wifi_alloc_active ? "WIFI_HAL_ALLOC accounts the whole run" : "Heap accounting is not supported on this platform");
+        WIFI_TRACE_TEST_END();
+        return;
+    }
+
+    wifi_alloc_reset();
+    wifi_sim_reset();
+    UT_ASSERT_EQUAL(wifi_sim_init(NULL), RETURN_OK);
+    wifi_alloc_enable(1);
+
+    wifi_alloc_call_enter(single);
+    block = test_malloc(SMALL_BLOCK);
+    block = realloc(block, LARGE_BLOCK);
+    free(block);
+    wifi_alloc_call_exit(single);
+
+    wifi_alloc_call_enter(outer);
+    wifi_alloc_call_enter(inner);
+    block = test_malloc(SMALL_BLOCK);
+    wifi_alloc_call_exit(inner);
+    wifi_alloc_call_exit(outer);
+    free(block);
+
+    block = test_malloc(SMALL_BLOCK);
+    free(block);
+
+    wifi_alloc_call_enter(scan);
+    UT_ASSERT_EQUAL(wifi_sim_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &aps, &count), RETURN_OK);
+    wifi_alloc_call_exit(scan);
+    free(aps);
+
+    wifi_alloc_enable(0);
+    wifi_sim_reset();
+
+    wifi_alloc_get(single, &stats);
+    alloc_log(single, &stats);
+    UT_ASSERT_EQUAL(stats.calls, 1);
+    UT_ASSERT_EQUAL(stats.allocs, 2);
+    UT_ASSERT_EQUAL(stats.frees, 2);
+    UT_ASSERT_EQUAL(stats.bytes, SMALL_BLOCK + LARGE_BLOCK);
+    UT_ASSERT_EQUAL(stats.retained, 0);
+    UT_ASSERT_EQUAL(stats.max_call_peak >= LARGE_BLOCK, 1);
+
+    wifi_alloc_get(outer, &stats);
+    alloc_log(outer, &stats);
+    UT_ASSERT_EQUAL(stats.calls, 1);
+    UT_ASSERT_EQUAL(stats.allocs, 1);
+    UT_ASSERT_EQUAL(stats.bytes, SMALL_BLOCK);
+    UT_ASSERT_EQUAL(stats.retained >= SMALL_BLOCK, 1);
+
+    wifi_alloc_get(inner, &stats);
+    UT_ASSERT_EQUAL(stats.calls, 0);
+    UT_ASSERT_EQUAL(stats.allocs, 0);
+
+    wifi_alloc_get(scan, &stats);
+    alloc_log(scan, &stats);
+    UT_ASSERT_EQUAL(count > 0, 1);
+    UT_ASSERT_EQUAL(stats.allocs, 1);
+    UT_ASSERT_EQUAL(stats.bytes, count * sizeof(wifi_neighbor_ap_t));
+    UT_ASSERT_EQUAL(stats.retained >= count * sizeof(wifi_neighbor_ap_t), 1);
+
+    saved_set[0] = wifi_alloc_get_budget(single, &saved[0]);
+    saved_set[1] = wifi_alloc_get_budget(WIFI_HAL_API_wifi_getStats, &saved[1]);
+    UT_ASSERT_EQUAL(wifi_alloc_parse_budgets("wifi_getRadioChannel=0,wifi_getStats=2:512"), 0);
+    UT_ASSERT_EQUAL(wifi_alloc_get_budget(WIFI_HAL_API_wifi_getStats, &parsed), 1);
+    UT_ASSERT_EQUAL(parsed.max_allocs, 2);
+    UT_ASSERT_EQUAL(parsed.max_bytes, 512);
+    UT_ASSERT_EQUAL(wifi_alloc_within_budget(single), 0);
+    UT_ASSERT_EQUAL(wifi_alloc_within_budget(outer), 1);
+    UT_ASSERT_EQUAL(wifi_alloc_parse_budgets("wifi_getBogus=1"), -1);
+    UT_ASSERT_EQUAL(wifi_alloc_parse_budgets("wifi_getStats=x"), -1);
+    UT_ASSERT_EQUAL(wifi_alloc_parse_budgets("wifi_getStats=1:"), -1);
+    wifi_alloc_set_budget(single, saved_set[0] ? &saved[0] : NULL);
+    wifi_alloc_set_budget(WIFI_HAL_API_wifi_getStats, saved_set[1] ? &saved[1] : NULL);
+
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Check the heap use of every read-only getter of the HAL under test against its budget
+*
+* Calls each getter 20 times with heap accounting enabled and logs a row per getter. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** wifi_init() has been called @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Apply the default budgets not set by WIFI_HAL_ALLOC_BUDGET | wifi_getRadioChannel = 0 | None | Should be successful |
+* | 02 | Call every getter 20 times | radioIndex = 1, ssidIndex = 1 | None | Should be successful |
+* | 03 | Check every getter that has a budget | None | No call over its budget | Should Pass |
+*/
+void test_l2_wifi_alloc_budget_hal (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    const wifi_perf_probe_t *probes;
+    size_t probe_count;
+    int was_active = wifi_alloc_active;
+    int over = 0;
+
+    if (!wifi_alloc_supported())
+    {
+        UT_LOG("Heap accounting is not supported on this platform, skipping\n");
+        WIFI_TRACE_TEST_END();
+        return;
+    }
+
+    for (size_t i = 0; i < sizeof(default_budgets) / sizeof(default_budgets[0]); i++)
+    {
+        if (!wifi_alloc_get_budget(default_budgets[i].api, NULL))
+        {
+            wifi_alloc_set_budget(default_budgets[i].api, &default_budgets[i].budget);
+        }
+    }
+
+    /* With WIFI_HAL_ALLOC=1 the figures include the rest of the run, which only makes the check stricter */
+    if (!was_active)
+    {
+        wifi_alloc_reset();
+        wifi_alloc_enable(1);
+    }
+
+    probes = wifi_perf_probes(&probe_count);
+    for (int iteration = 0; iteration < HAL_ITERATIONS; iteration++)
+    {
+        for (size_t i = 0; i < probe_count; i++)
+        {
+            probes[i].call(RADIO_INDEX, SSID_INDEX);
+        }
+    }
+
+    if (!was_active)
+    {
+        wifi_alloc_enable(0);
+    }
+
+    for (size_t i = 0; i < probe_count; i++)
+    {
+        wifi_alloc_stats_t stats;
+
+        wifi_alloc_get(probes[i].api, &stats);
+        alloc_log(probes[i].api, &stats);
+        if (!wifi_alloc_within_budget(probes[i].api))
+        {
+            over++;
+        }
+    }
+    UT_ASSERT_EQUAL(over, 0);
+
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_alloc = NULL;
+static UT_test_suite_t * pSuite_alloc_hal = NULL;
+
+/**
+ * @brief Register the allocation budget tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_alloc_budget_register_l2_tests (void)
+{
+    pSuite_alloc = UT_add_suite("[L2 wifi_alloc_budget tests]", NULL, NULL);
+    if (pSuite_alloc == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_alloc, "l2_wifi_alloc_accounting", test_l2_wifi_alloc_accounting);
+
+    pSuite_alloc_hal = UT_add_suite("[L2 wifi_alloc_budget post-init tests]", WiFi_InitPreReq, WiFi_UnInitPosReq);
+    if (pSuite_alloc_hal == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_alloc_hal, "l2_wifi_alloc_budget_hal", test_l2_wifi_alloc_budget_hal);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_ALLOC_BUDGET_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
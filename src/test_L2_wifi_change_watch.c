@@ -0,0 +1,534 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_CHANGE_WATCH_HALTEST_L2 RDK-V WiFi Change Watcher L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for change watchers :
+ *
+ * Checks the change watchers of the simulator (wifi_sim_watch_open()), which
+ * let a client wait for channel, status, signal and connection changes on an
+ * eventfd instead of calling the getters on a timer.
+ *
+ * The second test drives a series of channel and signal changes and observes
+ * them three ways at once: woken by a watcher, and by polling the getters
+ * every 100 ms and every second. It reports how many times each observer woke
+ * up, the CPU time it used and how long each change took to be seen.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_change_watch.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <time.h>
+#include <unistd.h>
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stability.h"
+#include "wifi_perf_stats.h"
+#include "wifi_sim.h"
+
+#define WATCH_HANDSHAKE_MS 20
+#define WATCH_CALLBACK_TIMEOUT_MS 2000
+#define WATCH_CHANGE_INTERVAL_MS 250
+#define WATCH_TAIL_MS 1200
+#define WATCH_EVENT_BUDGET_MS 20
+#define WATCH_CHANGES 8
+#define WATCH_OBSERVERS 3
+
+/**
+ * @brief One step of the benchmark, a channel or a signal level
+ */
+typedef struct
+{
+    BOOL channel;  /*!< TRUE for a channel change, FALSE for a signal change */
+    INT value;     /*!< Channel, or signal in dBm; each differs from all earlier values of its kind */
+} watch_change_t;
+
+/* Every signal step lands in another WIFI_SIM_RSSI_BUCKET_DB bucket than the one before */
+static const watch_change_t watch_changes[WATCH_CHANGES] = {
+    { TRUE, 40 }, { FALSE, -65 }, { TRUE, 44 }, { FALSE, -75 },
+    { TRUE, 48 }, { FALSE, -55 }, { TRUE, 149 }, { FALSE, -85 },
+};
+
+/**
+ * @brief One way of finding out about the changes
+ */
+typedef struct
+{
+    const char *name;
+    UINT poll_ms;                        /*!< 0 waits on a watcher */
+    INT watch;                           /*!< Watcher, or -1 */
+    int stop;                            /*!< eventfd that ends the watcher wait */
+    pthread_t thread;
+    int detected;                        /*!< Changes seen so far, in order */
+    uint64_t seen_ns[WATCH_CHANGES];
+    UINT wakeups;
+    uint64_t cpu_ns;
+} watch_observer_t;
+
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t state_changed = PTHREAD_COND_INITIALIZER;
+static int connect_count = 0;
+static uint64_t change_ns[WATCH_CHANGES];
+static volatile int watch_stop = 0;
+
+static INT watch_connect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    pthread_mutex_lock(&state_lock);
+    connect_count++;
+    pthread_cond_broadcast(&state_changed);
+    pthread_mutex_unlock(&state_lock);
+    return RETURN_OK;
+}
+
+static int wait_for_connect(void)
+{
+    struct timespec deadline;
+    int ret = 0;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += WATCH_CALLBACK_TIMEOUT_MS / 1000;
+    pthread_mutex_lock(&state_lock);
+    while (connect_count == 0 && ret == 0)
+    {
+        ret = pthread_cond_timedwait(&state_changed, &state_lock, &deadline);
+    }
+    pthread_mutex_unlock(&state_lock);
+    return (connect_count > 0) ? 0 : -1;
+}
+
+/* Fresh, initialised simulator with a fast handshake */
+static void sim_setup(void)
+{
+    wifi_sim_timing_t timing;
+
+    wifi_sim_reset();
+    wifi_sim_get_timing(&timing);
+    timing.handshake_ms = WATCH_HANDSHAKE_MS;
+    wifi_sim_set_timing(&timing);
+    wifi_sim_init(NULL);
+    wifi_sim_connectEndpoint_callback_register(watch_connect_callback);
+}
+
+static int sim_connect(void)
+{
+    CHAR ssid[] = "SimHome";
+    CHAR passphrase[] = "simulated-passphrase";
+    CHAR empty[1] = "";
+
+    pthread_mutex_lock(&state_lock);
+    connect_count = 0;
+    pthread_mutex_unlock(&state_lock);
+    if (wifi_sim_connectEndpoint(1, ssid, WIFI_SECURITY_WPA2_PSK_AES, empty, empty, passphrase, 0, empty, empty, empty,
+                                 empty) != RETURN_OK)
+    {
+        return -1;
+    }
+    return wait_for_connect();
+}
+
+static void sim_set_channel(ULONG channel)
+{
+    wifi_sim_radio_t radio;
+
+    wifi_sim_get_radio(&radio);
+    radio.channel = channel;
+    wifi_sim_set_radio(&radio);
+}
+
+/* Leaves SimHome as the only access point, at the given signal */
+static void sim_set_signal(INT rssi)
+{
+    wifi_neighbor_ap_t ap;
+
+    memset(&ap, 0, sizeof(ap));
+    snprintf(ap.ap_SSID, sizeof(ap.ap_SSID), "SimHome");
+    snprintf(ap.ap_BSSID, sizeof(ap.ap_BSSID), "02:00:00:00:00:01");
+    snprintf(ap.ap_SecurityModeEnabled, sizeof(ap.ap_SecurityModeEnabled), "WPA2-Personal");
+    snprintf(ap.ap_OperatingFrequencyBand, sizeof(ap.ap_OperatingFrequencyBand), "5GHz");
+    ap.ap_Channel = 36;
+    ap.ap_SignalStrength = rssi;
+    ap.ap_Noise = -92;
+    wifi_sim_set_aps(&ap, 1);
+}
+
+static BOOL watcher_readable(INT fd)
+{
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+
+    return (poll(&pfd, 1, 0) == 1) ? TRUE : FALSE;
+}
+
+/**
+* @brief Verify which changes wake which watcher, and that a burst wakes it once
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Open a watcher for nothing | changes = 0 | -1 | Should be successful |
+* | 02 | Open a channel and signal watcher and an all changes watcher, initialise | None | Only the second woken, with STATUS | Should be successful |
+* | 03 | Connect to SimHome | WPA2-PSK | CONNECTION on the second only | Should be successful |
+* | 04 | Move the signal within its bucket | -48 to -45 dBm | Neither woken | Should be successful |
+* | 05 | Change the channel and the signal before reading | 40, -65 dBm | One eventfd count, CHANNEL and RSSI | Should be successful |
+* | 06 | Open watchers until none is left | None | WIFI_SIM_MAX_WATCHERS open, then -1 | Should be successful |
+* | 07 | Bring the radio down, read a closed watcher | None | STATUS and CONNECTION; 0 | Should be successful |
+*/
+void test_l2_wifi_change_watch_filter (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    INT fds[WIFI_SIM_MAX_WATCHERS];
+    INT link_watch;
+    INT all_watch;
+    uint64_t count = 0;
+    int opened = 0;
+
+    wifi_sim_reset();
+    UT_ASSERT_EQUAL(wifi_sim_watch_open(0), -1);
+    UT_ASSERT_EQUAL(wifi_sim_watch_open(0x100), -1);
+
+    link_watch = wifi_sim_watch_open(WIFI_SIM_CHANGE_CHANNEL | WIFI_SIM_CHANGE_RSSI);
+    all_watch = wifi_sim_watch_open(WIFI_SIM_CHANGE_ALL);
+    if (link_watch < 0 || all_watch < 0)
+    {
+        wifi_sim_watch_close(link_watch);
+        wifi_sim_watch_close(all_watch);
+        UT_FAIL_FATAL("wifi_sim_watch_open failed");
+    }
+    UT_ASSERT_FALSE(watcher_readable(all_watch));
+
+    sim_setup();
+    UT_ASSERT_FALSE(watcher_readable(link_watch));
+    UT_ASSERT_TRUE(watcher_readable(all_watch));
+    UT_ASSERT_EQUAL(wifi_sim_watch_read(all_watch), WIFI_SIM_CHANGE_STATUS);
+    UT_ASSERT_FALSE(watcher_readable(all_watch));
+    UT_ASSERT_EQUAL(wifi_sim_watch_read(all_watch), 0);
+
+    UT_ASSERT_EQUAL(sim_connect(), 0);
+    UT_ASSERT_FALSE(watcher_readable(link_watch));
+    UT_ASSERT_EQUAL(wifi_sim_watch_read(all_watch), WIFI_SIM_CHANGE_CONNECTION);
+
+    sim_set_signal(-45);
+    UT_ASSERT_FALSE(watcher_readable(link_watch));
+    UT_ASSERT_FALSE(watcher_readable(all_watch));
+
+    sim_set_channel(40);
+    sim_set_signal(-65);
+    UT_ASSERT_TRUE(watcher_readable(link_watch));
+    UT_ASSERT_EQUAL(read(link_watch, &count, sizeof(count)), (ssize_t)sizeof(count));
+    UT_ASSERT_EQUAL(count, 1);
+    UT_ASSERT_EQUAL(wifi_sim_watch_read(link_watch), WIFI_SIM_CHANGE_CHANNEL | WIFI_SIM_CHANGE_RSSI);
+    UT_ASSERT_EQUAL(wifi_sim_watch_read(all_watch), WIFI_SIM_CHANGE_CHANNEL | WIFI_SIM_CHANGE_RSSI);
+
+    /* Two are already open */
+    for (int i = 0; i < WIFI_SIM_MAX_WATCHERS; i++)
+    {
+        fds[i] = wifi_sim_watch_open(WIFI_SIM_CHANGE_STATUS);
+        if (fds[i] >= 0)
+        {
+            opened++;
+        }
+    }
+    UT_ASSERT_EQUAL(opened, WIFI_SIM_MAX_WATCHERS - 2);
+    for (int i = 0; i < WIFI_SIM_MAX_WATCHERS; i++)
+    {
+        wifi_sim_watch_close(fds[i]);
+    }
+
+    wifi_sim_down();
+    UT_ASSERT_EQUAL(wifi_sim_watch_read(all_watch), WIFI_SIM_CHANGE_STATUS | WIFI_SIM_CHANGE_CONNECTION);
+    UT_ASSERT_EQUAL(wifi_sim_watch_read(link_watch), 0);
+
+    wifi_sim_watch_close(link_watch);
+    wifi_sim_watch_close(all_watch);
+    UT_ASSERT_EQUAL(wifi_sim_watch_read(all_watch), 0);
+    wifi_sim_reset();
+
+    WIFI_TRACE_TEST_END();
+}
+
+static uint64_t thread_cpu_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Index of the last change of the given kind with this value, -1 for the starting value */
+static int change_index(BOOL channel, INT value)
+{
+    for (int i = WATCH_CHANGES - 1; i >= 0; i--)
+    {
+        if (watch_changes[i].channel == channel && watch_changes[i].value == value)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Reads the state through the getters a client would call and marks every
+ * change up to the latest one it shows as seen now. The changes are applied in
+ * order, so seeing one means all before it have happened too.
+ */
+static void observer_check(watch_observer_t *observer)
+{
+    wifi_sim_radio_t radio;
+    wifi_sta_stats_t sta;
+    CHAR status[64];
+    int latest;
+    uint64_t now;
+
+    wifi_sim_get_radio(&radio);
+    wifi_sim_getRadioStatus(1, status);
+    if (wifi_sim_getStats(1, &sta) != RETURN_OK)
+    {
+        return;
+    }
+    now = wifi_perf_now_ns();
+    latest = change_index(TRUE, (INT)radio.channel);
+    if (change_index(FALSE, (INT)sta.sta_RSSI) > latest)
+    {
+        latest = change_index(FALSE, (INT)sta.sta_RSSI);
+    }
+    while (observer->detected <= latest)
+    {
+        observer->seen_ns[observer->detected] = now;
+        observer->detected++;
+    }
+}
+
+static void *observer_thread(void *arg)
+{
+    watch_observer_t *observer = (watch_observer_t *)arg;
+    uint64_t cpu_start = thread_cpu_ns();
+
+    if (observer->poll_ms == 0)
+    {
+        for (;;)
+        {
+            struct pollfd pfd[2] = { { .fd = observer->watch, .events = POLLIN }, { .fd = observer->stop, .events = POLLIN } };
+
+            if (poll(pfd, 2, -1) < 0 || pfd[1].revents != 0)
+            {
+                break;
+            }
+            observer->wakeups++;
+            wifi_sim_watch_read(observer->watch);
+            observer_check(observer);
+        }
+    }
+    else
+    {
+        while (!__atomic_load_n(&watch_stop, __ATOMIC_ACQUIRE))
+        {
+            wifi_perf_sleep_ms(observer->poll_ms);
+            observer->wakeups++;
+            observer_check(observer);
+        }
+    }
+    observer->cpu_ns = thread_cpu_ns() - cpu_start;
+    return NULL;
+}
+
+/**
+* @brief Compare waiting on a watcher with polling the getters for channel and signal changes
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** Medium @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Connect, start a watcher observer and 100 ms and 1 s pollers | CHANNEL and RSSI watcher | Observers running | Should be successful |
+* | 02 | Alternate channel and signal changes | 8 changes, 250 ms apart | Applied | Should be successful |
+* | 03 | Wait for the slowest poller, stop the observers | 1.2 s | Every observer has seen every change | Should be successful |
+* | 04 | Log wakeups, CPU time and latency of each observer | None | Watcher latency within 20 ms, fewer wakeups than the 100 ms poller | Should be successful |
+*/
+void test_l2_wifi_change_watch_vs_polling (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    watch_observer_t observers[WATCH_OBSERVERS] = {
+        { .name = "watcher", .poll_ms = 0 },
+        { .name = "poll every 100 ms", .poll_ms = 100 },
+        { .name = "poll every 1 s", .poll_ms = 1000 },
+    };
+    wifi_perf_samples_t latency;
+    wifi_perf_summary_t summary[WATCH_OBSERVERS];
+    int started = 0;
+
+    sim_setup();
+    if (sim_connect() != 0)
+    {
+        wifi_sim_reset();
+        UT_FAIL_FATAL("Simulator did not connect");
+    }
+    observers[0].watch = wifi_sim_watch_open(WIFI_SIM_CHANGE_CHANNEL | WIFI_SIM_CHANGE_RSSI);
+    observers[0].stop = eventfd(0, EFD_CLOEXEC);
+    if (observers[0].watch < 0 || observers[0].stop < 0 || wifi_perf_samples_init(&latency, WATCH_CHANGES) != 0)
+    {
+        wifi_sim_watch_close(observers[0].watch);
+        if (observers[0].stop >= 0)
+        {
+            close(observers[0].stop);
+        }
+        wifi_sim_reset();
+        UT_FAIL_FATAL("Cannot set up the observers");
+    }
+
+    __atomic_store_n(&watch_stop, 0, __ATOMIC_RELEASE);
+    for (; started < WATCH_OBSERVERS; started++)
+    {
+        if (wifi_perf_thread_create(&observers[started].thread, observer_thread, &observers[started]) != 0)
+        {
+            break;
+        }
+    }
+    UT_ASSERT_EQUAL(started, WATCH_OBSERVERS);
+
+    for (int i = 0; i < WATCH_CHANGES && started == WATCH_OBSERVERS; i++)
+    {
+        wifi_perf_sleep_ms(WATCH_CHANGE_INTERVAL_MS);
+        change_ns[i] = wifi_perf_now_ns();
+        if (watch_changes[i].channel)
+        {
+            sim_set_channel((ULONG)watch_changes[i].value);
+        }
+        else
+        {
+            sim_set_signal(watch_changes[i].value);
+        }
+    }
+    wifi_perf_sleep_ms(WATCH_TAIL_MS);
+
+    __atomic_store_n(&watch_stop, 1, __ATOMIC_RELEASE);
+    if (observers[0].stop >= 0)
+    {
+        uint64_t one = 1;
+
+        (void)!write(observers[0].stop, &one, sizeof(one));
+    }
+    for (int i = 0; i < started; i++)
+    {
+        pthread_join(observers[i].thread, NULL);
+    }
+
+    UT_LOG("\n| %-18s | wakeups | CPU us | seen | p50 ms | max ms |\n", "observer");
+    for (int i = 0; i < WATCH_OBSERVERS; i++)
+    {
+        wifi_perf_samples_clear(&latency);
+        for (int c = 0; c < observers[i].detected; c++)
+        {
+            wifi_perf_samples_add(&latency, observers[i].seen_ns[c] - change_ns[c]);
+        }
+        wifi_perf_summarize(&latency, &summary[i]);
+        UT_LOG("| %-18s | %7u | %6.0f | %4d | %6.2f | %6.2f |\n", observers[i].name, observers[i].wakeups,
+               observers[i].cpu_ns / 1000.0, observers[i].detected, summary[i].p50 / 1e6, summary[i].max / 1e6);
+        UT_ASSERT_EQUAL(observers[i].detected, WATCH_CHANGES);
+    }
+    UT_ASSERT_TRUE(summary[0].max <= WATCH_EVENT_BUDGET_MS * 1e6);
+    UT_ASSERT_TRUE(observers[0].wakeups <= WATCH_CHANGES);
+    UT_ASSERT_TRUE(observers[0].wakeups < observers[1].wakeups);
+
+    wifi_perf_samples_free(&latency);
+    close(observers[0].stop);
+    wifi_sim_watch_close(observers[0].watch);
+    wifi_sim_reset();
+
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_change_watch = NULL;
+
+/**
+ * @brief Register the change watcher tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_change_watch_register_l2_tests (void)
+{
+    pSuite_change_watch = UT_add_suite("[L2 wifi_change_watch tests]", NULL, NULL);
+    if (pSuite_change_watch == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_change_watch, "l2_wifi_change_watch_filter", test_l2_wifi_change_watch_filter);
+    UT_add_test(pSuite_change_watch, "l2_wifi_change_watch_vs_polling", test_l2_wifi_change_watch_vs_polling);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_CHANGE_WATCH_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,751 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_CONNECT_TRANSITION_HALTEST_L2 RDK-V WiFi Connect Transition L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for getter latency during connect and disconnect :
+ *
+ * wifi_connectEndpoint() and wifi_disconnectEndpoint() are issued repeatedly with the
+ * connection profiles of the test config file. Meanwhile a sampler thread calls
+ * wifi_getStats() and wifi_lastConnected_Endpoint() every 10 ms and tags each sample
+ * with the connection phase, which follows the registered connect and disconnect
+ * callbacks. Every phase is compared with the disconnected phase to show which parts
+ * of a transition serialize the HAL.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_connect_transition.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <time.h>
+#include <glib.h>
+#include "wifi_client_hal.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_probe.h"
+#include "wifi_perf_stability.h"
+#include "wifi_perf_stats.h"
+#include "test_wifi_client_config.h"
+
+#define SAMPLED_APIS 2
+#define SAMPLE_INTERVAL_MS 10
+#define HOLD_MS 200
+#define CALLBACK_TIMEOUT_MS 30000
+#define MOCK_CYCLES 3
+#define MOCK_NEGOTIATION_MS 150
+#define MOCK_DISCONNECT_MS 50
+#define MOCK_GETTER_US 50
+#define MOCK_CALLBACK_TIMEOUT_MS 2000
+#define HAL_CYCLES 3
+
+extern int WiFi_InitPreReq(void);
+extern int WiFi_UnInitPosReq(void);
+extern const int RADIO_INDEX;
+extern const int SSID_INDEX;
+
+/**
+ * @brief Connection phase a sample was taken in
+ */
+typedef enum
+{
+    PHASE_DISCONNECTED = 0, /*!< Idle, used as the baseline */
+    PHASE_CONNECT_CALL,     /*!< Inside wifi_connectEndpoint() */
+    PHASE_CONNECTING,       /*!< Call returned, waiting for the connect callback */
+    PHASE_CONNECTED,        /*!< Connect callback reported WIFI_HAL_CONNECTED */
+    PHASE_DISCONNECT_CALL,  /*!< Inside wifi_disconnectEndpoint() */
+    PHASE_DISCONNECTING,    /*!< Call returned, waiting for the disconnect callback */
+    PHASE_COUNT
+} transition_phase_t;
+
+static const char *phase_names[PHASE_COUNT] = {
+    "disconnected", "connect call", "connecting", "connected", "disconnect call", "disconnecting"
+};
+
+typedef INT (*transition_getter_fn)(INT radioIndex, INT ssidIndex);
+
+/**
+ * @brief HAL calls used by one transition run
+ */
+typedef struct
+{
+    INT (*connect)(INT ssidIndex, CHAR *AP_SSID, wifiSecurityMode_t AP_security_mode, CHAR *AP_security_WEPKey,
+                   CHAR *AP_security_PreSharedKey, CHAR *AP_security_KeyPassphrase, INT saveSSID,
+                   CHAR *eapIdentity, CHAR *carootcert, CHAR *clientcert, CHAR *privatekey);
+    INT (*disconnect)(INT ssidIndex, CHAR *AP_SSID);
+    void (*register_connect)(wifi_connectEndpoint_callback callback_proc);
+    void (*register_disconnect)(wifi_disconnectEndpoint_callback callback_proc);
+    transition_getter_fn getters[SAMPLED_APIS];
+    const char *names[SAMPLED_APIS];
+    UINT callback_timeout_ms;
+} transition_ops_t;
+
+/**
+ * @brief Connection profile, as named in the test config file
+ */
+typedef struct
+{
+    const char *name;
+    wifiSecurityMode_t mode;
+} transition_profile_t;
+
+/**
+ * @brief Result of one transition run
+ */
+typedef struct
+{
+    wifi_perf_samples_t samples[SAMPLED_APIS][PHASE_COUNT];
+    wifi_perf_samples_t connect_time;    /*!< wifi_connectEndpoint() issued to WIFI_HAL_CONNECTED */
+    wifi_perf_samples_t disconnect_time; /*!< wifi_disconnectEndpoint() issued to WIFI_HAL_DISCONNECTED */
+    int call_failures;
+    int connect_failures;
+    int timeouts;
+    int getter_failures;
+} transition_result_t;
+
+static const transition_profile_t hal_profiles[] = {
+    { "POSITIVE3_WPA2_PSK_AES_SECURITY_MODE", WIFI_SECURITY_WPA2_PSK_AES },
+    { "POSITIVE1_WEP_64_SECURITY_MODE", WIFI_SECURITY_WEP_64 },
+    { "POSITIVE2_WPA_ENTERPRISE_AES_SECURITY_MODE", WIFI_SECURITY_WPA_ENTERPRISE_AES },
+};
+
+static pthread_mutex_t phase_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t phase_changed = PTHREAD_COND_INITIALIZER;
+static int current_phase = PHASE_DISCONNECTED;
+static int connect_failed = 0;
+static int sampler_stop = 0;
+
+static void set_phase(transition_phase_t phase)
+{
+    pthread_mutex_lock(&phase_lock);
+    __atomic_store_n(&current_phase, phase, __ATOMIC_SEQ_CST);
+    pthread_cond_broadcast(&phase_changed);
+    pthread_mutex_unlock(&phase_lock);
+}
+
+/* Moves to next only if the callback has not already moved past from */
+static void advance_phase(transition_phase_t from, transition_phase_t next)
+{
+    pthread_mutex_lock(&phase_lock);
+    if (__atomic_load_n(&current_phase, __ATOMIC_SEQ_CST) == (int)from)
+    {
+        __atomic_store_n(&current_phase, next, __ATOMIC_SEQ_CST);
+    }
+    pthread_mutex_unlock(&phase_lock);
+}
+
+static INT transition_connect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    wifiStatusCode_t status = (error != NULL) ? *error : WIFI_HAL_ERROR_UNKNOWN;
+
+    pthread_mutex_lock(&phase_lock);
+    if (status == WIFI_HAL_CONNECTED)
+    {
+        __atomic_store_n(&current_phase, PHASE_CONNECTED, __ATOMIC_SEQ_CST);
+    }
+    else if (status == WIFI_HAL_CONNECTING)
+    {
+        __atomic_store_n(&current_phase, PHASE_CONNECTING, __ATOMIC_SEQ_CST);
+    }
+    else
+    {
+        connect_failed = 1;
+        __atomic_store_n(&current_phase, PHASE_DISCONNECTED, __ATOMIC_SEQ_CST);
+    }
+    pthread_cond_broadcast(&phase_changed);
+    pthread_mutex_unlock(&phase_lock);
+    return RETURN_OK;
+}
+
+static INT transition_disconnect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    if (error != NULL && *error == WIFI_HAL_DISCONNECTED)
+    {
+        set_phase(PHASE_DISCONNECTED);
+    }
+    return RETURN_OK;
+}
+
+/* Returns 1 once the phase is target, 0 on timeout or when a connect attempt fails */
+static int wait_for_phase(transition_phase_t target, UINT timeout_ms)
+{
+    struct timespec deadline = wifi_perf_deadline_ms(timeout_ms);
+    int reached;
+
+    pthread_mutex_lock(&phase_lock);
+    while (__atomic_load_n(&current_phase, __ATOMIC_SEQ_CST) != (int)target && !connect_failed)
+    {
+        if (pthread_cond_timedwait(&phase_changed, &phase_lock, &deadline) != 0)
+        {
+            break;
+        }
+    }
+    reached = (__atomic_load_n(&current_phase, __ATOMIC_SEQ_CST) == (int)target);
+    pthread_mutex_unlock(&phase_lock);
+    return reached;
+}
+
+typedef struct
+{
+    const transition_ops_t *ops;
+    transition_result_t *result;
+} sampler_arg_t;
+
+static void *sampler_thread(void *arg)
+{
+    sampler_arg_t *sampler = arg;
+
+    while (!__atomic_load_n(&sampler_stop, __ATOMIC_SEQ_CST))
+    {
+        uint64_t tick = wifi_perf_now_ns();
+        uint64_t elapsed;
+
+        for (int api = 0; api < SAMPLED_APIS; api++)
+        {
+            int phase = __atomic_load_n(&current_phase, __ATOMIC_SEQ_CST);
+            uint64_t start = wifi_perf_now_ns();
+
+            if (sampler->ops->getters[api](RADIO_INDEX, SSID_INDEX) != RETURN_OK)
+            {
+                sampler->result->getter_failures++;
+            }
+            wifi_perf_samples_add(&sampler->result->samples[api][phase], wifi_perf_now_ns() - start);
+        }
+        elapsed = wifi_perf_now_ns() - tick;
+        if (elapsed < SAMPLE_INTERVAL_MS * WIFI_PERF_NS_PER_MS)
+        {
+            wifi_perf_sleep_us((uint32_t)((SAMPLE_INTERVAL_MS * WIFI_PERF_NS_PER_MS - elapsed) / WIFI_PERF_NS_PER_US));
+        }
+    }
+    return NULL;
+}
+
+static void transition_result_init(transition_result_t *result)
+{
+    memset(result, 0, sizeof(*result));
+    for (int api = 0; api < SAMPLED_APIS; api++)
+    {
+        for (int phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            wifi_perf_samples_init(&result->samples[api][phase], 0);
+        }
+    }
+    wifi_perf_samples_init(&result->connect_time, 0);
+    wifi_perf_samples_init(&result->disconnect_time, 0);
+}
+
+static void transition_result_free(transition_result_t *result)
+{
+    for (int api = 0; api < SAMPLED_APIS; api++)
+    {
+        for (int phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            wifi_perf_samples_free(&result->samples[api][phase]);
+        }
+    }
+    wifi_perf_samples_free(&result->connect_time);
+    wifi_perf_samples_free(&result->disconnect_time);
+}
+
+/* One connect, hold, disconnect, hold cycle */
+static void transition_cycle(const transition_ops_t *ops, wifi_connectEndpoint_test_config_t *config,
+                             wifiSecurityMode_t mode, transition_result_t *result)
+{
+    uint64_t start;
+    INT ret;
+
+    pthread_mutex_lock(&phase_lock);
+    connect_failed = 0;
+    pthread_mutex_unlock(&phase_lock);
+
+    set_phase(PHASE_CONNECT_CALL);
+    start = wifi_perf_now_ns();
+    ret = ops->connect(SSID_INDEX, config->ap_SSID, mode, config->WEPKey, config->PreSharedKey,
+                       config->KeyPassphrase, 0, config->eapIdentity, config->carootcert,
+                       config->clientcert, config->privatekey);
+    if (ret != RETURN_OK)
+    {
+        result->call_failures++;
+        set_phase(PHASE_DISCONNECTED);
+        wifi_perf_sleep_ms(HOLD_MS);
+        return;
+    }
+    advance_phase(PHASE_CONNECT_CALL, PHASE_CONNECTING);
+    if (!wait_for_phase(PHASE_CONNECTED, ops->callback_timeout_ms))
+    {
+        if (connect_failed)
+        {
+            result->connect_failures++;
+        }
+        else
+        {
+            result->timeouts++;
+        }
+        set_phase(PHASE_DISCONNECTED);
+        wifi_perf_sleep_ms(HOLD_MS);
+        return;
+    }
+    wifi_perf_samples_add(&result->connect_time, wifi_perf_now_ns() - start);
+    wifi_perf_sleep_ms(HOLD_MS);
+
+    set_phase(PHASE_DISCONNECT_CALL);
+    start = wifi_perf_now_ns();
+    ret = ops->disconnect(SSID_INDEX, config->ap_SSID);
+    if (ret != RETURN_OK)
+    {
+        result->call_failures++;
+    }
+    else
+    {
+        advance_phase(PHASE_DISCONNECT_CALL, PHASE_DISCONNECTING);
+        if (wait_for_phase(PHASE_DISCONNECTED, ops->callback_timeout_ms))
+        {
+            wifi_perf_samples_add(&result->disconnect_time, wifi_perf_now_ns() - start);
+        }
+        else
+        {
+            result->timeouts++;
+        }
+    }
+    set_phase(PHASE_DISCONNECTED);
+    wifi_perf_sleep_ms(HOLD_MS);
+}
+
+static void transition_run(const transition_ops_t *ops, wifi_connectEndpoint_test_config_t **configs,
+                           const wifiSecurityMode_t *modes, int profiles, int cycles, transition_result_t *result)
+{
+    pthread_t sampler;
+    sampler_arg_t arg = { .ops = ops, .result = result };
+
+    transition_result_init(result);
+    ops->register_connect(transition_connect_callback);
+    ops->register_disconnect(transition_disconnect_callback);
+    set_phase(PHASE_DISCONNECTED);
+    __atomic_store_n(&sampler_stop, 0, __ATOMIC_SEQ_CST);
+    wifi_perf_thread_create(&sampler, sampler_thread, &arg);
+
+    /* Idle baseline before the first transition */
+    wifi_perf_sleep_ms(HOLD_MS);
+    for (int profile = 0; profile < profiles; profile++)
+    {
+        for (int cycle = 0; cycle < cycles; cycle++)
+        {
+            transition_cycle(ops, configs[profile], modes[profile], result);
+        }
+    }
+
+    __atomic_store_n(&sampler_stop, 1, __ATOMIC_SEQ_CST);
+    pthread_join(sampler, NULL);
+}
+
+/* Logs every phase of every getter, returns a bitmask of the phases that blocked at least one getter */
+static unsigned transition_report(const transition_ops_t *ops, transition_result_t *result)
+{
+    wifi_perf_summary_t baseline;
+    wifi_perf_summary_t summary;
+    char label[96];
+    char line[256];
+    unsigned blocked = 0;
+
+    wifi_perf_summarize(&result->connect_time, &summary);
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "connect to WIFI_HAL_CONNECTED", &summary));
+    wifi_perf_summarize(&result->disconnect_time, &summary);
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "disconnect to WIFI_HAL_DISCONNECTED", &summary));
+    UT_LOG("call failures=%d connect failures=%d callback timeouts=%d getter failures=%d\n",
+           result->call_failures, result->connect_failures, result->timeouts, result->getter_failures);
+
+    for (int api = 0; api < SAMPLED_APIS; api++)
+    {
+        wifi_perf_summarize(&result->samples[api][PHASE_DISCONNECTED], &baseline);
+        for (int phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            int phase_blocked = 0;
+
+            if (phase == PHASE_DISCONNECTED)
+            {
+                summary = baseline;
+            }
+            else
+            {
+                wifi_perf_summarize(&result->samples[api][phase], &summary);
+                phase_blocked = wifi_perf_blocked(&baseline, &summary);
+            }
+            if (summary.count == 0)
+            {
+                continue;
+            }
+            snprintf(label, sizeof(label), "%s %s", ops->names[api], phase_names[phase]);
+            UT_LOG("%s%s\n", wifi_perf_format_summary(line, sizeof(line), label, &summary),
+                   phase_blocked ? " <- serialized" : "");
+            if (phase_blocked)
+            {
+                blocked |= 1u << phase;
+            }
+        }
+    }
+    return blocked;
+}
+
+static pthread_mutex_t mock_driver_lock = PTHREAD_MUTEX_INITIALIZER;
+static int mock_global_lock = 0;
+static wifi_connectEndpoint_callback mock_connect_cb = NULL;
+static wifi_disconnectEndpoint_callback mock_disconnect_cb = NULL;
+static pthread_t mock_worker;
+static int mock_worker_running = 0;
+
+static void mock_driver_access(UINT duration_us)
+{
+    if (mock_global_lock)
+    {
+        pthread_mutex_lock(&mock_driver_lock);
+    }
+    wifi_perf_sleep_us(duration_us);
+    if (mock_global_lock)
+    {
+        pthread_mutex_unlock(&mock_driver_lock);
+    }
+}
+
+static void mock_join_worker(void)
+{
+    if (mock_worker_running)
+    {
+        pthread_join(mock_worker, NULL);
+        mock_worker_running = 0;
+    }
+}
+
+/* Association and key exchange, with the driver lock held when mock_global_lock is set */
+static void *mock_negotiate(void *arg)
+{
+    wifiStatusCode_t status = WIFI_HAL_CONNECTING;
+
+    mock_connect_cb(SSID_INDEX, "MockAP", &status);
+    mock_driver_access(MOCK_NEGOTIATION_MS * 1000);
+    status = WIFI_HAL_CONNECTED;
+    mock_connect_cb(SSID_INDEX, "MockAP", &status);
+    return NULL;
+}
+
+static void *mock_teardown(void *arg)
+{
+    wifiStatusCode_t status = WIFI_HAL_DISCONNECTED;
+
+    mock_driver_access(MOCK_DISCONNECT_MS * 1000);
+    mock_disconnect_cb(SSID_INDEX, "MockAP", &status);
+    return NULL;
+}
+
+static INT mock_connectEndpoint(INT ssidIndex, CHAR *AP_SSID, wifiSecurityMode_t AP_security_mode, CHAR *AP_security_WEPKey,
+                                CHAR *AP_security_PreSharedKey, CHAR *AP_security_KeyPassphrase, INT saveSSID,
+                                CHAR *eapIdentity, CHAR *carootcert, CHAR *clientcert, CHAR *privatekey)
+{
+    mock_join_worker();
+    if (wifi_perf_thread_create(&mock_worker, mock_negotiate, NULL) != 0)
+    {
+        return RETURN_ERR;
+    }
+    mock_worker_running = 1;
+    return RETURN_OK;
+}
+
+static INT mock_disconnectEndpoint(INT ssidIndex, CHAR *AP_SSID)
+{
+    mock_join_worker();
+    if (wifi_perf_thread_create(&mock_worker, mock_teardown, NULL) != 0)
+    {
+        return RETURN_ERR;
+    }
+    mock_worker_running = 1;
+    return RETURN_OK;
+}
+
+static void mock_connect_callback_register(wifi_connectEndpoint_callback callback_proc)
+{
+    mock_connect_cb = callback_proc;
+}
+
+static void mock_disconnect_callback_register(wifi_disconnectEndpoint_callback callback_proc)
+{
+    mock_disconnect_cb = callback_proc;
+}
+
+static INT mock_getter(INT radioIndex, INT ssidIndex)
+{
+    mock_driver_access(MOCK_GETTER_US);
+    return RETURN_OK;
+}
+
+static const transition_ops_t mock_ops = {
+    .connect = mock_connectEndpoint,
+    .disconnect = mock_disconnectEndpoint,
+    .register_connect = mock_connect_callback_register,
+    .register_disconnect = mock_disconnect_callback_register,
+    .getters = { mock_getter, mock_getter },
+    .names = { "mock_getStats", "mock_lastConnected_Endpoint" },
+    .callback_timeout_ms = MOCK_CALLBACK_TIMEOUT_MS,
+};
+
+static unsigned run_mock(int global_lock, transition_result_t *result)
+{
+    wifi_connectEndpoint_test_config_t config = { .ap_SSID = "MockAP", .PreSharedKey = "MockPassphrase" };
+    wifi_connectEndpoint_test_config_t *configs[1] = { &config };
+    wifiSecurityMode_t modes[1] = { WIFI_SECURITY_WPA2_PSK_AES };
+    unsigned blocked;
+
+    mock_global_lock = global_lock;
+    transition_run(&mock_ops, configs, modes, 1, MOCK_CYCLES, result);
+    mock_join_worker();
+    mock_global_lock = 0;
+
+    blocked = transition_report(&mock_ops, result);
+    UT_ASSERT_EQUAL(result->call_failures, 0);
+    UT_ASSERT_EQUAL(result->timeouts, 0);
+    UT_ASSERT_EQUAL(result->connect_time.count, MOCK_CYCLES);
+    UT_ASSERT_EQUAL(result->disconnect_time.count, MOCK_CYCLES);
+    return blocked;
+}
+
+/**
+* @brief Verify that phases follow the callbacks and that a HAL without a global lock shows no serialization
+*
+* The mock reports WIFI_HAL_CONNECTING, negotiates for 150 ms without holding the driver lock and then
+* reports WIFI_HAL_CONNECTED. Disconnecting takes 50 ms. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Run three connect/disconnect cycles on the mock while sampling every 10 ms | negotiation = 150 ms, no lock | Three connect and three disconnect callbacks, no timeouts | Should be successful |
+* | 02 | Check the phase tags | None | Samples in the disconnected, connecting, connected and disconnecting phases | Should be successful |
+* | 03 | Compare every phase with the disconnected phase | None | No phase serialized | Should be successful |
+*/
+void test_l2_wifi_connect_transition_unlocked_mock (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    transition_result_t result;
+
+    UT_ASSERT_EQUAL(run_mock(0, &result), 0);
+    for (int api = 0; api < SAMPLED_APIS; api++)
+    {
+        UT_ASSERT_EQUAL(result.samples[api][PHASE_DISCONNECTED].count > 0, 1);
+        UT_ASSERT_EQUAL(result.samples[api][PHASE_CONNECTING].count > 0, 1);
+        UT_ASSERT_EQUAL(result.samples[api][PHASE_CONNECTED].count > 0, 1);
+        UT_ASSERT_EQUAL(result.samples[api][PHASE_DISCONNECTING].count > 0, 1);
+    }
+
+    transition_result_free(&result);
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that a global lock held during negotiation is reported for the connecting phase only
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Run three connect/disconnect cycles on the mock while sampling every 10 ms | negotiation = 150 ms, global lock | Three connect and three disconnect callbacks | Should be successful |
+* | 02 | Compare every phase with the disconnected phase | None | Connecting phase serialized, connected phase not | Should be successful |
+*/
+void test_l2_wifi_connect_transition_global_lock_mock (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    transition_result_t result;
+    unsigned blocked;
+
+    blocked = run_mock(1, &result);
+    /* The first getter of a tick waits out the negotiation, so the second one usually lands in the next phase */
+    UT_ASSERT_EQUAL(result.samples[0][PHASE_CONNECTING].count > 0, 1);
+    UT_ASSERT_EQUAL((blocked >> PHASE_CONNECTING) & 1u, 1);
+    UT_ASSERT_EQUAL((blocked >> PHASE_CONNECTED) & 1u, 0);
+
+    transition_result_free(&result);
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Measure getter latency per connection phase on the HAL under test
+*
+* Connects and disconnects three times with each connection profile found in the test config file,
+* with saveSSID = 0, while wifi_getStats() and wifi_lastConnected_Endpoint() are sampled every 10 ms. @n
+*
+* **Test Group ID:** Stress: 03 @n
+* **Test Case ID:** 003 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** wifi_init() called by the suite, access points of the profiles reachable @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Load the connection profiles from the config file | POSITIVE3_WPA2_PSK_AES, POSITIVE1_WEP_64, POSITIVE2_WPA_ENTERPRISE_AES | At least one profile found | Should be successful |
+* | 02 | Run three wifi_connectEndpoint()/wifi_disconnectEndpoint() cycles per profile while sampling | ssidIndex = 1, saveSSID = 0 | RETURN_OK, callbacks within 30 s | Should Pass |
+* | 03 | Compare every phase with the disconnected phase | None | No phase serialized | Should Pass |
+*/
+void test_l2_wifi_connect_transition_hal (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    transition_ops_t hal_ops = {
+        .connect = wifi_connectEndpoint,
+        .disconnect = wifi_disconnectEndpoint,
+        .register_connect = wifi_connectEndpoint_callback_register,
+        .register_disconnect = wifi_disconnectEndpoint_callback_register,
+        .names = { "wifi_getStats", "wifi_lastConnected_Endpoint" },
+        .callback_timeout_ms = CALLBACK_TIMEOUT_MS,
+    };
+    int total = sizeof(hal_profiles) / sizeof(hal_profiles[0]);
+    wifi_connectEndpoint_test_config_t *configs[sizeof(hal_profiles) / sizeof(hal_profiles[0])];
+    wifiSecurityMode_t modes[sizeof(hal_profiles) / sizeof(hal_profiles[0])];
+    transition_result_t result;
+    int profiles = 0;
+
+    for (int api = 0; api < SAMPLED_APIS; api++)
+    {
+        const wifi_perf_probe_t *probe = wifi_perf_probe_find(hal_ops.names[api]);
+
+        if (probe == NULL)
+        {
+            UT_FAIL_FATAL("No probe for a sampled getter");
+            return;
+        }
+        hal_ops.getters[api] = probe->call;
+    }
+
+    for (int i = 0; i < total; i++)
+    {
+        wifi_connectEndpoint_test_config_t *config = Config_new(key_file, (char *)hal_profiles[i].name);
+
+        if (config == NULL || config->ap_SSID == NULL)
+        {
+            UT_LOG("Skipping profile %s\n", hal_profiles[i].name);
+            Config_delete(config);
+            continue;
+        }
+        configs[profiles] = config;
+        modes[profiles] = hal_profiles[i].mode;
+        profiles++;
+    }
+    if (profiles == 0)
+    {
+        UT_FAIL_FATAL("Test config not found");
+        return;
+    }
+
+    transition_run(&hal_ops, configs, modes, profiles, HAL_CYCLES, &result);
+
+    UT_ASSERT_EQUAL(transition_report(&hal_ops, &result), 0);
+    UT_ASSERT_EQUAL(result.call_failures, 0);
+    UT_ASSERT_EQUAL(result.connect_failures, 0);
+    UT_ASSERT_EQUAL(result.timeouts, 0);
+    UT_ASSERT_EQUAL(result.getter_failures, 0);
+
+    transition_result_free(&result);
+    for (int i = 0; i < profiles; i++)
+    {
+        Config_delete(configs[i]);
+    }
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_connect_transition = NULL;
+static UT_test_suite_t * pSuite_connect_transition_with_wifi_init = NULL;
+
+/**
+ * @brief Register the connect transition tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_connect_transition_register_l2_tests (void)
+{
+    pSuite_connect_transition = UT_add_suite("[L2 wifi_connect_transition tests]", NULL, NULL);
+    if (pSuite_connect_transition == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_connect_transition, "l2_wifi_connect_transition_unlocked_mock", test_l2_wifi_connect_transition_unlocked_mock);
+    UT_add_test(pSuite_connect_transition, "l2_wifi_connect_transition_global_lock_mock", test_l2_wifi_connect_transition_global_lock_mock);
+
+    pSuite_connect_transition_with_wifi_init = UT_add_suite("[L2 wifi_connect_transition post-init tests]", WiFi_InitPreReq, WiFi_UnInitPosReq);
+    if (pSuite_connect_transition_with_wifi_init == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_connect_transition_with_wifi_init, "l2_wifi_connect_transition_hal", test_l2_wifi_connect_transition_hal);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_CONNECT_TRANSITION_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,657 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_FAST_RECONNECT_HALTEST_L2 RDK-V WiFi Fast Reconnect L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for reconnecting with saved credentials :
+ *
+ * Times wifi_init() to WIFI_HAL_CONNECTED in three scenarios:
+ *
+ * - cold: wifi_clearSSIDInfo(), wifi_down(), wifi_init(), then wifi_connectEndpoint() with the full profile
+ * - saved: connected with saveSSID = 1, wifi_down(), wifi_init(), then reconnect to the last endpoint
+ * - cleared: connected with saveSSID = 1, wifi_clearSSIDInfo(), wifi_down(), wifi_init(), then the same reconnect
+ *
+ * The reconnect first waits briefly for the HAL to reconnect on its own. If it does not,
+ * it reads wifi_lastConnected_Endpoint() and connects with the saved credentials, and
+ * falls back to the full profile when nothing is saved. This is the resume-from-standby
+ * path of the middleware.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_fast_reconnect.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <time.h>
+#include <glib.h>
+#include "wifi_client_hal.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stability.h"
+#include "wifi_perf_stats.h"
+#include "test_wifi_client_config.h"
+
+#define HAL_ITERATIONS 3
+#define HAL_AUTO_RECONNECT_WAIT_MS 5000
+#define CALLBACK_TIMEOUT_MS 30000
+#define HAL_PROFILE "POSITIVE3_WPA2_PSK_AES_SECURITY_MODE"
+#define MOCK_ITERATIONS 3
+#define MOCK_AUTO_RECONNECT_WAIT_MS 100
+#define MOCK_CONNECT_MS 300
+#define MOCK_RECONNECT_MS 30
+#define MOCK_CALLBACK_TIMEOUT_MS 2000
+
+extern int WiFi_InitPreReq(void);
+extern int WiFi_UnInitPosReq(void);
+extern const int SSID_INDEX;
+
+/**
+ * @brief Starting point of a measurement
+ */
+typedef enum
+{
+    SCENARIO_COLD = 0, /*!< Nothing saved, connect with the full profile */
+    SCENARIO_SAVED,    /*!< Reconnect after wifi_down()/wifi_init() with saved credentials */
+    SCENARIO_CLEARED,  /*!< Reconnect after wifi_clearSSIDInfo() */
+    SCENARIO_COUNT
+} reconnect_scenario_t;
+
+/**
+ * @brief How the connection was re-established
+ */
+typedef enum
+{
+    PATH_AUTO = 0, /*!< The HAL reconnected by itself after wifi_init() */
+    PATH_SAVED,    /*!< wifi_connectEndpoint() with wifi_lastConnected_Endpoint() */
+    PATH_PROFILE,  /*!< wifi_connectEndpoint() with the full profile */
+    PATH_COUNT
+} reconnect_path_t;
+
+static const char *scenario_names[SCENARIO_COUNT] = { "cold", "saved", "cleared" };
+static const char *path_names[PATH_COUNT] = { "auto", "last endpoint", "profile" };
+
+/**
+ * @brief HAL calls used by the benchmark
+ */
+typedef struct
+{
+    INT (*init)(void);
+    INT (*down)(void);
+    INT (*clear)(INT ssidIndex);
+    INT (*last_connected)(wifi_pairedSSIDInfo_t *pairedSSIDInfo);
+    INT (*connect)(INT ssidIndex, CHAR *AP_SSID, wifiSecurityMode_t AP_security_mode, CHAR *AP_security_WEPKey,
+                   CHAR *AP_security_PreSharedKey, CHAR *AP_security_KeyPassphrase, INT saveSSID,
+                   CHAR *eapIdentity, CHAR *carootcert, CHAR *clientcert, CHAR *privatekey);
+    void (*register_connect)(wifi_connectEndpoint_callback callback_proc);
+    UINT auto_reconnect_wait_ms;
+    UINT callback_timeout_ms;
+} reconnect_ops_t;
+
+/**
+ * @brief Results of every scenario
+ */
+typedef struct
+{
+    wifi_perf_samples_t total[SCENARIO_COUNT];   /*!< wifi_init() started to WIFI_HAL_CONNECTED */
+    wifi_perf_samples_t init[SCENARIO_COUNT];    /*!< wifi_init() alone */
+    int paths[SCENARIO_COUNT][PATH_COUNT];
+    int failures[SCENARIO_COUNT];
+} reconnect_result_t;
+
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t state_changed = PTHREAD_COND_INITIALIZER;
+static int connected = 0;
+static int connect_failed = 0;
+
+static INT reconnect_connect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    wifiStatusCode_t status = (error != NULL) ? *error : WIFI_HAL_ERROR_UNKNOWN;
+
+    pthread_mutex_lock(&state_lock);
+    if (status == WIFI_HAL_CONNECTED)
+    {
+        connected = 1;
+    }
+    else if (status != WIFI_HAL_CONNECTING)
+    {
+        connect_failed = 1;
+    }
+    pthread_cond_broadcast(&state_changed);
+    pthread_mutex_unlock(&state_lock);
+    return RETURN_OK;
+}
+
+static void reset_connection_state(void)
+{
+    pthread_mutex_lock(&state_lock);
+    connected = 0;
+    connect_failed = 0;
+    pthread_mutex_unlock(&state_lock);
+}
+
+/* Returns 1 once WIFI_HAL_CONNECTED was reported, 0 on timeout or failure */
+static int wait_for_connected(UINT timeout_ms)
+{
+    struct timespec deadline = wifi_perf_deadline_ms(timeout_ms);
+    int result;
+
+    pthread_mutex_lock(&state_lock);
+    while (!connected && !connect_failed)
+    {
+        if (pthread_cond_timedwait(&state_changed, &state_lock, &deadline) != 0)
+        {
+            break;
+        }
+    }
+    result = connected;
+    pthread_mutex_unlock(&state_lock);
+    return result;
+}
+
+static int connect_profile(const reconnect_ops_t *ops, wifi_connectEndpoint_test_config_t *config, wifiSecurityMode_t mode)
+{
+    reset_connection_state();
+    if (ops->connect(SSID_INDEX, config->ap_SSID, mode, config->WEPKey, config->PreSharedKey, config->KeyPassphrase,
+                     1, config->eapIdentity, config->carootcert, config->clientcert, config->privatekey) != RETURN_OK)
+    {
+        return 0;
+    }
+    return wait_for_connected(ops->callback_timeout_ms);
+}
+
+/* wifi_init() and the resume logic of the middleware. Returns the path used, PATH_COUNT on failure. */
+static reconnect_path_t init_and_reconnect(const reconnect_ops_t *ops, wifi_connectEndpoint_test_config_t *config,
+                                           wifiSecurityMode_t mode, uint64_t *init_ns)
+{
+    wifi_pairedSSIDInfo_t paired;
+    uint64_t start;
+
+    reset_connection_state();
+    start = wifi_perf_now_ns();
+    if (ops->init() != RETURN_OK)
+    {
+        return PATH_COUNT;
+    }
+    *init_ns = wifi_perf_now_ns() - start;
+    ops->register_connect(reconnect_connect_callback);
+
+    if (wait_for_connected(ops->auto_reconnect_wait_ms))
+    {
+        return PATH_AUTO;
+    }
+
+    memset(&paired, 0, sizeof(paired));
+    if (ops->last_connected(&paired) == RETURN_OK && paired.ap_ssid[0] != '\0')
+    {
+        reset_connection_state();
+        if (ops->connect(SSID_INDEX, paired.ap_ssid, mode, paired.ap_wep_key, paired.ap_passphrase, paired.ap_passphrase,
+                         1, config->eapIdentity, config->carootcert, config->clientcert, config->privatekey) != RETURN_OK)
+        {
+            return PATH_COUNT;
+        }
+        return wait_for_connected(ops->callback_timeout_ms) ? PATH_SAVED : PATH_COUNT;
+    }
+
+    return connect_profile(ops, config, mode) ? PATH_PROFILE : PATH_COUNT;
+}
+
+static void reconnect_iteration(const reconnect_ops_t *ops, wifi_connectEndpoint_test_config_t *config,
+                                wifiSecurityMode_t mode, reconnect_scenario_t scenario, reconnect_result_t *result)
+{
+    reconnect_path_t path;
+    uint64_t start;
+    uint64_t init_ns = 0;
+
+    if (scenario == SCENARIO_COLD)
+    {
+        ops->clear(SSID_INDEX);
+        ops->down();
+        start = wifi_perf_now_ns();
+        if (ops->init() != RETURN_OK)
+        {
+            result->failures[scenario]++;
+            return;
+        }
+        init_ns = wifi_perf_now_ns() - start;
+        ops->register_connect(reconnect_connect_callback);
+        path = connect_profile(ops, config, mode) ? PATH_PROFILE : PATH_COUNT;
+    }
+    else
+    {
+        /* Establish the saved connection the reconnect will resume */
+        if (!connect_profile(ops, config, mode))
+        {
+            result->failures[scenario]++;
+            return;
+        }
+        if (scenario == SCENARIO_CLEARED)
+        {
+            ops->clear(SSID_INDEX);
+        }
+        ops->down();
+        start = wifi_perf_now_ns();
+        path = init_and_reconnect(ops, config, mode, &init_ns);
+    }
+
+    if (path == PATH_COUNT)
+    {
+        result->failures[scenario]++;
+        return;
+    }
+    wifi_perf_samples_add(&result->total[scenario], wifi_perf_now_ns() - start);
+    wifi_perf_samples_add(&result->init[scenario], init_ns);
+    result->paths[scenario][path]++;
+}
+
+static void reconnect_run(const reconnect_ops_t *ops, wifi_connectEndpoint_test_config_t *config,
+                          wifiSecurityMode_t mode, int iterations, reconnect_result_t *result)
+{
+    memset(result, 0, sizeof(*result));
+    for (int scenario = 0; scenario < SCENARIO_COUNT; scenario++)
+    {
+        wifi_perf_samples_init(&result->total[scenario], iterations);
+        wifi_perf_samples_init(&result->init[scenario], iterations);
+    }
+
+    ops->register_connect(reconnect_connect_callback);
+    for (int scenario = 0; scenario < SCENARIO_COUNT; scenario++)
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            reconnect_iteration(ops, config, mode, scenario, result);
+        }
+    }
+    /* Do not leave the test credentials saved */
+    ops->clear(SSID_INDEX);
+}
+
+static void reconnect_result_free(reconnect_result_t *result)
+{
+    for (int scenario = 0; scenario < SCENARIO_COUNT; scenario++)
+    {
+        wifi_perf_samples_free(&result->total[scenario]);
+        wifi_perf_samples_free(&result->init[scenario]);
+    }
+}
+
+/* Logs the comparison table and returns the p50 of every scenario in p50_ns */
+static void reconnect_report(reconnect_result_t *result, double p50_ns[SCENARIO_COUNT])
+{
+    wifi_perf_summary_t summary;
+    char label[64];
+    char line[256];
+
+    for (int scenario = 0; scenario < SCENARIO_COUNT; scenario++)
+    {
+        wifi_perf_summarize(&result->init[scenario], &summary);
+        snprintf(label, sizeof(label), "%s wifi_init", scenario_names[scenario]);
+        UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), label, &summary));
+        wifi_perf_summarize(&result->total[scenario], &summary);
+        snprintf(label, sizeof(label), "%s init to connected", scenario_names[scenario]);
+        UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), label, &summary));
+        p50_ns[scenario] = summary.p50;
+        UT_LOG("%s: paths auto=%d %s=%d %s=%d failures=%d\n", scenario_names[scenario],
+               result->paths[scenario][PATH_AUTO], path_names[PATH_SAVED], result->paths[scenario][PATH_SAVED],
+               path_names[PATH_PROFILE], result->paths[scenario][PATH_PROFILE], result->failures[scenario]);
+    }
+    if (p50_ns[SCENARIO_SAVED] > 0.0)
+    {
+        UT_LOG("Saved reconnect is %.2fx faster than cold and %.2fx faster than after wifi_clearSSIDInfo (p50)\n",
+               p50_ns[SCENARIO_COLD] / p50_ns[SCENARIO_SAVED], p50_ns[SCENARIO_CLEARED] / p50_ns[SCENARIO_SAVED]);
+    }
+}
+
+static pthread_mutex_t mock_lock = PTHREAD_MUTEX_INITIALIZER;
+static wifi_connectEndpoint_callback mock_connect_cb = NULL;
+static wifi_pairedSSIDInfo_t mock_saved;
+static int mock_has_saved = 0;
+static int mock_auto_reconnect = 0;
+static pthread_t mock_worker;
+static int mock_worker_running = 0;
+
+static void mock_join_worker(void)
+{
+    if (mock_worker_running)
+    {
+        pthread_join(mock_worker, NULL);
+        mock_worker_running = 0;
+    }
+}
+
+/* Association takes MOCK_CONNECT_MS, or MOCK_RECONNECT_MS when the credentials are saved */
+static void *mock_associate(void *arg)
+{
+    wifiStatusCode_t status = WIFI_HAL_CONNECTED;
+
+    wifi_perf_sleep_ms((UINT)(uintptr_t)arg);
+    if (mock_connect_cb != NULL)
+    {
+        mock_connect_cb(SSID_INDEX, "MockAP", &status);
+    }
+    return NULL;
+}
+
+static INT mock_start_association(UINT duration_ms)
+{
+    mock_join_worker();
+    if (wifi_perf_thread_create(&mock_worker, mock_associate, (void *)(uintptr_t)duration_ms) != 0)
+    {
+        return RETURN_ERR;
+    }
+    mock_worker_running = 1;
+    return RETURN_OK;
+}
+
+static INT mock_init(void)
+{
+    int reconnect;
+
+    pthread_mutex_lock(&mock_lock);
+    reconnect = mock_has_saved && mock_auto_reconnect;
+    pthread_mutex_unlock(&mock_lock);
+    return reconnect ? mock_start_association(MOCK_RECONNECT_MS) : RETURN_OK;
+}
+
+static INT mock_down(void)
+{
+    mock_join_worker();
+    return RETURN_OK;
+}
+
+static INT mock_clearSSIDInfo(INT ssidIndex)
+{
+    pthread_mutex_lock(&mock_lock);
+    memset(&mock_saved, 0, sizeof(mock_saved));
+    mock_has_saved = 0;
+    pthread_mutex_unlock(&mock_lock);
+    return RETURN_OK;
+}
+
+static INT mock_lastConnected_Endpoint(wifi_pairedSSIDInfo_t *pairedSSIDInfo)
+{
+    INT ret = RETURN_ERR;
+
+    pthread_mutex_lock(&mock_lock);
+    if (mock_has_saved)
+    {
+        *pairedSSIDInfo = mock_saved;
+        ret = RETURN_OK;
+    }
+    pthread_mutex_unlock(&mock_lock);
+    return ret;
+}
+
+static INT mock_connectEndpoint(INT ssidIndex, CHAR *AP_SSID, wifiSecurityMode_t AP_security_mode, CHAR *AP_security_WEPKey,
+                                CHAR *AP_security_PreSharedKey, CHAR *AP_security_KeyPassphrase, INT saveSSID,
+                                CHAR *eapIdentity, CHAR *carootcert, CHAR *clientcert, CHAR *privatekey)
+{
+    UINT duration_ms;
+
+    pthread_mutex_lock(&mock_lock);
+    duration_ms = (mock_has_saved && strcmp(mock_saved.ap_ssid, AP_SSID) == 0) ? MOCK_RECONNECT_MS : MOCK_CONNECT_MS;
+    if (saveSSID)
+    {
+        memset(&mock_saved, 0, sizeof(mock_saved));
+        snprintf(mock_saved.ap_ssid, sizeof(mock_saved.ap_ssid), "%s", AP_SSID);
+        snprintf(mock_saved.ap_passphrase, sizeof(mock_saved.ap_passphrase), "%s",
+                 (AP_security_PreSharedKey != NULL) ? AP_security_PreSharedKey : "");
+        mock_has_saved = 1;
+    }
+    pthread_mutex_unlock(&mock_lock);
+    return mock_start_association(duration_ms);
+}
+
+static void mock_connect_callback_register(wifi_connectEndpoint_callback callback_proc)
+{
+    mock_connect_cb = callback_proc;
+}
+
+static const reconnect_ops_t mock_ops = {
+    .init = mock_init,
+    .down = mock_down,
+    .clear = mock_clearSSIDInfo,
+    .last_connected = mock_lastConnected_Endpoint,
+    .connect = mock_connectEndpoint,
+    .register_connect = mock_connect_callback_register,
+    .auto_reconnect_wait_ms = MOCK_AUTO_RECONNECT_WAIT_MS,
+    .callback_timeout_ms = MOCK_CALLBACK_TIMEOUT_MS,
+};
+
+static void run_mock(int auto_reconnect, reconnect_result_t *result, double p50_ns[SCENARIO_COUNT])
+{
+    wifi_connectEndpoint_test_config_t config = { .ap_SSID = "MockAP", .PreSharedKey = "MockPassphrase" };
+
+    mock_clearSSIDInfo(SSID_INDEX);
+    mock_auto_reconnect = auto_reconnect;
+    reconnect_run(&mock_ops, &config, WIFI_SECURITY_WPA2_PSK_AES, MOCK_ITERATIONS, result);
+    mock_join_worker();
+    mock_auto_reconnect = 0;
+    reconnect_report(result, p50_ns);
+
+    for (int scenario = 0; scenario < SCENARIO_COUNT; scenario++)
+    {
+        UT_ASSERT_EQUAL(result->failures[scenario], 0);
+        UT_ASSERT_EQUAL(result->total[scenario].count, MOCK_ITERATIONS);
+    }
+    UT_ASSERT_EQUAL(result->paths[SCENARIO_COLD][PATH_PROFILE], MOCK_ITERATIONS);
+    UT_ASSERT_EQUAL(result->paths[SCENARIO_CLEARED][PATH_PROFILE], MOCK_ITERATIONS);
+    UT_ASSERT_EQUAL(p50_ns[SCENARIO_SAVED] < p50_ns[SCENARIO_COLD], 1);
+    UT_ASSERT_EQUAL(p50_ns[SCENARIO_SAVED] < p50_ns[SCENARIO_CLEARED], 1);
+}
+
+/**
+* @brief Verify the reconnect measurement on a mock that reconnects by itself after wifi_init()
+*
+* The mock connects in 300 ms with a new profile and in 30 ms with saved credentials. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Run the cold, saved and cleared scenarios three times each | auto reconnect enabled | Every run connected | Should be successful |
+* | 02 | Check the reconnect paths | None | saved reconnects automatically, cold and cleared use the profile | Should be successful |
+* | 03 | Compare the p50 of the scenarios | None | saved faster than cold and cleared | Should be successful |
+*/
+void test_l2_wifi_fast_reconnect_auto_reconnect_mock (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    reconnect_result_t result;
+    double p50_ns[SCENARIO_COUNT];
+
+    run_mock(1, &result, p50_ns);
+    UT_ASSERT_EQUAL(result.paths[SCENARIO_SAVED][PATH_AUTO], MOCK_ITERATIONS);
+
+    reconnect_result_free(&result);
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify the reconnect measurement on a mock that needs the middleware to reconnect
+*
+* The mock does not reconnect after wifi_init(), so the benchmark reads wifi_lastConnected_Endpoint()
+* and reconnects with the saved credentials. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Run the cold, saved and cleared scenarios three times each | auto reconnect disabled | Every run connected | Should be successful |
+* | 02 | Check the reconnect paths | None | saved uses the last endpoint, cold and cleared use the profile | Should be successful |
+* | 03 | Compare the p50 of the scenarios | None | saved faster than cold and cleared | Should be successful |
+*/
+void test_l2_wifi_fast_reconnect_last_endpoint_mock (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    reconnect_result_t result;
+    double p50_ns[SCENARIO_COUNT];
+
+    run_mock(0, &result, p50_ns);
+    UT_ASSERT_EQUAL(result.paths[SCENARIO_SAVED][PATH_SAVED], MOCK_ITERATIONS);
+
+    reconnect_result_free(&result);
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Benchmark reconnect with saved credentials on the HAL under test
+*
+* Compares wifi_init() to WIFI_HAL_CONNECTED for a cold connect, a reconnect with credentials saved by
+* saveSSID = 1, and a reconnect after wifi_clearSSIDInfo(). After wifi_clearSSIDInfo() the HAL must not
+* reconnect with the cleared credentials. @n
+*
+* **Test Group ID:** Stress: 03 @n
+* **Test Case ID:** 003 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** wifi_init() called by the suite, access point of the profile reachable @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Load the connection profile from the config file | POSITIVE3_WPA2_PSK_AES_SECURITY_MODE | Profile found | Should be successful |
+* | 02 | Cold: wifi_clearSSIDInfo(), wifi_down(), wifi_init(), wifi_connectEndpoint() three times | ssidIndex = 1, saveSSID = 1 | WIFI_HAL_CONNECTED within 30 s | Should Pass |
+* | 03 | Saved: connect, wifi_down(), wifi_init(), reconnect three times | ssidIndex = 1 | WIFI_HAL_CONNECTED within 30 s | Should Pass |
+* | 04 | Cleared: connect, wifi_clearSSIDInfo(), wifi_down(), wifi_init(), reconnect three times | ssidIndex = 1 | Connected with the profile, not with cleared credentials | Should Pass |
+* | 05 | Clear the saved credentials | ssidIndex = 1 | None | Cleanup |
+*/
+void test_l2_wifi_fast_reconnect_hal (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    const reconnect_ops_t hal_ops = {
+        .init = wifi_init,
+        .down = wifi_down,
+        .clear = wifi_clearSSIDInfo,
+        .last_connected = wifi_lastConnected_Endpoint,
+        .connect = wifi_connectEndpoint,
+        .register_connect = wifi_connectEndpoint_callback_register,
+        .auto_reconnect_wait_ms = HAL_AUTO_RECONNECT_WAIT_MS,
+        .callback_timeout_ms = CALLBACK_TIMEOUT_MS,
+    };
+    wifi_connectEndpoint_test_config_t *config = Config_new(key_file, HAL_PROFILE);
+    reconnect_result_t result;
+    double p50_ns[SCENARIO_COUNT];
+
+    if (config == NULL || config->ap_SSID == NULL)
+    {
+        Config_delete(config);
+        UT_FAIL_FATAL("Test config not found");
+        return;
+    }
+
+    reconnect_run(&hal_ops, config, WIFI_SECURITY_WPA2_PSK_AES, HAL_ITERATIONS, &result);
+    reconnect_report(&result, p50_ns);
+
+    for (int scenario = 0; scenario < SCENARIO_COUNT; scenario++)
+    {
+        UT_ASSERT_EQUAL(result.failures[scenario], 0);
+    }
+    UT_ASSERT_EQUAL(result.paths[SCENARIO_CLEARED][PATH_AUTO], 0);
+    UT_ASSERT_EQUAL(result.paths[SCENARIO_CLEARED][PATH_SAVED], 0);
+
+    reconnect_result_free(&result);
+    Config_delete(config);
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_fast_reconnect = NULL;
+static UT_test_suite_t * pSuite_fast_reconnect_with_wifi_init = NULL;
+
+/**
+ * @brief Register the fast reconnect tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_fast_reconnect_register_l2_tests (void)
+{
+    pSuite_fast_reconnect = UT_add_suite("[L2 wifi_fast_reconnect tests]", NULL, NULL);
+    if (pSuite_fast_reconnect == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_fast_reconnect, "l2_wifi_fast_reconnect_auto_reconnect_mock", test_l2_wifi_fast_reconnect_auto_reconnect_mock);
+    UT_add_test(pSuite_fast_reconnect, "l2_wifi_fast_reconnect_last_endpoint_mock", test_l2_wifi_fast_reconnect_last_endpoint_mock);
+
+    pSuite_fast_reconnect_with_wifi_init = UT_add_suite("[L2 wifi_fast_reconnect post-init tests]", WiFi_InitPreReq, WiFi_UnInitPosReq);
+    if (pSuite_fast_reconnect_with_wifi_init == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_fast_reconnect_with_wifi_init, "l2_wifi_fast_reconnect_hal", test_l2_wifi_fast_reconnect_hal);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_FAST_RECONNECT_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,531 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_NETSTATS_HALTEST_L2 RDK-V WiFi Interface Counter L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the interface counter reader :
+ *
+ * Checks the traffic counter reader of the reference HAL
+ * (reference/include/wifi_netstats.h) against fake sysfs and procfs trees
+ * built in a temporary directory. The counter files are rewritten in place
+ * between reads, as the kernel regenerates them, so the tests see whether the
+ * descriptors kept open by the reader pick up new values.
+ *
+ * The last test times a refresh against opening and scanning each counter
+ * with stdio on every call, on the fake tree and on the loopback interface of
+ * the host.
+ *
+ * **Pre-Conditions:**  A writable /tmp @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_netstats.c
+*
+*/
+
+#define _GNU_SOURCE
+
+#include <ut.h>
+#include <ut_log.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stats.h"
+#include "wifi_netstats.h"
+
+#define NETSTATS_BENCH_ITERATIONS 2000
+
+static const char *const stat_names[WIFI_NETSTATS_COUNTERS] = {
+    "rx_bytes", "rx_packets", "rx_errors", "rx_dropped", "rx_fifo_errors", "rx_frame_errors",
+    "rx_compressed", "multicast", "tx_bytes", "tx_packets", "tx_errors", "tx_dropped",
+    "tx_fifo_errors", "collisions", "tx_carrier_errors", "tx_compressed", "rx_crc_errors",
+};
+
+static char fake_root[64];
+
+static int fake_mkdirs(const char *rel)
+{
+    char path[256];
+
+    snprintf(path, sizeof(path), "%s/%s", fake_root, rel);
+    for (char *p = path + strlen(fake_root) + 1; *p != '\0'; p++)
+    {
+        if (*p == '/')
+        {
+            *p = '\0';
+            mkdir(path, 0700);
+            *p = '/';
+        }
+    }
+    return (mkdir(path, 0700) == 0 || errno == EEXIST) ? 0 : -1;
+}
+
+/* Rewrites a file in place, so descriptors already open on it see the new text */
+static int fake_write(const char *rel, const char *text)
+{
+    char path[256];
+    size_t len = strlen(text);
+    int fd;
+    ssize_t n;
+
+    snprintf(path, sizeof(path), "%s/%s", fake_root, rel);
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    n = write(fd, text, len);
+    close(fd);
+    return (n == (ssize_t)len) ? 0 : -1;
+}
+
+static int fake_write_stat(const char *ifname, const char *name, uint64_t value)
+{
+    char rel[128];
+    char text[32];
+
+    snprintf(rel, sizeof(rel), "sys/class/net/%s/statistics/%s", ifname, name);
+    snprintf(text, sizeof(text), "%llu\n", (unsigned long long)value);
+    return fake_write(rel, text);
+}
+
+/* Counter i of the fake interface is base + i */
+static int fake_sysfs(const char *ifname, uint64_t base, BOOL with_crc)
+{
+    char rel[128];
+
+    snprintf(rel, sizeof(rel), "sys/class/net/%s/statistics", ifname);
+    if (fake_mkdirs(rel) != 0)
+    {
+        return -1;
+    }
+    for (int i = 0; i < WIFI_NETSTATS_COUNTERS; i++)
+    {
+        if ((i != WIFI_NETSTATS_RX_CRC_ERRORS || with_crc) && fake_write_stat(ifname, stat_names[i], base + i) != 0)
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int fake_remove(const char *path, const struct stat *sb, int type, struct FTW *ftw)
+{
+    (void)sb;
+    (void)type;
+    (void)ftw;
+    return remove(path);
+}
+
+static int fake_setup(void)
+{
+    snprintf(fake_root, sizeof(fake_root), "/tmp/wifi_netstats_XXXXXX");
+    return (mkdtemp(fake_root) != NULL) ? 0 : -1;
+}
+
+static void fake_teardown(void)
+{
+    nftw(fake_root, fake_remove, 8, FTW_DEPTH | FTW_PHYS);
+}
+
+static BOOL counters_are(const wifi_netstats_counters_t *counters, uint64_t base, BOOL with_crc)
+{
+    for (int i = 0; i < WIFI_NETSTATS_COUNTERS; i++)
+    {
+        uint64_t expected = (i != WIFI_NETSTATS_RX_CRC_ERRORS || with_crc) ? base + i : 0;
+
+        if (counters->value[i] != expected)
+        {
+            UT_LOG("%s: %llu, expected %llu\n", stat_names[i], (unsigned long long)counters->value[i],
+                   (unsigned long long)expected);
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/**
+* @brief Read counters from a fake sysfs tree and map them to the traffic statistics
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Open wlan0 under a fake sysfs without rx_crc_errors | Counter i = 1000 + i | Sysfs source, every counter read, rx_crc_errors 0 | Should be successful |
+* | 02 | Rewrite the counters in place and read again | Counter i = 5000000000 + i | New values through the open descriptors | Should be successful |
+* | 03 | Fill radio and SSID traffic statistics | None | Bytes, packets, errors, discards, multicast and unicast mapped | Should be successful |
+* | 04 | Write the largest 64 bit counter, then one past it, then text | 18446744073709551615 | Read, then -1, then -1 | Should be successful |
+* | 05 | Open an interface that is not there | wlan9 | NULL | Should be successful |
+*/
+void test_l2_wifi_netstats_sysfs (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_netstats_t *netstats;
+    wifi_netstats_counters_t counters;
+    wifi_radioTrafficStats_t radio;
+    wifi_ssidTrafficStats_t ssid;
+
+    if (fake_setup() != 0 || fake_sysfs("wlan0", 1000, FALSE) != 0)
+    {
+        UT_FAIL_FATAL("Cannot build the fake sysfs tree");
+    }
+    netstats = wifi_netstats_open(fake_root, "wlan0");
+    if (netstats == NULL)
+    {
+        fake_teardown();
+        UT_FAIL_FATAL("wifi_netstats_open failed");
+    }
+    UT_ASSERT_EQUAL(wifi_netstats_source(netstats), WIFI_NETSTATS_SOURCE_SYSFS);
+    UT_ASSERT_EQUAL(wifi_netstats_read(netstats, &counters), 0);
+    UT_ASSERT_TRUE(counters_are(&counters, 1000, FALSE));
+
+    /* Wider than 32 bits, as a long running interface gets */
+    UT_ASSERT_EQUAL(fake_sysfs("wlan0", 5000000000ULL, FALSE), 0);
+    UT_ASSERT_EQUAL(wifi_netstats_read(netstats, &counters), 0);
+    UT_ASSERT_TRUE(counters_are(&counters, 5000000000ULL, FALSE));
+
+    wifi_netstats_fill_radio(&counters, &radio);
+    UT_ASSERT_EQUAL(radio.radio_BytesSent, (ULONG)(5000000000ULL + WIFI_NETSTATS_TX_BYTES));
+    UT_ASSERT_EQUAL(radio.radio_BytesReceived, (ULONG)(5000000000ULL + WIFI_NETSTATS_RX_BYTES));
+    UT_ASSERT_EQUAL(radio.radio_PacketsSent, (ULONG)(5000000000ULL + WIFI_NETSTATS_TX_PACKETS));
+    UT_ASSERT_EQUAL(radio.radio_PacketsReceived, (ULONG)(5000000000ULL + WIFI_NETSTATS_RX_PACKETS));
+    UT_ASSERT_EQUAL(radio.radio_ErrorsSent, (ULONG)(5000000000ULL + WIFI_NETSTATS_TX_ERRORS));
+    UT_ASSERT_EQUAL(radio.radio_ErrorsReceived, (ULONG)(5000000000ULL + WIFI_NETSTATS_RX_ERRORS));
+    UT_ASSERT_EQUAL(radio.radio_DiscardPacketsSent, (ULONG)(5000000000ULL + WIFI_NETSTATS_TX_DROPPED));
+    UT_ASSERT_EQUAL(radio.radio_DiscardPacketsReceived, (ULONG)(5000000000ULL + WIFI_NETSTATS_RX_DROPPED));
+    UT_ASSERT_EQUAL(radio.radio_FCSErrorCount, 0);
+    UT_ASSERT_EQUAL(radio.radio_NoiseFloor, 0);
+
+    wifi_netstats_fill_ssid(&counters, &ssid);
+    UT_ASSERT_EQUAL(ssid.ssid_BytesSent, radio.radio_BytesSent);
+    UT_ASSERT_EQUAL(ssid.ssid_PacketsReceived, radio.radio_PacketsReceived);
+    UT_ASSERT_EQUAL(ssid.ssid_DiscardedPacketsReceived, radio.radio_DiscardPacketsReceived);
+    UT_ASSERT_EQUAL(ssid.ssid_MulticastPacketsReceived, (ULONG)(5000000000ULL + WIFI_NETSTATS_MULTICAST));
+    /* Fewer packets than multicast packets, as when the two are read a packet apart */
+    UT_ASSERT_EQUAL(ssid.ssid_UnicastPacketsReceived, 0);
+    UT_ASSERT_EQUAL(ssid.ssid_RetransCount, 0);
+
+    UT_ASSERT_EQUAL(fake_write_stat("wlan0", "rx_packets", 5000000100ULL), 0);
+    UT_ASSERT_EQUAL(wifi_netstats_read(netstats, &counters), 0);
+    wifi_netstats_fill_ssid(&counters, &ssid);
+    UT_ASSERT_EQUAL(ssid.ssid_UnicastPacketsReceived, (ULONG)(100 - WIFI_NETSTATS_MULTICAST));
+
+    UT_ASSERT_EQUAL(fake_write("sys/class/net/wlan0/statistics/tx_bytes", "18446744073709551615\n"), 0);
+    UT_ASSERT_EQUAL(wifi_netstats_read(netstats, &counters), 0);
+    UT_ASSERT_EQUAL(counters.value[WIFI_NETSTATS_TX_BYTES], UINT64_MAX);
+    UT_ASSERT_EQUAL(fake_write("sys/class/net/wlan0/statistics/tx_bytes", "18446744073709551616\n"), 0);
+    UT_ASSERT_EQUAL(wifi_netstats_read(netstats, &counters), -1);
+    UT_ASSERT_EQUAL(fake_write("sys/class/net/wlan0/statistics/tx_bytes", "n/a\n"), 0);
+    UT_ASSERT_EQUAL(wifi_netstats_read(netstats, &counters), -1);
+    wifi_netstats_close(netstats);
+
+    UT_ASSERT_PTR_NULL(wifi_netstats_open(fake_root, "wlan9"));
+    UT_ASSERT_PTR_NULL(wifi_netstats_open(fake_root, "../wlan0"));
+    fake_teardown();
+
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Read counters from a fake /proc/net/dev where sysfs has no statistics
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Open wlan0 with only proc/net/dev present | lo, wlan01 and wlan0 lines | Procfs source, the 16 wlan0 columns read, CRC errors 0 | Should be successful |
+* | 02 | Rewrite the table in place and read again | New wlan0 line | New values | Should be successful |
+* | 03 | Truncate the wlan0 line, then drop it | 10 columns | -1 both times | Should be successful |
+* | 04 | Open an interface that is not in the table | eth9 | NULL | Should be successful |
+*/
+void test_l2_wifi_netstats_procfs (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    static const char header[] =
+        "Inter-|   Receive                                                |  Transmit\n"
+        " face |bytes    packets errs drop fifo frame compressed multicast|bytes    packets errs drop fifo colls carrier compressed\n"
+        "    lo:  123456     789    0    0    0     0          0         0   123456     789    0    0    0     0       0          0\n"
+        "wlan01: 9 9 9 9 9 9 9 9 9 9 9 9 9 9 9 9\n";
+    char table[1024];
+    wifi_netstats_t *netstats;
+    wifi_netstats_counters_t counters;
+
+    if (fake_setup() != 0 || fake_mkdirs("proc/net") != 0)
+    {
+        UT_FAIL_FATAL("Cannot build the fake procfs tree");
+    }
+    snprintf(table, sizeof(table), "%s"
+             "  wlan0: 1000 1001 1002 1003 1004 1005 1006 1007 1008 1009 1010 1011 1012 1013 1014 1015\n", header);
+    UT_ASSERT_EQUAL(fake_write("proc/net/dev", table), 0);
+
+    netstats = wifi_netstats_open(fake_root, "wlan0");
+    if (netstats == NULL)
+    {
+        fake_teardown();
+        UT_FAIL_FATAL("wifi_netstats_open failed");
+    }
+    UT_ASSERT_EQUAL(wifi_netstats_source(netstats), WIFI_NETSTATS_SOURCE_PROCFS);
+    UT_ASSERT_EQUAL(wifi_netstats_read(netstats, &counters), 0);
+    UT_ASSERT_TRUE(counters_are(&counters, 1000, FALSE));
+
+    /* No newline after the last line */
+    snprintf(table, sizeof(table), "%s"
+             "  wlan0:7000000000 7000000001 7000000002 7000000003 7000000004 7000000005 7000000006 7000000007 "
+             "7000000008 7000000009 7000000010 7000000011 7000000012 7000000013 7000000014 7000000015", header);
+    UT_ASSERT_EQUAL(fake_write("proc/net/dev", table), 0);
+    UT_ASSERT_EQUAL(wifi_netstats_read(netstats, &counters), 0);
+    UT_ASSERT_TRUE(counters_are(&counters, 7000000000ULL, FALSE));
+
+    snprintf(table, sizeof(table), "%s  wlan0: 1 2 3 4 5 6 7 8 9 10\n    eth0: 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16\n",
+             header);
+    UT_ASSERT_EQUAL(fake_write("proc/net/dev", table), 0);
+    UT_ASSERT_EQUAL(wifi_netstats_read(netstats, &counters), -1);
+    UT_ASSERT_EQUAL(fake_write("proc/net/dev", header), 0);
+    UT_ASSERT_EQUAL(wifi_netstats_read(netstats, &counters), -1);
+    wifi_netstats_close(netstats);
+
+    UT_ASSERT_PTR_NULL(wifi_netstats_open(fake_root, "eth9"));
+    fake_teardown();
+
+    WIFI_TRACE_TEST_END();
+}
+
+/* Opens and scans every counter with stdio, the way a HAL without a reader does it */
+static int stdio_read(const char *root, const char *ifname, wifi_netstats_counters_t *counters)
+{
+    char path[256];
+
+    for (int i = 0; i < WIFI_NETSTATS_COUNTERS; i++)
+    {
+        unsigned long long value = 0;
+        FILE *fp;
+
+        snprintf(path, sizeof(path), "%s/sys/class/net/%s/statistics/%s", root, ifname, stat_names[i]);
+        fp = fopen(path, "r");
+        if (fp == NULL)
+        {
+            counters->value[i] = 0;
+            continue;
+        }
+        if (fscanf(fp, "%llu", &value) != 1)
+        {
+            fclose(fp);
+            return -1;
+        }
+        fclose(fp);
+        counters->value[i] = value;
+    }
+    return 0;
+}
+
+static void bench_log(const char *name, wifi_perf_samples_t *samples)
+{
+    wifi_perf_summary_t summary;
+
+    wifi_perf_summarize(samples, &summary);
+    UT_LOG("| %-28s | %8.2f | %8.2f | %8.2f |\n", name, summary.p50 / 1000.0, summary.p90 / 1000.0,
+           summary.mean / 1000.0);
+}
+
+/* Times NETSTATS_BENCH_ITERATIONS refreshes of an open reader and, with stdio_root set, of stdio_read() */
+static void bench_source(const char *name, wifi_netstats_t *netstats, const char *stdio_root, const char *ifname)
+{
+    wifi_perf_samples_t samples;
+    wifi_netstats_counters_t counters;
+    char label[64];
+    int failures = 0;
+
+    wifi_perf_samples_init(&samples, NETSTATS_BENCH_ITERATIONS);
+    for (int i = 0; i < NETSTATS_BENCH_ITERATIONS; i++)
+    {
+        uint64_t start = wifi_perf_now_ns();
+
+        failures += (wifi_netstats_read(netstats, &counters) != 0);
+        wifi_perf_samples_add(&samples, wifi_perf_now_ns() - start);
+    }
+    UT_ASSERT_EQUAL(failures, 0);
+    snprintf(label, sizeof(label), "%s, pread", name);
+    bench_log(label, &samples);
+
+    if (stdio_root != NULL)
+    {
+        wifi_perf_samples_clear(&samples);
+        failures = 0;
+        for (int i = 0; i < NETSTATS_BENCH_ITERATIONS; i++)
+        {
+            uint64_t start = wifi_perf_now_ns();
+
+            failures += (stdio_read(stdio_root, ifname, &counters) != 0);
+            wifi_perf_samples_add(&samples, wifi_perf_now_ns() - start);
+        }
+        UT_ASSERT_EQUAL(failures, 0);
+        snprintf(label, sizeof(label), "%s, fopen/fscanf", name);
+        bench_log(label, &samples);
+    }
+    wifi_perf_samples_free(&samples);
+}
+
+/**
+* @brief Time a counter refresh against stdio on every call
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 003 @n
+* **Priority:** Medium @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Read the fake sysfs counters with the reader and with fopen/fscanf | 2000 refreshes each | Same values, cost logged | Should be successful |
+* | 02 | Read lo from the host sysfs and /proc/net/dev the same way | 2000 refreshes each | Cost logged, skipped where the host has no lo | Informational |
+*/
+void test_l2_wifi_netstats_benchmark (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_netstats_t *netstats;
+    wifi_netstats_counters_t counters;
+    wifi_netstats_counters_t baseline;
+
+    if (fake_setup() != 0 || fake_sysfs("wlan0", 1000, TRUE) != 0)
+    {
+        UT_FAIL_FATAL("Cannot build the fake sysfs tree");
+    }
+    netstats = wifi_netstats_open(fake_root, "wlan0");
+    if (netstats == NULL)
+    {
+        fake_teardown();
+        UT_FAIL_FATAL("wifi_netstats_open failed");
+    }
+    UT_ASSERT_EQUAL(wifi_netstats_read(netstats, &counters), 0);
+    UT_ASSERT_EQUAL(stdio_read(fake_root, "wlan0", &baseline), 0);
+    UT_ASSERT_EQUAL(memcmp(&counters, &baseline, sizeof(counters)), 0);
+
+    UT_LOG("| %-28s |   p50 us |   p90 us |  mean us |\n", "17 counters");
+    bench_source("fake sysfs", netstats, fake_root, "wlan0");
+    wifi_netstats_close(netstats);
+    fake_teardown();
+
+    /* The host may run the tests in a container without sysfs */
+    netstats = wifi_netstats_open(NULL, "lo");
+    if (netstats != NULL && wifi_netstats_source(netstats) == WIFI_NETSTATS_SOURCE_SYSFS)
+    {
+        bench_source("host sysfs lo", netstats, "", "lo");
+    }
+    wifi_netstats_close(netstats);
+
+    if (fake_setup() == 0)
+    {
+        char link[128];
+
+        /* A root with proc but no sys, so the reader takes /proc/net/dev of the host */
+        snprintf(link, sizeof(link), "%s/proc", fake_root);
+        if (symlink("/proc", link) == 0)
+        {
+            netstats = wifi_netstats_open(fake_root, "lo");
+            if (netstats != NULL)
+            {
+                bench_source("host /proc/net/dev lo", netstats, NULL, "lo");
+            }
+            wifi_netstats_close(netstats);
+        }
+        fake_teardown();
+    }
+
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_netstats = NULL;
+
+/**
+ * @brief Register the interface counter tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_netstats_register_l2_tests (void)
+{
+    pSuite_netstats = UT_add_suite("[L2 wifi_netstats tests]", NULL, NULL);
+    if (pSuite_netstats == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_netstats, "l2_wifi_netstats_sysfs", test_l2_wifi_netstats_sysfs);
+    UT_add_test(pSuite_netstats, "l2_wifi_netstats_procfs", test_l2_wifi_netstats_procfs);
+    UT_add_test(pSuite_netstats, "l2_wifi_netstats_benchmark", test_l2_wifi_netstats_benchmark);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_NETSTATS_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
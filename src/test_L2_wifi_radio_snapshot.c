@@ -0,0 +1,526 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_RADIO_SNAPSHOT_HALTEST_L2 RDK-V WiFi Radio Snapshot L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the RDK-V WiFi static radio attribute snapshot :
+ *
+ * Module and stress tests for the snapshot in wrappers/src/wifi_radio_snapshot.c.
+ * The module tests take the snapshot over mock getters, the stress tests compare
+ * snapshot and direct getter latency.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_radio_snapshot.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "wifi_common_hal.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stats.h"
+#include "wifi_radio_snapshot.h"
+
+#define MOCK_RADIOS 2
+#define MOCK_GETTER_DELAY_MS 1
+#define BENCH_ITERATIONS 20
+#define HAL_BENCH_ITERATIONS 200
+#define SNAPSHOT_OUTPUT_LEN 256
+
+extern int WiFi_InitPreReq(void);
+extern int WiFi_UnInitPosReq(void);
+extern const int RADIO_INDEX;
+
+typedef INT (*radio_string_getter_t)(INT radioIndex, CHAR *output_string);
+
+static int mock_calls = 0;
+static UINT mock_delay_ms = 0;
+static int mock_fail_if_name = 0;
+static int mock_long_max_bit_rate = 0;
+
+static INT mock_getRadioNumberOfEntries(ULONG *output)
+{
+    mock_calls++;
+    *output = MOCK_RADIOS;
+    return RETURN_OK;
+}
+
+static INT mock_string(INT radioIndex, CHAR *output_string, const char *value)
+{
+    mock_calls++;
+    wifi_perf_sleep_ms(mock_delay_ms);
+    if (radioIndex < 1 || radioIndex > MOCK_RADIOS)
+    {
+        return RETURN_ERR;
+    }
+    sprintf(output_string, "%s", value);
+    return RETURN_OK;
+}
+
+static INT mock_getRadioIfName(INT radioIndex, CHAR *output_string)
+{
+    if (mock_fail_if_name)
+    {
+        mock_calls++;
+        return RETURN_ERR;
+    }
+    return mock_string(radioIndex, output_string, (radioIndex == 1) ? "wlan0" : "wlan1");
+}
+
+static INT mock_getRadioSupportedFrequencyBands(INT radioIndex, CHAR *output_string)
+{
+    return mock_string(radioIndex, output_string, (radioIndex == 1) ? "2.4GHz" : "5GHz");
+}
+
+static INT mock_getRadioSupportedStandards(INT radioIndex, CHAR *output_string)
+{
+    return mock_string(radioIndex, output_string, (radioIndex == 1) ? "b,g,n,ax" : "a,n,ac,ax");
+}
+
+static INT mock_getRadioMaxBitRate(INT radioIndex, CHAR *output_string)
+{
+    if (mock_long_max_bit_rate)
+    {
+        return mock_string(radioIndex, output_string, "1201 Mb/s with a vendor suffix too long to keep in the snapshot");
+    }
+    return mock_string(radioIndex, output_string, (radioIndex == 1) ? "574 Mb/s" : "1201 Mb/s");
+}
+
+static INT mock_getRadioTransmitPowerSupported(INT radioIndex, CHAR *output_list)
+{
+    return mock_string(radioIndex, output_list, "0,25,50,75,100");
+}
+
+static const wifi_radio_snapshot_config_t mock_config = {
+    .getRadioNumberOfEntries = mock_getRadioNumberOfEntries,
+    .getRadioIfName = mock_getRadioIfName,
+    .getRadioSupportedFrequencyBands = mock_getRadioSupportedFrequencyBands,
+    .getRadioSupportedStandards = mock_getRadioSupportedStandards,
+    .getRadioMaxBitRate = mock_getRadioMaxBitRate,
+    .getRadioTransmitPowerSupported = mock_getRadioTransmitPowerSupported,
+};
+
+/* The snapshot getters, in the same order as the direct getters below */
+static const radio_string_getter_t snapshot_getters[] = {
+    wifi_radio_snapshot_getRadioIfName,
+    wifi_radio_snapshot_getRadioSupportedFrequencyBands,
+    wifi_radio_snapshot_getRadioSupportedStandards,
+    wifi_radio_snapshot_getRadioMaxBitRate,
+    wifi_radio_snapshot_getRadioTransmitPowerSupported,
+};
+
+static const radio_string_getter_t mock_getters[] = {
+    mock_getRadioIfName,
+    mock_getRadioSupportedFrequencyBands,
+    mock_getRadioSupportedStandards,
+    mock_getRadioMaxBitRate,
+    mock_getRadioTransmitPowerSupported,
+};
+
+static const radio_string_getter_t hal_getters[] = {
+    wifi_getRadioIfName,
+    wifi_getRadioSupportedFrequencyBands,
+    wifi_getRadioSupportedStandards,
+    wifi_getRadioMaxBitRate,
+    wifi_getRadioTransmitPowerSupported,
+};
+
+#define GETTER_COUNT (sizeof(snapshot_getters) / sizeof(snapshot_getters[0]))
+
+static void mock_snapshot_init(void)
+{
+    mock_calls = 0;
+    wifi_radio_snapshot_deinit();
+    if (wifi_radio_snapshot_init(&mock_config) != RETURN_OK)
+    {
+        UT_FAIL_FATAL("wifi_radio_snapshot_init failed");
+    }
+}
+
+static void mock_reset(void)
+{
+    mock_delay_ms = 0;
+    mock_fail_if_name = 0;
+    mock_long_max_bit_rate = 0;
+}
+
+/* Times `iterations` rounds of every getter on one radio, returns the number of failed calls */
+static int bench_getters(const radio_string_getter_t *getters, INT radioIndex, int iterations, wifi_perf_summary_t *summary)
+{
+    CHAR output_string[SNAPSHOT_OUTPUT_LEN];
+    wifi_perf_samples_t samples;
+    int failures = 0;
+
+    wifi_perf_samples_init(&samples, iterations * GETTER_COUNT);
+    for (int i = 0; i < iterations; i++)
+    {
+        for (size_t getter = 0; getter < GETTER_COUNT; getter++)
+        {
+            uint64_t start = wifi_perf_now_ns();
+
+            if (getters[getter](radioIndex, output_string) != RETURN_OK)
+            {
+                failures++;
+            }
+            wifi_perf_samples_add(&samples, wifi_perf_now_ns() - start);
+        }
+    }
+    wifi_perf_summarize(&samples, summary);
+    wifi_perf_samples_free(&samples);
+    return failures;
+}
+
+/**
+* @brief Verify that the snapshot reads every attribute once and then serves them from memory
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Take the snapshot over two mock radios | None | RETURN_OK, 11 getter calls, every attribute valid | Should be successful |
+* | 02 | Read every attribute of both radios 10 times | radioIndex = 1, 2 | RETURN_OK, same value as the mock, no further getter calls | Should be successful |
+*/
+void test_l2_wifi_radio_snapshot_attributes_served_from_memory (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    CHAR snapshot_value[SNAPSHOT_OUTPUT_LEN];
+    CHAR direct_value[SNAPSHOT_OUTPUT_LEN];
+    const wifi_radio_static_attrs_t *radio;
+    wifi_radio_snapshot_stats_t stats;
+    int calls;
+
+    mock_reset();
+    mock_snapshot_init();
+    UT_ASSERT_EQUAL(mock_calls, 1 + MOCK_RADIOS * GETTER_COUNT);
+    UT_ASSERT_EQUAL(wifi_radio_snapshot_count(), MOCK_RADIOS);
+
+    for (INT radioIndex = 1; radioIndex <= MOCK_RADIOS; radioIndex++)
+    {
+        radio = wifi_radio_snapshot_get(radioIndex);
+        UT_ASSERT_EQUAL(radio != NULL, 1);
+        if (radio != NULL)
+        {
+            UT_ASSERT_EQUAL(radio->radioIndex, radioIndex);
+            UT_ASSERT_EQUAL(radio->valid, WIFI_RADIO_ATTR_ALL);
+        }
+    }
+
+    calls = mock_calls;
+    for (int i = 0; i < 10; i++)
+    {
+        for (INT radioIndex = 1; radioIndex <= MOCK_RADIOS; radioIndex++)
+        {
+            for (size_t getter = 0; getter < GETTER_COUNT; getter++)
+            {
+                UT_ASSERT_EQUAL(snapshot_getters[getter](radioIndex, snapshot_value), RETURN_OK);
+                mock_getters[getter](radioIndex, direct_value);
+                UT_ASSERT_EQUAL(strcmp(snapshot_value, direct_value), 0);
+            }
+        }
+    }
+    /* Only the comparison calls above reached the mock */
+    UT_ASSERT_EQUAL(mock_calls - calls, 10 * MOCK_RADIOS * GETTER_COUNT);
+    wifi_radio_snapshot_get_stats(&stats);
+    UT_ASSERT_EQUAL(stats.hits, 10 * MOCK_RADIOS * GETTER_COUNT);
+    UT_ASSERT_EQUAL(stats.forwarded, 0);
+
+    wifi_radio_snapshot_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that attributes which failed or did not fit are forwarded to the HAL
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Take the snapshot with the interface name failing and a maximum bit rate longer than its field | None | RETURN_OK, both bits clear in valid | Should be successful |
+* | 02 | Let the interface name succeed and read it | radioIndex = 1 | RETURN_OK, "wlan0", call forwarded | Should be successful |
+* | 03 | Read the maximum bit rate | radioIndex = 1 | RETURN_OK, full untruncated value, call forwarded | Should be successful |
+* | 04 | Read an attribute of a radio outside the snapshot | radioIndex = 3 | RETURN_ERR from the mock, call forwarded | Should Fail |
+*/
+void test_l2_wifi_radio_snapshot_unreadable_attributes_forwarded (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    CHAR output_string[SNAPSHOT_OUTPUT_LEN];
+    CHAR expected[SNAPSHOT_OUTPUT_LEN];
+    const wifi_radio_static_attrs_t *radio;
+    wifi_radio_snapshot_stats_t stats;
+
+    mock_reset();
+    mock_fail_if_name = 1;
+    mock_long_max_bit_rate = 1;
+    mock_snapshot_init();
+
+    radio = wifi_radio_snapshot_get(1);
+    UT_ASSERT_EQUAL(radio != NULL, 1);
+    if (radio != NULL)
+    {
+        UT_ASSERT_EQUAL(radio->valid, WIFI_RADIO_ATTR_ALL & ~(WIFI_RADIO_ATTR_IF_NAME | WIFI_RADIO_ATTR_MAX_BIT_RATE));
+    }
+
+    mock_fail_if_name = 0;
+    UT_ASSERT_EQUAL(wifi_radio_snapshot_getRadioIfName(1, output_string), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(output_string, "wlan0"), 0);
+
+    UT_ASSERT_EQUAL(wifi_radio_snapshot_getRadioMaxBitRate(1, output_string), RETURN_OK);
+    mock_getRadioMaxBitRate(1, expected);
+    UT_ASSERT_EQUAL(strcmp(output_string, expected), 0);
+
+    UT_ASSERT_EQUAL(wifi_radio_snapshot_getRadioSupportedStandards(MOCK_RADIOS + 1, output_string), RETURN_ERR);
+
+    wifi_radio_snapshot_get_stats(&stats);
+    UT_ASSERT_EQUAL(stats.forwarded, 3);
+    UT_ASSERT_EQUAL(stats.hits, 0);
+
+    wifi_radio_snapshot_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that the snapshot rejects invalid parameters and calls before initialisation
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 003 @n
+* **Priority:** Med @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Read an attribute before wifi_radio_snapshot_init() | None | RETURN_ERR, count 0, no snapshot | Should Fail |
+* | 02 | Pass a NULL output buffer to every getter | output_string = NULL | RETURN_ERR | Should Fail |
+* | 03 | Initialise twice | None | RETURN_ERR on the second call | Should Fail |
+*/
+void test_l2_wifi_radio_snapshot_invalid_parameters (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    CHAR output_string[SNAPSHOT_OUTPUT_LEN];
+
+    mock_reset();
+    wifi_radio_snapshot_deinit();
+    UT_ASSERT_EQUAL(wifi_radio_snapshot_getRadioIfName(1, output_string), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_radio_snapshot_count(), 0);
+    UT_ASSERT_EQUAL(wifi_radio_snapshot_get(1) == NULL, 1);
+
+    mock_snapshot_init();
+    for (size_t getter = 0; getter < GETTER_COUNT; getter++)
+    {
+        UT_ASSERT_EQUAL(snapshot_getters[getter](1, NULL), RETURN_ERR);
+    }
+    UT_ASSERT_EQUAL(wifi_radio_snapshot_init(&mock_config), RETURN_ERR);
+
+    wifi_radio_snapshot_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Benchmark snapshot and direct reads of the static attributes over a mock with a driver round-trip
+*
+* **Test Group ID:** Stress: 03 @n
+* **Test Case ID:** 004 @n
+* **Priority:** Med @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Read the five attributes 20 times from the mock | getter delay = 1 ms | RETURN_OK | Direct |
+* | 02 | Read the five attributes 20 times from the snapshot | getter delay = 1 ms | RETURN_OK, p99 below the direct minimum | Snapshot |
+*/
+void test_l2_wifi_radio_snapshot_benchmark_mock (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_perf_summary_t direct;
+    wifi_perf_summary_t snapshot;
+    char line[256];
+
+    mock_reset();
+    mock_delay_ms = MOCK_GETTER_DELAY_MS;
+    mock_snapshot_init();
+
+    UT_ASSERT_EQUAL(bench_getters(mock_getters, 1, BENCH_ITERATIONS, &direct), 0);
+    UT_ASSERT_EQUAL(bench_getters(snapshot_getters, 1, BENCH_ITERATIONS, &snapshot), 0);
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "direct static attributes (mock)", &direct));
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "snapshot static attributes (mock)", &snapshot));
+    UT_LOG("Saved %.1f ms over %zu calls\n", (direct.total - snapshot.total) / 1e6, direct.count);
+    UT_ASSERT_EQUAL(snapshot.p99 < direct.min, 1);
+
+    mock_reset();
+    wifi_radio_snapshot_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Compare snapshot and direct static attributes on the HAL under test
+*
+* **Test Group ID:** Stress: 03 @n
+* **Test Case ID:** 005 @n
+* **Priority:** Med @n
+* @n
+* **Pre-Conditions:** wifi_init() called by the suite @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Take the snapshot from the HAL | None | RETURN_OK, the test is skipped if the HAL reports no radios | Should be successful |
+* | 02 | Compare every snapshot attribute with a direct HAL call | radioIndex = 1 | Same status and value | Should be successful |
+* | 03 | Time 200 rounds of the five getters directly and from the snapshot | radioIndex = 1 | Same number of failures, latencies logged | Benchmark |
+*/
+void test_l2_wifi_radio_snapshot_hal_direct_vs_snapshot (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    CHAR snapshot_value[SNAPSHOT_OUTPUT_LEN];
+    CHAR direct_value[SNAPSHOT_OUTPUT_LEN];
+    wifi_perf_summary_t direct;
+    wifi_perf_summary_t snapshot;
+    int direct_failures;
+    int snapshot_failures;
+    char line[256];
+
+    wifi_radio_snapshot_deinit();
+    UT_ASSERT_EQUAL(wifi_radio_snapshot_init(NULL), RETURN_OK);
+    UT_LOG("Snapshot holds %lu radios, %zu bytes each\n", (unsigned long)wifi_radio_snapshot_count(), sizeof(wifi_radio_static_attrs_t));
+    if (wifi_radio_snapshot_count() == 0)
+    {
+        UT_LOG("HAL reports no radios, comparison skipped\n");
+        wifi_radio_snapshot_deinit();
+        WIFI_TRACE_TEST_END();
+        return;
+    }
+
+    for (size_t getter = 0; getter < GETTER_COUNT; getter++)
+    {
+        INT snapshot_ret;
+        INT direct_ret;
+
+        memset(snapshot_value, 0, sizeof(snapshot_value));
+        memset(direct_value, 0, sizeof(direct_value));
+        snapshot_ret = snapshot_getters[getter](RADIO_INDEX, snapshot_value);
+        direct_ret = hal_getters[getter](RADIO_INDEX, direct_value);
+        UT_ASSERT_EQUAL(snapshot_ret, direct_ret);
+        if (snapshot_ret == RETURN_OK && direct_ret == RETURN_OK)
+        {
+            UT_ASSERT_EQUAL(strcmp(snapshot_value, direct_value), 0);
+        }
+    }
+
+    direct_failures = bench_getters(hal_getters, RADIO_INDEX, HAL_BENCH_ITERATIONS, &direct);
+    snapshot_failures = bench_getters(snapshot_getters, RADIO_INDEX, HAL_BENCH_ITERATIONS, &snapshot);
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "direct static attributes", &direct));
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "snapshot static attributes", &snapshot));
+    UT_ASSERT_EQUAL(snapshot_failures, direct_failures);
+
+    wifi_radio_snapshot_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_radio_snapshot = NULL;
+static UT_test_suite_t * pSuite_radio_snapshot_with_wifi_init = NULL;
+
+/**
+ * @brief Register the static radio attribute snapshot tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_radio_snapshot_register_l2_tests (void)
+{
+    pSuite_radio_snapshot = UT_add_suite("[L2 wifi_radio_snapshot tests]", NULL, NULL);
+    if (pSuite_radio_snapshot == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_radio_snapshot, "l2_wifi_radio_snapshot_attributes_served_from_memory", test_l2_wifi_radio_snapshot_attributes_served_from_memory);
+    UT_add_test(pSuite_radio_snapshot, "l2_wifi_radio_snapshot_unreadable_attributes_forwarded", test_l2_wifi_radio_snapshot_unreadable_attributes_forwarded);
+    UT_add_test(pSuite_radio_snapshot, "l2_wifi_radio_snapshot_invalid_parameters", test_l2_wifi_radio_snapshot_invalid_parameters);
+    UT_add_test(pSuite_radio_snapshot, "l2_wifi_radio_snapshot_benchmark_mock", test_l2_wifi_radio_snapshot_benchmark_mock);
+
+    pSuite_radio_snapshot_with_wifi_init = UT_add_suite("[L2 wifi_radio_snapshot post-init tests]", WiFi_InitPreReq, WiFi_UnInitPosReq);
+    if (pSuite_radio_snapshot_with_wifi_init == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_radio_snapshot_with_wifi_init, "l2_wifi_radio_snapshot_hal_direct_vs_snapshot", test_l2_wifi_radio_snapshot_hal_direct_vs_snapshot);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_RADIO_SNAPSHOT_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,343 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_RADIO_STATE_HALTEST_L2 RDK-V WiFi Batch Radio State L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the RDK-V WiFi batch radio state query :
+ *
+ * Module and stress tests for wrappers/src/wifi_radio_state.c. The batch query is
+ * checked against the individual getters of the HAL under test and timed against
+ * the sum of the individual calls.
+ *
+ * **Pre-Conditions:**  wifi_init() called by the suite @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_radio_state.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "wifi_common_hal.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stats.h"
+#include "wifi_radio_state.h"
+
+#define BENCH_ITERATIONS 100
+
+/* Same room as wifi_radio_state_get() gives a string getter */
+#define SCRATCH_LEN 256
+
+extern int WiFi_InitPreReq(void);
+extern int WiFi_UnInitPosReq(void);
+extern const int RADIO_INDEX;
+
+static uint64_t individual_ns;
+
+#define TIMED_FIELD(field, call) \
+    do { \
+        uint64_t start = wifi_perf_now_ns(); \
+        INT ret = (call); \
+        individual_ns += wifi_perf_now_ns() - start; \
+        if (ret == RETURN_OK) { \
+            state->valid |= WIFI_RADIO_STATE_BIT(field); \
+        } \
+    } while (0)
+
+/*
+ * The HAL does not take a buffer size, so string getters write into scratch and the
+ * value is kept only if it fits the field, as wifi_radio_state_get() does
+ */
+#define TIMED_STRING(field, member, call) \
+    do { \
+        CHAR scratch[SCRATCH_LEN] = {0}; \
+        uint64_t start = wifi_perf_now_ns(); \
+        INT ret = (call); \
+        individual_ns += wifi_perf_now_ns() - start; \
+        scratch[sizeof(scratch) - 1] = '\0'; \
+        if (ret == RETURN_OK && strlen(scratch) < sizeof(state->member)) { \
+            strcpy(state->member, scratch); \
+            state->valid |= WIFI_RADIO_STATE_BIT(field); \
+        } \
+    } while (0)
+
+/* Reads the radio with one timed call per getter, adding their latencies to individual_ns */
+static void read_individually(INT radioIndex, wifi_radio_state_t *state)
+{
+    memset(state, 0, sizeof(*state));
+    state->radioIndex = radioIndex;
+    TIMED_FIELD(WIFI_RADIO_STATE_ENABLE, wifi_getRadioEnable(radioIndex, &state->enable));
+    TIMED_STRING(WIFI_RADIO_STATE_STATUS, status, wifi_getRadioStatus(radioIndex, scratch));
+    TIMED_STRING(WIFI_RADIO_STATE_OPERATING_FREQUENCY_BAND, operatingFrequencyBand, wifi_getRadioOperatingFrequencyBand(radioIndex, scratch));
+    TIMED_STRING(WIFI_RADIO_STATE_STANDARD, standard, wifi_getRadioStandard(radioIndex, scratch, &state->gOnly, &state->nOnly, &state->acOnly));
+    TIMED_STRING(WIFI_RADIO_STATE_POSSIBLE_CHANNELS, possibleChannels, wifi_getRadioPossibleChannels(radioIndex, scratch));
+    TIMED_STRING(WIFI_RADIO_STATE_CHANNELS_IN_USE, channelsInUse, wifi_getRadioChannelsInUse(radioIndex, scratch));
+    TIMED_FIELD(WIFI_RADIO_STATE_CHANNEL, wifi_getRadioChannel(radioIndex, &state->channel));
+    TIMED_FIELD(WIFI_RADIO_STATE_AUTO_CHANNEL_SUPPORTED, wifi_getRadioAutoChannelSupported(radioIndex, &state->autoChannelSupported));
+    TIMED_FIELD(WIFI_RADIO_STATE_AUTO_CHANNEL_ENABLE, wifi_getRadioAutoChannelEnable(radioIndex, &state->autoChannelEnable));
+    TIMED_FIELD(WIFI_RADIO_STATE_AUTO_CHANNEL_REFRESH_PERIOD, wifi_getRadioAutoChannelRefreshPeriod(radioIndex, &state->autoChannelRefreshPeriod));
+    TIMED_STRING(WIFI_RADIO_STATE_GUARD_INTERVAL, guardInterval, wifi_getRadioGuardInterval(radioIndex, scratch));
+    TIMED_STRING(WIFI_RADIO_STATE_OPERATING_CHANNEL_BANDWIDTH, operatingChannelBandwidth, wifi_getRadioOperatingChannelBandwidth(radioIndex, scratch));
+    TIMED_STRING(WIFI_RADIO_STATE_EXT_CHANNEL, extChannel, wifi_getRadioExtChannel(radioIndex, scratch));
+    TIMED_FIELD(WIFI_RADIO_STATE_MCS, wifi_getRadioMCS(radioIndex, &state->mcs));
+    TIMED_FIELD(WIFI_RADIO_STATE_TRANSMIT_POWER, wifi_getRadioTransmitPower(radioIndex, &state->transmitPower));
+    TIMED_FIELD(WIFI_RADIO_STATE_IEEE80211H_SUPPORTED, wifi_getRadioIEEE80211hSupported(radioIndex, &state->ieee80211hSupported));
+    TIMED_FIELD(WIFI_RADIO_STATE_IEEE80211H_ENABLED, wifi_getRadioIEEE80211hEnabled(radioIndex, &state->ieee80211hEnabled));
+    TIMED_STRING(WIFI_RADIO_STATE_REGULATORY_DOMAIN, regulatoryDomain, wifi_getRegulatoryDomain(radioIndex, scratch));
+    TIMED_FIELD(WIFI_RADIO_STATE_TRAFFIC_STATS, wifi_getRadioTrafficStats(radioIndex, &state->trafficStats));
+}
+
+/**
+* @brief Verify that the batch query returns the same fields as the individual getters
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** wifi_init() called by the suite @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Invoke wifi_radio_state_get() | radioIndex = 1 | RETURN_OK | Should Pass |
+* | 02 | Invoke each getter individually | radioIndex = 1 | Same valid mask and same values as the batch query | Should Pass |
+*/
+void test_l2_wifi_radio_state_matches_individual_getters (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_radio_state_t batch;
+    wifi_radio_state_t individual;
+
+    UT_ASSERT_EQUAL(wifi_radio_state_get(RADIO_INDEX, &batch), RETURN_OK);
+    read_individually(RADIO_INDEX, &individual);
+
+    UT_LOG("Batch query read %u of %d fields, valid=0x%05x\n", wifi_radio_state_field_count(batch.valid),
+           WIFI_RADIO_STATE_FIELD_MAX, batch.valid);
+    UT_ASSERT_EQUAL(batch.radioIndex, RADIO_INDEX);
+    UT_ASSERT_EQUAL(batch.valid, individual.valid);
+    UT_ASSERT_EQUAL(batch.enable, individual.enable);
+    UT_ASSERT_EQUAL(strcmp(batch.status, individual.status), 0);
+    UT_ASSERT_EQUAL(strcmp(batch.standard, individual.standard), 0);
+    UT_ASSERT_EQUAL(batch.channel, individual.channel);
+    UT_ASSERT_EQUAL(strcmp(batch.operatingChannelBandwidth, individual.operatingChannelBandwidth), 0);
+    UT_ASSERT_EQUAL(strcmp(batch.extChannel, individual.extChannel), 0);
+    UT_ASSERT_EQUAL(strcmp(batch.guardInterval, individual.guardInterval), 0);
+    UT_ASSERT_EQUAL(batch.mcs, individual.mcs);
+    UT_ASSERT_EQUAL(batch.transmitPower, individual.transmitPower);
+    UT_ASSERT_EQUAL(batch.ieee80211hEnabled, individual.ieee80211hEnabled);
+    UT_ASSERT_EQUAL(strcmp(batch.regulatoryDomain, individual.regulatoryDomain), 0);
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that wifi_radio_state_get_all() fills one entry per radio
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** wifi_init() called by the suite @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Invoke wifi_getRadioNumberOfEntries() | None | RETURN_OK | Should Pass |
+* | 02 | Invoke wifi_radio_state_get_all() | max_radios = 4 | RETURN_OK, one entry per radio with radioIndex 1..N | Should Pass |
+*/
+void test_l2_wifi_radio_state_all_radios (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_radio_state_t states[WIFI_RADIO_STATE_MAX_RADIOS];
+    ULONG radios = 0;
+    ULONG count = 0;
+
+    UT_ASSERT_EQUAL(wifi_getRadioNumberOfEntries(&radios), RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_radio_state_get_all(states, WIFI_RADIO_STATE_MAX_RADIOS, &count), RETURN_OK);
+    UT_LOG("wifi_getRadioNumberOfEntries() = %lu, radios filled = %lu\n", (unsigned long)radios, (unsigned long)count);
+    UT_ASSERT_EQUAL(count, (radios < WIFI_RADIO_STATE_MAX_RADIOS) ? radios : WIFI_RADIO_STATE_MAX_RADIOS);
+    for (ULONG i = 0; i < count; i++)
+    {
+        UT_ASSERT_EQUAL(states[i].radioIndex, (INT)(i + 1));
+        UT_ASSERT_EQUAL(states[i].valid != 0, 1);
+    }
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that the batch query rejects invalid parameters
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 003 @n
+* **Priority:** Med @n
+* @n
+* **Pre-Conditions:** wifi_init() called by the suite @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Invoke wifi_radio_state_get() with a NULL state | state = NULL | RETURN_ERR | Should Fail |
+* | 02 | Invoke wifi_radio_state_get_all() with NULL pointers or no room | states = NULL, output_count = NULL, max_radios = 0 | RETURN_ERR | Should Fail |
+*/
+void test_l2_wifi_radio_state_invalid_parameters (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_radio_state_t states[WIFI_RADIO_STATE_MAX_RADIOS];
+    ULONG count = 0;
+
+    UT_ASSERT_EQUAL(wifi_radio_state_get(RADIO_INDEX, NULL), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_radio_state_get_all(NULL, WIFI_RADIO_STATE_MAX_RADIOS, &count), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_radio_state_get_all(states, WIFI_RADIO_STATE_MAX_RADIOS, NULL), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_radio_state_get_all(states, 0, &count), RETURN_ERR);
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Benchmark the batch query against the sum of the individual getters
+*
+* Times 100 batch queries of every radio and 100 rounds of the individual getters, where each
+* getter is timed on its own and the latencies are summed as a caller polling fields separately would see them. @n
+*
+* **Test Group ID:** Stress: 03 @n
+* **Test Case ID:** 004 @n
+* **Priority:** Med @n
+* @n
+* **Pre-Conditions:** wifi_init() called by the suite @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Invoke wifi_radio_state_get_all() 100 times | max_radios = 4 | RETURN_OK | Batch |
+* | 02 | Invoke the individual getters of every radio 100 times | radioIndex = 1..N | Same valid masks as the batch | Individual |
+*/
+void test_l2_wifi_radio_state_benchmark_vs_individual (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_radio_state_t states[WIFI_RADIO_STATE_MAX_RADIOS];
+    wifi_radio_state_t individual;
+    wifi_perf_samples_t batch_samples;
+    wifi_perf_samples_t individual_samples;
+    wifi_perf_summary_t summary;
+    ULONG count = 0;
+    int mismatches = 0;
+    char line[256];
+
+    wifi_perf_samples_init(&batch_samples, BENCH_ITERATIONS);
+    wifi_perf_samples_init(&individual_samples, BENCH_ITERATIONS);
+
+    for (int i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        uint64_t start = wifi_perf_now_ns();
+
+        UT_ASSERT_EQUAL(wifi_radio_state_get_all(states, WIFI_RADIO_STATE_MAX_RADIOS, &count), RETURN_OK);
+        wifi_perf_samples_add(&batch_samples, wifi_perf_now_ns() - start);
+    }
+    for (int i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        individual_ns = 0;
+        for (ULONG radio = 0; radio < count; radio++)
+        {
+            read_individually((INT)(radio + 1), &individual);
+            if (individual.valid != states[radio].valid)
+            {
+                mismatches++;
+            }
+        }
+        wifi_perf_samples_add(&individual_samples, individual_ns);
+    }
+
+    wifi_perf_summarize(&batch_samples, &summary);
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "batch radio state, all radios", &summary));
+    wifi_perf_summarize(&individual_samples, &summary);
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "sum of individual getters", &summary));
+    UT_LOG("%lu radios, %d getters per radio\n", (unsigned long)count, WIFI_RADIO_STATE_FIELD_MAX);
+    UT_ASSERT_EQUAL(mismatches, 0);
+
+    wifi_perf_samples_free(&batch_samples);
+    wifi_perf_samples_free(&individual_samples);
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_radio_state = NULL;
+
+/**
+ * @brief Register the batch radio state tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_radio_state_register_l2_tests (void)
+{
+    pSuite_radio_state = UT_add_suite("[L2 wifi_radio_state post-init tests]", WiFi_InitPreReq, WiFi_UnInitPosReq);
+    if (pSuite_radio_state == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_radio_state, "l2_wifi_radio_state_matches_individual_getters", test_l2_wifi_radio_state_matches_individual_getters);
+    UT_add_test(pSuite_radio_state, "l2_wifi_radio_state_all_radios", test_l2_wifi_radio_state_all_radios);
+    UT_add_test(pSuite_radio_state, "l2_wifi_radio_state_invalid_parameters", test_l2_wifi_radio_state_invalid_parameters);
+    UT_add_test(pSuite_radio_state, "l2_wifi_radio_state_benchmark_vs_individual", test_l2_wifi_radio_state_benchmark_vs_individual);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_RADIO_STATE_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
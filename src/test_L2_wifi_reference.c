@@ -0,0 +1,1112 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_REFERENCE_HALTEST_L2 RDK-V WiFi Reference HAL L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the reference HAL over wpa_supplicant :
+ *
+ * Drives the reference core (reference/include/wifi_ref.h) against the mock
+ * supplicant (reference/include/wifi_mock_supplicant.h) on a control socket in
+ * a temporary directory, the same way it drives wpa_supplicant on a device:
+ * scans, connections, statistics and WPS all go over the control interface
+ * and complete through supplicant events.
+ *
+ * The mock is backed by the HAL simulator, whose access points and timing the
+ * results are checked against. The last test checks that the control
+ * connection is opened once and reused, and logs what a wifi_getStats() round
+ * trip costs over it.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_reference.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "wifi_hal_trace.h"
+#include "wifi_mock_supplicant.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stats.h"
+#include "wifi_ref.h"
+#include "wifi_sim.h"
+
+#define REF_HANDSHAKE_MS 50
+#define REF_SCAN_DWELL_MS 5
+#define REF_WPS_RESPONSE_MS 100
+#define REF_CANCEL_MS 20
+#define REF_CALLBACK_TIMEOUT_MS 2000
+#define REF_STATS_ITERATIONS 100
+#define REF_STATS_WINDOW_MS 50
+#define REF_STATS_POLL_MS 5
+#define REF_WATCH_TIMEOUT_MS 1000
+#define REF_WATCH_QUIET_MS 100
+#define REF_REGISTRAR_PIN "12345670"
+#define REF_WRONG_PIN "00000000"
+
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t state_changed = PTHREAD_COND_INITIALIZER;
+static int connect_count = 0;
+static int disconnect_count = 0;
+static wifiStatusCode_t last_connect = WIFI_HAL_SUCCESS;
+static wifiStatusCode_t last_disconnect = WIFI_HAL_SUCCESS;
+static CHAR last_ssid[64];
+static CHAR ctrl_dir[64];
+static CHAR ctrl_path[96];
+
+static INT ref_connect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    pthread_mutex_lock(&state_lock);
+    connect_count++;
+    last_connect = *error;
+    snprintf(last_ssid, sizeof(last_ssid), "%s", AP_SSID);
+    pthread_cond_broadcast(&state_changed);
+    pthread_mutex_unlock(&state_lock);
+    return RETURN_OK;
+}
+
+static INT ref_disconnect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    pthread_mutex_lock(&state_lock);
+    disconnect_count++;
+    last_disconnect = *error;
+    pthread_cond_broadcast(&state_changed);
+    pthread_mutex_unlock(&state_lock);
+    return RETURN_OK;
+}
+
+static void reset_callback_state(void)
+{
+    pthread_mutex_lock(&state_lock);
+    connect_count = 0;
+    disconnect_count = 0;
+    last_connect = WIFI_HAL_SUCCESS;
+    last_disconnect = WIFI_HAL_SUCCESS;
+    last_ssid[0] = '\0';
+    pthread_mutex_unlock(&state_lock);
+}
+
+/* Waits for the next callback on *count, returns its status or WIFI_HAL_ERROR_TIMEOUT_EXPIRED */
+static wifiStatusCode_t wait_for_callback(int *count, wifiStatusCode_t *status)
+{
+    struct timespec deadline = wifi_perf_deadline_ms(REF_CALLBACK_TIMEOUT_MS);
+    wifiStatusCode_t result = WIFI_HAL_ERROR_TIMEOUT_EXPIRED;
+
+    pthread_mutex_lock(&state_lock);
+    while (*count == 0)
+    {
+        if (pthread_cond_timedwait(&state_changed, &state_lock, &deadline) != 0)
+        {
+            break;
+        }
+    }
+    if (*count != 0)
+    {
+        result = *status;
+    }
+    pthread_mutex_unlock(&state_lock);
+    return result;
+}
+
+static wifiStatusCode_t wait_for_connect(void)
+{
+    return wait_for_callback(&connect_count, &last_connect);
+}
+
+static wifiStatusCode_t wait_for_disconnect(void)
+{
+    return wait_for_callback(&disconnect_count, &last_disconnect);
+}
+
+/* Fresh simulator with short timings behind a mock supplicant on a temporary control socket */
+static int mock_setup(BOOL registrar_present)
+{
+    wifi_sim_timing_t timing;
+    wifi_sim_registrar_t registrar;
+
+    wifi_sim_reset();
+    wifi_sim_get_timing(&timing);
+    timing.handshake_ms = REF_HANDSHAKE_MS;
+    timing.scan_dwell_ms = REF_SCAN_DWELL_MS;
+    wifi_sim_set_timing(&timing);
+
+    wifi_sim_get_registrar(&registrar);
+    registrar.present = registrar_present;
+    registrar.pbc_response_ms = REF_WPS_RESPONSE_MS;
+    registrar.pin_response_ms = REF_WPS_RESPONSE_MS;
+    registrar.cancel_ms = REF_CANCEL_MS;
+    snprintf(registrar.pin, sizeof(registrar.pin), "%s", REF_REGISTRAR_PIN);
+    wifi_sim_set_registrar(&registrar);
+
+    snprintf(ctrl_dir, sizeof(ctrl_dir), "/tmp/wifi_ref_test_%d", (int)getpid());
+    snprintf(ctrl_path, sizeof(ctrl_path), "%s/%s", ctrl_dir, WIFI_REF_DEFAULT_INTERFACE);
+    mkdir(ctrl_dir, 0700);
+    if (wifi_mock_supplicant_start(ctrl_path) != RETURN_OK)
+    {
+        return -1;
+    }
+    wifi_ref_set_ctrl_dir(ctrl_dir);
+    reset_callback_state();
+    return 0;
+}
+
+static void mock_teardown(void)
+{
+    wifi_ref_uninit();
+    wifi_ref_connectEndpoint_callback_register(NULL);
+    wifi_ref_disconnectEndpoint_callback_register(NULL);
+    wifi_ref_set_ctrl_dir(NULL);
+    wifi_ref_set_stats_window(-1);
+    wifi_ref_set_netstats_root(NULL);
+    wifi_mock_supplicant_stop();
+    rmdir(ctrl_dir);
+    wifi_sim_reset();
+}
+
+/* Starts the mock and initialises the reference core against it */
+static int ref_setup(BOOL registrar_present)
+{
+    if (mock_setup(registrar_present) != 0)
+    {
+        return -1;
+    }
+    if (wifi_ref_init(NULL) != RETURN_OK)
+    {
+        mock_teardown();
+        return -1;
+    }
+    wifi_ref_connectEndpoint_callback_register(ref_connect_callback);
+    wifi_ref_disconnectEndpoint_callback_register(ref_disconnect_callback);
+    return 0;
+}
+
+static wifiStatusCode_t ref_connect(const char *ssid, wifiSecurityMode_t mode, const char *passphrase)
+{
+    CHAR ssid_buf[64];
+    CHAR pass_buf[64];
+    CHAR empty[1] = "";
+
+    snprintf(ssid_buf, sizeof(ssid_buf), "%s", ssid);
+    snprintf(pass_buf, sizeof(pass_buf), "%s", passphrase);
+    reset_callback_state();
+    if (wifi_ref_connectEndpoint(1, ssid_buf, mode, empty, empty, pass_buf, 1, empty, empty, empty, empty) != RETURN_OK)
+    {
+        return WIFI_HAL_UNRECOVERABLE_ERROR;
+    }
+    return wait_for_connect();
+}
+
+static const wifi_neighbor_ap_t *find_ap(const wifi_neighbor_ap_t *aps, UINT count, const char *ssid)
+{
+    for (UINT i = 0; i < count; i++)
+    {
+        if (strcmp(aps[i].ap_SSID, ssid) == 0)
+        {
+            return &aps[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+* @brief Verify requests and replies on a control connection to the mock supplicant
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Open a connection without events | on_event = NULL | Connection opened | Should be successful |
+* | 02 | Send PING | "PING" | "PONG" | Should be successful |
+* | 03 | Send an unknown command | "FROBNICATE" | "UNKNOWN COMMAND" | Should be successful |
+* | 04 | Send STATUS | "STATUS" | wpa_state=DISCONNECTED | Should be successful |
+* | 05 | Read the counters | None | 3 requests, no failures | Should be successful |
+*/
+void test_l2_wifi_reference_ctrl_request (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_ctrl_t *ctrl;
+    wifi_ctrl_stats_t stats;
+    char reply[256];
+    char value[32];
+    size_t len;
+
+    if (mock_setup(TRUE) != 0)
+    {
+        UT_FAIL_FATAL("Mock supplicant did not start");
+    }
+    ctrl = wifi_ctrl_open(ctrl_path, NULL, NULL);
+    UT_ASSERT_EQUAL(ctrl != NULL, 1);
+    if (ctrl != NULL)
+    {
+        len = sizeof(reply);
+        UT_ASSERT_EQUAL(wifi_ctrl_request(ctrl, "PING", reply, &len), 0);
+        UT_ASSERT_EQUAL(strncmp(reply, "PONG", 4), 0);
+
+        len = sizeof(reply);
+        UT_ASSERT_EQUAL(wifi_ctrl_request(ctrl, "FROBNICATE", reply, &len), 0);
+        UT_ASSERT_EQUAL(strncmp(reply, "UNKNOWN COMMAND", 15), 0);
+
+        len = sizeof(reply);
+        UT_ASSERT_EQUAL(wifi_ctrl_request(ctrl, "STATUS", reply, &len), 0);
+        UT_ASSERT_EQUAL(wifi_ctrl_get_value(reply, "wpa_state", value, sizeof(value)), 0);
+        UT_ASSERT_EQUAL(strcmp(value, "DISCONNECTED"), 0);
+
+        wifi_ctrl_get_stats(ctrl, &stats);
+        UT_LOG("requests=%llu failures=%llu\n", (unsigned long long)stats.requests, (unsigned long long)stats.failures);
+        UT_ASSERT_EQUAL(stats.requests, 3);
+        UT_ASSERT_EQUAL(stats.failures, 0);
+        wifi_ctrl_close(ctrl);
+    }
+    mock_teardown();
+
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify the radio getters and a scan through the reference core
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Read the radio getters | radioIndex = 1 | "Up", "wlan0", "2.4GHz,5GHz", the simulator channels, "US", dual band | Should be successful |
+* | 02 | Scan four channels and wait for the results | freqList = "2412 2437 2462 5180" | RETURN_OK | Should be successful |
+* | 03 | Read the neighbour results | None | The four simulated access points with their channel, signal and security | Should be successful |
+* | 04 | Look up one SSID on 2.4GHz | SSID = "SimHome-2G" | One entry on channel 6 | Should be successful |
+*/
+void test_l2_wifi_reference_scan (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_sim_radio_t radio;
+    wifi_neighbor_ap_t *aps = NULL;
+    const wifi_neighbor_ap_t *ap;
+    UINT count = 0;
+    CHAR output[512];
+
+    if (ref_setup(TRUE) != 0)
+    {
+        UT_FAIL_FATAL("Reference core did not initialise");
+    }
+    wifi_sim_get_radio(&radio);
+
+    UT_ASSERT_EQUAL(wifi_ref_getRadioStatus(1, output), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(output, "Up"), 0);
+    UT_ASSERT_EQUAL(wifi_ref_getRadioIfName(1, output), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(output, WIFI_REF_DEFAULT_INTERFACE), 0);
+    UT_ASSERT_EQUAL(wifi_ref_getRadioSupportedFrequencyBands(1, output), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(output, "2.4GHz,5GHz"), 0);
+    UT_ASSERT_EQUAL(wifi_ref_getRadioPossibleChannels(1, output), RETURN_OK);
+    UT_LOG("Possible channels: %s\n", output);
+    UT_ASSERT_EQUAL(strcmp(output, radio.possible_channels), 0);
+    UT_ASSERT_EQUAL(wifi_ref_getRegulatoryDomain(1, output), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(output, radio.regulatory_domain), 0);
+    UT_ASSERT_EQUAL(wifi_ref_getDualBandSupport(), 1);
+    /* Not associated, so no operating channel */
+    UT_ASSERT_EQUAL(wifi_ref_getRadioOperatingFrequencyBand(1, output), RETURN_ERR);
+
+    UT_ASSERT_EQUAL(wifi_ref_setRadioScanningFreqList(1, "2412 2437 2462 5180"), RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_ref_waitForScanResults(), RETURN_OK);
+
+    UT_ASSERT_EQUAL(wifi_ref_getNeighboringWiFiDiagnosticResult(1, &aps, &count), RETURN_OK);
+    UT_LOG("%u access points\n", count);
+    UT_ASSERT_EQUAL(count, 4);
+    ap = find_ap(aps, count, "SimHome");
+    UT_ASSERT_EQUAL(ap != NULL, 1);
+    if (ap != NULL)
+    {
+        UT_ASSERT_EQUAL(ap->ap_Channel, 36);
+        UT_ASSERT_EQUAL(ap->ap_SignalStrength, -48);
+        UT_ASSERT_EQUAL(strcmp(ap->ap_BSSID, "02:00:00:00:00:01"), 0);
+        UT_ASSERT_EQUAL(strcmp(ap->ap_SecurityModeEnabled, "WPA2-Personal"), 0);
+        UT_ASSERT_EQUAL(strcmp(ap->ap_EncryptionMode, "AES"), 0);
+        UT_ASSERT_EQUAL(strcmp(ap->ap_OperatingFrequencyBand, "5GHz"), 0);
+    }
+    ap = find_ap(aps, count, "SimOpen");
+    UT_ASSERT_EQUAL(ap != NULL, 1);
+    if (ap != NULL)
+    {
+        UT_ASSERT_EQUAL(ap->ap_Channel, 1);
+        UT_ASSERT_EQUAL(strcmp(ap->ap_SecurityModeEnabled, "None"), 0);
+    }
+    free(aps);
+
+    aps = NULL;
+    UT_ASSERT_EQUAL(wifi_ref_getSpecificSSIDInfo("SimHome-2G", WIFI_HAL_FREQ_BAND_24GHZ, &aps, &count), RETURN_OK);
+    UT_ASSERT_EQUAL(count, 1);
+    if (count == 1)
+    {
+        UT_ASSERT_EQUAL(aps[0].ap_Channel, 6);
+    }
+    free(aps);
+
+    mock_teardown();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify connect, statistics and disconnect through supplicant events
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 003 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Read the channel, then connect and save | SSID = "SimHome", WPA2-PSK | Channel 0, WIFI_HAL_CONNECTED | Should be successful |
+* | 02 | Read the station statistics | radioIndex = 1 | SSID, BSSID, RSSI, noise, frequency, PHY rate and security of SimHome | Should be successful |
+* | 03 | Read the channel, bandwidth and saved network | None | 36, "80MHz", SimHome with the passphrase | Should be successful |
+* | 04 | Disconnect and read the channel | SSID = "SimHome" | WIFI_HAL_DISCONNECTED on the disconnect callback, channel stays 36 | Should be successful |
+* | 05 | Connect to an SSID nobody broadcasts | SSID = "Nowhere" | WIFI_HAL_ERROR_NOT_FOUND | Should be successful |
+*/
+void test_l2_wifi_reference_connect (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_sta_stats_t sta;
+    wifi_pairedSSIDInfo_t paired;
+    ULONG channel = 0;
+    CHAR output[64];
+    CHAR ssid[16] = "SimHome";
+
+    if (ref_setup(TRUE) != 0)
+    {
+        UT_FAIL_FATAL("Reference core did not initialise");
+    }
+
+    /* No association yet, the channel reads 0 */
+    UT_ASSERT_EQUAL(wifi_ref_getRadioChannel(1, &channel), RETURN_OK);
+    UT_ASSERT_EQUAL(channel, 0);
+
+    UT_ASSERT_EQUAL(ref_connect("SimHome", WIFI_SECURITY_WPA2_PSK_AES, "simulated-passphrase"), WIFI_HAL_CONNECTED);
+    UT_ASSERT_EQUAL(strcmp(last_ssid, "SimHome"), 0);
+
+    UT_ASSERT_EQUAL(wifi_ref_getStats(1, &sta), RETURN_OK);
+    UT_LOG("SSID=%s BSSID=%s RSSI=%.0f Noise=%.0f Frequency=%u PhyRate=%.0f %s/%s\n", sta.sta_SSID, sta.sta_BSSID,
+           sta.sta_RSSI, sta.sta_Noise, sta.sta_Frequency, sta.sta_PhyRate, sta.sta_SecMode, sta.sta_Encryption);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_SSID, "SimHome"), 0);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_BSSID, "02:00:00:00:00:01"), 0);
+    UT_ASSERT_EQUAL((int)sta.sta_RSSI, -48);
+    UT_ASSERT_EQUAL((int)sta.sta_Noise, -92);
+    UT_ASSERT_EQUAL(sta.sta_Frequency, 5180);
+    UT_ASSERT_EQUAL((int)sta.sta_PhyRate, 866);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_BAND, "5GHz"), 0);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_SecMode, "WPA2-Personal"), 0);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_Encryption, "AES"), 0);
+
+    UT_ASSERT_EQUAL(wifi_ref_getRadioChannel(1, &channel), RETURN_OK);
+    UT_ASSERT_EQUAL(channel, 36);
+    UT_ASSERT_EQUAL(wifi_ref_getRadioOperatingChannelBandwidth(1, output), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(output, "80MHz"), 0);
+    UT_ASSERT_EQUAL(wifi_ref_getSSIDName(1, output), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(output, "SimHome"), 0);
+    UT_ASSERT_EQUAL(wifi_ref_lastConnected_Endpoint(&paired), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(paired.ap_ssid, "SimHome"), 0);
+    UT_ASSERT_EQUAL(strcmp(paired.ap_passphrase, "simulated-passphrase"), 0);
+    UT_ASSERT_EQUAL(strcmp(paired.ap_security, "WPA2-Personal"), 0);
+
+    reset_callback_state();
+    UT_ASSERT_EQUAL(wifi_ref_disconnectEndpoint(1, ssid), RETURN_OK);
+    UT_ASSERT_EQUAL(wait_for_disconnect(), WIFI_HAL_DISCONNECTED);
+    UT_ASSERT_EQUAL(wifi_ref_getStats(1, &sta), RETURN_OK);
+    UT_ASSERT_EQUAL(sta.sta_SSID[0], '\0');
+    UT_ASSERT_EQUAL(wifi_ref_getRadioChannel(1, &channel), RETURN_OK);
+    UT_ASSERT_EQUAL(channel, 36);
+
+    UT_ASSERT_EQUAL(ref_connect("Nowhere", WIFI_SECURITY_WPA2_PSK_AES, "simulated-passphrase"), WIFI_HAL_ERROR_NOT_FOUND);
+
+    mock_teardown();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify WPS push button, PIN and cancel through supplicant events
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 004 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Push the button | ssidIndex = 1 | WIFI_HAL_CONNECTED to the registrar SSID, saved as the last network | Should be successful |
+* | 02 | Enter a wrong PIN | EnrolleePin = "00000000" | WIFI_HAL_ERROR_INVALID_CREDENTIALS | Should be successful |
+* | 03 | Push the button without a registrar and cancel | None | RETURN_OK, a scan is accepted again once the cancel completes | Should be successful |
+*/
+void test_l2_wifi_reference_wps (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_pairedSSIDInfo_t paired;
+    CHAR pin[16] = REF_WRONG_PIN;
+    INT ret = RETURN_ERR;
+
+    if (ref_setup(TRUE) != 0)
+    {
+        UT_FAIL_FATAL("Reference core did not initialise");
+    }
+
+    reset_callback_state();
+    UT_ASSERT_EQUAL(wifi_ref_setCliWpsButtonPush(1), RETURN_OK);
+    UT_ASSERT_EQUAL(wait_for_connect(), WIFI_HAL_CONNECTED);
+    UT_ASSERT_EQUAL(strcmp(last_ssid, "SimHome"), 0);
+    UT_ASSERT_EQUAL(wifi_ref_lastConnected_Endpoint(&paired), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(paired.ap_ssid, "SimHome"), 0);
+    UT_ASSERT_EQUAL(strcmp(paired.ap_bssid, "02:00:00:00:00:01"), 0);
+
+    reset_callback_state();
+    UT_ASSERT_EQUAL(wifi_ref_setCliWpsEnrolleePin(1, pin), RETURN_OK);
+    UT_ASSERT_EQUAL(wait_for_connect(), WIFI_HAL_ERROR_INVALID_CREDENTIALS);
+    mock_teardown();
+
+    if (ref_setup(FALSE) != 0)
+    {
+        UT_FAIL_FATAL("Reference core did not initialise");
+    }
+    UT_ASSERT_EQUAL(wifi_ref_setCliWpsButtonPush(1), RETURN_OK);
+    /* The session holds the radio */
+    UT_ASSERT_EQUAL(wifi_ref_setRadioScanningFreqList(1, "2412"), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_ref_cancelWpsPairing(), RETURN_OK);
+    for (int i = 0; i < 100 && ret != RETURN_OK; i++)
+    {
+        wifi_perf_sleep_ms(REF_CANCEL_MS);
+        ret = wifi_ref_setRadioScanningFreqList(1, "2412");
+    }
+    UT_ASSERT_EQUAL(ret, RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_ref_waitForScanResults(), RETURN_OK);
+    mock_teardown();
+
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify the control connection is opened once and measure a statistics round trip
+*
+* A HAL that opens a control socket per call pays a socket setup, a bind and a PING on every
+* getter. The reference core opens one connection for requests and one for events. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 005 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Connect | SSID = "SimHome" | WIFI_HAL_CONNECTED | Should be successful |
+* | 02 | Read the statistics 100 times without the cache | radioIndex = 1, window 0 | RETURN_OK every time | Should be successful |
+* | 03 | Read the mock counters | None | Two clients, one attached | Should be successful |
+* | 04 | Read the connection counters | None | Two requests in one round trip per call, no failure, mean round trip logged | Should be successful |
+*/
+void test_l2_wifi_reference_persistent_ctrl (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_mock_supplicant_stats_t mock_stats;
+    wifi_ctrl_stats_t before;
+    wifi_ctrl_stats_t after;
+    wifi_sta_stats_t sta;
+    uint64_t start;
+    uint64_t elapsed_ns;
+    int failures = 0;
+
+    if (ref_setup(TRUE) != 0)
+    {
+        UT_FAIL_FATAL("Reference core did not initialise");
+    }
+    UT_ASSERT_EQUAL(ref_connect("SimHome", WIFI_SECURITY_WPA2_PSK_AES, "simulated-passphrase"), WIFI_HAL_CONNECTED);
+
+    /* Every call goes to the supplicant */
+    wifi_ref_set_stats_window(0);
+    wifi_ref_ctrl_stats(&before);
+    start = wifi_perf_now_ns();
+    for (int i = 0; i < REF_STATS_ITERATIONS; i++)
+    {
+        if (wifi_ref_getStats(1, &sta) != RETURN_OK || sta.sta_SSID[0] == '\0')
+        {
+            failures++;
+        }
+    }
+    elapsed_ns = wifi_perf_now_ns() - start;
+    wifi_ref_ctrl_stats(&after);
+    wifi_mock_supplicant_stats(&mock_stats);
+
+    UT_LOG("getStats: %.1f us per call, %llu requests, %.1f us per request\n",
+           (double)elapsed_ns / REF_STATS_ITERATIONS / 1000.0, (unsigned long long)(after.requests - before.requests),
+           (after.requests > before.requests)
+               ? (double)(after.request_ns - before.request_ns) / (double)(after.requests - before.requests) / 1000.0
+               : 0.0);
+    UT_LOG("mock: %llu requests from %u clients, %u attached, %llu events\n", (unsigned long long)mock_stats.requests,
+           mock_stats.clients, mock_stats.attached, (unsigned long long)mock_stats.events);
+
+    UT_ASSERT_EQUAL(failures, 0);
+    UT_ASSERT_EQUAL(after.failures, 0);
+    UT_ASSERT_EQUAL(after.requests - before.requests, 2 * REF_STATS_ITERATIONS);
+    UT_ASSERT_EQUAL(after.batches - before.batches, REF_STATS_ITERATIONS);
+    UT_ASSERT_EQUAL(mock_stats.clients, 2);
+    UT_ASSERT_EQUAL(mock_stats.attached, 1);
+
+    mock_teardown();
+    WIFI_TRACE_TEST_END();
+}
+
+/* Per-field collection, the way a HAL built from single-value getters fills wifi_sta_stats_t: one request per field */
+static int naive_get_stats(wifi_ctrl_t *ctrl, wifi_sta_stats_t *sta)
+{
+    static const struct
+    {
+        const char *cmd;
+        const char *key;
+    } fields[] = {
+        { "STATUS", "ssid" }, { "STATUS", "bssid" }, { "STATUS", "freq" }, { "STATUS", "key_mgmt" },
+        { "STATUS", "pairwise_cipher" }, { "SIGNAL_POLL", "RSSI" }, { "SIGNAL_POLL", "NOISE" },
+        { "SIGNAL_POLL", "LINKSPEED" },
+    };
+    char reply[2048];
+    char value[64];
+
+    memset(sta, 0, sizeof(*sta));
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++)
+    {
+        size_t len = sizeof(reply);
+
+        if (wifi_ctrl_request(ctrl, fields[i].cmd, reply, &len) != 0)
+        {
+            return -1;
+        }
+        if (wifi_ctrl_get_value(reply, fields[i].key, value, sizeof(value)) != 0)
+        {
+            continue;
+        }
+        switch (i)
+        {
+            case 0:
+                snprintf(sta->sta_SSID, sizeof(sta->sta_SSID), "%s", value);
+                break;
+            case 1:
+                snprintf(sta->sta_BSSID, sizeof(sta->sta_BSSID), "%s", value);
+                break;
+            case 2:
+                sta->sta_Frequency = (UINT)strtoul(value, NULL, 10);
+                snprintf(sta->sta_BAND, sizeof(sta->sta_BAND), "%s", (sta->sta_Frequency < 3000) ? "2.4GHz" : "5GHz");
+                break;
+            case 3:
+                snprintf(sta->sta_SecMode, sizeof(sta->sta_SecMode), "%s",
+                         (strcmp(value, "WPA2-PSK") == 0) ? "WPA2-Personal" : value);
+                break;
+            case 4:
+                snprintf(sta->sta_Encryption, sizeof(sta->sta_Encryption), "%s", (strcmp(value, "CCMP") == 0) ? "AES" : value);
+                break;
+            case 5:
+                sta->sta_RSSI = (FLOAT)strtol(value, NULL, 10);
+                break;
+            case 6:
+                sta->sta_Noise = (FLOAT)strtol(value, NULL, 10);
+                break;
+            default:
+                sta->sta_PhyRate = (FLOAT)strtoul(value, NULL, 10);
+                sta->sta_LastDataUplinkRate = (UINT)strtoul(value, NULL, 10) * 1000;
+                break;
+        }
+    }
+    return 0;
+}
+
+/* STATUS, then SIGNAL_POLL once its reply is in, as the core did before batching */
+static int sequential_get_stats(wifi_ctrl_t *ctrl)
+{
+    char reply[2048];
+    size_t len = sizeof(reply);
+
+    if (wifi_ctrl_request(ctrl, "STATUS", reply, &len) != 0)
+    {
+        return -1;
+    }
+    len = sizeof(reply);
+    return wifi_ctrl_request(ctrl, "SIGNAL_POLL", reply, &len);
+}
+
+static void stats_log(const char *name, wifi_perf_samples_t *samples, double round_trips)
+{
+    wifi_perf_summary_t summary;
+
+    wifi_perf_summarize(samples, &summary);
+    UT_LOG("| %-22s | %8.1f | %8.1f | %8.1f | %11.2f |\n", name, summary.p50 / 1000.0, summary.p90 / 1000.0,
+           summary.mean / 1000.0, round_trips);
+}
+
+/**
+* @brief Verify the batched, cached statistics collector and compare it with per-field queries
+*
+* wifi_getStats() needs STATUS and SIGNAL_POLL. Asking for each field separately costs eight round
+* trips to the supplicant; the collector sends both commands together and waits once, and serves the
+* result again for a short window. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 006 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Connect and read the statistics per field over a second connection | SSID = "SimHome" | Same values as the collector | Should be successful |
+* | 02 | Read the statistics repeatedly within the window | window 50 ms | One round trip, identical results | Should be successful |
+* | 03 | Disconnect, read the statistics | None | Zeroed at once, the cached result is dropped | Should be successful |
+* | 04 | Reconnect, time 100 calls per field, sequential, batched and cached polled every 5 ms | None | Per-call cost and round trips logged | Informational |
+*/
+void test_l2_wifi_reference_stats_collector (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_ctrl_t *ctrl;
+    wifi_ctrl_stats_t before;
+    wifi_ctrl_stats_t after;
+    wifi_ctrl_stats_t naive_before;
+    wifi_ctrl_stats_t naive_after;
+    wifi_sta_stats_t sta;
+    wifi_sta_stats_t naive;
+    wifi_sta_stats_t again;
+    wifi_perf_samples_t samples;
+    CHAR ssid[16] = "SimHome";
+    uint64_t start;
+    int failures = 0;
+
+    if (ref_setup(TRUE) != 0)
+    {
+        UT_FAIL_FATAL("Reference core did not initialise");
+    }
+    ctrl = wifi_ctrl_open(ctrl_path, NULL, NULL);
+    if (ctrl == NULL)
+    {
+        mock_teardown();
+        UT_FAIL_FATAL("Second control connection did not open");
+    }
+    UT_ASSERT_EQUAL(ref_connect("SimHome", WIFI_SECURITY_WPA2_PSK_AES, "simulated-passphrase"), WIFI_HAL_CONNECTED);
+
+    wifi_ref_set_stats_window(REF_STATS_WINDOW_MS);
+    UT_ASSERT_EQUAL(wifi_ref_getStats(1, &sta), RETURN_OK);
+    UT_ASSERT_EQUAL(naive_get_stats(ctrl, &naive), 0);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_SSID, naive.sta_SSID), 0);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_BSSID, naive.sta_BSSID), 0);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_BAND, naive.sta_BAND), 0);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_SecMode, naive.sta_SecMode), 0);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_Encryption, naive.sta_Encryption), 0);
+    UT_ASSERT_EQUAL(sta.sta_Frequency, naive.sta_Frequency);
+    UT_ASSERT_EQUAL((int)sta.sta_RSSI, (int)naive.sta_RSSI);
+    UT_ASSERT_EQUAL((int)sta.sta_Noise, (int)naive.sta_Noise);
+    UT_ASSERT_EQUAL((int)sta.sta_PhyRate, (int)naive.sta_PhyRate);
+    UT_ASSERT_EQUAL(sta.sta_LastDataUplinkRate, naive.sta_LastDataUplinkRate);
+
+    /* Within the window nothing is sent */
+    wifi_ref_set_stats_window(REF_STATS_WINDOW_MS);
+    wifi_ref_ctrl_stats(&before);
+    for (int i = 0; i < 10; i++)
+    {
+        UT_ASSERT_EQUAL(wifi_ref_getStats(1, &again), RETURN_OK);
+    }
+    wifi_ref_ctrl_stats(&after);
+    UT_ASSERT_EQUAL(after.batches - before.batches, 1);
+    UT_ASSERT_EQUAL(after.requests - before.requests, 2);
+    UT_ASSERT_EQUAL(memcmp(&sta, &again, sizeof(sta)), 0);
+
+    /* The disconnection event drops the cached result */
+    reset_callback_state();
+    UT_ASSERT_EQUAL(wifi_ref_disconnectEndpoint(1, ssid), RETURN_OK);
+    UT_ASSERT_EQUAL(wait_for_disconnect(), WIFI_HAL_DISCONNECTED);
+    UT_ASSERT_EQUAL(wifi_ref_getStats(1, &again), RETURN_OK);
+    UT_ASSERT_EQUAL(again.sta_SSID[0], '\0');
+    UT_ASSERT_EQUAL(ref_connect("SimHome", WIFI_SECURITY_WPA2_PSK_AES, "simulated-passphrase"), WIFI_HAL_CONNECTED);
+    UT_ASSERT_EQUAL(wifi_ref_getStats(1, &again), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(again.sta_SSID, "SimHome"), 0);
+
+    UT_LOG("| %-22s | %8s | %8s | %8s | %11s |\n", "wifi_getStats", "p50 us", "p90 us", "mean us", "round trips");
+
+    wifi_perf_samples_init(&samples, REF_STATS_ITERATIONS);
+    wifi_ctrl_get_stats(ctrl, &naive_before);
+    for (int i = 0; i < REF_STATS_ITERATIONS; i++)
+    {
+        start = wifi_perf_now_ns();
+        failures += (naive_get_stats(ctrl, &naive) != 0);
+        wifi_perf_samples_add(&samples, wifi_perf_now_ns() - start);
+    }
+    wifi_ctrl_get_stats(ctrl, &naive_after);
+    stats_log("per field", &samples, (double)(naive_after.batches - naive_before.batches) / REF_STATS_ITERATIONS);
+    wifi_perf_samples_clear(&samples);
+
+    wifi_ctrl_get_stats(ctrl, &naive_before);
+    for (int i = 0; i < REF_STATS_ITERATIONS; i++)
+    {
+        start = wifi_perf_now_ns();
+        failures += (sequential_get_stats(ctrl) != 0);
+        wifi_perf_samples_add(&samples, wifi_perf_now_ns() - start);
+    }
+    wifi_ctrl_get_stats(ctrl, &naive_after);
+    stats_log("STATUS, SIGNAL_POLL", &samples, (double)(naive_after.batches - naive_before.batches) / REF_STATS_ITERATIONS);
+    wifi_perf_samples_clear(&samples);
+
+    wifi_ref_set_stats_window(0);
+    wifi_ref_ctrl_stats(&before);
+    for (int i = 0; i < REF_STATS_ITERATIONS; i++)
+    {
+        start = wifi_perf_now_ns();
+        failures += (wifi_ref_getStats(1, &sta) != RETURN_OK);
+        wifi_perf_samples_add(&samples, wifi_perf_now_ns() - start);
+    }
+    wifi_ref_ctrl_stats(&after);
+    stats_log("batched", &samples, (double)(after.batches - before.batches) / REF_STATS_ITERATIONS);
+    UT_ASSERT_EQUAL(after.batches - before.batches, REF_STATS_ITERATIONS);
+    wifi_perf_samples_clear(&samples);
+
+    /* A poller at 200 Hz sees one collection per window */
+    wifi_ref_set_stats_window(REF_STATS_WINDOW_MS);
+    wifi_ref_ctrl_stats(&before);
+    for (int i = 0; i < REF_STATS_ITERATIONS; i++)
+    {
+        start = wifi_perf_now_ns();
+        failures += (wifi_ref_getStats(1, &sta) != RETURN_OK);
+        wifi_perf_samples_add(&samples, wifi_perf_now_ns() - start);
+        wifi_perf_sleep_ms(REF_STATS_POLL_MS);
+    }
+    wifi_ref_ctrl_stats(&after);
+    stats_log("batched, 50 ms window", &samples, (double)(after.batches - before.batches) / REF_STATS_ITERATIONS);
+    UT_ASSERT_EQUAL(after.batches - before.batches < REF_STATS_ITERATIONS / 2, 1);
+    wifi_perf_samples_free(&samples);
+
+    UT_ASSERT_EQUAL(failures, 0);
+    UT_ASSERT_EQUAL(after.failures, 0);
+
+    wifi_ctrl_close(ctrl);
+    mock_teardown();
+    WIFI_TRACE_TEST_END();
+}
+
+static const char *const netstats_dirs[] = { "sys", "sys/class", "sys/class/net", "sys/class/net/wlan0",
+                                             "sys/class/net/wlan0/statistics" };
+static const char *const netstats_files[] = { "rx_bytes", "tx_bytes", "rx_packets", "tx_packets", "multicast" };
+
+static int netstats_write(const char *root, const char *name, unsigned long long value)
+{
+    char path[160];
+    FILE *fp;
+
+    snprintf(path, sizeof(path), "%s/sys/class/net/wlan0/statistics/%s", root, name);
+    /* "w" truncates the same file, which the core has open */
+    fp = fopen(path, "w");
+    if (fp == NULL)
+    {
+        return -1;
+    }
+    fprintf(fp, "%llu\n", value);
+    return fclose(fp);
+}
+
+static void netstats_remove(const char *root)
+{
+    char path[160];
+
+    for (size_t i = 0; i < sizeof(netstats_files) / sizeof(netstats_files[0]); i++)
+    {
+        snprintf(path, sizeof(path), "%s/sys/class/net/wlan0/statistics/%s", root, netstats_files[i]);
+        unlink(path);
+    }
+    for (size_t i = sizeof(netstats_dirs) / sizeof(netstats_dirs[0]); i > 0; i--)
+    {
+        snprintf(path, sizeof(path), "%s/%s", root, netstats_dirs[i - 1]);
+        rmdir(path);
+    }
+    rmdir(root);
+}
+
+/**
+* @brief Verify the traffic getters of the reference core on a fake sysfs tree
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 007 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Read the traffic statistics before initialisation | radioIndex = 1, ssidIndex = 1 | RETURN_ERR | Should be successful |
+* | 02 | Initialise with a root that has no wlan0 | Empty directory | RETURN_ERR from both getters | Should be successful |
+* | 03 | Initialise with a fake sysfs wlan0 and read both | 5 counters | RETURN_OK, counters mapped | Should be successful |
+* | 04 | Rewrite a counter and read again | rx_bytes = 9000000000 | New value | Should be successful |
+* | 05 | Read with invalid indices or NULL | radioIndex = 2, ssidIndex = 0 | RETURN_ERR | Should be successful |
+*/
+void test_l2_wifi_reference_traffic_stats (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_radioTrafficStats_t radio;
+    wifi_ssidTrafficStats_t ssid;
+    char root[64];
+    char path[160];
+    int ret = 0;
+
+    UT_ASSERT_EQUAL(wifi_ref_getRadioTrafficStats(1, &radio), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_ref_getSSIDTrafficStats(1, &ssid), RETURN_ERR);
+
+    snprintf(root, sizeof(root), "/tmp/wifi_ref_netstats_%d", (int)getpid());
+    mkdir(root, 0700);
+    wifi_ref_set_netstats_root(root);
+    if (ref_setup(TRUE) != 0)
+    {
+        rmdir(root);
+        UT_FAIL_FATAL("Reference core did not initialise");
+    }
+    UT_ASSERT_EQUAL(wifi_ref_getRadioTrafficStats(1, &radio), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_ref_getSSIDTrafficStats(1, &ssid), RETURN_ERR);
+    mock_teardown();
+
+    for (size_t i = 0; i < sizeof(netstats_dirs) / sizeof(netstats_dirs[0]); i++)
+    {
+        snprintf(path, sizeof(path), "%s/%s", root, netstats_dirs[i]);
+        mkdir(path, 0700);
+    }
+    ret |= netstats_write(root, "rx_bytes", 4000000000ULL);
+    ret |= netstats_write(root, "tx_bytes", 2000000ULL);
+    ret |= netstats_write(root, "rx_packets", 3000000ULL);
+    ret |= netstats_write(root, "tx_packets", 1500ULL);
+    ret |= netstats_write(root, "multicast", 1000000ULL);
+    if (ret != 0)
+    {
+        netstats_remove(root);
+        UT_FAIL_FATAL("Cannot build the fake sysfs tree");
+    }
+
+    wifi_ref_set_netstats_root(root);
+    if (ref_setup(TRUE) != 0)
+    {
+        netstats_remove(root);
+        UT_FAIL_FATAL("Reference core did not initialise");
+    }
+    UT_ASSERT_EQUAL(wifi_ref_getRadioTrafficStats(1, &radio), RETURN_OK);
+    UT_ASSERT_EQUAL(radio.radio_BytesReceived, 4000000000UL);
+    UT_ASSERT_EQUAL(radio.radio_BytesSent, 2000000);
+    UT_ASSERT_EQUAL(radio.radio_PacketsReceived, 3000000);
+    UT_ASSERT_EQUAL(radio.radio_PacketsSent, 1500);
+    UT_ASSERT_EQUAL(radio.radio_ErrorsReceived, 0);
+
+    UT_ASSERT_EQUAL(wifi_ref_getSSIDTrafficStats(1, &ssid), RETURN_OK);
+    UT_ASSERT_EQUAL(ssid.ssid_BytesReceived, 4000000000UL);
+    UT_ASSERT_EQUAL(ssid.ssid_MulticastPacketsReceived, 1000000);
+    UT_ASSERT_EQUAL(ssid.ssid_UnicastPacketsReceived, 2000000);
+
+    UT_ASSERT_EQUAL(netstats_write(root, "rx_bytes", 9000000000ULL), 0);
+    UT_ASSERT_EQUAL(wifi_ref_getRadioTrafficStats(1, &radio), RETURN_OK);
+    UT_ASSERT_EQUAL(radio.radio_BytesReceived, (ULONG)9000000000ULL);
+
+    UT_ASSERT_EQUAL(wifi_ref_getRadioTrafficStats(2, &radio), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_ref_getRadioTrafficStats(1, NULL), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_ref_getSSIDTrafficStats(0, &ssid), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_ref_getSSIDTrafficStats(1, NULL), RETURN_ERR);
+
+    mock_teardown();
+    netstats_remove(root);
+    WIFI_TRACE_TEST_END();
+}
+
+/* Waits for the watcher to become readable and returns its changes, 0 on timeout */
+static UINT watch_wait(INT fd, int timeout_ms)
+{
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+
+    if (poll(&pfd, 1, timeout_ms) != 1)
+    {
+        return 0;
+    }
+    return wifi_ref_watch_read(fd);
+}
+
+/* Leaves SimHome as the only access point of the simulator, at the given signal */
+static void watch_set_signal(INT rssi)
+{
+    wifi_neighbor_ap_t ap;
+
+    memset(&ap, 0, sizeof(ap));
+    snprintf(ap.ap_SSID, sizeof(ap.ap_SSID), "SimHome");
+    snprintf(ap.ap_BSSID, sizeof(ap.ap_BSSID), "02:00:00:00:00:01");
+    snprintf(ap.ap_SecurityModeEnabled, sizeof(ap.ap_SecurityModeEnabled), "WPA2-Personal");
+    ap.ap_Channel = 36;
+    ap.ap_SignalStrength = rssi;
+    ap.ap_Noise = -92;
+    wifi_sim_set_aps(&ap, 1);
+}
+
+/**
+* @brief Verify that supplicant events wake the change watchers of the reference core
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 008 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Open a watcher for all changes, initialise | None | STATUS | Should be successful |
+* | 02 | Connect to SimHome | WPA2-PSK | CONNECTION | Should be successful |
+* | 03 | Change the signal of SimHome in the simulator | -48 to -65 dBm | RSSI, from CTRL-EVENT-SIGNAL-CHANGE | Should be successful |
+* | 04 | Move the signal within its bucket, then out of it | -67, then -75 dBm | Not woken, then RSSI | Should be successful |
+* | 05 | Change the channel in the simulator | 40 | CHANNEL, from CTRL-EVENT-CHANNEL-SWITCH | Should be successful |
+* | 06 | Bring the reference core down | None | STATUS | Should be successful |
+*/
+void test_l2_wifi_reference_change_watch (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_sim_radio_t radio;
+    INT fd;
+
+    UT_ASSERT_EQUAL(wifi_ref_watch_open(0), -1);
+    fd = wifi_ref_watch_open(WIFI_REF_CHANGE_ALL);
+    if (fd < 0)
+    {
+        UT_FAIL_FATAL("wifi_ref_watch_open failed");
+    }
+    if (ref_setup(TRUE) != 0)
+    {
+        wifi_ref_watch_close(fd);
+        UT_FAIL_FATAL("Reference core did not initialise");
+    }
+    UT_ASSERT_EQUAL(watch_wait(fd, 0), WIFI_REF_CHANGE_STATUS);
+
+    UT_ASSERT_EQUAL(ref_connect("SimHome", WIFI_SECURITY_WPA2_PSK_AES, "simulated-passphrase"), WIFI_HAL_CONNECTED);
+    UT_ASSERT_TRUE((watch_wait(fd, 0) & WIFI_REF_CHANGE_CONNECTION) != 0);
+
+    watch_set_signal(-65);
+    UT_ASSERT_EQUAL(watch_wait(fd, REF_WATCH_TIMEOUT_MS), WIFI_REF_CHANGE_RSSI);
+    watch_set_signal(-67);
+    UT_ASSERT_EQUAL(watch_wait(fd, REF_WATCH_QUIET_MS), 0);
+    watch_set_signal(-75);
+    UT_ASSERT_EQUAL(watch_wait(fd, REF_WATCH_TIMEOUT_MS), WIFI_REF_CHANGE_RSSI);
+
+    wifi_sim_get_radio(&radio);
+    radio.channel = 40;
+    wifi_sim_set_radio(&radio);
+    UT_ASSERT_EQUAL(watch_wait(fd, REF_WATCH_TIMEOUT_MS), WIFI_REF_CHANGE_CHANNEL);
+
+    UT_ASSERT_EQUAL(wifi_ref_down(), RETURN_OK);
+    UT_ASSERT_TRUE((watch_wait(fd, 0) & WIFI_REF_CHANGE_STATUS) != 0);
+
+    mock_teardown();
+    wifi_ref_watch_close(fd);
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_reference = NULL;
+
+/**
+ * @brief Register the reference HAL tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_reference_register_l2_tests (void)
+{
+    pSuite_reference = UT_add_suite("[L2 wifi_reference tests]", NULL, NULL);
+    if (pSuite_reference == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_reference, "l2_wifi_reference_ctrl_request", test_l2_wifi_reference_ctrl_request);
+    UT_add_test(pSuite_reference, "l2_wifi_reference_scan", test_l2_wifi_reference_scan);
+    UT_add_test(pSuite_reference, "l2_wifi_reference_connect", test_l2_wifi_reference_connect);
+    UT_add_test(pSuite_reference, "l2_wifi_reference_wps", test_l2_wifi_reference_wps);
+    UT_add_test(pSuite_reference, "l2_wifi_reference_persistent_ctrl", test_l2_wifi_reference_persistent_ctrl);
+    UT_add_test(pSuite_reference, "l2_wifi_reference_stats_collector", test_l2_wifi_reference_stats_collector);
+    UT_add_test(pSuite_reference, "l2_wifi_reference_traffic_stats", test_l2_wifi_reference_traffic_stats);
+    UT_add_test(pSuite_reference, "l2_wifi_reference_change_watch", test_l2_wifi_reference_change_watch);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_REFERENCE_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,501 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_ROAMING_HALTEST_L2 RDK-V WiFi Roaming Handoff L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for roaming handoff latency :
+ *
+ * Walks a simulated station from one access point of an SSID to another
+ * (simulator/include/wifi_sim.h RF model, with fading) once per
+ * wifi_roamingCtrl_t configuration, and compares per handoff:
+ *
+ * - detection: the second access point becoming the stronger to the trigger of the roam that reaches it
+ * - scan: the roam scan over the channels of the SSID
+ * - reassociation: leaving the first access point to associating with the second
+ * - outage: time without a link over the whole walk, roams and lost links alike
+ *
+ * A station that does not roam in time loses its link at the edge of the
+ * first access point's range and, like a client, scans and reconnects.
+ *
+ * The seconds of the roaming control run 100 times faster so a walk takes
+ * about 1.5 s. Scan dwell and handshake keep their real durations.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_roaming.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stats.h"
+#include "wifi_sim.h"
+
+#define ROAM_HANDSHAKE_MS 80
+#define ROAM_SCAN_DWELL_MS 20
+#define ROAM_SLACK_MS 15
+#define ROAM_SECOND_MS 10
+#define ROAM_WALK_MS 1500
+#define ROAM_SETTLE_MS 300
+#define ROAM_POLL_MS 5
+#define ROAM_RUNS 3
+#define ROAM_MAX_SAMPLES 64
+#define ROAM_TIMEOUT_MS 2000
+#define ROAM_NEAR_BSSID "02:00:00:00:00:01"
+#define ROAM_FAR_BSSID "02:00:00:00:00:05"
+#define ROAM_FREQS "5180 5745"
+
+/**
+ * @brief One roaming configuration of the comparison
+ */
+typedef struct
+{
+    const char *name;
+    wifi_roamingCtrl_t ctrl;
+} roam_config_t;
+
+/**
+ * @brief Results of one configuration over all its walks
+ */
+typedef struct
+{
+    ULONG roams;
+    ULONG failed;
+    ULONG links_lost;
+    wifi_perf_samples_t detection;
+    wifi_perf_samples_t scan;
+    wifi_perf_samples_t reassociation;
+    wifi_perf_samples_t outage;          /*!< One sample per walk */
+} roam_result_t;
+
+static const roam_config_t configs[] = {
+    { "disabled",   { .roamingEnable = 0 } },
+    { "L1 values",  { .roamingEnable = 1, .postAssnSelfSteerThreshold = -75, .postAssnSelfSteerTimeframe = 60,
+                      .postAssnLevelDeltaConnected = 12, .postAssnBackOffTime = 2 } },
+    { "aggressive", { .roamingEnable = 1, .postAssnSelfSteerThreshold = -65, .postAssnSelfSteerTimeframe = 1,
+                      .postAssnLevelDeltaConnected = 3, .postAssnBackOffTime = 1 } },
+    { "balanced",   { .roamingEnable = 1, .postAssnSelfSteerThreshold = -72, .postAssnSelfSteerTimeframe = 5,
+                      .postAssnLevelDeltaConnected = 6, .postAssnBackOffTime = 5 } },
+    { "sticky",     { .roamingEnable = 1, .postAssnSelfSteerThreshold = -80, .postAssnSelfSteerTimeframe = 10,
+                      .postAssnLevelDeltaConnected = 10, .postAssnBackOffTime = 10 } },
+};
+
+#define ROAM_CONFIGS (sizeof(configs) / sizeof(configs[0]))
+
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t state_changed = PTHREAD_COND_INITIALIZER;
+static int connect_count = 0;
+static wifiStatusCode_t last_status = WIFI_HAL_SUCCESS;
+static uint64_t last_callback_ns = 0;
+static uint64_t lost_ns = 0;                 /*!< Link lost and not recovered yet, 0 otherwise */
+
+static INT roam_connect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    uint64_t now = wifi_perf_now_ns();
+
+    pthread_mutex_lock(&state_lock);
+    connect_count++;
+    last_status = *error;
+    last_callback_ns = now;
+    if (*error == WIFI_HAL_ERROR_CONNECTION_LOST)
+    {
+        lost_ns = now;
+    }
+    pthread_cond_broadcast(&state_changed);
+    pthread_mutex_unlock(&state_lock);
+    return RETURN_OK;
+}
+
+static int roam_connect_count(void)
+{
+    int count;
+
+    pthread_mutex_lock(&state_lock);
+    count = connect_count;
+    pthread_mutex_unlock(&state_lock);
+    return count;
+}
+
+/* Waits for the connect callback to have run count times, returns its last status or WIFI_HAL_ERROR_UNKNOWN on timeout */
+static wifiStatusCode_t roam_wait_connect(int count, uint64_t *when)
+{
+    struct timespec deadline;
+    wifiStatusCode_t status;
+    int ret = 0;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += ROAM_TIMEOUT_MS / 1000;
+    pthread_mutex_lock(&state_lock);
+    while (connect_count < count && ret == 0)
+    {
+        ret = pthread_cond_timedwait(&state_changed, &state_lock, &deadline);
+    }
+    status = (connect_count >= count) ? last_status : WIFI_HAL_ERROR_UNKNOWN;
+    *when = last_callback_ns;
+    pthread_mutex_unlock(&state_lock);
+    return status;
+}
+
+static INT roam_connect(void)
+{
+    CHAR ssid[] = "SimHome";
+    CHAR passphrase[] = "simulated-passphrase";
+    CHAR empty[1] = "";
+
+    return wifi_sim_connectEndpoint(1, ssid, WIFI_SECURITY_WPA2_PSK_AES, empty, empty, passphrase, 0, empty, empty,
+                                    empty, empty);
+}
+
+/* Connects as a client would after losing the link: scan, then associate. Returns the time of the connect callback */
+static uint64_t roam_reconnect(void)
+{
+    uint64_t when = 0;
+
+    for (int attempt = 0; attempt < 10; attempt++)
+    {
+        int before = roam_connect_count();
+
+        wifi_sim_setRadioScanningFreqList(1, ROAM_FREQS);
+        wifi_sim_waitForScanResults();
+        if (roam_connect() == RETURN_OK && roam_wait_connect(before + 1, &when) == WIFI_HAL_CONNECTED)
+        {
+            return when;
+        }
+    }
+    return 0;
+}
+
+/* TRUE once the far access point is heard stronger than the near one, or the near one is not heard */
+static BOOL roam_far_stronger(void)
+{
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT count = 0;
+    INT near = -1000;
+    INT far = -1000;
+
+    if (wifi_sim_getNeighboringWiFiDiagnosticResult(1, &aps, &count) != RETURN_OK)
+    {
+        return FALSE;
+    }
+    for (UINT i = 0; i < count; i++)
+    {
+        if (strcmp(aps[i].ap_BSSID, ROAM_NEAR_BSSID) == 0)
+        {
+            near = aps[i].ap_SignalStrength;
+        }
+        else if (strcmp(aps[i].ap_BSSID, ROAM_FAR_BSSID) == 0)
+        {
+            far = aps[i].ap_SignalStrength;
+        }
+    }
+    free(aps);
+    return (far > -1000 && far > near) ? TRUE : FALSE;
+}
+
+/*
+ * Corridor of 62 m with SimHome at each end, channel 36 and 149. 20 dBm,
+ * exponent 4: the near access point is lost below -90 dBm past 56 m, the far
+ * one is heard from 6 m on, and they are equal at 31 m.
+ */
+static void roam_setup(UINT seed)
+{
+    wifi_sim_timing_t timing;
+    wifi_neighbor_ap_t *aps = NULL;
+    wifi_neighbor_ap_t population[5];
+    wifi_sim_rf_t rf;
+    UINT count = 0;
+
+    wifi_sim_reset();
+    wifi_sim_get_timing(&timing);
+    timing.handshake_ms = ROAM_HANDSHAKE_MS;
+    timing.scan_dwell_ms = ROAM_SCAN_DWELL_MS;
+    wifi_sim_set_timing(&timing);
+    wifi_sim_init(NULL);
+    wifi_sim_connectEndpoint_callback_register(roam_connect_callback);
+
+    wifi_sim_getNeighboringWiFiDiagnosticResult(1, &aps, &count);
+    memcpy(population, aps, 4 * sizeof(*aps));
+    free(aps);
+    population[4] = population[0];
+    snprintf(population[4].ap_BSSID, sizeof(population[4].ap_BSSID), "%s", ROAM_FAR_BSSID);
+    population[4].ap_Channel = 149;
+    wifi_sim_set_aps(population, 5);
+
+    wifi_sim_get_rf(&rf);
+    rf.enable = TRUE;
+    rf.realtime = TRUE;
+    rf.tick_ms = 10;
+    rf.seed = seed;
+    rf.fading_sigma_db = 2.0;
+    rf.fading_correlation = 0.9;
+    rf.roam_second_ms = ROAM_SECOND_MS;
+    rf.ref_loss_db = 40.0;
+    rf.path_loss_exponent = 4.0;
+    rf.sensitivity_dbm = -90;
+    rf.ap_count = 2;
+    memset(rf.aps, 0, 2 * sizeof(rf.aps[0]));
+    snprintf(rf.aps[0].bssid, sizeof(rf.aps[0].bssid), "%s", ROAM_NEAR_BSSID);
+    snprintf(rf.aps[1].bssid, sizeof(rf.aps[1].bssid), "%s", ROAM_FAR_BSSID);
+    rf.aps[1].x_m = 62.0;
+    rf.aps[0].tx_power_dbm = 20;
+    rf.aps[1].tx_power_dbm = 20;
+    rf.aps[0].utilization = 30;
+    rf.aps[1].utilization = 30;
+    rf.waypoint_count = 2;
+    rf.path[0].t_ms = 0;
+    rf.path[0].x_m = 3.0;
+    rf.path[0].y_m = 0.0;
+    rf.path[1].t_ms = ROAM_WALK_MS;
+    rf.path[1].x_m = 60.0;
+    rf.path[1].y_m = 0.0;
+    wifi_sim_set_rf(&rf);
+
+    pthread_mutex_lock(&state_lock);
+    connect_count = 0;
+    last_status = WIFI_HAL_SUCCESS;
+    lost_ns = 0;
+    pthread_mutex_unlock(&state_lock);
+}
+
+/* One walk with a configuration, adds its handoffs and outage to the result */
+static void roam_walk(const roam_config_t *config, UINT seed, roam_result_t *result)
+{
+    wifi_roamingCtrl_t ctrl = config->ctrl;
+    wifi_sim_roam_t roam;
+    uint64_t start;
+    uint64_t crossover_ns = 0;
+    uint64_t outage_ns = 0;
+    uint64_t connected_ns;
+    ULONG seen = 0;
+
+    roam_setup(seed);
+    wifi_sim_setRoamingControl(1, &ctrl);
+    UT_ASSERT_EQUAL(roam_connect(), RETURN_OK);
+    UT_ASSERT_EQUAL(roam_wait_connect(1, &connected_ns), WIFI_HAL_CONNECTED);
+
+    start = wifi_perf_now_ns();
+    while (wifi_perf_now_ns() - start < (ROAM_WALK_MS + ROAM_SETTLE_MS) * 1000000ULL)
+    {
+        uint64_t lost;
+
+        if (crossover_ns == 0 && roam_far_stronger())
+        {
+            crossover_ns = wifi_perf_now_ns();
+        }
+
+        wifi_sim_get_roam(&roam);
+        if (roam.roams > seen)
+        {
+            seen = roam.roams;
+            if (crossover_ns != 0 && roam.triggered_ns >= crossover_ns && strcmp(roam.to_bssid, ROAM_FAR_BSSID) == 0)
+            {
+                wifi_perf_samples_add(&result->detection, roam.triggered_ns - crossover_ns);
+            }
+            wifi_perf_samples_add(&result->scan, roam.scanned_ns - roam.triggered_ns);
+            wifi_perf_samples_add(&result->reassociation, roam.connected_ns - roam.scanned_ns);
+            outage_ns += roam.connected_ns - roam.scanned_ns;
+        }
+
+        pthread_mutex_lock(&state_lock);
+        lost = lost_ns;
+        lost_ns = 0;
+        pthread_mutex_unlock(&state_lock);
+        if (lost != 0)
+        {
+            connected_ns = roam_reconnect();
+            UT_ASSERT_TRUE(connected_ns != 0);
+            outage_ns += (connected_ns != 0) ? connected_ns - lost : wifi_perf_now_ns() - lost;
+        }
+        wifi_perf_sleep_ms(ROAM_POLL_MS);
+    }
+
+    wifi_sim_get_roam(&roam);
+    result->roams += roam.roams;
+    result->failed += roam.failed;
+    result->links_lost += roam.links_lost;
+    wifi_perf_samples_add(&result->outage, outage_ns);
+}
+
+static void roam_cell(char *buf, size_t size, wifi_perf_samples_t *set)
+{
+    wifi_perf_summary_t summary;
+
+    if (set->count == 0)
+    {
+        snprintf(buf, size, "%s", "-");
+        return;
+    }
+    wifi_perf_summarize(set, &summary);
+    snprintf(buf, size, "%.1f", summary.p50 / 1e6);
+}
+
+/**
+* @brief Compare handoff latency and outage of roaming configurations on a walk between two access points
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Walk 3 m to 60 m between two SimHome access points 62 m apart, 3 seeds per configuration | disabled, L1 values, aggressive, balanced, sticky | None | Should be successful |
+* | 02 | Check every handoff | 2 channel roam scan, 80 ms handshake | Scan and reassociation within 15 ms of the model | Should be successful |
+* | 03 | Check the configuration without roaming | disabled | No roam, the link is lost every walk | Should be successful |
+* | 04 | Check the balanced configuration | -72 dBm for 5 s, 6 dB, 5 s back-off | Roams every walk without losing the link, less outage than without roaming | Should be successful |
+* | 05 | Log the comparison table | p50 over all handoffs, outage p50 per walk | None | Should be successful |
+*/
+void test_l2_wifi_roaming_handoff (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    roam_result_t results[ROAM_CONFIGS];
+    wifi_perf_summary_t outage[ROAM_CONFIGS];
+
+    memset(results, 0, sizeof(results));
+    for (size_t c = 0; c < ROAM_CONFIGS; c++)
+    {
+        roam_result_t *r = &results[c];
+
+        if (wifi_perf_samples_init(&r->detection, ROAM_MAX_SAMPLES) != 0 ||
+            wifi_perf_samples_init(&r->scan, ROAM_MAX_SAMPLES) != 0 ||
+            wifi_perf_samples_init(&r->reassociation, ROAM_MAX_SAMPLES) != 0 ||
+            wifi_perf_samples_init(&r->outage, ROAM_RUNS) != 0)
+        {
+            UT_FAIL_FATAL("Cannot allocate samples");
+        }
+        for (UINT seed = 1; seed <= ROAM_RUNS; seed++)
+        {
+            roam_walk(&configs[c], seed, r);
+        }
+        wifi_perf_summarize(&r->outage, &outage[c]);
+    }
+
+    UT_LOG("\n| %-10s | threshold | timeframe s | delta | back-off s | roams | failed scans | links lost | detection ms | scan ms | reassoc ms | outage ms |\n",
+           "config");
+    for (size_t c = 0; c < ROAM_CONFIGS; c++)
+    {
+        const wifi_roamingCtrl_t *ctrl = &configs[c].ctrl;
+        roam_result_t *r = &results[c];
+        char detection[16];
+        char scan[16];
+        char reassociation[16];
+
+        roam_cell(detection, sizeof(detection), &r->detection);
+        roam_cell(scan, sizeof(scan), &r->scan);
+        roam_cell(reassociation, sizeof(reassociation), &r->reassociation);
+        UT_LOG("| %-10s | %9d | %11d | %5d | %10d | %5lu | %12lu | %10lu | %12s | %7s | %10s | %9.1f |\n",
+               configs[c].name, ctrl->postAssnSelfSteerThreshold, ctrl->postAssnSelfSteerTimeframe,
+               ctrl->postAssnLevelDeltaConnected, ctrl->postAssnBackOffTime, r->roams, r->failed, r->links_lost,
+               detection, scan, reassociation, outage[c].p50 / 1e6);
+
+        for (size_t i = 0; i < r->scan.count; i++)
+        {
+            UT_ASSERT_TRUE(r->scan.samples[i] >= 2 * ROAM_SCAN_DWELL_MS * 1000000ULL);
+            UT_ASSERT_TRUE(r->scan.samples[i] <= (2 * ROAM_SCAN_DWELL_MS + ROAM_SLACK_MS) * 1000000ULL);
+        }
+        for (size_t i = 0; i < r->reassociation.count; i++)
+        {
+            UT_ASSERT_TRUE(r->reassociation.samples[i] >= ROAM_HANDSHAKE_MS * 1000000ULL);
+            UT_ASSERT_TRUE(r->reassociation.samples[i] <= (ROAM_HANDSHAKE_MS + ROAM_SLACK_MS) * 1000000ULL);
+        }
+    }
+
+    UT_ASSERT_EQUAL(results[0].roams, 0);
+    UT_ASSERT_TRUE(results[0].links_lost >= ROAM_RUNS);
+    UT_ASSERT_TRUE(results[3].roams >= ROAM_RUNS);
+    UT_ASSERT_EQUAL(results[3].links_lost, 0);
+    UT_ASSERT_TRUE(outage[3].p50 < outage[0].p50);
+
+    for (size_t c = 0; c < ROAM_CONFIGS; c++)
+    {
+        wifi_perf_samples_free(&results[c].detection);
+        wifi_perf_samples_free(&results[c].scan);
+        wifi_perf_samples_free(&results[c].reassociation);
+        wifi_perf_samples_free(&results[c].outage);
+    }
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_roaming = NULL;
+
+/**
+ * @brief Register the roaming handoff tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_roaming_register_l2_tests (void)
+{
+    pSuite_roaming = UT_add_suite("[L2 wifi_roaming tests]", NULL, NULL);
+    if (pSuite_roaming == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_roaming, "l2_wifi_roaming_handoff", test_l2_wifi_roaming_handoff);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_ROAMING_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,318 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_RUSAGE_HALTEST_L2 RDK-V WiFi System Cost L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the system cost of HAL calls :
+ *
+ * Reports what each read-only getter costs the system beyond wall time: context switches, user
+ * and system CPU time, page faults and, where perf_event_open() is permitted, cycles,
+ * instructions and cache misses (wifi_hal_rusage.h).
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_rusage.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+#include "wifi_common_hal.h"
+#include "wifi_hal_api.h"
+#include "wifi_hal_rusage.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_probe.h"
+
+#define HAL_ITERATIONS 20
+#define SLEEP_COUNT 3
+#define SLEEP_MS 5
+#define SPIN_MS 30
+#define SPIN_MIN_MS 20
+#define TOUCH_BYTES (1024 * 1024)
+#define TOUCH_MIN_FAULTS 128
+
+extern int WiFi_InitPreReq(void);
+extern int WiFi_UnInitPosReq(void);
+extern const int RADIO_INDEX;
+extern const int SSID_INDEX;
+
+static const char *counter_modes[] = { "not available", "user space only", "user space and kernel" };
+
+static uint64_t thread_cpu_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * WIFI_PERF_NS_PER_SEC + (uint64_t)ts.tv_nsec;
+}
+
+/* Burns CPU on the calling thread until it has used ms of it */
+static void spin_cpu_ms(unsigned ms)
+{
+    uint64_t end = thread_cpu_ns() + (uint64_t)ms * WIFI_PERF_NS_PER_MS;
+    volatile uint64_t sink = 0;
+
+    while (thread_cpu_ns() < end)
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            sink += (uint64_t)i;
+        }
+    }
+}
+
+/* Maps fresh anonymous memory and touches every page, one minor fault each */
+static void touch_pages(size_t bytes)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    volatile char *mem = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (mem == MAP_FAILED)
+    {
+        return;
+    }
+    for (size_t offset = 0; offset < bytes; offset += (size_t)page)
+    {
+        mem[offset] = 1;
+    }
+    munmap((void *)mem, bytes);
+}
+
+static void rusage_log(wifi_hal_api_t api, const wifi_rusage_stats_t *stats)
+{
+    double calls = (stats->calls > 0) ? (double)stats->calls : 1.0;
+    double counted = (stats->counted_calls > 0) ? (double)stats->counted_calls : 1.0;
+
+    UT_LOG("%-40s calls=%llu per call: vol_cs=%.2f invol_cs=%.2f user=%.2fus sys=%.2fus minflt=%.2f majflt=%.2f cycles=%.0f instr=%.0f llc_miss=%.1f\n",
+           wifi_hal_api_name(api), (unsigned long long)stats->calls, stats->voluntary_switches / calls,
+           stats->involuntary_switches / calls, stats->user_ns / calls / WIFI_PERF_NS_PER_US,
+           stats->system_ns / calls / WIFI_PERF_NS_PER_US, stats->minor_faults / calls, stats->major_faults / calls,
+           stats->cycles / counted, stats->instructions / counted, stats->cache_misses / counted);
+}
+
+/**
+* @brief Verify the system cost accounting against known workloads
+*
+* Runs a sleeping, a CPU bound and a page touching workload between explicit call markers and
+* checks what is charged to each API. Skipped while WIFI_HAL_RUSAGE=1 accounts the whole run, as
+* the markers would charge made-up work to real APIs. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Sleep three times inside a call | 5 ms each | At least 3 voluntary context switches | Should be successful |
+* | 02 | Burn CPU inside a call | 30 ms | At least 20 ms of user and system time | Should be successful |
+* | 03 | Touch fresh memory inside a call | 1 MiB | At least 128 minor faults | Should be successful |
+* | 04 | Check the hardware counters if available | None | Cycles and instructions counted for the CPU bound call | Should be successful |
+*/
+void test_l2_wifi_rusage_accounting (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    const wifi_hal_api_t sleep_api = WIFI_HAL_API_wifi_getRadioChannel;
+    const wifi_hal_api_t spin_api = WIFI_HAL_API_wifi_getRadioStatus;
+    const wifi_hal_api_t touch_api = WIFI_HAL_API_wifi_getStats;
+    wifi_rusage_counters_t mode;
+    wifi_rusage_stats_t stats;
+
+    if (wifi_rusage_active)
+    {
+        UT_LOG("WIFI_HAL_RUSAGE accounts the whole run, skipping\n");
+        WIFI_TRACE_TEST_END();
+        return;
+    }
+    mode = wifi_rusage_counters();
+    UT_LOG("Hardware counters: %s\n", counter_modes[mode]);
+    wifi_rusage_reset();
+    wifi_rusage_enable(1);
+
+    wifi_rusage_call_enter(sleep_api);
+    for (int i = 0; i < SLEEP_COUNT; i++)
+    {
+        wifi_perf_sleep_ms(SLEEP_MS);
+    }
+    wifi_rusage_call_exit(sleep_api);
+
+    wifi_rusage_call_enter(spin_api);
+    spin_cpu_ms(SPIN_MS);
+    wifi_rusage_call_exit(spin_api);
+
+    wifi_rusage_call_enter(touch_api);
+    touch_pages(TOUCH_BYTES);
+    wifi_rusage_call_exit(touch_api);
+
+    wifi_rusage_enable(0);
+
+    wifi_rusage_get(sleep_api, &stats);
+    rusage_log(sleep_api, &stats);
+    UT_ASSERT_EQUAL(stats.calls, 1);
+    UT_ASSERT_EQUAL(stats.voluntary_switches >= SLEEP_COUNT, 1);
+
+    wifi_rusage_get(spin_api, &stats);
+    rusage_log(spin_api, &stats);
+    UT_ASSERT_EQUAL(stats.calls, 1);
+    UT_ASSERT_EQUAL(stats.user_ns + stats.system_ns >= (uint64_t)SPIN_MIN_MS * WIFI_PERF_NS_PER_MS, 1);
+    if (mode != WIFI_RUSAGE_COUNTERS_NONE)
+    {
+        UT_ASSERT_EQUAL(stats.counted_calls, 1);
+        UT_ASSERT_EQUAL(stats.cycles > 0, 1);
+        UT_ASSERT_EQUAL(stats.instructions > 0, 1);
+    }
+
+    wifi_rusage_get(touch_api, &stats);
+    rusage_log(touch_api, &stats);
+    UT_ASSERT_EQUAL(stats.minor_faults >= TOUCH_MIN_FAULTS, 1);
+
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Report the system cost of every read-only getter of the HAL under test
+*
+* Calls each getter 20 times with accounting enabled and logs the average cost per call. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** Medium @n
+* @n
+* **Pre-Conditions:** wifi_init() has been called @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Call every getter 20 times | radioIndex = 1, ssidIndex = 1 | Every call accounted | Should be successful |
+* | 02 | Log the cost per call of each getter | None | None | Should be successful |
+*/
+void test_l2_wifi_rusage_getters_hal (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    const wifi_perf_probe_t *probes;
+    size_t probe_count;
+    int was_active = wifi_rusage_active;
+
+    /* With WIFI_HAL_RUSAGE=1 the rows include the rest of the run */
+    if (!was_active)
+    {
+        wifi_rusage_reset();
+        wifi_rusage_enable(1);
+    }
+
+    probes = wifi_perf_probes(&probe_count);
+    for (int iteration = 0; iteration < HAL_ITERATIONS; iteration++)
+    {
+        for (size_t i = 0; i < probe_count; i++)
+        {
+            probes[i].call(RADIO_INDEX, SSID_INDEX);
+        }
+    }
+
+    if (!was_active)
+    {
+        wifi_rusage_enable(0);
+    }
+
+    UT_LOG("Hardware counters: %s\n", counter_modes[wifi_rusage_counters()]);
+    for (size_t i = 0; i < probe_count; i++)
+    {
+        wifi_rusage_stats_t stats;
+
+        wifi_rusage_get(probes[i].api, &stats);
+        rusage_log(probes[i].api, &stats);
+        UT_ASSERT_EQUAL(stats.calls >= HAL_ITERATIONS, 1);
+    }
+
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_rusage = NULL;
+static UT_test_suite_t * pSuite_rusage_hal = NULL;
+
+/**
+ * @brief Register the system cost tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_rusage_register_l2_tests (void)
+{
+    pSuite_rusage = UT_add_suite("[L2 wifi_rusage tests]", NULL, NULL);
+    if (pSuite_rusage == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_rusage, "l2_wifi_rusage_accounting", test_l2_wifi_rusage_accounting);
+
+    pSuite_rusage_hal = UT_add_suite("[L2 wifi_rusage post-init tests]", WiFi_InitPreReq, WiFi_UnInitPosReq);
+    if (pSuite_rusage_hal == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_rusage_hal, "l2_wifi_rusage_getters_hal", test_l2_wifi_rusage_getters_hal);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_RUSAGE_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
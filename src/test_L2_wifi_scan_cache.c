@@ -0,0 +1,761 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_SCAN_CACHE_HALTEST_L2 RDK-V WiFi Scan Cache L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the RDK-V WiFi scan result cache :
+ *
+ * Module and stress tests for the scan cache in wrappers/src/wifi_scan_cache.c.
+ * The module tests run the cache over a mock scan with a known delay, the
+ * stress test compares cached and direct scans on the HAL under test.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_scan_cache.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "wifi_common_hal.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stability.h"
+#include "wifi_perf_stats.h"
+#include "wifi_scan_cache.h"
+
+#define MOCK_AP_COUNT 3
+#define MOCK_SCAN_DELAY_MS 20
+#define COALESCE_THREADS 16
+#define BENCH_CLIENTS 8
+#define BENCH_DURATION_MS 1000
+#define BENCH_POLL_MS 10
+#define BENCH_MAX_AGE_MS 500
+#define BENCH_SCAN_DELAY_MS 50
+#define HAL_BENCH_ITERATIONS 5
+#define BOUNDED_MAX_ENTRIES 4
+#define BOUNDED_SSIDS 10
+
+extern int WiFi_InitPreReq(void);
+extern int WiFi_UnInitPosReq(void);
+extern const int RADIO_INDEX;
+
+static UINT mock_scan_delay_ms = MOCK_SCAN_DELAY_MS;
+static INT mock_scan_result = RETURN_OK;
+static int mock_scan_calls = 0;
+
+static wifi_neighbor_ap_t *mock_ap_array(const char *prefix, UINT channel)
+{
+    wifi_neighbor_ap_t *aps = calloc(MOCK_AP_COUNT, sizeof(wifi_neighbor_ap_t));
+
+    if (aps == NULL)
+    {
+        return NULL;
+    }
+    for (int i = 0; i < MOCK_AP_COUNT; i++)
+    {
+        snprintf(aps[i].ap_SSID, sizeof(aps[i].ap_SSID), "%s_%d", prefix, i);
+        snprintf(aps[i].ap_BSSID, sizeof(aps[i].ap_BSSID), "00:11:22:33:44:%02x", i);
+        aps[i].ap_Channel = channel;
+        aps[i].ap_SignalStrength = -40 - i;
+    }
+    return aps;
+}
+
+static INT mock_getNeighboringWiFiDiagnosticResult(INT radioIndex, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size)
+{
+    char prefix[16];
+
+    __atomic_add_fetch(&mock_scan_calls, 1, __ATOMIC_SEQ_CST);
+    wifi_perf_sleep_ms(mock_scan_delay_ms);
+    if (mock_scan_result != RETURN_OK)
+    {
+        return mock_scan_result;
+    }
+    snprintf(prefix, sizeof(prefix), "radio%d", radioIndex);
+    *neighbor_ap_array = mock_ap_array(prefix, 6);
+    *output_array_size = (*neighbor_ap_array != NULL) ? MOCK_AP_COUNT : 0;
+    return (*neighbor_ap_array != NULL) ? RETURN_OK : RETURN_ERR;
+}
+
+static INT mock_getSpecificSSIDInfo(const char *SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t **ap_array, UINT *output_array_size)
+{
+    __atomic_add_fetch(&mock_scan_calls, 1, __ATOMIC_SEQ_CST);
+    wifi_perf_sleep_ms(mock_scan_delay_ms);
+    if (mock_scan_result != RETURN_OK)
+    {
+        return mock_scan_result;
+    }
+    *ap_array = mock_ap_array(SSID, (band == WIFI_HAL_FREQ_BAND_5GHZ) ? 36 : 6);
+    *output_array_size = (*ap_array != NULL) ? MOCK_AP_COUNT : 0;
+    return (*ap_array != NULL) ? RETURN_OK : RETURN_ERR;
+}
+
+static void mock_cache_init(UINT max_age_ms, UINT scan_delay_ms)
+{
+    wifi_scan_cache_config_t config = {
+        .max_age_ms = max_age_ms,
+        .neighbor_fn = mock_getNeighboringWiFiDiagnosticResult,
+        .ssid_fn = mock_getSpecificSSIDInfo,
+    };
+
+    mock_scan_delay_ms = scan_delay_ms;
+    mock_scan_result = RETURN_OK;
+    mock_scan_calls = 0;
+    wifi_scan_cache_deinit();
+    if (wifi_scan_cache_init(&config) != RETURN_OK)
+    {
+        UT_FAIL_FATAL("wifi_scan_cache_init failed");
+    }
+}
+
+static void log_cache_stats(const char *label)
+{
+    wifi_scan_cache_stats_t stats;
+
+    wifi_scan_cache_get_stats(&stats);
+    UT_LOG("%s: requests=%llu hits=%llu coalesced=%llu scans=%llu errors=%llu hit_rate=%.1f%% scan_time=%.1fms saved=%.1fms\n",
+           label, (unsigned long long)stats.requests, (unsigned long long)stats.hits,
+           (unsigned long long)stats.coalesced, (unsigned long long)stats.scans,
+           (unsigned long long)stats.errors, wifi_scan_cache_hit_rate(&stats) * 100.0,
+           (double)stats.scan_ns / 1e6, (double)stats.saved_ns / 1e6);
+}
+
+/**
+* @brief Verify that a second request within the maximum age is served from the cache
+*
+* The first request misses and runs a scan, the second request returns an identical copy of the
+* cached result without calling the scan again. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Request the neighbor scan through the cache | radioIndex = 1, max_age_ms = 10000 | RETURN_OK, one scan issued | Miss |
+* | 02 | Request the same scan again | radioIndex = 1 | RETURN_OK, still one scan issued, same content | Hit |
+* | 03 | Read the cache counters | None | requests = 2, hits = 1, scans = 1 | Should be successful |
+*/
+void test_l2_wifi_scan_cache_fresh_result_served_from_cache (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_neighbor_ap_t *first = NULL;
+    wifi_neighbor_ap_t *second = NULL;
+    UINT first_size = 0;
+    UINT second_size = 0;
+    wifi_scan_cache_stats_t stats;
+    INT ret;
+
+    mock_cache_init(10000, MOCK_SCAN_DELAY_MS);
+
+    ret = wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &first, &first_size);
+    UT_ASSERT_EQUAL(ret, RETURN_OK);
+    UT_ASSERT_EQUAL(first_size, MOCK_AP_COUNT);
+    ret = wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &second, &second_size);
+    UT_ASSERT_EQUAL(ret, RETURN_OK);
+    UT_ASSERT_EQUAL(second_size, MOCK_AP_COUNT);
+    UT_ASSERT_EQUAL(mock_scan_calls, 1);
+
+    if (first != NULL && second != NULL)
+    {
+        UT_ASSERT_EQUAL(first != second, 1);
+        UT_ASSERT_EQUAL(memcmp(first, second, MOCK_AP_COUNT * sizeof(wifi_neighbor_ap_t)), 0);
+    }
+
+    wifi_scan_cache_get_stats(&stats);
+    UT_ASSERT_EQUAL(stats.requests, 2);
+    UT_ASSERT_EQUAL(stats.hits, 1);
+    UT_ASSERT_EQUAL(stats.scans, 1);
+    log_cache_stats("fresh result");
+
+    free(first);
+    free(second);
+    wifi_scan_cache_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that a result older than the maximum age triggers a new scan
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Request the neighbor scan through the cache | max_age_ms = 50 | RETURN_OK, one scan issued | Miss |
+* | 02 | Wait longer than the maximum age and request again | sleep 100 ms | RETURN_OK, two scans issued | Stale |
+* | 03 | Invalidate the cache and request again | None | RETURN_OK, three scans issued | Invalidated |
+*/
+void test_l2_wifi_scan_cache_stale_result_rescanned (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT size = 0;
+    INT ret;
+
+    mock_cache_init(50, 1);
+
+    ret = wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &aps, &size);
+    UT_ASSERT_EQUAL(ret, RETURN_OK);
+    free(aps);
+    UT_ASSERT_EQUAL(mock_scan_calls, 1);
+
+    wifi_perf_sleep_ms(100);
+    ret = wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &aps, &size);
+    UT_ASSERT_EQUAL(ret, RETURN_OK);
+    free(aps);
+    UT_ASSERT_EQUAL(mock_scan_calls, 2);
+
+    wifi_scan_cache_invalidate();
+    ret = wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &aps, &size);
+    UT_ASSERT_EQUAL(ret, RETURN_OK);
+    free(aps);
+    UT_ASSERT_EQUAL(mock_scan_calls, 3);
+
+    wifi_scan_cache_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+typedef struct
+{
+    pthread_barrier_t *start;
+    INT ret;
+    UINT size;
+} coalesce_arg_t;
+
+static void *coalesce_thread(void *arg)
+{
+    coalesce_arg_t *ctx = arg;
+    wifi_neighbor_ap_t *aps = NULL;
+
+    pthread_barrier_wait(ctx->start);
+    ctx->ret = wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &aps, &ctx->size);
+    free(aps);
+    return NULL;
+}
+
+/**
+* @brief Verify that concurrent requests for the same scan are coalesced into one scan
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 003 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Release 16 threads at once, each requesting the same neighbor scan | scan delay = 100 ms | Every thread gets RETURN_OK and 3 entries | Should be successful |
+* | 02 | Count the underlying scans | None | Exactly one scan, 15 coalesced requests | Should be successful |
+*/
+void test_l2_wifi_scan_cache_concurrent_requests_coalesced (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    pthread_t threads[COALESCE_THREADS];
+    coalesce_arg_t args[COALESCE_THREADS];
+    pthread_barrier_t start;
+    wifi_scan_cache_stats_t stats;
+
+    mock_cache_init(10000, 100);
+    pthread_barrier_init(&start, NULL, COALESCE_THREADS);
+
+    for (int i = 0; i < COALESCE_THREADS; i++)
+    {
+        args[i].start = &start;
+        args[i].ret = RETURN_ERR;
+        args[i].size = 0;
+        wifi_perf_thread_create(&threads[i], coalesce_thread, &args[i]);
+    }
+    for (int i = 0; i < COALESCE_THREADS; i++)
+    {
+        pthread_join(threads[i], NULL);
+        UT_ASSERT_EQUAL(args[i].ret, RETURN_OK);
+        UT_ASSERT_EQUAL(args[i].size, MOCK_AP_COUNT);
+    }
+    pthread_barrier_destroy(&start);
+
+    wifi_scan_cache_get_stats(&stats);
+    UT_LOG("Underlying scans: %d\n", mock_scan_calls);
+    UT_ASSERT_EQUAL(mock_scan_calls, 1);
+    UT_ASSERT_EQUAL(stats.scans, 1);
+    UT_ASSERT_EQUAL(stats.coalesced + stats.hits, COALESCE_THREADS - 1);
+    log_cache_stats("coalesced");
+
+    wifi_scan_cache_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that failed scans are reported to the caller and never cached
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 004 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Make the scan fail and request it twice | scan result = RETURN_ERR | RETURN_ERR both times, two scans issued | Should Fail |
+* | 02 | Make the scan succeed and request it | scan result = RETURN_OK | RETURN_OK, three scans issued | Should Pass |
+*/
+void test_l2_wifi_scan_cache_failed_scan_not_cached (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT size = 0;
+    wifi_scan_cache_stats_t stats;
+    INT ret;
+
+    mock_cache_init(10000, 1);
+    mock_scan_result = RETURN_ERR;
+
+    ret = wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &aps, &size);
+    UT_ASSERT_EQUAL(ret, RETURN_ERR);
+    ret = wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &aps, &size);
+    UT_ASSERT_EQUAL(ret, RETURN_ERR);
+    UT_ASSERT_EQUAL(mock_scan_calls, 2);
+
+    mock_scan_result = RETURN_OK;
+    ret = wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &aps, &size);
+    UT_ASSERT_EQUAL(ret, RETURN_OK);
+    UT_ASSERT_EQUAL(size, MOCK_AP_COUNT);
+    free(aps);
+    UT_ASSERT_EQUAL(mock_scan_calls, 3);
+
+    wifi_scan_cache_get_stats(&stats);
+    UT_ASSERT_EQUAL(stats.errors, 2);
+    wifi_scan_cache_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that wifi_getSpecificSSIDInfo results are cached per SSID and band
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 005 @n
+* **Priority:** Med @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Request three different SSID/band pairs | ("HomeAP", 2.4GHz), ("GuestAP", 2.4GHz), ("HomeAP", 5GHz) | RETURN_OK, three scans issued | Should be successful |
+* | 02 | Request ("HomeAP", 2.4GHz) again | None | RETURN_OK, still three scans, result for HomeAP on channel 6 | Hit |
+*/
+void test_l2_wifi_scan_cache_ssid_results_keyed_by_ssid_and_band (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT size = 0;
+    INT ret;
+
+    mock_cache_init(10000, 1);
+
+    ret = wifi_scan_cache_getSpecificSSIDInfo("HomeAP", WIFI_HAL_FREQ_BAND_24GHZ, &aps, &size);
+    UT_ASSERT_EQUAL(ret, RETURN_OK);
+    free(aps);
+    ret = wifi_scan_cache_getSpecificSSIDInfo("GuestAP", WIFI_HAL_FREQ_BAND_24GHZ, &aps, &size);
+    UT_ASSERT_EQUAL(ret, RETURN_OK);
+    free(aps);
+    ret = wifi_scan_cache_getSpecificSSIDInfo("HomeAP", WIFI_HAL_FREQ_BAND_5GHZ, &aps, &size);
+    UT_ASSERT_EQUAL(ret, RETURN_OK);
+    free(aps);
+    UT_ASSERT_EQUAL(mock_scan_calls, 3);
+
+    aps = NULL;
+    ret = wifi_scan_cache_getSpecificSSIDInfo("HomeAP", WIFI_HAL_FREQ_BAND_24GHZ, &aps, &size);
+    UT_ASSERT_EQUAL(ret, RETURN_OK);
+    UT_ASSERT_EQUAL(mock_scan_calls, 3);
+    if (aps != NULL)
+    {
+        UT_ASSERT_EQUAL(strcmp(aps[0].ap_SSID, "HomeAP_0"), 0);
+        UT_ASSERT_EQUAL(aps[0].ap_Channel, 6);
+    }
+    free(aps);
+
+    wifi_scan_cache_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that the cache rejects invalid parameters and calls before initialisation
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 006 @n
+* **Priority:** Med @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Request a scan before wifi_scan_cache_init() | None | RETURN_ERR | Should Fail |
+* | 02 | Pass NULL output pointers | neighbor_ap_array = NULL, output_array_size = NULL | RETURN_ERR | Should Fail |
+* | 03 | Pass a NULL SSID | SSID = NULL | RETURN_ERR | Should Fail |
+* | 04 | Initialise twice | None | RETURN_ERR on the second call | Should Fail |
+*/
+void test_l2_wifi_scan_cache_invalid_parameters (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT size = 0;
+
+    wifi_scan_cache_deinit();
+    UT_ASSERT_EQUAL(wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &aps, &size), RETURN_ERR);
+
+    mock_cache_init(10000, 1);
+    UT_ASSERT_EQUAL(wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, NULL, &size), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &aps, NULL), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_scan_cache_getSpecificSSIDInfo(NULL, WIFI_HAL_FREQ_BAND_24GHZ, &aps, &size), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_scan_cache_init(NULL), RETURN_ERR);
+    UT_ASSERT_EQUAL(mock_scan_calls, 0);
+
+    wifi_scan_cache_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that the cache keeps at most max_entries results
+*
+* Stale results are released first, then the least recently used ones. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 007 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Request ten different SSIDs with room for four results | "AP0" .. "AP9", max_entries = 4 | RETURN_OK, ten scans, six results evicted | Should be successful |
+* | 02 | Request the last SSID again | "AP9" | Hit, no new scan | Should be successful |
+* | 03 | Request the first SSID again | "AP0" | Evicted, so scanned again | Should be successful |
+* | 04 | Drop every result and request a new SSID | "AP10" | The four invalidated results are released | Should be successful |
+*/
+void test_l2_wifi_scan_cache_entries_bounded (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_scan_cache_config_t config = {
+        .max_age_ms = 10000,
+        .neighbor_fn = mock_getNeighboringWiFiDiagnosticResult,
+        .ssid_fn = mock_getSpecificSSIDInfo,
+        .max_entries = BOUNDED_MAX_ENTRIES,
+    };
+    wifi_scan_cache_stats_t stats;
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT size = 0;
+    uint64_t evicted;
+    char ssid[16];
+
+    /* Mock state from mock_cache_init(), then a cache with room for four results */
+    mock_cache_init(10000, 1);
+    wifi_scan_cache_deinit();
+    UT_ASSERT_EQUAL(wifi_scan_cache_init(&config), RETURN_OK);
+
+    for (int i = 0; i < BOUNDED_SSIDS; i++)
+    {
+        snprintf(ssid, sizeof(ssid), "AP%d", i);
+        UT_ASSERT_EQUAL(wifi_scan_cache_getSpecificSSIDInfo(ssid, WIFI_HAL_FREQ_BAND_24GHZ, &aps, &size), RETURN_OK);
+        free(aps);
+    }
+    wifi_scan_cache_get_stats(&stats);
+    UT_ASSERT_EQUAL(mock_scan_calls, BOUNDED_SSIDS);
+    UT_ASSERT_EQUAL(stats.evicted, BOUNDED_SSIDS - BOUNDED_MAX_ENTRIES);
+
+    UT_ASSERT_EQUAL(wifi_scan_cache_getSpecificSSIDInfo("AP9", WIFI_HAL_FREQ_BAND_24GHZ, &aps, &size), RETURN_OK);
+    free(aps);
+    UT_ASSERT_EQUAL(mock_scan_calls, BOUNDED_SSIDS);
+    UT_ASSERT_EQUAL(wifi_scan_cache_getSpecificSSIDInfo("AP0", WIFI_HAL_FREQ_BAND_24GHZ, &aps, &size), RETURN_OK);
+    free(aps);
+    UT_ASSERT_EQUAL(mock_scan_calls, BOUNDED_SSIDS + 1);
+
+    wifi_scan_cache_get_stats(&stats);
+    evicted = stats.evicted;
+    wifi_scan_cache_invalidate();
+    UT_ASSERT_EQUAL(wifi_scan_cache_getSpecificSSIDInfo("AP10", WIFI_HAL_FREQ_BAND_24GHZ, &aps, &size), RETURN_OK);
+    free(aps);
+    wifi_scan_cache_get_stats(&stats);
+    UT_ASSERT_EQUAL(stats.evicted - evicted, BOUNDED_MAX_ENTRIES);
+
+    wifi_scan_cache_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+typedef struct
+{
+    wifi_perf_samples_t latency;
+    INT failures;
+} bench_client_t;
+
+static void *bench_client_thread(void *arg)
+{
+    bench_client_t *client = arg;
+    uint64_t end = wifi_perf_now_ns() + BENCH_DURATION_MS * WIFI_PERF_NS_PER_MS;
+
+    while (wifi_perf_now_ns() < end)
+    {
+        wifi_neighbor_ap_t *aps = NULL;
+        UINT size = 0;
+        uint64_t start = wifi_perf_now_ns();
+
+        if (wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &aps, &size) != RETURN_OK)
+        {
+            client->failures++;
+        }
+        wifi_perf_samples_add(&client->latency, wifi_perf_now_ns() - start);
+        free(aps);
+        wifi_perf_sleep_ms(BENCH_POLL_MS);
+    }
+    return NULL;
+}
+
+/**
+* @brief Benchmark the cache against several components polling the neighbor scan
+*
+* Eight clients poll the scan every 10 ms for one second over a mock scan that takes 50 ms.
+* Reports hit rate, caller latency and the scan time saved compared to every call scanning. @n
+*
+* **Test Group ID:** Stress: 03 @n
+* **Test Case ID:** 008 @n
+* **Priority:** Med @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Run 8 polling clients through the cache | max_age_ms = 500, scan = 50 ms, poll = 10 ms, 1 s | No failures | Should be successful |
+* | 02 | Compare scans issued with requests served | None | Hit rate above 90%, p50 latency below the scan time | Should be successful |
+*/
+void test_l2_wifi_scan_cache_polling_clients_benchmark (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    pthread_t threads[BENCH_CLIENTS];
+    bench_client_t clients[BENCH_CLIENTS];
+    wifi_perf_samples_t all;
+    wifi_perf_summary_t summary;
+    wifi_scan_cache_stats_t stats;
+    char line[256];
+
+    mock_cache_init(BENCH_MAX_AGE_MS, BENCH_SCAN_DELAY_MS);
+    wifi_perf_samples_init(&all, 0);
+
+    for (int i = 0; i < BENCH_CLIENTS; i++)
+    {
+        wifi_perf_samples_init(&clients[i].latency, 0);
+        clients[i].failures = 0;
+        wifi_perf_thread_create(&threads[i], bench_client_thread, &clients[i]);
+    }
+    for (int i = 0; i < BENCH_CLIENTS; i++)
+    {
+        pthread_join(threads[i], NULL);
+        UT_ASSERT_EQUAL(clients[i].failures, 0);
+        wifi_perf_samples_merge(&all, &clients[i].latency);
+        wifi_perf_samples_free(&clients[i].latency);
+    }
+
+    wifi_perf_summarize(&all, &summary);
+    wifi_scan_cache_get_stats(&stats);
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "cached neighbor scan latency", &summary));
+    UT_LOG("Direct scanning would have cost %.1f ms of caller time, cached callers spent %.1f ms\n",
+           (double)stats.requests * BENCH_SCAN_DELAY_MS, summary.total / 1e6);
+    log_cache_stats("polling clients");
+
+    UT_ASSERT_EQUAL(wifi_scan_cache_hit_rate(&stats) > 0.9, 1);
+    UT_ASSERT_EQUAL(summary.p50 < (double)BENCH_SCAN_DELAY_MS * WIFI_PERF_NS_PER_MS, 1);
+
+    wifi_perf_samples_free(&all);
+    wifi_scan_cache_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Compare direct and cached neighbor scans on the HAL under test
+*
+* Runs wifi_getNeighboringWiFiDiagnosticResult() directly and through the cache and reports both latencies.
+* The cache must return the same status as the HAL. @n
+*
+* **Test Group ID:** Stress: 03 @n
+* **Test Case ID:** 009 @n
+* **Priority:** Med @n
+* @n
+* **Pre-Conditions:** wifi_init() called by the suite @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Invoke wifi_getNeighboringWiFiDiagnosticResult() 5 times | radioIndex = 1 | RETURN_OK | Direct |
+* | 02 | Invoke the cached variant 5 times | radioIndex = 1, default max age | RETURN_OK, at most one scan | Cached |
+*/
+void test_l2_wifi_scan_cache_hal_direct_vs_cached (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_perf_samples_t direct;
+    wifi_perf_samples_t cached;
+    wifi_perf_summary_t summary;
+    wifi_scan_cache_stats_t stats;
+    char line[256];
+    INT ret;
+
+    wifi_perf_samples_init(&direct, HAL_BENCH_ITERATIONS);
+    wifi_perf_samples_init(&cached, HAL_BENCH_ITERATIONS);
+    wifi_scan_cache_deinit();
+    UT_ASSERT_EQUAL(wifi_scan_cache_init(NULL), RETURN_OK);
+
+    for (int i = 0; i < HAL_BENCH_ITERATIONS; i++)
+    {
+        wifi_neighbor_ap_t *aps = NULL;
+        UINT size = 0;
+        uint64_t start = wifi_perf_now_ns();
+
+        ret = wifi_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &aps, &size);
+        wifi_perf_samples_add(&direct, wifi_perf_now_ns() - start);
+        UT_ASSERT_EQUAL(ret, RETURN_OK);
+        free(aps);
+    }
+    for (int i = 0; i < HAL_BENCH_ITERATIONS; i++)
+    {
+        wifi_neighbor_ap_t *aps = NULL;
+        UINT size = 0;
+        uint64_t start = wifi_perf_now_ns();
+
+        ret = wifi_scan_cache_getNeighboringWiFiDiagnosticResult(RADIO_INDEX, &aps, &size);
+        wifi_perf_samples_add(&cached, wifi_perf_now_ns() - start);
+        UT_ASSERT_EQUAL(ret, RETURN_OK);
+        free(aps);
+    }
+
+    wifi_perf_summarize(&direct, &summary);
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "direct neighbor scan", &summary));
+    wifi_perf_summarize(&cached, &summary);
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "cached neighbor scan", &summary));
+    wifi_scan_cache_get_stats(&stats);
+    UT_ASSERT_EQUAL(stats.scans <= 1, 1);
+    log_cache_stats("HAL");
+
+    wifi_perf_samples_free(&direct);
+    wifi_perf_samples_free(&cached);
+    wifi_scan_cache_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_scan_cache = NULL;
+static UT_test_suite_t * pSuite_scan_cache_with_wifi_init = NULL;
+
+/**
+ * @brief Register the scan cache tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_scan_cache_register_l2_tests (void)
+{
+    pSuite_scan_cache = UT_add_suite("[L2 wifi_scan_cache tests]", NULL, NULL);
+    if (pSuite_scan_cache == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_scan_cache, "l2_wifi_scan_cache_fresh_result_served_from_cache", test_l2_wifi_scan_cache_fresh_result_served_from_cache);
+    UT_add_test(pSuite_scan_cache, "l2_wifi_scan_cache_stale_result_rescanned", test_l2_wifi_scan_cache_stale_result_rescanned);
+    UT_add_test(pSuite_scan_cache, "l2_wifi_scan_cache_concurrent_requests_coalesced", test_l2_wifi_scan_cache_concurrent_requests_coalesced);
+    UT_add_test(pSuite_scan_cache, "l2_wifi_scan_cache_failed_scan_not_cached", test_l2_wifi_scan_cache_failed_scan_not_cached);
+    UT_add_test(pSuite_scan_cache, "l2_wifi_scan_cache_ssid_results_keyed_by_ssid_and_band", test_l2_wifi_scan_cache_ssid_results_keyed_by_ssid_and_band);
+    UT_add_test(pSuite_scan_cache, "l2_wifi_scan_cache_invalid_parameters", test_l2_wifi_scan_cache_invalid_parameters);
+    UT_add_test(pSuite_scan_cache, "l2_wifi_scan_cache_entries_bounded", test_l2_wifi_scan_cache_entries_bounded);
+    UT_add_test(pSuite_scan_cache, "l2_wifi_scan_cache_polling_clients_benchmark", test_l2_wifi_scan_cache_polling_clients_benchmark);
+
+    pSuite_scan_cache_with_wifi_init = UT_add_suite("[L2 wifi_scan_cache post-init tests]", WiFi_InitPreReq, WiFi_UnInitPosReq);
+    if (pSuite_scan_cache_with_wifi_init == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_scan_cache_with_wifi_init, "l2_wifi_scan_cache_hal_direct_vs_cached", test_l2_wifi_scan_cache_hal_direct_vs_cached);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_SCAN_CACHE_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,515 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_SCAN_INTERFERENCE_HALTEST_L2 RDK-V WiFi Scan Interference L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for getter latency while a scan is in progress :
+ *
+ * One thread runs wifi_setRadioScanningFreqList() followed by wifi_waitForScanResults()
+ * while one polling thread per getter calls wifi_getStats(), wifi_getRadioChannel() and
+ * wifi_getSSIDTrafficStats(). Getter latency while the scan is running is compared with
+ * latency at idle. A getter that is much slower during the scan is blocked behind the
+ * scan, typically by a global lock inside the HAL.
+ *
+ * The module tests validate the measurement over a mock HAL with and without a global
+ * lock, the stress test runs it on the HAL under test.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_scan_interference.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "wifi_common_hal.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_probe.h"
+#include "wifi_perf_stability.h"
+#include "wifi_perf_stats.h"
+
+#define POLLED_APIS 3
+#define IDLE_DURATION_MS 300
+#define POLL_INTERVAL_MS 1
+#define MOCK_SCAN_ROUNDS 3
+#define MOCK_SCAN_MS 100
+#define MOCK_GETTER_US 50
+#define HAL_SCAN_ROUNDS 3
+#define HAL_SCAN_FREQ_LIST "2412 2437 2462"
+
+extern int WiFi_InitPreReq(void);
+extern int WiFi_UnInitPosReq(void);
+extern const int RADIO_INDEX;
+extern const int SSID_INDEX;
+
+typedef INT (*interference_getter_fn)(INT radioIndex, INT ssidIndex);
+
+/**
+ * @brief HAL calls used by one interference run
+ */
+typedef struct
+{
+    INT (*set_freq_list)(INT radioIndex, const CHAR *freqList);
+    INT (*wait_scan)(void);
+    interference_getter_fn getters[POLLED_APIS];   /*!< NULL for a getter the HAL does not support */
+    const char *names[POLLED_APIS];
+} interference_ops_t;
+
+/**
+ * @brief Result of one interference run
+ */
+typedef struct
+{
+    wifi_perf_samples_t idle[POLLED_APIS];
+    wifi_perf_samples_t scan[POLLED_APIS];
+    wifi_perf_samples_t scan_duration;
+    int getter_failures[POLLED_APIS];
+    int scan_failures;
+} interference_result_t;
+
+typedef struct
+{
+    const interference_ops_t *ops;
+    int api;
+    wifi_perf_samples_t *idle;
+    wifi_perf_samples_t *scan;
+    int *failures;
+} poller_arg_t;
+
+static int scan_active = 0;
+static int pollers_stop = 0;
+static int scan_phase = 0;
+
+static pthread_mutex_t mock_driver_lock = PTHREAD_MUTEX_INITIALIZER;
+static int mock_global_lock = 0;
+
+static void mock_driver_access(UINT duration_us)
+{
+    if (mock_global_lock)
+    {
+        pthread_mutex_lock(&mock_driver_lock);
+    }
+    wifi_perf_sleep_us(duration_us);
+    if (mock_global_lock)
+    {
+        pthread_mutex_unlock(&mock_driver_lock);
+    }
+}
+
+static INT mock_setRadioScanningFreqList(INT radioIndex, const CHAR *freqList)
+{
+    mock_driver_access(MOCK_GETTER_US);
+    return RETURN_OK;
+}
+
+/* The scan itself runs with the driver lock held when mock_global_lock is set */
+static INT mock_waitForScanResults(void)
+{
+    mock_driver_access(MOCK_SCAN_MS * 1000);
+    return RETURN_OK;
+}
+
+static INT mock_getter(INT radioIndex, INT ssidIndex)
+{
+    mock_driver_access(MOCK_GETTER_US);
+    return RETURN_OK;
+}
+
+static const interference_ops_t mock_ops = {
+    .set_freq_list = mock_setRadioScanningFreqList,
+    .wait_scan = mock_waitForScanResults,
+    .getters = { mock_getter, mock_getter, mock_getter },
+    .names = { "mock_getStats", "mock_getRadioChannel", "mock_getSSIDTrafficStats" },
+};
+
+static void *poller_thread(void *arg)
+{
+    poller_arg_t *poller = arg;
+
+    while (!__atomic_load_n(&pollers_stop, __ATOMIC_SEQ_CST))
+    {
+        int during_scan = __atomic_load_n(&scan_active, __ATOMIC_SEQ_CST);
+        uint64_t start = wifi_perf_now_ns();
+        INT ret = poller->ops->getters[poller->api](RADIO_INDEX, SSID_INDEX);
+        uint64_t elapsed = wifi_perf_now_ns() - start;
+
+        /* A call overlapping the scan at either end counts as during the scan.
+         * Calls in the scan phase that never overlapped a scan are discarded. */
+        during_scan |= __atomic_load_n(&scan_active, __ATOMIC_SEQ_CST);
+        if (ret != RETURN_OK)
+        {
+            (*poller->failures)++;
+        }
+        if (during_scan)
+        {
+            wifi_perf_samples_add(poller->scan, elapsed);
+        }
+        else if (!__atomic_load_n(&scan_phase, __ATOMIC_SEQ_CST))
+        {
+            wifi_perf_samples_add(poller->idle, elapsed);
+        }
+        wifi_perf_sleep_ms(POLL_INTERVAL_MS);
+    }
+    return NULL;
+}
+
+static void interference_result_init(interference_result_t *result)
+{
+    memset(result, 0, sizeof(*result));
+    for (int i = 0; i < POLLED_APIS; i++)
+    {
+        wifi_perf_samples_init(&result->idle[i], 0);
+        wifi_perf_samples_init(&result->scan[i], 0);
+    }
+    wifi_perf_samples_init(&result->scan_duration, 0);
+}
+
+static void interference_result_free(interference_result_t *result)
+{
+    for (int i = 0; i < POLLED_APIS; i++)
+    {
+        wifi_perf_samples_free(&result->idle[i]);
+        wifi_perf_samples_free(&result->scan[i]);
+    }
+    wifi_perf_samples_free(&result->scan_duration);
+}
+
+/* Polls the getters at idle for IDLE_DURATION_MS, then runs the scan rounds on this thread */
+static void interference_run(const interference_ops_t *ops, INT radioIndex, const CHAR *freqList,
+                             int rounds, interference_result_t *result)
+{
+    pthread_t threads[POLLED_APIS];
+    poller_arg_t pollers[POLLED_APIS];
+
+    interference_result_init(result);
+    __atomic_store_n(&scan_active, 0, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&scan_phase, 0, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&pollers_stop, 0, __ATOMIC_SEQ_CST);
+
+    for (int i = 0; i < POLLED_APIS; i++)
+    {
+        if (ops->getters[i] == NULL)
+        {
+            continue;
+        }
+        pollers[i].ops = ops;
+        pollers[i].api = i;
+        pollers[i].idle = &result->idle[i];
+        pollers[i].scan = &result->scan[i];
+        pollers[i].failures = &result->getter_failures[i];
+        wifi_perf_thread_create(&threads[i], poller_thread, &pollers[i]);
+    }
+
+    wifi_perf_sleep_ms(IDLE_DURATION_MS);
+    __atomic_store_n(&scan_phase, 1, __ATOMIC_SEQ_CST);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        uint64_t start;
+        INT ret;
+
+        __atomic_store_n(&scan_active, 1, __ATOMIC_SEQ_CST);
+        start = wifi_perf_now_ns();
+        ret = ops->set_freq_list(radioIndex, freqList);
+        if (ret == RETURN_OK)
+        {
+            ret = ops->wait_scan();
+        }
+        wifi_perf_samples_add(&result->scan_duration, wifi_perf_now_ns() - start);
+        __atomic_store_n(&scan_active, 0, __ATOMIC_SEQ_CST);
+        if (ret != RETURN_OK)
+        {
+            result->scan_failures++;
+        }
+        /* Let the pollers settle between rounds */
+        wifi_perf_sleep_ms(10 * POLL_INTERVAL_MS);
+    }
+
+    __atomic_store_n(&pollers_stop, 1, __ATOMIC_SEQ_CST);
+    for (int i = 0; i < POLLED_APIS; i++)
+    {
+        if (ops->getters[i] != NULL)
+        {
+            pthread_join(threads[i], NULL);
+        }
+    }
+}
+
+/* Logs idle and during-scan latency of every getter, returns how many getters were blocked by the scan */
+static int interference_report(const interference_ops_t *ops, interference_result_t *result)
+{
+    wifi_perf_summary_t idle;
+    wifi_perf_summary_t scan;
+    char label[64];
+    char line[256];
+    int blocked = 0;
+
+    wifi_perf_summarize(&result->scan_duration, &scan);
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "scan (set freq list + wait)", &scan));
+
+    for (int i = 0; i < POLLED_APIS; i++)
+    {
+        int interference;
+
+        if (ops->getters[i] == NULL)
+        {
+            UT_LOG("%s: not supported by this HAL, skipped\n", ops->names[i]);
+            continue;
+        }
+
+        wifi_perf_summarize(&result->idle[i], &idle);
+        wifi_perf_summarize(&result->scan[i], &scan);
+        snprintf(label, sizeof(label), "%s idle", ops->names[i]);
+        UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), label, &idle));
+        snprintf(label, sizeof(label), "%s during scan", ops->names[i]);
+        UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), label, &scan));
+
+        if (scan.count == 0)
+        {
+            UT_LOG("%s: no call overlapped a scan, the scan completed too quickly to measure\n", ops->names[i]);
+            continue;
+        }
+        interference = wifi_perf_blocked(&idle, &scan);
+        UT_LOG("%s: p99 %.1fus idle vs %.1fus during scan (x%.1f)%s\n", ops->names[i],
+               idle.p99 / 1000.0, scan.p99 / 1000.0, (idle.p99 > 0.0) ? scan.p99 / idle.p99 : 0.0,
+               interference ? ", blocked by the scan" : "");
+        blocked += interference;
+    }
+    return blocked;
+}
+
+/**
+* @brief Verify that getters of a HAL without a global lock show no interference from a scan
+*
+* The mock scan takes 100 ms without holding the driver lock, so the getters keep their idle latency. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Poll the three mock getters at idle for 300 ms | getter = 50 us | Idle samples for every getter | Should be successful |
+* | 02 | Run three mock scans while polling | scan = 100 ms, no lock | Samples during the scan for every getter | Should be successful |
+* | 03 | Compare idle and during-scan p99 | None | No getter blocked by the scan | Should be successful |
+*/
+void test_l2_wifi_scan_interference_unlocked_mock (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    interference_result_t result;
+
+    mock_global_lock = 0;
+    interference_run(&mock_ops, RADIO_INDEX, HAL_SCAN_FREQ_LIST, MOCK_SCAN_ROUNDS, &result);
+
+    UT_ASSERT_EQUAL(result.scan_failures, 0);
+    for (int i = 0; i < POLLED_APIS; i++)
+    {
+        UT_ASSERT_EQUAL(result.getter_failures[i], 0);
+        UT_ASSERT_EQUAL(result.idle[i].count > 0, 1);
+        UT_ASSERT_EQUAL(result.scan[i].count > 0, 1);
+    }
+    UT_ASSERT_EQUAL(interference_report(&mock_ops, &result), 0);
+
+    interference_result_free(&result);
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that getters blocked by a global lock held over the scan are detected
+*
+* The mock scan holds the driver lock for 100 ms, so every getter issued during the scan waits for it. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Poll the three mock getters at idle for 300 ms | getter = 50 us | Idle samples for every getter | Should be successful |
+* | 02 | Run three mock scans while polling | scan = 100 ms, global lock | Samples during the scan for every getter | Should be successful |
+* | 03 | Compare idle and during-scan p99 | None | All three getters blocked, max latency close to the scan time | Should be successful |
+*/
+void test_l2_wifi_scan_interference_global_lock_mock (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    interference_result_t result;
+    wifi_perf_summary_t scan;
+
+    mock_global_lock = 1;
+    interference_run(&mock_ops, RADIO_INDEX, HAL_SCAN_FREQ_LIST, MOCK_SCAN_ROUNDS, &result);
+    mock_global_lock = 0;
+
+    UT_ASSERT_EQUAL(result.scan_failures, 0);
+    UT_ASSERT_EQUAL(interference_report(&mock_ops, &result), POLLED_APIS);
+    for (int i = 0; i < POLLED_APIS; i++)
+    {
+        wifi_perf_summarize(&result.scan[i], &scan);
+        UT_ASSERT_EQUAL(scan.max > (double)MOCK_SCAN_MS * WIFI_PERF_NS_PER_MS / 2, 1);
+    }
+
+    interference_result_free(&result);
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Measure getter latency during a scan on the HAL under test
+*
+* Polls wifi_getStats(), wifi_getRadioChannel() and wifi_getSSIDTrafficStats() at idle and while
+* wifi_setRadioScanningFreqList() and wifi_waitForScanResults() run on another thread. A getter whose
+* p99 during the scan is ten times its idle p99 and more than 20 ms slower is reported as blocked. @n
+*
+* **Test Group ID:** Stress: 03 @n
+* **Test Case ID:** 003 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** wifi_init() called by the suite @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Call each getter once and skip the ones the HAL does not support | radioIndex = 1, ssidIndex = 1 | None | Should Pass |
+* | 02 | Poll the supported getters at idle for 300 ms | radioIndex = 1, ssidIndex = 1 | RETURN_OK | Should Pass |
+* | 03 | Run wifi_setRadioScanningFreqList() and wifi_waitForScanResults() three times while polling | freqList = "2412 2437 2462" | RETURN_OK | Should Pass |
+* | 04 | Compare idle and during-scan latency of every supported getter | None | No getter blocked by the scan | Should Pass |
+*/
+void test_l2_wifi_scan_interference_hal (void)
+{
+    interference_ops_t hal_ops = {
+        .set_freq_list = wifi_setRadioScanningFreqList,
+        .wait_scan = wifi_waitForScanResults,
+        .names = { "wifi_getStats", "wifi_getRadioChannel", "wifi_getSSIDTrafficStats" },
+    };
+    interference_result_t result;
+
+    /* Resolved before the test span opens, so a fatal failure leaves nothing to close */
+    for (int i = 0; i < POLLED_APIS; i++)
+    {
+        const wifi_perf_probe_t *probe = wifi_perf_probe_find(hal_ops.names[i]);
+
+        if (probe == NULL)
+        {
+            UT_FAIL_FATAL("No probe for a polled getter");
+            return;
+        }
+        hal_ops.getters[i] = probe->call;
+    }
+
+    WIFI_TRACE_TEST_BEGIN();
+    /* A getter failing at idle is not supported here, e.g. traffic counters of an interface without sysfs statistics */
+    for (int i = 0; i < POLLED_APIS; i++)
+    {
+        if (hal_ops.getters[i](RADIO_INDEX, SSID_INDEX) != RETURN_OK)
+        {
+            hal_ops.getters[i] = NULL;
+        }
+    }
+
+    interference_run(&hal_ops, RADIO_INDEX, HAL_SCAN_FREQ_LIST, HAL_SCAN_ROUNDS, &result);
+
+    UT_ASSERT_EQUAL(result.scan_failures, 0);
+    for (int i = 0; i < POLLED_APIS; i++)
+    {
+        UT_ASSERT_EQUAL(result.getter_failures[i], 0);
+    }
+    UT_ASSERT_EQUAL(interference_report(&hal_ops, &result), 0);
+
+    interference_result_free(&result);
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_scan_interference = NULL;
+static UT_test_suite_t * pSuite_scan_interference_with_wifi_init = NULL;
+
+/**
+ * @brief Register the scan interference tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_scan_interference_register_l2_tests (void)
+{
+    pSuite_scan_interference = UT_add_suite("[L2 wifi_scan_interference tests]", NULL, NULL);
+    if (pSuite_scan_interference == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_scan_interference, "l2_wifi_scan_interference_unlocked_mock", test_l2_wifi_scan_interference_unlocked_mock);
+    UT_add_test(pSuite_scan_interference, "l2_wifi_scan_interference_global_lock_mock", test_l2_wifi_scan_interference_global_lock_mock);
+
+    pSuite_scan_interference_with_wifi_init = UT_add_suite("[L2 wifi_scan_interference post-init tests]", WiFi_InitPreReq, WiFi_UnInitPosReq);
+    if (pSuite_scan_interference_with_wifi_init == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_scan_interference_with_wifi_init, "l2_wifi_scan_interference_hal", test_l2_wifi_scan_interference_hal);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_SCAN_INTERFERENCE_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
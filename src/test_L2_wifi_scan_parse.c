@@ -0,0 +1,729 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_SCAN_PARSE_HALTEST_L2 RDK-V WiFi Scan Parser L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the scan output parser :
+ *
+ * Checks the SCAN_RESULTS and BSS parsers of the reference HAL
+ * (reference/include/wifi_scan_parse.h) on known replies, then feeds them
+ * mutated and truncated replies, each in a heap block of exactly its length,
+ * so that reading past the text or leaving a string unterminated shows up
+ * under a memory checker.
+ *
+ * The last test times the parser on SCAN_RESULTS replies of 50, 500 and 5000
+ * lines against the strtok_r() parser the reference HAL used before, and
+ * checks that both produce the same entries.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_scan_parse.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include "wifi_hal_alloc.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stats.h"
+#include "wifi_scan_parse.h"
+
+#define PARSE_FUZZ_ITERATIONS 3000
+#define PARSE_FUZZ_SEED 0x5CA17E57U
+#define PARSE_BENCH_ITERATIONS 50
+
+/* Zeroed element bodies, in hex */
+#define HEX_ZERO_6 "000000000000"
+#define HEX_ZERO_12 HEX_ZERO_6 HEX_ZERO_6
+#define HEX_ZERO_20 HEX_ZERO_12 "0000000000000000"
+#define HEX_ZERO_26 HEX_ZERO_20 HEX_ZERO_6
+
+static const CHAR scan_results_text[] =
+    "bssid / frequency / signal level / flags / ssid\n"
+    "02:00:00:00:00:01\t5180\t-48\t[WPA2-PSK-CCMP][ESS]\tSimHome\n"
+    "02:00:00:00:00:02\t2437\t-45\t[WPA-PSK-CCMP+TKIP][WPA2-PSK-CCMP+TKIP][WPS][ESS]\tSimHome\n"
+    "02:00:00:00:00:03\t2462\t-72\t[WPA2-EAP-CCMP][ESS]\tOffice\\\\Guest\r\n"
+    "02:00:00:00:00:04\t2412\t-80\t[ESS]\n"
+    "02:00:00:00:00:05\t5745\t-67\t[WPA2-PSK+SAE-CCMP][ESS]\tCaf\\xc3\\xa9 \\\"Wi-Fi\\\"\n"
+    "02:00:00:00:00:06\t2412\t-90\t[WEP][IBSS]\tadhoc\n"
+    "not a bssid line\n"
+    "02:00:00:00:00:07\tfreq\t-50\t[ESS]\tbroken\n"
+    "02:00:00:00:00:08\t5500\t-61\t[WPA-EAP-TKIP][WPA2-EAP-CCMP+TKIP][ESS]\tCorp";
+
+static const CHAR bss_text[] =
+    "id=4\n"
+    "bssid=02:00:00:00:00:02\n"
+    "freq=2437\n"
+    "beacon_int=100\n"
+    "capabilities=0x0431\n"
+    "qual=0\n"
+    "noise=-95\n"
+    "level=-45\n"
+    "tsf=0000001234567890\n"
+    "age=3\n"
+    "ie=000453696d48"
+    "010882848b960c121824"
+    "32043048606c"
+    "050400030000"
+    "0b050a00800000"
+    "2d1a" HEX_ZERO_26
+    "3d160605" HEX_ZERO_20 "\n"
+    "flags=[WPA2-PSK-CCMP][ESS]\n"
+    "ssid=SimH\n"
+    "====\n"
+    "id=7\n"
+    "bssid=02:00:00:00:00:05\n"
+    "freq=5180\n"
+    "beacon_int=102\n"
+    "capabilities=0x0011\n"
+    "noise=-92\n"
+    "level=-52\n"
+    "ie=01048c129824"
+    "2d1a" HEX_ZERO_26
+    "3d162405" HEX_ZERO_20
+    "bf0c" HEX_ZERO_12
+    "c005012a000000"
+    "ff0123\n"
+    "flags=[WPA2-PSK+SAE-CCMP][ESS]\n"
+    "ssid=Caf\\xc3\\xa9\n"
+    "====\n"
+    "id=8\n"
+    "freq=2412\n"
+    "ssid=no bssid\n"
+    "id=9\n"
+    "bssid=02:00:00:00:00:06\n"
+    "freq=2462\n"
+    "capabilities=0x0002\n"
+    "level=-88\n"
+    "ssid=adhoc\n";
+
+/* Parts the generated replies are made of, in the proportions of a busy scan */
+static const CHAR *fixture_flags[] = {
+    "[WPA2-PSK-CCMP][ESS]",
+    "[WPA2-PSK-CCMP][WPS][ESS]",
+    "[WPA-PSK-CCMP+TKIP][WPA2-PSK-CCMP+TKIP][ESS]",
+    "[WPA2-PSK+SAE-CCMP][ESS]",
+    "[WPA2-EAP-CCMP][ESS]",
+    "[ESS]",
+    "[WEP][ESS]",
+    "[WPA2-PSK-CCMP][ESS][P2P]",
+};
+static const UINT fixture_freqs[] = { 2412, 2437, 2462, 5180, 5220, 5500, 5745, 5805 };
+
+/* Builds a SCAN_RESULTS reply of lines BSSes into a heap block, NUL terminated */
+static CHAR *fixture_scan_results(UINT lines, size_t *len)
+{
+    size_t size = 64 + (size_t)lines * 128;
+    CHAR *text = malloc(size);
+    size_t pos;
+
+    if (text == NULL)
+    {
+        return NULL;
+    }
+    pos = (size_t)snprintf(text, size, "bssid / frequency / signal level / flags / ssid\n");
+    for (UINT i = 0; i < lines; i++)
+    {
+        pos += (size_t)snprintf(text + pos, size - pos, "%02x:%02x:%02x:%02x:%02x:%02x\t%u\t%d\t%s",
+                                0x02, 0x1a, (i >> 16) & 0xff, (i >> 8) & 0xff, i & 0xff, (i * 7) & 0xff,
+                                fixture_freqs[i % 8], -30 - (int)((i * 7) % 60), fixture_flags[(i / 8) % 8]);
+        switch (i % 10)
+        {
+            case 0:
+                /* Hidden */
+                break;
+            case 1:
+                pos += (size_t)snprintf(text + pos, size - pos, "\tCaf\\xc3\\xa9-%u", i);
+                break;
+            default:
+                pos += (size_t)snprintf(text + pos, size - pos, "\tNeighbour-%04u", i);
+                break;
+        }
+        text[pos++] = '\n';
+    }
+    text[pos] = '\0';
+    *len = pos;
+    return text;
+}
+
+static const CHAR *baseline_security(const CHAR *flags)
+{
+    if (strstr(flags, "WEP") != NULL)
+    {
+        return "WEP";
+    }
+    if (strstr(flags, "[WPA-PSK") != NULL && strstr(flags, "[WPA2-PSK") != NULL)
+    {
+        return "WPA-WPA2-Personal";
+    }
+    if (strstr(flags, "SAE") != NULL)
+    {
+        return "WPA3-Personal";
+    }
+    if (strstr(flags, "WPA2-EAP") != NULL)
+    {
+        return "WPA2-Enterprise";
+    }
+    if (strstr(flags, "EAP") != NULL)
+    {
+        return "WPA-Enterprise";
+    }
+    if (strstr(flags, "WPA2-PSK") != NULL)
+    {
+        return "WPA2-Personal";
+    }
+    return (strstr(flags, "PSK") != NULL) ? "WPA-Personal" : "None";
+}
+
+/* The strtok_r() parser the reference HAL had before wifi_scan_parse_results(), for comparison */
+static INT baseline_parse(CHAR *reply, wifi_neighbor_ap_t **out, UINT *count)
+{
+    char *line;
+    char *save = NULL;
+    UINT lines = 0;
+
+    *out = NULL;
+    *count = 0;
+    for (const char *p = strchr(reply, '\n'); p != NULL; p = strchr(p + 1, '\n'))
+    {
+        lines++;
+    }
+    if (lines == 0)
+    {
+        return RETURN_OK;
+    }
+    *out = malloc(lines * sizeof(wifi_neighbor_ap_t));
+    if (*out == NULL)
+    {
+        return RETURN_ERR;
+    }
+    line = strtok_r(reply, "\n", &save);
+    while ((line = strtok_r(NULL, "\n", &save)) != NULL)
+    {
+        char *fields[5];
+        char *field_save = NULL;
+        wifi_neighbor_ap_t *ap;
+        UINT freq;
+        int n = 0;
+
+        for (char *f = strtok_r(line, "\t", &field_save); f != NULL && n < 5; f = strtok_r(NULL, "\t", &field_save))
+        {
+            fields[n++] = f;
+        }
+        if (n < 4)
+        {
+            continue;
+        }
+        if (n == 4)
+        {
+            fields[4] = "";
+        }
+        ap = &(*out)[(*count)++];
+        freq = (UINT)strtoul(fields[1], NULL, 10);
+        memset(ap, 0, sizeof(*ap));
+        snprintf(ap->ap_SSID, sizeof(ap->ap_SSID), "%s", fields[4]);
+        snprintf(ap->ap_BSSID, sizeof(ap->ap_BSSID), "%s", fields[0]);
+        snprintf(ap->ap_Mode, sizeof(ap->ap_Mode), "%s", (strstr(fields[3], "[IBSS]") != NULL) ? "AdHoc" : "Infrastructure");
+        ap->ap_Channel = (freq < 3000) ? (freq - 2407) / 5 : (freq - 5000) / 5;
+        ap->ap_SignalStrength = (INT)strtol(fields[2], NULL, 10);
+        snprintf(ap->ap_SecurityModeEnabled, sizeof(ap->ap_SecurityModeEnabled), "%s", baseline_security(fields[3]));
+        snprintf(ap->ap_EncryptionMode, sizeof(ap->ap_EncryptionMode), "%s",
+                 (strstr(fields[3], "CCMP") != NULL && strstr(fields[3], "TKIP") != NULL) ? "AES+TKIP" :
+                 (strstr(fields[3], "CCMP") != NULL) ? "AES" : (strstr(fields[3], "TKIP") != NULL) ? "TKIP" : "None");
+        snprintf(ap->ap_OperatingFrequencyBand, sizeof(ap->ap_OperatingFrequencyBand), "%s",
+                 (freq < 3000) ? "2.4GHz" : "5GHz");
+    }
+    return RETURN_OK;
+}
+
+/* Deterministic, so a failing input can be reproduced from the iteration number */
+static uint32_t fuzz_next(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/* Checks the invariants every parse has to keep, whatever the input */
+static void check_parsed(const wifi_neighbor_ap_t *aps, UINT count, size_t len)
+{
+    UT_ASSERT_EQUAL(count == 0, aps == NULL);
+    /* Every entry takes at least a line of 20 bytes */
+    UT_ASSERT_EQUAL(count <= len / 20 + 1, 1);
+    for (UINT i = 0; i < count; i++)
+    {
+        UT_ASSERT_EQUAL(strnlen(aps[i].ap_SSID, sizeof(aps[i].ap_SSID)) < sizeof(aps[i].ap_SSID), 1);
+        UT_ASSERT_EQUAL(strlen(aps[i].ap_BSSID), 17);
+        UT_ASSERT_EQUAL(strnlen(aps[i].ap_SupportedDataTransferRates, sizeof(aps[i].ap_SupportedDataTransferRates)) <
+                        sizeof(aps[i].ap_SupportedDataTransferRates), 1);
+        UT_ASSERT_EQUAL(strnlen(aps[i].ap_SupportedStandards, sizeof(aps[i].ap_SupportedStandards)) <
+                        sizeof(aps[i].ap_SupportedStandards), 1);
+    }
+}
+
+/**
+* @brief Verify SCAN_RESULTS replies are parsed into neighbour entries
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Parse a reply with a header, a hidden SSID, escapes, CRLF and two bad lines | No filter | 7 entries, bad lines skipped | Should be successful |
+* | 02 | Check security, encryption, band, channel and mode | None | As in the flags | Should be successful |
+* | 03 | Check the allocations of a parse | Heap accounting | One block of exactly 7 entries | Should be successful |
+* | 04 | Parse with an SSID and a band filter | "SimHome", 5GHz | The one 5GHz SimHome entry | Should be successful |
+* | 05 | Parse the reply cut in the middle of the last entry, without a terminating NUL | len - 3 | SSID cut at the length | Should be successful |
+* | 06 | Parse an empty reply and bad arguments | "" / NULL | No array / RETURN_ERR | Should be successful |
+*/
+void test_l2_wifi_scan_parse_results (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    const wifi_hal_api_t scan = WIFI_HAL_API_wifi_getNeighboringWiFiDiagnosticResult;
+    wifi_scan_filter_t filter = { "SimHome", WIFI_HAL_FREQ_BAND_5GHZ };
+    size_t len = strlen(scan_results_text);
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT count = 0;
+
+    UT_ASSERT_EQUAL(wifi_scan_parse_results(scan_results_text, len, NULL, &aps, &count), RETURN_OK);
+    if (count != 7 || aps == NULL)
+    {
+        UT_FAIL_FATAL("SCAN_RESULTS reply did not parse into 7 entries");
+    }
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_SSID, "SimHome"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_BSSID, "02:00:00:00:00:01"), 0);
+    UT_ASSERT_EQUAL(aps[0].ap_Channel, 36);
+    UT_ASSERT_EQUAL(aps[0].ap_SignalStrength, -48);
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_SecurityModeEnabled, "WPA2-Personal"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_EncryptionMode, "AES"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_OperatingFrequencyBand, "5GHz"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_Mode, "Infrastructure"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[1].ap_SecurityModeEnabled, "WPA-WPA2-Personal"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[1].ap_EncryptionMode, "AES+TKIP"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[1].ap_OperatingFrequencyBand, "2.4GHz"), 0);
+    UT_ASSERT_EQUAL(aps[1].ap_Channel, 6);
+    UT_ASSERT_EQUAL(strcmp(aps[2].ap_SSID, "Office\\Guest"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[2].ap_SecurityModeEnabled, "WPA2-Enterprise"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[3].ap_SSID, ""), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[3].ap_SecurityModeEnabled, "None"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[3].ap_EncryptionMode, "None"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[4].ap_SSID, "Caf\xc3\xa9 \"Wi-Fi\""), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[4].ap_SecurityModeEnabled, "WPA3-Personal"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[5].ap_SecurityModeEnabled, "WEP"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[5].ap_Mode, "AdHoc"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[6].ap_SSID, "Corp"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[6].ap_SecurityModeEnabled, "WPA-WPA2-Enterprise"), 0);
+    /* SCAN_RESULTS has nothing to say about these */
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_SupportedStandards, ""), 0);
+    UT_ASSERT_EQUAL(aps[0].ap_BeaconPeriod, 0);
+    check_parsed(aps, count, len);
+    free(aps);
+
+    if (wifi_alloc_supported() && !wifi_alloc_active)
+    {
+        wifi_alloc_stats_t stats;
+
+        wifi_alloc_reset();
+        wifi_alloc_enable(1);
+        wifi_alloc_call_enter(scan);
+        UT_ASSERT_EQUAL(wifi_scan_parse_results(scan_results_text, len, NULL, &aps, &count), RETURN_OK);
+        wifi_alloc_call_exit(scan);
+        wifi_alloc_enable(0);
+        free(aps);
+        wifi_alloc_get(scan, &stats);
+        UT_LOG("Parse of %u entries: %llu allocations, %llu bytes\n", count, (unsigned long long)stats.allocs,
+               (unsigned long long)stats.bytes);
+        UT_ASSERT_EQUAL(stats.allocs, 1);
+        UT_ASSERT_EQUAL(stats.bytes, 7 * sizeof(wifi_neighbor_ap_t));
+        wifi_alloc_reset();
+    }
+
+    UT_ASSERT_EQUAL(wifi_scan_parse_results(scan_results_text, len, &filter, &aps, &count), RETURN_OK);
+    UT_ASSERT_EQUAL(count, 1);
+    if (count == 1)
+    {
+        UT_ASSERT_EQUAL(strcmp(aps[0].ap_BSSID, "02:00:00:00:00:01"), 0);
+    }
+    free(aps);
+    filter.ssid = "Caf\xc3\xa9 \"Wi-Fi\"";
+    filter.band = WIFI_HAL_FREQ_BAND_NONE;
+    UT_ASSERT_EQUAL(wifi_scan_parse_results(scan_results_text, len, &filter, &aps, &count), RETURN_OK);
+    UT_ASSERT_EQUAL(count, 1);
+    free(aps);
+
+    /* "Corp" cut to "C", the length is honoured rather than a NUL */
+    UT_ASSERT_EQUAL(wifi_scan_parse_results(scan_results_text, len - 3, NULL, &aps, &count), RETURN_OK);
+    UT_ASSERT_EQUAL(count, 7);
+    if (count == 7)
+    {
+        UT_ASSERT_EQUAL(strcmp(aps[6].ap_SSID, "C"), 0);
+    }
+    free(aps);
+
+    UT_ASSERT_EQUAL(wifi_scan_parse_results("", 0, NULL, &aps, &count), RETURN_OK);
+    UT_ASSERT_EQUAL(count, 0);
+    UT_ASSERT_PTR_NULL(aps);
+    UT_ASSERT_EQUAL(wifi_scan_parse_results(NULL, 0, NULL, &aps, &count), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_scan_parse_results(scan_results_text, len, NULL, NULL, &count), RETURN_ERR);
+
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify BSS replies are parsed, including their information elements
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Parse entries separated by "====" and by "id=" | No filter | 3 entries, the one without bssid skipped | Should be successful |
+* | 02 | Check a 2.4GHz entry with rates, TIM, BSS load and HT elements | None | b,g,n / 40MHz / DTIM 3 / 50% | Should be successful |
+* | 03 | Check a 5GHz entry with VHT and HE elements | None | a,n,ac,ax / 80MHz | Should be successful |
+* | 04 | Check an entry without flags or elements | capabilities=0x0002 | AdHoc, no standards | Should be successful |
+* | 05 | Parse with a band filter | 5GHz | The 5GHz entry | Should be successful |
+*/
+void test_l2_wifi_scan_parse_bss (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_scan_filter_t filter = { NULL, WIFI_HAL_FREQ_BAND_5GHZ };
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT count = 0;
+
+    UT_ASSERT_EQUAL(wifi_scan_parse_bss(bss_text, strlen(bss_text), NULL, &aps, &count), RETURN_OK);
+    if (count != 3 || aps == NULL)
+    {
+        UT_FAIL_FATAL("BSS reply did not parse into 3 entries");
+    }
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_SSID, "SimH"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_BSSID, "02:00:00:00:00:02"), 0);
+    UT_ASSERT_EQUAL(aps[0].ap_Channel, 6);
+    UT_ASSERT_EQUAL(aps[0].ap_SignalStrength, -45);
+    UT_ASSERT_EQUAL(aps[0].ap_Noise, -95);
+    UT_ASSERT_EQUAL(aps[0].ap_BeaconPeriod, 100);
+    UT_ASSERT_EQUAL(aps[0].ap_DTIMPeriod, 3);
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_SecurityModeEnabled, "WPA2-Personal"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_SupportedDataTransferRates, "1,2,5.5,11,6,9,12,18,24,36,48,54"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_BasicDataTransferRates, "1,2,5.5,11"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_SupportedStandards, "b,g,n"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_OperatingStandards, "n"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_OperatingChannelBandwidth, "40MHz"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[0].ap_ChannelUtilization, "50"), 0);
+
+    UT_ASSERT_EQUAL(strcmp(aps[1].ap_SSID, "Caf\xc3\xa9"), 0);
+    UT_ASSERT_EQUAL(aps[1].ap_Channel, 36);
+    UT_ASSERT_EQUAL(aps[1].ap_Noise, -92);
+    UT_ASSERT_EQUAL(strcmp(aps[1].ap_SecurityModeEnabled, "WPA3-Personal"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[1].ap_SupportedDataTransferRates, "6,9,12,18"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[1].ap_BasicDataTransferRates, "6,12"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[1].ap_SupportedStandards, "a,n,ac,ax"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[1].ap_OperatingStandards, "ax"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[1].ap_OperatingChannelBandwidth, "80MHz"), 0);
+
+    UT_ASSERT_EQUAL(strcmp(aps[2].ap_SSID, "adhoc"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[2].ap_Mode, "AdHoc"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[2].ap_SecurityModeEnabled, "None"), 0);
+    UT_ASSERT_EQUAL(strcmp(aps[2].ap_SupportedStandards, ""), 0);
+    check_parsed(aps, count, strlen(bss_text));
+    free(aps);
+
+    UT_ASSERT_EQUAL(wifi_scan_parse_bss(bss_text, strlen(bss_text), &filter, &aps, &count), RETURN_OK);
+    UT_ASSERT_EQUAL(count, 1);
+    if (count == 1)
+    {
+        UT_ASSERT_EQUAL(strcmp(aps[0].ap_BSSID, "02:00:00:00:00:05"), 0);
+    }
+    free(aps);
+
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify the parsers survive mutated and truncated replies
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 003 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Mutate a known reply: overwrite, insert separators, escapes and hex, truncate | Seeded xorshift, 3000 inputs per format | RETURN_OK, count bounded by the length | Should be successful |
+* | 02 | Copy each input into a block of exactly its length | No NUL | No read past the block | Checked under a memory checker |
+* | 03 | Check every returned entry | None | Strings terminated within their fields | Should be successful |
+*/
+void test_l2_wifi_scan_parse_fuzz (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    static const CHAR inserts[] = "\t\n\\x=[]-0f";
+    const CHAR *sources[2] = { scan_results_text, bss_text };
+    wifi_scan_filter_t filter = { "SimHome", WIFI_HAL_FREQ_BAND_NONE };
+    uint32_t state = PARSE_FUZZ_SEED;
+    UINT entries = 0;
+
+    for (int format = 0; format < 2; format++)
+    {
+        size_t source_len = strlen(sources[format]);
+
+        for (int i = 0; i < PARSE_FUZZ_ITERATIONS; i++)
+        {
+            CHAR *input = malloc(source_len + 16);
+            CHAR *exact;
+            size_t len = source_len;
+            int mutations = 1 + (int)(fuzz_next(&state) % 8);
+            wifi_neighbor_ap_t *aps = NULL;
+            UINT count = 0;
+            INT ret;
+
+            if (input == NULL)
+            {
+                UT_FAIL_FATAL("Out of memory");
+            }
+            memcpy(input, sources[format], source_len);
+            for (int m = 0; m < mutations && len > 0; m++)
+            {
+                size_t at = fuzz_next(&state) % len;
+
+                switch (fuzz_next(&state) % 3)
+                {
+                    case 0:
+                        input[at] = (CHAR)(fuzz_next(&state) & 0xff);
+                        break;
+                    case 1:
+                        if (len < source_len + 16)
+                        {
+                            memmove(input + at + 1, input + at, len - at);
+                            input[at] = inserts[fuzz_next(&state) % (sizeof(inserts) - 1)];
+                            len++;
+                        }
+                        break;
+                    default:
+                        memmove(input + at, input + at + 1, len - at - 1);
+                        len--;
+                        break;
+                }
+            }
+            len = fuzz_next(&state) % (len + 1);
+
+            /* No slack and no NUL after the text */
+            exact = malloc(len > 0 ? len : 1);
+            if (exact == NULL)
+            {
+                free(input);
+                UT_FAIL_FATAL("Out of memory");
+            }
+            memcpy(exact, input, len);
+            free(input);
+
+            ret = (format == 0) ? wifi_scan_parse_results(exact, len, NULL, &aps, &count)
+                                : wifi_scan_parse_bss(exact, len, NULL, &aps, &count);
+            UT_ASSERT_EQUAL(ret, RETURN_OK);
+            check_parsed(aps, count, len);
+            entries += count;
+            free(aps);
+
+            ret = (format == 0) ? wifi_scan_parse_results(exact, len, &filter, &aps, &count)
+                                : wifi_scan_parse_bss(exact, len, &filter, &aps, &count);
+            UT_ASSERT_EQUAL(ret, RETURN_OK);
+            check_parsed(aps, count, len);
+            for (UINT j = 0; j < count; j++)
+            {
+                UT_ASSERT_EQUAL(strcmp(aps[j].ap_SSID, "SimHome"), 0);
+            }
+            free(aps);
+            free(exact);
+        }
+    }
+    UT_LOG("%d mutated replies per format, %u entries parsed\n", PARSE_FUZZ_ITERATIONS, entries);
+
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Measure the parser on SCAN_RESULTS replies of 50, 500 and 5000 lines
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 004 @n
+* **Priority:** Medium @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Generate a reply of each size | Mixed bands, security, hidden and escaped SSIDs | None | Should be successful |
+* | 02 | Parse it with wifi_scan_parse_results() and with the strtok_r() parser | 50 iterations | Same BSSIDs, channels, levels, bands, security and modes | Should be successful |
+* | 03 | Log the median cost per line of both | None | Logged | Informational |
+*/
+void test_l2_wifi_scan_parse_benchmark (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    static const UINT sizes[] = { 50, 500, 5000 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        wifi_perf_samples_t parsed;
+        wifi_perf_samples_t baseline;
+        wifi_perf_summary_t parsed_summary;
+        wifi_perf_summary_t baseline_summary;
+        size_t len = 0;
+        CHAR *text = fixture_scan_results(sizes[s], &len);
+        CHAR *scratch = malloc(len + 1);
+        BOOL same = TRUE;
+
+        if (text == NULL || scratch == NULL)
+        {
+            free(text);
+            free(scratch);
+            UT_FAIL_FATAL("Out of memory");
+        }
+        wifi_perf_samples_init(&parsed, PARSE_BENCH_ITERATIONS);
+        wifi_perf_samples_init(&baseline, PARSE_BENCH_ITERATIONS);
+
+        for (int i = 0; i < PARSE_BENCH_ITERATIONS; i++)
+        {
+            wifi_neighbor_ap_t *aps = NULL;
+            wifi_neighbor_ap_t *old = NULL;
+            UINT count = 0;
+            UINT old_count = 0;
+            uint64_t start = wifi_perf_now_ns();
+
+            UT_ASSERT_EQUAL(wifi_scan_parse_results(text, len, NULL, &aps, &count), RETURN_OK);
+            wifi_perf_samples_add(&parsed, wifi_perf_now_ns() - start);
+
+            /* strtok_r() writes into the reply, which the HAL received into a buffer of its own */
+            start = wifi_perf_now_ns();
+            memcpy(scratch, text, len + 1);
+            UT_ASSERT_EQUAL(baseline_parse(scratch, &old, &old_count), RETURN_OK);
+            wifi_perf_samples_add(&baseline, wifi_perf_now_ns() - start);
+
+            if (i == 0)
+            {
+                same = (count == sizes[s] && old_count == count);
+                for (UINT j = 0; same && j < count; j++)
+                {
+                    same = (strcmp(aps[j].ap_BSSID, old[j].ap_BSSID) == 0 && aps[j].ap_Channel == old[j].ap_Channel &&
+                            aps[j].ap_SignalStrength == old[j].ap_SignalStrength &&
+                            strcmp(aps[j].ap_OperatingFrequencyBand, old[j].ap_OperatingFrequencyBand) == 0 &&
+                            strcmp(aps[j].ap_SecurityModeEnabled, old[j].ap_SecurityModeEnabled) == 0 &&
+                            strcmp(aps[j].ap_EncryptionMode, old[j].ap_EncryptionMode) == 0 &&
+                            strcmp(aps[j].ap_Mode, old[j].ap_Mode) == 0);
+                }
+            }
+            free(aps);
+            free(old);
+        }
+        UT_ASSERT_EQUAL(same, TRUE);
+
+        wifi_perf_summarize(&parsed, &parsed_summary);
+        wifi_perf_summarize(&baseline, &baseline_summary);
+        UT_LOG("%5u lines (%6zu bytes): wifi_scan_parse %7.1f ns/line, strtok_r %7.1f ns/line, %.2fx\n", sizes[s], len,
+               parsed_summary.p50 / sizes[s], baseline_summary.p50 / sizes[s],
+               (parsed_summary.p50 > 0) ? baseline_summary.p50 / parsed_summary.p50 : 0.0);
+
+        wifi_perf_samples_free(&parsed);
+        wifi_perf_samples_free(&baseline);
+        free(scratch);
+        free(text);
+    }
+
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_scan_parse = NULL;
+
+/**
+ * @brief Register the scan parser tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_scan_parse_register_l2_tests (void)
+{
+    pSuite_scan_parse = UT_add_suite("[L2 wifi_scan_parse tests]", NULL, NULL);
+    if (pSuite_scan_parse == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_scan_parse, "l2_wifi_scan_parse_results", test_l2_wifi_scan_parse_results);
+    UT_add_test(pSuite_scan_parse, "l2_wifi_scan_parse_bss", test_l2_wifi_scan_parse_bss);
+    UT_add_test(pSuite_scan_parse, "l2_wifi_scan_parse_fuzz", test_l2_wifi_scan_parse_fuzz);
+    UT_add_test(pSuite_scan_parse, "l2_wifi_scan_parse_benchmark", test_l2_wifi_scan_parse_benchmark);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_SCAN_PARSE_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
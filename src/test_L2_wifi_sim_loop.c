@@ -0,0 +1,544 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_SIM_LOOP_HALTEST_L2 RDK-V WiFi Simulator Event Loop L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the simulator event loop :
+ *
+ * Checks the timing the simulator event loop gives asynchronous operations:
+ * scans that dwell on each channel passed to wifi_setRadioScanningFreqList(),
+ * connect and disconnect callbacks after the modelled handshake, and the
+ * telemetry markers sent for each completion. Every duration is measured
+ * several times and checked against the model, so the tests also show how
+ * reproducible the timing is.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_sim_loop.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stats.h"
+#include "wifi_sim.h"
+
+#define LOOP_SCAN_DWELL_MS 20
+#define LOOP_HANDSHAKE_MS 80
+#define LOOP_DISCONNECT_MS 30
+#define LOOP_ITERATIONS 5
+#define LOOP_SLACK_MS 15
+#define LOOP_CALLBACK_TIMEOUT_MS 2000
+#define LOOP_MAX_EVENTS 32
+
+/**
+ * @brief One telemetry marker received
+ */
+typedef struct
+{
+    CHAR marker[64];
+    CHAR text[64];          /*!< event_s value, empty for event_d */
+    INT value;              /*!< event_d value */
+} loop_event_t;
+
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t state_changed = PTHREAD_COND_INITIALIZER;
+static int connect_count = 0;
+static int disconnect_count = 0;
+static wifiStatusCode_t last_status = WIFI_HAL_SUCCESS;
+static uint64_t callback_ns = 0;
+static loop_event_t events[LOOP_MAX_EVENTS];
+static int event_count = 0;
+static CHAR telemetry_name[32];
+
+/* Caller holds state_lock */
+static void loop_record_locked(const char *marker, const char *text, int value)
+{
+    if (event_count < LOOP_MAX_EVENTS)
+    {
+        snprintf(events[event_count].marker, sizeof(events[event_count].marker), "%s", marker);
+        snprintf(events[event_count].text, sizeof(events[event_count].text), "%s", text);
+        events[event_count].value = value;
+        event_count++;
+    }
+}
+
+static void loop_record(const char *marker, const char *text, int value)
+{
+    pthread_mutex_lock(&state_lock);
+    loop_record_locked(marker, text, value);
+    pthread_cond_broadcast(&state_changed);
+    pthread_mutex_unlock(&state_lock);
+}
+
+static void loop_telemetry_init(char *name)
+{
+    snprintf(telemetry_name, sizeof(telemetry_name), "%s", name);
+}
+
+static void loop_telemetry_s(char *marker, char *value)
+{
+    loop_record(marker, value, 0);
+}
+
+static void loop_telemetry_d(char *marker, int value)
+{
+    loop_record(marker, "", value);
+}
+
+static wifi_telemetry_ops_t loop_telemetry = {
+    .init = loop_telemetry_init,
+    .event_s = loop_telemetry_s,
+    .event_d = loop_telemetry_d,
+};
+
+static INT loop_connect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    uint64_t now = wifi_perf_now_ns();
+
+    pthread_mutex_lock(&state_lock);
+    connect_count++;
+    last_status = *error;
+    callback_ns = now;
+    /* Recorded beside the markers, which must come before it */
+    loop_record_locked("callback", AP_SSID, (int)*error);
+    pthread_cond_broadcast(&state_changed);
+    pthread_mutex_unlock(&state_lock);
+    return RETURN_OK;
+}
+
+static INT loop_disconnect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    uint64_t now = wifi_perf_now_ns();
+
+    pthread_mutex_lock(&state_lock);
+    disconnect_count++;
+    last_status = *error;
+    callback_ns = now;
+    pthread_cond_broadcast(&state_changed);
+    pthread_mutex_unlock(&state_lock);
+    return RETURN_OK;
+}
+
+static void loop_reset_events(void)
+{
+    pthread_mutex_lock(&state_lock);
+    connect_count = 0;
+    disconnect_count = 0;
+    last_status = WIFI_HAL_SUCCESS;
+    callback_ns = 0;
+    event_count = 0;
+    pthread_mutex_unlock(&state_lock);
+}
+
+/* Waits for *count to reach 1, returns the time of the callback or 0 on timeout */
+static uint64_t loop_wait(int *count)
+{
+    struct timespec deadline;
+    uint64_t when;
+    int ret = 0;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += LOOP_CALLBACK_TIMEOUT_MS / 1000;
+    pthread_mutex_lock(&state_lock);
+    while (*count == 0 && ret == 0)
+    {
+        ret = pthread_cond_timedwait(&state_changed, &state_lock, &deadline);
+    }
+    when = (*count > 0) ? callback_ns : 0;
+    pthread_mutex_unlock(&state_lock);
+    return when;
+}
+
+/* Index of the first recorded event with this marker, -1 if none. Caller holds state_lock */
+static int loop_find_event_locked(const char *marker)
+{
+    for (int i = 0; i < event_count; i++)
+    {
+        if (strcmp(events[i].marker, marker) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int loop_find_event(const char *marker)
+{
+    int found;
+
+    pthread_mutex_lock(&state_lock);
+    found = loop_find_event_locked(marker);
+    pthread_mutex_unlock(&state_lock);
+    return found;
+}
+
+/* As loop_find_event(), for markers sent after the waiter has been woken */
+static int loop_wait_event(const char *marker)
+{
+    struct timespec deadline;
+    int found;
+    int ret = 0;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += LOOP_CALLBACK_TIMEOUT_MS / 1000;
+    pthread_mutex_lock(&state_lock);
+    while ((found = loop_find_event_locked(marker)) < 0 && ret == 0)
+    {
+        ret = pthread_cond_timedwait(&state_changed, &state_lock, &deadline);
+    }
+    pthread_mutex_unlock(&state_lock);
+    return found;
+}
+
+/* Fresh, initialised simulator with the test timings and telemetry */
+static void loop_setup(void)
+{
+    wifi_sim_timing_t timing;
+
+    wifi_sim_reset();
+    wifi_sim_get_timing(&timing);
+    timing.scan_dwell_ms = LOOP_SCAN_DWELL_MS;
+    timing.handshake_ms = LOOP_HANDSHAKE_MS;
+    timing.disconnect_ms = LOOP_DISCONNECT_MS;
+    wifi_sim_set_timing(&timing);
+    wifi_sim_init(NULL);
+    telemetry_name[0] = '\0';
+    wifi_sim_telemetry_callback_register(&loop_telemetry);
+    wifi_sim_connectEndpoint_callback_register(loop_connect_callback);
+    wifi_sim_disconnectEndpoint_callback_register(loop_disconnect_callback);
+    loop_reset_events();
+}
+
+static INT loop_connect(const char *ssid)
+{
+    CHAR ssid_buf[64];
+    CHAR passphrase[] = "simulated-passphrase";
+    CHAR empty[1] = "";
+
+    snprintf(ssid_buf, sizeof(ssid_buf), "%s", ssid);
+    return wifi_sim_connectEndpoint(1, ssid_buf, WIFI_SECURITY_WPA2_PSK_AES, empty, empty, passphrase, 0, empty, empty,
+                                    empty, empty);
+}
+
+/* TRUE if a duration in nanoseconds is at least the model and within LOOP_SLACK_MS of it */
+static BOOL loop_on_time(double elapsed_ns, UINT model_ms)
+{
+    return (elapsed_ns >= model_ms * 1e6 && elapsed_ns <= (model_ms + LOOP_SLACK_MS) * 1e6) ? TRUE : FALSE;
+}
+
+/**
+* @brief Verify scans take the dwell time of each channel in the frequency list
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Scan 1, 3 and 6 channels 5 times each, wait for the results | 20 ms dwell | Every scan within 15 ms over channels * 20 ms | Should be successful |
+* | 02 | Check the scan telemetry of the last scan | None | WIFI_INFO_SCAN_MS of channels * 20 ms | Should be successful |
+* | 03 | Log p50 and spread of each list | None | None | Should be successful |
+*/
+void test_l2_wifi_sim_loop_scan (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    static const struct
+    {
+        const char *freqs;
+        UINT channels;
+    } lists[] = {
+        { "5180", 1 },
+        { "2412 2437 2462", 3 },
+        { "2412,2437,2462,5180,5200,5745", 6 },
+    };
+    wifi_perf_samples_t samples;
+    wifi_perf_summary_t summary;
+
+    if (wifi_perf_samples_init(&samples, LOOP_ITERATIONS) != 0)
+    {
+        UT_FAIL_FATAL("Cannot allocate samples");
+    }
+    loop_setup();
+    UT_ASSERT_EQUAL(strcmp(telemetry_name, WIFI_SIM_TELEMETRY_NAME), 0);
+
+    UT_LOG("\n| %-32s | model ms | p50 ms | min ms | max ms |\n", "frequencies");
+    for (size_t l = 0; l < sizeof(lists) / sizeof(lists[0]); l++)
+    {
+        UINT model_ms = lists[l].channels * LOOP_SCAN_DWELL_MS;
+        int marker;
+
+        wifi_perf_samples_clear(&samples);
+        for (int i = 0; i < LOOP_ITERATIONS; i++)
+        {
+            uint64_t start;
+
+            loop_reset_events();
+            start = wifi_perf_now_ns();
+            UT_ASSERT_EQUAL(wifi_sim_setRadioScanningFreqList(1, lists[l].freqs), RETURN_OK);
+            UT_ASSERT_EQUAL(wifi_sim_waitForScanResults(), RETURN_OK);
+            wifi_perf_samples_add(&samples, wifi_perf_now_ns() - start);
+        }
+        wifi_perf_summarize(&samples, &summary);
+        UT_LOG("| %-32s | %8u | %6.2f | %6.2f | %6.2f |\n", lists[l].freqs, model_ms, summary.p50 / 1e6,
+               summary.min / 1e6, summary.max / 1e6);
+        UT_ASSERT_TRUE(loop_on_time(summary.min, model_ms));
+        UT_ASSERT_TRUE(loop_on_time(summary.max, model_ms));
+
+        marker = loop_wait_event(WIFI_SIM_MARKER_SCAN_MS);
+        UT_ASSERT_TRUE(marker >= 0);
+        if (marker >= 0)
+        {
+            UT_ASSERT_TRUE(events[marker].value >= (INT)model_ms && events[marker].value <= (INT)(model_ms + LOOP_SLACK_MS));
+        }
+    }
+
+    wifi_sim_telemetry_callback_register(NULL);
+    wifi_perf_samples_free(&samples);
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify connect and disconnect callbacks and their telemetry follow the modelled delays
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Connect and disconnect 5 times | SimHome, 80 ms handshake, 30 ms disconnect | Callbacks within 15 ms of the model | Should be successful |
+* | 02 | Check the telemetry of each | None | WIFI_INFO_CONNECTED and WIFI_INFO_CONNECT_MS before the connect callback, WIFI_INFO_DISCONNECTED | Should be successful |
+* | 03 | Connect to an SSID that is not there | NoSuchAP | WIFI_HAL_ERROR_NOT_FOUND, WIFI_ERROR_CONNECT_FAILED with that code | Should be successful |
+*/
+void test_l2_wifi_sim_loop_callbacks (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_perf_samples_t connect_time;
+    wifi_perf_samples_t disconnect_time;
+    wifi_perf_summary_t connect_summary;
+    wifi_perf_summary_t disconnect_summary;
+    CHAR ssid[] = "SimHome";
+    int marker;
+
+    if (wifi_perf_samples_init(&connect_time, LOOP_ITERATIONS) != 0)
+    {
+        UT_FAIL_FATAL("Cannot allocate samples");
+    }
+    if (wifi_perf_samples_init(&disconnect_time, LOOP_ITERATIONS) != 0)
+    {
+        wifi_perf_samples_free(&connect_time);
+        UT_FAIL_FATAL("Cannot allocate samples");
+    }
+    loop_setup();
+
+    for (int i = 0; i < LOOP_ITERATIONS; i++)
+    {
+        uint64_t start;
+        uint64_t done;
+        int callback;
+
+        loop_reset_events();
+        start = wifi_perf_now_ns();
+        UT_ASSERT_EQUAL(loop_connect("SimHome"), RETURN_OK);
+        done = loop_wait(&connect_count);
+        UT_ASSERT_EQUAL(last_status, WIFI_HAL_CONNECTED);
+        if (done != 0)
+        {
+            wifi_perf_samples_add(&connect_time, done - start);
+        }
+        marker = loop_find_event(WIFI_SIM_MARKER_CONNECTED);
+        callback = loop_find_event("callback");
+        UT_ASSERT_TRUE(marker >= 0 && marker < callback);
+        if (marker >= 0)
+        {
+            UT_ASSERT_EQUAL(strcmp(events[marker].text, "SimHome"), 0);
+        }
+        marker = loop_find_event(WIFI_SIM_MARKER_CONNECT_MS);
+        UT_ASSERT_TRUE(marker >= 0 && marker < callback);
+        if (marker >= 0)
+        {
+            UT_ASSERT_TRUE(events[marker].value >= LOOP_HANDSHAKE_MS &&
+                           events[marker].value <= LOOP_HANDSHAKE_MS + LOOP_SLACK_MS);
+        }
+
+        loop_reset_events();
+        start = wifi_perf_now_ns();
+        UT_ASSERT_EQUAL(wifi_sim_disconnectEndpoint(1, ssid), RETURN_OK);
+        done = loop_wait(&disconnect_count);
+        UT_ASSERT_EQUAL(last_status, WIFI_HAL_DISCONNECTED);
+        if (done != 0)
+        {
+            wifi_perf_samples_add(&disconnect_time, done - start);
+        }
+        marker = loop_wait_event(WIFI_SIM_MARKER_DISCONNECTED);
+        UT_ASSERT_TRUE(marker >= 0);
+        if (marker >= 0)
+        {
+            UT_ASSERT_EQUAL(strcmp(events[marker].text, "SimHome"), 0);
+        }
+    }
+
+    wifi_perf_summarize(&connect_time, &connect_summary);
+    wifi_perf_summarize(&disconnect_time, &disconnect_summary);
+    UT_LOG("\nconnect callback: p50 %.2f ms, min %.2f ms, max %.2f ms (model %d ms)\n", connect_summary.p50 / 1e6,
+           connect_summary.min / 1e6, connect_summary.max / 1e6, LOOP_HANDSHAKE_MS);
+    UT_LOG("disconnect callback: p50 %.2f ms, min %.2f ms, max %.2f ms (model %d ms)\n", disconnect_summary.p50 / 1e6,
+           disconnect_summary.min / 1e6, disconnect_summary.max / 1e6, LOOP_DISCONNECT_MS);
+    UT_ASSERT_EQUAL(connect_summary.count, LOOP_ITERATIONS);
+    UT_ASSERT_EQUAL(disconnect_summary.count, LOOP_ITERATIONS);
+    UT_ASSERT_TRUE(loop_on_time(connect_summary.min, LOOP_HANDSHAKE_MS));
+    UT_ASSERT_TRUE(loop_on_time(connect_summary.max, LOOP_HANDSHAKE_MS));
+    UT_ASSERT_TRUE(loop_on_time(disconnect_summary.min, LOOP_DISCONNECT_MS));
+    UT_ASSERT_TRUE(loop_on_time(disconnect_summary.max, LOOP_DISCONNECT_MS));
+
+    loop_reset_events();
+    UT_ASSERT_EQUAL(loop_connect("NoSuchAP"), RETURN_OK);
+    UT_ASSERT_TRUE(loop_wait(&connect_count) != 0);
+    UT_ASSERT_EQUAL(last_status, WIFI_HAL_ERROR_NOT_FOUND);
+    marker = loop_find_event(WIFI_SIM_MARKER_CONNECT_FAILED);
+    UT_ASSERT_TRUE(marker >= 0);
+    if (marker >= 0)
+    {
+        UT_ASSERT_EQUAL(events[marker].value, WIFI_HAL_ERROR_NOT_FOUND);
+    }
+    UT_ASSERT_EQUAL(loop_find_event(WIFI_SIM_MARKER_CONNECTED), -1);
+
+    wifi_sim_telemetry_callback_register(NULL);
+    wifi_perf_samples_free(&connect_time);
+    wifi_perf_samples_free(&disconnect_time);
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify overlapping operations complete in deadline order on the event loop
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 003 @n
+* **Priority:** Medium @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Start a 6 channel scan, then connect | 120 ms scan, 80 ms handshake | Connect telemetry and callback before the scan telemetry | Should be successful |
+* | 02 | Wait for the scan | None | Scan still takes 120 ms from its start | Should be successful |
+*/
+void test_l2_wifi_sim_loop_overlap (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    uint64_t start;
+    uint64_t elapsed;
+
+    loop_setup();
+    start = wifi_perf_now_ns();
+    UT_ASSERT_EQUAL(wifi_sim_setRadioScanningFreqList(1, "2412 2437 2462 5180 5200 5745"), RETURN_OK);
+    UT_ASSERT_EQUAL(loop_connect("SimHome"), RETURN_OK);
+    UT_ASSERT_TRUE(loop_wait(&connect_count) != 0);
+    UT_ASSERT_EQUAL(wifi_sim_waitForScanResults(), RETURN_OK);
+    elapsed = wifi_perf_now_ns() - start;
+
+    UT_ASSERT_TRUE(loop_find_event("callback") >= 0);
+    UT_ASSERT_TRUE(loop_wait_event(WIFI_SIM_MARKER_SCAN_MS) > loop_find_event("callback"));
+    UT_ASSERT_TRUE(loop_on_time((double)elapsed, 6 * LOOP_SCAN_DWELL_MS));
+    UT_LOG("\nscan with a connect on the loop: %.2f ms (model %d ms)\n", elapsed / 1e6, 6 * LOOP_SCAN_DWELL_MS);
+
+    wifi_sim_telemetry_callback_register(NULL);
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_sim_loop = NULL;
+
+/**
+ * @brief Register the simulator event loop tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_sim_loop_register_l2_tests (void)
+{
+    pSuite_sim_loop = UT_add_suite("[L2 wifi_sim_loop tests]", NULL, NULL);
+    if (pSuite_sim_loop == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_sim_loop, "l2_wifi_sim_loop_scan", test_l2_wifi_sim_loop_scan);
+    UT_add_test(pSuite_sim_loop, "l2_wifi_sim_loop_callbacks", test_l2_wifi_sim_loop_callbacks);
+    UT_add_test(pSuite_sim_loop, "l2_wifi_sim_loop_overlap", test_l2_wifi_sim_loop_overlap);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_SIM_LOOP_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,717 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_SIM_RF_HALTEST_L2 RDK-V WiFi Simulator RF Model L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the simulator RF model :
+ *
+ * Checks the RF model of the simulator against its formulas: signal from
+ * log-distance path loss along a mobility path, access points dropping out
+ * below the sensitivity, the spread and correlation of the seeded fading,
+ * the link statistics following the model until the link is lost, and the
+ * pre- and post-association roaming control of wifi_setRoamingControl().
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_sim_rf.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_sim.h"
+
+#define RF_HANDSHAKE_MS 80
+#define RF_SCAN_DWELL_MS 20
+#define RF_SLACK_MS 15
+#define RF_TIMEOUT_MS 3000
+#define RF_FADING_TICKS 2000
+/* Size of sta_BSSID in wifi_sta_stats_t, so the copy of a BSSID never truncates */
+#define RF_BSSID_SIZE 64
+#define RF_HOME_BSSID "02:00:00:00:00:01"
+#define RF_OPEN_BSSID "02:00:00:00:00:04"
+#define RF_FAR_BSSID "02:00:00:00:00:05"
+
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t state_changed = PTHREAD_COND_INITIALIZER;
+static int connect_count = 0;
+static wifiStatusCode_t last_status = WIFI_HAL_SUCCESS;
+static int link_lost_count = 0;
+static int roam_ms = -1;
+
+static INT rf_connect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    pthread_mutex_lock(&state_lock);
+    connect_count++;
+    last_status = *error;
+    pthread_cond_broadcast(&state_changed);
+    pthread_mutex_unlock(&state_lock);
+    return RETURN_OK;
+}
+
+static void rf_telemetry_init(char *name)
+{
+}
+
+static void rf_telemetry_s(char *marker, char *value)
+{
+    pthread_mutex_lock(&state_lock);
+    if (strcmp(marker, WIFI_SIM_MARKER_LINK_LOST) == 0)
+    {
+        link_lost_count++;
+    }
+    pthread_mutex_unlock(&state_lock);
+}
+
+static void rf_telemetry_d(char *marker, int value)
+{
+    pthread_mutex_lock(&state_lock);
+    if (strcmp(marker, WIFI_SIM_MARKER_ROAM_MS) == 0)
+    {
+        roam_ms = value;
+    }
+    pthread_mutex_unlock(&state_lock);
+}
+
+static wifi_telemetry_ops_t rf_telemetry = {
+    .init = rf_telemetry_init,
+    .event_s = rf_telemetry_s,
+    .event_d = rf_telemetry_d,
+};
+
+/* Waits for the connect callback to have run count times, returns its last status or WIFI_HAL_ERROR_UNKNOWN on timeout */
+static wifiStatusCode_t rf_wait_connect(int count)
+{
+    struct timespec deadline;
+    wifiStatusCode_t status;
+    int ret = 0;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += RF_TIMEOUT_MS / 1000;
+    pthread_mutex_lock(&state_lock);
+    while (connect_count < count && ret == 0)
+    {
+        ret = pthread_cond_timedwait(&state_changed, &state_lock, &deadline);
+    }
+    status = (connect_count >= count) ? last_status : WIFI_HAL_ERROR_UNKNOWN;
+    pthread_mutex_unlock(&state_lock);
+    return status;
+}
+
+/* Fresh, initialised simulator with the test timings, callbacks and telemetry */
+static void rf_setup(void)
+{
+    wifi_sim_timing_t timing;
+
+    wifi_sim_reset();
+    wifi_sim_get_timing(&timing);
+    timing.handshake_ms = RF_HANDSHAKE_MS;
+    timing.scan_dwell_ms = RF_SCAN_DWELL_MS;
+    wifi_sim_set_timing(&timing);
+    wifi_sim_init(NULL);
+    wifi_sim_connectEndpoint_callback_register(rf_connect_callback);
+    wifi_sim_telemetry_callback_register(&rf_telemetry);
+
+    pthread_mutex_lock(&state_lock);
+    connect_count = 0;
+    last_status = WIFI_HAL_SUCCESS;
+    link_lost_count = 0;
+    roam_ms = -1;
+    pthread_mutex_unlock(&state_lock);
+}
+
+/* Enabled model without fading or jitter: 20 dBm, 40 dB at 1 m, exponent 3 */
+static void rf_base(wifi_sim_rf_t *rf, BOOL realtime)
+{
+    wifi_sim_get_rf(rf);
+    rf->enable = TRUE;
+    rf->realtime = realtime;
+    rf->tick_ms = 100;
+    rf->fading_sigma_db = 0.0;
+    rf->noise_sigma_db = 0.0;
+    rf->utilization_sigma = 0.0;
+    rf->noise_floor_dbm = -92;
+    rf->sensitivity_dbm = -90;
+    rf->waypoint_count = 0;
+    rf->ap_count = 0;
+}
+
+static void rf_place(wifi_sim_rf_t *rf, const char *bssid, double x, double y)
+{
+    wifi_sim_rf_ap_t *ap = &rf->aps[rf->ap_count++];
+
+    memset(ap, 0, sizeof(*ap));
+    snprintf(ap->bssid, sizeof(ap->bssid), "%s", bssid);
+    ap->x_m = x;
+    ap->y_m = y;
+    ap->tx_power_dbm = 20;
+    ap->utilization = 30;
+}
+
+static void rf_waypoint(wifi_sim_rf_t *rf, UINT t_ms, double x, double y)
+{
+    wifi_sim_waypoint_t *w = &rf->path[rf->waypoint_count++];
+
+    w->t_ms = t_ms;
+    w->x_m = x;
+    w->y_m = y;
+}
+
+/* Signal the model gives at a distance */
+static INT rf_expected(double distance)
+{
+    return (INT)lround(20.0 - 40.0 - 30.0 * log10(distance));
+}
+
+/* Looks an access point up in the neighbour results, FALSE if it is not heard */
+static BOOL rf_heard(const char *bssid, wifi_neighbor_ap_t *found)
+{
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT count = 0;
+    BOOL heard = FALSE;
+
+    if (wifi_sim_getNeighboringWiFiDiagnosticResult(1, &aps, &count) != RETURN_OK)
+    {
+        return FALSE;
+    }
+    for (UINT i = 0; i < count && !heard; i++)
+    {
+        if (strcmp(aps[i].ap_BSSID, bssid) == 0)
+        {
+            *found = aps[i];
+            heard = TRUE;
+        }
+    }
+    free(aps);
+    return heard;
+}
+
+static INT rf_connect(const char *ssid)
+{
+    CHAR ssid_buf[64];
+    CHAR passphrase[] = "simulated-passphrase";
+    CHAR empty[1] = "";
+
+    snprintf(ssid_buf, sizeof(ssid_buf), "%s", ssid);
+    return wifi_sim_connectEndpoint(1, ssid_buf, WIFI_SECURITY_WPA2_PSK_AES, empty, empty, passphrase, 0, empty, empty,
+                                    empty, empty);
+}
+
+/* Default population plus a second SimHome access point on channel 149 */
+static void rf_two_homes(void)
+{
+    wifi_neighbor_ap_t *aps = NULL;
+    wifi_neighbor_ap_t population[5];
+    UINT count = 0;
+
+    wifi_sim_getNeighboringWiFiDiagnosticResult(1, &aps, &count);
+    memcpy(population, aps, 4 * sizeof(*aps));
+    free(aps);
+    population[4] = population[0];
+    snprintf(population[4].ap_BSSID, sizeof(population[4].ap_BSSID), "%s", RF_FAR_BSSID);
+    population[4].ap_Channel = 149;
+    wifi_sim_set_aps(population, 5);
+}
+
+/**
+* @brief Verify the signal follows log-distance path loss along the mobility path
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Place SimHome at 0 m and SimOpen at 300 m, walk from 10 m to 100 m in 10 ticks | No fading | SimHome at 20 - 40 - 30 log10(d) dBm at ticks 0, 5 and 10, noise -92 dBm, utilisation 30 | Should be successful |
+* | 02 | Check SimOpen | -90 dBm sensitivity | Not heard at 290 m, heard at 200 m | Should be successful |
+* | 03 | Step past the end of the path | 20 ticks | Signal stays at the last waypoint | Should be successful |
+* | 04 | Check the unplaced access points | SimHome-2G | Configured -45 dBm unchanged | Should be successful |
+*/
+void test_l2_wifi_sim_rf_path_loss (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_sim_rf_t rf;
+    wifi_neighbor_ap_t ap;
+
+    rf_setup();
+    rf_base(&rf, FALSE);
+    rf_place(&rf, RF_HOME_BSSID, 0.0, 0.0);
+    rf_place(&rf, RF_OPEN_BSSID, 300.0, 0.0);
+    rf_waypoint(&rf, 0, 10.0, 0.0);
+    rf_waypoint(&rf, 1000, 100.0, 0.0);
+    UT_ASSERT_EQUAL(wifi_sim_set_rf(&rf), RETURN_OK);
+
+    UT_LOG("\n| tick | distance m | expected dBm | SimHome dBm |\n");
+    for (UINT tick = 0; tick <= 10; tick += 5)
+    {
+        double distance = 10.0 + 9.0 * tick;
+
+        UT_ASSERT_TRUE(rf_heard(RF_HOME_BSSID, &ap));
+        UT_LOG("| %4u | %10.1f | %12d | %11d |\n", tick, distance, rf_expected(distance), ap.ap_SignalStrength);
+        UT_ASSERT_EQUAL(ap.ap_SignalStrength, rf_expected(distance));
+        UT_ASSERT_EQUAL(ap.ap_Noise, -92);
+        UT_ASSERT_EQUAL(strcmp(ap.ap_ChannelUtilization, "30"), 0);
+        if (tick == 0)
+        {
+            UT_ASSERT_FALSE(rf_heard(RF_OPEN_BSSID, &ap));
+        }
+        UT_ASSERT_EQUAL(wifi_sim_rf_step(5), RETURN_OK);
+    }
+
+    UT_ASSERT_TRUE(rf_heard(RF_OPEN_BSSID, &ap));
+    UT_ASSERT_EQUAL(ap.ap_SignalStrength, rf_expected(200.0));
+
+    UT_ASSERT_EQUAL(wifi_sim_rf_step(20), RETURN_OK);
+    UT_ASSERT_TRUE(rf_heard(RF_HOME_BSSID, &ap));
+    UT_ASSERT_EQUAL(ap.ap_SignalStrength, rf_expected(100.0));
+
+    UT_ASSERT_TRUE(rf_heard("02:00:00:00:00:02", &ap));
+    UT_ASSERT_EQUAL(ap.ap_SignalStrength, -45);
+
+    /* A realtime model is not stepped, a path going back in time is refused */
+    rf.realtime = TRUE;
+    UT_ASSERT_EQUAL(wifi_sim_set_rf(&rf), RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_sim_rf_step(1), RETURN_ERR);
+    rf.path[1].t_ms = 0;
+    UT_ASSERT_EQUAL(wifi_sim_set_rf(&rf), RETURN_ERR);
+
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+typedef struct
+{
+    double mean;
+    double stddev;
+    double lag1;                 /*!< Correlation of consecutive ticks */
+} rf_trace_stats_t;
+
+/* Records the signal of SimHome over RF_FADING_TICKS ticks */
+static void rf_trace(UINT seed, double correlation, INT *trace, rf_trace_stats_t *stats)
+{
+    wifi_sim_rf_t rf;
+    wifi_neighbor_ap_t ap;
+    double sum = 0.0;
+    double sq = 0.0;
+    double cross = 0.0;
+
+    rf_base(&rf, FALSE);
+    rf.seed = seed;
+    rf.fading_sigma_db = 4.0;
+    rf.fading_correlation = correlation;
+    rf_place(&rf, RF_HOME_BSSID, 0.0, 0.0);
+    rf_waypoint(&rf, 0, 10.0, 0.0);
+    wifi_sim_set_rf(&rf);
+
+    for (int i = 0; i < RF_FADING_TICKS; i++)
+    {
+        trace[i] = rf_heard(RF_HOME_BSSID, &ap) ? ap.ap_SignalStrength : 0;
+        wifi_sim_rf_step(1);
+    }
+
+    for (int i = 0; i < RF_FADING_TICKS; i++)
+    {
+        sum += trace[i];
+    }
+    stats->mean = sum / RF_FADING_TICKS;
+    for (int i = 0; i < RF_FADING_TICKS; i++)
+    {
+        sq += (trace[i] - stats->mean) * (trace[i] - stats->mean);
+        if (i > 0)
+        {
+            cross += (trace[i] - stats->mean) * (trace[i - 1] - stats->mean);
+        }
+    }
+    stats->stddev = sqrt(sq / (RF_FADING_TICKS - 1));
+    stats->lag1 = (sq > 0.0) ? cross / sq : 0.0;
+}
+
+/**
+* @brief Verify the fading has the configured spread and correlation and replays from its seed
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Record SimHome at 10 m for 2000 ticks without correlation | 4 dB sigma, seed 1 | Mean -50 dBm within 1 dB, deviation 3.5 to 4.5 dB, lag 1 correlation below 0.1 | Should be successful |
+* | 02 | Record again with correlation | 0.9 | Mean within 1.5 dB, deviation 3.2 to 4.8 dB, lag 1 correlation 0.85 to 0.95 | Should be successful |
+* | 03 | Record with the same seed and another seed | Seeds 1 and 2 | Same seed gives the same trace, the other seed does not | Should be successful |
+*/
+void test_l2_wifi_sim_rf_fading (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    INT *first = calloc(RF_FADING_TICKS, sizeof(INT));
+    INT *second = calloc(RF_FADING_TICKS, sizeof(INT));
+    rf_trace_stats_t white;
+    rf_trace_stats_t correlated;
+    rf_trace_stats_t replay;
+
+    if (first == NULL || second == NULL)
+    {
+        free(first);
+        free(second);
+        UT_FAIL_FATAL("Cannot allocate traces");
+    }
+    rf_setup();
+
+    rf_trace(1, 0.0, first, &white);
+    rf_trace(1, 0.9, second, &correlated);
+    UT_LOG("\n| correlation | mean dBm | deviation dB | lag 1 |\n");
+    UT_LOG("| %11.1f | %8.2f | %12.2f | %5.2f |\n", 0.0, white.mean, white.stddev, white.lag1);
+    UT_LOG("| %11.1f | %8.2f | %12.2f | %5.2f |\n", 0.9, correlated.mean, correlated.stddev, correlated.lag1);
+
+    UT_ASSERT_TRUE(fabs(white.mean + 50.0) <= 1.0);
+    UT_ASSERT_TRUE(white.stddev >= 3.5 && white.stddev <= 4.5);
+    UT_ASSERT_TRUE(fabs(white.lag1) < 0.1);
+    UT_ASSERT_TRUE(fabs(correlated.mean + 50.0) <= 1.5);
+    UT_ASSERT_TRUE(correlated.stddev >= 3.2 && correlated.stddev <= 4.8);
+    UT_ASSERT_TRUE(correlated.lag1 >= 0.85 && correlated.lag1 <= 0.95);
+
+    rf_trace(1, 0.9, first, &replay);
+    UT_ASSERT_EQUAL(memcmp(first, second, RF_FADING_TICKS * sizeof(INT)), 0);
+    rf_trace(2, 0.9, first, &replay);
+    UT_ASSERT_TRUE(memcmp(first, second, RF_FADING_TICKS * sizeof(INT)) != 0);
+
+    free(first);
+    free(second);
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify the link statistics follow the model until the link is lost
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 003 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Connect to SimHome at 10 m | No fading | RSSI -50 dBm, noise -92 dBm, PHY rate 866.7 Mb/s | Should be successful |
+* | 02 | Walk to 127 m | 3 ticks | RSSI -83 dBm, PHY rate 130 Mb/s at 9 dB SNR | Should be successful |
+* | 03 | Walk on below the sensitivity | 244 m | WIFI_HAL_ERROR_CONNECTION_LOST, WIFI_ERROR_LINK_LOST, statistics cleared, one link lost | Should be successful |
+*/
+void test_l2_wifi_sim_rf_link (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_sim_rf_t rf;
+    wifi_sta_stats_t sta;
+    wifi_sim_roam_t roam;
+    wifi_neighbor_ap_t ap;
+
+    rf_setup();
+    rf_base(&rf, FALSE);
+    rf_place(&rf, RF_HOME_BSSID, 0.0, 0.0);
+    rf_waypoint(&rf, 0, 10.0, 0.0);
+    rf_waypoint(&rf, 1000, 400.0, 0.0);
+    UT_ASSERT_EQUAL(wifi_sim_set_rf(&rf), RETURN_OK);
+
+    UT_ASSERT_EQUAL(rf_connect("SimHome"), RETURN_OK);
+    UT_ASSERT_EQUAL(rf_wait_connect(1), WIFI_HAL_CONNECTED);
+    UT_ASSERT_EQUAL(wifi_sim_getStats(1, &sta), RETURN_OK);
+    UT_ASSERT_EQUAL((INT)sta.sta_RSSI, -50);
+    UT_ASSERT_EQUAL((INT)sta.sta_Noise, -92);
+    UT_ASSERT_TRUE(fabs(sta.sta_PhyRate - 866.7f) < 0.1f);
+
+    UT_ASSERT_EQUAL(wifi_sim_rf_step(3), RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_sim_getStats(1, &sta), RETURN_OK);
+    UT_LOG("\nat 127 m: RSSI %.0f dBm, noise %.0f dBm, PHY rate %.1f Mb/s\n", sta.sta_RSSI, sta.sta_Noise, sta.sta_PhyRate);
+    UT_ASSERT_EQUAL((INT)sta.sta_RSSI, rf_expected(127.0));
+    UT_ASSERT_TRUE(fabs(sta.sta_PhyRate - 130.0f) < 0.1f);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_BSSID, RF_HOME_BSSID), 0);
+
+    UT_ASSERT_EQUAL(wifi_sim_rf_step(3), RETURN_OK);
+    UT_ASSERT_EQUAL(rf_wait_connect(2), WIFI_HAL_ERROR_CONNECTION_LOST);
+    UT_ASSERT_EQUAL(link_lost_count, 1);
+    UT_ASSERT_EQUAL(wifi_sim_getStats(1, &sta), RETURN_OK);
+    UT_ASSERT_EQUAL(sta.sta_SSID[0], '\0');
+    UT_ASSERT_FALSE(rf_heard(RF_HOME_BSSID, &ap));
+    wifi_sim_get_roam(&roam);
+    UT_ASSERT_EQUAL(roam.links_lost, 1);
+
+    /* Out of range, so nothing to connect to */
+    UT_ASSERT_EQUAL(rf_connect("SimHome"), RETURN_OK);
+    UT_ASSERT_EQUAL(rf_wait_connect(3), WIFI_HAL_ERROR_NOT_FOUND);
+
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+/* Connects to SimSteer with a 5 GHz and a 2.4 GHz access point, returns the BSSID chosen */
+static void rf_steer(INT signal_5g, INT signal_24g, BOOL roaming, CHAR *bssid, size_t size)
+{
+    wifi_neighbor_ap_t *aps = NULL;
+    wifi_neighbor_ap_t population[2];
+    wifi_roamingCtrl_t ctrl;
+    wifi_sta_stats_t sta;
+    UINT count = 0;
+    int before;
+
+    wifi_sim_getNeighboringWiFiDiagnosticResult(1, &aps, &count);
+    population[0] = aps[0];
+    population[1] = aps[1];
+    free(aps);
+    snprintf(population[0].ap_SSID, sizeof(population[0].ap_SSID), "SimSteer");
+    snprintf(population[1].ap_SSID, sizeof(population[1].ap_SSID), "SimSteer");
+    population[0].ap_SignalStrength = signal_5g;
+    population[1].ap_SignalStrength = signal_24g;
+    wifi_sim_set_aps(population, 2);
+
+    memset(&ctrl, 0, sizeof(ctrl));
+    ctrl.roamingEnable = roaming;
+    ctrl.preassnBestThreshold = -70;
+    ctrl.preassnBestDelta = 5;
+    wifi_sim_setRoamingControl(1, &ctrl);
+
+    pthread_mutex_lock(&state_lock);
+    before = connect_count;
+    pthread_mutex_unlock(&state_lock);
+    bssid[0] = '\0';
+    if (rf_connect("SimSteer") == RETURN_OK && rf_wait_connect(before + 1) == WIFI_HAL_CONNECTED &&
+        wifi_sim_getStats(1, &sta) == RETURN_OK)
+    {
+        snprintf(bssid, size, "%s", sta.sta_BSSID);
+    }
+}
+
+/**
+* @brief Verify the pre-association roaming control chooses between the bands
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 004 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Connect with 5 GHz above the threshold, 2.4 GHz 10 dB stronger | -60 / -50 dBm, threshold -70, delta 5 | 2.4 GHz | Should be successful |
+* | 02 | Connect with 2.4 GHz 3 dB stronger | -60 / -57 dBm | 5 GHz | Should be successful |
+* | 03 | Connect with 5 GHz below the threshold | -75 / -74 dBm | 2.4 GHz | Should be successful |
+* | 04 | Connect without roaming | -60 / -50 dBm | First of the population, 5 GHz | Should be successful |
+*/
+void test_l2_wifi_sim_rf_band_steering (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    CHAR bssid[RF_BSSID_SIZE];
+
+    rf_setup();
+    rf_steer(-60, -50, TRUE, bssid, sizeof(bssid));
+    UT_ASSERT_EQUAL(strcmp(bssid, "02:00:00:00:00:02"), 0);
+    rf_steer(-60, -57, TRUE, bssid, sizeof(bssid));
+    UT_ASSERT_EQUAL(strcmp(bssid, RF_HOME_BSSID), 0);
+    rf_steer(-75, -74, TRUE, bssid, sizeof(bssid));
+    UT_ASSERT_EQUAL(strcmp(bssid, "02:00:00:00:00:02"), 0);
+    rf_steer(-60, -50, FALSE, bssid, sizeof(bssid));
+    UT_ASSERT_EQUAL(strcmp(bssid, RF_HOME_BSSID), 0);
+
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+/* Walks from SimHome at 0 m towards the second SimHome at 60 m in 1 s and returns the roaming record */
+static void rf_walk(BOOL roaming, INT far_tx_power_dbm, wifi_sim_roam_t *roam)
+{
+    wifi_sim_rf_t rf;
+    wifi_roamingCtrl_t ctrl;
+
+    rf_setup();
+    rf_two_homes();
+    rf_base(&rf, TRUE);
+    rf.tick_ms = 20;
+    rf.roam_second_ms = 10;
+    rf_place(&rf, RF_HOME_BSSID, 0.0, 0.0);
+    rf_place(&rf, RF_FAR_BSSID, 60.0, 0.0);
+    rf.aps[1].tx_power_dbm = far_tx_power_dbm;
+    rf_waypoint(&rf, 0, 5.0, 0.0);
+    rf_waypoint(&rf, 1000, 55.0, 0.0);
+
+    memset(&ctrl, 0, sizeof(ctrl));
+    ctrl.roamingEnable = roaming;
+    ctrl.preassnBestThreshold = -70;
+    ctrl.preassnBestDelta = 5;
+    ctrl.postAssnLevelDeltaConnected = 12;
+    ctrl.postAssnSelfSteerThreshold = -70;
+    ctrl.postAssnSelfSteerTimeframe = 2;
+    ctrl.postAssnBackOffTime = 2;
+    wifi_sim_setRoamingControl(1, &ctrl);
+
+    wifi_sim_set_rf(&rf);
+    rf_connect("SimHome");
+    UT_ASSERT_EQUAL(rf_wait_connect(1), WIFI_HAL_CONNECTED);
+
+    for (int waited = 0; waited < 1300; waited += 10)
+    {
+        wifi_sim_get_roam(roam);
+        if (roam->roams > 0)
+        {
+            break;
+        }
+        wifi_perf_sleep_ms(10);
+    }
+}
+
+/**
+* @brief Verify the post-association roaming control hands the link over while walking away
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 005 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Walk from 5 m to 55 m of SimHome towards a second SimHome on channel 149 | 20 ms ticks, threshold -70 dBm for 2 s, delta 12 dB, 10 ms seconds | One roam to the second access point | Should be successful |
+* | 02 | Check the roam timeline | 2 channel roam scan, 80 ms handshake | Scan 40 ms and handshake 80 ms within 15 ms, WIFI_INFO_ROAM_MS, connect callback | Should be successful |
+* | 03 | Walk again without roaming | roamingEnable 0 | No roam, still on SimHome | Should be successful |
+* | 04 | Walk again with a second access point too weak to clear the delta | -20 dBm | No roam, failed roam scans | Should be successful |
+*/
+void test_l2_wifi_sim_rf_roaming (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_sim_roam_t roam;
+    wifi_sta_stats_t sta;
+    double scan_ms;
+    double handshake_ms;
+
+    rf_walk(TRUE, 20, &roam);
+    UT_ASSERT_EQUAL(roam.roams, 1);
+    UT_ASSERT_EQUAL(strcmp(roam.from_bssid, RF_HOME_BSSID), 0);
+    UT_ASSERT_EQUAL(strcmp(roam.to_bssid, RF_FAR_BSSID), 0);
+    UT_ASSERT_TRUE(roam.below_ns != 0 && roam.below_ns <= roam.triggered_ns);
+    UT_ASSERT_TRUE(roam.triggered_ns <= roam.scanned_ns && roam.scanned_ns <= roam.connected_ns);
+
+    scan_ms = (roam.scanned_ns - roam.triggered_ns) / 1e6;
+    handshake_ms = (roam.connected_ns - roam.scanned_ns) / 1e6;
+    UT_LOG("\nroam: detection %.1f ms, scan %.1f ms, handshake %.1f ms\n", (roam.triggered_ns - roam.below_ns) / 1e6,
+           scan_ms, handshake_ms);
+    UT_ASSERT_TRUE(scan_ms >= 2 * RF_SCAN_DWELL_MS && scan_ms <= 2 * RF_SCAN_DWELL_MS + RF_SLACK_MS);
+    UT_ASSERT_TRUE(handshake_ms >= RF_HANDSHAKE_MS && handshake_ms <= RF_HANDSHAKE_MS + RF_SLACK_MS);
+    UT_ASSERT_EQUAL(rf_wait_connect(2), WIFI_HAL_CONNECTED);
+    UT_ASSERT_TRUE(roam_ms >= 2 * RF_SCAN_DWELL_MS + RF_HANDSHAKE_MS);
+    UT_ASSERT_EQUAL(wifi_sim_getStats(1, &sta), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_BSSID, RF_FAR_BSSID), 0);
+
+    rf_walk(FALSE, 20, &roam);
+    UT_ASSERT_EQUAL(roam.roams, 0);
+    UT_ASSERT_EQUAL(wifi_sim_getStats(1, &sta), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_BSSID, RF_HOME_BSSID), 0);
+
+    rf_walk(TRUE, -20, &roam);
+    UT_LOG("weak second access point: %lu failed roam scans\n", roam.failed);
+    UT_ASSERT_EQUAL(roam.roams, 0);
+    UT_ASSERT_TRUE(roam.failed >= 1);
+    UT_ASSERT_EQUAL(wifi_sim_getStats(1, &sta), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_BSSID, RF_HOME_BSSID), 0);
+
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_sim_rf = NULL;
+
+/**
+ * @brief Register the simulator RF model tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_sim_rf_register_l2_tests (void)
+{
+    pSuite_sim_rf = UT_add_suite("[L2 wifi_sim_rf tests]", NULL, NULL);
+    if (pSuite_sim_rf == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_sim_rf, "l2_wifi_sim_rf_path_loss", test_l2_wifi_sim_rf_path_loss);
+    UT_add_test(pSuite_sim_rf, "l2_wifi_sim_rf_fading", test_l2_wifi_sim_rf_fading);
+    UT_add_test(pSuite_sim_rf, "l2_wifi_sim_rf_link", test_l2_wifi_sim_rf_link);
+    UT_add_test(pSuite_sim_rf, "l2_wifi_sim_rf_band_steering", test_l2_wifi_sim_rf_band_steering);
+    UT_add_test(pSuite_sim_rf, "l2_wifi_sim_rf_roaming", test_l2_wifi_sim_rf_roaming);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_SIM_RF_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
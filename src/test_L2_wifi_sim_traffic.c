@@ -0,0 +1,618 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_SIM_TRAFFIC_HALTEST_L2 RDK-V WiFi Simulator Workload L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the simulator workload model :
+ *
+ * Runs the idle, web and adaptive bitrate video workloads of
+ * simulator/include/wifi_sim.h and checks the rates computed from two reads
+ * of wifi_sim_getSSIDTrafficStats() against the workload, and every counter
+ * against the ground truth the model keeps.
+ *
+ * The stepped tests run minutes of model time in a few milliseconds. The
+ * free throughput of the link, 650 Mb/s on SimHome, is set through the
+ * channel utilisation of the access point.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_sim_traffic.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_sim.h"
+
+#define TRAFFIC_HANDSHAKE_MS 20
+#define TRAFFIC_CALLBACK_TIMEOUT_MS 2000
+#define TRAFFIC_TICK_MS 100
+#define TRAFFIC_TICKS_PER_S (1000 / TRAFFIC_TICK_MS)
+#define TRAFFIC_WARMUP_S 40
+#define TRAFFIC_MEASURE_S 60
+#define TRAFFIC_RATE_TOLERANCE 0.05
+#define TRAFFIC_WEB_S 600
+#define TRAFFIC_LINK_KBPS 650000
+#define TRAFFIC_BSSID "02:00:00:00:00:01"
+
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t state_changed = PTHREAD_COND_INITIALIZER;
+static int connect_count = 0;
+
+static INT traffic_connect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    pthread_mutex_lock(&state_lock);
+    connect_count++;
+    pthread_cond_broadcast(&state_changed);
+    pthread_mutex_unlock(&state_lock);
+    return RETURN_OK;
+}
+
+/* Fresh, initialised simulator connected to SimHome */
+static int traffic_setup(void)
+{
+    wifi_sim_timing_t timing;
+    CHAR ssid[] = "SimHome";
+    CHAR passphrase[] = "simulated-passphrase";
+    CHAR empty[1] = "";
+    struct timespec deadline;
+    int ret = 0;
+
+    wifi_sim_reset();
+    wifi_sim_get_timing(&timing);
+    timing.handshake_ms = TRAFFIC_HANDSHAKE_MS;
+    wifi_sim_set_timing(&timing);
+    wifi_sim_init(NULL);
+    wifi_sim_connectEndpoint_callback_register(traffic_connect_callback);
+
+    pthread_mutex_lock(&state_lock);
+    connect_count = 0;
+    pthread_mutex_unlock(&state_lock);
+    if (wifi_sim_connectEndpoint(1, ssid, WIFI_SECURITY_WPA2_PSK_AES, empty, empty, passphrase, 0, empty, empty, empty,
+                                 empty) != RETURN_OK)
+    {
+        return -1;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += TRAFFIC_CALLBACK_TIMEOUT_MS / 1000;
+    pthread_mutex_lock(&state_lock);
+    while (connect_count == 0 && ret == 0)
+    {
+        ret = pthread_cond_timedwait(&state_changed, &state_lock, &deadline);
+    }
+    pthread_mutex_unlock(&state_lock);
+    return (connect_count > 0) ? 0 : -1;
+}
+
+/* Stepped model of a workload on the defaults */
+static void traffic_base(wifi_sim_workload_t *workload, wifi_sim_workload_kind_t kind)
+{
+    wifi_sim_get_workload(workload);
+    workload->enable = TRUE;
+    workload->realtime = FALSE;
+    workload->tick_ms = TRAFFIC_TICK_MS;
+    workload->kind = kind;
+}
+
+/* Sets the channel utilisation of the access point of the link */
+static void traffic_utilization(UINT percent)
+{
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT count = 0;
+
+    if (wifi_sim_getNeighboringWiFiDiagnosticResult(1, &aps, &count) != RETURN_OK)
+    {
+        return;
+    }
+    for (UINT i = 0; i < count; i++)
+    {
+        if (strcmp(aps[i].ap_BSSID, TRAFFIC_BSSID) == 0)
+        {
+            snprintf(aps[i].ap_ChannelUtilization, sizeof(aps[i].ap_ChannelUtilization), "%u", percent);
+        }
+    }
+    wifi_sim_set_aps(aps, count);
+    free(aps);
+}
+
+/* Received data rate in kb/s between two reads taken seconds apart */
+static double traffic_kbps(const wifi_ssidTrafficStats_t *before, const wifi_ssidTrafficStats_t *after, UINT seconds)
+{
+    return (double)(after->ssid_BytesReceived - before->ssid_BytesReceived) * 8.0 / 1000.0 / seconds;
+}
+
+/* TRUE if the counters moved by exactly the traffic */
+static BOOL traffic_matches(const wifi_ssidTrafficStats_t *before, const wifi_ssidTrafficStats_t *after,
+                            const wifi_sim_traffic_t *traffic)
+{
+    return (after->ssid_BytesSent - before->ssid_BytesSent == traffic->bytes_sent &&
+            after->ssid_BytesReceived - before->ssid_BytesReceived == traffic->bytes_received &&
+            after->ssid_PacketsSent - before->ssid_PacketsSent == traffic->packets_sent &&
+            after->ssid_PacketsReceived - before->ssid_PacketsReceived == traffic->packets_received &&
+            after->ssid_MulticastPacketsReceived - before->ssid_MulticastPacketsReceived == traffic->multicast_received &&
+            after->ssid_UnicastPacketsReceived - before->ssid_UnicastPacketsReceived ==
+                traffic->packets_received - traffic->multicast_received &&
+            after->ssid_RetransCount - before->ssid_RetransCount == traffic->retransmissions &&
+            after->ssid_DiscardedPacketsReceived - before->ssid_DiscardedPacketsReceived == traffic->discards_received)
+        ? TRUE : FALSE;
+}
+
+/**
+* @brief Verify the video workload picks the rendition the free throughput allows and averages its bitrate
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Connect, set the utilisation of SimHome and start the video workload | 99, 98, 97, 96 and 30 percent, 4 to 25 Mb/s ladder | RETURN_OK | Should be successful |
+* | 02 | Run 40 s to fill the buffer, then measure the received rate over 60 s | None | 4, 8, 12, 16 and 25 Mb/s within 5%, no stall or switch | Should be successful |
+* | 03 | Compare the counter deltas with the ground truth | wifi_sim_get_workload_state() | Equal | Should be successful |
+* | 04 | Log one row per utilisation | None | None | Should be successful |
+*/
+void test_l2_wifi_sim_traffic_video_ladder (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    static const UINT utilization[] = { 99, 98, 97, 96, 30 };
+    static const UINT expected[] = { 4000, 8000, 12000, 16000, 25000 };
+    wifi_sim_workload_t workload;
+    wifi_sim_workload_state_t start;
+    wifi_sim_workload_state_t end;
+    wifi_ssidTrafficStats_t before;
+    wifi_ssidTrafficStats_t after;
+
+    if (traffic_setup() != 0)
+    {
+        UT_FAIL_FATAL("Cannot connect to SimHome");
+    }
+
+    UT_LOG("\n| utilisation %% | free Mb/s | rendition Mb/s | measured Mb/s | segments |\n");
+    for (size_t i = 0; i < sizeof(utilization) / sizeof(utilization[0]); i++)
+    {
+        wifi_sim_traffic_t delta;
+        double kbps;
+
+        traffic_utilization(utilization[i]);
+        traffic_base(&workload, WIFI_SIM_WORKLOAD_VIDEO);
+        UT_ASSERT_EQUAL(wifi_sim_set_workload(&workload), RETURN_OK);
+        UT_ASSERT_EQUAL(wifi_sim_workload_step(TRAFFIC_WARMUP_S * TRAFFIC_TICKS_PER_S), RETURN_OK);
+        wifi_sim_get_workload_state(&start);
+        UT_ASSERT_EQUAL(wifi_sim_getSSIDTrafficStats(1, &before), RETURN_OK);
+        UT_ASSERT_EQUAL(wifi_sim_workload_step(TRAFFIC_MEASURE_S * TRAFFIC_TICKS_PER_S), RETURN_OK);
+        wifi_sim_get_workload_state(&end);
+        UT_ASSERT_EQUAL(wifi_sim_getSSIDTrafficStats(1, &after), RETURN_OK);
+
+        kbps = traffic_kbps(&before, &after, TRAFFIC_MEASURE_S);
+        UT_LOG("| %13u | %9.1f | %14.1f | %13.2f | %8lu |\n", utilization[i],
+               TRAFFIC_LINK_KBPS * (100 - utilization[i]) / 100 / 1000.0, end.rendition_kbps / 1000.0, kbps / 1000.0,
+               end.segments - start.segments);
+
+        UT_ASSERT_EQUAL(end.rendition_kbps, expected[i]);
+        UT_ASSERT_TRUE(kbps >= expected[i] * (1.0 - TRAFFIC_RATE_TOLERANCE));
+        UT_ASSERT_TRUE(kbps <= expected[i] * (1.0 + TRAFFIC_RATE_TOLERANCE));
+        UT_ASSERT_EQUAL(end.stalls, 0);
+        UT_ASSERT_EQUAL(end.switches, 0);
+
+        delta.bytes_sent = end.total.bytes_sent - start.total.bytes_sent;
+        delta.bytes_received = end.total.bytes_received - start.total.bytes_received;
+        delta.packets_sent = end.total.packets_sent - start.total.packets_sent;
+        delta.packets_received = end.total.packets_received - start.total.packets_received;
+        delta.multicast_received = end.total.multicast_received - start.total.multicast_received;
+        delta.retransmissions = end.total.retransmissions - start.total.retransmissions;
+        delta.discards_received = end.total.discards_received - start.total.discards_received;
+        UT_ASSERT_TRUE(traffic_matches(&before, &after, &delta));
+    }
+
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify the video workload switches rendition and stalls as the free throughput changes
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Run the video workload for 40 s with SimHome 30% utilised | None | 25 Mb/s rendition | Should be successful |
+* | 02 | Raise the utilisation, run 40 s | 99% | One switch down to 4 Mb/s, no stall | Should be successful |
+* | 03 | Leave no throughput, run 20 s | 100% | Buffer empty, one stall | Should be successful |
+* | 04 | Restore the utilisation, run 40 s | 30% | Back at 25 Mb/s after a second switch, playing | Should be successful |
+*/
+void test_l2_wifi_sim_traffic_video_abr (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_sim_workload_t workload;
+    wifi_sim_workload_state_t state;
+
+    if (traffic_setup() != 0)
+    {
+        UT_FAIL_FATAL("Cannot connect to SimHome");
+    }
+    traffic_base(&workload, WIFI_SIM_WORKLOAD_VIDEO);
+    UT_ASSERT_EQUAL(wifi_sim_set_workload(&workload), RETURN_OK);
+
+    wifi_sim_workload_step(40 * TRAFFIC_TICKS_PER_S);
+    wifi_sim_get_workload_state(&state);
+    UT_ASSERT_EQUAL(state.rendition_kbps, 25000);
+
+    traffic_utilization(99);
+    wifi_sim_workload_step(40 * TRAFFIC_TICKS_PER_S);
+    wifi_sim_get_workload_state(&state);
+    UT_LOG("99%% utilised: %u kb/s, buffer %u ms, %lu switches, %lu stalls\n", state.rendition_kbps, state.buffer_ms,
+           state.switches, state.stalls);
+    UT_ASSERT_EQUAL(state.rendition_kbps, 4000);
+    UT_ASSERT_EQUAL(state.switches, 1);
+    UT_ASSERT_EQUAL(state.stalls, 0);
+
+    traffic_utilization(100);
+    wifi_sim_workload_step(20 * TRAFFIC_TICKS_PER_S);
+    wifi_sim_get_workload_state(&state);
+    UT_LOG("100%% utilised: buffer %u ms, %lu stalls\n", state.buffer_ms, state.stalls);
+    UT_ASSERT_EQUAL(state.buffer_ms, 0);
+    UT_ASSERT_EQUAL(state.stalls, 1);
+
+    traffic_utilization(30);
+    wifi_sim_workload_step(40 * TRAFFIC_TICKS_PER_S);
+    wifi_sim_get_workload_state(&state);
+    UT_LOG("30%% utilised: %u kb/s, buffer %u ms, %lu switches, %lu stalls\n", state.rendition_kbps, state.buffer_ms,
+           state.switches, state.stalls);
+    UT_ASSERT_EQUAL(state.rendition_kbps, 25000);
+    UT_ASSERT_EQUAL(state.switches, 2);
+    UT_ASSERT_EQUAL(state.stalls, 1);
+    UT_ASSERT_TRUE(state.buffer_ms >= workload.buffer_ms - workload.segment_ms);
+
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify the web workload is bursty around its mean page size and think time
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 003 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Run the web workload for 600 s, reading the counters every second | 2000 kB pages, 10 s think time | RETURN_OK | Should be successful |
+* | 02 | Count pages and seconds with data | None | 40 to 80 pages, data in under 20% of the seconds | Should be successful |
+* | 03 | Compare the busiest second with the mean rate | None | At least 10 times the mean | Should be successful |
+* | 04 | Compare the counters with the ground truth | wifi_sim_get_workload_state() | Equal | Should be successful |
+*/
+void test_l2_wifi_sim_traffic_web (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_sim_workload_t workload;
+    wifi_sim_workload_state_t state;
+    wifi_ssidTrafficStats_t first;
+    wifi_ssidTrafficStats_t before;
+    wifi_ssidTrafficStats_t after;
+    ULONG background;
+    ULONG peak = 0;
+    UINT active = 0;
+    double mean_kbps;
+
+    if (traffic_setup() != 0)
+    {
+        UT_FAIL_FATAL("Cannot connect to SimHome");
+    }
+    traffic_base(&workload, WIFI_SIM_WORKLOAD_WEB);
+    UT_ASSERT_EQUAL(wifi_sim_set_workload(&workload), RETURN_OK);
+    /* The multicast frames of a second, 200 bytes each */
+    background = workload.multicast_pps * 200;
+
+    UT_ASSERT_EQUAL(wifi_sim_getSSIDTrafficStats(1, &first), RETURN_OK);
+    before = first;
+    for (UINT s = 0; s < TRAFFIC_WEB_S; s++)
+    {
+        ULONG bytes;
+
+        wifi_sim_workload_step(TRAFFIC_TICKS_PER_S);
+        wifi_sim_getSSIDTrafficStats(1, &after);
+        bytes = after.ssid_BytesReceived - before.ssid_BytesReceived;
+        if (bytes > background)
+        {
+            active++;
+        }
+        if (bytes > peak)
+        {
+            peak = bytes;
+        }
+        before = after;
+    }
+    wifi_sim_get_workload_state(&state);
+
+    mean_kbps = traffic_kbps(&first, &after, TRAFFIC_WEB_S);
+    UT_LOG("%lu pages, data in %u of %u s, mean %.2f Mb/s, busiest second %.1f Mb/s\n", state.pages, active,
+           TRAFFIC_WEB_S, mean_kbps / 1000.0, peak * 8.0 / 1e6);
+    UT_ASSERT_TRUE(state.pages >= 40 && state.pages <= 80);
+    UT_ASSERT_TRUE(active < TRAFFIC_WEB_S / 5);
+    UT_ASSERT_TRUE(peak * 8.0 / 1000.0 >= 10.0 * mean_kbps);
+    UT_ASSERT_TRUE(traffic_matches(&first, &after, &state.total));
+
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify the packet, multicast, retry and discard counts of the workloads
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 004 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Set invalid models | ladder not ascending, tick_ms 0, retry_ratio 2 | RETURN_ERR, stepping a disabled model fails | Should be successful |
+* | 02 | Run the idle workload for 100 s | 20 multicast frames/s | 2000 multicast frames of 200 bytes, nothing else received | Should be successful |
+* | 03 | Run the video workload for 60 s | retry_ratio 0.05, discard_ratio 0.001 | Frames of 1500 bytes, an acknowledgement every second frame, the ratios rounded down once | Should be successful |
+* | 04 | Compare radio, SSID and station counters | None | Same bytes and packets, unicast and multicast add up, retransmissions on the station | Should be successful |
+* | 05 | Disconnect and run 20 s | None | No traffic, playback stalls | Should be successful |
+*/
+void test_l2_wifi_sim_traffic_counters (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_sim_workload_t workload;
+    wifi_sim_workload_t invalid;
+    wifi_sim_workload_state_t state;
+    wifi_radioTrafficStats_t radio;
+    wifi_ssidTrafficStats_t before;
+    wifi_ssidTrafficStats_t after;
+    wifi_sta_stats_t sta;
+    CHAR ssid[] = "SimHome";
+    ULONG data_frames;
+
+    if (traffic_setup() != 0)
+    {
+        UT_FAIL_FATAL("Cannot connect to SimHome");
+    }
+
+    traffic_base(&invalid, WIFI_SIM_WORKLOAD_VIDEO);
+    invalid.renditions_kbps[1] = invalid.renditions_kbps[0];
+    UT_ASSERT_EQUAL(wifi_sim_set_workload(&invalid), RETURN_ERR);
+    traffic_base(&invalid, WIFI_SIM_WORKLOAD_IDLE);
+    invalid.tick_ms = 0;
+    UT_ASSERT_EQUAL(wifi_sim_set_workload(&invalid), RETURN_ERR);
+    traffic_base(&invalid, WIFI_SIM_WORKLOAD_IDLE);
+    invalid.retry_ratio = 2.0;
+    UT_ASSERT_EQUAL(wifi_sim_set_workload(&invalid), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_sim_set_workload(NULL), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_sim_workload_step(1), RETURN_ERR);
+
+    /* Idle: background multicast only */
+    traffic_base(&workload, WIFI_SIM_WORKLOAD_IDLE);
+    UT_ASSERT_EQUAL(wifi_sim_set_workload(&workload), RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_sim_getSSIDTrafficStats(1, &before), RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_sim_workload_step(100 * TRAFFIC_TICKS_PER_S), RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_sim_getSSIDTrafficStats(1, &after), RETURN_OK);
+    wifi_sim_get_workload_state(&state);
+    UT_ASSERT_EQUAL(state.total.multicast_received, 100 * workload.multicast_pps);
+    UT_ASSERT_EQUAL(state.total.packets_received, state.total.multicast_received);
+    UT_ASSERT_EQUAL(state.total.bytes_received, state.total.multicast_received * 200);
+    UT_ASSERT_EQUAL(state.total.packets_sent, 0);
+    UT_ASSERT_EQUAL(after.ssid_UnicastPacketsReceived, before.ssid_UnicastPacketsReceived);
+    UT_ASSERT_TRUE(traffic_matches(&before, &after, &state.total));
+
+    /* Video: frame accounting */
+    traffic_base(&workload, WIFI_SIM_WORKLOAD_VIDEO);
+    UT_ASSERT_EQUAL(wifi_sim_set_workload(&workload), RETURN_OK);
+    before = after;
+    UT_ASSERT_EQUAL(wifi_sim_workload_step(60 * TRAFFIC_TICKS_PER_S), RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_sim_getSSIDTrafficStats(1, &after), RETURN_OK);
+    wifi_sim_get_workload_state(&state);
+
+    data_frames = state.total.packets_received - state.total.multicast_received;
+    UT_LOG("%lu segments, %lu data frames, %lu sent, %lu retransmissions, %lu discards\n", state.segments, data_frames,
+           state.total.packets_sent, state.total.retransmissions, state.total.discards_received);
+    UT_ASSERT_EQUAL(data_frames,
+                    (state.total.bytes_received - state.total.multicast_received * 200 + workload.mtu - 1) / workload.mtu);
+    UT_ASSERT_EQUAL(state.total.packets_sent, data_frames / 2 + state.segments);
+    UT_ASSERT_EQUAL(state.total.bytes_sent, (data_frames / 2) * 66 + state.segments * 400);
+    UT_ASSERT_TRUE(state.total.retransmissions + 1 >=
+                   (ULONG)(workload.retry_ratio * (state.total.packets_sent + state.total.packets_received)));
+    UT_ASSERT_TRUE(state.total.retransmissions <=
+                   (ULONG)(workload.retry_ratio * (state.total.packets_sent + state.total.packets_received)));
+    UT_ASSERT_TRUE(state.total.discards_received + 1 >= (ULONG)(workload.discard_ratio * state.total.packets_received));
+    UT_ASSERT_TRUE(state.total.discards_received <= (ULONG)(workload.discard_ratio * state.total.packets_received));
+    UT_ASSERT_TRUE(traffic_matches(&before, &after, &state.total));
+
+    /* Every counter structure saw the same traffic since the reset */
+    UT_ASSERT_EQUAL(wifi_sim_getRadioTrafficStats(1, &radio), RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_sim_getStats(1, &sta), RETURN_OK);
+    UT_ASSERT_EQUAL(radio.radio_BytesReceived, after.ssid_BytesReceived);
+    UT_ASSERT_EQUAL(radio.radio_PacketsReceived, after.ssid_PacketsReceived);
+    UT_ASSERT_EQUAL(radio.radio_PacketsSent, after.ssid_PacketsSent);
+    UT_ASSERT_EQUAL(radio.radio_DiscardPacketsReceived, after.ssid_DiscardedPacketsReceived);
+    UT_ASSERT_EQUAL(after.ssid_UnicastPacketsReceived + after.ssid_MulticastPacketsReceived, after.ssid_PacketsReceived);
+    UT_ASSERT_EQUAL(sta.sta_Retransmissions, after.ssid_RetransCount);
+
+    /* No link, no traffic, and the player runs dry */
+    UT_ASSERT_EQUAL(wifi_sim_disconnectEndpoint(1, ssid), RETURN_OK);
+    wifi_perf_sleep_ms(200);
+    before = after;
+    UT_ASSERT_EQUAL(wifi_sim_workload_step(20 * TRAFFIC_TICKS_PER_S), RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_sim_getSSIDTrafficStats(1, &after), RETURN_OK);
+    UT_ASSERT_EQUAL(after.ssid_BytesReceived, before.ssid_BytesReceived);
+    UT_ASSERT_EQUAL(after.ssid_PacketsSent, before.ssid_PacketsSent);
+    wifi_sim_get_workload_state(&state);
+    UT_ASSERT_EQUAL(state.buffer_ms, 0);
+    UT_ASSERT_EQUAL(state.stalls, 1);
+
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify the workload model on the event loop
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 005 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Run the video workload in real time for 1 s | tick_ms 10 | About 100 ticks, stepping fails | Should be successful |
+* | 02 | Read the ground truth and the counters between two ticks | None | Counters equal the ground truth | Should be successful |
+* | 03 | Disable the model | None | The counters stop moving | Should be successful |
+*/
+void test_l2_wifi_sim_traffic_realtime (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_sim_workload_t workload;
+    wifi_sim_workload_state_t state;
+    wifi_sim_workload_state_t again;
+    wifi_ssidTrafficStats_t zero;
+    wifi_ssidTrafficStats_t ssid;
+    wifi_ssidTrafficStats_t later;
+    BOOL read = FALSE;
+
+    if (traffic_setup() != 0)
+    {
+        UT_FAIL_FATAL("Cannot connect to SimHome");
+    }
+    memset(&zero, 0, sizeof(zero));
+    traffic_base(&workload, WIFI_SIM_WORKLOAD_VIDEO);
+    workload.realtime = TRUE;
+    workload.tick_ms = 10;
+    UT_ASSERT_EQUAL(wifi_sim_set_workload(&workload), RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_sim_workload_step(1), RETURN_ERR);
+    wifi_perf_sleep_ms(1000);
+
+    /* The reads are consistent if no tick ran between the two states */
+    for (int attempt = 0; attempt < 100 && !read; attempt++)
+    {
+        wifi_sim_get_workload_state(&state);
+        wifi_sim_getSSIDTrafficStats(1, &ssid);
+        wifi_sim_get_workload_state(&again);
+        read = (state.ticks == again.ticks) ? TRUE : FALSE;
+    }
+    UT_ASSERT_TRUE(read);
+    UT_LOG("%lu ticks in 1 s, %lu segments, %.1f MB received\n", state.ticks, state.segments,
+           state.total.bytes_received / 1e6);
+    UT_ASSERT_TRUE(state.ticks >= 90 && state.ticks <= 110);
+    UT_ASSERT_TRUE(state.segments > 0);
+    UT_ASSERT_TRUE(traffic_matches(&zero, &ssid, &state.total));
+
+    workload.enable = FALSE;
+    UT_ASSERT_EQUAL(wifi_sim_set_workload(&workload), RETURN_OK);
+    wifi_sim_getSSIDTrafficStats(1, &ssid);
+    wifi_perf_sleep_ms(100);
+    wifi_sim_getSSIDTrafficStats(1, &later);
+    UT_ASSERT_EQUAL(later.ssid_BytesReceived, ssid.ssid_BytesReceived);
+
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_sim_traffic = NULL;
+
+/**
+ * @brief Register the simulator workload model tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_sim_traffic_register_l2_tests (void)
+{
+    pSuite_sim_traffic = UT_add_suite("[L2 wifi_sim_traffic tests]", NULL, NULL);
+    if (pSuite_sim_traffic == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_sim_traffic, "l2_wifi_sim_traffic_video_ladder", test_l2_wifi_sim_traffic_video_ladder);
+    UT_add_test(pSuite_sim_traffic, "l2_wifi_sim_traffic_video_abr", test_l2_wifi_sim_traffic_video_abr);
+    UT_add_test(pSuite_sim_traffic, "l2_wifi_sim_traffic_web", test_l2_wifi_sim_traffic_web);
+    UT_add_test(pSuite_sim_traffic, "l2_wifi_sim_traffic_counters", test_l2_wifi_sim_traffic_counters);
+    UT_add_test(pSuite_sim_traffic, "l2_wifi_sim_traffic_realtime", test_l2_wifi_sim_traffic_realtime);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_SIM_TRAFFIC_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,607 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_SINGLE_FLIGHT_HALTEST_L2 RDK-V WiFi Single-Flight Getter L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the RDK-V WiFi single-flight getters :
+ *
+ * Module and stress tests for the single-flight wrapper in wrappers/src/wifi_single_flight.c.
+ * The module tests run the wrapper over mock getters with a known delay, the stress tests
+ * measure HAL call reduction and caller latency with 32 concurrent threads.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_single_flight.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "wifi_common_hal.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stability.h"
+#include "wifi_perf_stats.h"
+#include "wifi_single_flight.h"
+
+#define MOCK_GETTER_DELAY_MS 2
+#define MOCK_CHANNEL 36
+#define MOCK_REGULATORY_DOMAIN "US"
+#define MOCK_POSSIBLE_CHANNELS "36,40,44,48,149,153,157,161"
+#define STRESS_THREADS 32
+#define STRESS_ITERATIONS 10
+#define HAL_STRESS_ITERATIONS 20
+
+extern int WiFi_InitPreReq(void);
+extern int WiFi_UnInitPosReq(void);
+extern const int RADIO_INDEX;
+
+static UINT mock_delay_ms = MOCK_GETTER_DELAY_MS;
+static INT mock_result = RETURN_OK;
+static int mock_calls = 0;
+static pthread_mutex_t mock_driver_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Like most drivers, the mock serves one request at a time */
+static void mock_enter(void)
+{
+    __atomic_add_fetch(&mock_calls, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_lock(&mock_driver_lock);
+    wifi_perf_sleep_ms(mock_delay_ms);
+    pthread_mutex_unlock(&mock_driver_lock);
+}
+
+static INT mock_getRadioChannel(INT radioIndex, ULONG *output_ulong)
+{
+    mock_enter();
+    if (mock_result == RETURN_OK)
+    {
+        *output_ulong = MOCK_CHANNEL + radioIndex;
+    }
+    return mock_result;
+}
+
+static INT mock_getRegulatoryDomain(INT radioIndex, CHAR *output_string)
+{
+    mock_enter();
+    if (mock_result == RETURN_OK)
+    {
+        strcpy(output_string, MOCK_REGULATORY_DOMAIN);
+    }
+    return mock_result;
+}
+
+static INT mock_getRadioPossibleChannels(INT radioIndex, CHAR *output_string)
+{
+    mock_enter();
+    if (mock_result == RETURN_OK)
+    {
+        strcpy(output_string, MOCK_POSSIBLE_CHANNELS);
+    }
+    return mock_result;
+}
+
+static const wifi_single_flight_config_t mock_config = {
+    .getRadioChannel = mock_getRadioChannel,
+    .getRegulatoryDomain = mock_getRegulatoryDomain,
+    .getRadioPossibleChannels = mock_getRadioPossibleChannels,
+};
+
+static const wifi_single_flight_config_t hal_getters = {
+    .getRadioChannel = wifi_getRadioChannel,
+    .getRegulatoryDomain = wifi_getRegulatoryDomain,
+    .getRadioPossibleChannels = wifi_getRadioPossibleChannels,
+};
+
+static void mock_single_flight_init(UINT delay_ms)
+{
+    mock_delay_ms = delay_ms;
+    mock_result = RETURN_OK;
+    mock_calls = 0;
+    wifi_single_flight_deinit();
+    if (wifi_single_flight_init(&mock_config) != RETURN_OK)
+    {
+        UT_FAIL_FATAL("wifi_single_flight_init failed");
+    }
+}
+
+static uint64_t total_hal_calls(void)
+{
+    wifi_single_flight_stats_t stats;
+    uint64_t total = 0;
+
+    for (int i = 0; i < WIFI_SINGLE_FLIGHT_MAX; i++)
+    {
+        wifi_single_flight_get_stats((wifi_single_flight_getter_t)i, &stats);
+        total += stats.hal_calls;
+    }
+    return total;
+}
+
+typedef struct
+{
+    pthread_barrier_t *start;
+    INT radio_index;
+    INT ret;
+    ULONG channel;
+} channel_arg_t;
+
+static void *channel_thread(void *arg)
+{
+    channel_arg_t *ctx = arg;
+
+    pthread_barrier_wait(ctx->start);
+    ctx->ret = wifi_single_flight_getRadioChannel(ctx->radio_index, &ctx->channel);
+    return NULL;
+}
+
+static void run_channel_threads(channel_arg_t *args, int count)
+{
+    pthread_t threads[STRESS_THREADS];
+    pthread_barrier_t start;
+
+    pthread_barrier_init(&start, NULL, count);
+    for (int i = 0; i < count; i++)
+    {
+        args[i].start = &start;
+        args[i].ret = RETURN_ERR;
+        args[i].channel = 0;
+        wifi_perf_thread_create(&threads[i], channel_thread, &args[i]);
+    }
+    for (int i = 0; i < count; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    pthread_barrier_destroy(&start);
+}
+
+/**
+* @brief Verify that concurrent identical getter calls reach the HAL once
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Release 32 threads at once calling wifi_single_flight_getRadioChannel() | radioIndex = 1, getter delay = 100 ms | Every thread gets RETURN_OK and channel 37 | Should be successful |
+* | 02 | Count the underlying calls | None | One HAL call, 31 shared results | Should be successful |
+*/
+void test_l2_wifi_single_flight_concurrent_calls_collapsed (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    channel_arg_t args[STRESS_THREADS];
+    wifi_single_flight_stats_t stats;
+
+    mock_single_flight_init(100);
+    for (int i = 0; i < STRESS_THREADS; i++)
+    {
+        args[i].radio_index = RADIO_INDEX;
+    }
+    run_channel_threads(args, STRESS_THREADS);
+
+    for (int i = 0; i < STRESS_THREADS; i++)
+    {
+        UT_ASSERT_EQUAL(args[i].ret, RETURN_OK);
+        UT_ASSERT_EQUAL(args[i].channel, MOCK_CHANNEL + RADIO_INDEX);
+    }
+    wifi_single_flight_get_stats(WIFI_SINGLE_FLIGHT_RADIO_CHANNEL, &stats);
+    UT_LOG("requests=%llu hal_calls=%llu shared=%llu\n", (unsigned long long)stats.requests,
+           (unsigned long long)stats.hal_calls, (unsigned long long)stats.shared);
+    UT_ASSERT_EQUAL(mock_calls, 1);
+    UT_ASSERT_EQUAL(stats.hal_calls, 1);
+    UT_ASSERT_EQUAL(stats.shared, STRESS_THREADS - 1);
+
+    wifi_single_flight_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that calls for different radios or made one after another are not merged
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Release 2 threads at once for different radios | radioIndex = 1 and 2 | Two HAL calls, each thread gets its own radio's channel | Should be successful |
+* | 02 | Call the three getters twice in sequence | radioIndex = 1 | Six more HAL calls, nothing is cached | Should be successful |
+*/
+void test_l2_wifi_single_flight_distinct_and_sequential_calls_not_merged (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    channel_arg_t args[2];
+    CHAR output_string[WIFI_SINGLE_FLIGHT_STRING_LEN];
+    ULONG channel = 0;
+
+    mock_single_flight_init(50);
+    args[0].radio_index = 1;
+    args[1].radio_index = 2;
+    run_channel_threads(args, 2);
+    UT_ASSERT_EQUAL(args[0].ret, RETURN_OK);
+    UT_ASSERT_EQUAL(args[1].ret, RETURN_OK);
+    UT_ASSERT_EQUAL(args[0].channel, MOCK_CHANNEL + 1);
+    UT_ASSERT_EQUAL(args[1].channel, MOCK_CHANNEL + 2);
+    UT_ASSERT_EQUAL(mock_calls, 2);
+
+    mock_delay_ms = 0;
+    for (int i = 0; i < 2; i++)
+    {
+        UT_ASSERT_EQUAL(wifi_single_flight_getRadioChannel(RADIO_INDEX, &channel), RETURN_OK);
+        UT_ASSERT_EQUAL(wifi_single_flight_getRegulatoryDomain(RADIO_INDEX, output_string), RETURN_OK);
+        UT_ASSERT_EQUAL(strcmp(output_string, MOCK_REGULATORY_DOMAIN), 0);
+        UT_ASSERT_EQUAL(wifi_single_flight_getRadioPossibleChannels(RADIO_INDEX, output_string), RETURN_OK);
+        UT_ASSERT_EQUAL(strcmp(output_string, MOCK_POSSIBLE_CHANNELS), 0);
+    }
+    UT_ASSERT_EQUAL(mock_calls, 8);
+
+    wifi_single_flight_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that a HAL error is fanned out to every waiting caller
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 003 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Make the getter fail and release 32 threads at once | getter result = RETURN_ERR | Every thread gets RETURN_ERR, one HAL call | Should Fail |
+* | 02 | Make the getter succeed and call it again | getter result = RETURN_OK | RETURN_OK, the error was not kept | Should Pass |
+*/
+void test_l2_wifi_single_flight_error_fanned_out (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    channel_arg_t args[STRESS_THREADS];
+    wifi_single_flight_stats_t stats;
+    ULONG channel = 0;
+
+    mock_single_flight_init(100);
+    mock_result = RETURN_ERR;
+    for (int i = 0; i < STRESS_THREADS; i++)
+    {
+        args[i].radio_index = RADIO_INDEX;
+    }
+    run_channel_threads(args, STRESS_THREADS);
+    for (int i = 0; i < STRESS_THREADS; i++)
+    {
+        UT_ASSERT_EQUAL(args[i].ret, RETURN_ERR);
+    }
+    UT_ASSERT_EQUAL(mock_calls, 1);
+
+    mock_result = RETURN_OK;
+    UT_ASSERT_EQUAL(wifi_single_flight_getRadioChannel(RADIO_INDEX, &channel), RETURN_OK);
+    UT_ASSERT_EQUAL(channel, MOCK_CHANNEL + RADIO_INDEX);
+
+    wifi_single_flight_get_stats(WIFI_SINGLE_FLIGHT_RADIO_CHANNEL, &stats);
+    UT_ASSERT_EQUAL(stats.errors, 1);
+    wifi_single_flight_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify that the wrapper rejects invalid parameters and calls before initialisation
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 004 @n
+* **Priority:** Med @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Call a getter before wifi_single_flight_init() | None | RETURN_ERR | Should Fail |
+* | 02 | Pass NULL output pointers to each getter | output = NULL | RETURN_ERR, no HAL call | Should Fail |
+* | 03 | Initialise twice | None | RETURN_ERR on the second call | Should Fail |
+*/
+void test_l2_wifi_single_flight_invalid_parameters (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    ULONG channel = 0;
+
+    wifi_single_flight_deinit();
+    UT_ASSERT_EQUAL(wifi_single_flight_getRadioChannel(RADIO_INDEX, &channel), RETURN_ERR);
+
+    mock_single_flight_init(0);
+    UT_ASSERT_EQUAL(wifi_single_flight_getRadioChannel(RADIO_INDEX, NULL), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_single_flight_getRegulatoryDomain(RADIO_INDEX, NULL), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_single_flight_getRadioPossibleChannels(RADIO_INDEX, NULL), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_single_flight_init(NULL), RETURN_ERR);
+    UT_ASSERT_EQUAL(mock_calls, 0);
+
+    wifi_single_flight_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+typedef struct
+{
+    pthread_barrier_t *start;
+    const wifi_single_flight_config_t *direct; /* NULL to go through the wrapper */
+    int iterations;
+    int failures;
+    wifi_perf_samples_t latency;
+} stress_arg_t;
+
+static void *stress_thread(void *arg)
+{
+    stress_arg_t *ctx = arg;
+    CHAR output_string[WIFI_SINGLE_FLIGHT_STRING_LEN];
+    ULONG channel;
+    INT ret;
+
+    pthread_barrier_wait(ctx->start);
+    for (int i = 0; i < ctx->iterations; i++)
+    {
+        for (int getter = 0; getter < WIFI_SINGLE_FLIGHT_MAX; getter++)
+        {
+            uint64_t start = wifi_perf_now_ns();
+
+            switch (getter)
+            {
+                case WIFI_SINGLE_FLIGHT_RADIO_CHANNEL:
+                    ret = (ctx->direct == NULL) ? wifi_single_flight_getRadioChannel(RADIO_INDEX, &channel)
+                                                : ctx->direct->getRadioChannel(RADIO_INDEX, &channel);
+                    break;
+                case WIFI_SINGLE_FLIGHT_REGULATORY_DOMAIN:
+                    ret = (ctx->direct == NULL) ? wifi_single_flight_getRegulatoryDomain(RADIO_INDEX, output_string)
+                                                : ctx->direct->getRegulatoryDomain(RADIO_INDEX, output_string);
+                    break;
+                default:
+                    ret = (ctx->direct == NULL) ? wifi_single_flight_getRadioPossibleChannels(RADIO_INDEX, output_string)
+                                                : ctx->direct->getRadioPossibleChannels(RADIO_INDEX, output_string);
+                    break;
+            }
+            wifi_perf_samples_add(&ctx->latency, wifi_perf_now_ns() - start);
+            if (ret != RETURN_OK)
+            {
+                ctx->failures++;
+            }
+        }
+    }
+    return NULL;
+}
+
+/* Runs the 32-thread load and returns the number of failed calls */
+static int run_stress(const wifi_single_flight_config_t *direct, int iterations, wifi_perf_summary_t *summary, uint64_t *elapsed_ns)
+{
+    pthread_t threads[STRESS_THREADS];
+    stress_arg_t args[STRESS_THREADS];
+    pthread_barrier_t start;
+    wifi_perf_samples_t all;
+    uint64_t begin;
+    int failures = 0;
+
+    wifi_perf_samples_init(&all, 0);
+    pthread_barrier_init(&start, NULL, STRESS_THREADS);
+    begin = wifi_perf_now_ns();
+    for (int i = 0; i < STRESS_THREADS; i++)
+    {
+        args[i].start = &start;
+        args[i].direct = direct;
+        args[i].iterations = iterations;
+        args[i].failures = 0;
+        wifi_perf_samples_init(&args[i].latency, iterations * WIFI_SINGLE_FLIGHT_MAX);
+        wifi_perf_thread_create(&threads[i], stress_thread, &args[i]);
+    }
+    for (int i = 0; i < STRESS_THREADS; i++)
+    {
+        pthread_join(threads[i], NULL);
+        failures += args[i].failures;
+        wifi_perf_samples_merge(&all, &args[i].latency);
+        wifi_perf_samples_free(&args[i].latency);
+    }
+    *elapsed_ns = wifi_perf_now_ns() - begin;
+    pthread_barrier_destroy(&start);
+
+    wifi_perf_summarize(&all, summary);
+    wifi_perf_samples_free(&all);
+    return failures;
+}
+
+/**
+* @brief Benchmark 32 threads polling the three getters with and without single-flight
+*
+* The direct run calls the mock getters straight away, the second run goes through the wrapper.
+* Reports underlying calls and caller latency for both. @n
+*
+* **Test Group ID:** Stress: 03 @n
+* **Test Case ID:** 005 @n
+* **Priority:** Med @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | 32 threads each call the three mock getters 10 times directly | getter delay = 2 ms, one call at a time | 960 underlying calls | Baseline |
+* | 02 | Repeat through the single-flight wrapper | getter delay = 2 ms | No failures, far fewer underlying calls, lower p50 latency | Should be successful |
+*/
+void test_l2_wifi_single_flight_stress_32_threads_mock (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_perf_summary_t direct;
+    wifi_perf_summary_t collapsed;
+    uint64_t direct_ns;
+    uint64_t collapsed_ns;
+    int direct_calls;
+    char line[256];
+
+    mock_single_flight_init(MOCK_GETTER_DELAY_MS);
+
+    /* Baseline: the mock getters straight from every thread */
+    UT_ASSERT_EQUAL(run_stress(&mock_config, STRESS_ITERATIONS, &direct, &direct_ns), 0);
+    direct_calls = mock_calls;
+
+    mock_calls = 0;
+    UT_ASSERT_EQUAL(run_stress(NULL, STRESS_ITERATIONS, &collapsed, &collapsed_ns), 0);
+
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "direct getters, 32 threads", &direct));
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "single-flight getters, 32 threads", &collapsed));
+    UT_LOG("Underlying calls: direct=%d single-flight=%d (%.1f%% fewer), wall time: direct=%.1fms single-flight=%.1fms\n",
+           direct_calls, mock_calls, 100.0 * (1.0 - (double)mock_calls / (double)direct_calls),
+           direct_ns / 1e6, collapsed_ns / 1e6);
+
+    UT_ASSERT_EQUAL(direct_calls, STRESS_THREADS * STRESS_ITERATIONS * WIFI_SINGLE_FLIGHT_MAX);
+    UT_ASSERT_EQUAL((uint64_t)mock_calls, total_hal_calls());
+    UT_ASSERT_EQUAL(mock_calls * 4 < direct_calls, 1);
+    UT_ASSERT_EQUAL(collapsed.p50 < direct.p50, 1);
+
+    wifi_single_flight_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Benchmark 32 threads polling the three getters on the HAL under test
+*
+* Runs the same load directly against the HAL and through the wrapper and reports HAL call
+* reduction and caller latency. @n
+*
+* **Test Group ID:** Stress: 03 @n
+* **Test Case ID:** 006 @n
+* **Priority:** Med @n
+* @n
+* **Pre-Conditions:** wifi_init() called by the suite @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | 32 threads each call wifi_getRadioChannel(), wifi_getRegulatoryDomain() and wifi_getRadioPossibleChannels() 20 times | radioIndex = 1 | RETURN_OK | Direct |
+* | 02 | Repeat through the single-flight wrapper | radioIndex = 1 | RETURN_OK, no more HAL calls than requests | Single-flight |
+*/
+void test_l2_wifi_single_flight_stress_32_threads_hal (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_perf_summary_t summary;
+    uint64_t elapsed_ns;
+    uint64_t hal_calls;
+    uint64_t requests = (uint64_t)STRESS_THREADS * HAL_STRESS_ITERATIONS * WIFI_SINGLE_FLIGHT_MAX;
+    char line[256];
+
+    wifi_single_flight_deinit();
+    UT_ASSERT_EQUAL(wifi_single_flight_init(NULL), RETURN_OK);
+
+    UT_ASSERT_EQUAL(run_stress(&hal_getters, HAL_STRESS_ITERATIONS, &summary, &elapsed_ns), 0);
+    UT_LOG("%s wall=%.1fms\n", wifi_perf_format_summary(line, sizeof(line), "direct HAL getters, 32 threads", &summary), elapsed_ns / 1e6);
+
+    UT_ASSERT_EQUAL(run_stress(NULL, HAL_STRESS_ITERATIONS, &summary, &elapsed_ns), 0);
+    UT_LOG("%s wall=%.1fms\n", wifi_perf_format_summary(line, sizeof(line), "single-flight HAL getters, 32 threads", &summary), elapsed_ns / 1e6);
+
+    hal_calls = total_hal_calls();
+    UT_LOG("HAL calls: direct=%llu single-flight=%llu (%.1f%% fewer)\n", (unsigned long long)requests,
+           (unsigned long long)hal_calls, 100.0 * (1.0 - (double)hal_calls / (double)requests));
+    UT_ASSERT_EQUAL(hal_calls <= requests, 1);
+
+    wifi_single_flight_deinit();
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_single_flight = NULL;
+static UT_test_suite_t * pSuite_single_flight_with_wifi_init = NULL;
+
+/**
+ * @brief Register the single-flight getter tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_single_flight_register_l2_tests (void)
+{
+    pSuite_single_flight = UT_add_suite("[L2 wifi_single_flight tests]", NULL, NULL);
+    if (pSuite_single_flight == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_single_flight, "l2_wifi_single_flight_concurrent_calls_collapsed", test_l2_wifi_single_flight_concurrent_calls_collapsed);
+    UT_add_test(pSuite_single_flight, "l2_wifi_single_flight_distinct_and_sequential_calls_not_merged", test_l2_wifi_single_flight_distinct_and_sequential_calls_not_merged);
+    UT_add_test(pSuite_single_flight, "l2_wifi_single_flight_error_fanned_out", test_l2_wifi_single_flight_error_fanned_out);
+    UT_add_test(pSuite_single_flight, "l2_wifi_single_flight_invalid_parameters", test_l2_wifi_single_flight_invalid_parameters);
+    UT_add_test(pSuite_single_flight, "l2_wifi_single_flight_stress_32_threads_mock", test_l2_wifi_single_flight_stress_32_threads_mock);
+
+    pSuite_single_flight_with_wifi_init = UT_add_suite("[L2 wifi_single_flight post-init tests]", WiFi_InitPreReq, WiFi_UnInitPosReq);
+    if (pSuite_single_flight_with_wifi_init == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_single_flight_with_wifi_init, "l2_wifi_single_flight_stress_32_threads_hal", test_l2_wifi_single_flight_stress_32_threads_hal);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_SINGLE_FLIGHT_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,392 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_SPAWN_HALTEST_L2 RDK-V WiFi Process Start L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for HAL calls that start processes :
+ *
+ * Getters implemented with popen("wpa_cli ...") or system("iw ...") cost milliseconds and a
+ * process image per call. These tests watch every read-only getter through the harness process
+ * start replacements (wifi_hal_spawn.h), report the APIs that start processes with the time they
+ * spend on them, and fail if a latency-critical getter does. `WIFI_HAL_SPAWN_CRITICAL` marks
+ * further APIs as critical.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_spawn.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <spawn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "wifi_common_hal.h"
+#include "wifi_hal_api.h"
+#include "wifi_hal_spawn.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_probe.h"
+
+#define HAL_ITERATIONS 5
+#define TEST_POPEN_COMMAND "echo spawn"
+#define TEST_EXEC_PATH "/bin/true"
+#define TEST_SPAWN_FILE "true"
+
+extern int WiFi_InitPreReq(void);
+extern int WiFi_UnInitPosReq(void);
+extern const int RADIO_INDEX;
+extern const int SSID_INDEX;
+
+extern char **environ;
+
+/**
+ * @brief Getters polled by the middleware, which must never start a process
+ */
+static const wifi_hal_api_t critical_apis[] = {
+    WIFI_HAL_API_wifi_getStats,
+    WIFI_HAL_API_wifi_getRadioEnable,
+    WIFI_HAL_API_wifi_getRadioStatus,
+    WIFI_HAL_API_wifi_getRadioChannel,
+    WIFI_HAL_API_wifi_getRadioOperatingFrequencyBand,
+    WIFI_HAL_API_wifi_getRadioTrafficStats,
+    WIFI_HAL_API_wifi_getSSIDName,
+    WIFI_HAL_API_wifi_getSSIDTrafficStats,
+};
+
+#define CRITICAL_API_COUNT (sizeof(critical_apis) / sizeof(critical_apis[0]))
+
+static uint64_t spawn_total(const wifi_spawn_stats_t *stats)
+{
+    uint64_t total = 0;
+
+    for (int kind = 0; kind < WIFI_SPAWN_KIND_MAX; kind++)
+    {
+        total += stats->spawns[kind];
+    }
+    return total;
+}
+
+static void spawn_log(wifi_hal_api_t api, const wifi_spawn_stats_t *stats)
+{
+    UT_LOG("%-40s calls=%llu spawning=%llu fork=%llu posix_spawn=%llu exec=%llu popen=%llu system=%llu total=%.3fms max/call=%.3fms \"%s\"%s\n",
+           (api < WIFI_HAL_API_MAX) ? wifi_hal_api_name(api) : "(outside HAL calls)",
+           (unsigned long long)stats->calls, (unsigned long long)stats->spawning_calls,
+           (unsigned long long)stats->spawns[WIFI_SPAWN_FORK], (unsigned long long)stats->spawns[WIFI_SPAWN_POSIX_SPAWN],
+           (unsigned long long)stats->spawns[WIFI_SPAWN_EXEC], (unsigned long long)stats->spawns[WIFI_SPAWN_POPEN],
+           (unsigned long long)stats->spawns[WIFI_SPAWN_SYSTEM], (double)stats->spawn_ns / WIFI_PERF_NS_PER_MS,
+           (double)stats->max_call_spawn_ns / WIFI_PERF_NS_PER_MS, stats->command,
+           wifi_spawn_check(api) ? "" : " CRITICAL");
+}
+
+/**
+* @brief Verify the process start detection against known processes
+*
+* Starts processes in every supported way between explicit call markers and checks what is
+* charged to each API. Skipped while WIFI_HAL_SPAWN=1 watches the whole run, as the markers would
+* charge made-up processes to real APIs. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** /bin/true and a shell are available @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | popen and pclose inside a call | "echo spawn" | One popen with its command and time charged | Should be successful |
+* | 02 | system inside a call | "true" | One system charged | Should be successful |
+* | 03 | fork, execv in the child and waitpid inside a call | /bin/true | One fork and the child's exec charged | Should be successful |
+* | 04 | posix_spawnp and waitpid inside a call | true | One posix_spawn charged | Should be successful |
+* | 05 | system outside any call | "true" | Charged to the outside slot | Should be successful |
+* | 06 | A call without processes | None | Counted, not spawning | Should be successful |
+* | 07 | Mark the popen API and the quiet API critical | None | Only the popen API fails the check | Should be successful |
+*/
+void test_l2_wifi_spawn_detection (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    const wifi_hal_api_t popen_api = WIFI_HAL_API_wifi_getRadioChannel;
+    const wifi_hal_api_t system_api = WIFI_HAL_API_wifi_getRadioStatus;
+    const wifi_hal_api_t fork_api = WIFI_HAL_API_wifi_getStats;
+    const wifi_hal_api_t spawn_api = WIFI_HAL_API_wifi_getSSIDName;
+    const wifi_hal_api_t quiet_api = WIFI_HAL_API_wifi_getRadioEnable;
+    char *const exec_argv[] = { TEST_EXEC_PATH, NULL };
+    char *const spawn_argv[] = { TEST_SPAWN_FILE, NULL };
+    wifi_spawn_stats_t stats;
+    int saved_critical[2];
+    char line[32] = "";
+    FILE *fp;
+    pid_t pid;
+    int status;
+
+    if (wifi_spawn_active)
+    {
+        UT_LOG("WIFI_HAL_SPAWN watches the whole run, skipping\n");
+        WIFI_TRACE_TEST_END();
+        return;
+    }
+    if (wifi_spawn_enable(1) != 0)
+    {
+        UT_FAIL_FATAL("wifi_spawn_enable failed");
+    }
+    wifi_spawn_reset();
+
+    wifi_spawn_call_enter(popen_api);
+    fp = popen(TEST_POPEN_COMMAND, "r");
+    if (fp != NULL)
+    {
+        if (fgets(line, sizeof(line), fp) == NULL)
+        {
+            line[0] = '\0';
+        }
+        pclose(fp);
+    }
+    wifi_spawn_call_exit(popen_api);
+
+    wifi_spawn_call_enter(system_api);
+    status = system("true");
+    wifi_spawn_call_exit(system_api);
+    UT_ASSERT_EQUAL(status, 0);
+
+    wifi_spawn_call_enter(fork_api);
+    pid = fork();
+    if (pid == 0)
+    {
+        execv(TEST_EXEC_PATH, exec_argv);
+        _exit(127);
+    }
+    if (pid > 0)
+    {
+        waitpid(pid, &status, 0);
+    }
+    wifi_spawn_call_exit(fork_api);
+
+    wifi_spawn_call_enter(spawn_api);
+    if (posix_spawnp(&pid, TEST_SPAWN_FILE, NULL, NULL, spawn_argv, environ) == 0)
+    {
+        waitpid(pid, &status, 0);
+    }
+    wifi_spawn_call_exit(spawn_api);
+
+    system("true");
+
+    wifi_spawn_call_enter(quiet_api);
+    wifi_spawn_call_exit(quiet_api);
+
+    wifi_spawn_enable(0);
+
+    wifi_spawn_get(popen_api, &stats);
+    spawn_log(popen_api, &stats);
+    UT_ASSERT_EQUAL(strcmp(line, "spawn\n"), 0);
+    UT_ASSERT_EQUAL(stats.calls, 1);
+    UT_ASSERT_EQUAL(stats.spawning_calls, 1);
+    UT_ASSERT_EQUAL(stats.spawns[WIFI_SPAWN_POPEN], 1);
+    UT_ASSERT_EQUAL(spawn_total(&stats), 1);
+    UT_ASSERT_EQUAL(stats.spawn_ns > 0, 1);
+    UT_ASSERT_EQUAL(stats.max_call_spawn_ns, stats.spawn_ns);
+    UT_ASSERT_EQUAL(strcmp(stats.command, TEST_POPEN_COMMAND), 0);
+
+    wifi_spawn_get(system_api, &stats);
+    spawn_log(system_api, &stats);
+    UT_ASSERT_EQUAL(stats.spawns[WIFI_SPAWN_SYSTEM], 1);
+    UT_ASSERT_EQUAL(spawn_total(&stats), 1);
+
+    wifi_spawn_get(fork_api, &stats);
+    spawn_log(fork_api, &stats);
+    UT_ASSERT_EQUAL(stats.spawning_calls, 1);
+    UT_ASSERT_EQUAL(stats.spawns[WIFI_SPAWN_FORK], 1);
+    UT_ASSERT_EQUAL(stats.spawns[WIFI_SPAWN_EXEC], 1);
+    UT_ASSERT_EQUAL(strcmp(stats.command, TEST_EXEC_PATH), 0);
+
+    wifi_spawn_get(spawn_api, &stats);
+    spawn_log(spawn_api, &stats);
+    UT_ASSERT_EQUAL(stats.spawns[WIFI_SPAWN_POSIX_SPAWN], 1);
+    UT_ASSERT_EQUAL(strcmp(stats.command, TEST_SPAWN_FILE), 0);
+
+    wifi_spawn_get(WIFI_HAL_API_MAX, &stats);
+    spawn_log(WIFI_HAL_API_MAX, &stats);
+    UT_ASSERT_EQUAL(stats.spawns[WIFI_SPAWN_SYSTEM], 1);
+    UT_ASSERT_EQUAL(spawn_total(&stats), 1);
+
+    wifi_spawn_get(quiet_api, &stats);
+    UT_ASSERT_EQUAL(stats.calls, 1);
+    UT_ASSERT_EQUAL(stats.spawning_calls, 0);
+
+    saved_critical[0] = wifi_spawn_is_critical(popen_api);
+    saved_critical[1] = wifi_spawn_is_critical(quiet_api);
+    UT_ASSERT_EQUAL(wifi_spawn_parse_critical("wifi_getRadioChannel,wifi_getRadioEnable"), 0);
+    UT_ASSERT_EQUAL(wifi_spawn_check(popen_api), 0);
+    UT_ASSERT_EQUAL(wifi_spawn_check(quiet_api), 1);
+    UT_ASSERT_EQUAL(wifi_spawn_parse_critical("wifi_getBogus"), -1);
+    wifi_spawn_set_critical(popen_api, saved_critical[0]);
+    wifi_spawn_set_critical(quiet_api, saved_critical[1]);
+
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Check that no latency-critical getter of the HAL under test starts a process
+*
+* Calls every read-only getter five times with process start detection enabled, logs the getters
+* that start processes and fails for the critical ones. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** wifi_init() has been called @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Mark the polled getters critical | wifi_getStats, wifi_getRadioChannel, ... | None | Should be successful |
+* | 02 | Call every getter five times | radioIndex = 1, ssidIndex = 1 | None | Should be successful |
+* | 03 | Log every getter that started a process | None | None | Should be successful |
+* | 04 | Check the critical getters | None | None started a process | Should Pass |
+*/
+void test_l2_wifi_spawn_getters_hal (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    const wifi_perf_probe_t *probes;
+    size_t probe_count;
+    int was_active = wifi_spawn_active;
+    int spawning = 0;
+    int failed = 0;
+
+    for (size_t i = 0; i < CRITICAL_API_COUNT; i++)
+    {
+        wifi_spawn_set_critical(critical_apis[i], 1);
+    }
+
+    /* With WIFI_HAL_SPAWN=1 the figures include the rest of the run, which only makes the check stricter */
+    if (!was_active)
+    {
+        if (wifi_spawn_enable(1) != 0)
+        {
+            UT_FAIL_FATAL("wifi_spawn_enable failed");
+        }
+        wifi_spawn_reset();
+    }
+
+    probes = wifi_perf_probes(&probe_count);
+    for (int iteration = 0; iteration < HAL_ITERATIONS; iteration++)
+    {
+        for (size_t i = 0; i < probe_count; i++)
+        {
+            probes[i].call(RADIO_INDEX, SSID_INDEX);
+        }
+    }
+
+    if (!was_active)
+    {
+        wifi_spawn_enable(0);
+    }
+
+    for (size_t i = 0; i < probe_count; i++)
+    {
+        wifi_spawn_stats_t stats;
+
+        wifi_spawn_get(probes[i].api, &stats);
+        if (spawn_total(&stats) > 0)
+        {
+            spawn_log(probes[i].api, &stats);
+            spawning++;
+        }
+        if (!wifi_spawn_check(probes[i].api))
+        {
+            failed++;
+        }
+    }
+    UT_LOG("%d of %zu getters started processes, %d of them latency critical\n", spawning, probe_count, failed);
+    UT_ASSERT_EQUAL(failed, 0);
+
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_spawn = NULL;
+static UT_test_suite_t * pSuite_spawn_hal = NULL;
+
+/**
+ * @brief Register the process start detection tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_spawn_register_l2_tests (void)
+{
+    pSuite_spawn = UT_add_suite("[L2 wifi_spawn tests]", NULL, NULL);
+    if (pSuite_spawn == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_spawn, "l2_wifi_spawn_detection", test_l2_wifi_spawn_detection);
+
+    pSuite_spawn_hal = UT_add_suite("[L2 wifi_spawn post-init tests]", WiFi_InitPreReq, WiFi_UnInitPosReq);
+    if (pSuite_spawn_hal == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_spawn_hal, "l2_wifi_spawn_getters_hal", test_l2_wifi_spawn_getters_hal);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_SPAWN_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,333 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_STABILITY_HALTEST_L2 RDK-V WiFi Measurement Stability L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the measurement stability controls :
+ *
+ * Checks CPU pinning, SCHED_FIFO and clock overhead subtraction (wifi_perf_stability.h) and
+ * reports how much they tighten the latency distribution of a getter.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_stability.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include "wifi_common_hal.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stability.h"
+#include "wifi_perf_stats.h"
+
+#define OVERHEAD_ITERATIONS 10000
+#define OVERHEAD_MAX_NS (10 * WIFI_PERF_NS_PER_US)
+#define FIFO_PRIORITY 1
+#define HAL_WARMUP 10
+#define HAL_ITERATIONS 1000
+
+extern int WiFi_InitPreReq(void);
+extern int WiFi_UnInitPosReq(void);
+extern const int RADIO_INDEX;
+
+/* Number of CPUs set in a saved affinity mask, and the first of them */
+static int affinity_cpus(const wifi_perf_sched_t *sched, int *first)
+{
+    int count = 0;
+
+    *first = -1;
+    for (int cpu = 0; cpu < (int)sizeof(sched->affinity) * 8; cpu++)
+    {
+        if (sched->affinity[cpu / 8] & (1u << (cpu % 8)))
+        {
+            if (*first < 0)
+            {
+                *first = cpu;
+            }
+            count++;
+        }
+    }
+    return count;
+}
+
+static void measure_channel(wifi_perf_samples_t *samples, uint64_t overhead_ns, wifi_perf_summary_t *summary)
+{
+    ULONG channel = 0;
+
+    for (int i = 0; i < HAL_WARMUP; i++)
+    {
+        wifi_getRadioChannel(RADIO_INDEX, &channel);
+    }
+    wifi_perf_samples_clear(samples);
+    for (int i = 0; i < HAL_ITERATIONS; i++)
+    {
+        uint64_t start = wifi_perf_now_ns();
+
+        wifi_getRadioChannel(RADIO_INDEX, &channel);
+        wifi_perf_samples_add(samples, wifi_perf_now_ns() - start);
+    }
+    wifi_perf_samples_subtract(samples, overhead_ns);
+    wifi_perf_summarize(samples, summary);
+}
+
+/**
+* @brief Verify CPU pinning and SCHED_FIFO on the calling thread
+*
+* Pins the thread to the first CPU it may run on, raises it to SCHED_FIFO and restores the saved
+* state. Without CAP_SYS_NICE, SCHED_FIFO must fail with EPERM and leave the thread unchanged. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Save the scheduling state | None | At least one allowed CPU | Should be successful |
+* | 02 | Pin to the first allowed CPU | wifi_perf_pin_cpu() | Returns 0, affinity is that CPU only | Should be successful |
+* | 03 | Raise to SCHED_FIFO | priority = 1 | Returns 0 and policy is SCHED_FIFO, or -1 with EPERM | Should be successful |
+* | 04 | Pass invalid arguments | cpu = -1, priority = 0 | Both return -1 | Should fail |
+* | 05 | Restore the saved state | None | Affinity and policy as saved | Should be successful |
+*/
+void test_l2_wifi_stability_controls (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_perf_sched_t saved;
+    wifi_perf_sched_t current;
+    struct sched_param param;
+    int allowed;
+    int first;
+    int pinned;
+    int policy = -1;
+    int ret;
+
+    wifi_perf_sched_save(&saved);
+    allowed = affinity_cpus(&saved, &first);
+    UT_LOG("Thread may run on %d CPUs, policy %d priority %d\n", allowed, saved.policy, saved.priority);
+    if (allowed == 0)
+    {
+        UT_FAIL_FATAL("sched_getaffinity() failed");
+    }
+
+    UT_ASSERT_EQUAL(wifi_perf_pin_cpu(first), 0);
+    wifi_perf_sched_save(&current);
+    UT_ASSERT_EQUAL(affinity_cpus(&current, &pinned), 1);
+    UT_ASSERT_EQUAL(pinned, first);
+
+    errno = 0;
+    ret = wifi_perf_set_fifo(FIFO_PRIORITY);
+    pthread_getschedparam(pthread_self(), &policy, &param);
+    if (ret == 0)
+    {
+        UT_LOG("SCHED_FIFO granted\n");
+        UT_ASSERT_EQUAL(policy, SCHED_FIFO);
+        UT_ASSERT_EQUAL(param.sched_priority, FIFO_PRIORITY);
+    }
+    else
+    {
+        UT_LOG("SCHED_FIFO not permitted for this user\n");
+        UT_ASSERT_EQUAL(errno, EPERM);
+        UT_ASSERT_EQUAL(policy, saved.policy);
+    }
+
+    UT_ASSERT_EQUAL(wifi_perf_pin_cpu(-1), -1);
+    UT_ASSERT_EQUAL(wifi_perf_set_fifo(0), -1);
+
+    wifi_perf_sched_restore(&saved);
+    wifi_perf_sched_save(&current);
+    UT_ASSERT_EQUAL(affinity_cpus(&current, &pinned), allowed);
+    UT_ASSERT_EQUAL(current.policy, saved.policy);
+    UT_ASSERT_EQUAL(current.priority, saved.priority);
+
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify the clock overhead measurement and its subtraction
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Measure the cost of a clock reading | 10000 readings | Between 0 and 10 us | Should be successful |
+* | 02 | Subtract 50 ns from known samples | 100, 30, 50 ns | 50, 0, 0 ns | Should be successful |
+*/
+void test_l2_wifi_stability_overhead (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_perf_samples_t samples;
+    uint64_t overhead_ns;
+
+    overhead_ns = wifi_perf_clock_overhead_ns(OVERHEAD_ITERATIONS);
+    UT_LOG("clock_gettime() pair: %llu ns\n", (unsigned long long)overhead_ns);
+    UT_ASSERT_EQUAL(overhead_ns < OVERHEAD_MAX_NS, 1);
+    UT_ASSERT_EQUAL(wifi_perf_clock_overhead_ns(0), 0);
+
+    if (wifi_perf_samples_init(&samples, 3) != 0)
+    {
+        UT_FAIL_FATAL("Sample allocation failed");
+    }
+    wifi_perf_samples_add(&samples, 100);
+    wifi_perf_samples_add(&samples, 30);
+    wifi_perf_samples_add(&samples, 50);
+    wifi_perf_samples_subtract(&samples, 50);
+    UT_ASSERT_EQUAL(samples.count, 3);
+    UT_ASSERT_EQUAL(samples.samples[0], 50);
+    UT_ASSERT_EQUAL(samples.samples[1], 0);
+    UT_ASSERT_EQUAL(samples.samples[2], 0);
+    wifi_perf_samples_free(&samples);
+
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Report the latency spread of wifi_getRadioChannel() with and without the stability controls
+*
+* Times the getter after a warmup, first as the thread is scheduled, then pinned and, if
+* permitted, at SCHED_FIFO, and logs p50 and the coefficient of variation of both runs. Results
+* with a coefficient of variation above WIFI_PERF_CV_LIMIT are flagged as unstable. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 003 @n
+* **Priority:** Medium @n
+* @n
+* **Pre-Conditions:** wifi_init() has been called @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Time the getter unpinned | 10 warmup, 1000 measured calls | 1000 samples | Should be successful |
+* | 02 | Time the getter pinned and at SCHED_FIFO | 10 warmup, 1000 measured calls | 1000 samples | Should be successful |
+* | 03 | Restore the scheduling state | None | None | Should be successful |
+*/
+void test_l2_wifi_stability_latency_hal (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_perf_sched_t saved;
+    wifi_perf_samples_t samples;
+    wifi_perf_summary_t summary;
+    uint64_t overhead_ns;
+    int first;
+
+    if (wifi_perf_samples_init(&samples, HAL_ITERATIONS) != 0)
+    {
+        UT_FAIL_FATAL("Sample allocation failed");
+    }
+    wifi_perf_sched_save(&saved);
+    affinity_cpus(&saved, &first);
+    overhead_ns = wifi_perf_clock_overhead_ns(OVERHEAD_ITERATIONS);
+
+    measure_channel(&samples, overhead_ns, &summary);
+    UT_LOG("as scheduled:      p50=%.3fus cv=%.3f%s\n", summary.p50 / 1000.0, summary.cv,
+           (summary.cv > WIFI_PERF_CV_LIMIT) ? " unstable" : "");
+    UT_ASSERT_EQUAL(summary.count, HAL_ITERATIONS);
+
+    wifi_perf_pin_cpu(first);
+    wifi_perf_set_fifo(FIFO_PRIORITY);
+    measure_channel(&samples, overhead_ns, &summary);
+    wifi_perf_sched_restore(&saved);
+    UT_LOG("pinned to CPU %d: p50=%.3fus cv=%.3f%s\n", first, summary.p50 / 1000.0, summary.cv,
+           (summary.cv > WIFI_PERF_CV_LIMIT) ? " unstable" : "");
+    UT_ASSERT_EQUAL(summary.count, HAL_ITERATIONS);
+
+    wifi_perf_samples_free(&samples);
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_stability = NULL;
+static UT_test_suite_t * pSuite_stability_hal = NULL;
+
+/**
+ * @brief Register the measurement stability tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_stability_register_l2_tests (void)
+{
+    pSuite_stability = UT_add_suite("[L2 wifi_stability tests]", NULL, NULL);
+    if (pSuite_stability == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_stability, "l2_wifi_stability_controls", test_l2_wifi_stability_controls);
+    UT_add_test(pSuite_stability, "l2_wifi_stability_overhead", test_l2_wifi_stability_overhead);
+
+    pSuite_stability_hal = UT_add_suite("[L2 wifi_stability post-init tests]", WiFi_InitPreReq, WiFi_UnInitPosReq);
+    if (pSuite_stability_hal == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_stability_hal, "l2_wifi_stability_latency_hal", test_l2_wifi_stability_latency_hal);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_STABILITY_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
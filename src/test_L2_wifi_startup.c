@@ -0,0 +1,521 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_STARTUP_HALTEST_L2 RDK-V WiFi Startup Profiling L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for cold and warm start :
+ *
+ * Profiles wifi_init() and wifi_initWithConfig() with several wlan_Interface values. Every cycle
+ * records three times, all measured from the start of the init call:
+ *
+ * - the init call itself
+ * - the first successful wifi_getRadioStatus()
+ * - the first wifi_getNeighboringWiFiDiagnosticResult() with at least one access point
+ *
+ * Cycles are grouped by phase:
+ *
+ * - cold: the first init of the process. The HAL wrappers time it whichever test makes it
+ *   (wifi_hal_first_init()), so the status and scan times are only available when this suite
+ *   runs first.
+ * - after uninit: the first init of each configuration, following wifi_uninit()
+ * - steady: the remaining init/uninit cycles of the configuration
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_startup.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include "wifi_common_hal.h"
+#include "wifi_hal_api.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stats.h"
+#include "wifi_sim.h"
+
+#define HAL_CYCLES 5
+#define HAL_STATUS_LIMIT_MS 10000
+#define HAL_SCAN_LIMIT_MS 10000
+#define HAL_POLL_INTERVAL_MS 10
+#define HAL_REQUIRED_CONFIGS 2
+#define SIM_CYCLES 4
+#define SIM_COLD_INIT_MS 120
+#define SIM_WARM_INIT_MS 30
+#define SIM_RADIO_UP_MS 40
+#define SIM_FIRST_SCAN_MS 80
+#define SIM_LIMIT_MS 2000
+#define SIM_POLL_INTERVAL_MS 1
+
+extern const int RADIO_INDEX;
+
+/**
+ * @brief Init variants, NULL is wifi_init() and anything else wifi_initWithConfig() with that wlan_Interface
+ *
+ * The first HAL_REQUIRED_CONFIGS must work on every platform, the rest are reported only.
+ */
+static const char *startup_interfaces[] = { NULL, "wlan0", "wlan1" };
+
+#define STARTUP_CONFIGS (sizeof(startup_interfaces) / sizeof(startup_interfaces[0]))
+
+/**
+ * @brief Phase of an init cycle
+ */
+typedef enum
+{
+    PHASE_COLD = 0,      /*!< First init of the process */
+    PHASE_AFTER_UNINIT,  /*!< First init of a configuration after wifi_uninit() */
+    PHASE_STEADY,        /*!< Repeated init/uninit cycles */
+    PHASE_COUNT
+} startup_phase_t;
+
+static const char *phase_names[PHASE_COUNT] = { "cold", "after uninit", "steady" };
+
+/**
+ * @brief HAL calls used by the profiler
+ */
+typedef struct
+{
+    INT (*init)(void);
+    INT (*init_with_config)(wifi_halConfig_t *conf);
+    INT (*uninit)(void);
+    INT (*get_radio_status)(INT radioIndex, CHAR *output_string);
+    INT (*get_neighbors)(INT radioIndex, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size);
+    UINT status_limit_ms;
+    UINT scan_limit_ms;
+    UINT poll_interval_ms;
+} startup_ops_t;
+
+/**
+ * @brief Results of one configuration
+ */
+typedef struct
+{
+    wifi_perf_samples_t init[PHASE_COUNT];    /*!< Init call */
+    wifi_perf_samples_t status[PHASE_COUNT];  /*!< Init started to the first successful wifi_getRadioStatus() */
+    wifi_perf_samples_t scan[PHASE_COUNT];    /*!< Init started to the first non-empty scan result */
+    int failures;                             /*!< Init calls that failed */
+    int status_timeouts;
+    int scan_timeouts;
+} startup_result_t;
+
+static INT startup_init(const startup_ops_t *ops, size_t config)
+{
+    wifi_halConfig_t conf;
+
+    if (startup_interfaces[config] == NULL)
+    {
+        return ops->init();
+    }
+    memset(&conf, 0, sizeof(conf));
+    snprintf(conf.wlan_Interface, sizeof(conf.wlan_Interface), "%s", startup_interfaces[config]);
+    return ops->init_with_config(&conf);
+}
+
+static void startup_label(size_t config, char *buf, size_t size)
+{
+    if (startup_interfaces[config] == NULL)
+    {
+        snprintf(buf, size, "wifi_init");
+    }
+    else
+    {
+        snprintf(buf, size, "wifi_initWithConfig(%s)", startup_interfaces[config]);
+    }
+}
+
+/* Polls until the radio reports its status, returns 0 on timeout */
+static int startup_wait_status(const startup_ops_t *ops, uint64_t start, uint64_t *elapsed_ns)
+{
+    uint64_t limit = start + (uint64_t)ops->status_limit_ms * WIFI_PERF_NS_PER_MS;
+    CHAR status[64];
+
+    for (;;)
+    {
+        if (ops->get_radio_status(RADIO_INDEX, status) == RETURN_OK)
+        {
+            *elapsed_ns = wifi_perf_now_ns() - start;
+            return 1;
+        }
+        if (wifi_perf_now_ns() >= limit)
+        {
+            return 0;
+        }
+        wifi_perf_sleep_ms(ops->poll_interval_ms);
+    }
+}
+
+/* Polls until a scan returns at least one access point, returns 0 on timeout */
+static int startup_wait_scan(const startup_ops_t *ops, uint64_t start, uint64_t *elapsed_ns)
+{
+    uint64_t limit = start + (uint64_t)ops->scan_limit_ms * WIFI_PERF_NS_PER_MS;
+
+    for (;;)
+    {
+        wifi_neighbor_ap_t *aps = NULL;
+        UINT count = 0;
+        INT ret = ops->get_neighbors(RADIO_INDEX, &aps, &count);
+
+        free(aps);
+        if (ret == RETURN_OK && count > 0)
+        {
+            *elapsed_ns = wifi_perf_now_ns() - start;
+            return 1;
+        }
+        if (wifi_perf_now_ns() >= limit)
+        {
+            return 0;
+        }
+        wifi_perf_sleep_ms(ops->poll_interval_ms);
+    }
+}
+
+/*
+ * Runs every configuration for the given number of cycles. cold says whether the first
+ * init of the run is the first of the process. Once a scan times out the scan is not
+ * waited for again, a HAL without results would otherwise cost the full limit every cycle.
+ */
+static void startup_run(const startup_ops_t *ops, int cycles, int cold, startup_result_t results[STARTUP_CONFIGS])
+{
+    int scan_enabled = 1;
+
+    memset(results, 0, STARTUP_CONFIGS * sizeof(results[0]));
+    for (size_t config = 0; config < STARTUP_CONFIGS; config++)
+    {
+        for (int phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            wifi_perf_samples_init(&results[config].init[phase], cycles);
+            wifi_perf_samples_init(&results[config].status[phase], cycles);
+            wifi_perf_samples_init(&results[config].scan[phase], cycles);
+        }
+    }
+
+    for (size_t config = 0; config < STARTUP_CONFIGS; config++)
+    {
+        startup_result_t *result = &results[config];
+
+        for (int cycle = 0; cycle < cycles; cycle++)
+        {
+            startup_phase_t phase = (cycle == 0) ? PHASE_AFTER_UNINIT : PHASE_STEADY;
+            uint64_t start;
+            uint64_t elapsed_ns;
+
+            if (cold && config == 0 && cycle == 0)
+            {
+                phase = PHASE_COLD;
+            }
+            else
+            {
+                /* Fails harmlessly when nothing is initialised yet */
+                ops->uninit();
+            }
+
+            start = wifi_perf_now_ns();
+            if (startup_init(ops, config) != RETURN_OK)
+            {
+                result->failures++;
+                continue;
+            }
+            wifi_perf_samples_add(&result->init[phase], wifi_perf_now_ns() - start);
+
+            if (startup_wait_status(ops, start, &elapsed_ns))
+            {
+                wifi_perf_samples_add(&result->status[phase], elapsed_ns);
+            }
+            else
+            {
+                result->status_timeouts++;
+            }
+
+            if (scan_enabled && startup_wait_scan(ops, start, &elapsed_ns))
+            {
+                wifi_perf_samples_add(&result->scan[phase], elapsed_ns);
+            }
+            else if (scan_enabled)
+            {
+                result->scan_timeouts++;
+                scan_enabled = 0;
+                UT_LOG("No scan result within %u ms, not waiting for scans again\n", ops->scan_limit_ms);
+            }
+        }
+    }
+    ops->uninit();
+}
+
+static void startup_result_free(startup_result_t results[STARTUP_CONFIGS])
+{
+    for (size_t config = 0; config < STARTUP_CONFIGS; config++)
+    {
+        for (int phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            wifi_perf_samples_free(&results[config].init[phase]);
+            wifi_perf_samples_free(&results[config].status[phase]);
+            wifi_perf_samples_free(&results[config].scan[phase]);
+        }
+    }
+}
+
+static void startup_report(startup_result_t results[STARTUP_CONFIGS])
+{
+    static const char *metric_names[3] = { "init call", "to radio status", "to first scan" };
+    wifi_perf_summary_t summary;
+    char config_label[64];
+    char label[128];
+    char line[256];
+
+    for (size_t config = 0; config < STARTUP_CONFIGS; config++)
+    {
+        startup_label(config, config_label, sizeof(config_label));
+        for (int phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            wifi_perf_samples_t *metrics[3] = { &results[config].init[phase], &results[config].status[phase],
+                                                &results[config].scan[phase] };
+
+            for (int metric = 0; metric < 3; metric++)
+            {
+                if (metrics[metric]->count == 0)
+                {
+                    continue;
+                }
+                wifi_perf_summarize(metrics[metric], &summary);
+                snprintf(label, sizeof(label), "%s %s %s", config_label, phase_names[phase], metric_names[metric]);
+                UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), label, &summary));
+            }
+        }
+        UT_LOG("%s: failures=%d status timeouts=%d scan timeouts=%d\n", config_label, results[config].failures,
+               results[config].status_timeouts, results[config].scan_timeouts);
+    }
+}
+
+static INT sim_init(void)
+{
+    return wifi_sim_init(NULL);
+}
+
+static INT sim_init_with_config(wifi_halConfig_t *conf)
+{
+    if (conf == NULL)
+    {
+        return RETURN_ERR;
+    }
+    return wifi_sim_init(conf->wlan_Interface);
+}
+
+static double startup_p50(wifi_perf_samples_t *samples)
+{
+    wifi_perf_summary_t summary;
+
+    wifi_perf_summarize(samples, &summary);
+    return summary.p50;
+}
+
+/**
+* @brief Verify the startup profiler against the simulator
+*
+* The simulator takes 120 ms for the first init after a reset and 30 ms afterwards, reports the radio
+* status 40 ms after init and the first scan results 80 ms after init. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Reset the simulator and run four cycles of every configuration | wifi_init, wlan0, wlan1 | No failures or timeouts | Should be successful |
+* | 02 | Compare the cold init with the warm ones | None | Cold at least 120 ms, warm at least 30 ms and faster than cold | Should be successful |
+* | 03 | Check the radio status and scan times | None | At least the modelled delay after the init call | Should be successful |
+* | 04 | Check the interface after the last cycle of wlan1 | None | wifi_getRadioIfName() would report wlan1 | Should be successful |
+*/
+void test_l2_wifi_startup_sim (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    const startup_ops_t sim_ops = {
+        .init = sim_init,
+        .init_with_config = sim_init_with_config,
+        .uninit = wifi_sim_uninit,
+        .get_radio_status = wifi_sim_getRadioStatus,
+        .get_neighbors = wifi_sim_getNeighboringWiFiDiagnosticResult,
+        .status_limit_ms = SIM_LIMIT_MS,
+        .scan_limit_ms = SIM_LIMIT_MS,
+        .poll_interval_ms = SIM_POLL_INTERVAL_MS,
+    };
+    startup_result_t results[STARTUP_CONFIGS];
+    wifi_sim_timing_t timing;
+    wifi_sim_radio_t radio;
+    double ms = (double)WIFI_PERF_NS_PER_MS;
+
+    wifi_sim_reset();
+    wifi_sim_get_timing(&timing);
+    timing.cold_init_ms = SIM_COLD_INIT_MS;
+    timing.warm_init_ms = SIM_WARM_INIT_MS;
+    timing.radio_up_ms = SIM_RADIO_UP_MS;
+    timing.first_scan_ms = SIM_FIRST_SCAN_MS;
+    wifi_sim_set_timing(&timing);
+
+    startup_run(&sim_ops, SIM_CYCLES, 1, results);
+    wifi_sim_get_radio(&radio);
+    startup_report(results);
+    wifi_sim_reset();
+
+    for (size_t config = 0; config < STARTUP_CONFIGS; config++)
+    {
+        UT_ASSERT_EQUAL(results[config].failures, 0);
+        UT_ASSERT_EQUAL(results[config].status_timeouts, 0);
+        UT_ASSERT_EQUAL(results[config].scan_timeouts, 0);
+        UT_ASSERT_EQUAL(results[config].init[PHASE_AFTER_UNINIT].count, (config == 0) ? 0 : 1);
+        UT_ASSERT_EQUAL(startup_p50(&results[config].init[PHASE_STEADY]) >= SIM_WARM_INIT_MS * ms, 1);
+        UT_ASSERT_EQUAL(startup_p50(&results[config].init[PHASE_STEADY]) < SIM_COLD_INIT_MS * ms, 1);
+        UT_ASSERT_EQUAL(startup_p50(&results[config].status[PHASE_STEADY]) >= (SIM_WARM_INIT_MS + SIM_RADIO_UP_MS) * ms, 1);
+        UT_ASSERT_EQUAL(startup_p50(&results[config].scan[PHASE_STEADY]) >= (SIM_WARM_INIT_MS + SIM_FIRST_SCAN_MS) * ms, 1);
+    }
+    UT_ASSERT_EQUAL(results[0].init[PHASE_COLD].count, 1);
+    UT_ASSERT_EQUAL(startup_p50(&results[0].init[PHASE_COLD]) >= SIM_COLD_INIT_MS * ms, 1);
+    UT_ASSERT_EQUAL(startup_p50(&results[0].status[PHASE_COLD]) >= (SIM_COLD_INIT_MS + SIM_RADIO_UP_MS) * ms, 1);
+    UT_ASSERT_EQUAL(strcmp(radio.if_name, startup_interfaces[STARTUP_CONFIGS - 1]), 0);
+
+    startup_result_free(results);
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Profile cold and warm start of the HAL under test
+*
+* Runs five init/uninit cycles of wifi_init(), wifi_initWithConfig("wlan0") and
+* wifi_initWithConfig("wlan1"). Configurations after the first two are reported but may fail
+* on platforms without that interface. @n
+*
+* **Test Group ID:** Stress: 03 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** Best run as the only suite of the process, so that the cold start includes the radio status and scan times @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Log the first init of the process if another test made it | None | None | Should be successful |
+* | 02 | Run five cycles of every configuration | wifi_init, wlan0, wlan1 | wifi_init and wlan0 never fail | Should Pass |
+* | 03 | Wait for the radio status after every init | radioIndex = 1 | Within 10 s for wifi_init and wlan0 | Should Pass |
+* | 04 | Wait for the first scan result after every init | radioIndex = 1 | Logged, not checked | Should be successful |
+* | 05 | Leave the HAL uninitialised | None | None | Cleanup |
+*/
+void test_l2_wifi_startup_hal (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    const startup_ops_t hal_ops = {
+        .init = wifi_init,
+        .init_with_config = wifi_initWithConfig,
+        .uninit = wifi_uninit,
+        .get_radio_status = wifi_getRadioStatus,
+        .get_neighbors = wifi_getNeighboringWiFiDiagnosticResult,
+        .status_limit_ms = HAL_STATUS_LIMIT_MS,
+        .scan_limit_ms = HAL_SCAN_LIMIT_MS,
+        .poll_interval_ms = HAL_POLL_INTERVAL_MS,
+    };
+    startup_result_t results[STARTUP_CONFIGS];
+    wifi_hal_first_init_t first;
+    int cold = !wifi_hal_first_init(&first);
+
+    if (!cold)
+    {
+        UT_LOG("Cold start was made earlier in this process: %s took %.3f ms and returned %d\n",
+               wifi_hal_api_name(first.api), (double)first.call_ns / WIFI_PERF_NS_PER_MS, first.result);
+    }
+
+    startup_run(&hal_ops, HAL_CYCLES, cold, results);
+    startup_report(results);
+
+    for (size_t config = 0; config < HAL_REQUIRED_CONFIGS; config++)
+    {
+        UT_ASSERT_EQUAL(results[config].failures, 0);
+        UT_ASSERT_EQUAL(results[config].status_timeouts, 0);
+    }
+
+    startup_result_free(results);
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_startup = NULL;
+
+/**
+ * @brief Register the startup profiling tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_startup_register_l2_tests (void)
+{
+    /* The HAL test does its own init and uninit, so the suite has no init prerequisite */
+    pSuite_startup = UT_add_suite("[L2 wifi_startup tests]", NULL, NULL);
+    if (pSuite_startup == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_startup, "l2_wifi_startup_sim", test_l2_wifi_startup_sim);
+    UT_add_test(pSuite_startup, "l2_wifi_startup_hal", test_l2_wifi_startup_hal);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_STARTUP_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,505 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_STATS_STORE_HALTEST_L2 RDK-V WiFi Statistics Store L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the simulator statistics store :
+ *
+ * Checks the store behind wifi_sim_getStats(), wifi_sim_getRadioTrafficStats()
+ * and wifi_sim_getSSIDTrafficStats(), which the getters read under a sequence
+ * counter instead of the simulator lock.
+ *
+ * The stress test runs a thread adding traffic as fast as it can against 1 to
+ * 64 reader threads calling the three getters. Every batch of traffic keeps
+ * fixed ratios between the counters of each structure, so a reader that got
+ * half of one update and half of the next sees them broken. The same run with
+ * readers calling a getter that takes the simulator lock shows what the
+ * statistics getters cost before.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_stats_store.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stability.h"
+#include "wifi_sim.h"
+
+#define STORE_HANDSHAKE_MS 20
+#define STORE_CALLBACK_TIMEOUT_MS 2000
+#define STORE_MAX_READERS 64
+#define STORE_RUN_MS 200
+#define STORE_PROGRESS_TIMEOUT_MS 5000
+#define STORE_PACKET_BYTES 1500
+#define STORE_LATENCY_EVERY 64
+
+/**
+ * @brief One traffic batch of the stress test, every counter a fixed multiple of the batch count
+ */
+static const wifi_sim_traffic_t store_batch = {
+    .bytes_sent = 2 * STORE_PACKET_BYTES,
+    .bytes_received = 4 * STORE_PACKET_BYTES,
+    .packets_sent = 2,
+    .packets_received = 4,
+    .multicast_sent = 0,
+    .multicast_received = 1,
+    .retransmissions = 1,
+    .errors_sent = 0,
+    .errors_received = 0,
+    .discards_sent = 0,
+    .discards_received = 1,
+};
+
+/**
+ * @brief One reader thread of the stress test
+ */
+typedef struct
+{
+    pthread_t thread;
+    BOOL locked;                 /*!< Call the locking baseline getter instead */
+    uint64_t reads;
+    uint64_t torn;
+    uint64_t failures;
+    uint64_t read_ns;            /*!< Summed over every STORE_LATENCY_EVERY-th read */
+    uint64_t timed;
+} store_reader_t;
+
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t state_changed = PTHREAD_COND_INITIALIZER;
+static int connect_count = 0;
+static volatile int store_stop = 0;
+static uint64_t store_writes = 0;
+
+static INT store_connect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    pthread_mutex_lock(&state_lock);
+    connect_count++;
+    pthread_cond_broadcast(&state_changed);
+    pthread_mutex_unlock(&state_lock);
+    return RETURN_OK;
+}
+
+/* Fresh, initialised simulator connected to SimHome */
+static int store_setup(void)
+{
+    wifi_sim_timing_t timing;
+    CHAR ssid[] = "SimHome";
+    CHAR passphrase[] = "simulated-passphrase";
+    CHAR empty[1] = "";
+    struct timespec deadline;
+    int ret = 0;
+
+    wifi_sim_reset();
+    wifi_sim_get_timing(&timing);
+    timing.handshake_ms = STORE_HANDSHAKE_MS;
+    wifi_sim_set_timing(&timing);
+    wifi_sim_init(NULL);
+    wifi_sim_connectEndpoint_callback_register(store_connect_callback);
+
+    pthread_mutex_lock(&state_lock);
+    connect_count = 0;
+    pthread_mutex_unlock(&state_lock);
+    if (wifi_sim_connectEndpoint(1, ssid, WIFI_SECURITY_WPA2_PSK_AES, empty, empty, passphrase, 0, empty, empty, empty,
+                                 empty) != RETURN_OK)
+    {
+        return -1;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += STORE_CALLBACK_TIMEOUT_MS / 1000;
+    pthread_mutex_lock(&state_lock);
+    while (connect_count == 0 && ret == 0)
+    {
+        ret = pthread_cond_timedwait(&state_changed, &state_lock, &deadline);
+    }
+    pthread_mutex_unlock(&state_lock);
+    return (connect_count > 0) ? 0 : -1;
+}
+
+/**
+* @brief Verify the statistics getters follow the simulator state
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Read the statistics and add traffic before initialisation | None | RETURN_ERR | Should be successful |
+* | 02 | Initialise, read the station statistics | None | RETURN_OK, all zero while not connected | Should be successful |
+* | 03 | Add traffic with more multicast than packets | multicast_sent = 3, packets_sent = 2 | RETURN_ERR | Should be successful |
+* | 04 | Connect, add one batch twice | store_batch | Radio, SSID and station counters at twice the batch | Should be successful |
+* | 05 | Uninitialise | None | RETURN_ERR from the getters, publishes counted | Should be successful |
+*/
+void test_l2_wifi_stats_store_getters (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wifi_sim_traffic_t traffic = { 0 };
+    wifi_sta_stats_t sta;
+    wifi_radioTrafficStats_t radio;
+    wifi_ssidTrafficStats_t ssid;
+    wifi_sim_store_stats_t store;
+
+    wifi_sim_reset();
+    UT_ASSERT_EQUAL(wifi_sim_getStats(1, &sta), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_sim_getRadioTrafficStats(1, &radio), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_sim_getSSIDTrafficStats(1, &ssid), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_sim_add_traffic(&store_batch), RETURN_ERR);
+
+    wifi_sim_init(NULL);
+    memset(&sta, 0xff, sizeof(sta));
+    UT_ASSERT_EQUAL(wifi_sim_getStats(1, &sta), RETURN_OK);
+    UT_ASSERT_EQUAL(sta.sta_SSID[0], '\0');
+    UT_ASSERT_EQUAL(sta.sta_Retransmissions, 0);
+    UT_ASSERT_EQUAL(wifi_sim_getStats(2, &sta), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_sim_getStats(1, NULL), RETURN_ERR);
+
+    traffic.packets_sent = 2;
+    traffic.multicast_sent = 3;
+    UT_ASSERT_EQUAL(wifi_sim_add_traffic(&traffic), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_sim_add_traffic(NULL), RETURN_ERR);
+
+    if (store_setup() != 0)
+    {
+        wifi_sim_reset();
+        UT_FAIL_FATAL("Simulator did not connect");
+    }
+    UT_ASSERT_EQUAL(wifi_sim_add_traffic(&store_batch), RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_sim_add_traffic(&store_batch), RETURN_OK);
+
+    UT_ASSERT_EQUAL(wifi_sim_getRadioTrafficStats(1, &radio), RETURN_OK);
+    UT_ASSERT_EQUAL(radio.radio_BytesSent, 4 * STORE_PACKET_BYTES);
+    UT_ASSERT_EQUAL(radio.radio_BytesReceived, 8 * STORE_PACKET_BYTES);
+    UT_ASSERT_EQUAL(radio.radio_PacketsSent, 4);
+    UT_ASSERT_EQUAL(radio.radio_PacketsReceived, 8);
+    UT_ASSERT_EQUAL(radio.radio_DiscardPacketsReceived, 2);
+
+    UT_ASSERT_EQUAL(wifi_sim_getSSIDTrafficStats(1, &ssid), RETURN_OK);
+    UT_ASSERT_EQUAL(ssid.ssid_BytesReceived, 8 * STORE_PACKET_BYTES);
+    UT_ASSERT_EQUAL(ssid.ssid_UnicastPacketsSent, 4);
+    UT_ASSERT_EQUAL(ssid.ssid_UnicastPacketsReceived, 6);
+    UT_ASSERT_EQUAL(ssid.ssid_MulticastPacketsReceived, 2);
+    UT_ASSERT_EQUAL(ssid.ssid_RetransCount, 2);
+    UT_ASSERT_EQUAL(ssid.ssid_DiscardedPacketsReceived, 2);
+
+    UT_ASSERT_EQUAL(wifi_sim_getStats(1, &sta), RETURN_OK);
+    UT_ASSERT_EQUAL(strcmp(sta.sta_SSID, "SimHome"), 0);
+    UT_ASSERT_EQUAL(sta.sta_Retransmissions, 2);
+
+    UT_ASSERT_EQUAL(wifi_sim_uninit(), RETURN_OK);
+    UT_ASSERT_EQUAL(wifi_sim_getStats(1, &sta), RETURN_ERR);
+    UT_ASSERT_EQUAL(wifi_sim_getRadioTrafficStats(1, &radio), RETURN_ERR);
+    wifi_sim_get_store_stats(&store);
+    UT_ASSERT_TRUE(store.publishes > 0);
+
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+/* TRUE if the three structures each hold a whole number of batches */
+static BOOL store_consistent(const wifi_sta_stats_t *sta, const wifi_radioTrafficStats_t *radio,
+                             const wifi_ssidTrafficStats_t *ssid)
+{
+    ULONG batches = radio->radio_PacketsReceived / store_batch.packets_received;
+
+    if (radio->radio_BytesSent != batches * store_batch.bytes_sent ||
+        radio->radio_BytesReceived != batches * store_batch.bytes_received ||
+        radio->radio_PacketsSent != batches * store_batch.packets_sent ||
+        radio->radio_PacketsReceived != batches * store_batch.packets_received ||
+        radio->radio_DiscardPacketsReceived != batches * store_batch.discards_received)
+    {
+        return FALSE;
+    }
+
+    batches = ssid->ssid_PacketsReceived / store_batch.packets_received;
+    if (ssid->ssid_BytesReceived != batches * store_batch.bytes_received ||
+        ssid->ssid_PacketsSent != batches * store_batch.packets_sent ||
+        ssid->ssid_MulticastPacketsReceived != batches * store_batch.multicast_received ||
+        ssid->ssid_UnicastPacketsReceived != batches * (store_batch.packets_received - store_batch.multicast_received) ||
+        ssid->ssid_RetransCount != batches * store_batch.retransmissions)
+    {
+        return FALSE;
+    }
+
+    /* The station fields are written once at association and must come out whole */
+    return (strcmp(sta->sta_SSID, "SimHome") == 0 && strcmp(sta->sta_BSSID, "02:00:00:00:00:01") == 0 &&
+            sta->sta_Frequency == 5180) ? TRUE : FALSE;
+}
+
+static void *store_writer_thread(void *arg)
+{
+    while (!__atomic_load_n(&store_stop, __ATOMIC_ACQUIRE))
+    {
+        if (wifi_sim_add_traffic(&store_batch) == RETURN_OK)
+        {
+            __atomic_add_fetch(&store_writes, 1, __ATOMIC_RELAXED);
+        }
+    }
+    return NULL;
+}
+
+static void *store_reader_thread(void *arg)
+{
+    store_reader_t *reader = (store_reader_t *)arg;
+    wifi_sta_stats_t sta;
+    wifi_radioTrafficStats_t radio;
+    wifi_ssidTrafficStats_t ssid;
+    CHAR status[64];
+
+    while (!__atomic_load_n(&store_stop, __ATOMIC_ACQUIRE))
+    {
+        BOOL timed = ((reader->reads % STORE_LATENCY_EVERY) == 0);
+        uint64_t start = timed ? wifi_perf_now_ns() : 0;
+
+        if (reader->locked)
+        {
+            /* Takes the simulator lock, as the statistics getters did */
+            if (wifi_sim_getRadioStatus(1, status) != RETURN_OK)
+            {
+                reader->failures++;
+            }
+        }
+        else if (wifi_sim_getStats(1, &sta) != RETURN_OK || wifi_sim_getRadioTrafficStats(1, &radio) != RETURN_OK ||
+                 wifi_sim_getSSIDTrafficStats(1, &ssid) != RETURN_OK)
+        {
+            reader->failures++;
+        }
+        else if (!store_consistent(&sta, &radio, &ssid))
+        {
+            reader->torn++;
+        }
+        if (timed)
+        {
+            reader->read_ns += wifi_perf_now_ns() - start;
+            reader->timed++;
+        }
+        /* Only this thread writes it, the store lets store_progressed() read it */
+        __atomic_store_n(&reader->reads, reader->reads + 1, __ATOMIC_RELAXED);
+    }
+    return NULL;
+}
+
+/* Whether the writer and every reader started have made at least one call */
+static BOOL store_progressed(const store_reader_t *readers, int started)
+{
+    if (__atomic_load_n(&store_writes, __ATOMIC_RELAXED) == 0)
+    {
+        return FALSE;
+    }
+    for (int i = 0; i < started; i++)
+    {
+        if (__atomic_load_n(&readers[i].reads, __ATOMIC_RELAXED) == 0)
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/*
+ * Runs the writer against count readers for STORE_RUN_MS, longer if a thread has not run yet,
+ * returns the number of readers started and the length of the run in elapsed_ns
+ */
+static int store_run(store_reader_t *readers, int count, BOOL locked, uint64_t *writes, uint64_t *elapsed_ns)
+{
+    pthread_t writer;
+    int started = 0;
+    uint64_t start;
+    uint64_t deadline;
+
+    __atomic_store_n(&store_stop, 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&store_writes, 0, __ATOMIC_RELAXED);
+    memset(readers, 0, (size_t)count * sizeof(*readers));
+    start = wifi_perf_now_ns();
+    if (wifi_perf_thread_create(&writer, store_writer_thread, NULL) != 0)
+    {
+        *elapsed_ns = 0;
+        return 0;
+    }
+    for (; started < count; started++)
+    {
+        readers[started].locked = locked;
+        if (wifi_perf_thread_create(&readers[started].thread, store_reader_thread, &readers[started]) != 0)
+        {
+            break;
+        }
+    }
+    wifi_perf_sleep_ms(STORE_RUN_MS);
+
+    /* With more threads than CPUs a thread can miss the window, only a thread that never runs is starved */
+    deadline = wifi_perf_now_ns() + (uint64_t)STORE_PROGRESS_TIMEOUT_MS * 1000000ULL;
+    while (!store_progressed(readers, started) && wifi_perf_now_ns() < deadline)
+    {
+        wifi_perf_sleep_ms(1);
+    }
+    __atomic_store_n(&store_stop, 1, __ATOMIC_RELEASE);
+    for (int i = 0; i < started; i++)
+    {
+        pthread_join(readers[i].thread, NULL);
+    }
+    pthread_join(writer, NULL);
+    *elapsed_ns = wifi_perf_now_ns() - start;
+    *writes = __atomic_load_n(&store_writes, __ATOMIC_RELAXED);
+    return started;
+}
+
+/**
+* @brief Stress the statistics getters with up to 64 readers against a writer adding traffic
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** Medium @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Connect, run the writer against 1, 2, 4 ... 64 statistics readers | 200 ms each, longer until every thread has run | No failed or torn reads, every reader and the writer make progress | Should be successful |
+* | 02 | Repeat with readers calling a getter that takes the simulator lock | 200 ms each | Logged for comparison | Should be successful |
+* | 03 | Log reads and writes per second, mean read time and store retries | None | None | Should be successful |
+*/
+void test_l2_wifi_stats_store_stress (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    static store_reader_t readers[STORE_MAX_READERS];
+    wifi_sim_store_stats_t before;
+    wifi_sim_store_stats_t after;
+
+    if (store_setup() != 0)
+    {
+        wifi_sim_reset();
+        UT_FAIL_FATAL("Simulator did not connect");
+    }
+
+    UT_LOG("\n%ld CPUs online, a seqlock read calls all three statistics getters\n", sysconf(_SC_NPROCESSORS_ONLN));
+    UT_LOG("| %-8s | readers | reads/s    | mean read us | writes/s   | retries | torn |\n", "getter");
+    for (int locked = 0; locked <= 1; locked++)
+    {
+        for (int count = 1; count <= STORE_MAX_READERS; count *= 2)
+        {
+            uint64_t writes = 0;
+            uint64_t elapsed_ns = 0;
+            uint64_t reads = 0;
+            uint64_t torn = 0;
+            uint64_t failures = 0;
+            uint64_t read_ns = 0;
+            uint64_t timed = 0;
+            int idle = 0;
+            int started;
+
+            wifi_sim_get_store_stats(&before);
+            started = store_run(readers, count, locked ? TRUE : FALSE, &writes, &elapsed_ns);
+            wifi_sim_get_store_stats(&after);
+            UT_ASSERT_EQUAL(started, count);
+            for (int i = 0; i < started; i++)
+            {
+                reads += readers[i].reads;
+                torn += readers[i].torn;
+                failures += readers[i].failures;
+                read_ns += readers[i].read_ns;
+                timed += readers[i].timed;
+                idle += (readers[i].reads == 0) ? 1 : 0;
+            }
+            UT_LOG("| %-8s | %7d | %10.0f | %12.2f | %10.0f | %7lu | %4llu |\n", locked ? "locked" : "seqlock", count,
+                   reads * 1e9 / elapsed_ns, (timed > 0) ? read_ns / 1000.0 / timed : 0.0,
+                   writes * 1e9 / elapsed_ns, after.retries - before.retries, (unsigned long long)torn);
+            UT_ASSERT_EQUAL(torn, 0);
+            UT_ASSERT_EQUAL(failures, 0);
+            UT_ASSERT_EQUAL(idle, 0);
+            UT_ASSERT_TRUE(writes > 0);
+        }
+    }
+
+    wifi_sim_reset();
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_stats_store = NULL;
+
+/**
+ * @brief Register the statistics store tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_stats_store_register_l2_tests (void)
+{
+    pSuite_stats_store = UT_add_suite("[L2 wifi_stats_store tests]", NULL, NULL);
+    if (pSuite_stats_store == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_stats_store, "l2_wifi_stats_store_getters", test_l2_wifi_stats_store_getters);
+    UT_add_test(pSuite_stats_store, "l2_wifi_stats_store_stress", test_l2_wifi_stats_store_stress);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_STATS_STORE_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,332 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_TRACE_HALTEST_L2 RDK-V WiFi Trace Export L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for the trace exporter :
+ *
+ * Records unbalanced spans, as a test failing out of an assertion and a
+ * wrapped ring leave them, and checks that the exported trace (wifi_hal_trace.h)
+ * is balanced on every thread. Checks that a Perfetto event too large for a
+ * packet fails the export instead of corrupting the stream.
+ *
+ * The tests are skipped while the run itself is traced, they would discard
+ * its events.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_trace.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "wifi_hal_trace.h"
+#include "wifi_perf_stability.h"
+
+#define TRACE_SMALL_RING 8
+#define TRACE_MAX_THREADS 8
+#define TRACE_LONG_NAME 600
+
+static char trace_long_name[TRACE_LONG_NAME + 1];
+
+/* A test that failed out of an assertion, then one that passed */
+static void *trace_failed_test_thread(void *arg)
+{
+    wifi_trace_record("test_a", WIFI_TRACE_CATEGORY_TEST, WIFI_TRACE_PHASE_BEGIN);
+    wifi_trace_record("wifi_getRadioEnable", WIFI_TRACE_CATEGORY_HAL, WIFI_TRACE_PHASE_BEGIN);
+    wifi_trace_record("wifi_getRadioEnable", WIFI_TRACE_CATEGORY_HAL, WIFI_TRACE_PHASE_END);
+    wifi_trace_record("test_b", WIFI_TRACE_CATEGORY_TEST, WIFI_TRACE_PHASE_BEGIN);
+    wifi_trace_record("test_b", WIFI_TRACE_CATEGORY_TEST, WIFI_TRACE_PHASE_END);
+    return NULL;
+}
+
+/* Ten events on a ring of eight: the begins of the first call and of the outer span are lost */
+static void *trace_wrapped_thread(void *arg)
+{
+    wifi_trace_record("outer", WIFI_TRACE_CATEGORY_USER, WIFI_TRACE_PHASE_BEGIN);
+    for (int i = 0; i < 4; i++)
+    {
+        wifi_trace_record("wifi_getSSIDName", WIFI_TRACE_CATEGORY_HAL, WIFI_TRACE_PHASE_BEGIN);
+        wifi_trace_record("wifi_getSSIDName", WIFI_TRACE_CATEGORY_HAL, WIFI_TRACE_PHASE_END);
+    }
+    wifi_trace_record("outer", WIFI_TRACE_CATEGORY_USER, WIFI_TRACE_PHASE_END);
+    return NULL;
+}
+
+static void *trace_long_name_thread(void *arg)
+{
+    wifi_trace_record(trace_long_name, WIFI_TRACE_CATEGORY_USER, WIFI_TRACE_PHASE_BEGIN);
+    wifi_trace_record(trace_long_name, WIFI_TRACE_CATEGORY_USER, WIFI_TRACE_PHASE_END);
+    return NULL;
+}
+
+static void trace_run(void *(*fn)(void *))
+{
+    pthread_t thread;
+
+    if (wifi_perf_thread_create(&thread, fn, NULL) == 0)
+    {
+        pthread_join(thread, NULL);
+    }
+}
+
+/* Starts from an empty trace, returns -1 if the run itself is being traced */
+static int trace_setup(uint32_t capacity)
+{
+    if (wifi_trace_active)
+    {
+        return -1;
+    }
+    wifi_trace_reset();
+    wifi_trace_set_capacity(capacity);
+    wifi_trace_enable(1);
+    return 0;
+}
+
+static void trace_teardown(void)
+{
+    wifi_trace_enable(0);
+    wifi_trace_reset();
+    wifi_trace_set_capacity(0);
+}
+
+/*
+ * Checks every thread of a Chrome JSON export nests: no end without an open
+ * begin and nothing open at the end. Counts the begins and ends.
+ */
+static int trace_check_json(const char *path, int *begins, int *ends)
+{
+    int tids[TRACE_MAX_THREADS];
+    int depth[TRACE_MAX_THREADS];
+    int threads = 0;
+    char line[1024];
+    FILE *fp = fopen(path, "r");
+    int ret = 0;
+
+    *begins = 0;
+    *ends = 0;
+    if (fp == NULL)
+    {
+        return -1;
+    }
+    while (fgets(line, sizeof(line), fp) != NULL && ret == 0)
+    {
+        const char *tid_field = strstr(line, "\"tid\":");
+        int begin = (strstr(line, "\"ph\":\"B\"") != NULL);
+        int end = (strstr(line, "\"ph\":\"E\"") != NULL);
+        int tid;
+        int t;
+
+        if (tid_field == NULL || (!begin && !end))
+        {
+            continue;
+        }
+        tid = atoi(tid_field + strlen("\"tid\":"));
+        for (t = 0; t < threads && tids[t] != tid; t++)
+        {
+        }
+        if (t == threads)
+        {
+            if (threads == TRACE_MAX_THREADS)
+            {
+                ret = -1;
+                break;
+            }
+            tids[threads] = tid;
+            depth[threads++] = 0;
+        }
+        depth[t] += begin ? 1 : -1;
+        *begins += begin;
+        *ends += end;
+        if (depth[t] < 0)
+        {
+            ret = -1;
+        }
+    }
+    fclose(fp);
+    for (int t = 0; t < threads; t++)
+    {
+        if (depth[t] != 0)
+        {
+            ret = -1;
+        }
+    }
+    return ret;
+}
+
+/**
+* @brief Verify the exporter closes spans left open and drops ends without a begin
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | On one thread, begin a test without ending it, then run a second test | test_a, test_b | None | Should be successful |
+* | 02 | On another thread, record ten events in a ring of eight | outer span around four HAL calls | Two events dropped | Should be successful |
+* | 03 | Export as Chrome JSON and check every thread | None | Balanced: 3 spans on the first thread, 3 on the second | Should be successful |
+* | 04 | Export as Perfetto | None | 0 | Should be successful |
+*/
+void test_l2_wifi_trace_balance (void)
+{
+    char path[] = "/tmp/wifi_trace_XXXXXX";
+    int begins = 0;
+    int ends = 0;
+    int fd;
+
+    WIFI_TRACE_TEST_BEGIN();
+    if (trace_setup(TRACE_SMALL_RING) != 0)
+    {
+        UT_LOG("Run traced through WIFI_HAL_TRACE, skipped\n");
+        WIFI_TRACE_TEST_END();
+        return;
+    }
+    trace_run(trace_failed_test_thread);
+    trace_run(trace_wrapped_thread);
+    wifi_trace_enable(0);
+    UT_ASSERT_EQUAL(wifi_trace_dropped(), 2);
+
+    fd = mkstemp(path);
+    UT_ASSERT_TRUE(fd >= 0);
+    close(fd);
+    UT_ASSERT_EQUAL(wifi_trace_export(path, WIFI_TRACE_FORMAT_CHROME_JSON), 0);
+    UT_ASSERT_EQUAL(trace_check_json(path, &begins, &ends), 0);
+    UT_LOG("%d begins, %d ends\n", begins, ends);
+    UT_ASSERT_EQUAL(begins, 6);
+    UT_ASSERT_EQUAL(ends, 6);
+    UT_ASSERT_EQUAL(wifi_trace_export(path, WIFI_TRACE_FORMAT_PERFETTO), 0);
+    unlink(path);
+
+    trace_teardown();
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify a Perfetto event too large for a packet fails the export
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Record a span with a long name | 600 characters | None | Should be successful |
+* | 02 | Export as Perfetto | None | -1 | Should be successful |
+* | 03 | Export as Chrome JSON | None | 0 | Should be successful |
+*/
+void test_l2_wifi_trace_perfetto_overflow (void)
+{
+    char path[] = "/tmp/wifi_trace_XXXXXX";
+    int fd;
+
+    WIFI_TRACE_TEST_BEGIN();
+    if (trace_setup(0) != 0)
+    {
+        UT_LOG("Run traced through WIFI_HAL_TRACE, skipped\n");
+        WIFI_TRACE_TEST_END();
+        return;
+    }
+    memset(trace_long_name, 'x', TRACE_LONG_NAME);
+    trace_long_name[TRACE_LONG_NAME] = '\0';
+    trace_run(trace_long_name_thread);
+    wifi_trace_enable(0);
+
+    fd = mkstemp(path);
+    UT_ASSERT_TRUE(fd >= 0);
+    close(fd);
+    UT_ASSERT_EQUAL(wifi_trace_export(path, WIFI_TRACE_FORMAT_PERFETTO), -1);
+    UT_ASSERT_EQUAL(wifi_trace_export(path, WIFI_TRACE_FORMAT_CHROME_JSON), 0);
+    unlink(path);
+
+    trace_teardown();
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_trace = NULL;
+
+/**
+ * @brief Register the trace exporter tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_trace_register_l2_tests (void)
+{
+    pSuite_trace = UT_add_suite("[L2 wifi_trace tests]", NULL, NULL);
+    if (pSuite_trace == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_trace, "l2_wifi_trace_balance", test_l2_wifi_trace_balance);
+    UT_add_test(pSuite_trace, "l2_wifi_trace_perfetto_overflow", test_l2_wifi_trace_perfetto_overflow);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_TRACE_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
@@ -0,0 +1,581 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_HALTEST RDK-V WiFi HAL Tests
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_WPS_LATENCY_HALTEST_L2 RDK-V WiFi WPS Latency L2 Test Cases
+ * @{
+ * @parblock
+ *  ### L2 Tests for WPS pairing latency :
+ *
+ * Measures two things:
+ *
+ * - time to credential: wifi_setCliWpsButtonPush() or wifi_setCliWpsEnrolleePin() to WIFI_HAL_CONNECTED
+ * - cancel responsiveness: how long wifi_cancelWpsPairing() takes to return, and how long until
+ *   the radio accepts wifi_setRadioScanningFreqList() again
+ *
+ * A WPS session holds the radio, so a slow cancel keeps scans and connects failing long after
+ * the user backed out of the pairing screen.
+ *
+ * The module tests run against the registrar of the HAL simulator (simulator/include/wifi_sim.h),
+ * with shortened response times. The HAL test only measures cancellation, which needs no
+ * registrar. With HAL_BACKEND=simulator it runs against the same simulator.
+ *
+ * **Pre-Conditions:**  None @n
+ * **Dependencies:** None @n
+ *
+ * Refer to API Definition specification documentation : [rdkv-wifi_halSpec.md](../../docs/pages/rdkv-wifi_halSpec.md)
+ * @endparblock
+ */
+
+/**
+* @file test_L2_wifi_wps_latency.c
+*
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <time.h>
+#include "wifi_client_hal.h"
+#include "wifi_hal_trace.h"
+#include "wifi_perf_clock.h"
+#include "wifi_perf_stats.h"
+#include "wifi_sim.h"
+
+#define HAL_CANCEL_ITERATIONS 3
+#define HAL_SESSION_MS 100
+#define HAL_RADIO_FREE_BUDGET_MS 2000
+#define HAL_SCAN_FREQ_LIST "2412 2437 2462"
+#define CANCEL_CALL_BUDGET_MS 50
+#define RADIO_POLL_LIMIT_MS 10000
+#define LATE_CALLBACK_WAIT_MS 200
+#define SIM_ITERATIONS 3
+#define SIM_PBC_RESPONSE_MS 150
+#define SIM_PIN_RESPONSE_MS 250
+#define SIM_CANCEL_MS 20
+#define SIM_HANDSHAKE_MS 50
+#define SIM_SLACK_MS 200
+#define SIM_CALLBACK_TIMEOUT_MS 2000
+#define SIM_REGISTRAR_PIN "12345670"
+#define SIM_WRONG_PIN "00000000"
+
+extern int WiFi_InitPreReq(void);
+extern int WiFi_UnInitPosReq(void);
+extern const int RADIO_INDEX;
+extern const int SSID_INDEX;
+
+/**
+ * @brief Enrollee methods
+ */
+typedef enum
+{
+    WPS_PBC = 0, /*!< wifi_setCliWpsButtonPush() */
+    WPS_PIN,     /*!< wifi_setCliWpsEnrolleePin() */
+    WPS_METHOD_COUNT
+} wps_method_t;
+
+static const char *method_names[WPS_METHOD_COUNT] = { "push button", "PIN" };
+
+/**
+ * @brief HAL calls used by the benchmark
+ */
+typedef struct
+{
+    INT (*push_button)(INT ssidIndex);
+    INT (*enrollee_pin)(INT ssidIndex, CHAR *EnrolleePin);
+    INT (*cancel)(void);
+    INT (*set_freq_list)(INT radioIndex, const CHAR *freqList);
+    INT (*wait_scan)(void);
+    void (*register_connect)(wifi_connectEndpoint_callback callback_proc);
+    UINT callback_timeout_ms;
+} wps_ops_t;
+
+/**
+ * @brief Results of the cancel measurement
+ */
+typedef struct
+{
+    wifi_perf_samples_t cancel_call;   /*!< wifi_cancelWpsPairing() call */
+    wifi_perf_samples_t radio_free;    /*!< wifi_cancelWpsPairing() called to the first accepted scan */
+    int failures;                      /*!< Calls that failed or radio never freed */
+    int scan_accepted;                 /*!< Scans accepted while the session was running */
+    int late_connects;                 /*!< WIFI_HAL_CONNECTED reported after the cancel */
+} wps_cancel_result_t;
+
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t state_changed = PTHREAD_COND_INITIALIZER;
+static int callback_count = 0;
+static int connected = 0;
+static wifiStatusCode_t last_status = WIFI_HAL_SUCCESS;
+
+static INT wps_connect_callback(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error)
+{
+    wifiStatusCode_t status = (error != NULL) ? *error : WIFI_HAL_ERROR_UNKNOWN;
+
+    if (status == WIFI_HAL_CONNECTING)
+    {
+        return RETURN_OK;
+    }
+    pthread_mutex_lock(&state_lock);
+    callback_count++;
+    last_status = status;
+    if (status == WIFI_HAL_CONNECTED)
+    {
+        connected = 1;
+    }
+    pthread_cond_broadcast(&state_changed);
+    pthread_mutex_unlock(&state_lock);
+    return RETURN_OK;
+}
+
+static void reset_callback_state(void)
+{
+    pthread_mutex_lock(&state_lock);
+    callback_count = 0;
+    connected = 0;
+    last_status = WIFI_HAL_SUCCESS;
+    pthread_mutex_unlock(&state_lock);
+}
+
+/* Waits for the next final status, returns WIFI_HAL_ERROR_TIMEOUT_EXPIRED if none arrives */
+static wifiStatusCode_t wait_for_status(UINT timeout_ms)
+{
+    struct timespec deadline = wifi_perf_deadline_ms(timeout_ms);
+    wifiStatusCode_t status = WIFI_HAL_ERROR_TIMEOUT_EXPIRED;
+
+    pthread_mutex_lock(&state_lock);
+    while (callback_count == 0)
+    {
+        if (pthread_cond_timedwait(&state_changed, &state_lock, &deadline) != 0)
+        {
+            break;
+        }
+    }
+    if (callback_count != 0)
+    {
+        status = last_status;
+    }
+    pthread_mutex_unlock(&state_lock);
+    return status;
+}
+
+/* Starts a session and times it up to the final connect callback */
+static wifiStatusCode_t wps_time_to_credential(const wps_ops_t *ops, wps_method_t method, const char *pin, uint64_t *elapsed_ns)
+{
+    CHAR pin_buf[16];
+    uint64_t start;
+    INT ret;
+    wifiStatusCode_t status;
+
+    snprintf(pin_buf, sizeof(pin_buf), "%s", (pin != NULL) ? pin : "");
+    reset_callback_state();
+    start = wifi_perf_now_ns();
+    ret = (method == WPS_PBC) ? ops->push_button(SSID_INDEX) : ops->enrollee_pin(SSID_INDEX, pin_buf);
+    if (ret != RETURN_OK)
+    {
+        return WIFI_HAL_UNRECOVERABLE_ERROR;
+    }
+    status = wait_for_status(ops->callback_timeout_ms);
+    *elapsed_ns = wifi_perf_now_ns() - start;
+    return status;
+}
+
+/* Runs one push button session for session_ms, cancels it and polls the radio every millisecond until it scans again */
+static void wps_cancel_once(const wps_ops_t *ops, UINT session_ms, wps_cancel_result_t *result)
+{
+    uint64_t start;
+    uint64_t returned;
+    uint64_t limit;
+    int freed = 0;
+
+    reset_callback_state();
+    if (ops->push_button(SSID_INDEX) != RETURN_OK)
+    {
+        result->failures++;
+        return;
+    }
+    wifi_perf_sleep_ms(session_ms);
+
+    if (ops->set_freq_list(RADIO_INDEX, HAL_SCAN_FREQ_LIST) == RETURN_OK)
+    {
+        /* The radio was not held by the session, nothing to free */
+        result->scan_accepted++;
+        ops->wait_scan();
+    }
+
+    start = wifi_perf_now_ns();
+    if (ops->cancel() != RETURN_OK)
+    {
+        result->failures++;
+        return;
+    }
+    returned = wifi_perf_now_ns();
+    wifi_perf_samples_add(&result->cancel_call, returned - start);
+
+    limit = start + (uint64_t)RADIO_POLL_LIMIT_MS * WIFI_PERF_NS_PER_MS;
+    while (wifi_perf_now_ns() < limit)
+    {
+        if (ops->set_freq_list(RADIO_INDEX, HAL_SCAN_FREQ_LIST) == RETURN_OK)
+        {
+            wifi_perf_samples_add(&result->radio_free, wifi_perf_now_ns() - start);
+            freed = 1;
+            break;
+        }
+        wifi_perf_sleep_ms(1);
+    }
+    if (!freed)
+    {
+        result->failures++;
+        return;
+    }
+    ops->wait_scan();
+
+    /* A cancelled session must not complete behind the caller's back */
+    wifi_perf_sleep_ms(LATE_CALLBACK_WAIT_MS);
+    pthread_mutex_lock(&state_lock);
+    result->late_connects += connected;
+    pthread_mutex_unlock(&state_lock);
+}
+
+static void wps_cancel_run(const wps_ops_t *ops, UINT session_ms, int iterations, wps_cancel_result_t *result)
+{
+    memset(result, 0, sizeof(*result));
+    wifi_perf_samples_init(&result->cancel_call, iterations);
+    wifi_perf_samples_init(&result->radio_free, iterations);
+
+    ops->register_connect(wps_connect_callback);
+    for (int i = 0; i < iterations; i++)
+    {
+        wps_cancel_once(ops, session_ms, result);
+    }
+}
+
+static void wps_cancel_report(wps_cancel_result_t *result, wifi_perf_summary_t *cancel_call, wifi_perf_summary_t *radio_free)
+{
+    char line[256];
+
+    wifi_perf_summarize(&result->cancel_call, cancel_call);
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "wifi_cancelWpsPairing call", cancel_call));
+    wifi_perf_summarize(&result->radio_free, radio_free);
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), "cancel to radio free", radio_free));
+    UT_LOG("failures=%d scans accepted during session=%d connected after cancel=%d\n",
+           result->failures, result->scan_accepted, result->late_connects);
+}
+
+static void wps_cancel_result_free(wps_cancel_result_t *result)
+{
+    wifi_perf_samples_free(&result->cancel_call);
+    wifi_perf_samples_free(&result->radio_free);
+}
+
+static const wps_ops_t sim_ops = {
+    .push_button = wifi_sim_setCliWpsButtonPush,
+    .enrollee_pin = wifi_sim_setCliWpsEnrolleePin,
+    .cancel = wifi_sim_cancelWpsPairing,
+    .set_freq_list = wifi_sim_setRadioScanningFreqList,
+    .wait_scan = wifi_sim_waitForScanResults,
+    .register_connect = wifi_sim_connectEndpoint_callback_register,
+    .callback_timeout_ms = SIM_CALLBACK_TIMEOUT_MS,
+};
+
+/* Fresh simulator with a fast registrar */
+static void sim_setup(BOOL registrar_present)
+{
+    wifi_sim_timing_t timing;
+    wifi_sim_registrar_t registrar;
+
+    wifi_sim_reset();
+    wifi_sim_get_timing(&timing);
+    timing.handshake_ms = SIM_HANDSHAKE_MS;
+    timing.scan_dwell_ms = 10;
+    wifi_sim_set_timing(&timing);
+
+    wifi_sim_get_registrar(&registrar);
+    registrar.present = registrar_present;
+    registrar.pbc_response_ms = SIM_PBC_RESPONSE_MS;
+    registrar.pin_response_ms = SIM_PIN_RESPONSE_MS;
+    registrar.cancel_ms = SIM_CANCEL_MS;
+    snprintf(registrar.pin, sizeof(registrar.pin), "%s", SIM_REGISTRAR_PIN);
+    wifi_sim_set_registrar(&registrar);
+
+    wifi_sim_init(NULL);
+    wifi_sim_connectEndpoint_callback_register(wps_connect_callback);
+}
+
+/* Runs SIM_ITERATIONS sessions of one method and checks the p50 against the modelled delay */
+static void sim_credential_run(wps_method_t method, UINT response_ms)
+{
+    wifi_perf_samples_t samples;
+    wifi_perf_summary_t summary;
+    char label[64];
+    char line[256];
+    int failures = 0;
+    double expected_ns = (double)(response_ms + SIM_HANDSHAKE_MS) * WIFI_PERF_NS_PER_MS;
+
+    wifi_perf_samples_init(&samples, SIM_ITERATIONS);
+    for (int i = 0; i < SIM_ITERATIONS; i++)
+    {
+        uint64_t elapsed_ns = 0;
+
+        if (wps_time_to_credential(&sim_ops, method, SIM_REGISTRAR_PIN, &elapsed_ns) == WIFI_HAL_CONNECTED)
+        {
+            wifi_perf_samples_add(&samples, elapsed_ns);
+        }
+        else
+        {
+            failures++;
+        }
+    }
+
+    wifi_perf_summarize(&samples, &summary);
+    snprintf(label, sizeof(label), "%s to credential", method_names[method]);
+    UT_LOG("%s\n", wifi_perf_format_summary(line, sizeof(line), label, &summary));
+
+    UT_ASSERT_EQUAL(failures, 0);
+    UT_ASSERT_EQUAL(summary.p50 >= expected_ns, 1);
+    UT_ASSERT_EQUAL(summary.p50 < expected_ns + (double)SIM_SLACK_MS * WIFI_PERF_NS_PER_MS, 1);
+    wifi_perf_samples_free(&samples);
+}
+
+/**
+* @brief Verify the time-to-credential measurement for push button against the simulated registrar
+*
+* The registrar answers a push button after 150 ms and the station associates in 50 ms. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Push the button and wait for the connect callback three times | ssidIndex = 1 | WIFI_HAL_CONNECTED every time | Should be successful |
+* | 02 | Compare the p50 with the modelled delay | 200 ms | Not faster, at most 200 ms slower | Should be successful |
+*/
+void test_l2_wifi_wps_latency_push_button_sim (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+
+    sim_setup(TRUE);
+    sim_credential_run(WPS_PBC, SIM_PBC_RESPONSE_MS);
+    wifi_sim_reset();
+
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify the time-to-credential measurement for PIN against the simulated registrar
+*
+* The registrar answers a PIN after 250 ms. A wrong PIN must be rejected with a failure status
+* in the same time rather than left to run out the walk time. @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Enter the registrar PIN and wait for the connect callback three times | EnrolleePin = "12345670" | WIFI_HAL_CONNECTED every time | Should be successful |
+* | 02 | Compare the p50 with the modelled delay | 300 ms | Not faster, at most 200 ms slower | Should be successful |
+* | 03 | Enter a wrong PIN | EnrolleePin = "00000000" | WIFI_HAL_ERROR_INVALID_CREDENTIALS within the registrar response time plus slack | Should be successful |
+*/
+void test_l2_wifi_wps_latency_pin_sim (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    uint64_t elapsed_ns = 0;
+    wifiStatusCode_t status;
+
+    sim_setup(TRUE);
+    sim_credential_run(WPS_PIN, SIM_PIN_RESPONSE_MS);
+
+    status = wps_time_to_credential(&sim_ops, WPS_PIN, SIM_WRONG_PIN, &elapsed_ns);
+    UT_LOG("Wrong PIN: status %d after %.1f ms\n", status, (double)elapsed_ns / WIFI_PERF_NS_PER_MS);
+    UT_ASSERT_EQUAL(status, WIFI_HAL_ERROR_INVALID_CREDENTIALS);
+    UT_ASSERT_EQUAL(elapsed_ns < (uint64_t)(SIM_PIN_RESPONSE_MS + SIM_SLACK_MS) * WIFI_PERF_NS_PER_MS, 1);
+    wifi_sim_reset();
+
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Verify the cancel measurement against the simulator
+*
+* No registrar answers, so every session stays in flight until it is cancelled. The simulator
+* frees the radio 20 ms after wifi_cancelWpsPairing(). @n
+*
+* **Test Group ID:** Module: 02 @n
+* **Test Case ID:** 003 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Push the button, try a scan after 100 ms, cancel, poll the scan every 1 ms, three times | freqList = "2412 2437 2462" | Scan rejected during the session | Should be successful |
+* | 02 | Check the cancel call | None | Returns RETURN_OK within 50 ms | Should be successful |
+* | 03 | Check the time until the radio is free | None | Between 20 ms and 220 ms | Should be successful |
+* | 04 | Check for a late connection | None | No WIFI_HAL_CONNECTED after the cancel | Should be successful |
+*/
+void test_l2_wifi_wps_latency_cancel_sim (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    wps_cancel_result_t result;
+    wifi_perf_summary_t cancel_call;
+    wifi_perf_summary_t radio_free;
+
+    sim_setup(FALSE);
+    wps_cancel_run(&sim_ops, HAL_SESSION_MS, SIM_ITERATIONS, &result);
+    wps_cancel_report(&result, &cancel_call, &radio_free);
+    wifi_sim_reset();
+
+    UT_ASSERT_EQUAL(result.failures, 0);
+    UT_ASSERT_EQUAL(result.scan_accepted, 0);
+    UT_ASSERT_EQUAL(result.late_connects, 0);
+    UT_ASSERT_EQUAL(radio_free.count, SIM_ITERATIONS);
+    UT_ASSERT_EQUAL(cancel_call.max < (double)CANCEL_CALL_BUDGET_MS * WIFI_PERF_NS_PER_MS, 1);
+    UT_ASSERT_EQUAL(radio_free.min >= (double)SIM_CANCEL_MS * WIFI_PERF_NS_PER_MS, 1);
+    UT_ASSERT_EQUAL(radio_free.max < (double)(SIM_CANCEL_MS + SIM_SLACK_MS) * WIFI_PERF_NS_PER_MS, 1);
+
+    wps_cancel_result_free(&result);
+    WIFI_TRACE_TEST_END();
+}
+
+/**
+* @brief Measure how quickly wifi_cancelWpsPairing() aborts a session on the HAL under test
+*
+* Starts a push button session without pressing the button on any access point, cancels it after
+* 100 ms and measures the cancel call and the time until wifi_setRadioScanningFreqList() is accepted
+* again. @n
+*
+* **Test Group ID:** Stress: 03 @n
+* **Test Case ID:** 004 @n
+* **Priority:** High @n
+* @n
+* **Pre-Conditions:** wifi_init() called by the suite, no access point in WPS mode @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Push the button, cancel after 100 ms, poll the scan every 1 ms, three times | ssidIndex = 1, freqList = "2412 2437 2462" | Every cancel returns RETURN_OK | Should Pass |
+* | 02 | Check the cancel call | None | Returns within 50 ms | Should Pass |
+* | 03 | Check the time until the radio is free | None | Within 2 s | Should Pass |
+* | 04 | Check for a late connection | None | No WIFI_HAL_CONNECTED after the cancel | Should Pass |
+*/
+void test_l2_wifi_wps_latency_cancel_hal (void)
+{
+    WIFI_TRACE_TEST_BEGIN();
+    const wps_ops_t hal_ops = {
+        .push_button = wifi_setCliWpsButtonPush,
+        .enrollee_pin = wifi_setCliWpsEnrolleePin,
+        .cancel = wifi_cancelWpsPairing,
+        .set_freq_list = wifi_setRadioScanningFreqList,
+        .wait_scan = wifi_waitForScanResults,
+        .register_connect = wifi_connectEndpoint_callback_register,
+        .callback_timeout_ms = HAL_RADIO_FREE_BUDGET_MS,
+    };
+    wps_cancel_result_t result;
+    wifi_perf_summary_t cancel_call;
+    wifi_perf_summary_t radio_free;
+
+    wps_cancel_run(&hal_ops, HAL_SESSION_MS, HAL_CANCEL_ITERATIONS, &result);
+    wps_cancel_report(&result, &cancel_call, &radio_free);
+
+    UT_ASSERT_EQUAL(result.failures, 0);
+    UT_ASSERT_EQUAL(result.late_connects, 0);
+    UT_ASSERT_EQUAL(cancel_call.max < (double)CANCEL_CALL_BUDGET_MS * WIFI_PERF_NS_PER_MS, 1);
+    UT_ASSERT_EQUAL(radio_free.max < (double)HAL_RADIO_FREE_BUDGET_MS * WIFI_PERF_NS_PER_MS, 1);
+
+    wps_cancel_result_free(&result);
+    WIFI_TRACE_TEST_END();
+}
+
+static UT_test_suite_t * pSuite_wps_latency = NULL;
+static UT_test_suite_t * pSuite_wps_latency_with_wifi_init = NULL;
+
+/**
+ * @brief Register the WPS latency tests
+ *
+ * @return int - 0 on success, otherwise failure
+ */
+int test_wifi_wps_latency_register_l2_tests (void)
+{
+    pSuite_wps_latency = UT_add_suite("[L2 wifi_wps_latency tests]", NULL, NULL);
+    if (pSuite_wps_latency == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_wps_latency, "l2_wifi_wps_latency_push_button_sim", test_l2_wifi_wps_latency_push_button_sim);
+    UT_add_test(pSuite_wps_latency, "l2_wifi_wps_latency_pin_sim", test_l2_wifi_wps_latency_pin_sim);
+    UT_add_test(pSuite_wps_latency, "l2_wifi_wps_latency_cancel_sim", test_l2_wifi_wps_latency_cancel_sim);
+
+    pSuite_wps_latency_with_wifi_init = UT_add_suite("[L2 wifi_wps_latency post-init tests]", WiFi_InitPreReq, WiFi_UnInitPosReq);
+    if (pSuite_wps_latency_with_wifi_init == NULL) {
+        return -1;
+    }
+
+    UT_add_test(pSuite_wps_latency_with_wifi_init, "l2_wifi_wps_latency_cancel_hal", test_l2_wifi_wps_latency_cancel_hal);
+
+    return 0;
+}
+
+/** @} */ // End of RDKV_WIFI_WPS_LATENCY_HALTEST_L2
+/** @} */ // End of RDKV_WIFI_HALTEST
+/** @} */ // End of RDKV_WIFI
+/** @} */ // End of HPK
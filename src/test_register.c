@@ -87,6 +87,63 @@ int register_hal_l1_tests( void )
     return registerFailed;
 }
 
+/* L2 Testing Functions */
+
+extern int test_wifi_trace_register_l2_tests (void);
+extern int test_wifi_scan_cache_register_l2_tests (void);
+extern int test_wifi_single_flight_register_l2_tests (void);
+extern int test_wifi_radio_snapshot_register_l2_tests (void);
+extern int test_wifi_radio_state_register_l2_tests (void);
+extern int test_wifi_scan_interference_register_l2_tests (void);
+extern int test_wifi_connect_transition_register_l2_tests (void);
+extern int test_wifi_fast_reconnect_register_l2_tests (void);
+extern int test_wifi_wps_latency_register_l2_tests (void);
+extern int test_wifi_startup_register_l2_tests (void);
+extern int test_wifi_alloc_budget_register_l2_tests (void);
+extern int test_wifi_spawn_register_l2_tests (void);
+extern int test_wifi_rusage_register_l2_tests (void);
+extern int test_wifi_stability_register_l2_tests (void);
+extern int test_wifi_reference_register_l2_tests (void);
+extern int test_wifi_scan_parse_register_l2_tests (void);
+extern int test_wifi_netstats_register_l2_tests (void);
+extern int test_wifi_change_watch_register_l2_tests (void);
+extern int test_wifi_stats_store_register_l2_tests (void);
+extern int test_wifi_sim_loop_register_l2_tests (void);
+extern int test_wifi_sim_rf_register_l2_tests (void);
+extern int test_wifi_roaming_register_l2_tests (void);
+extern int test_wifi_sim_traffic_register_l2_tests (void);
+
+int register_hal_l2_tests( void )
+{
+    int registerFailed=0;
+
+    registerFailed |= test_wifi_trace_register_l2_tests();
+    registerFailed |= test_wifi_scan_cache_register_l2_tests();
+    registerFailed |= test_wifi_single_flight_register_l2_tests();
+    registerFailed |= test_wifi_radio_snapshot_register_l2_tests();
+    registerFailed |= test_wifi_radio_state_register_l2_tests();
+    registerFailed |= test_wifi_scan_interference_register_l2_tests();
+    registerFailed |= test_wifi_connect_transition_register_l2_tests();
+    registerFailed |= test_wifi_fast_reconnect_register_l2_tests();
+    registerFailed |= test_wifi_wps_latency_register_l2_tests();
+    registerFailed |= test_wifi_startup_register_l2_tests();
+    registerFailed |= test_wifi_alloc_budget_register_l2_tests();
+    registerFailed |= test_wifi_spawn_register_l2_tests();
+    registerFailed |= test_wifi_rusage_register_l2_tests();
+    registerFailed |= test_wifi_stability_register_l2_tests();
+    registerFailed |= test_wifi_reference_register_l2_tests();
+    registerFailed |= test_wifi_scan_parse_register_l2_tests();
+    registerFailed |= test_wifi_netstats_register_l2_tests();
+    registerFailed |= test_wifi_change_watch_register_l2_tests();
+    registerFailed |= test_wifi_stats_store_register_l2_tests();
+    registerFailed |= test_wifi_sim_loop_register_l2_tests();
+    registerFailed |= test_wifi_sim_rf_register_l2_tests();
+    registerFailed |= test_wifi_roaming_register_l2_tests();
+    registerFailed |= test_wifi_sim_traffic_register_l2_tests();
+
+    return registerFailed;
+}
+
 /** @} */ // End of RDKV_WIFI_HALTEST_REGISTER
 /** @} */ // End of RDKV_WIFI_HALTEST
 /** @} */ // End of RDKV_WIFI
@@ -0,0 +1,66 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file test_wifi_client_config.h
+*
+* Connection profiles read from the test configuration file. Config_new()
+* and Config_delete() are defined in test_L1_wifi_client_hal.c and shared
+* with the L2 connection tests.
+*/
+
+#ifndef __TEST_WIFI_CLIENT_CONFIG_H__
+#define __TEST_WIFI_CLIENT_CONFIG_H__
+
+#include <glib.h>
+
+/**
+ * @brief Credentials of one connection profile, NULL where the profile has no such key
+ */
+typedef struct _wifi_connectEndpoint_test_config
+{
+    char *ap_SSID;
+    char *WEPKey;
+    char *PreSharedKey;
+    char *KeyPassphrase;
+    char *eapIdentity;
+    char *carootcert;
+    char *clientcert;
+    char *privatekey;
+} wifi_connectEndpoint_test_config_t;
+
+extern GKeyFile *key_file;
+
+/**
+ * @brief Reads a connection profile
+ *
+ * @param[in] key_file  Loaded test configuration
+ * @param[in] test_case Group of the profile
+ *
+ * @return wifi_connectEndpoint_test_config_t* - The profile, NULL if the group is missing or on allocation failure
+ */
+wifi_connectEndpoint_test_config_t *Config_new(GKeyFile *key_file, char *test_case);
+
+/**
+ * @brief Frees a profile returned by Config_new()
+ *
+ * @param[in] l1_config Profile, may be NULL
+ */
+void Config_delete(wifi_connectEndpoint_test_config_t *l1_config);
+
+#endif // __TEST_WIFI_CLIENT_CONFIG_H__
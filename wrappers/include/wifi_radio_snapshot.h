@@ -0,0 +1,186 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_WRAPPERS RDK-V WiFi HAL Reference Wrappers
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_RADIO_SNAPSHOT RDK-V WiFi Static Radio Attribute Snapshot
+ * @{
+ */
+
+/**
+* @file wifi_radio_snapshot.h
+*
+* One-time snapshot of radio attributes that do not change after wifi_init().
+*
+* wifi_radio_snapshot_init() reads the supported frequency bands, supported
+* standards, supported transmit powers, interface name and maximum bit rate
+* of every radio once and keeps them in a packed table. The getters below
+* have the same signature as the HAL functions and copy from that table.
+* An attribute that could not be read, or that does not fit in the table,
+* is forwarded to the HAL on every call, as is any radio index outside the
+* snapshot.
+*/
+
+#ifndef __WIFI_RADIO_SNAPSHOT_H__
+#define __WIFI_RADIO_SNAPSHOT_H__
+
+#include <stdint.h>
+#include "wifi_common_hal.h"
+
+/**
+ * @brief Largest number of radios kept in the snapshot
+ */
+#define WIFI_RADIO_SNAPSHOT_MAX_RADIOS 4
+
+/**
+ * @brief Bits of wifi_radio_static_attrs_t::valid
+ */
+#define WIFI_RADIO_ATTR_IF_NAME                  (1 << 0)
+#define WIFI_RADIO_ATTR_SUPPORTED_FREQUENCY_BANDS (1 << 1)
+#define WIFI_RADIO_ATTR_SUPPORTED_STANDARDS      (1 << 2)
+#define WIFI_RADIO_ATTR_MAX_BIT_RATE             (1 << 3)
+#define WIFI_RADIO_ATTR_TRANSMIT_POWER_SUPPORTED (1 << 4)
+#define WIFI_RADIO_ATTR_ALL                      0x1F
+
+/**
+ * @brief Static attributes of one radio
+ */
+typedef struct __attribute__((packed))
+{
+    uint8_t radioIndex;                 /*!< HAL radio index */
+    uint8_t valid;                      /*!< WIFI_RADIO_ATTR_* bits of the fields read successfully */
+    CHAR ifName[32];                    /*!< wifi_getRadioIfName() */
+    CHAR supportedFrequencyBands[32];   /*!< wifi_getRadioSupportedFrequencyBands() */
+    CHAR supportedStandards[64];        /*!< wifi_getRadioSupportedStandards() */
+    CHAR maxBitRate[32];                /*!< wifi_getRadioMaxBitRate() */
+    CHAR transmitPowerSupported[64];    /*!< wifi_getRadioTransmitPowerSupported() */
+} wifi_radio_static_attrs_t;
+
+/**
+ * @brief Underlying getters, NULL selects the HAL function of the same name
+ */
+typedef struct
+{
+    INT (*getRadioNumberOfEntries)(ULONG *output);
+    INT (*getRadioIfName)(INT radioIndex, CHAR *output_string);
+    INT (*getRadioSupportedFrequencyBands)(INT radioIndex, CHAR *output_string);
+    INT (*getRadioSupportedStandards)(INT radioIndex, CHAR *output_string);
+    INT (*getRadioMaxBitRate)(INT radioIndex, CHAR *output_string);
+    INT (*getRadioTransmitPowerSupported)(INT radioIndex, CHAR *output_list);
+} wifi_radio_snapshot_config_t;
+
+/**
+ * @brief Snapshot counters
+ */
+typedef struct
+{
+    uint64_t hits;      /*!< Getter calls served from the snapshot */
+    uint64_t forwarded; /*!< Getter calls forwarded to the HAL */
+} wifi_radio_snapshot_stats_t;
+
+/**
+ * @brief Reads the static attributes of every radio
+ *
+ * Must be called after wifi_init() or wifi_initWithConfig(), before any
+ * other thread uses the snapshot.
+ *
+ * @param[in] config Underlying getters, NULL for the HAL functions
+ *
+ * @return INT - The status of the operation
+ * @retval RETURN_OK  if the snapshot was taken, even if some attributes could not be read
+ * @retval RETURN_ERR if already initialised or the number of radios could not be read
+ */
+INT wifi_radio_snapshot_init(const wifi_radio_snapshot_config_t *config);
+
+/**
+ * @brief Drops the snapshot, call before wifi_uninit()
+ */
+void wifi_radio_snapshot_deinit(void);
+
+/**
+ * @brief Returns the number of radios in the snapshot
+ *
+ * @return ULONG - Number of radios, 0 if not initialised
+ */
+ULONG wifi_radio_snapshot_count(void);
+
+/**
+ * @brief Returns the snapshot of one radio
+ *
+ * @param[in] radioIndex Radio index
+ *
+ * @return const wifi_radio_static_attrs_t* - Snapshot, NULL if the radio is not in the snapshot
+ */
+const wifi_radio_static_attrs_t *wifi_radio_snapshot_get(INT radioIndex);
+
+/**
+ * @brief Snapshot wifi_getRadioIfName()
+ *
+ * @return INT - RETURN_OK if successful, otherwise RETURN_ERR
+ */
+INT wifi_radio_snapshot_getRadioIfName(INT radioIndex, CHAR *output_string);
+
+/**
+ * @brief Snapshot wifi_getRadioSupportedFrequencyBands()
+ *
+ * @return INT - RETURN_OK if successful, otherwise RETURN_ERR
+ */
+INT wifi_radio_snapshot_getRadioSupportedFrequencyBands(INT radioIndex, CHAR *output_string);
+
+/**
+ * @brief Snapshot wifi_getRadioSupportedStandards()
+ *
+ * @return INT - RETURN_OK if successful, otherwise RETURN_ERR
+ */
+INT wifi_radio_snapshot_getRadioSupportedStandards(INT radioIndex, CHAR *output_string);
+
+/**
+ * @brief Snapshot wifi_getRadioMaxBitRate()
+ *
+ * @return INT - RETURN_OK if successful, otherwise RETURN_ERR
+ */
+INT wifi_radio_snapshot_getRadioMaxBitRate(INT radioIndex, CHAR *output_string);
+
+/**
+ * @brief Snapshot wifi_getRadioTransmitPowerSupported()
+ *
+ * @return INT - RETURN_OK if successful, otherwise RETURN_ERR
+ */
+INT wifi_radio_snapshot_getRadioTransmitPowerSupported(INT radioIndex, CHAR *output_list);
+
+/**
+ * @brief Reads the snapshot counters
+ *
+ * @param[out] stats Counters
+ */
+void wifi_radio_snapshot_get_stats(wifi_radio_snapshot_stats_t *stats);
+
+#endif // __WIFI_RADIO_SNAPSHOT_H__
+
+/** @} */ // End of RDKV_WIFI_RADIO_SNAPSHOT
+/** @} */ // End of RDKV_WIFI_WRAPPERS
+/** @} */ // End of RDKV_WIFI
@@ -0,0 +1,162 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_WRAPPERS RDK-V WiFi HAL Reference Wrappers
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_RADIO_STATE RDK-V WiFi Batch Radio State Query
+ * @{
+ */
+
+/**
+* @file wifi_radio_state.h
+*
+* Fills one wifi_radio_state_t with every per-radio getter in a single pass.
+*
+* The HAL API has no session or batch call, and no way to share one driver
+* exchange between getters, so the fields are gathered with the individual
+* getters back to back. What the helper saves a caller is the bookkeeping of
+* about twenty calls per radio, not driver round trips.
+*/
+
+#ifndef __WIFI_RADIO_STATE_H__
+#define __WIFI_RADIO_STATE_H__
+
+#include <stdint.h>
+#include "wifi_common_hal.h"
+
+/**
+ * @brief Fields of wifi_radio_state_t, one bit each in wifi_radio_state_t::valid
+ */
+typedef enum
+{
+    WIFI_RADIO_STATE_ENABLE = 0,                   /*!< wifi_getRadioEnable() */
+    WIFI_RADIO_STATE_STATUS,                       /*!< wifi_getRadioStatus() */
+    WIFI_RADIO_STATE_OPERATING_FREQUENCY_BAND,     /*!< wifi_getRadioOperatingFrequencyBand() */
+    WIFI_RADIO_STATE_STANDARD,                     /*!< wifi_getRadioStandard() */
+    WIFI_RADIO_STATE_POSSIBLE_CHANNELS,            /*!< wifi_getRadioPossibleChannels() */
+    WIFI_RADIO_STATE_CHANNELS_IN_USE,              /*!< wifi_getRadioChannelsInUse() */
+    WIFI_RADIO_STATE_CHANNEL,                      /*!< wifi_getRadioChannel() */
+    WIFI_RADIO_STATE_AUTO_CHANNEL_SUPPORTED,       /*!< wifi_getRadioAutoChannelSupported() */
+    WIFI_RADIO_STATE_AUTO_CHANNEL_ENABLE,          /*!< wifi_getRadioAutoChannelEnable() */
+    WIFI_RADIO_STATE_AUTO_CHANNEL_REFRESH_PERIOD,  /*!< wifi_getRadioAutoChannelRefreshPeriod() */
+    WIFI_RADIO_STATE_GUARD_INTERVAL,               /*!< wifi_getRadioGuardInterval() */
+    WIFI_RADIO_STATE_OPERATING_CHANNEL_BANDWIDTH,  /*!< wifi_getRadioOperatingChannelBandwidth() */
+    WIFI_RADIO_STATE_EXT_CHANNEL,                  /*!< wifi_getRadioExtChannel() */
+    WIFI_RADIO_STATE_MCS,                          /*!< wifi_getRadioMCS() */
+    WIFI_RADIO_STATE_TRANSMIT_POWER,               /*!< wifi_getRadioTransmitPower() */
+    WIFI_RADIO_STATE_IEEE80211H_SUPPORTED,         /*!< wifi_getRadioIEEE80211hSupported() */
+    WIFI_RADIO_STATE_IEEE80211H_ENABLED,           /*!< wifi_getRadioIEEE80211hEnabled() */
+    WIFI_RADIO_STATE_REGULATORY_DOMAIN,            /*!< wifi_getRegulatoryDomain() */
+    WIFI_RADIO_STATE_TRAFFIC_STATS,                /*!< wifi_getRadioTrafficStats() */
+    WIFI_RADIO_STATE_FIELD_MAX
+} wifi_radio_state_field_t;
+
+/**
+ * @brief Bit of a field in wifi_radio_state_t::valid
+ */
+#define WIFI_RADIO_STATE_BIT(field) (1u << (field))
+
+/**
+ * @brief Every field of wifi_radio_state_t
+ */
+#define WIFI_RADIO_STATE_ALL (WIFI_RADIO_STATE_BIT(WIFI_RADIO_STATE_FIELD_MAX) - 1u)
+
+/**
+ * @brief Largest number of radios returned by wifi_radio_state_get_all()
+ */
+#define WIFI_RADIO_STATE_MAX_RADIOS 4
+
+/**
+ * @brief Current state of one radio
+ */
+typedef struct
+{
+    INT radioIndex;                        /*!< HAL radio index */
+    uint32_t valid;                        /*!< WIFI_RADIO_STATE_BIT() of every field read successfully */
+    BOOL enable;
+    CHAR status[32];
+    CHAR operatingFrequencyBand[32];
+    CHAR standard[32];
+    BOOL gOnly;
+    BOOL nOnly;
+    BOOL acOnly;
+    CHAR possibleChannels[128];
+    CHAR channelsInUse[128];
+    ULONG channel;
+    BOOL autoChannelSupported;
+    BOOL autoChannelEnable;
+    ULONG autoChannelRefreshPeriod;
+    CHAR guardInterval[32];
+    CHAR operatingChannelBandwidth[32];
+    CHAR extChannel[32];
+    INT mcs;
+    INT transmitPower;
+    BOOL ieee80211hSupported;
+    BOOL ieee80211hEnabled;
+    CHAR regulatoryDomain[32];
+    wifi_radioTrafficStats_t trafficStats;
+} wifi_radio_state_t;
+
+/**
+ * @brief Reads every field of one radio
+ *
+ * @param[in]  radioIndex Radio index
+ * @param[out] state      State, fields that could not be read have their valid bit clear
+ *
+ * @return INT - The status of the operation
+ * @retval RETURN_OK  if at least one field was read
+ * @retval RETURN_ERR if state is NULL or no field could be read
+ */
+INT wifi_radio_state_get(INT radioIndex, wifi_radio_state_t *state);
+
+/**
+ * @brief Reads every field of every radio reported by wifi_getRadioNumberOfEntries()
+ *
+ * @param[out] states       Array of at least max_radios entries
+ * @param[in]  max_radios   Size of states
+ * @param[out] output_count Number of radios filled
+ *
+ * @return INT - The status of the operation
+ * @retval RETURN_OK  if every radio returned at least one field
+ * @retval RETURN_ERR if a parameter is invalid, the radio count could not be read or a radio returned nothing
+ */
+INT wifi_radio_state_get_all(wifi_radio_state_t *states, ULONG max_radios, ULONG *output_count);
+
+/**
+ * @brief Returns the number of fields set in a valid mask
+ *
+ * @param[in] valid wifi_radio_state_t::valid
+ *
+ * @return UINT - Number of fields
+ */
+UINT wifi_radio_state_field_count(uint32_t valid);
+
+#endif // __WIFI_RADIO_STATE_H__
+
+/** @} */ // End of RDKV_WIFI_RADIO_STATE
+/** @} */ // End of RDKV_WIFI_WRAPPERS
+/** @} */ // End of RDKV_WIFI
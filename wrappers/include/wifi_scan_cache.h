@@ -0,0 +1,192 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_WRAPPERS RDK-V WiFi HAL Reference Wrappers
+ * @{
+ * @parblock
+ *
+ * ### Reference wrappers for RDK-V WiFi HAL :
+ *
+ * Libraries layered on top of the HAL API that middleware can use to avoid
+ * redundant driver round-trips. They only use the public HAL interface and
+ * work with any vendor implementation.
+ *
+ * @endparblock
+ */
+
+/**
+ * @defgroup RDKV_WIFI_SCAN_CACHE RDK-V WiFi Scan Result Cache
+ * @{
+ */
+
+/**
+* @file wifi_scan_cache.h
+*
+* Shared cache in front of wifi_getNeighboringWiFiDiagnosticResult() and
+* wifi_getSpecificSSIDInfo().
+*
+* Results younger than the configured maximum age are served from memory.
+* The cache keeps at most max_entries results: stale ones are released
+* first, then the least recently used.
+* When a result is missing or stale, the first caller runs the scan and any
+* caller asking for the same result meanwhile waits for that scan instead of
+* starting another one. Callers always receive their own copy of the array
+* and must free() it, exactly as with the HAL functions.
+*/
+
+#ifndef __WIFI_SCAN_CACHE_H__
+#define __WIFI_SCAN_CACHE_H__
+
+#include <stdint.h>
+#include "wifi_common_hal.h"
+
+/**
+ * @brief Underlying neighbor scan, same signature as wifi_getNeighboringWiFiDiagnosticResult()
+ */
+typedef INT (*wifi_scan_cache_neighbor_fn)(INT radioIndex, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size);
+
+/**
+ * @brief Underlying SSID scan, same signature as wifi_getSpecificSSIDInfo()
+ */
+typedef INT (*wifi_scan_cache_ssid_fn)(const char *SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t **ap_array, UINT *output_array_size);
+
+/**
+ * @brief Cache configuration
+ */
+typedef struct
+{
+    UINT max_age_ms;                         /*!< Results older than this are rescanned. 0 disables caching but keeps coalescing */
+    wifi_scan_cache_neighbor_fn neighbor_fn; /*!< NULL selects wifi_getNeighboringWiFiDiagnosticResult() */
+    wifi_scan_cache_ssid_fn ssid_fn;         /*!< NULL selects wifi_getSpecificSSIDInfo() */
+    UINT max_entries;                        /*!< Results kept, per radio or per SSID and band. 0 selects WIFI_SCAN_CACHE_DEFAULT_MAX_ENTRIES */
+} wifi_scan_cache_config_t;
+
+/**
+ * @brief Cache counters
+ */
+typedef struct
+{
+    uint64_t requests;      /*!< Calls into the cache */
+    uint64_t hits;          /*!< Served from a fresh cached result */
+    uint64_t coalesced;     /*!< Joined a scan already in flight */
+    uint64_t scans;         /*!< Scans issued to the HAL */
+    uint64_t errors;        /*!< Scans that returned an error */
+    uint64_t scan_ns;       /*!< Total time spent in HAL scans */
+    uint64_t saved_ns;      /*!< Estimated caller latency saved by hits and coalescing */
+    uint64_t evicted;       /*!< Results released because they were stale or the cache was full */
+} wifi_scan_cache_stats_t;
+
+/**
+ * @brief Default maximum age of a cached result
+ */
+#define WIFI_SCAN_CACHE_DEFAULT_MAX_AGE_MS 10000
+
+/**
+ * @brief Default number of results kept
+ */
+#define WIFI_SCAN_CACHE_DEFAULT_MAX_ENTRIES 32
+
+/**
+ * @brief Initialises the shared cache
+ *
+ * @param[in] config Configuration, NULL for the defaults
+ *
+ * @return INT - The status of the operation
+ * @retval RETURN_OK  if successful
+ * @retval RETURN_ERR if the cache is already initialised
+ */
+INT wifi_scan_cache_init(const wifi_scan_cache_config_t *config);
+
+/**
+ * @brief Releases every cached result
+ *
+ * Must not be called while another thread is inside the cache.
+ */
+void wifi_scan_cache_deinit(void);
+
+/**
+ * @brief Changes the maximum age of cached results
+ *
+ * @param[in] max_age_ms New maximum age in milliseconds
+ */
+void wifi_scan_cache_set_max_age(UINT max_age_ms);
+
+/**
+ * @brief Drops every cached result so the next call rescans
+ */
+void wifi_scan_cache_invalidate(void);
+
+/**
+ * @brief Cached wifi_getNeighboringWiFiDiagnosticResult()
+ *
+ * @param[in]  radioIndex        Radio index
+ * @param[out] neighbor_ap_array Copy of the result, to be freed by the caller
+ * @param[out] output_array_size Number of entries
+ *
+ * @return INT - The status of the operation
+ * @retval RETURN_OK  if successful
+ * @retval RETURN_ERR if the cache is not initialised, a parameter is NULL or the scan failed
+ */
+INT wifi_scan_cache_getNeighboringWiFiDiagnosticResult(INT radioIndex, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size);
+
+/**
+ * @brief Cached wifi_getSpecificSSIDInfo()
+ *
+ * @param[in]  SSID              SSID to look for
+ * @param[in]  band              Frequency band
+ * @param[out] ap_array          Copy of the result, to be freed by the caller
+ * @param[out] output_array_size Number of entries
+ *
+ * @return INT - The status of the operation
+ * @retval RETURN_OK  if successful
+ * @retval RETURN_ERR if the cache is not initialised, a parameter is NULL or the scan failed
+ */
+INT wifi_scan_cache_getSpecificSSIDInfo(const char *SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t **ap_array, UINT *output_array_size);
+
+/**
+ * @brief Reads the cache counters
+ *
+ * @param[out] stats Counters
+ */
+void wifi_scan_cache_get_stats(wifi_scan_cache_stats_t *stats);
+
+/**
+ * @brief Resets the cache counters
+ */
+void wifi_scan_cache_reset_stats(void);
+
+/**
+ * @brief Returns the fraction of requests served without a new scan
+ *
+ * @param[in] stats Counters
+ *
+ * @return double - (hits + coalesced) / requests, 0 if there were no requests
+ */
+double wifi_scan_cache_hit_rate(const wifi_scan_cache_stats_t *stats);
+
+#endif // __WIFI_SCAN_CACHE_H__
+
+/** @} */ // End of RDKV_WIFI_SCAN_CACHE
+/** @} */ // End of RDKV_WIFI_WRAPPERS
+/** @} */ // End of RDKV_WIFI
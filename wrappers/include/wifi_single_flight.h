@@ -0,0 +1,159 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI RDK-V WiFi
+ * @{
+ */
+
+/**
+ * @addtogroup RDKV_WIFI_WRAPPERS RDK-V WiFi HAL Reference Wrappers
+ * @{
+ */
+
+/**
+ * @defgroup RDKV_WIFI_SINGLE_FLIGHT RDK-V WiFi Single-Flight Getters
+ * @{
+ */
+
+/**
+* @file wifi_single_flight.h
+*
+* Collapses concurrent identical getter calls into one HAL call.
+*
+* The first caller for a given getter and radio index calls the HAL; every
+* caller arriving before that call returns waits and receives the same
+* result and status. Nothing is kept once the call has completed, so a
+* later caller always reaches the HAL again.
+*/
+
+#ifndef __WIFI_SINGLE_FLIGHT_H__
+#define __WIFI_SINGLE_FLIGHT_H__
+
+#include <stdint.h>
+#include "wifi_common_hal.h"
+
+/**
+ * @brief Getters handled by the single-flight wrapper
+ */
+typedef enum
+{
+    WIFI_SINGLE_FLIGHT_RADIO_CHANNEL = 0,      /*!< wifi_getRadioChannel() */
+    WIFI_SINGLE_FLIGHT_REGULATORY_DOMAIN,      /*!< wifi_getRegulatoryDomain() */
+    WIFI_SINGLE_FLIGHT_RADIO_POSSIBLE_CHANNELS,/*!< wifi_getRadioPossibleChannels() */
+    WIFI_SINGLE_FLIGHT_MAX
+} wifi_single_flight_getter_t;
+
+/**
+ * @brief Underlying getters, NULL selects the HAL function of the same name
+ */
+typedef struct
+{
+    INT (*getRadioChannel)(INT radioIndex, ULONG *output_ulong);
+    INT (*getRegulatoryDomain)(INT radioIndex, CHAR *output_string);
+    INT (*getRadioPossibleChannels)(INT radioIndex, CHAR *output_string);
+} wifi_single_flight_config_t;
+
+/**
+ * @brief Per-getter counters
+ */
+typedef struct
+{
+    uint64_t requests;  /*!< Calls into the wrapper */
+    uint64_t hal_calls; /*!< Calls that reached the HAL */
+    uint64_t shared;    /*!< Calls answered by another caller's HAL call */
+    uint64_t errors;    /*!< HAL calls that returned an error */
+} wifi_single_flight_stats_t;
+
+/**
+ * @brief Largest string result the wrapper can fan out, including the terminator
+ */
+#define WIFI_SINGLE_FLIGHT_STRING_LEN 256
+
+/**
+ * @brief Initialises the wrapper
+ *
+ * @param[in] config Underlying getters, NULL for the HAL functions
+ *
+ * @return INT - The status of the operation
+ * @retval RETURN_OK  if successful
+ * @retval RETURN_ERR if the wrapper is already initialised
+ */
+INT wifi_single_flight_init(const wifi_single_flight_config_t *config);
+
+/**
+ * @brief Releases the wrapper
+ *
+ * Must not be called while another thread is inside the wrapper.
+ */
+void wifi_single_flight_deinit(void);
+
+/**
+ * @brief Single-flight wifi_getRadioChannel()
+ *
+ * @param[in]  radioIndex   Radio index
+ * @param[out] output_ulong Current channel
+ *
+ * @return INT - The status of the underlying HAL call
+ * @retval RETURN_OK  if successful
+ * @retval RETURN_ERR if the wrapper is not initialised, output_ulong is NULL or the HAL call failed
+ */
+INT wifi_single_flight_getRadioChannel(INT radioIndex, ULONG *output_ulong);
+
+/**
+ * @brief Single-flight wifi_getRegulatoryDomain()
+ *
+ * @param[in]  radioIndex    Radio index
+ * @param[out] output_string Regulatory domain, sized as required by wifi_getRegulatoryDomain()
+ *
+ * @return INT - The status of the underlying HAL call
+ * @retval RETURN_OK  if successful
+ * @retval RETURN_ERR if the wrapper is not initialised, output_string is NULL or the HAL call failed
+ */
+INT wifi_single_flight_getRegulatoryDomain(INT radioIndex, CHAR *output_string);
+
+/**
+ * @brief Single-flight wifi_getRadioPossibleChannels()
+ *
+ * @param[in]  radioIndex    Radio index
+ * @param[out] output_string Possible channels, sized as required by wifi_getRadioPossibleChannels()
+ *
+ * @return INT - The status of the underlying HAL call
+ * @retval RETURN_OK  if successful
+ * @retval RETURN_ERR if the wrapper is not initialised, output_string is NULL or the HAL call failed
+ */
+INT wifi_single_flight_getRadioPossibleChannels(INT radioIndex, CHAR *output_string);
+
+/**
+ * @brief Reads the counters of one getter
+ *
+ * @param[in]  getter Getter
+ * @param[out] stats  Counters
+ */
+void wifi_single_flight_get_stats(wifi_single_flight_getter_t getter, wifi_single_flight_stats_t *stats);
+
+/**
+ * @brief Resets the counters of every getter
+ */
+void wifi_single_flight_reset_stats(void);
+
+#endif // __WIFI_SINGLE_FLIGHT_H__
+
+/** @} */ // End of RDKV_WIFI_SINGLE_FLIGHT
+/** @} */ // End of RDKV_WIFI_WRAPPERS
+/** @} */ // End of RDKV_WIFI
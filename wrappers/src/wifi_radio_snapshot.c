@@ -0,0 +1,221 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_RADIO_SNAPSHOT RDK-V WiFi Static Radio Attribute Snapshot
+ * @{
+ */
+
+/**
+* @file wifi_radio_snapshot.c
+*
+*/
+
+#include <stddef.h>
+#include <string.h>
+#include "wifi_radio_snapshot.h"
+
+/* The HAL does not take a buffer size, so give it room well beyond any table field */
+#define SNAPSHOT_SCRATCH_LEN 256
+
+typedef INT (*string_getter_fn)(INT radioIndex, CHAR *output_string);
+
+typedef enum
+{
+    ATTR_IF_NAME = 0,
+    ATTR_SUPPORTED_FREQUENCY_BANDS,
+    ATTR_SUPPORTED_STANDARDS,
+    ATTR_MAX_BIT_RATE,
+    ATTR_TRANSMIT_POWER_SUPPORTED,
+    ATTR_MAX
+} snapshot_attr_t;
+
+typedef struct
+{
+    uint8_t bit;
+    size_t offset;
+    size_t size;
+} attr_layout_t;
+
+#define ATTR_LAYOUT(bit, field) { bit, offsetof(wifi_radio_static_attrs_t, field), sizeof(((wifi_radio_static_attrs_t *)0)->field) }
+
+static const attr_layout_t attr_layout[ATTR_MAX] = {
+    ATTR_LAYOUT(WIFI_RADIO_ATTR_IF_NAME, ifName),
+    ATTR_LAYOUT(WIFI_RADIO_ATTR_SUPPORTED_FREQUENCY_BANDS, supportedFrequencyBands),
+    ATTR_LAYOUT(WIFI_RADIO_ATTR_SUPPORTED_STANDARDS, supportedStandards),
+    ATTR_LAYOUT(WIFI_RADIO_ATTR_MAX_BIT_RATE, maxBitRate),
+    ATTR_LAYOUT(WIFI_RADIO_ATTR_TRANSMIT_POWER_SUPPORTED, transmitPowerSupported),
+};
+
+static int snapshot_initialised = 0;
+static ULONG snapshot_radios = 0;
+static wifi_radio_static_attrs_t snapshot_table[WIFI_RADIO_SNAPSHOT_MAX_RADIOS];
+static string_getter_fn snapshot_getters[ATTR_MAX];
+static wifi_radio_snapshot_stats_t snapshot_stats;
+
+/* Radio indices start at 1 */
+static wifi_radio_static_attrs_t *snapshot_radio(INT radioIndex)
+{
+    if (!snapshot_initialised || radioIndex < 1 || (ULONG)radioIndex > snapshot_radios)
+    {
+        return NULL;
+    }
+    return &snapshot_table[radioIndex - 1];
+}
+
+static void snapshot_read(wifi_radio_static_attrs_t *radio)
+{
+    CHAR scratch[SNAPSHOT_SCRATCH_LEN];
+
+    for (int attr = 0; attr < ATTR_MAX; attr++)
+    {
+        memset(scratch, 0, sizeof(scratch));
+        if (snapshot_getters[attr](radio->radioIndex, scratch) != RETURN_OK)
+        {
+            continue;
+        }
+        scratch[sizeof(scratch) - 1] = '\0';
+        /* Never hand out a truncated value, leave it to the HAL instead */
+        if (strlen(scratch) >= attr_layout[attr].size)
+        {
+            continue;
+        }
+        strcpy((CHAR *)radio + attr_layout[attr].offset, scratch);
+        radio->valid |= attr_layout[attr].bit;
+    }
+}
+
+static INT snapshot_lookup(snapshot_attr_t attr, INT radioIndex, CHAR *output_string)
+{
+    const wifi_radio_static_attrs_t *radio;
+
+    if (!snapshot_initialised || output_string == NULL)
+    {
+        return RETURN_ERR;
+    }
+    radio = snapshot_radio(radioIndex);
+    if (radio == NULL || !(radio->valid & attr_layout[attr].bit))
+    {
+        __atomic_add_fetch(&snapshot_stats.forwarded, 1, __ATOMIC_RELAXED);
+        return snapshot_getters[attr](radioIndex, output_string);
+    }
+    __atomic_add_fetch(&snapshot_stats.hits, 1, __ATOMIC_RELAXED);
+    strcpy(output_string, (const CHAR *)radio + attr_layout[attr].offset);
+    return RETURN_OK;
+}
+
+INT wifi_radio_snapshot_init(const wifi_radio_snapshot_config_t *config)
+{
+    wifi_radio_snapshot_config_t getters;
+    ULONG radios = 0;
+
+    if (snapshot_initialised)
+    {
+        return RETURN_ERR;
+    }
+    memset(&getters, 0, sizeof(getters));
+    if (config != NULL)
+    {
+        getters = *config;
+    }
+    if (getters.getRadioNumberOfEntries == NULL)
+    {
+        getters.getRadioNumberOfEntries = wifi_getRadioNumberOfEntries;
+    }
+    snapshot_getters[ATTR_IF_NAME] = (getters.getRadioIfName != NULL) ? getters.getRadioIfName : wifi_getRadioIfName;
+    snapshot_getters[ATTR_SUPPORTED_FREQUENCY_BANDS] = (getters.getRadioSupportedFrequencyBands != NULL) ?
+                                                       getters.getRadioSupportedFrequencyBands : wifi_getRadioSupportedFrequencyBands;
+    snapshot_getters[ATTR_SUPPORTED_STANDARDS] = (getters.getRadioSupportedStandards != NULL) ?
+                                                 getters.getRadioSupportedStandards : wifi_getRadioSupportedStandards;
+    snapshot_getters[ATTR_MAX_BIT_RATE] = (getters.getRadioMaxBitRate != NULL) ? getters.getRadioMaxBitRate : wifi_getRadioMaxBitRate;
+    snapshot_getters[ATTR_TRANSMIT_POWER_SUPPORTED] = (getters.getRadioTransmitPowerSupported != NULL) ?
+                                                      getters.getRadioTransmitPowerSupported : wifi_getRadioTransmitPowerSupported;
+
+    if (getters.getRadioNumberOfEntries(&radios) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    if (radios > WIFI_RADIO_SNAPSHOT_MAX_RADIOS)
+    {
+        radios = WIFI_RADIO_SNAPSHOT_MAX_RADIOS;
+    }
+
+    memset(snapshot_table, 0, sizeof(snapshot_table));
+    memset(&snapshot_stats, 0, sizeof(snapshot_stats));
+    for (ULONG i = 0; i < radios; i++)
+    {
+        snapshot_table[i].radioIndex = (uint8_t)(i + 1);
+        snapshot_read(&snapshot_table[i]);
+    }
+    snapshot_radios = radios;
+    snapshot_initialised = 1;
+    return RETURN_OK;
+}
+
+void wifi_radio_snapshot_deinit(void)
+{
+    snapshot_initialised = 0;
+    snapshot_radios = 0;
+}
+
+ULONG wifi_radio_snapshot_count(void)
+{
+    return snapshot_initialised ? snapshot_radios : 0;
+}
+
+const wifi_radio_static_attrs_t *wifi_radio_snapshot_get(INT radioIndex)
+{
+    return snapshot_radio(radioIndex);
+}
+
+INT wifi_radio_snapshot_getRadioIfName(INT radioIndex, CHAR *output_string)
+{
+    return snapshot_lookup(ATTR_IF_NAME, radioIndex, output_string);
+}
+
+INT wifi_radio_snapshot_getRadioSupportedFrequencyBands(INT radioIndex, CHAR *output_string)
+{
+    return snapshot_lookup(ATTR_SUPPORTED_FREQUENCY_BANDS, radioIndex, output_string);
+}
+
+INT wifi_radio_snapshot_getRadioSupportedStandards(INT radioIndex, CHAR *output_string)
+{
+    return snapshot_lookup(ATTR_SUPPORTED_STANDARDS, radioIndex, output_string);
+}
+
+INT wifi_radio_snapshot_getRadioMaxBitRate(INT radioIndex, CHAR *output_string)
+{
+    return snapshot_lookup(ATTR_MAX_BIT_RATE, radioIndex, output_string);
+}
+
+INT wifi_radio_snapshot_getRadioTransmitPowerSupported(INT radioIndex, CHAR *output_list)
+{
+    return snapshot_lookup(ATTR_TRANSMIT_POWER_SUPPORTED, radioIndex, output_list);
+}
+
+void wifi_radio_snapshot_get_stats(wifi_radio_snapshot_stats_t *stats)
+{
+    if (stats == NULL)
+    {
+        return;
+    }
+    stats->hits = __atomic_load_n(&snapshot_stats.hits, __ATOMIC_RELAXED);
+    stats->forwarded = __atomic_load_n(&snapshot_stats.forwarded, __ATOMIC_RELAXED);
+}
+
+/** @} */ // End of RDKV_WIFI_RADIO_SNAPSHOT
@@ -0,0 +1,181 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_RADIO_STATE RDK-V WiFi Batch Radio State Query
+ * @{
+ */
+
+/**
+* @file wifi_radio_state.c
+*
+*/
+
+#include <string.h>
+#include "wifi_radio_state.h"
+
+/* The HAL does not take a buffer size, so give it room well beyond any state field */
+#define RADIO_STATE_SCRATCH_LEN 256
+
+typedef INT (*field_reader_fn)(INT radioIndex, wifi_radio_state_t *state);
+
+/* Reads a string getter into a field, refusing values that would be truncated */
+static INT read_string(INT (*getter)(INT, CHAR *), INT radioIndex, CHAR *field, size_t size)
+{
+    CHAR scratch[RADIO_STATE_SCRATCH_LEN] = {0};
+
+    if (getter(radioIndex, scratch) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    scratch[sizeof(scratch) - 1] = '\0';
+    if (strlen(scratch) >= size)
+    {
+        return RETURN_ERR;
+    }
+    strcpy(field, scratch);
+    return RETURN_OK;
+}
+
+#define STRING_READER(name, getter, field) \
+    static INT name(INT radioIndex, wifi_radio_state_t *state) \
+    { \
+        return read_string(getter, radioIndex, state->field, sizeof(state->field)); \
+    }
+
+#define VALUE_READER(name, getter, field) \
+    static INT name(INT radioIndex, wifi_radio_state_t *state) \
+    { \
+        return getter(radioIndex, &state->field); \
+    }
+
+VALUE_READER(read_enable, wifi_getRadioEnable, enable)
+STRING_READER(read_status, wifi_getRadioStatus, status)
+STRING_READER(read_operating_frequency_band, wifi_getRadioOperatingFrequencyBand, operatingFrequencyBand)
+STRING_READER(read_possible_channels, wifi_getRadioPossibleChannels, possibleChannels)
+STRING_READER(read_channels_in_use, wifi_getRadioChannelsInUse, channelsInUse)
+VALUE_READER(read_channel, wifi_getRadioChannel, channel)
+VALUE_READER(read_auto_channel_supported, wifi_getRadioAutoChannelSupported, autoChannelSupported)
+VALUE_READER(read_auto_channel_enable, wifi_getRadioAutoChannelEnable, autoChannelEnable)
+VALUE_READER(read_auto_channel_refresh_period, wifi_getRadioAutoChannelRefreshPeriod, autoChannelRefreshPeriod)
+STRING_READER(read_guard_interval, wifi_getRadioGuardInterval, guardInterval)
+STRING_READER(read_operating_channel_bandwidth, wifi_getRadioOperatingChannelBandwidth, operatingChannelBandwidth)
+STRING_READER(read_ext_channel, wifi_getRadioExtChannel, extChannel)
+VALUE_READER(read_mcs, wifi_getRadioMCS, mcs)
+VALUE_READER(read_transmit_power, wifi_getRadioTransmitPower, transmitPower)
+VALUE_READER(read_ieee80211h_supported, wifi_getRadioIEEE80211hSupported, ieee80211hSupported)
+VALUE_READER(read_ieee80211h_enabled, wifi_getRadioIEEE80211hEnabled, ieee80211hEnabled)
+STRING_READER(read_regulatory_domain, wifi_getRegulatoryDomain, regulatoryDomain)
+VALUE_READER(read_traffic_stats, wifi_getRadioTrafficStats, trafficStats)
+
+static INT read_standard(INT radioIndex, wifi_radio_state_t *state)
+{
+    CHAR scratch[RADIO_STATE_SCRATCH_LEN] = {0};
+
+    if (wifi_getRadioStandard(radioIndex, scratch, &state->gOnly, &state->nOnly, &state->acOnly) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    scratch[sizeof(scratch) - 1] = '\0';
+    if (strlen(scratch) >= sizeof(state->standard))
+    {
+        return RETURN_ERR;
+    }
+    strcpy(state->standard, scratch);
+    return RETURN_OK;
+}
+
+/* Indexed by wifi_radio_state_field_t */
+static const field_reader_fn field_readers[WIFI_RADIO_STATE_FIELD_MAX] = {
+    read_enable,
+    read_status,
+    read_operating_frequency_band,
+    read_standard,
+    read_possible_channels,
+    read_channels_in_use,
+    read_channel,
+    read_auto_channel_supported,
+    read_auto_channel_enable,
+    read_auto_channel_refresh_period,
+    read_guard_interval,
+    read_operating_channel_bandwidth,
+    read_ext_channel,
+    read_mcs,
+    read_transmit_power,
+    read_ieee80211h_supported,
+    read_ieee80211h_enabled,
+    read_regulatory_domain,
+    read_traffic_stats,
+};
+
+INT wifi_radio_state_get(INT radioIndex, wifi_radio_state_t *state)
+{
+    if (state == NULL)
+    {
+        return RETURN_ERR;
+    }
+    memset(state, 0, sizeof(*state));
+    state->radioIndex = radioIndex;
+
+    for (int field = 0; field < WIFI_RADIO_STATE_FIELD_MAX; field++)
+    {
+        if (field_readers[field](radioIndex, state) == RETURN_OK)
+        {
+            state->valid |= WIFI_RADIO_STATE_BIT(field);
+        }
+    }
+    return (state->valid != 0) ? RETURN_OK : RETURN_ERR;
+}
+
+INT wifi_radio_state_get_all(wifi_radio_state_t *states, ULONG max_radios, ULONG *output_count)
+{
+    ULONG radios = 0;
+    INT ret = RETURN_OK;
+
+    if (states == NULL || output_count == NULL || max_radios == 0)
+    {
+        return RETURN_ERR;
+    }
+    *output_count = 0;
+    if (wifi_getRadioNumberOfEntries(&radios) != RETURN_OK)
+    {
+        return RETURN_ERR;
+    }
+    if (radios > max_radios)
+    {
+        radios = max_radios;
+    }
+
+    /* Radio indices start at 1 */
+    for (ULONG i = 0; i < radios; i++)
+    {
+        if (wifi_radio_state_get((INT)(i + 1), &states[i]) != RETURN_OK)
+        {
+            ret = RETURN_ERR;
+        }
+    }
+    *output_count = radios;
+    return ret;
+}
+
+UINT wifi_radio_state_field_count(uint32_t valid)
+{
+    return (UINT)__builtin_popcount(valid & WIFI_RADIO_STATE_ALL);
+}
+
+/** @} */ // End of RDKV_WIFI_RADIO_STATE
@@ -0,0 +1,424 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_SCAN_CACHE RDK-V WiFi Scan Result Cache
+ * @{
+ */
+
+/**
+* @file wifi_scan_cache.c
+*
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "wifi_perf_clock.h"
+#include "wifi_scan_cache.h"
+
+#define SCAN_CACHE_SSID_LEN 64
+
+typedef enum
+{
+    SCAN_KIND_NEIGHBOR = 0,
+    SCAN_KIND_SSID
+} scan_kind_t;
+
+typedef struct scan_entry
+{
+    struct scan_entry *next;
+
+    /* Key */
+    scan_kind_t kind;
+    INT radio_index;
+    WIFI_HAL_FREQ_BAND band;
+    char ssid[SCAN_CACHE_SSID_LEN];
+
+    /* Cached result, owned by the cache */
+    int valid;
+    uint64_t timestamp_ns;
+    uint64_t last_used_ns;
+    wifi_neighbor_ap_t *aps;
+    UINT count;
+
+    /* In-flight scan shared by every caller asking for this key */
+    int in_flight;
+    uint64_t generation;
+    INT last_result;
+    uint64_t last_scan_ns;
+    UINT waiters;
+    pthread_cond_t done;
+} scan_entry_t;
+
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static int cache_initialised = 0;
+static wifi_scan_cache_config_t cache_config;
+static scan_entry_t *cache_entries = NULL;
+static UINT cache_entry_count = 0;
+static wifi_scan_cache_stats_t cache_stats;
+
+static void entry_free(scan_entry_t *entry)
+{
+    pthread_cond_destroy(&entry->done);
+    free(entry->aps);
+    free(entry);
+}
+
+/* Unlinks and frees *link. Called with cache_lock held. */
+static void entry_evict(scan_entry_t **link)
+{
+    scan_entry_t *entry = *link;
+
+    *link = entry->next;
+    entry_free(entry);
+    cache_entry_count--;
+    cache_stats.evicted++;
+}
+
+/* An entry with a scan in flight or callers waiting on it must stay */
+static int entry_idle(const scan_entry_t *entry)
+{
+    return !entry->in_flight && entry->waiters == 0;
+}
+
+/*
+ * Makes room for one more entry: frees every idle entry without a fresh result,
+ * then the least recently used idle entries while the cache is full. Called with
+ * cache_lock held.
+ */
+static void entries_trim(uint64_t now)
+{
+    uint64_t max_age_ns = (uint64_t)cache_config.max_age_ms * 1000000ULL;
+    scan_entry_t **link = &cache_entries;
+
+    while (*link != NULL)
+    {
+        if (entry_idle(*link) && (!(*link)->valid || (now - (*link)->timestamp_ns) >= max_age_ns))
+        {
+            entry_evict(link);
+        }
+        else
+        {
+            link = &(*link)->next;
+        }
+    }
+
+    while (cache_entry_count >= cache_config.max_entries)
+    {
+        scan_entry_t **oldest = NULL;
+
+        for (link = &cache_entries; *link != NULL; link = &(*link)->next)
+        {
+            if (entry_idle(*link) && (oldest == NULL || (*link)->last_used_ns < (*oldest)->last_used_ns))
+            {
+                oldest = link;
+            }
+        }
+        if (oldest == NULL)
+        {
+            /* Every entry is busy, go over the limit until one is released */
+            break;
+        }
+        entry_evict(oldest);
+    }
+}
+
+static scan_entry_t *entry_find(scan_kind_t kind, INT radio_index, const char *ssid, WIFI_HAL_FREQ_BAND band, uint64_t now)
+{
+    scan_entry_t *entry;
+
+    for (entry = cache_entries; entry != NULL; entry = entry->next)
+    {
+        if (entry->kind != kind)
+        {
+            continue;
+        }
+        if (kind == SCAN_KIND_NEIGHBOR && entry->radio_index == radio_index)
+        {
+            return entry;
+        }
+        if (kind == SCAN_KIND_SSID && entry->band == band && strncmp(entry->ssid, ssid, sizeof(entry->ssid)) == 0)
+        {
+            return entry;
+        }
+    }
+
+    entries_trim(now);
+    entry = calloc(1, sizeof(scan_entry_t));
+    if (entry == NULL)
+    {
+        return NULL;
+    }
+    entry->kind = kind;
+    entry->radio_index = radio_index;
+    entry->band = band;
+    if (ssid != NULL)
+    {
+        strncpy(entry->ssid, ssid, sizeof(entry->ssid) - 1);
+    }
+    pthread_cond_init(&entry->done, NULL);
+    entry->next = cache_entries;
+    cache_entries = entry;
+    cache_entry_count++;
+    return entry;
+}
+
+/* Hands the caller its own copy of the cached array. Called with cache_lock held. */
+static INT entry_copy_out(const scan_entry_t *entry, wifi_neighbor_ap_t **ap_array, UINT *output_array_size)
+{
+    *ap_array = NULL;
+    *output_array_size = 0;
+    if (entry->count == 0 || entry->aps == NULL)
+    {
+        return RETURN_OK;
+    }
+    *ap_array = malloc(entry->count * sizeof(wifi_neighbor_ap_t));
+    if (*ap_array == NULL)
+    {
+        return RETURN_ERR;
+    }
+    memcpy(*ap_array, entry->aps, entry->count * sizeof(wifi_neighbor_ap_t));
+    *output_array_size = entry->count;
+    return RETURN_OK;
+}
+
+static uint64_t mean_scan_ns(void)
+{
+    return (cache_stats.scans != 0) ? cache_stats.scan_ns / cache_stats.scans : 0;
+}
+
+static INT cached_scan(scan_kind_t kind, INT radio_index, const char *ssid, WIFI_HAL_FREQ_BAND band,
+                       wifi_neighbor_ap_t **ap_array, UINT *output_array_size)
+{
+    scan_entry_t *entry;
+    wifi_neighbor_ap_t *aps = NULL;
+    UINT count = 0;
+    uint64_t start;
+    uint64_t scan_ns;
+    INT ret;
+
+    if (ap_array == NULL || output_array_size == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    start = wifi_perf_now_ns();
+    pthread_mutex_lock(&cache_lock);
+    if (!cache_initialised)
+    {
+        pthread_mutex_unlock(&cache_lock);
+        return RETURN_ERR;
+    }
+    cache_stats.requests++;
+
+    entry = entry_find(kind, radio_index, ssid, band, start);
+    if (entry == NULL)
+    {
+        pthread_mutex_unlock(&cache_lock);
+        return RETURN_ERR;
+    }
+    entry->last_used_ns = start;
+
+    if (entry->valid && (start - entry->timestamp_ns) < (uint64_t)cache_config.max_age_ms * 1000000ULL)
+    {
+        cache_stats.hits++;
+        cache_stats.saved_ns += mean_scan_ns();
+        ret = entry_copy_out(entry, ap_array, output_array_size);
+        pthread_mutex_unlock(&cache_lock);
+        return ret;
+    }
+
+    if (entry->in_flight)
+    {
+        uint64_t generation = entry->generation;
+        uint64_t waited;
+
+        /* Keeps the entry from being evicted between the broadcast and this caller waking up */
+        entry->waiters++;
+        while (entry->generation == generation)
+        {
+            pthread_cond_wait(&entry->done, &cache_lock);
+        }
+        entry->waiters--;
+        cache_stats.coalesced++;
+        waited = wifi_perf_now_ns() - start;
+        if (entry->last_scan_ns > waited)
+        {
+            cache_stats.saved_ns += entry->last_scan_ns - waited;
+        }
+        ret = (entry->last_result == RETURN_OK) ? entry_copy_out(entry, ap_array, output_array_size) : entry->last_result;
+        pthread_mutex_unlock(&cache_lock);
+        return ret;
+    }
+
+    /* This caller runs the scan, everyone else arriving meanwhile waits on entry->done */
+    entry->in_flight = 1;
+    pthread_mutex_unlock(&cache_lock);
+
+    start = wifi_perf_now_ns();
+    if (kind == SCAN_KIND_NEIGHBOR)
+    {
+        ret = cache_config.neighbor_fn(radio_index, &aps, &count);
+    }
+    else
+    {
+        ret = cache_config.ssid_fn(ssid, band, &aps, &count);
+    }
+    scan_ns = wifi_perf_now_ns() - start;
+
+    pthread_mutex_lock(&cache_lock);
+    cache_stats.scans++;
+    cache_stats.scan_ns += scan_ns;
+    if (ret == RETURN_OK)
+    {
+        free(entry->aps);
+        entry->aps = aps;
+        entry->count = (aps != NULL) ? count : 0;
+        entry->valid = 1;
+        entry->timestamp_ns = wifi_perf_now_ns();
+    }
+    else
+    {
+        free(aps);
+        cache_stats.errors++;
+        entry->valid = 0;
+    }
+    entry->last_result = ret;
+    entry->last_scan_ns = scan_ns;
+    entry->in_flight = 0;
+    entry->generation++;
+    pthread_cond_broadcast(&entry->done);
+
+    if (ret == RETURN_OK)
+    {
+        ret = entry_copy_out(entry, ap_array, output_array_size);
+    }
+    pthread_mutex_unlock(&cache_lock);
+    return ret;
+}
+
+INT wifi_scan_cache_init(const wifi_scan_cache_config_t *config)
+{
+    pthread_mutex_lock(&cache_lock);
+    if (cache_initialised)
+    {
+        pthread_mutex_unlock(&cache_lock);
+        return RETURN_ERR;
+    }
+    memset(&cache_config, 0, sizeof(cache_config));
+    cache_config.max_age_ms = WIFI_SCAN_CACHE_DEFAULT_MAX_AGE_MS;
+    if (config != NULL)
+    {
+        cache_config = *config;
+    }
+    if (cache_config.neighbor_fn == NULL)
+    {
+        cache_config.neighbor_fn = wifi_getNeighboringWiFiDiagnosticResult;
+    }
+    if (cache_config.ssid_fn == NULL)
+    {
+        cache_config.ssid_fn = wifi_getSpecificSSIDInfo;
+    }
+    if (cache_config.max_entries == 0)
+    {
+        cache_config.max_entries = WIFI_SCAN_CACHE_DEFAULT_MAX_ENTRIES;
+    }
+    memset(&cache_stats, 0, sizeof(cache_stats));
+    cache_initialised = 1;
+    pthread_mutex_unlock(&cache_lock);
+    return RETURN_OK;
+}
+
+void wifi_scan_cache_deinit(void)
+{
+    scan_entry_t *entry;
+
+    pthread_mutex_lock(&cache_lock);
+    while (cache_entries != NULL)
+    {
+        entry = cache_entries;
+        cache_entries = entry->next;
+        entry_free(entry);
+    }
+    cache_entry_count = 0;
+    cache_initialised = 0;
+    pthread_mutex_unlock(&cache_lock);
+}
+
+void wifi_scan_cache_set_max_age(UINT max_age_ms)
+{
+    pthread_mutex_lock(&cache_lock);
+    cache_config.max_age_ms = max_age_ms;
+    pthread_mutex_unlock(&cache_lock);
+}
+
+void wifi_scan_cache_invalidate(void)
+{
+    scan_entry_t *entry;
+
+    pthread_mutex_lock(&cache_lock);
+    for (entry = cache_entries; entry != NULL; entry = entry->next)
+    {
+        entry->valid = 0;
+    }
+    pthread_mutex_unlock(&cache_lock);
+}
+
+INT wifi_scan_cache_getNeighboringWiFiDiagnosticResult(INT radioIndex, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size)
+{
+    return cached_scan(SCAN_KIND_NEIGHBOR, radioIndex, NULL, WIFI_HAL_FREQ_BAND_NONE, neighbor_ap_array, output_array_size);
+}
+
+INT wifi_scan_cache_getSpecificSSIDInfo(const char *SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t **ap_array, UINT *output_array_size)
+{
+    if (SSID == NULL)
+    {
+        return RETURN_ERR;
+    }
+    return cached_scan(SCAN_KIND_SSID, 0, SSID, band, ap_array, output_array_size);
+}
+
+void wifi_scan_cache_get_stats(wifi_scan_cache_stats_t *stats)
+{
+    if (stats == NULL)
+    {
+        return;
+    }
+    pthread_mutex_lock(&cache_lock);
+    *stats = cache_stats;
+    pthread_mutex_unlock(&cache_lock);
+}
+
+void wifi_scan_cache_reset_stats(void)
+{
+    pthread_mutex_lock(&cache_lock);
+    memset(&cache_stats, 0, sizeof(cache_stats));
+    pthread_mutex_unlock(&cache_lock);
+}
+
+double wifi_scan_cache_hit_rate(const wifi_scan_cache_stats_t *stats)
+{
+    if (stats == NULL || stats->requests == 0)
+    {
+        return 0.0;
+    }
+    return (double)(stats->hits + stats->coalesced) / (double)stats->requests;
+}
+
+/** @} */ // End of RDKV_WIFI_SCAN_CACHE
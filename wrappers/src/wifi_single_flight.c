@@ -0,0 +1,276 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @addtogroup RDKV_WIFI_SINGLE_FLIGHT RDK-V WiFi Single-Flight Getters
+ * @{
+ */
+
+/**
+* @file wifi_single_flight.c
+*
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "wifi_single_flight.h"
+
+typedef union
+{
+    ULONG ulong;
+    CHAR string[WIFI_SINGLE_FLIGHT_STRING_LEN];
+} flight_value_t;
+
+typedef struct flight
+{
+    struct flight *next;
+
+    /* Key */
+    wifi_single_flight_getter_t getter;
+    INT radio_index;
+
+    /* Outcome of the most recent HAL call, handed to every caller that waited for it */
+    int in_flight;
+    uint64_t generation;
+    INT result;
+    flight_value_t value;
+    pthread_cond_t done;
+} flight_t;
+
+static pthread_mutex_t flight_lock = PTHREAD_MUTEX_INITIALIZER;
+static int flight_initialised = 0;
+static wifi_single_flight_config_t flight_config;
+static flight_t *flights = NULL;
+static wifi_single_flight_stats_t flight_stats[WIFI_SINGLE_FLIGHT_MAX];
+
+static flight_t *flight_find(wifi_single_flight_getter_t getter, INT radio_index)
+{
+    flight_t *flight;
+
+    for (flight = flights; flight != NULL; flight = flight->next)
+    {
+        if (flight->getter == getter && flight->radio_index == radio_index)
+        {
+            return flight;
+        }
+    }
+
+    flight = calloc(1, sizeof(flight_t));
+    if (flight == NULL)
+    {
+        return NULL;
+    }
+    flight->getter = getter;
+    flight->radio_index = radio_index;
+    pthread_cond_init(&flight->done, NULL);
+    flight->next = flights;
+    flights = flight;
+    return flight;
+}
+
+static INT flight_call_hal(wifi_single_flight_getter_t getter, INT radio_index, flight_value_t *value)
+{
+    switch (getter)
+    {
+        case WIFI_SINGLE_FLIGHT_RADIO_CHANNEL:
+            return flight_config.getRadioChannel(radio_index, &value->ulong);
+        case WIFI_SINGLE_FLIGHT_REGULATORY_DOMAIN:
+            return flight_config.getRegulatoryDomain(radio_index, value->string);
+        case WIFI_SINGLE_FLIGHT_RADIO_POSSIBLE_CHANNELS:
+            return flight_config.getRadioPossibleChannels(radio_index, value->string);
+        default:
+            return RETURN_ERR;
+    }
+}
+
+static INT single_flight(wifi_single_flight_getter_t getter, INT radio_index, flight_value_t *value)
+{
+    flight_t *flight;
+    uint64_t generation;
+    INT ret;
+
+    pthread_mutex_lock(&flight_lock);
+    if (!flight_initialised)
+    {
+        pthread_mutex_unlock(&flight_lock);
+        return RETURN_ERR;
+    }
+    flight_stats[getter].requests++;
+
+    flight = flight_find(getter, radio_index);
+    if (flight == NULL)
+    {
+        pthread_mutex_unlock(&flight_lock);
+        return RETURN_ERR;
+    }
+
+    if (flight->in_flight)
+    {
+        generation = flight->generation;
+        while (flight->generation == generation)
+        {
+            pthread_cond_wait(&flight->done, &flight_lock);
+        }
+        flight_stats[getter].shared++;
+        *value = flight->value;
+        ret = flight->result;
+        pthread_mutex_unlock(&flight_lock);
+        return ret;
+    }
+
+    /* This caller reaches the HAL, everyone else asking meanwhile waits on flight->done */
+    flight->in_flight = 1;
+    flight_stats[getter].hal_calls++;
+    pthread_mutex_unlock(&flight_lock);
+
+    memset(value, 0, sizeof(*value));
+    ret = flight_call_hal(getter, radio_index, value);
+    value->string[WIFI_SINGLE_FLIGHT_STRING_LEN - 1] = '\0';
+
+    pthread_mutex_lock(&flight_lock);
+    if (ret != RETURN_OK)
+    {
+        flight_stats[getter].errors++;
+    }
+    flight->value = *value;
+    flight->result = ret;
+    flight->in_flight = 0;
+    flight->generation++;
+    pthread_cond_broadcast(&flight->done);
+    pthread_mutex_unlock(&flight_lock);
+    return ret;
+}
+
+INT wifi_single_flight_init(const wifi_single_flight_config_t *config)
+{
+    pthread_mutex_lock(&flight_lock);
+    if (flight_initialised)
+    {
+        pthread_mutex_unlock(&flight_lock);
+        return RETURN_ERR;
+    }
+    memset(&flight_config, 0, sizeof(flight_config));
+    if (config != NULL)
+    {
+        flight_config = *config;
+    }
+    if (flight_config.getRadioChannel == NULL)
+    {
+        flight_config.getRadioChannel = wifi_getRadioChannel;
+    }
+    if (flight_config.getRegulatoryDomain == NULL)
+    {
+        flight_config.getRegulatoryDomain = wifi_getRegulatoryDomain;
+    }
+    if (flight_config.getRadioPossibleChannels == NULL)
+    {
+        flight_config.getRadioPossibleChannels = wifi_getRadioPossibleChannels;
+    }
+    memset(flight_stats, 0, sizeof(flight_stats));
+    flight_initialised = 1;
+    pthread_mutex_unlock(&flight_lock);
+    return RETURN_OK;
+}
+
+void wifi_single_flight_deinit(void)
+{
+    flight_t *flight;
+
+    pthread_mutex_lock(&flight_lock);
+    while (flights != NULL)
+    {
+        flight = flights;
+        flights = flight->next;
+        pthread_cond_destroy(&flight->done);
+        free(flight);
+    }
+    flight_initialised = 0;
+    pthread_mutex_unlock(&flight_lock);
+}
+
+INT wifi_single_flight_getRadioChannel(INT radioIndex, ULONG *output_ulong)
+{
+    flight_value_t value;
+    INT ret;
+
+    if (output_ulong == NULL)
+    {
+        return RETURN_ERR;
+    }
+    ret = single_flight(WIFI_SINGLE_FLIGHT_RADIO_CHANNEL, radioIndex, &value);
+    if (ret == RETURN_OK)
+    {
+        *output_ulong = value.ulong;
+    }
+    return ret;
+}
+
+INT wifi_single_flight_getRegulatoryDomain(INT radioIndex, CHAR *output_string)
+{
+    flight_value_t value;
+    INT ret;
+
+    if (output_string == NULL)
+    {
+        return RETURN_ERR;
+    }
+    ret = single_flight(WIFI_SINGLE_FLIGHT_REGULATORY_DOMAIN, radioIndex, &value);
+    if (ret == RETURN_OK)
+    {
+        strcpy(output_string, value.string);
+    }
+    return ret;
+}
+
+INT wifi_single_flight_getRadioPossibleChannels(INT radioIndex, CHAR *output_string)
+{
+    flight_value_t value;
+    INT ret;
+
+    if (output_string == NULL)
+    {
+        return RETURN_ERR;
+    }
+    ret = single_flight(WIFI_SINGLE_FLIGHT_RADIO_POSSIBLE_CHANNELS, radioIndex, &value);
+    if (ret == RETURN_OK)
+    {
+        strcpy(output_string, value.string);
+    }
+    return ret;
+}
+
+void wifi_single_flight_get_stats(wifi_single_flight_getter_t getter, wifi_single_flight_stats_t *stats)
+{
+    if (stats == NULL || getter >= WIFI_SINGLE_FLIGHT_MAX)
+    {
+        return;
+    }
+    pthread_mutex_lock(&flight_lock);
+    *stats = flight_stats[getter];
+    pthread_mutex_unlock(&flight_lock);
+}
+
+void wifi_single_flight_reset_stats(void)
+{
+    pthread_mutex_lock(&flight_lock);
+    memset(flight_stats, 0, sizeof(flight_stats));
+    pthread_mutex_unlock(&flight_lock);
+}
+
+/** @} */ // End of RDKV_WIFI_SINGLE_FLIGHT